@@ -8196,8181 +8196,8182 @@ CREATE TABLE `item_enchantment_random_suffixes` (
   `ItemSubClassMask` int unsigned DEFAULT '0',
   `EnchantQuality` int unsigned DEFAULT '0',
   `EnchantCategoryMask` int unsigned DEFAULT '0',
+  `Weight` int unsigned DEFAULT '1',
   PRIMARY KEY (`SuffixID`)
 ) ENGINE=MyISAM DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_0900_ai_ci;
-INSERT INTO item_enchantment_random_suffixes (SuffixID,MinLevel,MaxLevel,AttributeMask,ItemClass,ItemSubClassMask,EnchantQuality,EnchantCategoryMask)
+INSERT INTO item_enchantment_random_suffixes (SuffixID,MinLevel,MaxLevel,AttributeMask,ItemClass,ItemSubClassMask,EnchantQuality,EnchantCategoryMask,Weight)
 VALUES
-(1000,0,0,1,0,0,0,0),
-(1001,0,0,1,0,0,1,0),
-(1002,0,0,1,0,0,2,0),
-(1003,0,0,1,0,0,3,0),
-(1004,0,0,2,0,0,0,0),
-(1005,0,0,2,0,0,1,0),
-(1006,0,0,2,0,0,2,0),
-(1007,0,0,2,0,0,3,0),
-(1008,0,0,4,0,0,0,0),
-(1009,0,0,4,0,0,1,0),
-(1010,0,0,4,0,0,2,0),
-(1011,0,0,4,0,0,3,0),
-(1012,0,0,8,0,0,0,0),
-(1013,0,0,8,0,0,1,0),
-(1014,0,0,8,0,0,2,0),
-(1015,0,0,8,0,0,3,0),
-(1016,0,0,16,0,0,0,0),
-(1017,0,0,16,0,0,1,0),
-(1018,0,0,16,0,0,2,0),
-(1019,0,0,16,0,0,3,0),
-(1020,0,0,32,0,0,0,0),
-(1021,0,0,32,0,0,1,0),
-(1022,0,0,32,0,0,2,0),
-(1023,0,0,32,0,0,3,0),
-(1024,0,0,64,0,0,0,0),
-(1025,0,0,64,0,0,1,0),
-(1026,0,0,64,0,0,2,0),
-(1027,0,0,64,0,0,3,0),
-(1028,0,0,128,0,0,0,0),
-(1029,0,0,128,0,0,1,0),
-(1030,0,0,128,0,0,2,0),
-(1031,0,0,128,0,0,3,0),
-(1032,0,0,256,0,0,0,0),
-(1033,0,0,256,0,0,1,0),
-(1034,0,0,256,0,0,2,0),
-(1035,0,0,256,0,0,3,0),
-(1036,0,0,512,0,0,0,0),
-(1037,0,0,512,0,0,1,0),
-(1038,0,0,512,0,0,2,0),
-(1039,0,0,512,0,0,3,0),
-(1040,0,0,1024,0,0,0,0),
-(1041,0,0,1024,0,0,1,0),
-(1042,0,0,1024,0,0,2,0),
-(1043,0,0,1024,0,0,3,0),
-(1044,0,0,2048,0,0,0,0),
-(1045,0,0,2048,0,0,1,0),
-(1046,0,0,2048,0,0,2,0),
-(1047,0,0,2048,0,0,3,0),
-(1048,0,0,4096,0,0,0,0),
-(1049,0,0,4096,0,0,1,0),
-(1050,0,0,4096,0,0,2,0),
-(1051,0,0,4096,0,0,3,0),
-(1052,0,0,8192,0,0,0,0),
-(1053,0,0,8192,0,0,1,0),
-(1054,0,0,8192,0,0,2,0),
-(1055,0,0,8192,0,0,3,0),
-(1056,0,0,3,0,0,0,0),
-(1057,0,0,3,0,0,1,0),
-(1058,0,0,3,0,0,2,0),
-(1059,0,0,3,0,0,3,0),
-(1060,0,0,5,0,0,0,0),
-(1061,0,0,5,0,0,1,0),
-(1062,0,0,5,0,0,2,0),
-(1063,0,0,5,0,0,3,0),
-(1064,0,0,17,0,0,0,0),
-(1065,0,0,17,0,0,1,0),
-(1066,0,0,17,0,0,2,0),
-(1067,0,0,17,0,0,3,0),
-(1068,0,0,33,0,0,0,0),
-(1069,0,0,33,0,0,1,0),
-(1070,0,0,33,0,0,2,0),
-(1071,0,0,33,0,0,3,0),
-(1072,0,0,65,0,0,0,0),
-(1073,0,0,65,0,0,1,0),
-(1074,0,0,65,0,0,2,0),
-(1075,0,0,65,0,0,3,0),
-(1076,0,0,129,0,0,0,0),
-(1077,0,0,129,0,0,1,0),
-(1078,0,0,129,0,0,2,0),
-(1079,0,0,129,0,0,3,0),
-(1080,0,0,257,0,0,0,0),
-(1081,0,0,257,0,0,1,0),
-(1082,0,0,257,0,0,2,0),
-(1083,0,0,257,0,0,3,0),
-(1084,0,0,513,0,0,0,0),
-(1085,0,0,513,0,0,1,0),
-(1086,0,0,513,0,0,2,0),
-(1087,0,0,513,0,0,3,0),
-(1088,0,0,1025,0,0,0,0),
-(1089,0,0,1025,0,0,1,0),
-(1090,0,0,1025,0,0,2,0),
-(1091,0,0,1025,0,0,3,0),
-(1092,0,0,2049,0,0,0,0),
-(1093,0,0,2049,0,0,1,0),
-(1094,0,0,2049,0,0,2,0),
-(1095,0,0,2049,0,0,3,0),
-(1096,0,0,4097,0,0,0,0),
-(1097,0,0,4097,0,0,1,0),
-(1098,0,0,4097,0,0,2,0),
-(1099,0,0,4097,0,0,3,0),
-(1100,0,0,8193,0,0,0,0),
-(1101,0,0,8193,0,0,1,0),
-(1102,0,0,8193,0,0,2,0),
-(1103,0,0,8193,0,0,3,0),
-(1104,0,0,6,0,0,0,0),
-(1105,0,0,6,0,0,1,0),
-(1106,0,0,6,0,0,2,0),
-(1107,0,0,6,0,0,3,0),
-(1108,0,0,18,0,0,0,0),
-(1109,0,0,18,0,0,1,0),
-(1110,0,0,18,0,0,2,0),
-(1111,0,0,18,0,0,3,0),
-(1112,0,0,34,0,0,0,0),
-(1113,0,0,34,0,0,1,0),
-(1114,0,0,34,0,0,2,0),
-(1115,0,0,34,0,0,3,0),
-(1116,0,0,66,0,0,0,0),
-(1117,0,0,66,0,0,1,0),
-(1118,0,0,66,0,0,2,0),
-(1119,0,0,66,0,0,3,0),
-(1120,0,0,130,0,0,0,0),
-(1121,0,0,130,0,0,1,0),
-(1122,0,0,130,0,0,2,0),
-(1123,0,0,130,0,0,3,0),
-(1124,0,0,258,0,0,0,0),
-(1125,0,0,258,0,0,1,0),
-(1126,0,0,258,0,0,2,0),
-(1127,0,0,258,0,0,3,0),
-(1128,0,0,514,0,0,0,0),
-(1129,0,0,514,0,0,1,0),
-(1130,0,0,514,0,0,2,0),
-(1131,0,0,514,0,0,3,0),
-(1132,0,0,1026,0,0,0,0),
-(1133,0,0,1026,0,0,1,0),
-(1134,0,0,1026,0,0,2,0),
-(1135,0,0,1026,0,0,3,0),
-(1136,0,0,2050,0,0,0,0),
-(1137,0,0,2050,0,0,1,0),
-(1138,0,0,2050,0,0,2,0),
-(1139,0,0,2050,0,0,3,0),
-(1140,0,0,4098,0,0,0,0),
-(1141,0,0,4098,0,0,1,0),
-(1142,0,0,4098,0,0,2,0),
-(1143,0,0,4098,0,0,3,0),
-(1144,0,0,12,0,0,0,0),
-(1145,0,0,12,0,0,1,0),
-(1146,0,0,12,0,0,2,0),
-(1147,0,0,12,0,0,3,0),
-(1148,0,0,20,0,0,0,0),
-(1149,0,0,20,0,0,1,0),
-(1150,0,0,20,0,0,2,0),
-(1151,0,0,20,0,0,3,0),
-(1152,0,0,68,0,0,0,0),
-(1153,0,0,68,0,0,1,0),
-(1154,0,0,68,0,0,2,0),
-(1155,0,0,68,0,0,3,0),
-(1156,0,0,132,0,0,0,0),
-(1157,0,0,132,0,0,1,0),
-(1158,0,0,132,0,0,2,0),
-(1159,0,0,132,0,0,3,0),
-(1160,0,0,260,0,0,0,0),
-(1161,0,0,260,0,0,1,0),
-(1162,0,0,260,0,0,2,0),
-(1163,0,0,260,0,0,3,0),
-(1164,0,0,516,0,0,0,0),
-(1165,0,0,516,0,0,1,0),
-(1166,0,0,516,0,0,2,0),
-(1167,0,0,516,0,0,3,0),
-(1168,0,0,24,0,0,0,0),
-(1169,0,0,24,0,0,1,0),
-(1170,0,0,24,0,0,2,0),
-(1171,0,0,24,0,0,3,0),
-(1172,0,0,72,0,0,0,0),
-(1173,0,0,72,0,0,1,0),
-(1174,0,0,72,0,0,2,0),
-(1175,0,0,72,0,0,3,0),
-(1176,0,0,136,0,0,0,0),
-(1177,0,0,136,0,0,1,0),
-(1178,0,0,136,0,0,2,0),
-(1179,0,0,136,0,0,3,0),
-(1180,0,0,264,0,0,0,0),
-(1181,0,0,264,0,0,1,0),
-(1182,0,0,264,0,0,2,0),
-(1183,0,0,264,0,0,3,0),
-(1184,0,0,520,0,0,0,0),
-(1185,0,0,520,0,0,1,0),
-(1186,0,0,520,0,0,2,0),
-(1187,0,0,520,0,0,3,0),
-(1188,0,0,48,0,0,0,0),
-(1189,0,0,48,0,0,1,0),
-(1190,0,0,48,0,0,2,0),
-(1191,0,0,48,0,0,3,0),
-(1192,0,0,80,0,0,0,0),
-(1193,0,0,80,0,0,1,0),
-(1194,0,0,80,0,0,2,0),
-(1195,0,0,80,0,0,3,0),
-(1196,0,0,144,0,0,0,0),
-(1197,0,0,144,0,0,1,0),
-(1198,0,0,144,0,0,2,0),
-(1199,0,0,144,0,0,3,0),
-(1200,0,0,272,0,0,0,0),
-(1201,0,0,272,0,0,1,0),
-(1202,0,0,272,0,0,2,0),
-(1203,0,0,272,0,0,3,0),
-(1204,0,0,528,0,0,0,0),
-(1205,0,0,528,0,0,1,0),
-(1206,0,0,528,0,0,2,0),
-(1207,0,0,528,0,0,3,0),
-(1208,0,0,1040,0,0,0,0),
-(1209,0,0,1040,0,0,1,0),
-(1210,0,0,1040,0,0,2,0),
-(1211,0,0,1040,0,0,3,0),
-(1212,0,0,2064,0,0,0,0),
-(1213,0,0,2064,0,0,1,0),
-(1214,0,0,2064,0,0,2,0),
-(1215,0,0,2064,0,0,3,0),
-(1216,0,0,4112,0,0,0,0),
-(1217,0,0,4112,0,0,1,0),
-(1218,0,0,4112,0,0,2,0),
-(1219,0,0,4112,0,0,3,0),
-(1220,0,0,8208,0,0,0,0),
-(1221,0,0,8208,0,0,1,0),
-(1222,0,0,8208,0,0,2,0),
-(1223,0,0,8208,0,0,3,0),
-(1224,0,0,160,0,0,0,0),
-(1225,0,0,160,0,0,1,0),
-(1226,0,0,160,0,0,2,0),
-(1227,0,0,160,0,0,3,0),
-(1228,0,0,288,0,0,0,0),
-(1229,0,0,288,0,0,1,0),
-(1230,0,0,288,0,0,2,0),
-(1231,0,0,288,0,0,3,0),
-(1232,0,0,544,0,0,0,0),
-(1233,0,0,544,0,0,1,0),
-(1234,0,0,544,0,0,2,0),
-(1235,0,0,544,0,0,3,0),
-(1236,0,0,1056,0,0,0,0),
-(1237,0,0,1056,0,0,1,0),
-(1238,0,0,1056,0,0,2,0),
-(1239,0,0,1056,0,0,3,0),
-(1240,0,0,2080,0,0,0,0),
-(1241,0,0,2080,0,0,1,0),
-(1242,0,0,2080,0,0,2,0),
-(1243,0,0,2080,0,0,3,0),
-(1244,0,0,4128,0,0,0,0),
-(1245,0,0,4128,0,0,1,0),
-(1246,0,0,4128,0,0,2,0),
-(1247,0,0,4128,0,0,3,0),
-(1248,0,0,8224,0,0,0,0),
-(1249,0,0,8224,0,0,1,0),
-(1250,0,0,8224,0,0,2,0),
-(1251,0,0,8224,0,0,3,0),
-(1252,0,0,192,0,0,0,0),
-(1253,0,0,192,0,0,1,0),
-(1254,0,0,192,0,0,2,0),
-(1255,0,0,192,0,0,3,0),
-(1256,0,0,320,0,0,0,0),
-(1257,0,0,320,0,0,1,0),
-(1258,0,0,320,0,0,2,0),
-(1259,0,0,320,0,0,3,0),
-(1260,0,0,576,0,0,0,0),
-(1261,0,0,576,0,0,1,0),
-(1262,0,0,576,0,0,2,0),
-(1263,0,0,576,0,0,3,0),
-(1264,0,0,384,0,0,0,0),
-(1265,0,0,384,0,0,1,0),
-(1266,0,0,384,0,0,2,0),
-(1267,0,0,384,0,0,3,0),
-(1268,0,0,640,0,0,0,0),
-(1269,0,0,640,0,0,1,0),
-(1270,0,0,640,0,0,2,0),
-(1271,0,0,640,0,0,3,0),
-(1272,0,0,1152,0,0,0,0),
-(1273,0,0,1152,0,0,1,0),
-(1274,0,0,1152,0,0,2,0),
-(1275,0,0,1152,0,0,3,0),
-(1276,0,0,2176,0,0,0,0),
-(1277,0,0,2176,0,0,1,0),
-(1278,0,0,2176,0,0,2,0),
-(1279,0,0,2176,0,0,3,0),
-(1280,0,0,4224,0,0,0,0),
-(1281,0,0,4224,0,0,1,0),
-(1282,0,0,4224,0,0,2,0),
-(1283,0,0,4224,0,0,3,0),
-(1284,0,0,8320,0,0,0,0),
-(1285,0,0,8320,0,0,1,0),
-(1286,0,0,8320,0,0,2,0),
-(1287,0,0,8320,0,0,3,0),
-(1288,0,0,768,0,0,0,0),
-(1289,0,0,768,0,0,1,0),
-(1290,0,0,768,0,0,2,0),
-(1291,0,0,768,0,0,3,0),
-(1292,0,0,1280,0,0,0,0),
-(1293,0,0,1280,0,0,1,0),
-(1294,0,0,1280,0,0,2,0),
-(1295,0,0,1280,0,0,3,0),
-(1296,0,0,2304,0,0,0,0),
-(1297,0,0,2304,0,0,1,0),
-(1298,0,0,2304,0,0,2,0),
-(1299,0,0,2304,0,0,3,0),
-(1300,0,0,4352,0,0,0,0),
-(1301,0,0,4352,0,0,1,0),
-(1302,0,0,4352,0,0,2,0),
-(1303,0,0,4352,0,0,3,0),
-(1304,0,0,8448,0,0,0,0),
-(1305,0,0,8448,0,0,1,0),
-(1306,0,0,8448,0,0,2,0),
-(1307,0,0,8448,0,0,3,0),
-(1308,0,0,1536,0,0,0,0),
-(1309,0,0,1536,0,0,1,0),
-(1310,0,0,1536,0,0,2,0),
-(1311,0,0,1536,0,0,3,0),
-(1312,0,0,2560,0,0,0,0),
-(1313,0,0,2560,0,0,1,0),
-(1314,0,0,2560,0,0,2,0),
-(1315,0,0,2560,0,0,3,0),
-(1316,0,0,4608,0,0,0,0),
-(1317,0,0,4608,0,0,1,0),
-(1318,0,0,4608,0,0,2,0),
-(1319,0,0,4608,0,0,3,0),
-(1320,0,0,8704,0,0,0,0),
-(1321,0,0,8704,0,0,1,0),
-(1322,0,0,8704,0,0,2,0),
-(1323,0,0,8704,0,0,3,0),
-(1324,0,0,3072,0,0,0,0),
-(1325,0,0,3072,0,0,1,0),
-(1326,0,0,3072,0,0,2,0),
-(1327,0,0,3072,0,0,3,0),
-(1328,0,0,5120,0,0,0,0),
-(1329,0,0,5120,0,0,1,0),
-(1330,0,0,5120,0,0,2,0),
-(1331,0,0,5120,0,0,3,0),
-(1332,0,0,9216,0,0,0,0),
-(1333,0,0,9216,0,0,1,0),
-(1334,0,0,9216,0,0,2,0),
-(1335,0,0,9216,0,0,3,0),
-(1336,0,0,6144,0,0,0,0),
-(1337,0,0,6144,0,0,1,0),
-(1338,0,0,6144,0,0,2,0),
-(1339,0,0,6144,0,0,3,0),
-(1340,0,0,10240,0,0,0,0),
-(1341,0,0,10240,0,0,1,0),
-(1342,0,0,10240,0,0,2,0),
-(1343,0,0,10240,0,0,3,0),
-(1344,0,0,12288,0,0,0,0),
-(1345,0,0,12288,0,0,1,0),
-(1346,0,0,12288,0,0,2,0),
-(1347,0,0,12288,0,0,3,0),
-(1348,0,0,19,0,0,0,0),
-(1349,0,0,19,0,0,1,0),
-(1350,0,0,19,0,0,2,0),
-(1351,0,0,19,0,0,3,0),
-(1352,0,0,35,0,0,0,0),
-(1353,0,0,35,0,0,1,0),
-(1354,0,0,35,0,0,2,0),
-(1355,0,0,35,0,0,3,0),
-(1356,0,0,67,0,0,0,0),
-(1357,0,0,67,0,0,1,0),
-(1358,0,0,67,0,0,2,0),
-(1359,0,0,67,0,0,3,0),
-(1360,0,0,131,0,0,0,0),
-(1361,0,0,131,0,0,1,0),
-(1362,0,0,131,0,0,2,0),
-(1363,0,0,131,0,0,3,0),
-(1364,0,0,259,0,0,0,0),
-(1365,0,0,259,0,0,1,0),
-(1366,0,0,259,0,0,2,0),
-(1367,0,0,259,0,0,3,0),
-(1368,0,0,515,0,0,0,0),
-(1369,0,0,515,0,0,1,0),
-(1370,0,0,515,0,0,2,0),
-(1371,0,0,515,0,0,3,0),
-(1372,0,0,1027,0,0,0,0),
-(1373,0,0,1027,0,0,1,0),
-(1374,0,0,1027,0,0,2,0),
-(1375,0,0,1027,0,0,3,0),
-(1376,0,0,2051,0,0,0,0),
-(1377,0,0,2051,0,0,1,0),
-(1378,0,0,2051,0,0,2,0),
-(1379,0,0,2051,0,0,3,0),
-(1380,0,0,4099,0,0,0,0),
-(1381,0,0,4099,0,0,1,0),
-(1382,0,0,4099,0,0,2,0),
-(1383,0,0,4099,0,0,3,0),
-(1384,0,0,21,0,0,0,0),
-(1385,0,0,21,0,0,1,0),
-(1386,0,0,21,0,0,2,0),
-(1387,0,0,21,0,0,3,0),
-(1388,0,0,37,0,0,0,0),
-(1389,0,0,37,0,0,1,0),
-(1390,0,0,37,0,0,2,0),
-(1391,0,0,37,0,0,3,0),
-(1392,0,0,69,0,0,0,0),
-(1393,0,0,69,0,0,1,0),
-(1394,0,0,69,0,0,2,0),
-(1395,0,0,69,0,0,3,0),
-(1396,0,0,133,0,0,0,0),
-(1397,0,0,133,0,0,1,0),
-(1398,0,0,133,0,0,2,0),
-(1399,0,0,133,0,0,3,0),
-(1400,0,0,261,0,0,0,0),
-(1401,0,0,261,0,0,1,0),
-(1402,0,0,261,0,0,2,0),
-(1403,0,0,261,0,0,3,0),
-(1404,0,0,517,0,0,0,0),
-(1405,0,0,517,0,0,1,0),
-(1406,0,0,517,0,0,2,0),
-(1407,0,0,517,0,0,3,0),
-(1408,0,0,1029,0,0,0,0),
-(1409,0,0,1029,0,0,1,0),
-(1410,0,0,1029,0,0,2,0),
-(1411,0,0,1029,0,0,3,0),
-(1412,0,0,2053,0,0,0,0),
-(1413,0,0,2053,0,0,1,0),
-(1414,0,0,2053,0,0,2,0),
-(1415,0,0,2053,0,0,3,0),
-(1416,0,0,4101,0,0,0,0),
-(1417,0,0,4101,0,0,1,0),
-(1418,0,0,4101,0,0,2,0),
-(1419,0,0,4101,0,0,3,0),
-(1420,0,0,8197,0,0,0,0),
-(1421,0,0,8197,0,0,1,0),
-(1422,0,0,8197,0,0,2,0),
-(1423,0,0,8197,0,0,3,0),
-(1424,0,0,49,0,0,0,0),
-(1425,0,0,49,0,0,1,0),
-(1426,0,0,49,0,0,2,0),
-(1427,0,0,49,0,0,3,0),
-(1428,0,0,81,0,0,0,0),
-(1429,0,0,81,0,0,1,0),
-(1430,0,0,81,0,0,2,0),
-(1431,0,0,81,0,0,3,0),
-(1432,0,0,145,0,0,0,0),
-(1433,0,0,145,0,0,1,0),
-(1434,0,0,145,0,0,2,0),
-(1435,0,0,145,0,0,3,0),
-(1436,0,0,273,0,0,0,0),
-(1437,0,0,273,0,0,1,0),
-(1438,0,0,273,0,0,2,0),
-(1439,0,0,273,0,0,3,0),
-(1440,0,0,529,0,0,0,0),
-(1441,0,0,529,0,0,1,0),
-(1442,0,0,529,0,0,2,0),
-(1443,0,0,529,0,0,3,0),
-(1444,0,0,1041,0,0,0,0),
-(1445,0,0,1041,0,0,1,0),
-(1446,0,0,1041,0,0,2,0),
-(1447,0,0,1041,0,0,3,0),
-(1448,0,0,2065,0,0,0,0),
-(1449,0,0,2065,0,0,1,0),
-(1450,0,0,2065,0,0,2,0),
-(1451,0,0,2065,0,0,3,0),
-(1452,0,0,4113,0,0,0,0),
-(1453,0,0,4113,0,0,1,0),
-(1454,0,0,4113,0,0,2,0),
-(1455,0,0,4113,0,0,3,0),
-(1456,0,0,8209,0,0,0,0),
-(1457,0,0,8209,0,0,1,0),
-(1458,0,0,8209,0,0,2,0),
-(1459,0,0,8209,0,0,3,0),
-(1460,0,0,97,0,0,0,0),
-(1461,0,0,97,0,0,1,0),
-(1462,0,0,97,0,0,2,0),
-(1463,0,0,97,0,0,3,0),
-(1464,0,0,161,0,0,0,0),
-(1465,0,0,161,0,0,1,0),
-(1466,0,0,161,0,0,2,0),
-(1467,0,0,161,0,0,3,0),
-(1468,0,0,289,0,0,0,0),
-(1469,0,0,289,0,0,1,0),
-(1470,0,0,289,0,0,2,0),
-(1471,0,0,289,0,0,3,0),
-(1472,0,0,545,0,0,0,0),
-(1473,0,0,545,0,0,1,0),
-(1474,0,0,545,0,0,2,0),
-(1475,0,0,545,0,0,3,0),
-(1476,0,0,1057,0,0,0,0),
-(1477,0,0,1057,0,0,1,0),
-(1478,0,0,1057,0,0,2,0),
-(1479,0,0,1057,0,0,3,0),
-(1480,0,0,2081,0,0,0,0),
-(1481,0,0,2081,0,0,1,0),
-(1482,0,0,2081,0,0,2,0),
-(1483,0,0,2081,0,0,3,0),
-(1484,0,0,4129,0,0,0,0),
-(1485,0,0,4129,0,0,1,0),
-(1486,0,0,4129,0,0,2,0),
-(1487,0,0,4129,0,0,3,0),
-(1488,0,0,8225,0,0,0,0),
-(1489,0,0,8225,0,0,1,0),
-(1490,0,0,8225,0,0,2,0),
-(1491,0,0,8225,0,0,3,0),
-(1492,0,0,193,0,0,0,0),
-(1493,0,0,193,0,0,1,0),
-(1494,0,0,193,0,0,2,0),
-(1495,0,0,193,0,0,3,0),
-(1496,0,0,321,0,0,0,0),
-(1497,0,0,321,0,0,1,0),
-(1498,0,0,321,0,0,2,0),
-(1499,0,0,321,0,0,3,0),
-(1500,0,0,577,0,0,0,0),
-(1501,0,0,577,0,0,1,0),
-(1502,0,0,577,0,0,2,0),
-(1503,0,0,577,0,0,3,0),
-(1504,0,0,1089,0,0,0,0),
-(1505,0,0,1089,0,0,1,0),
-(1506,0,0,1089,0,0,2,0),
-(1507,0,0,1089,0,0,3,0),
-(1508,0,0,2113,0,0,0,0),
-(1509,0,0,2113,0,0,1,0),
-(1510,0,0,2113,0,0,2,0),
-(1511,0,0,2113,0,0,3,0),
-(1512,0,0,4161,0,0,0,0),
-(1513,0,0,4161,0,0,1,0),
-(1514,0,0,4161,0,0,2,0),
-(1515,0,0,4161,0,0,3,0),
-(1516,0,0,8257,0,0,0,0),
-(1517,0,0,8257,0,0,1,0),
-(1518,0,0,8257,0,0,2,0),
-(1519,0,0,8257,0,0,3,0),
-(1520,0,0,385,0,0,0,0),
-(1521,0,0,385,0,0,1,0),
-(1522,0,0,385,0,0,2,0),
-(1523,0,0,385,0,0,3,0),
-(1524,0,0,641,0,0,0,0),
-(1525,0,0,641,0,0,1,0),
-(1526,0,0,641,0,0,2,0),
-(1527,0,0,641,0,0,3,0),
-(1528,0,0,1153,0,0,0,0),
-(1529,0,0,1153,0,0,1,0),
-(1530,0,0,1153,0,0,2,0),
-(1531,0,0,1153,0,0,3,0),
-(1532,0,0,2177,0,0,0,0),
-(1533,0,0,2177,0,0,1,0),
-(1534,0,0,2177,0,0,2,0),
-(1535,0,0,2177,0,0,3,0),
-(1536,0,0,4225,0,0,0,0),
-(1537,0,0,4225,0,0,1,0),
-(1538,0,0,4225,0,0,2,0),
-(1539,0,0,4225,0,0,3,0),
-(1540,0,0,8321,0,0,0,0),
-(1541,0,0,8321,0,0,1,0),
-(1542,0,0,8321,0,0,2,0),
-(1543,0,0,8321,0,0,3,0),
-(1544,0,0,769,0,0,0,0),
-(1545,0,0,769,0,0,1,0),
-(1546,0,0,769,0,0,2,0),
-(1547,0,0,769,0,0,3,0),
-(1548,0,0,1281,0,0,0,0),
-(1549,0,0,1281,0,0,1,0),
-(1550,0,0,1281,0,0,2,0),
-(1551,0,0,1281,0,0,3,0),
-(1552,0,0,2305,0,0,0,0),
-(1553,0,0,2305,0,0,1,0),
-(1554,0,0,2305,0,0,2,0),
-(1555,0,0,2305,0,0,3,0),
-(1556,0,0,4353,0,0,0,0),
-(1557,0,0,4353,0,0,1,0),
-(1558,0,0,4353,0,0,2,0),
-(1559,0,0,4353,0,0,3,0),
-(1560,0,0,8449,0,0,0,0),
-(1561,0,0,8449,0,0,1,0),
-(1562,0,0,8449,0,0,2,0),
-(1563,0,0,8449,0,0,3,0),
-(1564,0,0,1537,0,0,0,0),
-(1565,0,0,1537,0,0,1,0),
-(1566,0,0,1537,0,0,2,0),
-(1567,0,0,1537,0,0,3,0),
-(1568,0,0,2561,0,0,0,0),
-(1569,0,0,2561,0,0,1,0),
-(1570,0,0,2561,0,0,2,0),
-(1571,0,0,2561,0,0,3,0),
-(1572,0,0,4609,0,0,0,0),
-(1573,0,0,4609,0,0,1,0),
-(1574,0,0,4609,0,0,2,0),
-(1575,0,0,4609,0,0,3,0),
-(1576,0,0,8705,0,0,0,0),
-(1577,0,0,8705,0,0,1,0),
-(1578,0,0,8705,0,0,2,0),
-(1579,0,0,8705,0,0,3,0),
-(1580,0,0,3073,0,0,0,0),
-(1581,0,0,3073,0,0,1,0),
-(1582,0,0,3073,0,0,2,0),
-(1583,0,0,3073,0,0,3,0),
-(1584,0,0,5121,0,0,0,0),
-(1585,0,0,5121,0,0,1,0),
-(1586,0,0,5121,0,0,2,0),
-(1587,0,0,5121,0,0,3,0),
-(1588,0,0,9217,0,0,0,0),
-(1589,0,0,9217,0,0,1,0),
-(1590,0,0,9217,0,0,2,0),
-(1591,0,0,9217,0,0,3,0),
-(1592,0,0,6145,0,0,0,0),
-(1593,0,0,6145,0,0,1,0),
-(1594,0,0,6145,0,0,2,0),
-(1595,0,0,6145,0,0,3,0),
-(1596,0,0,10241,0,0,0,0),
-(1597,0,0,10241,0,0,1,0),
-(1598,0,0,10241,0,0,2,0),
-(1599,0,0,10241,0,0,3,0),
-(1600,0,0,12289,0,0,0,0),
-(1601,0,0,12289,0,0,1,0),
-(1602,0,0,12289,0,0,2,0),
-(1603,0,0,12289,0,0,3,0),
-(1604,0,0,22,0,0,0,0),
-(1605,0,0,22,0,0,1,0),
-(1606,0,0,22,0,0,2,0),
-(1607,0,0,22,0,0,3,0),
-(1608,0,0,38,0,0,0,0),
-(1609,0,0,38,0,0,1,0),
-(1610,0,0,38,0,0,2,0),
-(1611,0,0,38,0,0,3,0),
-(1612,0,0,70,0,0,0,0),
-(1613,0,0,70,0,0,1,0),
-(1614,0,0,70,0,0,2,0),
-(1615,0,0,70,0,0,3,0),
-(1616,0,0,134,0,0,0,0),
-(1617,0,0,134,0,0,1,0),
-(1618,0,0,134,0,0,2,0),
-(1619,0,0,134,0,0,3,0),
-(1620,0,0,262,0,0,0,0),
-(1621,0,0,262,0,0,1,0),
-(1622,0,0,262,0,0,2,0),
-(1623,0,0,262,0,0,3,0),
-(1624,0,0,518,0,0,0,0),
-(1625,0,0,518,0,0,1,0),
-(1626,0,0,518,0,0,2,0),
-(1627,0,0,518,0,0,3,0),
-(1628,0,0,1030,0,0,0,0),
-(1629,0,0,1030,0,0,1,0),
-(1630,0,0,1030,0,0,2,0),
-(1631,0,0,1030,0,0,3,0),
-(1632,0,0,50,0,0,0,0),
-(1633,0,0,50,0,0,1,0),
-(1634,0,0,50,0,0,2,0),
-(1635,0,0,50,0,0,3,0),
-(1636,0,0,82,0,0,0,0),
-(1637,0,0,82,0,0,1,0),
-(1638,0,0,82,0,0,2,0),
-(1639,0,0,82,0,0,3,0),
-(1640,0,0,146,0,0,0,0),
-(1641,0,0,146,0,0,1,0),
-(1642,0,0,146,0,0,2,0),
-(1643,0,0,146,0,0,3,0),
-(1644,0,0,274,0,0,0,0),
-(1645,0,0,274,0,0,1,0),
-(1646,0,0,274,0,0,2,0),
-(1647,0,0,274,0,0,3,0),
-(1648,0,0,530,0,0,0,0),
-(1649,0,0,530,0,0,1,0),
-(1650,0,0,530,0,0,2,0),
-(1651,0,0,530,0,0,3,0),
-(1652,0,0,1042,0,0,0,0),
-(1653,0,0,1042,0,0,1,0),
-(1654,0,0,1042,0,0,2,0),
-(1655,0,0,1042,0,0,3,0),
-(1656,0,0,2066,0,0,0,0),
-(1657,0,0,2066,0,0,1,0),
-(1658,0,0,2066,0,0,2,0),
-(1659,0,0,2066,0,0,3,0),
-(1660,0,0,4114,0,0,0,0),
-(1661,0,0,4114,0,0,1,0),
-(1662,0,0,4114,0,0,2,0),
-(1663,0,0,4114,0,0,3,0),
-(1664,0,0,98,0,0,0,0),
-(1665,0,0,98,0,0,1,0),
-(1666,0,0,98,0,0,2,0),
-(1667,0,0,98,0,0,3,0),
-(1668,0,0,162,0,0,0,0),
-(1669,0,0,162,0,0,1,0),
-(1670,0,0,162,0,0,2,0),
-(1671,0,0,162,0,0,3,0),
-(1672,0,0,290,0,0,0,0),
-(1673,0,0,290,0,0,1,0),
-(1674,0,0,290,0,0,2,0),
-(1675,0,0,290,0,0,3,0),
-(1676,0,0,546,0,0,0,0),
-(1677,0,0,546,0,0,1,0),
-(1678,0,0,546,0,0,2,0),
-(1679,0,0,546,0,0,3,0),
-(1680,0,0,1058,0,0,0,0),
-(1681,0,0,1058,0,0,1,0),
-(1682,0,0,1058,0,0,2,0),
-(1683,0,0,1058,0,0,3,0),
-(1684,0,0,2082,0,0,0,0),
-(1685,0,0,2082,0,0,1,0),
-(1686,0,0,2082,0,0,2,0),
-(1687,0,0,2082,0,0,3,0),
-(1688,0,0,4130,0,0,0,0),
-(1689,0,0,4130,0,0,1,0),
-(1690,0,0,4130,0,0,2,0),
-(1691,0,0,4130,0,0,3,0),
-(1692,0,0,194,0,0,0,0),
-(1693,0,0,194,0,0,1,0),
-(1694,0,0,194,0,0,2,0),
-(1695,0,0,194,0,0,3,0),
-(1696,0,0,322,0,0,0,0),
-(1697,0,0,322,0,0,1,0),
-(1698,0,0,322,0,0,2,0),
-(1699,0,0,322,0,0,3,0),
-(1700,0,0,578,0,0,0,0),
-(1701,0,0,578,0,0,1,0),
-(1702,0,0,578,0,0,2,0),
-(1703,0,0,578,0,0,3,0),
-(1704,0,0,1090,0,0,0,0),
-(1705,0,0,1090,0,0,1,0),
-(1706,0,0,1090,0,0,2,0),
-(1707,0,0,1090,0,0,3,0),
-(1708,0,0,386,0,0,0,0),
-(1709,0,0,386,0,0,1,0),
-(1710,0,0,386,0,0,2,0),
-(1711,0,0,386,0,0,3,0),
-(1712,0,0,642,0,0,0,0),
-(1713,0,0,642,0,0,1,0),
-(1714,0,0,642,0,0,2,0),
-(1715,0,0,642,0,0,3,0),
-(1716,0,0,1154,0,0,0,0),
-(1717,0,0,1154,0,0,1,0),
-(1718,0,0,1154,0,0,2,0),
-(1719,0,0,1154,0,0,3,0),
-(1720,0,0,2178,0,0,0,0),
-(1721,0,0,2178,0,0,1,0),
-(1722,0,0,2178,0,0,2,0),
-(1723,0,0,2178,0,0,3,0),
-(1724,0,0,4226,0,0,0,0),
-(1725,0,0,4226,0,0,1,0),
-(1726,0,0,4226,0,0,2,0),
-(1727,0,0,4226,0,0,3,0),
-(1728,0,0,770,0,0,0,0),
-(1729,0,0,770,0,0,1,0),
-(1730,0,0,770,0,0,2,0),
-(1731,0,0,770,0,0,3,0),
-(1732,0,0,1282,0,0,0,0),
-(1733,0,0,1282,0,0,1,0),
-(1734,0,0,1282,0,0,2,0),
-(1735,0,0,1282,0,0,3,0),
-(1736,0,0,2306,0,0,0,0),
-(1737,0,0,2306,0,0,1,0),
-(1738,0,0,2306,0,0,2,0),
-(1739,0,0,2306,0,0,3,0),
-(1740,0,0,4354,0,0,0,0),
-(1741,0,0,4354,0,0,1,0),
-(1742,0,0,4354,0,0,2,0),
-(1743,0,0,4354,0,0,3,0),
-(1744,0,0,1538,0,0,0,0),
-(1745,0,0,1538,0,0,1,0),
-(1746,0,0,1538,0,0,2,0),
-(1747,0,0,1538,0,0,3,0),
-(1748,0,0,2562,0,0,0,0),
-(1749,0,0,2562,0,0,1,0),
-(1750,0,0,2562,0,0,2,0),
-(1751,0,0,2562,0,0,3,0),
-(1752,0,0,4610,0,0,0,0),
-(1753,0,0,4610,0,0,1,0),
-(1754,0,0,4610,0,0,2,0),
-(1755,0,0,4610,0,0,3,0),
-(1756,0,0,6146,0,0,0,0),
-(1757,0,0,6146,0,0,1,0),
-(1758,0,0,6146,0,0,2,0),
-(1759,0,0,6146,0,0,3,0),
-(1760,0,0,28,0,0,0,0),
-(1761,0,0,28,0,0,1,0),
-(1762,0,0,28,0,0,2,0),
-(1763,0,0,28,0,0,3,0),
-(1764,0,0,76,0,0,0,0),
-(1765,0,0,76,0,0,1,0),
-(1766,0,0,76,0,0,2,0),
-(1767,0,0,76,0,0,3,0),
-(1768,0,0,140,0,0,0,0),
-(1769,0,0,140,0,0,1,0),
-(1770,0,0,140,0,0,2,0),
-(1771,0,0,140,0,0,3,0),
-(1772,0,0,268,0,0,0,0),
-(1773,0,0,268,0,0,1,0),
-(1774,0,0,268,0,0,2,0),
-(1775,0,0,268,0,0,3,0),
-(1776,0,0,524,0,0,0,0),
-(1777,0,0,524,0,0,1,0),
-(1778,0,0,524,0,0,2,0),
-(1779,0,0,524,0,0,3,0),
-(1780,0,0,84,0,0,0,0),
-(1781,0,0,84,0,0,1,0),
-(1782,0,0,84,0,0,2,0),
-(1783,0,0,84,0,0,3,0),
-(1784,0,0,148,0,0,0,0),
-(1785,0,0,148,0,0,1,0),
-(1786,0,0,148,0,0,2,0),
-(1787,0,0,148,0,0,3,0),
-(1788,0,0,276,0,0,0,0),
-(1789,0,0,276,0,0,1,0),
-(1790,0,0,276,0,0,2,0),
-(1791,0,0,276,0,0,3,0),
-(1792,0,0,532,0,0,0,0),
-(1793,0,0,532,0,0,1,0),
-(1794,0,0,532,0,0,2,0),
-(1795,0,0,532,0,0,3,0),
-(1796,0,0,196,0,0,0,0),
-(1797,0,0,196,0,0,1,0),
-(1798,0,0,196,0,0,2,0),
-(1799,0,0,196,0,0,3,0),
-(1800,0,0,324,0,0,0,0),
-(1801,0,0,324,0,0,1,0),
-(1802,0,0,324,0,0,2,0),
-(1803,0,0,324,0,0,3,0),
-(1804,0,0,580,0,0,0,0),
-(1805,0,0,580,0,0,1,0),
-(1806,0,0,580,0,0,2,0),
-(1807,0,0,580,0,0,3,0),
-(1808,0,0,388,0,0,0,0),
-(1809,0,0,388,0,0,1,0),
-(1810,0,0,388,0,0,2,0),
-(1811,0,0,388,0,0,3,0),
-(1812,0,0,644,0,0,0,0),
-(1813,0,0,644,0,0,1,0),
-(1814,0,0,644,0,0,2,0),
-(1815,0,0,644,0,0,3,0),
-(1816,0,0,772,0,0,0,0),
-(1817,0,0,772,0,0,1,0),
-(1818,0,0,772,0,0,2,0),
-(1819,0,0,772,0,0,3,0),
-(1820,0,0,88,0,0,0,0),
-(1821,0,0,88,0,0,1,0),
-(1822,0,0,88,0,0,2,0),
-(1823,0,0,88,0,0,3,0),
-(1824,0,0,152,0,0,0,0),
-(1825,0,0,152,0,0,1,0),
-(1826,0,0,152,0,0,2,0),
-(1827,0,0,152,0,0,3,0),
-(1828,0,0,280,0,0,0,0),
-(1829,0,0,280,0,0,1,0),
-(1830,0,0,280,0,0,2,0),
-(1831,0,0,280,0,0,3,0),
-(1832,0,0,536,0,0,0,0),
-(1833,0,0,536,0,0,1,0),
-(1834,0,0,536,0,0,2,0),
-(1835,0,0,536,0,0,3,0),
-(1836,0,0,200,0,0,0,0),
-(1837,0,0,200,0,0,1,0),
-(1838,0,0,200,0,0,2,0),
-(1839,0,0,200,0,0,3,0),
-(1840,0,0,328,0,0,0,0),
-(1841,0,0,328,0,0,1,0),
-(1842,0,0,328,0,0,2,0),
-(1843,0,0,328,0,0,3,0),
-(1844,0,0,584,0,0,0,0),
-(1845,0,0,584,0,0,1,0),
-(1846,0,0,584,0,0,2,0),
-(1847,0,0,584,0,0,3,0),
-(1848,0,0,392,0,0,0,0),
-(1849,0,0,392,0,0,1,0),
-(1850,0,0,392,0,0,2,0),
-(1851,0,0,392,0,0,3,0),
-(1852,0,0,648,0,0,0,0),
-(1853,0,0,648,0,0,1,0),
-(1854,0,0,648,0,0,2,0),
-(1855,0,0,648,0,0,3,0),
-(1856,0,0,776,0,0,0,0),
-(1857,0,0,776,0,0,1,0),
-(1858,0,0,776,0,0,2,0),
-(1859,0,0,776,0,0,3,0),
-(1860,0,0,176,0,0,0,0),
-(1861,0,0,176,0,0,1,0),
-(1862,0,0,176,0,0,2,0),
-(1863,0,0,176,0,0,3,0),
-(1864,0,0,304,0,0,0,0),
-(1865,0,0,304,0,0,1,0),
-(1866,0,0,304,0,0,2,0),
-(1867,0,0,304,0,0,3,0),
-(1868,0,0,560,0,0,0,0),
-(1869,0,0,560,0,0,1,0),
-(1870,0,0,560,0,0,2,0),
-(1871,0,0,560,0,0,3,0),
-(1872,0,0,1072,0,0,0,0),
-(1873,0,0,1072,0,0,1,0),
-(1874,0,0,1072,0,0,2,0),
-(1875,0,0,1072,0,0,3,0),
-(1876,0,0,2096,0,0,0,0),
-(1877,0,0,2096,0,0,1,0),
-(1878,0,0,2096,0,0,2,0),
-(1879,0,0,2096,0,0,3,0),
-(1880,0,0,4144,0,0,0,0),
-(1881,0,0,4144,0,0,1,0),
-(1882,0,0,4144,0,0,2,0),
-(1883,0,0,4144,0,0,3,0),
-(1884,0,0,8240,0,0,0,0),
-(1885,0,0,8240,0,0,1,0),
-(1886,0,0,8240,0,0,2,0),
-(1887,0,0,8240,0,0,3,0),
-(1888,0,0,208,0,0,0,0),
-(1889,0,0,208,0,0,1,0),
-(1890,0,0,208,0,0,2,0),
-(1891,0,0,208,0,0,3,0),
-(1892,0,0,336,0,0,0,0),
-(1893,0,0,336,0,0,1,0),
-(1894,0,0,336,0,0,2,0),
-(1895,0,0,336,0,0,3,0),
-(1896,0,0,592,0,0,0,0),
-(1897,0,0,592,0,0,1,0),
-(1898,0,0,592,0,0,2,0),
-(1899,0,0,592,0,0,3,0),
-(1900,0,0,400,0,0,0,0),
-(1901,0,0,400,0,0,1,0),
-(1902,0,0,400,0,0,2,0),
-(1903,0,0,400,0,0,3,0),
-(1904,0,0,656,0,0,0,0),
-(1905,0,0,656,0,0,1,0),
-(1906,0,0,656,0,0,2,0),
-(1907,0,0,656,0,0,3,0),
-(1908,0,0,1168,0,0,0,0),
-(1909,0,0,1168,0,0,1,0),
-(1910,0,0,1168,0,0,2,0),
-(1911,0,0,1168,0,0,3,0),
-(1912,0,0,2192,0,0,0,0),
-(1913,0,0,2192,0,0,1,0),
-(1914,0,0,2192,0,0,2,0),
-(1915,0,0,2192,0,0,3,0),
-(1916,0,0,4240,0,0,0,0),
-(1917,0,0,4240,0,0,1,0),
-(1918,0,0,4240,0,0,2,0),
-(1919,0,0,4240,0,0,3,0),
-(1920,0,0,8336,0,0,0,0),
-(1921,0,0,8336,0,0,1,0),
-(1922,0,0,8336,0,0,2,0),
-(1923,0,0,8336,0,0,3,0),
-(1924,0,0,784,0,0,0,0),
-(1925,0,0,784,0,0,1,0),
-(1926,0,0,784,0,0,2,0),
-(1927,0,0,784,0,0,3,0),
-(1928,0,0,1296,0,0,0,0),
-(1929,0,0,1296,0,0,1,0),
-(1930,0,0,1296,0,0,2,0),
-(1931,0,0,1296,0,0,3,0),
-(1932,0,0,2320,0,0,0,0),
-(1933,0,0,2320,0,0,1,0),
-(1934,0,0,2320,0,0,2,0),
-(1935,0,0,2320,0,0,3,0),
-(1936,0,0,4368,0,0,0,0),
-(1937,0,0,4368,0,0,1,0),
-(1938,0,0,4368,0,0,2,0),
-(1939,0,0,4368,0,0,3,0),
-(1940,0,0,8464,0,0,0,0),
-(1941,0,0,8464,0,0,1,0),
-(1942,0,0,8464,0,0,2,0),
-(1943,0,0,8464,0,0,3,0),
-(1944,0,0,1552,0,0,0,0),
-(1945,0,0,1552,0,0,1,0),
-(1946,0,0,1552,0,0,2,0),
-(1947,0,0,1552,0,0,3,0),
-(1948,0,0,2576,0,0,0,0),
-(1949,0,0,2576,0,0,1,0),
-(1950,0,0,2576,0,0,2,0),
-(1951,0,0,2576,0,0,3,0),
-(1952,0,0,4624,0,0,0,0),
-(1953,0,0,4624,0,0,1,0),
-(1954,0,0,4624,0,0,2,0),
-(1955,0,0,4624,0,0,3,0),
-(1956,0,0,8720,0,0,0,0),
-(1957,0,0,8720,0,0,1,0),
-(1958,0,0,8720,0,0,2,0),
-(1959,0,0,8720,0,0,3,0),
-(1960,0,0,3088,0,0,0,0),
-(1961,0,0,3088,0,0,1,0),
-(1962,0,0,3088,0,0,2,0),
-(1963,0,0,3088,0,0,3,0),
-(1964,0,0,5136,0,0,0,0),
-(1965,0,0,5136,0,0,1,0),
-(1966,0,0,5136,0,0,2,0),
-(1967,0,0,5136,0,0,3,0),
-(1968,0,0,9232,0,0,0,0),
-(1969,0,0,9232,0,0,1,0),
-(1970,0,0,9232,0,0,2,0),
-(1971,0,0,9232,0,0,3,0),
-(1972,0,0,6160,0,0,0,0),
-(1973,0,0,6160,0,0,1,0),
-(1974,0,0,6160,0,0,2,0),
-(1975,0,0,6160,0,0,3,0),
-(1976,0,0,10256,0,0,0,0),
-(1977,0,0,10256,0,0,1,0),
-(1978,0,0,10256,0,0,2,0),
-(1979,0,0,10256,0,0,3,0),
-(1980,0,0,12304,0,0,0,0),
-(1981,0,0,12304,0,0,1,0),
-(1982,0,0,12304,0,0,2,0),
-(1983,0,0,12304,0,0,3,0),
-(1984,0,0,416,0,0,0,0),
-(1985,0,0,416,0,0,1,0),
-(1986,0,0,416,0,0,2,0),
-(1987,0,0,416,0,0,3,0),
-(1988,0,0,672,0,0,0,0),
-(1989,0,0,672,0,0,1,0),
-(1990,0,0,672,0,0,2,0),
-(1991,0,0,672,0,0,3,0),
-(1992,0,0,1184,0,0,0,0),
-(1993,0,0,1184,0,0,1,0),
-(1994,0,0,1184,0,0,2,0),
-(1995,0,0,1184,0,0,3,0),
-(1996,0,0,2208,0,0,0,0),
-(1997,0,0,2208,0,0,1,0),
-(1998,0,0,2208,0,0,2,0),
-(1999,0,0,2208,0,0,3,0),
-(2000,0,0,4256,0,0,0,0),
-(2001,0,0,4256,0,0,1,0),
-(2002,0,0,4256,0,0,2,0),
-(2003,0,0,4256,0,0,3,0),
-(2004,0,0,8352,0,0,0,0),
-(2005,0,0,8352,0,0,1,0),
-(2006,0,0,8352,0,0,2,0),
-(2007,0,0,8352,0,0,3,0),
-(2008,0,0,800,0,0,0,0),
-(2009,0,0,800,0,0,1,0),
-(2010,0,0,800,0,0,2,0),
-(2011,0,0,800,0,0,3,0),
-(2012,0,0,1312,0,0,0,0),
-(2013,0,0,1312,0,0,1,0),
-(2014,0,0,1312,0,0,2,0),
-(2015,0,0,1312,0,0,3,0),
-(2016,0,0,2336,0,0,0,0),
-(2017,0,0,2336,0,0,1,0),
-(2018,0,0,2336,0,0,2,0),
-(2019,0,0,2336,0,0,3,0),
-(2020,0,0,4384,0,0,0,0),
-(2021,0,0,4384,0,0,1,0),
-(2022,0,0,4384,0,0,2,0),
-(2023,0,0,4384,0,0,3,0),
-(2024,0,0,8480,0,0,0,0),
-(2025,0,0,8480,0,0,1,0),
-(2026,0,0,8480,0,0,2,0),
-(2027,0,0,8480,0,0,3,0),
-(2028,0,0,1568,0,0,0,0),
-(2029,0,0,1568,0,0,1,0),
-(2030,0,0,1568,0,0,2,0),
-(2031,0,0,1568,0,0,3,0),
-(2032,0,0,2592,0,0,0,0),
-(2033,0,0,2592,0,0,1,0),
-(2034,0,0,2592,0,0,2,0),
-(2035,0,0,2592,0,0,3,0),
-(2036,0,0,4640,0,0,0,0),
-(2037,0,0,4640,0,0,1,0),
-(2038,0,0,4640,0,0,2,0),
-(2039,0,0,4640,0,0,3,0),
-(2040,0,0,8736,0,0,0,0),
-(2041,0,0,8736,0,0,1,0),
-(2042,0,0,8736,0,0,2,0),
-(2043,0,0,8736,0,0,3,0),
-(2044,0,0,3104,0,0,0,0),
-(2045,0,0,3104,0,0,1,0),
-(2046,0,0,3104,0,0,2,0),
-(2047,0,0,3104,0,0,3,0),
-(2048,0,0,5152,0,0,0,0),
-(2049,0,0,5152,0,0,1,0),
-(2050,0,0,5152,0,0,2,0),
-(2051,0,0,5152,0,0,3,0),
-(2052,0,0,9248,0,0,0,0),
-(2053,0,0,9248,0,0,1,0),
-(2054,0,0,9248,0,0,2,0),
-(2055,0,0,9248,0,0,3,0),
-(2056,0,0,6176,0,0,0,0),
-(2057,0,0,6176,0,0,1,0),
-(2058,0,0,6176,0,0,2,0),
-(2059,0,0,6176,0,0,3,0),
-(2060,0,0,10272,0,0,0,0),
-(2061,0,0,10272,0,0,1,0),
-(2062,0,0,10272,0,0,2,0),
-(2063,0,0,10272,0,0,3,0),
-(2064,0,0,12320,0,0,0,0),
-(2065,0,0,12320,0,0,1,0),
-(2066,0,0,12320,0,0,2,0),
-(2067,0,0,12320,0,0,3,0),
-(2068,0,0,448,0,0,0,0),
-(2069,0,0,448,0,0,1,0),
-(2070,0,0,448,0,0,2,0),
-(2071,0,0,448,0,0,3,0),
-(2072,0,0,704,0,0,0,0),
-(2073,0,0,704,0,0,1,0),
-(2074,0,0,704,0,0,2,0),
-(2075,0,0,704,0,0,3,0),
-(2076,0,0,832,0,0,0,0),
-(2077,0,0,832,0,0,1,0),
-(2078,0,0,832,0,0,2,0),
-(2079,0,0,832,0,0,3,0),
-(2080,0,0,896,0,0,0,0),
-(2081,0,0,896,0,0,1,0),
-(2082,0,0,896,0,0,2,0),
-(2083,0,0,896,0,0,3,0),
-(2084,0,0,1408,0,0,0,0),
-(2085,0,0,1408,0,0,1,0),
-(2086,0,0,1408,0,0,2,0),
-(2087,0,0,1408,0,0,3,0),
-(2088,0,0,2432,0,0,0,0),
-(2089,0,0,2432,0,0,1,0),
-(2090,0,0,2432,0,0,2,0),
-(2091,0,0,2432,0,0,3,0),
-(2092,0,0,4480,0,0,0,0),
-(2093,0,0,4480,0,0,1,0),
-(2094,0,0,4480,0,0,2,0),
-(2095,0,0,4480,0,0,3,0),
-(2096,0,0,8576,0,0,0,0),
-(2097,0,0,8576,0,0,1,0),
-(2098,0,0,8576,0,0,2,0),
-(2099,0,0,8576,0,0,3,0),
-(2100,0,0,1664,0,0,0,0),
-(2101,0,0,1664,0,0,1,0),
-(2102,0,0,1664,0,0,2,0),
-(2103,0,0,1664,0,0,3,0),
-(2104,0,0,2688,0,0,0,0),
-(2105,0,0,2688,0,0,1,0),
-(2106,0,0,2688,0,0,2,0),
-(2107,0,0,2688,0,0,3,0),
-(2108,0,0,4736,0,0,0,0),
-(2109,0,0,4736,0,0,1,0),
-(2110,0,0,4736,0,0,2,0),
-(2111,0,0,4736,0,0,3,0),
-(2112,0,0,8832,0,0,0,0),
-(2113,0,0,8832,0,0,1,0),
-(2114,0,0,8832,0,0,2,0),
-(2115,0,0,8832,0,0,3,0),
-(2116,0,0,3200,0,0,0,0),
-(2117,0,0,3200,0,0,1,0),
-(2118,0,0,3200,0,0,2,0),
-(2119,0,0,3200,0,0,3,0),
-(2120,0,0,5248,0,0,0,0),
-(2121,0,0,5248,0,0,1,0),
-(2122,0,0,5248,0,0,2,0),
-(2123,0,0,5248,0,0,3,0),
-(2124,0,0,9344,0,0,0,0),
-(2125,0,0,9344,0,0,1,0),
-(2126,0,0,9344,0,0,2,0),
-(2127,0,0,9344,0,0,3,0),
-(2128,0,0,6272,0,0,0,0),
-(2129,0,0,6272,0,0,1,0),
-(2130,0,0,6272,0,0,2,0),
-(2131,0,0,6272,0,0,3,0),
-(2132,0,0,10368,0,0,0,0),
-(2133,0,0,10368,0,0,1,0),
-(2134,0,0,10368,0,0,2,0),
-(2135,0,0,10368,0,0,3,0),
-(2136,0,0,12416,0,0,0,0),
-(2137,0,0,12416,0,0,1,0),
-(2138,0,0,12416,0,0,2,0),
-(2139,0,0,12416,0,0,3,0),
-(2140,0,0,1792,0,0,0,0),
-(2141,0,0,1792,0,0,1,0),
-(2142,0,0,1792,0,0,2,0),
-(2143,0,0,1792,0,0,3,0),
-(2144,0,0,2816,0,0,0,0),
-(2145,0,0,2816,0,0,1,0),
-(2146,0,0,2816,0,0,2,0),
-(2147,0,0,2816,0,0,3,0),
-(2148,0,0,4864,0,0,0,0),
-(2149,0,0,4864,0,0,1,0),
-(2150,0,0,4864,0,0,2,0),
-(2151,0,0,4864,0,0,3,0),
-(2152,0,0,8960,0,0,0,0),
-(2153,0,0,8960,0,0,1,0),
-(2154,0,0,8960,0,0,2,0),
-(2155,0,0,8960,0,0,3,0),
-(2156,0,0,3328,0,0,0,0),
-(2157,0,0,3328,0,0,1,0),
-(2158,0,0,3328,0,0,2,0),
-(2159,0,0,3328,0,0,3,0),
-(2160,0,0,5376,0,0,0,0),
-(2161,0,0,5376,0,0,1,0),
-(2162,0,0,5376,0,0,2,0),
-(2163,0,0,5376,0,0,3,0),
-(2164,0,0,9472,0,0,0,0),
-(2165,0,0,9472,0,0,1,0),
-(2166,0,0,9472,0,0,2,0),
-(2167,0,0,9472,0,0,3,0),
-(2168,0,0,6400,0,0,0,0),
-(2169,0,0,6400,0,0,1,0),
-(2170,0,0,6400,0,0,2,0),
-(2171,0,0,6400,0,0,3,0),
-(2172,0,0,10496,0,0,0,0),
-(2173,0,0,10496,0,0,1,0),
-(2174,0,0,10496,0,0,2,0),
-(2175,0,0,10496,0,0,3,0),
-(2176,0,0,12544,0,0,0,0),
-(2177,0,0,12544,0,0,1,0),
-(2178,0,0,12544,0,0,2,0),
-(2179,0,0,12544,0,0,3,0),
-(2180,0,0,3584,0,0,0,0),
-(2181,0,0,3584,0,0,1,0),
-(2182,0,0,3584,0,0,2,0),
-(2183,0,0,3584,0,0,3,0),
-(2184,0,0,5632,0,0,0,0),
-(2185,0,0,5632,0,0,1,0),
-(2186,0,0,5632,0,0,2,0),
-(2187,0,0,5632,0,0,3,0),
-(2188,0,0,9728,0,0,0,0),
-(2189,0,0,9728,0,0,1,0),
-(2190,0,0,9728,0,0,2,0),
-(2191,0,0,9728,0,0,3,0),
-(2192,0,0,6656,0,0,0,0),
-(2193,0,0,6656,0,0,1,0),
-(2194,0,0,6656,0,0,2,0),
-(2195,0,0,6656,0,0,3,0),
-(2196,0,0,10752,0,0,0,0),
-(2197,0,0,10752,0,0,1,0),
-(2198,0,0,10752,0,0,2,0),
-(2199,0,0,10752,0,0,3,0),
-(2200,0,0,12800,0,0,0,0),
-(2201,0,0,12800,0,0,1,0),
-(2202,0,0,12800,0,0,2,0),
-(2203,0,0,12800,0,0,3,0),
-(2204,0,0,7168,0,0,0,0),
-(2205,0,0,7168,0,0,1,0),
-(2206,0,0,7168,0,0,2,0),
-(2207,0,0,7168,0,0,3,0),
-(2208,0,0,11264,0,0,0,0),
-(2209,0,0,11264,0,0,1,0),
-(2210,0,0,11264,0,0,2,0),
-(2211,0,0,11264,0,0,3,0),
-(2212,0,0,13312,0,0,0,0),
-(2213,0,0,13312,0,0,1,0),
-(2214,0,0,13312,0,0,2,0),
-(2215,0,0,13312,0,0,3,0),
-(2216,0,0,14336,0,0,0,0),
-(2217,0,0,14336,0,0,1,0),
-(2218,0,0,14336,0,0,2,0),
-(2219,0,0,14336,0,0,3,0),
-(2220,20,27,0,2,41459,0,7),
-(2221,20,27,1,2,41459,0,3),
-(2222,20,27,1,2,41459,1,3),
-(2223,20,27,1,2,41459,2,3),
-(2224,20,27,16,2,41459,0,2),
-(2225,20,27,16,2,41459,1,2),
-(2226,20,27,16,2,41459,2,2),
-(2227,20,27,128,2,41459,0,7),
-(2228,20,27,128,2,41459,1,7),
-(2229,20,27,128,2,41459,2,7),
-(2230,20,27,256,2,41459,0,7),
-(2231,20,27,256,2,41459,1,7),
-(2232,20,27,256,2,41459,2,7),
-(2233,20,27,1024,2,41459,0,7),
-(2234,20,27,1024,2,41459,1,7),
-(2235,20,27,1024,2,41459,2,7),
-(2236,20,27,2048,2,41459,0,2),
-(2237,20,27,2048,2,41459,1,2),
-(2238,20,27,2048,2,41459,2,2),
-(2239,20,27,4096,2,41459,0,2),
-(2240,20,27,4096,2,41459,1,2),
-(2241,20,27,4096,2,41459,2,2),
-(2242,20,27,8192,2,41459,0,2),
-(2243,20,27,8192,2,41459,1,2),
-(2244,20,27,8192,2,41459,2,2),
-(2245,20,27,32,2,41459,0,5),
-(2246,20,27,32,2,41459,1,5),
-(2247,20,27,32,2,41459,2,5),
-(2248,20,27,512,2,41459,0,5),
-(2249,20,27,512,2,41459,1,5),
-(2250,20,27,512,2,41459,2,5),
-(2251,20,27,2,2,41459,0,4),
-(2252,20,27,2,2,41459,1,4),
-(2253,20,27,2,2,41459,2,4),
-(2254,26,35,0,2,41459,0,39),
-(2255,26,35,1,2,41459,0,3),
-(2256,26,35,1,2,41459,1,3),
-(2257,26,35,1,2,41459,2,3),
-(2258,26,35,16,2,41459,0,2),
-(2259,26,35,16,2,41459,1,2),
-(2260,26,35,16,2,41459,2,2),
-(2261,26,35,128,2,41459,0,39),
-(2262,26,35,128,2,41459,1,39),
-(2263,26,35,128,2,41459,2,39),
-(2264,26,35,256,2,41459,0,39),
-(2265,26,35,256,2,41459,1,39),
-(2266,26,35,256,2,41459,2,39),
-(2267,26,35,1024,2,41459,0,7),
-(2268,26,35,1024,2,41459,1,7),
-(2269,26,35,1024,2,41459,2,7),
-(2270,26,35,2048,2,41459,0,2),
-(2271,26,35,2048,2,41459,1,2),
-(2272,26,35,2048,2,41459,2,2),
-(2273,26,35,4096,2,41459,0,2),
-(2274,26,35,4096,2,41459,1,2),
-(2275,26,35,4096,2,41459,2,2),
-(2276,26,35,8192,2,41459,0,2),
-(2277,26,35,8192,2,41459,1,2),
-(2278,26,35,8192,2,41459,2,2),
-(2279,26,35,32,2,41459,0,5),
-(2280,26,35,32,2,41459,1,5),
-(2281,26,35,32,2,41459,2,5),
-(2282,26,35,512,2,41459,0,37),
-(2283,26,35,512,2,41459,1,37),
-(2284,26,35,512,2,41459,2,37),
-(2285,26,35,2,2,41459,0,4),
-(2286,26,35,2,2,41459,1,4),
-(2287,26,35,2,2,41459,2,4),
-(2288,26,35,4,2,41459,0,32),
-(2289,26,35,4,2,41459,1,32),
-(2290,26,35,4,2,41459,2,32),
-(2291,26,35,8,2,41459,0,32),
-(2292,26,35,8,2,41459,1,32),
-(2293,26,35,8,2,41459,2,32),
-(2294,26,35,64,2,41459,0,32),
-(2295,26,35,64,2,41459,1,32),
-(2296,26,35,64,2,41459,2,32),
-(2297,18,25,0,2,41459,0,39),
-(2298,18,25,1,2,41459,0,3),
-(2299,18,25,1,2,41459,1,3),
-(2300,18,25,1,2,41459,2,3),
-(2301,18,25,16,2,41459,0,2),
-(2302,18,25,16,2,41459,1,2),
-(2303,18,25,16,2,41459,2,2),
-(2304,18,25,128,2,41459,0,39),
-(2305,18,25,128,2,41459,1,39),
-(2306,18,25,128,2,41459,2,39),
-(2307,18,25,256,2,41459,0,39),
-(2308,18,25,256,2,41459,1,39),
-(2309,18,25,256,2,41459,2,39),
-(2310,18,25,1024,2,41459,0,7),
-(2311,18,25,1024,2,41459,1,7),
-(2312,18,25,1024,2,41459,2,7),
-(2313,18,25,2048,2,41459,0,2),
-(2314,18,25,2048,2,41459,1,2),
-(2315,18,25,2048,2,41459,2,2),
-(2316,18,25,4096,2,41459,0,2),
-(2317,18,25,4096,2,41459,1,2),
-(2318,18,25,4096,2,41459,2,2),
-(2319,18,25,8192,2,41459,0,2),
-(2320,18,25,8192,2,41459,1,2),
-(2321,18,25,8192,2,41459,2,2),
-(2322,18,25,32,2,41459,0,5),
-(2323,18,25,32,2,41459,1,5),
-(2324,18,25,32,2,41459,2,5),
-(2325,18,25,512,2,41459,0,37),
-(2326,18,25,512,2,41459,1,37),
-(2327,18,25,512,2,41459,2,37),
-(2328,18,25,2,2,41459,0,4),
-(2329,18,25,2,2,41459,1,4),
-(2330,18,25,2,2,41459,2,4),
-(2331,18,25,4,2,41459,0,32),
-(2332,18,25,4,2,41459,1,32),
-(2333,18,25,4,2,41459,2,32),
-(2334,18,25,8,2,41459,0,32),
-(2335,18,25,8,2,41459,1,32),
-(2336,18,25,8,2,41459,2,32),
-(2337,18,25,64,2,41459,0,32),
-(2338,18,25,64,2,41459,1,32),
-(2339,18,25,64,2,41459,2,32),
-(2340,10,17,0,2,41459,0,39),
-(2341,10,17,1,2,41459,0,3),
-(2342,10,17,1,2,41459,1,3),
-(2343,10,17,1,2,41459,2,3),
-(2344,10,17,16,2,41459,0,2),
-(2345,10,17,16,2,41459,1,2),
-(2346,10,17,16,2,41459,2,2),
-(2347,10,17,128,2,41459,0,39),
-(2348,10,17,128,2,41459,1,39),
-(2349,10,17,128,2,41459,2,39),
-(2350,10,17,256,2,41459,0,39),
-(2351,10,17,256,2,41459,1,39),
-(2352,10,17,256,2,41459,2,39),
-(2353,10,17,1024,2,41459,0,7),
-(2354,10,17,1024,2,41459,1,7),
-(2355,10,17,1024,2,41459,2,7),
-(2356,10,17,2048,2,41459,0,2),
-(2357,10,17,2048,2,41459,1,2),
-(2358,10,17,2048,2,41459,2,2),
-(2359,10,17,4096,2,41459,0,2),
-(2360,10,17,4096,2,41459,1,2),
-(2361,10,17,4096,2,41459,2,2),
-(2362,10,17,8192,2,41459,0,2),
-(2363,10,17,8192,2,41459,1,2),
-(2364,10,17,8192,2,41459,2,2),
-(2365,10,17,32,2,41459,0,5),
-(2366,10,17,32,2,41459,1,5),
-(2367,10,17,32,2,41459,2,5),
-(2368,10,17,512,2,41459,0,37),
-(2369,10,17,512,2,41459,1,37),
-(2370,10,17,512,2,41459,2,37),
-(2371,10,17,2,2,41459,0,4),
-(2372,10,17,2,2,41459,1,4),
-(2373,10,17,2,2,41459,2,4),
-(2374,10,17,4,2,41459,0,32),
-(2375,10,17,4,2,41459,1,32),
-(2376,10,17,4,2,41459,2,32),
-(2377,10,17,8,2,41459,0,32),
-(2378,10,17,8,2,41459,1,32),
-(2379,10,17,8,2,41459,2,32),
-(2380,10,17,64,2,41459,0,32),
-(2381,10,17,64,2,41459,1,32),
-(2382,10,17,64,2,41459,2,32),
-(2383,30,37,0,2,41459,0,7),
-(2384,30,37,1,2,41459,0,3),
-(2385,30,37,1,2,41459,1,3),
-(2386,30,37,1,2,41459,2,3),
-(2387,30,37,16,2,41459,0,2),
-(2388,30,37,16,2,41459,1,2),
-(2389,30,37,16,2,41459,2,2),
-(2390,30,37,128,2,41459,0,7),
-(2391,30,37,128,2,41459,1,7),
-(2392,30,37,128,2,41459,2,7),
-(2393,30,37,256,2,41459,0,7),
-(2394,30,37,256,2,41459,1,7),
-(2395,30,37,256,2,41459,2,7),
-(2396,30,37,1024,2,41459,0,7),
-(2397,30,37,1024,2,41459,1,7),
-(2398,30,37,1024,2,41459,2,7),
-(2399,30,37,2048,2,41459,0,2),
-(2400,30,37,2048,2,41459,1,2),
-(2401,30,37,2048,2,41459,2,2),
-(2402,30,37,4096,2,41459,0,2),
-(2403,30,37,4096,2,41459,1,2),
-(2404,30,37,4096,2,41459,2,2),
-(2405,30,37,8192,2,41459,0,2),
-(2406,30,37,8192,2,41459,1,2),
-(2407,30,37,8192,2,41459,2,2),
-(2408,30,37,32,2,41459,0,5),
-(2409,30,37,32,2,41459,1,5),
-(2410,30,37,32,2,41459,2,5),
-(2411,30,37,512,2,41459,0,5),
-(2412,30,37,512,2,41459,1,5),
-(2413,30,37,512,2,41459,2,5),
-(2414,30,37,2,2,41459,0,4),
-(2415,30,37,2,2,41459,1,4),
-(2416,30,37,2,2,41459,2,4),
-(2417,38,45,0,2,41459,0,7),
-(2418,38,45,1,2,41459,0,3),
-(2419,38,45,1,2,41459,1,3),
-(2420,38,45,1,2,41459,2,3),
-(2421,38,45,16,2,41459,0,2),
-(2422,38,45,16,2,41459,1,2),
-(2423,38,45,16,2,41459,2,2),
-(2424,38,45,128,2,41459,0,7),
-(2425,38,45,128,2,41459,1,7),
-(2426,38,45,128,2,41459,2,7),
-(2427,38,45,256,2,41459,0,7),
-(2428,38,45,256,2,41459,1,7),
-(2429,38,45,256,2,41459,2,7),
-(2430,38,45,1024,2,41459,0,7),
-(2431,38,45,1024,2,41459,1,7),
-(2432,38,45,1024,2,41459,2,7),
-(2433,38,45,2048,2,41459,0,2),
-(2434,38,45,2048,2,41459,1,2),
-(2435,38,45,2048,2,41459,2,2),
-(2436,38,45,4096,2,41459,0,2),
-(2437,38,45,4096,2,41459,1,2),
-(2438,38,45,4096,2,41459,2,2),
-(2439,38,45,8192,2,41459,0,2),
-(2440,38,45,8192,2,41459,1,2),
-(2441,38,45,8192,2,41459,2,2),
-(2442,38,45,32,2,41459,0,5),
-(2443,38,45,32,2,41459,1,5),
-(2444,38,45,32,2,41459,2,5),
-(2445,38,45,512,2,41459,0,5),
-(2446,38,45,512,2,41459,1,5),
-(2447,38,45,512,2,41459,2,5),
-(2448,38,45,2,2,41459,0,4),
-(2449,38,45,2,2,41459,1,4),
-(2450,38,45,2,2,41459,2,4),
-(2451,20,27,0,2,41459,0,7),
-(2452,20,27,1,2,41459,0,3),
-(2453,20,27,1,2,41459,1,3),
-(2454,20,27,1,2,41459,2,3),
-(2455,20,27,16,2,41459,0,2),
-(2456,20,27,16,2,41459,1,2),
-(2457,20,27,16,2,41459,2,2),
-(2458,20,27,128,2,41459,0,7),
-(2459,20,27,128,2,41459,1,7),
-(2460,20,27,128,2,41459,2,7),
-(2461,20,27,256,2,41459,0,7),
-(2462,20,27,256,2,41459,1,7),
-(2463,20,27,256,2,41459,2,7),
-(2464,20,27,1024,2,41459,0,7),
-(2465,20,27,1024,2,41459,1,7),
-(2466,20,27,1024,2,41459,2,7),
-(2467,20,27,2048,2,41459,0,2),
-(2468,20,27,2048,2,41459,1,2),
-(2469,20,27,2048,2,41459,2,2),
-(2470,20,27,4096,2,41459,0,2),
-(2471,20,27,4096,2,41459,1,2),
-(2472,20,27,4096,2,41459,2,2),
-(2473,20,27,8192,2,41459,0,2),
-(2474,20,27,8192,2,41459,1,2),
-(2475,20,27,8192,2,41459,2,2),
-(2476,20,27,32,2,41459,0,5),
-(2477,20,27,32,2,41459,1,5),
-(2478,20,27,32,2,41459,2,5),
-(2479,20,27,512,2,41459,0,5),
-(2480,20,27,512,2,41459,1,5),
-(2481,20,27,512,2,41459,2,5),
-(2482,20,27,2,2,41459,0,4),
-(2483,20,27,2,2,41459,1,4),
-(2484,20,27,2,2,41459,2,4),
-(2485,28,32,0,2,41459,0,7),
-(2486,28,32,1,2,41459,0,3),
-(2487,28,32,1,2,41459,1,3),
-(2488,28,32,1,2,41459,2,3),
-(2489,28,32,16,2,41459,0,2),
-(2490,28,32,16,2,41459,1,2),
-(2491,28,32,16,2,41459,2,2),
-(2492,28,32,128,2,41459,0,7),
-(2493,28,32,128,2,41459,1,7),
-(2494,28,32,128,2,41459,2,7),
-(2495,28,32,256,2,41459,0,7),
-(2496,28,32,256,2,41459,1,7),
-(2497,28,32,256,2,41459,2,7),
-(2498,28,32,1024,2,41459,0,7),
-(2499,28,32,1024,2,41459,1,7),
-(2500,28,32,1024,2,41459,2,7),
-(2501,28,32,2048,2,41459,0,2),
-(2502,28,32,2048,2,41459,1,2),
-(2503,28,32,2048,2,41459,2,2),
-(2504,28,32,4096,2,41459,0,2),
-(2505,28,32,4096,2,41459,1,2),
-(2506,28,32,4096,2,41459,2,2),
-(2507,28,32,8192,2,41459,0,2),
-(2508,28,32,8192,2,41459,1,2),
-(2509,28,32,8192,2,41459,2,2),
-(2510,28,32,32,2,41459,0,5),
-(2511,28,32,32,2,41459,1,5),
-(2512,28,32,32,2,41459,2,5),
-(2513,28,32,512,2,41459,0,5),
-(2514,28,32,512,2,41459,1,5),
-(2515,28,32,512,2,41459,2,5),
-(2516,28,32,2,2,41459,0,4),
-(2517,28,32,2,2,41459,1,4),
-(2518,28,32,2,2,41459,2,4),
-(2519,33,35,0,2,41459,0,7),
-(2520,33,35,1,2,41459,0,3),
-(2521,33,35,1,2,41459,1,3),
-(2522,33,35,1,2,41459,2,3),
-(2523,33,35,16,2,41459,0,2),
-(2524,33,35,16,2,41459,1,2),
-(2525,33,35,16,2,41459,2,2),
-(2526,33,35,128,2,41459,0,7),
-(2527,33,35,128,2,41459,1,7),
-(2528,33,35,128,2,41459,2,7),
-(2529,33,35,256,2,41459,0,7),
-(2530,33,35,256,2,41459,1,7),
-(2531,33,35,256,2,41459,2,7),
-(2532,33,35,1024,2,41459,0,7),
-(2533,33,35,1024,2,41459,1,7),
-(2534,33,35,1024,2,41459,2,7),
-(2535,33,35,2048,2,41459,0,2),
-(2536,33,35,2048,2,41459,1,2),
-(2537,33,35,2048,2,41459,2,2),
-(2538,33,35,4096,2,41459,0,2),
-(2539,33,35,4096,2,41459,1,2),
-(2540,33,35,4096,2,41459,2,2),
-(2541,33,35,8192,2,41459,0,2),
-(2542,33,35,8192,2,41459,1,2),
-(2543,33,35,8192,2,41459,2,2),
-(2544,33,35,32,2,41459,0,5),
-(2545,33,35,32,2,41459,1,5),
-(2546,33,35,32,2,41459,2,5),
-(2547,33,35,512,2,41459,0,5),
-(2548,33,35,512,2,41459,1,5),
-(2549,33,35,512,2,41459,2,5),
-(2550,33,35,2,2,41459,0,4),
-(2551,33,35,2,2,41459,1,4),
-(2552,33,35,2,2,41459,2,4),
-(2553,28,37,0,2,41459,0,7),
-(2554,28,37,1,2,41459,0,3),
-(2555,28,37,1,2,41459,1,3),
-(2556,28,37,1,2,41459,2,3),
-(2557,28,37,16,2,41459,0,2),
-(2558,28,37,16,2,41459,1,2),
-(2559,28,37,16,2,41459,2,2),
-(2560,28,37,128,2,41459,0,7),
-(2561,28,37,128,2,41459,1,7),
-(2562,28,37,128,2,41459,2,7),
-(2563,28,37,256,2,41459,0,7),
-(2564,28,37,256,2,41459,1,7),
-(2565,28,37,256,2,41459,2,7),
-(2566,28,37,1024,2,41459,0,7),
-(2567,28,37,1024,2,41459,1,7),
-(2568,28,37,1024,2,41459,2,7),
-(2569,28,37,2048,2,41459,0,2),
-(2570,28,37,2048,2,41459,1,2),
-(2571,28,37,2048,2,41459,2,2),
-(2572,28,37,4096,2,41459,0,2),
-(2573,28,37,4096,2,41459,1,2),
-(2574,28,37,4096,2,41459,2,2),
-(2575,28,37,8192,2,41459,0,2),
-(2576,28,37,8192,2,41459,1,2),
-(2577,28,37,8192,2,41459,2,2),
-(2578,28,37,32,2,41459,0,5),
-(2579,28,37,32,2,41459,1,5),
-(2580,28,37,32,2,41459,2,5),
-(2581,28,37,512,2,41459,0,5),
-(2582,28,37,512,2,41459,1,5),
-(2583,28,37,512,2,41459,2,5),
-(2584,28,37,2,2,41459,0,4),
-(2585,28,37,2,2,41459,1,4),
-(2586,28,37,2,2,41459,2,4),
-(2587,5,14,0,2,164291,0,7),
-(2588,5,14,1,2,164291,0,3),
-(2589,5,14,1,2,164291,1,3),
-(2590,5,14,1,2,164291,2,3),
-(2591,5,14,16,2,164291,0,2),
-(2592,5,14,16,2,164291,1,2),
-(2593,5,14,16,2,164291,2,2),
-(2594,5,14,128,2,164291,0,7),
-(2595,5,14,128,2,164291,1,7),
-(2596,5,14,128,2,164291,2,7),
-(2597,5,14,256,2,164291,0,7),
-(2598,5,14,256,2,164291,1,7),
-(2599,5,14,256,2,164291,2,7),
-(2600,5,14,1024,2,164291,0,7),
-(2601,5,14,1024,2,164291,1,7),
-(2602,5,14,1024,2,164291,2,7),
-(2603,5,14,2048,2,164291,0,2),
-(2604,5,14,2048,2,164291,1,2),
-(2605,5,14,2048,2,164291,2,2),
-(2606,5,14,4096,2,164291,0,2),
-(2607,5,14,4096,2,164291,1,2),
-(2608,5,14,4096,2,164291,2,2),
-(2609,5,14,8192,2,164291,0,2),
-(2610,5,14,8192,2,164291,1,2),
-(2611,5,14,8192,2,164291,2,2),
-(2612,5,14,32,2,164291,0,5),
-(2613,5,14,32,2,164291,1,5),
-(2614,5,14,32,2,164291,2,5),
-(2615,5,14,512,2,164291,0,5),
-(2616,5,14,512,2,164291,1,5),
-(2617,5,14,512,2,164291,2,5),
-(2618,5,14,2,2,164291,0,4),
-(2619,5,14,2,2,164291,1,4),
-(2620,5,14,2,2,164291,2,4),
-(2621,15,24,0,2,164291,0,7),
-(2622,15,24,1,2,164291,0,3),
-(2623,15,24,1,2,164291,1,3),
-(2624,15,24,1,2,164291,2,3),
-(2625,15,24,16,2,164291,0,2),
-(2626,15,24,16,2,164291,1,2),
-(2627,15,24,16,2,164291,2,2),
-(2628,15,24,128,2,164291,0,7),
-(2629,15,24,128,2,164291,1,7),
-(2630,15,24,128,2,164291,2,7),
-(2631,15,24,256,2,164291,0,7),
-(2632,15,24,256,2,164291,1,7),
-(2633,15,24,256,2,164291,2,7),
-(2634,15,24,1024,2,164291,0,7),
-(2635,15,24,1024,2,164291,1,7),
-(2636,15,24,1024,2,164291,2,7),
-(2637,15,24,2048,2,164291,0,2),
-(2638,15,24,2048,2,164291,1,2),
-(2639,15,24,2048,2,164291,2,2),
-(2640,15,24,4096,2,164291,0,2),
-(2641,15,24,4096,2,164291,1,2),
-(2642,15,24,4096,2,164291,2,2),
-(2643,15,24,8192,2,164291,0,2),
-(2644,15,24,8192,2,164291,1,2),
-(2645,15,24,8192,2,164291,2,2),
-(2646,15,24,32,2,164291,0,5),
-(2647,15,24,32,2,164291,1,5),
-(2648,15,24,32,2,164291,2,5),
-(2649,15,24,512,2,164291,0,5),
-(2650,15,24,512,2,164291,1,5),
-(2651,15,24,512,2,164291,2,5),
-(2652,15,24,2,2,164291,0,4),
-(2653,15,24,2,2,164291,1,4),
-(2654,15,24,2,2,164291,2,4),
-(2655,1,4,0,2,9264,0,7),
-(2656,1,4,1,2,9264,0,3),
-(2657,1,4,1,2,9264,1,3),
-(2658,1,4,1,2,9264,2,3),
-(2659,1,4,16,2,9264,0,2),
-(2660,1,4,16,2,9264,1,2),
-(2661,1,4,16,2,9264,2,2),
-(2662,1,4,128,2,9264,0,7),
-(2663,1,4,128,2,9264,1,7),
-(2664,1,4,128,2,9264,2,7),
-(2665,1,4,256,2,9264,0,7),
-(2666,1,4,256,2,9264,1,7),
-(2667,1,4,256,2,9264,2,7),
-(2668,1,4,1024,2,9264,0,7),
-(2669,1,4,1024,2,9264,1,7),
-(2670,1,4,1024,2,9264,2,7),
-(2671,1,4,2048,2,9264,0,2),
-(2672,1,4,2048,2,9264,1,2),
-(2673,1,4,2048,2,9264,2,2),
-(2674,1,4,4096,2,9264,0,2),
-(2675,1,4,4096,2,9264,1,2),
-(2676,1,4,4096,2,9264,2,2),
-(2677,1,4,8192,2,9264,0,2),
-(2678,1,4,8192,2,9264,1,2),
-(2679,1,4,8192,2,9264,2,2),
-(2680,1,4,32,2,9264,0,5),
-(2681,1,4,32,2,9264,1,5),
-(2682,1,4,32,2,9264,2,5),
-(2683,1,4,512,2,9264,0,5),
-(2684,1,4,512,2,9264,1,5),
-(2685,1,4,512,2,9264,2,5),
-(2686,1,4,2,2,9264,0,4),
-(2687,1,4,2,2,9264,1,4),
-(2688,1,4,2,2,9264,2,4),
-(2689,5,14,0,2,9264,0,7),
-(2690,5,14,1,2,9264,0,3),
-(2691,5,14,1,2,9264,1,3),
-(2692,5,14,1,2,9264,2,3),
-(2693,5,14,16,2,9264,0,2),
-(2694,5,14,16,2,9264,1,2),
-(2695,5,14,16,2,9264,2,2),
-(2696,5,14,128,2,9264,0,7),
-(2697,5,14,128,2,9264,1,7),
-(2698,5,14,128,2,9264,2,7),
-(2699,5,14,256,2,9264,0,7),
-(2700,5,14,256,2,9264,1,7),
-(2701,5,14,256,2,9264,2,7),
-(2702,5,14,1024,2,9264,0,7),
-(2703,5,14,1024,2,9264,1,7),
-(2704,5,14,1024,2,9264,2,7),
-(2705,5,14,2048,2,9264,0,2),
-(2706,5,14,2048,2,9264,1,2),
-(2707,5,14,2048,2,9264,2,2),
-(2708,5,14,4096,2,9264,0,2),
-(2709,5,14,4096,2,9264,1,2),
-(2710,5,14,4096,2,9264,2,2),
-(2711,5,14,8192,2,9264,0,2),
-(2712,5,14,8192,2,9264,1,2),
-(2713,5,14,8192,2,9264,2,2),
-(2714,5,14,32,2,9264,0,5),
-(2715,5,14,32,2,9264,1,5),
-(2716,5,14,32,2,9264,2,5),
-(2717,5,14,512,2,9264,0,5),
-(2718,5,14,512,2,9264,1,5),
-(2719,5,14,512,2,9264,2,5),
-(2720,5,14,2,2,9264,0,4),
-(2721,5,14,2,2,9264,1,4),
-(2722,5,14,2,2,9264,2,4),
-(2723,15,24,0,2,9264,0,7),
-(2724,15,24,1,2,9264,0,3),
-(2725,15,24,1,2,9264,1,3),
-(2726,15,24,1,2,9264,2,3),
-(2727,15,24,16,2,9264,0,2),
-(2728,15,24,16,2,9264,1,2),
-(2729,15,24,16,2,9264,2,2),
-(2730,15,24,128,2,9264,0,7),
-(2731,15,24,128,2,9264,1,7),
-(2732,15,24,128,2,9264,2,7),
-(2733,15,24,256,2,9264,0,7),
-(2734,15,24,256,2,9264,1,7),
-(2735,15,24,256,2,9264,2,7),
-(2736,15,24,1024,2,9264,0,7),
-(2737,15,24,1024,2,9264,1,7),
-(2738,15,24,1024,2,9264,2,7),
-(2739,15,24,2048,2,9264,0,2),
-(2740,15,24,2048,2,9264,1,2),
-(2741,15,24,2048,2,9264,2,2),
-(2742,15,24,4096,2,9264,0,2),
-(2743,15,24,4096,2,9264,1,2),
-(2744,15,24,4096,2,9264,2,2),
-(2745,15,24,8192,2,9264,0,2),
-(2746,15,24,8192,2,9264,1,2),
-(2747,15,24,8192,2,9264,2,2),
-(2748,15,24,32,2,9264,0,5),
-(2749,15,24,32,2,9264,1,5),
-(2750,15,24,32,2,9264,2,5),
-(2751,15,24,512,2,9264,0,5),
-(2752,15,24,512,2,9264,1,5),
-(2753,15,24,512,2,9264,2,5),
-(2754,15,24,2,2,9264,0,4),
-(2755,15,24,2,2,9264,1,4),
-(2756,15,24,2,2,9264,2,4),
-(2757,20,83,0,2,41459,0,7),
-(2758,20,83,1,2,41459,0,3),
-(2759,20,83,1,2,41459,1,3),
-(2760,20,83,1,2,41459,2,3),
-(2761,20,83,16,2,41459,0,2),
-(2762,20,83,16,2,41459,1,2),
-(2763,20,83,16,2,41459,2,2),
-(2764,20,83,128,2,41459,0,7),
-(2765,20,83,128,2,41459,1,7),
-(2766,20,83,128,2,41459,2,7),
-(2767,20,83,256,2,41459,0,7),
-(2768,20,83,256,2,41459,1,7),
-(2769,20,83,256,2,41459,2,7),
-(2770,20,83,1024,2,41459,0,7),
-(2771,20,83,1024,2,41459,1,7),
-(2772,20,83,1024,2,41459,2,7),
-(2773,20,83,2048,2,41459,0,2),
-(2774,20,83,2048,2,41459,1,2),
-(2775,20,83,2048,2,41459,2,2),
-(2776,20,83,4096,2,41459,0,2),
-(2777,20,83,4096,2,41459,1,2),
-(2778,20,83,4096,2,41459,2,2),
-(2779,20,83,8192,2,41459,0,2),
-(2780,20,83,8192,2,41459,1,2),
-(2781,20,83,8192,2,41459,2,2),
-(2782,20,83,32,2,41459,0,5),
-(2783,20,83,32,2,41459,1,5),
-(2784,20,83,32,2,41459,2,5),
-(2785,20,83,512,2,41459,0,5),
-(2786,20,83,512,2,41459,1,5),
-(2787,20,83,512,2,41459,2,5),
-(2788,20,83,2,2,41459,0,4),
-(2789,20,83,2,2,41459,1,4),
-(2790,20,83,2,2,41459,2,4),
-(2791,24,69,0,2,41459,0,7),
-(2792,24,69,1,2,41459,0,3),
-(2793,24,69,1,2,41459,1,3),
-(2794,24,69,1,2,41459,2,3),
-(2795,24,69,16,2,41459,0,2),
-(2796,24,69,16,2,41459,1,2),
-(2797,24,69,16,2,41459,2,2),
-(2798,24,69,128,2,41459,0,7),
-(2799,24,69,128,2,41459,1,7),
-(2800,24,69,128,2,41459,2,7),
-(2801,24,69,256,2,41459,0,7),
-(2802,24,69,256,2,41459,1,7),
-(2803,24,69,256,2,41459,2,7),
-(2804,24,69,1024,2,41459,0,7),
-(2805,24,69,1024,2,41459,1,7),
-(2806,24,69,1024,2,41459,2,7),
-(2807,24,69,2048,2,41459,0,2),
-(2808,24,69,2048,2,41459,1,2),
-(2809,24,69,2048,2,41459,2,2),
-(2810,24,69,4096,2,41459,0,2),
-(2811,24,69,4096,2,41459,1,2),
-(2812,24,69,4096,2,41459,2,2),
-(2813,24,69,8192,2,41459,0,2),
-(2814,24,69,8192,2,41459,1,2),
-(2815,24,69,8192,2,41459,2,2),
-(2816,24,69,32,2,41459,0,5),
-(2817,24,69,32,2,41459,1,5),
-(2818,24,69,32,2,41459,2,5),
-(2819,24,69,512,2,41459,0,5),
-(2820,24,69,512,2,41459,1,5),
-(2821,24,69,512,2,41459,2,5),
-(2822,24,69,2,2,41459,0,4),
-(2823,24,69,2,2,41459,1,4),
-(2824,24,69,2,2,41459,2,4),
-(2825,40,69,0,2,41459,0,7),
-(2826,40,69,1,2,41459,0,3),
-(2827,40,69,1,2,41459,1,3),
-(2828,40,69,1,2,41459,2,3),
-(2829,40,69,16,2,41459,0,2),
-(2830,40,69,16,2,41459,1,2),
-(2831,40,69,16,2,41459,2,2),
-(2832,40,69,128,2,41459,0,7),
-(2833,40,69,128,2,41459,1,7),
-(2834,40,69,128,2,41459,2,7),
-(2835,40,69,256,2,41459,0,7),
-(2836,40,69,256,2,41459,1,7),
-(2837,40,69,256,2,41459,2,7),
-(2838,40,69,1024,2,41459,0,7),
-(2839,40,69,1024,2,41459,1,7),
-(2840,40,69,1024,2,41459,2,7),
-(2841,40,69,2048,2,41459,0,2),
-(2842,40,69,2048,2,41459,1,2),
-(2843,40,69,2048,2,41459,2,2),
-(2844,40,69,4096,2,41459,0,2),
-(2845,40,69,4096,2,41459,1,2),
-(2846,40,69,4096,2,41459,2,2),
-(2847,40,69,8192,2,41459,0,2),
-(2848,40,69,8192,2,41459,1,2),
-(2849,40,69,8192,2,41459,2,2),
-(2850,40,69,32,2,41459,0,5),
-(2851,40,69,32,2,41459,1,5),
-(2852,40,69,32,2,41459,2,5),
-(2853,40,69,512,2,41459,0,5),
-(2854,40,69,512,2,41459,1,5),
-(2855,40,69,512,2,41459,2,5),
-(2856,40,69,2,2,41459,0,4),
-(2857,40,69,2,2,41459,1,4),
-(2858,40,69,2,2,41459,2,4),
-(2859,5,12,0,2,327692,0,23),
-(2860,5,12,1,2,327692,0,3),
-(2861,5,12,1,2,327692,1,3),
-(2862,5,12,1,2,327692,2,3),
-(2863,5,12,16,2,327692,0,2),
-(2864,5,12,16,2,327692,1,2),
-(2865,5,12,16,2,327692,2,2),
-(2866,5,12,128,2,327692,0,23),
-(2867,5,12,128,2,327692,1,23),
-(2868,5,12,128,2,327692,2,23),
-(2869,5,12,256,2,327692,0,23),
-(2870,5,12,256,2,327692,1,23),
-(2871,5,12,256,2,327692,2,23),
-(2872,5,12,1024,2,327692,0,7),
-(2873,5,12,1024,2,327692,1,7),
-(2874,5,12,1024,2,327692,2,7),
-(2875,5,12,2048,2,327692,0,2),
-(2876,5,12,2048,2,327692,1,2),
-(2877,5,12,2048,2,327692,2,2),
-(2878,5,12,4096,2,327692,0,2),
-(2879,5,12,4096,2,327692,1,2),
-(2880,5,12,4096,2,327692,2,2),
-(2881,5,12,8192,2,327692,0,2),
-(2882,5,12,8192,2,327692,1,2),
-(2883,5,12,8192,2,327692,2,2),
-(2884,5,12,32,2,327692,0,21),
-(2885,5,12,32,2,327692,1,21),
-(2886,5,12,32,2,327692,2,21),
-(2887,5,12,512,2,327692,0,21),
-(2888,5,12,512,2,327692,1,21),
-(2889,5,12,512,2,327692,2,21),
-(2890,5,12,2,2,327692,0,20),
-(2891,5,12,2,2,327692,1,20),
-(2892,5,12,2,2,327692,2,20),
-(2893,10,22,0,2,327692,0,23),
-(2894,10,22,1,2,327692,0,3),
-(2895,10,22,1,2,327692,1,3),
-(2896,10,22,1,2,327692,2,3),
-(2897,10,22,16,2,327692,0,2),
-(2898,10,22,16,2,327692,1,2),
-(2899,10,22,16,2,327692,2,2),
-(2900,10,22,128,2,327692,0,23),
-(2901,10,22,128,2,327692,1,23),
-(2902,10,22,128,2,327692,2,23),
-(2903,10,22,256,2,327692,0,23),
-(2904,10,22,256,2,327692,1,23),
-(2905,10,22,256,2,327692,2,23),
-(2906,10,22,1024,2,327692,0,7),
-(2907,10,22,1024,2,327692,1,7),
-(2908,10,22,1024,2,327692,2,7),
-(2909,10,22,2048,2,327692,0,2),
-(2910,10,22,2048,2,327692,1,2),
-(2911,10,22,2048,2,327692,2,2),
-(2912,10,22,4096,2,327692,0,2),
-(2913,10,22,4096,2,327692,1,2),
-(2914,10,22,4096,2,327692,2,2),
-(2915,10,22,8192,2,327692,0,2),
-(2916,10,22,8192,2,327692,1,2),
-(2917,10,22,8192,2,327692,2,2),
-(2918,10,22,32,2,327692,0,21),
-(2919,10,22,32,2,327692,1,21),
-(2920,10,22,32,2,327692,2,21),
-(2921,10,22,512,2,327692,0,21),
-(2922,10,22,512,2,327692,1,21),
-(2923,10,22,512,2,327692,2,21),
-(2924,10,22,2,2,327692,0,20),
-(2925,10,22,2,2,327692,1,20),
-(2926,10,22,2,2,327692,2,20),
-(2927,20,36,0,2,327692,0,23),
-(2928,20,36,1,2,327692,0,3),
-(2929,20,36,1,2,327692,1,3),
-(2930,20,36,1,2,327692,2,3),
-(2931,20,36,16,2,327692,0,2),
-(2932,20,36,16,2,327692,1,2),
-(2933,20,36,16,2,327692,2,2),
-(2934,20,36,128,2,327692,0,23),
-(2935,20,36,128,2,327692,1,23),
-(2936,20,36,128,2,327692,2,23),
-(2937,20,36,256,2,327692,0,23),
-(2938,20,36,256,2,327692,1,23),
-(2939,20,36,256,2,327692,2,23),
-(2940,20,36,1024,2,327692,0,7),
-(2941,20,36,1024,2,327692,1,7),
-(2942,20,36,1024,2,327692,2,7),
-(2943,20,36,2048,2,327692,0,2),
-(2944,20,36,2048,2,327692,1,2),
-(2945,20,36,2048,2,327692,2,2),
-(2946,20,36,4096,2,327692,0,2),
-(2947,20,36,4096,2,327692,1,2),
-(2948,20,36,4096,2,327692,2,2),
-(2949,20,36,8192,2,327692,0,2),
-(2950,20,36,8192,2,327692,1,2),
-(2951,20,36,8192,2,327692,2,2),
-(2952,20,36,32,2,327692,0,21),
-(2953,20,36,32,2,327692,1,21),
-(2954,20,36,32,2,327692,2,21),
-(2955,20,36,512,2,327692,0,21),
-(2956,20,36,512,2,327692,1,21),
-(2957,20,36,512,2,327692,2,21),
-(2958,20,36,2,2,327692,0,20),
-(2959,20,36,2,2,327692,1,20),
-(2960,20,36,2,2,327692,2,20),
-(2961,24,83,0,2,41459,0,7),
-(2962,24,83,1,2,41459,0,3),
-(2963,24,83,1,2,41459,1,3),
-(2964,24,83,1,2,41459,2,3),
-(2965,24,83,16,2,41459,0,2),
-(2966,24,83,16,2,41459,1,2),
-(2967,24,83,16,2,41459,2,2),
-(2968,24,83,128,2,41459,0,7),
-(2969,24,83,128,2,41459,1,7),
-(2970,24,83,128,2,41459,2,7),
-(2971,24,83,256,2,41459,0,7),
-(2972,24,83,256,2,41459,1,7),
-(2973,24,83,256,2,41459,2,7),
-(2974,24,83,1024,2,41459,0,7),
-(2975,24,83,1024,2,41459,1,7),
-(2976,24,83,1024,2,41459,2,7),
-(2977,24,83,2048,2,41459,0,2),
-(2978,24,83,2048,2,41459,1,2),
-(2979,24,83,2048,2,41459,2,2),
-(2980,24,83,4096,2,41459,0,2),
-(2981,24,83,4096,2,41459,1,2),
-(2982,24,83,4096,2,41459,2,2),
-(2983,24,83,8192,2,41459,0,2),
-(2984,24,83,8192,2,41459,1,2),
-(2985,24,83,8192,2,41459,2,2),
-(2986,24,83,32,2,41459,0,5),
-(2987,24,83,32,2,41459,1,5),
-(2988,24,83,32,2,41459,2,5),
-(2989,24,83,512,2,41459,0,5),
-(2990,24,83,512,2,41459,1,5),
-(2991,24,83,512,2,41459,2,5),
-(2992,24,83,2,2,41459,0,4),
-(2993,24,83,2,2,41459,1,4),
-(2994,24,83,2,2,41459,2,4),
-(2995,40,65,0,2,41459,0,7),
-(2996,40,65,1,2,41459,0,3),
-(2997,40,65,1,2,41459,1,3),
-(2998,40,65,1,2,41459,2,3),
-(2999,40,65,16,2,41459,0,2),
-(3000,40,65,16,2,41459,1,2),
-(3001,40,65,16,2,41459,2,2),
-(3002,40,65,128,2,41459,0,7),
-(3003,40,65,128,2,41459,1,7),
-(3004,40,65,128,2,41459,2,7),
-(3005,40,65,256,2,41459,0,7),
-(3006,40,65,256,2,41459,1,7),
-(3007,40,65,256,2,41459,2,7),
-(3008,40,65,1024,2,41459,0,7),
-(3009,40,65,1024,2,41459,1,7),
-(3010,40,65,1024,2,41459,2,7),
-(3011,40,65,2048,2,41459,0,2),
-(3012,40,65,2048,2,41459,1,2),
-(3013,40,65,2048,2,41459,2,2),
-(3014,40,65,4096,2,41459,0,2),
-(3015,40,65,4096,2,41459,1,2),
-(3016,40,65,4096,2,41459,2,2),
-(3017,40,65,8192,2,41459,0,2),
-(3018,40,65,8192,2,41459,1,2),
-(3019,40,65,8192,2,41459,2,2),
-(3020,40,65,32,2,41459,0,5),
-(3021,40,65,32,2,41459,1,5),
-(3022,40,65,32,2,41459,2,5),
-(3023,40,65,512,2,41459,0,5),
-(3024,40,65,512,2,41459,1,5),
-(3025,40,65,512,2,41459,2,5),
-(3026,40,65,2,2,41459,0,4),
-(3027,40,65,2,2,41459,1,4),
-(3028,40,65,2,2,41459,2,4),
-(3029,1,59,0,2,41459,0,7),
-(3030,1,59,1,2,41459,0,3),
-(3031,1,59,1,2,41459,1,3),
-(3032,1,59,1,2,41459,2,3),
-(3033,1,59,16,2,41459,0,2),
-(3034,1,59,16,2,41459,1,2),
-(3035,1,59,16,2,41459,2,2),
-(3036,1,59,128,2,41459,0,7),
-(3037,1,59,128,2,41459,1,7),
-(3038,1,59,128,2,41459,2,7),
-(3039,1,59,256,2,41459,0,7),
-(3040,1,59,256,2,41459,1,7),
-(3041,1,59,256,2,41459,2,7),
-(3042,1,59,1024,2,41459,0,7),
-(3043,1,59,1024,2,41459,1,7),
-(3044,1,59,1024,2,41459,2,7),
-(3045,1,59,2048,2,41459,0,2),
-(3046,1,59,2048,2,41459,1,2),
-(3047,1,59,2048,2,41459,2,2),
-(3048,1,59,4096,2,41459,0,2),
-(3049,1,59,4096,2,41459,1,2),
-(3050,1,59,4096,2,41459,2,2),
-(3051,1,59,8192,2,41459,0,2),
-(3052,1,59,8192,2,41459,1,2),
-(3053,1,59,8192,2,41459,2,2),
-(3054,1,59,32,2,41459,0,5),
-(3055,1,59,32,2,41459,1,5),
-(3056,1,59,32,2,41459,2,5),
-(3057,1,59,512,2,41459,0,5),
-(3058,1,59,512,2,41459,1,5),
-(3059,1,59,512,2,41459,2,5),
-(3060,1,59,2,2,41459,0,4),
-(3061,1,59,2,2,41459,1,4),
-(3062,1,59,2,2,41459,2,4),
-(3063,1,4,0,2,164291,0,7),
-(3064,1,4,1,2,164291,0,3),
-(3065,1,4,1,2,164291,1,3),
-(3066,1,4,1,2,164291,2,3),
-(3067,1,4,16,2,164291,0,2),
-(3068,1,4,16,2,164291,1,2),
-(3069,1,4,16,2,164291,2,2),
-(3070,1,4,128,2,164291,0,7),
-(3071,1,4,128,2,164291,1,7),
-(3072,1,4,128,2,164291,2,7),
-(3073,1,4,256,2,164291,0,7),
-(3074,1,4,256,2,164291,1,7),
-(3075,1,4,256,2,164291,2,7),
-(3076,1,4,1024,2,164291,0,7),
-(3077,1,4,1024,2,164291,1,7),
-(3078,1,4,1024,2,164291,2,7),
-(3079,1,4,2048,2,164291,0,2),
-(3080,1,4,2048,2,164291,1,2),
-(3081,1,4,2048,2,164291,2,2),
-(3082,1,4,4096,2,164291,0,2),
-(3083,1,4,4096,2,164291,1,2),
-(3084,1,4,4096,2,164291,2,2),
-(3085,1,4,8192,2,164291,0,2),
-(3086,1,4,8192,2,164291,1,2),
-(3087,1,4,8192,2,164291,2,2),
-(3088,1,4,32,2,164291,0,5),
-(3089,1,4,32,2,164291,1,5),
-(3090,1,4,32,2,164291,2,5),
-(3091,1,4,512,2,164291,0,5),
-(3092,1,4,512,2,164291,1,5),
-(3093,1,4,512,2,164291,2,5),
-(3094,1,4,2,2,164291,0,4),
-(3095,1,4,2,2,164291,1,4),
-(3096,1,4,2,2,164291,2,4),
-(3097,28,36,0,2,41459,0,7),
-(3098,28,36,1,2,41459,0,3),
-(3099,28,36,1,2,41459,1,3),
-(3100,28,36,1,2,41459,2,3),
-(3101,28,36,16,2,41459,0,2),
-(3102,28,36,16,2,41459,1,2),
-(3103,28,36,16,2,41459,2,2),
-(3104,28,36,128,2,41459,0,7),
-(3105,28,36,128,2,41459,1,7),
-(3106,28,36,128,2,41459,2,7),
-(3107,28,36,256,2,41459,0,7),
-(3108,28,36,256,2,41459,1,7),
-(3109,28,36,256,2,41459,2,7),
-(3110,28,36,1024,2,41459,0,7),
-(3111,28,36,1024,2,41459,1,7),
-(3112,28,36,1024,2,41459,2,7),
-(3113,28,36,2048,2,41459,0,2),
-(3114,28,36,2048,2,41459,1,2),
-(3115,28,36,2048,2,41459,2,2),
-(3116,28,36,4096,2,41459,0,2),
-(3117,28,36,4096,2,41459,1,2),
-(3118,28,36,4096,2,41459,2,2),
-(3119,28,36,8192,2,41459,0,2),
-(3120,28,36,8192,2,41459,1,2),
-(3121,28,36,8192,2,41459,2,2),
-(3122,28,36,32,2,41459,0,5),
-(3123,28,36,32,2,41459,1,5),
-(3124,28,36,32,2,41459,2,5),
-(3125,28,36,512,2,41459,0,5),
-(3126,28,36,512,2,41459,1,5),
-(3127,28,36,512,2,41459,2,5),
-(3128,28,36,2,2,41459,0,4),
-(3129,28,36,2,2,41459,1,4),
-(3130,28,36,2,2,41459,2,4),
-(3131,1,6,0,2,41459,0,7),
-(3132,1,6,1,2,41459,0,3),
-(3133,1,6,1,2,41459,1,3),
-(3134,1,6,1,2,41459,2,3),
-(3135,1,6,16,2,41459,0,2),
-(3136,1,6,16,2,41459,1,2),
-(3137,1,6,16,2,41459,2,2),
-(3138,1,6,128,2,41459,0,7),
-(3139,1,6,128,2,41459,1,7),
-(3140,1,6,128,2,41459,2,7),
-(3141,1,6,256,2,41459,0,7),
-(3142,1,6,256,2,41459,1,7),
-(3143,1,6,256,2,41459,2,7),
-(3144,1,6,1024,2,41459,0,7),
-(3145,1,6,1024,2,41459,1,7),
-(3146,1,6,1024,2,41459,2,7),
-(3147,1,6,2048,2,41459,0,2),
-(3148,1,6,2048,2,41459,1,2),
-(3149,1,6,2048,2,41459,2,2),
-(3150,1,6,4096,2,41459,0,2),
-(3151,1,6,4096,2,41459,1,2),
-(3152,1,6,4096,2,41459,2,2),
-(3153,1,6,8192,2,41459,0,2),
-(3154,1,6,8192,2,41459,1,2),
-(3155,1,6,8192,2,41459,2,2),
-(3156,1,6,32,2,41459,0,5),
-(3157,1,6,32,2,41459,1,5),
-(3158,1,6,32,2,41459,2,5),
-(3159,1,6,512,2,41459,0,5),
-(3160,1,6,512,2,41459,1,5),
-(3161,1,6,512,2,41459,2,5),
-(3162,1,6,2,2,41459,0,4),
-(3163,1,6,2,2,41459,1,4),
-(3164,1,6,2,2,41459,2,4),
-(3165,1,12,0,2,41459,0,7),
-(3166,1,12,1,2,41459,0,3),
-(3167,1,12,1,2,41459,1,3),
-(3168,1,12,1,2,41459,2,3),
-(3169,1,12,16,2,41459,0,2),
-(3170,1,12,16,2,41459,1,2),
-(3171,1,12,16,2,41459,2,2),
-(3172,1,12,128,2,41459,0,7),
-(3173,1,12,128,2,41459,1,7),
-(3174,1,12,128,2,41459,2,7),
-(3175,1,12,256,2,41459,0,7),
-(3176,1,12,256,2,41459,1,7),
-(3177,1,12,256,2,41459,2,7),
-(3178,1,12,1024,2,41459,0,7),
-(3179,1,12,1024,2,41459,1,7),
-(3180,1,12,1024,2,41459,2,7),
-(3181,1,12,2048,2,41459,0,2),
-(3182,1,12,2048,2,41459,1,2),
-(3183,1,12,2048,2,41459,2,2),
-(3184,1,12,4096,2,41459,0,2),
-(3185,1,12,4096,2,41459,1,2),
-(3186,1,12,4096,2,41459,2,2),
-(3187,1,12,8192,2,41459,0,2),
-(3188,1,12,8192,2,41459,1,2),
-(3189,1,12,8192,2,41459,2,2),
-(3190,1,12,32,2,41459,0,5),
-(3191,1,12,32,2,41459,1,5),
-(3192,1,12,32,2,41459,2,5),
-(3193,1,12,512,2,41459,0,5),
-(3194,1,12,512,2,41459,1,5),
-(3195,1,12,512,2,41459,2,5),
-(3196,1,12,2,2,41459,0,4),
-(3197,1,12,2,2,41459,1,4),
-(3198,1,12,2,2,41459,2,4),
-(3199,5,13,0,2,41459,0,7),
-(3200,5,13,1,2,41459,0,3),
-(3201,5,13,1,2,41459,1,3),
-(3202,5,13,1,2,41459,2,3),
-(3203,5,13,16,2,41459,0,2),
-(3204,5,13,16,2,41459,1,2),
-(3205,5,13,16,2,41459,2,2),
-(3206,5,13,128,2,41459,0,7),
-(3207,5,13,128,2,41459,1,7),
-(3208,5,13,128,2,41459,2,7),
-(3209,5,13,256,2,41459,0,7),
-(3210,5,13,256,2,41459,1,7),
-(3211,5,13,256,2,41459,2,7),
-(3212,5,13,1024,2,41459,0,7),
-(3213,5,13,1024,2,41459,1,7),
-(3214,5,13,1024,2,41459,2,7),
-(3215,5,13,2048,2,41459,0,2),
-(3216,5,13,2048,2,41459,1,2),
-(3217,5,13,2048,2,41459,2,2),
-(3218,5,13,4096,2,41459,0,2),
-(3219,5,13,4096,2,41459,1,2),
-(3220,5,13,4096,2,41459,2,2),
-(3221,5,13,8192,2,41459,0,2),
-(3222,5,13,8192,2,41459,1,2),
-(3223,5,13,8192,2,41459,2,2),
-(3224,5,13,32,2,41459,0,5),
-(3225,5,13,32,2,41459,1,5),
-(3226,5,13,32,2,41459,2,5),
-(3227,5,13,512,2,41459,0,5),
-(3228,5,13,512,2,41459,1,5),
-(3229,5,13,512,2,41459,2,5),
-(3230,5,13,2,2,41459,0,4),
-(3231,5,13,2,2,41459,1,4),
-(3232,5,13,2,2,41459,2,4),
-(3233,7,16,0,2,41459,0,7),
-(3234,7,16,1,2,41459,0,3),
-(3235,7,16,1,2,41459,1,3),
-(3236,7,16,1,2,41459,2,3),
-(3237,7,16,16,2,41459,0,2),
-(3238,7,16,16,2,41459,1,2),
-(3239,7,16,16,2,41459,2,2),
-(3240,7,16,128,2,41459,0,7),
-(3241,7,16,128,2,41459,1,7),
-(3242,7,16,128,2,41459,2,7),
-(3243,7,16,256,2,41459,0,7),
-(3244,7,16,256,2,41459,1,7),
-(3245,7,16,256,2,41459,2,7),
-(3246,7,16,1024,2,41459,0,7),
-(3247,7,16,1024,2,41459,1,7),
-(3248,7,16,1024,2,41459,2,7),
-(3249,7,16,2048,2,41459,0,2),
-(3250,7,16,2048,2,41459,1,2),
-(3251,7,16,2048,2,41459,2,2),
-(3252,7,16,4096,2,41459,0,2),
-(3253,7,16,4096,2,41459,1,2),
-(3254,7,16,4096,2,41459,2,2),
-(3255,7,16,8192,2,41459,0,2),
-(3256,7,16,8192,2,41459,1,2),
-(3257,7,16,8192,2,41459,2,2),
-(3258,7,16,32,2,41459,0,5),
-(3259,7,16,32,2,41459,1,5),
-(3260,7,16,32,2,41459,2,5),
-(3261,7,16,512,2,41459,0,5),
-(3262,7,16,512,2,41459,1,5),
-(3263,7,16,512,2,41459,2,5),
-(3264,7,16,2,2,41459,0,4),
-(3265,7,16,2,2,41459,1,4),
-(3266,7,16,2,2,41459,2,4),
-(3267,9,18,0,2,41459,0,7),
-(3268,9,18,1,2,41459,0,3),
-(3269,9,18,1,2,41459,1,3),
-(3270,9,18,1,2,41459,2,3),
-(3271,9,18,16,2,41459,0,2),
-(3272,9,18,16,2,41459,1,2),
-(3273,9,18,16,2,41459,2,2),
-(3274,9,18,128,2,41459,0,7),
-(3275,9,18,128,2,41459,1,7),
-(3276,9,18,128,2,41459,2,7),
-(3277,9,18,256,2,41459,0,7),
-(3278,9,18,256,2,41459,1,7),
-(3279,9,18,256,2,41459,2,7),
-(3280,9,18,1024,2,41459,0,7),
-(3281,9,18,1024,2,41459,1,7),
-(3282,9,18,1024,2,41459,2,7),
-(3283,9,18,2048,2,41459,0,2),
-(3284,9,18,2048,2,41459,1,2),
-(3285,9,18,2048,2,41459,2,2),
-(3286,9,18,4096,2,41459,0,2),
-(3287,9,18,4096,2,41459,1,2),
-(3288,9,18,4096,2,41459,2,2),
-(3289,9,18,8192,2,41459,0,2),
-(3290,9,18,8192,2,41459,1,2),
-(3291,9,18,8192,2,41459,2,2),
-(3292,9,18,32,2,41459,0,5),
-(3293,9,18,32,2,41459,1,5),
-(3294,9,18,32,2,41459,2,5),
-(3295,9,18,512,2,41459,0,5),
-(3296,9,18,512,2,41459,1,5),
-(3297,9,18,512,2,41459,2,5),
-(3298,9,18,2,2,41459,0,4),
-(3299,9,18,2,2,41459,1,4),
-(3300,9,18,2,2,41459,2,4),
-(3301,10,25,0,2,41459,0,7),
-(3302,10,25,1,2,41459,0,3),
-(3303,10,25,1,2,41459,1,3),
-(3304,10,25,1,2,41459,2,3),
-(3305,10,25,16,2,41459,0,2),
-(3306,10,25,16,2,41459,1,2),
-(3307,10,25,16,2,41459,2,2),
-(3308,10,25,128,2,41459,0,7),
-(3309,10,25,128,2,41459,1,7),
-(3310,10,25,128,2,41459,2,7),
-(3311,10,25,256,2,41459,0,7),
-(3312,10,25,256,2,41459,1,7),
-(3313,10,25,256,2,41459,2,7),
-(3314,10,25,1024,2,41459,0,7),
-(3315,10,25,1024,2,41459,1,7),
-(3316,10,25,1024,2,41459,2,7),
-(3317,10,25,2048,2,41459,0,2),
-(3318,10,25,2048,2,41459,1,2),
-(3319,10,25,2048,2,41459,2,2),
-(3320,10,25,4096,2,41459,0,2),
-(3321,10,25,4096,2,41459,1,2),
-(3322,10,25,4096,2,41459,2,2),
-(3323,10,25,8192,2,41459,0,2),
-(3324,10,25,8192,2,41459,1,2),
-(3325,10,25,8192,2,41459,2,2),
-(3326,10,25,32,2,41459,0,5),
-(3327,10,25,32,2,41459,1,5),
-(3328,10,25,32,2,41459,2,5),
-(3329,10,25,512,2,41459,0,5),
-(3330,10,25,512,2,41459,1,5),
-(3331,10,25,512,2,41459,2,5),
-(3332,10,25,2,2,41459,0,4),
-(3333,10,25,2,2,41459,1,4),
-(3334,10,25,2,2,41459,2,4),
-(3335,20,33,0,2,41459,0,7),
-(3336,20,33,1,2,41459,0,3),
-(3337,20,33,1,2,41459,1,3),
-(3338,20,33,1,2,41459,2,3),
-(3339,20,33,16,2,41459,0,2),
-(3340,20,33,16,2,41459,1,2),
-(3341,20,33,16,2,41459,2,2),
-(3342,20,33,128,2,41459,0,7),
-(3343,20,33,128,2,41459,1,7),
-(3344,20,33,128,2,41459,2,7),
-(3345,20,33,256,2,41459,0,7),
-(3346,20,33,256,2,41459,1,7),
-(3347,20,33,256,2,41459,2,7),
-(3348,20,33,1024,2,41459,0,7),
-(3349,20,33,1024,2,41459,1,7),
-(3350,20,33,1024,2,41459,2,7),
-(3351,20,33,2048,2,41459,0,2),
-(3352,20,33,2048,2,41459,1,2),
-(3353,20,33,2048,2,41459,2,2),
-(3354,20,33,4096,2,41459,0,2),
-(3355,20,33,4096,2,41459,1,2),
-(3356,20,33,4096,2,41459,2,2),
-(3357,20,33,8192,2,41459,0,2),
-(3358,20,33,8192,2,41459,1,2),
-(3359,20,33,8192,2,41459,2,2),
-(3360,20,33,32,2,41459,0,5),
-(3361,20,33,32,2,41459,1,5),
-(3362,20,33,32,2,41459,2,5),
-(3363,20,33,512,2,41459,0,5),
-(3364,20,33,512,2,41459,1,5),
-(3365,20,33,512,2,41459,2,5),
-(3366,20,33,2,2,41459,0,4),
-(3367,20,33,2,2,41459,1,4),
-(3368,20,33,2,2,41459,2,4),
-(3369,1,85,0,2,128,0,7),
-(3370,1,85,1,2,128,0,3),
-(3371,1,85,1,2,128,1,3),
-(3372,1,85,1,2,128,2,3),
-(3373,1,85,16,2,128,0,2),
-(3374,1,85,16,2,128,1,2),
-(3375,1,85,16,2,128,2,2),
-(3376,1,85,128,2,128,0,7),
-(3377,1,85,128,2,128,1,7),
-(3378,1,85,128,2,128,2,7),
-(3379,1,85,256,2,128,0,7),
-(3380,1,85,256,2,128,1,7),
-(3381,1,85,256,2,128,2,7),
-(3382,1,85,1024,2,128,0,7),
-(3383,1,85,1024,2,128,1,7),
-(3384,1,85,1024,2,128,2,7),
-(3385,1,85,2048,2,128,0,2),
-(3386,1,85,2048,2,128,1,2),
-(3387,1,85,2048,2,128,2,2),
-(3388,1,85,4096,2,128,0,2),
-(3389,1,85,4096,2,128,1,2),
-(3390,1,85,4096,2,128,2,2),
-(3391,1,85,8192,2,128,0,2),
-(3392,1,85,8192,2,128,1,2),
-(3393,1,85,8192,2,128,2,2),
-(3394,1,85,32,2,128,0,5),
-(3395,1,85,32,2,128,1,5),
-(3396,1,85,32,2,128,2,5),
-(3397,1,85,512,2,128,0,5),
-(3398,1,85,512,2,128,1,5),
-(3399,1,85,512,2,128,2,5),
-(3400,1,85,2,2,128,0,4),
-(3401,1,85,2,2,128,1,4),
-(3402,1,85,2,2,128,2,4),
-(3403,1,85,0,2,128,0,7),
-(3404,1,85,1,2,128,0,3),
-(3405,1,85,1,2,128,1,3),
-(3406,1,85,1,2,128,2,3),
-(3407,1,85,16,2,128,0,2),
-(3408,1,85,16,2,128,1,2),
-(3409,1,85,16,2,128,2,2),
-(3410,1,85,128,2,128,0,7),
-(3411,1,85,128,2,128,1,7),
-(3412,1,85,128,2,128,2,7),
-(3413,1,85,256,2,128,0,7),
-(3414,1,85,256,2,128,1,7),
-(3415,1,85,256,2,128,2,7),
-(3416,1,85,1024,2,128,0,7),
-(3417,1,85,1024,2,128,1,7),
-(3418,1,85,1024,2,128,2,7),
-(3419,1,85,2048,2,128,0,2),
-(3420,1,85,2048,2,128,1,2),
-(3421,1,85,2048,2,128,2,2),
-(3422,1,85,4096,2,128,0,2),
-(3423,1,85,4096,2,128,1,2),
-(3424,1,85,4096,2,128,2,2),
-(3425,1,85,8192,2,128,0,2),
-(3426,1,85,8192,2,128,1,2),
-(3427,1,85,8192,2,128,2,2),
-(3428,1,85,32,2,128,0,5),
-(3429,1,85,32,2,128,1,5),
-(3430,1,85,32,2,128,2,5),
-(3431,1,85,512,2,128,0,5),
-(3432,1,85,512,2,128,1,5),
-(3433,1,85,512,2,128,2,5),
-(3434,1,85,2,2,128,0,4),
-(3435,1,85,2,2,128,1,4),
-(3436,1,85,2,2,128,2,4),
-(3437,1,85,0,2,128,0,7),
-(3438,1,85,1,2,128,0,3),
-(3439,1,85,1,2,128,1,3),
-(3440,1,85,1,2,128,2,3),
-(3441,1,85,16,2,128,0,2),
-(3442,1,85,16,2,128,1,2),
-(3443,1,85,16,2,128,2,2),
-(3444,1,85,128,2,128,0,7),
-(3445,1,85,128,2,128,1,7),
-(3446,1,85,128,2,128,2,7),
-(3447,1,85,256,2,128,0,7),
-(3448,1,85,256,2,128,1,7),
-(3449,1,85,256,2,128,2,7),
-(3450,1,85,1024,2,128,0,7),
-(3451,1,85,1024,2,128,1,7),
-(3452,1,85,1024,2,128,2,7),
-(3453,1,85,2048,2,128,0,2),
-(3454,1,85,2048,2,128,1,2),
-(3455,1,85,2048,2,128,2,2),
-(3456,1,85,4096,2,128,0,2),
-(3457,1,85,4096,2,128,1,2),
-(3458,1,85,4096,2,128,2,2),
-(3459,1,85,8192,2,128,0,2),
-(3460,1,85,8192,2,128,1,2),
-(3461,1,85,8192,2,128,2,2),
-(3462,1,85,32,2,128,0,5),
-(3463,1,85,32,2,128,1,5),
-(3464,1,85,32,2,128,2,5),
-(3465,1,85,512,2,128,0,5),
-(3466,1,85,512,2,128,1,5),
-(3467,1,85,512,2,128,2,5),
-(3468,1,85,2,2,128,0,4),
-(3469,1,85,2,2,128,1,4),
-(3470,1,85,2,2,128,2,4),
-(3471,1,85,0,2,128,0,7),
-(3472,1,85,1,2,128,0,3),
-(3473,1,85,1,2,128,1,3),
-(3474,1,85,1,2,128,2,3),
-(3475,1,85,16,2,128,0,2),
-(3476,1,85,16,2,128,1,2),
-(3477,1,85,16,2,128,2,2),
-(3478,1,85,128,2,128,0,7),
-(3479,1,85,128,2,128,1,7),
-(3480,1,85,128,2,128,2,7),
-(3481,1,85,256,2,128,0,7),
-(3482,1,85,256,2,128,1,7),
-(3483,1,85,256,2,128,2,7),
-(3484,1,85,1024,2,128,0,7),
-(3485,1,85,1024,2,128,1,7),
-(3486,1,85,1024,2,128,2,7),
-(3487,1,85,2048,2,128,0,2),
-(3488,1,85,2048,2,128,1,2),
-(3489,1,85,2048,2,128,2,2),
-(3490,1,85,4096,2,128,0,2),
-(3491,1,85,4096,2,128,1,2),
-(3492,1,85,4096,2,128,2,2),
-(3493,1,85,8192,2,128,0,2),
-(3494,1,85,8192,2,128,1,2),
-(3495,1,85,8192,2,128,2,2),
-(3496,1,85,32,2,128,0,5),
-(3497,1,85,32,2,128,1,5),
-(3498,1,85,32,2,128,2,5),
-(3499,1,85,512,2,128,0,5),
-(3500,1,85,512,2,128,1,5),
-(3501,1,85,512,2,128,2,5),
-(3502,1,85,2,2,128,0,4),
-(3503,1,85,2,2,128,1,4),
-(3504,1,85,2,2,128,2,4),
-(3505,1,85,0,2,128,0,7),
-(3506,1,85,1,2,128,0,3),
-(3507,1,85,1,2,128,1,3),
-(3508,1,85,1,2,128,2,3),
-(3509,1,85,16,2,128,0,2),
-(3510,1,85,16,2,128,1,2),
-(3511,1,85,16,2,128,2,2),
-(3512,1,85,128,2,128,0,7),
-(3513,1,85,128,2,128,1,7),
-(3514,1,85,128,2,128,2,7),
-(3515,1,85,256,2,128,0,7),
-(3516,1,85,256,2,128,1,7),
-(3517,1,85,256,2,128,2,7),
-(3518,1,85,1024,2,128,0,7),
-(3519,1,85,1024,2,128,1,7),
-(3520,1,85,1024,2,128,2,7),
-(3521,1,85,2048,2,128,0,2),
-(3522,1,85,2048,2,128,1,2),
-(3523,1,85,2048,2,128,2,2),
-(3524,1,85,4096,2,128,0,2),
-(3525,1,85,4096,2,128,1,2),
-(3526,1,85,4096,2,128,2,2),
-(3527,1,85,8192,2,128,0,2),
-(3528,1,85,8192,2,128,1,2),
-(3529,1,85,8192,2,128,2,2),
-(3530,1,85,32,2,128,0,5),
-(3531,1,85,32,2,128,1,5),
-(3532,1,85,32,2,128,2,5),
-(3533,1,85,512,2,128,0,5),
-(3534,1,85,512,2,128,1,5),
-(3535,1,85,512,2,128,2,5),
-(3536,1,85,2,2,128,0,4),
-(3537,1,85,2,2,128,1,4),
-(3538,1,85,2,2,128,2,4),
-(3539,1,85,0,2,128,0,7),
-(3540,1,85,1,2,128,0,3),
-(3541,1,85,1,2,128,1,3),
-(3542,1,85,1,2,128,2,3),
-(3543,1,85,16,2,128,0,2),
-(3544,1,85,16,2,128,1,2),
-(3545,1,85,16,2,128,2,2),
-(3546,1,85,128,2,128,0,7),
-(3547,1,85,128,2,128,1,7),
-(3548,1,85,128,2,128,2,7),
-(3549,1,85,256,2,128,0,7),
-(3550,1,85,256,2,128,1,7),
-(3551,1,85,256,2,128,2,7),
-(3552,1,85,1024,2,128,0,7),
-(3553,1,85,1024,2,128,1,7),
-(3554,1,85,1024,2,128,2,7),
-(3555,1,85,2048,2,128,0,2),
-(3556,1,85,2048,2,128,1,2),
-(3557,1,85,2048,2,128,2,2),
-(3558,1,85,4096,2,128,0,2),
-(3559,1,85,4096,2,128,1,2),
-(3560,1,85,4096,2,128,2,2),
-(3561,1,85,8192,2,128,0,2),
-(3562,1,85,8192,2,128,1,2),
-(3563,1,85,8192,2,128,2,2),
-(3564,1,85,32,2,128,0,5),
-(3565,1,85,32,2,128,1,5),
-(3566,1,85,32,2,128,2,5),
-(3567,1,85,512,2,128,0,5),
-(3568,1,85,512,2,128,1,5),
-(3569,1,85,512,2,128,2,5),
-(3570,1,85,2,2,128,0,4),
-(3571,1,85,2,2,128,1,4),
-(3572,1,85,2,2,128,2,4),
-(3573,1,85,0,2,128,0,7),
-(3574,1,85,1,2,128,0,3),
-(3575,1,85,1,2,128,1,3),
-(3576,1,85,1,2,128,2,3),
-(3577,1,85,16,2,128,0,2),
-(3578,1,85,16,2,128,1,2),
-(3579,1,85,16,2,128,2,2),
-(3580,1,85,128,2,128,0,7),
-(3581,1,85,128,2,128,1,7),
-(3582,1,85,128,2,128,2,7),
-(3583,1,85,256,2,128,0,7),
-(3584,1,85,256,2,128,1,7),
-(3585,1,85,256,2,128,2,7),
-(3586,1,85,1024,2,128,0,7),
-(3587,1,85,1024,2,128,1,7),
-(3588,1,85,1024,2,128,2,7),
-(3589,1,85,2048,2,128,0,2),
-(3590,1,85,2048,2,128,1,2),
-(3591,1,85,2048,2,128,2,2),
-(3592,1,85,4096,2,128,0,2),
-(3593,1,85,4096,2,128,1,2),
-(3594,1,85,4096,2,128,2,2),
-(3595,1,85,8192,2,128,0,2),
-(3596,1,85,8192,2,128,1,2),
-(3597,1,85,8192,2,128,2,2),
-(3598,1,85,32,2,128,0,5),
-(3599,1,85,32,2,128,1,5),
-(3600,1,85,32,2,128,2,5),
-(3601,1,85,512,2,128,0,5),
-(3602,1,85,512,2,128,1,5),
-(3603,1,85,512,2,128,2,5),
-(3604,1,85,2,2,128,0,4),
-(3605,1,85,2,2,128,1,4),
-(3606,1,85,2,2,128,2,4),
-(3607,1,85,0,2,256,0,7),
-(3608,1,85,1,2,256,0,3),
-(3609,1,85,1,2,256,1,3),
-(3610,1,85,1,2,256,2,3),
-(3611,1,85,16,2,256,0,2),
-(3612,1,85,16,2,256,1,2),
-(3613,1,85,16,2,256,2,2),
-(3614,1,85,128,2,256,0,7),
-(3615,1,85,128,2,256,1,7),
-(3616,1,85,128,2,256,2,7),
-(3617,1,85,256,2,256,0,7),
-(3618,1,85,256,2,256,1,7),
-(3619,1,85,256,2,256,2,7),
-(3620,1,85,1024,2,256,0,7),
-(3621,1,85,1024,2,256,1,7),
-(3622,1,85,1024,2,256,2,7),
-(3623,1,85,2048,2,256,0,2),
-(3624,1,85,2048,2,256,1,2),
-(3625,1,85,2048,2,256,2,2),
-(3626,1,85,4096,2,256,0,2),
-(3627,1,85,4096,2,256,1,2),
-(3628,1,85,4096,2,256,2,2),
-(3629,1,85,8192,2,256,0,2),
-(3630,1,85,8192,2,256,1,2),
-(3631,1,85,8192,2,256,2,2),
-(3632,1,85,32,2,256,0,5),
-(3633,1,85,32,2,256,1,5),
-(3634,1,85,32,2,256,2,5),
-(3635,1,85,512,2,256,0,5),
-(3636,1,85,512,2,256,1,5),
-(3637,1,85,512,2,256,2,5),
-(3638,1,85,2,2,256,0,4),
-(3639,1,85,2,2,256,1,4),
-(3640,1,85,2,2,256,2,4),
-(3641,1,85,0,2,256,0,7),
-(3642,1,85,1,2,256,0,3),
-(3643,1,85,1,2,256,1,3),
-(3644,1,85,1,2,256,2,3),
-(3645,1,85,16,2,256,0,2),
-(3646,1,85,16,2,256,1,2),
-(3647,1,85,16,2,256,2,2),
-(3648,1,85,128,2,256,0,7),
-(3649,1,85,128,2,256,1,7),
-(3650,1,85,128,2,256,2,7),
-(3651,1,85,256,2,256,0,7),
-(3652,1,85,256,2,256,1,7),
-(3653,1,85,256,2,256,2,7),
-(3654,1,85,1024,2,256,0,7),
-(3655,1,85,1024,2,256,1,7),
-(3656,1,85,1024,2,256,2,7),
-(3657,1,85,2048,2,256,0,2),
-(3658,1,85,2048,2,256,1,2),
-(3659,1,85,2048,2,256,2,2),
-(3660,1,85,4096,2,256,0,2),
-(3661,1,85,4096,2,256,1,2),
-(3662,1,85,4096,2,256,2,2),
-(3663,1,85,8192,2,256,0,2),
-(3664,1,85,8192,2,256,1,2),
-(3665,1,85,8192,2,256,2,2),
-(3666,1,85,32,2,256,0,5),
-(3667,1,85,32,2,256,1,5),
-(3668,1,85,32,2,256,2,5),
-(3669,1,85,512,2,256,0,5),
-(3670,1,85,512,2,256,1,5),
-(3671,1,85,512,2,256,2,5),
-(3672,1,85,2,2,256,0,4),
-(3673,1,85,2,2,256,1,4),
-(3674,1,85,2,2,256,2,4),
-(3675,1,85,0,2,256,0,7),
-(3676,1,85,1,2,256,0,3),
-(3677,1,85,1,2,256,1,3),
-(3678,1,85,1,2,256,2,3),
-(3679,1,85,16,2,256,0,2),
-(3680,1,85,16,2,256,1,2),
-(3681,1,85,16,2,256,2,2),
-(3682,1,85,128,2,256,0,7),
-(3683,1,85,128,2,256,1,7),
-(3684,1,85,128,2,256,2,7),
-(3685,1,85,256,2,256,0,7),
-(3686,1,85,256,2,256,1,7),
-(3687,1,85,256,2,256,2,7),
-(3688,1,85,1024,2,256,0,7),
-(3689,1,85,1024,2,256,1,7),
-(3690,1,85,1024,2,256,2,7),
-(3691,1,85,2048,2,256,0,2),
-(3692,1,85,2048,2,256,1,2),
-(3693,1,85,2048,2,256,2,2),
-(3694,1,85,4096,2,256,0,2),
-(3695,1,85,4096,2,256,1,2),
-(3696,1,85,4096,2,256,2,2),
-(3697,1,85,8192,2,256,0,2),
-(3698,1,85,8192,2,256,1,2),
-(3699,1,85,8192,2,256,2,2),
-(3700,1,85,32,2,256,0,5),
-(3701,1,85,32,2,256,1,5),
-(3702,1,85,32,2,256,2,5),
-(3703,1,85,512,2,256,0,5),
-(3704,1,85,512,2,256,1,5),
-(3705,1,85,512,2,256,2,5),
-(3706,1,85,2,2,256,0,4),
-(3707,1,85,2,2,256,1,4),
-(3708,1,85,2,2,256,2,4),
-(3709,1,85,0,2,256,0,7),
-(3710,1,85,1,2,256,0,3),
-(3711,1,85,1,2,256,1,3),
-(3712,1,85,1,2,256,2,3),
-(3713,1,85,16,2,256,0,2),
-(3714,1,85,16,2,256,1,2),
-(3715,1,85,16,2,256,2,2),
-(3716,1,85,128,2,256,0,7),
-(3717,1,85,128,2,256,1,7),
-(3718,1,85,128,2,256,2,7),
-(3719,1,85,256,2,256,0,7),
-(3720,1,85,256,2,256,1,7),
-(3721,1,85,256,2,256,2,7),
-(3722,1,85,1024,2,256,0,7),
-(3723,1,85,1024,2,256,1,7),
-(3724,1,85,1024,2,256,2,7),
-(3725,1,85,2048,2,256,0,2),
-(3726,1,85,2048,2,256,1,2),
-(3727,1,85,2048,2,256,2,2),
-(3728,1,85,4096,2,256,0,2),
-(3729,1,85,4096,2,256,1,2),
-(3730,1,85,4096,2,256,2,2),
-(3731,1,85,8192,2,256,0,2),
-(3732,1,85,8192,2,256,1,2),
-(3733,1,85,8192,2,256,2,2),
-(3734,1,85,32,2,256,0,5),
-(3735,1,85,32,2,256,1,5),
-(3736,1,85,32,2,256,2,5),
-(3737,1,85,512,2,256,0,5),
-(3738,1,85,512,2,256,1,5),
-(3739,1,85,512,2,256,2,5),
-(3740,1,85,2,2,256,0,4),
-(3741,1,85,2,2,256,1,4),
-(3742,1,85,2,2,256,2,4),
-(3743,1,85,0,2,256,0,7),
-(3744,1,85,1,2,256,0,3),
-(3745,1,85,1,2,256,1,3),
-(3746,1,85,1,2,256,2,3),
-(3747,1,85,16,2,256,0,2),
-(3748,1,85,16,2,256,1,2),
-(3749,1,85,16,2,256,2,2),
-(3750,1,85,128,2,256,0,7),
-(3751,1,85,128,2,256,1,7),
-(3752,1,85,128,2,256,2,7),
-(3753,1,85,256,2,256,0,7),
-(3754,1,85,256,2,256,1,7),
-(3755,1,85,256,2,256,2,7),
-(3756,1,85,1024,2,256,0,7),
-(3757,1,85,1024,2,256,1,7),
-(3758,1,85,1024,2,256,2,7),
-(3759,1,85,2048,2,256,0,2),
-(3760,1,85,2048,2,256,1,2),
-(3761,1,85,2048,2,256,2,2),
-(3762,1,85,4096,2,256,0,2),
-(3763,1,85,4096,2,256,1,2),
-(3764,1,85,4096,2,256,2,2),
-(3765,1,85,8192,2,256,0,2),
-(3766,1,85,8192,2,256,1,2),
-(3767,1,85,8192,2,256,2,2),
-(3768,1,85,32,2,256,0,5),
-(3769,1,85,32,2,256,1,5),
-(3770,1,85,32,2,256,2,5),
-(3771,1,85,512,2,256,0,5),
-(3772,1,85,512,2,256,1,5),
-(3773,1,85,512,2,256,2,5),
-(3774,1,85,2,2,256,0,4),
-(3775,1,85,2,2,256,1,4),
-(3776,1,85,2,2,256,2,4),
-(3777,1,85,0,2,256,0,7),
-(3778,1,85,1,2,256,0,3),
-(3779,1,85,1,2,256,1,3),
-(3780,1,85,1,2,256,2,3),
-(3781,1,85,16,2,256,0,2),
-(3782,1,85,16,2,256,1,2),
-(3783,1,85,16,2,256,2,2),
-(3784,1,85,128,2,256,0,7),
-(3785,1,85,128,2,256,1,7),
-(3786,1,85,128,2,256,2,7),
-(3787,1,85,256,2,256,0,7),
-(3788,1,85,256,2,256,1,7),
-(3789,1,85,256,2,256,2,7),
-(3790,1,85,1024,2,256,0,7),
-(3791,1,85,1024,2,256,1,7),
-(3792,1,85,1024,2,256,2,7),
-(3793,1,85,2048,2,256,0,2),
-(3794,1,85,2048,2,256,1,2),
-(3795,1,85,2048,2,256,2,2),
-(3796,1,85,4096,2,256,0,2),
-(3797,1,85,4096,2,256,1,2),
-(3798,1,85,4096,2,256,2,2),
-(3799,1,85,8192,2,256,0,2),
-(3800,1,85,8192,2,256,1,2),
-(3801,1,85,8192,2,256,2,2),
-(3802,1,85,32,2,256,0,5),
-(3803,1,85,32,2,256,1,5),
-(3804,1,85,32,2,256,2,5),
-(3805,1,85,512,2,256,0,5),
-(3806,1,85,512,2,256,1,5),
-(3807,1,85,512,2,256,2,5),
-(3808,1,85,2,2,256,0,4),
-(3809,1,85,2,2,256,1,4),
-(3810,1,85,2,2,256,2,4),
-(3811,1,85,0,2,256,0,7),
-(3812,1,85,1,2,256,0,3),
-(3813,1,85,1,2,256,1,3),
-(3814,1,85,1,2,256,2,3),
-(3815,1,85,16,2,256,0,2),
-(3816,1,85,16,2,256,1,2),
-(3817,1,85,16,2,256,2,2),
-(3818,1,85,128,2,256,0,7),
-(3819,1,85,128,2,256,1,7),
-(3820,1,85,128,2,256,2,7),
-(3821,1,85,256,2,256,0,7),
-(3822,1,85,256,2,256,1,7),
-(3823,1,85,256,2,256,2,7),
-(3824,1,85,1024,2,256,0,7),
-(3825,1,85,1024,2,256,1,7),
-(3826,1,85,1024,2,256,2,7),
-(3827,1,85,2048,2,256,0,2),
-(3828,1,85,2048,2,256,1,2),
-(3829,1,85,2048,2,256,2,2),
-(3830,1,85,4096,2,256,0,2),
-(3831,1,85,4096,2,256,1,2),
-(3832,1,85,4096,2,256,2,2),
-(3833,1,85,8192,2,256,0,2),
-(3834,1,85,8192,2,256,1,2),
-(3835,1,85,8192,2,256,2,2),
-(3836,1,85,32,2,256,0,5),
-(3837,1,85,32,2,256,1,5),
-(3838,1,85,32,2,256,2,5),
-(3839,1,85,512,2,256,0,5),
-(3840,1,85,512,2,256,1,5),
-(3841,1,85,512,2,256,2,5),
-(3842,1,85,2,2,256,0,4),
-(3843,1,85,2,2,256,1,4),
-(3844,1,85,2,2,256,2,4),
-(3845,1,85,0,2,16,0,7),
-(3846,1,85,1,2,16,0,3),
-(3847,1,85,1,2,16,1,3),
-(3848,1,85,1,2,16,2,3),
-(3849,1,85,16,2,16,0,2),
-(3850,1,85,16,2,16,1,2),
-(3851,1,85,16,2,16,2,2),
-(3852,1,85,128,2,16,0,7),
-(3853,1,85,128,2,16,1,7),
-(3854,1,85,128,2,16,2,7),
-(3855,1,85,256,2,16,0,7),
-(3856,1,85,256,2,16,1,7),
-(3857,1,85,256,2,16,2,7),
-(3858,1,85,1024,2,16,0,7),
-(3859,1,85,1024,2,16,1,7),
-(3860,1,85,1024,2,16,2,7),
-(3861,1,85,2048,2,16,0,2),
-(3862,1,85,2048,2,16,1,2),
-(3863,1,85,2048,2,16,2,2),
-(3864,1,85,4096,2,16,0,2),
-(3865,1,85,4096,2,16,1,2),
-(3866,1,85,4096,2,16,2,2),
-(3867,1,85,8192,2,16,0,2),
-(3868,1,85,8192,2,16,1,2),
-(3869,1,85,8192,2,16,2,2),
-(3870,1,85,32,2,16,0,5),
-(3871,1,85,32,2,16,1,5),
-(3872,1,85,32,2,16,2,5),
-(3873,1,85,512,2,16,0,5),
-(3874,1,85,512,2,16,1,5),
-(3875,1,85,512,2,16,2,5),
-(3876,1,85,2,2,16,0,4),
-(3877,1,85,2,2,16,1,4),
-(3878,1,85,2,2,16,2,4),
-(3879,1,85,0,2,16,0,7),
-(3880,1,85,1,2,16,0,3),
-(3881,1,85,1,2,16,1,3),
-(3882,1,85,1,2,16,2,3),
-(3883,1,85,16,2,16,0,2),
-(3884,1,85,16,2,16,1,2),
-(3885,1,85,16,2,16,2,2),
-(3886,1,85,128,2,16,0,7),
-(3887,1,85,128,2,16,1,7),
-(3888,1,85,128,2,16,2,7),
-(3889,1,85,256,2,16,0,7),
-(3890,1,85,256,2,16,1,7),
-(3891,1,85,256,2,16,2,7),
-(3892,1,85,1024,2,16,0,7),
-(3893,1,85,1024,2,16,1,7),
-(3894,1,85,1024,2,16,2,7),
-(3895,1,85,2048,2,16,0,2),
-(3896,1,85,2048,2,16,1,2),
-(3897,1,85,2048,2,16,2,2),
-(3898,1,85,4096,2,16,0,2),
-(3899,1,85,4096,2,16,1,2),
-(3900,1,85,4096,2,16,2,2),
-(3901,1,85,8192,2,16,0,2),
-(3902,1,85,8192,2,16,1,2),
-(3903,1,85,8192,2,16,2,2),
-(3904,1,85,32,2,16,0,5),
-(3905,1,85,32,2,16,1,5),
-(3906,1,85,32,2,16,2,5),
-(3907,1,85,512,2,16,0,5),
-(3908,1,85,512,2,16,1,5),
-(3909,1,85,512,2,16,2,5),
-(3910,1,85,2,2,16,0,4),
-(3911,1,85,2,2,16,1,4),
-(3912,1,85,2,2,16,2,4),
-(3913,1,85,0,2,16,0,7),
-(3914,1,85,1,2,16,0,3),
-(3915,1,85,1,2,16,1,3),
-(3916,1,85,1,2,16,2,3),
-(3917,1,85,16,2,16,0,2),
-(3918,1,85,16,2,16,1,2),
-(3919,1,85,16,2,16,2,2),
-(3920,1,85,128,2,16,0,7),
-(3921,1,85,128,2,16,1,7),
-(3922,1,85,128,2,16,2,7),
-(3923,1,85,256,2,16,0,7),
-(3924,1,85,256,2,16,1,7),
-(3925,1,85,256,2,16,2,7),
-(3926,1,85,1024,2,16,0,7),
-(3927,1,85,1024,2,16,1,7),
-(3928,1,85,1024,2,16,2,7),
-(3929,1,85,2048,2,16,0,2),
-(3930,1,85,2048,2,16,1,2),
-(3931,1,85,2048,2,16,2,2),
-(3932,1,85,4096,2,16,0,2),
-(3933,1,85,4096,2,16,1,2),
-(3934,1,85,4096,2,16,2,2),
-(3935,1,85,8192,2,16,0,2),
-(3936,1,85,8192,2,16,1,2),
-(3937,1,85,8192,2,16,2,2),
-(3938,1,85,32,2,16,0,5),
-(3939,1,85,32,2,16,1,5),
-(3940,1,85,32,2,16,2,5),
-(3941,1,85,512,2,16,0,5),
-(3942,1,85,512,2,16,1,5),
-(3943,1,85,512,2,16,2,5),
-(3944,1,85,2,2,16,0,4),
-(3945,1,85,2,2,16,1,4),
-(3946,1,85,2,2,16,2,4),
-(3947,1,85,0,2,16,0,7),
-(3948,1,85,1,2,16,0,3),
-(3949,1,85,1,2,16,1,3),
-(3950,1,85,1,2,16,2,3),
-(3951,1,85,16,2,16,0,2),
-(3952,1,85,16,2,16,1,2),
-(3953,1,85,16,2,16,2,2),
-(3954,1,85,128,2,16,0,7),
-(3955,1,85,128,2,16,1,7),
-(3956,1,85,128,2,16,2,7),
-(3957,1,85,256,2,16,0,7),
-(3958,1,85,256,2,16,1,7),
-(3959,1,85,256,2,16,2,7),
-(3960,1,85,1024,2,16,0,7),
-(3961,1,85,1024,2,16,1,7),
-(3962,1,85,1024,2,16,2,7),
-(3963,1,85,2048,2,16,0,2),
-(3964,1,85,2048,2,16,1,2),
-(3965,1,85,2048,2,16,2,2),
-(3966,1,85,4096,2,16,0,2),
-(3967,1,85,4096,2,16,1,2),
-(3968,1,85,4096,2,16,2,2),
-(3969,1,85,8192,2,16,0,2),
-(3970,1,85,8192,2,16,1,2),
-(3971,1,85,8192,2,16,2,2),
-(3972,1,85,32,2,16,0,5),
-(3973,1,85,32,2,16,1,5),
-(3974,1,85,32,2,16,2,5),
-(3975,1,85,512,2,16,0,5),
-(3976,1,85,512,2,16,1,5),
-(3977,1,85,512,2,16,2,5),
-(3978,1,85,2,2,16,0,4),
-(3979,1,85,2,2,16,1,4),
-(3980,1,85,2,2,16,2,4),
-(3981,1,85,0,2,16,0,7),
-(3982,1,85,1,2,16,0,3),
-(3983,1,85,1,2,16,1,3),
-(3984,1,85,1,2,16,2,3),
-(3985,1,85,16,2,16,0,2),
-(3986,1,85,16,2,16,1,2),
-(3987,1,85,16,2,16,2,2),
-(3988,1,85,128,2,16,0,7),
-(3989,1,85,128,2,16,1,7),
-(3990,1,85,128,2,16,2,7),
-(3991,1,85,256,2,16,0,7),
-(3992,1,85,256,2,16,1,7),
-(3993,1,85,256,2,16,2,7),
-(3994,1,85,1024,2,16,0,7),
-(3995,1,85,1024,2,16,1,7),
-(3996,1,85,1024,2,16,2,7),
-(3997,1,85,2048,2,16,0,2),
-(3998,1,85,2048,2,16,1,2),
-(3999,1,85,2048,2,16,2,2),
-(4000,1,85,4096,2,16,0,2),
-(4001,1,85,4096,2,16,1,2),
-(4002,1,85,4096,2,16,2,2),
-(4003,1,85,8192,2,16,0,2),
-(4004,1,85,8192,2,16,1,2),
-(4005,1,85,8192,2,16,2,2),
-(4006,1,85,32,2,16,0,5),
-(4007,1,85,32,2,16,1,5),
-(4008,1,85,32,2,16,2,5),
-(4009,1,85,512,2,16,0,5),
-(4010,1,85,512,2,16,1,5),
-(4011,1,85,512,2,16,2,5),
-(4012,1,85,2,2,16,0,4),
-(4013,1,85,2,2,16,1,4),
-(4014,1,85,2,2,16,2,4),
-(4015,1,85,0,2,16,0,7),
-(4016,1,85,1,2,16,0,3),
-(4017,1,85,1,2,16,1,3),
-(4018,1,85,1,2,16,2,3),
-(4019,1,85,16,2,16,0,2),
-(4020,1,85,16,2,16,1,2),
-(4021,1,85,16,2,16,2,2),
-(4022,1,85,128,2,16,0,7),
-(4023,1,85,128,2,16,1,7),
-(4024,1,85,128,2,16,2,7),
-(4025,1,85,256,2,16,0,7),
-(4026,1,85,256,2,16,1,7),
-(4027,1,85,256,2,16,2,7),
-(4028,1,85,1024,2,16,0,7),
-(4029,1,85,1024,2,16,1,7),
-(4030,1,85,1024,2,16,2,7),
-(4031,1,85,2048,2,16,0,2),
-(4032,1,85,2048,2,16,1,2),
-(4033,1,85,2048,2,16,2,2),
-(4034,1,85,4096,2,16,0,2),
-(4035,1,85,4096,2,16,1,2),
-(4036,1,85,4096,2,16,2,2),
-(4037,1,85,8192,2,16,0,2),
-(4038,1,85,8192,2,16,1,2),
-(4039,1,85,8192,2,16,2,2),
-(4040,1,85,32,2,16,0,5),
-(4041,1,85,32,2,16,1,5),
-(4042,1,85,32,2,16,2,5),
-(4043,1,85,512,2,16,0,5),
-(4044,1,85,512,2,16,1,5),
-(4045,1,85,512,2,16,2,5),
-(4046,1,85,2,2,16,0,4),
-(4047,1,85,2,2,16,1,4),
-(4048,1,85,2,2,16,2,4),
-(4049,1,85,0,2,16,0,7),
-(4050,1,85,1,2,16,0,3),
-(4051,1,85,1,2,16,1,3),
-(4052,1,85,1,2,16,2,3),
-(4053,1,85,16,2,16,0,2),
-(4054,1,85,16,2,16,1,2),
-(4055,1,85,16,2,16,2,2),
-(4056,1,85,128,2,16,0,7),
-(4057,1,85,128,2,16,1,7),
-(4058,1,85,128,2,16,2,7),
-(4059,1,85,256,2,16,0,7),
-(4060,1,85,256,2,16,1,7),
-(4061,1,85,256,2,16,2,7),
-(4062,1,85,1024,2,16,0,7),
-(4063,1,85,1024,2,16,1,7),
-(4064,1,85,1024,2,16,2,7),
-(4065,1,85,2048,2,16,0,2),
-(4066,1,85,2048,2,16,1,2),
-(4067,1,85,2048,2,16,2,2),
-(4068,1,85,4096,2,16,0,2),
-(4069,1,85,4096,2,16,1,2),
-(4070,1,85,4096,2,16,2,2),
-(4071,1,85,8192,2,16,0,2),
-(4072,1,85,8192,2,16,1,2),
-(4073,1,85,8192,2,16,2,2),
-(4074,1,85,32,2,16,0,5),
-(4075,1,85,32,2,16,1,5),
-(4076,1,85,32,2,16,2,5),
-(4077,1,85,512,2,16,0,5),
-(4078,1,85,512,2,16,1,5),
-(4079,1,85,512,2,16,2,5),
-(4080,1,85,2,2,16,0,4),
-(4081,1,85,2,2,16,1,4),
-(4082,1,85,2,2,16,2,4),
-(4083,1,85,0,2,32,0,7),
-(4084,1,85,1,2,32,0,3),
-(4085,1,85,1,2,32,1,3),
-(4086,1,85,1,2,32,2,3),
-(4087,1,85,16,2,32,0,2),
-(4088,1,85,16,2,32,1,2),
-(4089,1,85,16,2,32,2,2),
-(4090,1,85,128,2,32,0,7),
-(4091,1,85,128,2,32,1,7),
-(4092,1,85,128,2,32,2,7),
-(4093,1,85,256,2,32,0,7),
-(4094,1,85,256,2,32,1,7),
-(4095,1,85,256,2,32,2,7),
-(4096,1,85,1024,2,32,0,7),
-(4097,1,85,1024,2,32,1,7),
-(4098,1,85,1024,2,32,2,7),
-(4099,1,85,2048,2,32,0,2),
-(4100,1,85,2048,2,32,1,2),
-(4101,1,85,2048,2,32,2,2),
-(4102,1,85,4096,2,32,0,2),
-(4103,1,85,4096,2,32,1,2),
-(4104,1,85,4096,2,32,2,2),
-(4105,1,85,8192,2,32,0,2),
-(4106,1,85,8192,2,32,1,2),
-(4107,1,85,8192,2,32,2,2),
-(4108,1,85,32,2,32,0,5),
-(4109,1,85,32,2,32,1,5),
-(4110,1,85,32,2,32,2,5),
-(4111,1,85,512,2,32,0,5),
-(4112,1,85,512,2,32,1,5),
-(4113,1,85,512,2,32,2,5),
-(4114,1,85,2,2,32,0,4),
-(4115,1,85,2,2,32,1,4),
-(4116,1,85,2,2,32,2,4),
-(4117,1,85,0,2,32,0,7),
-(4118,1,85,1,2,32,0,3),
-(4119,1,85,1,2,32,1,3),
-(4120,1,85,1,2,32,2,3),
-(4121,1,85,16,2,32,0,2),
-(4122,1,85,16,2,32,1,2),
-(4123,1,85,16,2,32,2,2),
-(4124,1,85,128,2,32,0,7),
-(4125,1,85,128,2,32,1,7),
-(4126,1,85,128,2,32,2,7),
-(4127,1,85,256,2,32,0,7),
-(4128,1,85,256,2,32,1,7),
-(4129,1,85,256,2,32,2,7),
-(4130,1,85,1024,2,32,0,7),
-(4131,1,85,1024,2,32,1,7),
-(4132,1,85,1024,2,32,2,7),
-(4133,1,85,2048,2,32,0,2),
-(4134,1,85,2048,2,32,1,2),
-(4135,1,85,2048,2,32,2,2),
-(4136,1,85,4096,2,32,0,2),
-(4137,1,85,4096,2,32,1,2),
-(4138,1,85,4096,2,32,2,2),
-(4139,1,85,8192,2,32,0,2),
-(4140,1,85,8192,2,32,1,2),
-(4141,1,85,8192,2,32,2,2),
-(4142,1,85,32,2,32,0,5),
-(4143,1,85,32,2,32,1,5),
-(4144,1,85,32,2,32,2,5),
-(4145,1,85,512,2,32,0,5),
-(4146,1,85,512,2,32,1,5),
-(4147,1,85,512,2,32,2,5),
-(4148,1,85,2,2,32,0,4),
-(4149,1,85,2,2,32,1,4),
-(4150,1,85,2,2,32,2,4),
-(4151,1,85,0,2,32,0,7),
-(4152,1,85,1,2,32,0,3),
-(4153,1,85,1,2,32,1,3),
-(4154,1,85,1,2,32,2,3),
-(4155,1,85,16,2,32,0,2),
-(4156,1,85,16,2,32,1,2),
-(4157,1,85,16,2,32,2,2),
-(4158,1,85,128,2,32,0,7),
-(4159,1,85,128,2,32,1,7),
-(4160,1,85,128,2,32,2,7),
-(4161,1,85,256,2,32,0,7),
-(4162,1,85,256,2,32,1,7),
-(4163,1,85,256,2,32,2,7),
-(4164,1,85,1024,2,32,0,7),
-(4165,1,85,1024,2,32,1,7),
-(4166,1,85,1024,2,32,2,7),
-(4167,1,85,2048,2,32,0,2),
-(4168,1,85,2048,2,32,1,2),
-(4169,1,85,2048,2,32,2,2),
-(4170,1,85,4096,2,32,0,2),
-(4171,1,85,4096,2,32,1,2),
-(4172,1,85,4096,2,32,2,2),
-(4173,1,85,8192,2,32,0,2),
-(4174,1,85,8192,2,32,1,2),
-(4175,1,85,8192,2,32,2,2),
-(4176,1,85,32,2,32,0,5),
-(4177,1,85,32,2,32,1,5),
-(4178,1,85,32,2,32,2,5),
-(4179,1,85,512,2,32,0,5),
-(4180,1,85,512,2,32,1,5),
-(4181,1,85,512,2,32,2,5),
-(4182,1,85,2,2,32,0,4),
-(4183,1,85,2,2,32,1,4),
-(4184,1,85,2,2,32,2,4),
-(4185,1,85,0,2,32,0,7),
-(4186,1,85,1,2,32,0,3),
-(4187,1,85,1,2,32,1,3),
-(4188,1,85,1,2,32,2,3),
-(4189,1,85,16,2,32,0,2),
-(4190,1,85,16,2,32,1,2),
-(4191,1,85,16,2,32,2,2),
-(4192,1,85,128,2,32,0,7),
-(4193,1,85,128,2,32,1,7),
-(4194,1,85,128,2,32,2,7),
-(4195,1,85,256,2,32,0,7),
-(4196,1,85,256,2,32,1,7),
-(4197,1,85,256,2,32,2,7),
-(4198,1,85,1024,2,32,0,7),
-(4199,1,85,1024,2,32,1,7),
-(4200,1,85,1024,2,32,2,7),
-(4201,1,85,2048,2,32,0,2),
-(4202,1,85,2048,2,32,1,2),
-(4203,1,85,2048,2,32,2,2),
-(4204,1,85,4096,2,32,0,2),
-(4205,1,85,4096,2,32,1,2),
-(4206,1,85,4096,2,32,2,2),
-(4207,1,85,8192,2,32,0,2),
-(4208,1,85,8192,2,32,1,2),
-(4209,1,85,8192,2,32,2,2),
-(4210,1,85,32,2,32,0,5),
-(4211,1,85,32,2,32,1,5),
-(4212,1,85,32,2,32,2,5),
-(4213,1,85,512,2,32,0,5),
-(4214,1,85,512,2,32,1,5),
-(4215,1,85,512,2,32,2,5),
-(4216,1,85,2,2,32,0,4),
-(4217,1,85,2,2,32,1,4),
-(4218,1,85,2,2,32,2,4),
-(4219,1,85,0,2,32,0,7),
-(4220,1,85,1,2,32,0,3),
-(4221,1,85,1,2,32,1,3),
-(4222,1,85,1,2,32,2,3),
-(4223,1,85,16,2,32,0,2),
-(4224,1,85,16,2,32,1,2),
-(4225,1,85,16,2,32,2,2),
-(4226,1,85,128,2,32,0,7),
-(4227,1,85,128,2,32,1,7),
-(4228,1,85,128,2,32,2,7),
-(4229,1,85,256,2,32,0,7),
-(4230,1,85,256,2,32,1,7),
-(4231,1,85,256,2,32,2,7),
-(4232,1,85,1024,2,32,0,7),
-(4233,1,85,1024,2,32,1,7),
-(4234,1,85,1024,2,32,2,7),
-(4235,1,85,2048,2,32,0,2),
-(4236,1,85,2048,2,32,1,2),
-(4237,1,85,2048,2,32,2,2),
-(4238,1,85,4096,2,32,0,2),
-(4239,1,85,4096,2,32,1,2),
-(4240,1,85,4096,2,32,2,2),
-(4241,1,85,8192,2,32,0,2),
-(4242,1,85,8192,2,32,1,2),
-(4243,1,85,8192,2,32,2,2),
-(4244,1,85,32,2,32,0,5),
-(4245,1,85,32,2,32,1,5),
-(4246,1,85,32,2,32,2,5),
-(4247,1,85,512,2,32,0,5),
-(4248,1,85,512,2,32,1,5),
-(4249,1,85,512,2,32,2,5),
-(4250,1,85,2,2,32,0,4),
-(4251,1,85,2,2,32,1,4),
-(4252,1,85,2,2,32,2,4),
-(4253,1,85,0,2,32,0,7),
-(4254,1,85,1,2,32,0,3),
-(4255,1,85,1,2,32,1,3),
-(4256,1,85,1,2,32,2,3),
-(4257,1,85,16,2,32,0,2),
-(4258,1,85,16,2,32,1,2),
-(4259,1,85,16,2,32,2,2),
-(4260,1,85,128,2,32,0,7),
-(4261,1,85,128,2,32,1,7),
-(4262,1,85,128,2,32,2,7),
-(4263,1,85,256,2,32,0,7),
-(4264,1,85,256,2,32,1,7),
-(4265,1,85,256,2,32,2,7),
-(4266,1,85,1024,2,32,0,7),
-(4267,1,85,1024,2,32,1,7),
-(4268,1,85,1024,2,32,2,7),
-(4269,1,85,2048,2,32,0,2),
-(4270,1,85,2048,2,32,1,2),
-(4271,1,85,2048,2,32,2,2),
-(4272,1,85,4096,2,32,0,2),
-(4273,1,85,4096,2,32,1,2),
-(4274,1,85,4096,2,32,2,2),
-(4275,1,85,8192,2,32,0,2),
-(4276,1,85,8192,2,32,1,2),
-(4277,1,85,8192,2,32,2,2),
-(4278,1,85,32,2,32,0,5),
-(4279,1,85,32,2,32,1,5),
-(4280,1,85,32,2,32,2,5),
-(4281,1,85,512,2,32,0,5),
-(4282,1,85,512,2,32,1,5),
-(4283,1,85,512,2,32,2,5),
-(4284,1,85,2,2,32,0,4),
-(4285,1,85,2,2,32,1,4),
-(4286,1,85,2,2,32,2,4),
-(4287,1,85,0,2,32,0,7),
-(4288,1,85,1,2,32,0,3),
-(4289,1,85,1,2,32,1,3),
-(4290,1,85,1,2,32,2,3),
-(4291,1,85,16,2,32,0,2),
-(4292,1,85,16,2,32,1,2),
-(4293,1,85,16,2,32,2,2),
-(4294,1,85,128,2,32,0,7),
-(4295,1,85,128,2,32,1,7),
-(4296,1,85,128,2,32,2,7),
-(4297,1,85,256,2,32,0,7),
-(4298,1,85,256,2,32,1,7),
-(4299,1,85,256,2,32,2,7),
-(4300,1,85,1024,2,32,0,7),
-(4301,1,85,1024,2,32,1,7),
-(4302,1,85,1024,2,32,2,7),
-(4303,1,85,2048,2,32,0,2),
-(4304,1,85,2048,2,32,1,2),
-(4305,1,85,2048,2,32,2,2),
-(4306,1,85,4096,2,32,0,2),
-(4307,1,85,4096,2,32,1,2),
-(4308,1,85,4096,2,32,2,2),
-(4309,1,85,8192,2,32,0,2),
-(4310,1,85,8192,2,32,1,2),
-(4311,1,85,8192,2,32,2,2),
-(4312,1,85,32,2,32,0,5),
-(4313,1,85,32,2,32,1,5),
-(4314,1,85,32,2,32,2,5),
-(4315,1,85,512,2,32,0,5),
-(4316,1,85,512,2,32,1,5),
-(4317,1,85,512,2,32,2,5),
-(4318,1,85,2,2,32,0,4),
-(4319,1,85,2,2,32,1,4),
-(4320,1,85,2,2,32,2,4),
-(4321,1,85,0,2,1,0,7),
-(4322,1,85,1,2,1,0,3),
-(4323,1,85,1,2,1,1,3),
-(4324,1,85,1,2,1,2,3),
-(4325,1,85,16,2,1,0,2),
-(4326,1,85,16,2,1,1,2),
-(4327,1,85,16,2,1,2,2),
-(4328,1,85,128,2,1,0,7),
-(4329,1,85,128,2,1,1,7),
-(4330,1,85,128,2,1,2,7),
-(4331,1,85,256,2,1,0,7),
-(4332,1,85,256,2,1,1,7),
-(4333,1,85,256,2,1,2,7),
-(4334,1,85,1024,2,1,0,7),
-(4335,1,85,1024,2,1,1,7),
-(4336,1,85,1024,2,1,2,7),
-(4337,1,85,2048,2,1,0,2),
-(4338,1,85,2048,2,1,1,2),
-(4339,1,85,2048,2,1,2,2),
-(4340,1,85,4096,2,1,0,2),
-(4341,1,85,4096,2,1,1,2),
-(4342,1,85,4096,2,1,2,2),
-(4343,1,85,8192,2,1,0,2),
-(4344,1,85,8192,2,1,1,2),
-(4345,1,85,8192,2,1,2,2),
-(4346,1,85,32,2,1,0,5),
-(4347,1,85,32,2,1,1,5),
-(4348,1,85,32,2,1,2,5),
-(4349,1,85,512,2,1,0,5),
-(4350,1,85,512,2,1,1,5),
-(4351,1,85,512,2,1,2,5),
-(4352,1,85,2,2,1,0,4),
-(4353,1,85,2,2,1,1,4),
-(4354,1,85,2,2,1,2,4),
-(4355,1,85,0,2,1,0,7),
-(4356,1,85,1,2,1,0,3),
-(4357,1,85,1,2,1,1,3),
-(4358,1,85,1,2,1,2,3),
-(4359,1,85,16,2,1,0,2),
-(4360,1,85,16,2,1,1,2),
-(4361,1,85,16,2,1,2,2),
-(4362,1,85,128,2,1,0,7),
-(4363,1,85,128,2,1,1,7),
-(4364,1,85,128,2,1,2,7),
-(4365,1,85,256,2,1,0,7),
-(4366,1,85,256,2,1,1,7),
-(4367,1,85,256,2,1,2,7),
-(4368,1,85,1024,2,1,0,7),
-(4369,1,85,1024,2,1,1,7),
-(4370,1,85,1024,2,1,2,7),
-(4371,1,85,2048,2,1,0,2),
-(4372,1,85,2048,2,1,1,2),
-(4373,1,85,2048,2,1,2,2),
-(4374,1,85,4096,2,1,0,2),
-(4375,1,85,4096,2,1,1,2),
-(4376,1,85,4096,2,1,2,2),
-(4377,1,85,8192,2,1,0,2),
-(4378,1,85,8192,2,1,1,2),
-(4379,1,85,8192,2,1,2,2),
-(4380,1,85,32,2,1,0,5),
-(4381,1,85,32,2,1,1,5),
-(4382,1,85,32,2,1,2,5),
-(4383,1,85,512,2,1,0,5),
-(4384,1,85,512,2,1,1,5),
-(4385,1,85,512,2,1,2,5),
-(4386,1,85,2,2,1,0,4),
-(4387,1,85,2,2,1,1,4),
-(4388,1,85,2,2,1,2,4),
-(4389,1,85,0,2,1,0,7),
-(4390,1,85,1,2,1,0,3),
-(4391,1,85,1,2,1,1,3),
-(4392,1,85,1,2,1,2,3),
-(4393,1,85,16,2,1,0,2),
-(4394,1,85,16,2,1,1,2),
-(4395,1,85,16,2,1,2,2),
-(4396,1,85,128,2,1,0,7),
-(4397,1,85,128,2,1,1,7),
-(4398,1,85,128,2,1,2,7),
-(4399,1,85,256,2,1,0,7),
-(4400,1,85,256,2,1,1,7),
-(4401,1,85,256,2,1,2,7),
-(4402,1,85,1024,2,1,0,7),
-(4403,1,85,1024,2,1,1,7),
-(4404,1,85,1024,2,1,2,7),
-(4405,1,85,2048,2,1,0,2),
-(4406,1,85,2048,2,1,1,2),
-(4407,1,85,2048,2,1,2,2),
-(4408,1,85,4096,2,1,0,2),
-(4409,1,85,4096,2,1,1,2),
-(4410,1,85,4096,2,1,2,2),
-(4411,1,85,8192,2,1,0,2),
-(4412,1,85,8192,2,1,1,2),
-(4413,1,85,8192,2,1,2,2),
-(4414,1,85,32,2,1,0,5),
-(4415,1,85,32,2,1,1,5),
-(4416,1,85,32,2,1,2,5),
-(4417,1,85,512,2,1,0,5),
-(4418,1,85,512,2,1,1,5),
-(4419,1,85,512,2,1,2,5),
-(4420,1,85,2,2,1,0,4),
-(4421,1,85,2,2,1,1,4),
-(4422,1,85,2,2,1,2,4),
-(4423,1,85,0,2,1,0,7),
-(4424,1,85,1,2,1,0,3),
-(4425,1,85,1,2,1,1,3),
-(4426,1,85,1,2,1,2,3),
-(4427,1,85,16,2,1,0,2),
-(4428,1,85,16,2,1,1,2),
-(4429,1,85,16,2,1,2,2),
-(4430,1,85,128,2,1,0,7),
-(4431,1,85,128,2,1,1,7),
-(4432,1,85,128,2,1,2,7),
-(4433,1,85,256,2,1,0,7),
-(4434,1,85,256,2,1,1,7),
-(4435,1,85,256,2,1,2,7),
-(4436,1,85,1024,2,1,0,7),
-(4437,1,85,1024,2,1,1,7),
-(4438,1,85,1024,2,1,2,7),
-(4439,1,85,2048,2,1,0,2),
-(4440,1,85,2048,2,1,1,2),
-(4441,1,85,2048,2,1,2,2),
-(4442,1,85,4096,2,1,0,2),
-(4443,1,85,4096,2,1,1,2),
-(4444,1,85,4096,2,1,2,2),
-(4445,1,85,8192,2,1,0,2),
-(4446,1,85,8192,2,1,1,2),
-(4447,1,85,8192,2,1,2,2),
-(4448,1,85,32,2,1,0,5),
-(4449,1,85,32,2,1,1,5),
-(4450,1,85,32,2,1,2,5),
-(4451,1,85,512,2,1,0,5),
-(4452,1,85,512,2,1,1,5),
-(4453,1,85,512,2,1,2,5),
-(4454,1,85,2,2,1,0,4),
-(4455,1,85,2,2,1,1,4),
-(4456,1,85,2,2,1,2,4),
-(4457,1,85,0,2,1,0,7),
-(4458,1,85,1,2,1,0,3),
-(4459,1,85,1,2,1,1,3),
-(4460,1,85,1,2,1,2,3),
-(4461,1,85,16,2,1,0,2),
-(4462,1,85,16,2,1,1,2),
-(4463,1,85,16,2,1,2,2),
-(4464,1,85,128,2,1,0,7),
-(4465,1,85,128,2,1,1,7),
-(4466,1,85,128,2,1,2,7),
-(4467,1,85,256,2,1,0,7),
-(4468,1,85,256,2,1,1,7),
-(4469,1,85,256,2,1,2,7),
-(4470,1,85,1024,2,1,0,7),
-(4471,1,85,1024,2,1,1,7),
-(4472,1,85,1024,2,1,2,7),
-(4473,1,85,2048,2,1,0,2),
-(4474,1,85,2048,2,1,1,2),
-(4475,1,85,2048,2,1,2,2),
-(4476,1,85,4096,2,1,0,2),
-(4477,1,85,4096,2,1,1,2),
-(4478,1,85,4096,2,1,2,2),
-(4479,1,85,8192,2,1,0,2),
-(4480,1,85,8192,2,1,1,2),
-(4481,1,85,8192,2,1,2,2),
-(4482,1,85,32,2,1,0,5),
-(4483,1,85,32,2,1,1,5),
-(4484,1,85,32,2,1,2,5),
-(4485,1,85,512,2,1,0,5),
-(4486,1,85,512,2,1,1,5),
-(4487,1,85,512,2,1,2,5),
-(4488,1,85,2,2,1,0,4),
-(4489,1,85,2,2,1,1,4),
-(4490,1,85,2,2,1,2,4),
-(4491,1,85,0,2,1,0,7),
-(4492,1,85,1,2,1,0,3),
-(4493,1,85,1,2,1,1,3),
-(4494,1,85,1,2,1,2,3),
-(4495,1,85,16,2,1,0,2),
-(4496,1,85,16,2,1,1,2),
-(4497,1,85,16,2,1,2,2),
-(4498,1,85,128,2,1,0,7),
-(4499,1,85,128,2,1,1,7),
-(4500,1,85,128,2,1,2,7),
-(4501,1,85,256,2,1,0,7),
-(4502,1,85,256,2,1,1,7),
-(4503,1,85,256,2,1,2,7),
-(4504,1,85,1024,2,1,0,7),
-(4505,1,85,1024,2,1,1,7),
-(4506,1,85,1024,2,1,2,7),
-(4507,1,85,2048,2,1,0,2),
-(4508,1,85,2048,2,1,1,2),
-(4509,1,85,2048,2,1,2,2),
-(4510,1,85,4096,2,1,0,2),
-(4511,1,85,4096,2,1,1,2),
-(4512,1,85,4096,2,1,2,2),
-(4513,1,85,8192,2,1,0,2),
-(4514,1,85,8192,2,1,1,2),
-(4515,1,85,8192,2,1,2,2),
-(4516,1,85,32,2,1,0,5),
-(4517,1,85,32,2,1,1,5),
-(4518,1,85,32,2,1,2,5),
-(4519,1,85,512,2,1,0,5),
-(4520,1,85,512,2,1,1,5),
-(4521,1,85,512,2,1,2,5),
-(4522,1,85,2,2,1,0,4),
-(4523,1,85,2,2,1,1,4),
-(4524,1,85,2,2,1,2,4),
-(4525,1,85,0,2,1,0,7),
-(4526,1,85,1,2,1,0,3),
-(4527,1,85,1,2,1,1,3),
-(4528,1,85,1,2,1,2,3),
-(4529,1,85,16,2,1,0,2),
-(4530,1,85,16,2,1,1,2),
-(4531,1,85,16,2,1,2,2),
-(4532,1,85,128,2,1,0,7),
-(4533,1,85,128,2,1,1,7),
-(4534,1,85,128,2,1,2,7),
-(4535,1,85,256,2,1,0,7),
-(4536,1,85,256,2,1,1,7),
-(4537,1,85,256,2,1,2,7),
-(4538,1,85,1024,2,1,0,7),
-(4539,1,85,1024,2,1,1,7),
-(4540,1,85,1024,2,1,2,7),
-(4541,1,85,2048,2,1,0,2),
-(4542,1,85,2048,2,1,1,2),
-(4543,1,85,2048,2,1,2,2),
-(4544,1,85,4096,2,1,0,2),
-(4545,1,85,4096,2,1,1,2),
-(4546,1,85,4096,2,1,2,2),
-(4547,1,85,8192,2,1,0,2),
-(4548,1,85,8192,2,1,1,2),
-(4549,1,85,8192,2,1,2,2),
-(4550,1,85,32,2,1,0,5),
-(4551,1,85,32,2,1,1,5),
-(4552,1,85,32,2,1,2,5),
-(4553,1,85,512,2,1,0,5),
-(4554,1,85,512,2,1,1,5),
-(4555,1,85,512,2,1,2,5),
-(4556,1,85,2,2,1,0,4),
-(4557,1,85,2,2,1,1,4),
-(4558,1,85,2,2,1,2,4),
-(4559,1,85,0,2,2,0,7),
-(4560,1,85,1,2,2,0,3),
-(4561,1,85,1,2,2,1,3),
-(4562,1,85,1,2,2,2,3),
-(4563,1,85,16,2,2,0,2),
-(4564,1,85,16,2,2,1,2),
-(4565,1,85,16,2,2,2,2),
-(4566,1,85,128,2,2,0,7),
-(4567,1,85,128,2,2,1,7),
-(4568,1,85,128,2,2,2,7),
-(4569,1,85,256,2,2,0,7),
-(4570,1,85,256,2,2,1,7),
-(4571,1,85,256,2,2,2,7),
-(4572,1,85,1024,2,2,0,7),
-(4573,1,85,1024,2,2,1,7),
-(4574,1,85,1024,2,2,2,7),
-(4575,1,85,2048,2,2,0,2),
-(4576,1,85,2048,2,2,1,2),
-(4577,1,85,2048,2,2,2,2),
-(4578,1,85,4096,2,2,0,2),
-(4579,1,85,4096,2,2,1,2),
-(4580,1,85,4096,2,2,2,2),
-(4581,1,85,8192,2,2,0,2),
-(4582,1,85,8192,2,2,1,2),
-(4583,1,85,8192,2,2,2,2),
-(4584,1,85,32,2,2,0,5),
-(4585,1,85,32,2,2,1,5),
-(4586,1,85,32,2,2,2,5),
-(4587,1,85,512,2,2,0,5),
-(4588,1,85,512,2,2,1,5),
-(4589,1,85,512,2,2,2,5),
-(4590,1,85,2,2,2,0,4),
-(4591,1,85,2,2,2,1,4),
-(4592,1,85,2,2,2,2,4),
-(4593,1,85,0,2,2,0,7),
-(4594,1,85,1,2,2,0,3),
-(4595,1,85,1,2,2,1,3),
-(4596,1,85,1,2,2,2,3),
-(4597,1,85,16,2,2,0,2),
-(4598,1,85,16,2,2,1,2),
-(4599,1,85,16,2,2,2,2),
-(4600,1,85,128,2,2,0,7),
-(4601,1,85,128,2,2,1,7),
-(4602,1,85,128,2,2,2,7),
-(4603,1,85,256,2,2,0,7),
-(4604,1,85,256,2,2,1,7),
-(4605,1,85,256,2,2,2,7),
-(4606,1,85,1024,2,2,0,7),
-(4607,1,85,1024,2,2,1,7),
-(4608,1,85,1024,2,2,2,7),
-(4609,1,85,2048,2,2,0,2),
-(4610,1,85,2048,2,2,1,2),
-(4611,1,85,2048,2,2,2,2),
-(4612,1,85,4096,2,2,0,2),
-(4613,1,85,4096,2,2,1,2),
-(4614,1,85,4096,2,2,2,2),
-(4615,1,85,8192,2,2,0,2),
-(4616,1,85,8192,2,2,1,2),
-(4617,1,85,8192,2,2,2,2),
-(4618,1,85,32,2,2,0,5),
-(4619,1,85,32,2,2,1,5),
-(4620,1,85,32,2,2,2,5),
-(4621,1,85,512,2,2,0,5),
-(4622,1,85,512,2,2,1,5),
-(4623,1,85,512,2,2,2,5),
-(4624,1,85,2,2,2,0,4),
-(4625,1,85,2,2,2,1,4),
-(4626,1,85,2,2,2,2,4),
-(4627,1,85,0,2,2,0,7),
-(4628,1,85,1,2,2,0,3),
-(4629,1,85,1,2,2,1,3),
-(4630,1,85,1,2,2,2,3),
-(4631,1,85,16,2,2,0,2),
-(4632,1,85,16,2,2,1,2),
-(4633,1,85,16,2,2,2,2),
-(4634,1,85,128,2,2,0,7),
-(4635,1,85,128,2,2,1,7),
-(4636,1,85,128,2,2,2,7),
-(4637,1,85,256,2,2,0,7),
-(4638,1,85,256,2,2,1,7),
-(4639,1,85,256,2,2,2,7),
-(4640,1,85,1024,2,2,0,7),
-(4641,1,85,1024,2,2,1,7),
-(4642,1,85,1024,2,2,2,7),
-(4643,1,85,2048,2,2,0,2),
-(4644,1,85,2048,2,2,1,2),
-(4645,1,85,2048,2,2,2,2),
-(4646,1,85,4096,2,2,0,2),
-(4647,1,85,4096,2,2,1,2),
-(4648,1,85,4096,2,2,2,2),
-(4649,1,85,8192,2,2,0,2),
-(4650,1,85,8192,2,2,1,2),
-(4651,1,85,8192,2,2,2,2),
-(4652,1,85,32,2,2,0,5),
-(4653,1,85,32,2,2,1,5),
-(4654,1,85,32,2,2,2,5),
-(4655,1,85,512,2,2,0,5),
-(4656,1,85,512,2,2,1,5),
-(4657,1,85,512,2,2,2,5),
-(4658,1,85,2,2,2,0,4),
-(4659,1,85,2,2,2,1,4),
-(4660,1,85,2,2,2,2,4),
-(4661,1,85,0,2,2,0,7),
-(4662,1,85,1,2,2,0,3),
-(4663,1,85,1,2,2,1,3),
-(4664,1,85,1,2,2,2,3),
-(4665,1,85,16,2,2,0,2),
-(4666,1,85,16,2,2,1,2),
-(4667,1,85,16,2,2,2,2),
-(4668,1,85,128,2,2,0,7),
-(4669,1,85,128,2,2,1,7),
-(4670,1,85,128,2,2,2,7),
-(4671,1,85,256,2,2,0,7),
-(4672,1,85,256,2,2,1,7),
-(4673,1,85,256,2,2,2,7),
-(4674,1,85,1024,2,2,0,7),
-(4675,1,85,1024,2,2,1,7),
-(4676,1,85,1024,2,2,2,7),
-(4677,1,85,2048,2,2,0,2),
-(4678,1,85,2048,2,2,1,2),
-(4679,1,85,2048,2,2,2,2),
-(4680,1,85,4096,2,2,0,2),
-(4681,1,85,4096,2,2,1,2),
-(4682,1,85,4096,2,2,2,2),
-(4683,1,85,8192,2,2,0,2),
-(4684,1,85,8192,2,2,1,2),
-(4685,1,85,8192,2,2,2,2),
-(4686,1,85,32,2,2,0,5),
-(4687,1,85,32,2,2,1,5),
-(4688,1,85,32,2,2,2,5),
-(4689,1,85,512,2,2,0,5),
-(4690,1,85,512,2,2,1,5),
-(4691,1,85,512,2,2,2,5),
-(4692,1,85,2,2,2,0,4),
-(4693,1,85,2,2,2,1,4),
-(4694,1,85,2,2,2,2,4),
-(4695,1,85,0,2,2,0,7),
-(4696,1,85,1,2,2,0,3),
-(4697,1,85,1,2,2,1,3),
-(4698,1,85,1,2,2,2,3),
-(4699,1,85,16,2,2,0,2),
-(4700,1,85,16,2,2,1,2),
-(4701,1,85,16,2,2,2,2),
-(4702,1,85,128,2,2,0,7),
-(4703,1,85,128,2,2,1,7),
-(4704,1,85,128,2,2,2,7),
-(4705,1,85,256,2,2,0,7),
-(4706,1,85,256,2,2,1,7),
-(4707,1,85,256,2,2,2,7),
-(4708,1,85,1024,2,2,0,7),
-(4709,1,85,1024,2,2,1,7),
-(4710,1,85,1024,2,2,2,7),
-(4711,1,85,2048,2,2,0,2),
-(4712,1,85,2048,2,2,1,2),
-(4713,1,85,2048,2,2,2,2),
-(4714,1,85,4096,2,2,0,2),
-(4715,1,85,4096,2,2,1,2),
-(4716,1,85,4096,2,2,2,2),
-(4717,1,85,8192,2,2,0,2),
-(4718,1,85,8192,2,2,1,2),
-(4719,1,85,8192,2,2,2,2),
-(4720,1,85,32,2,2,0,5),
-(4721,1,85,32,2,2,1,5),
-(4722,1,85,32,2,2,2,5),
-(4723,1,85,512,2,2,0,5),
-(4724,1,85,512,2,2,1,5),
-(4725,1,85,512,2,2,2,5),
-(4726,1,85,2,2,2,0,4),
-(4727,1,85,2,2,2,1,4),
-(4728,1,85,2,2,2,2,4),
-(4729,1,85,0,2,2,0,7),
-(4730,1,85,1,2,2,0,3),
-(4731,1,85,1,2,2,1,3),
-(4732,1,85,1,2,2,2,3),
-(4733,1,85,16,2,2,0,2),
-(4734,1,85,16,2,2,1,2),
-(4735,1,85,16,2,2,2,2),
-(4736,1,85,128,2,2,0,7),
-(4737,1,85,128,2,2,1,7),
-(4738,1,85,128,2,2,2,7),
-(4739,1,85,256,2,2,0,7),
-(4740,1,85,256,2,2,1,7),
-(4741,1,85,256,2,2,2,7),
-(4742,1,85,1024,2,2,0,7),
-(4743,1,85,1024,2,2,1,7),
-(4744,1,85,1024,2,2,2,7),
-(4745,1,85,2048,2,2,0,2),
-(4746,1,85,2048,2,2,1,2),
-(4747,1,85,2048,2,2,2,2),
-(4748,1,85,4096,2,2,0,2),
-(4749,1,85,4096,2,2,1,2),
-(4750,1,85,4096,2,2,2,2),
-(4751,1,85,8192,2,2,0,2),
-(4752,1,85,8192,2,2,1,2),
-(4753,1,85,8192,2,2,2,2),
-(4754,1,85,32,2,2,0,5),
-(4755,1,85,32,2,2,1,5),
-(4756,1,85,32,2,2,2,5),
-(4757,1,85,512,2,2,0,5),
-(4758,1,85,512,2,2,1,5),
-(4759,1,85,512,2,2,2,5),
-(4760,1,85,2,2,2,0,4),
-(4761,1,85,2,2,2,1,4),
-(4762,1,85,2,2,2,2,4),
-(4763,1,85,0,2,2,0,7),
-(4764,1,85,1,2,2,0,3),
-(4765,1,85,1,2,2,1,3),
-(4766,1,85,1,2,2,2,3),
-(4767,1,85,16,2,2,0,2),
-(4768,1,85,16,2,2,1,2),
-(4769,1,85,16,2,2,2,2),
-(4770,1,85,128,2,2,0,7),
-(4771,1,85,128,2,2,1,7),
-(4772,1,85,128,2,2,2,7),
-(4773,1,85,256,2,2,0,7),
-(4774,1,85,256,2,2,1,7),
-(4775,1,85,256,2,2,2,7),
-(4776,1,85,1024,2,2,0,7),
-(4777,1,85,1024,2,2,1,7),
-(4778,1,85,1024,2,2,2,7),
-(4779,1,85,2048,2,2,0,2),
-(4780,1,85,2048,2,2,1,2),
-(4781,1,85,2048,2,2,2,2),
-(4782,1,85,4096,2,2,0,2),
-(4783,1,85,4096,2,2,1,2),
-(4784,1,85,4096,2,2,2,2),
-(4785,1,85,8192,2,2,0,2),
-(4786,1,85,8192,2,2,1,2),
-(4787,1,85,8192,2,2,2,2),
-(4788,1,85,32,2,2,0,5),
-(4789,1,85,32,2,2,1,5),
-(4790,1,85,32,2,2,2,5),
-(4791,1,85,512,2,2,0,5),
-(4792,1,85,512,2,2,1,5),
-(4793,1,85,512,2,2,2,5),
-(4794,1,85,2,2,2,0,4),
-(4795,1,85,2,2,2,1,4),
-(4796,1,85,2,2,2,2,4),
-(4797,1,85,0,2,32768,0,7),
-(4798,1,85,1,2,32768,0,3),
-(4799,1,85,1,2,32768,1,3),
-(4800,1,85,1,2,32768,2,3),
-(4801,1,85,16,2,32768,0,2),
-(4802,1,85,16,2,32768,1,2),
-(4803,1,85,16,2,32768,2,2),
-(4804,1,85,128,2,32768,0,7),
-(4805,1,85,128,2,32768,1,7),
-(4806,1,85,128,2,32768,2,7),
-(4807,1,85,256,2,32768,0,7),
-(4808,1,85,256,2,32768,1,7),
-(4809,1,85,256,2,32768,2,7),
-(4810,1,85,1024,2,32768,0,7),
-(4811,1,85,1024,2,32768,1,7),
-(4812,1,85,1024,2,32768,2,7),
-(4813,1,85,2048,2,32768,0,2),
-(4814,1,85,2048,2,32768,1,2),
-(4815,1,85,2048,2,32768,2,2),
-(4816,1,85,4096,2,32768,0,2),
-(4817,1,85,4096,2,32768,1,2),
-(4818,1,85,4096,2,32768,2,2),
-(4819,1,85,8192,2,32768,0,2),
-(4820,1,85,8192,2,32768,1,2),
-(4821,1,85,8192,2,32768,2,2),
-(4822,1,85,32,2,32768,0,5),
-(4823,1,85,32,2,32768,1,5),
-(4824,1,85,32,2,32768,2,5),
-(4825,1,85,512,2,32768,0,5),
-(4826,1,85,512,2,32768,1,5),
-(4827,1,85,512,2,32768,2,5),
-(4828,1,85,2,2,32768,0,4),
-(4829,1,85,2,2,32768,1,4),
-(4830,1,85,2,2,32768,2,4),
-(4831,1,85,0,2,32768,0,7),
-(4832,1,85,1,2,32768,0,3),
-(4833,1,85,1,2,32768,1,3),
-(4834,1,85,1,2,32768,2,3),
-(4835,1,85,16,2,32768,0,2),
-(4836,1,85,16,2,32768,1,2),
-(4837,1,85,16,2,32768,2,2),
-(4838,1,85,128,2,32768,0,7),
-(4839,1,85,128,2,32768,1,7),
-(4840,1,85,128,2,32768,2,7),
-(4841,1,85,256,2,32768,0,7),
-(4842,1,85,256,2,32768,1,7),
-(4843,1,85,256,2,32768,2,7),
-(4844,1,85,1024,2,32768,0,7),
-(4845,1,85,1024,2,32768,1,7),
-(4846,1,85,1024,2,32768,2,7),
-(4847,1,85,2048,2,32768,0,2),
-(4848,1,85,2048,2,32768,1,2),
-(4849,1,85,2048,2,32768,2,2),
-(4850,1,85,4096,2,32768,0,2),
-(4851,1,85,4096,2,32768,1,2),
-(4852,1,85,4096,2,32768,2,2),
-(4853,1,85,8192,2,32768,0,2),
-(4854,1,85,8192,2,32768,1,2),
-(4855,1,85,8192,2,32768,2,2),
-(4856,1,85,32,2,32768,0,5),
-(4857,1,85,32,2,32768,1,5),
-(4858,1,85,32,2,32768,2,5),
-(4859,1,85,512,2,32768,0,5),
-(4860,1,85,512,2,32768,1,5),
-(4861,1,85,512,2,32768,2,5),
-(4862,1,85,2,2,32768,0,4),
-(4863,1,85,2,2,32768,1,4),
-(4864,1,85,2,2,32768,2,4),
-(4865,1,85,0,2,32768,0,7),
-(4866,1,85,1,2,32768,0,3),
-(4867,1,85,1,2,32768,1,3),
-(4868,1,85,1,2,32768,2,3),
-(4869,1,85,16,2,32768,0,2),
-(4870,1,85,16,2,32768,1,2),
-(4871,1,85,16,2,32768,2,2),
-(4872,1,85,128,2,32768,0,7),
-(4873,1,85,128,2,32768,1,7),
-(4874,1,85,128,2,32768,2,7),
-(4875,1,85,256,2,32768,0,7),
-(4876,1,85,256,2,32768,1,7),
-(4877,1,85,256,2,32768,2,7),
-(4878,1,85,1024,2,32768,0,7),
-(4879,1,85,1024,2,32768,1,7),
-(4880,1,85,1024,2,32768,2,7),
-(4881,1,85,2048,2,32768,0,2),
-(4882,1,85,2048,2,32768,1,2),
-(4883,1,85,2048,2,32768,2,2),
-(4884,1,85,4096,2,32768,0,2),
-(4885,1,85,4096,2,32768,1,2),
-(4886,1,85,4096,2,32768,2,2),
-(4887,1,85,8192,2,32768,0,2),
-(4888,1,85,8192,2,32768,1,2),
-(4889,1,85,8192,2,32768,2,2),
-(4890,1,85,32,2,32768,0,5),
-(4891,1,85,32,2,32768,1,5),
-(4892,1,85,32,2,32768,2,5),
-(4893,1,85,512,2,32768,0,5),
-(4894,1,85,512,2,32768,1,5),
-(4895,1,85,512,2,32768,2,5),
-(4896,1,85,2,2,32768,0,4),
-(4897,1,85,2,2,32768,1,4),
-(4898,1,85,2,2,32768,2,4),
-(4899,1,85,0,2,32768,0,7),
-(4900,1,85,1,2,32768,0,3),
-(4901,1,85,1,2,32768,1,3),
-(4902,1,85,1,2,32768,2,3),
-(4903,1,85,16,2,32768,0,2),
-(4904,1,85,16,2,32768,1,2),
-(4905,1,85,16,2,32768,2,2),
-(4906,1,85,128,2,32768,0,7),
-(4907,1,85,128,2,32768,1,7),
-(4908,1,85,128,2,32768,2,7),
-(4909,1,85,256,2,32768,0,7),
-(4910,1,85,256,2,32768,1,7),
-(4911,1,85,256,2,32768,2,7),
-(4912,1,85,1024,2,32768,0,7),
-(4913,1,85,1024,2,32768,1,7),
-(4914,1,85,1024,2,32768,2,7),
-(4915,1,85,2048,2,32768,0,2),
-(4916,1,85,2048,2,32768,1,2),
-(4917,1,85,2048,2,32768,2,2),
-(4918,1,85,4096,2,32768,0,2),
-(4919,1,85,4096,2,32768,1,2),
-(4920,1,85,4096,2,32768,2,2),
-(4921,1,85,8192,2,32768,0,2),
-(4922,1,85,8192,2,32768,1,2),
-(4923,1,85,8192,2,32768,2,2),
-(4924,1,85,32,2,32768,0,5),
-(4925,1,85,32,2,32768,1,5),
-(4926,1,85,32,2,32768,2,5),
-(4927,1,85,512,2,32768,0,5),
-(4928,1,85,512,2,32768,1,5),
-(4929,1,85,512,2,32768,2,5),
-(4930,1,85,2,2,32768,0,4),
-(4931,1,85,2,2,32768,1,4),
-(4932,1,85,2,2,32768,2,4),
-(4933,1,85,0,2,32768,0,7),
-(4934,1,85,1,2,32768,0,3),
-(4935,1,85,1,2,32768,1,3),
-(4936,1,85,1,2,32768,2,3),
-(4937,1,85,16,2,32768,0,2),
-(4938,1,85,16,2,32768,1,2),
-(4939,1,85,16,2,32768,2,2),
-(4940,1,85,128,2,32768,0,7),
-(4941,1,85,128,2,32768,1,7),
-(4942,1,85,128,2,32768,2,7),
-(4943,1,85,256,2,32768,0,7),
-(4944,1,85,256,2,32768,1,7),
-(4945,1,85,256,2,32768,2,7),
-(4946,1,85,1024,2,32768,0,7),
-(4947,1,85,1024,2,32768,1,7),
-(4948,1,85,1024,2,32768,2,7),
-(4949,1,85,2048,2,32768,0,2),
-(4950,1,85,2048,2,32768,1,2),
-(4951,1,85,2048,2,32768,2,2),
-(4952,1,85,4096,2,32768,0,2),
-(4953,1,85,4096,2,32768,1,2),
-(4954,1,85,4096,2,32768,2,2),
-(4955,1,85,8192,2,32768,0,2),
-(4956,1,85,8192,2,32768,1,2),
-(4957,1,85,8192,2,32768,2,2),
-(4958,1,85,32,2,32768,0,5),
-(4959,1,85,32,2,32768,1,5),
-(4960,1,85,32,2,32768,2,5),
-(4961,1,85,512,2,32768,0,5),
-(4962,1,85,512,2,32768,1,5),
-(4963,1,85,512,2,32768,2,5),
-(4964,1,85,2,2,32768,0,4),
-(4965,1,85,2,2,32768,1,4),
-(4966,1,85,2,2,32768,2,4),
-(4967,1,85,0,2,32768,0,7),
-(4968,1,85,1,2,32768,0,3),
-(4969,1,85,1,2,32768,1,3),
-(4970,1,85,1,2,32768,2,3),
-(4971,1,85,16,2,32768,0,2),
-(4972,1,85,16,2,32768,1,2),
-(4973,1,85,16,2,32768,2,2),
-(4974,1,85,128,2,32768,0,7),
-(4975,1,85,128,2,32768,1,7),
-(4976,1,85,128,2,32768,2,7),
-(4977,1,85,256,2,32768,0,7),
-(4978,1,85,256,2,32768,1,7),
-(4979,1,85,256,2,32768,2,7),
-(4980,1,85,1024,2,32768,0,7),
-(4981,1,85,1024,2,32768,1,7),
-(4982,1,85,1024,2,32768,2,7),
-(4983,1,85,2048,2,32768,0,2),
-(4984,1,85,2048,2,32768,1,2),
-(4985,1,85,2048,2,32768,2,2),
-(4986,1,85,4096,2,32768,0,2),
-(4987,1,85,4096,2,32768,1,2),
-(4988,1,85,4096,2,32768,2,2),
-(4989,1,85,8192,2,32768,0,2),
-(4990,1,85,8192,2,32768,1,2),
-(4991,1,85,8192,2,32768,2,2),
-(4992,1,85,32,2,32768,0,5),
-(4993,1,85,32,2,32768,1,5),
-(4994,1,85,32,2,32768,2,5),
-(4995,1,85,512,2,32768,0,5),
-(4996,1,85,512,2,32768,1,5),
-(4997,1,85,512,2,32768,2,5),
-(4998,1,85,2,2,32768,0,4),
-(4999,1,85,2,2,32768,1,4),
-(5000,1,85,2,2,32768,2,4),
-(5001,1,85,0,2,32768,0,7),
-(5002,1,85,1,2,32768,0,3),
-(5003,1,85,1,2,32768,1,3),
-(5004,1,85,1,2,32768,2,3),
-(5005,1,85,16,2,32768,0,2),
-(5006,1,85,16,2,32768,1,2),
-(5007,1,85,16,2,32768,2,2),
-(5008,1,85,128,2,32768,0,7),
-(5009,1,85,128,2,32768,1,7),
-(5010,1,85,128,2,32768,2,7),
-(5011,1,85,256,2,32768,0,7),
-(5012,1,85,256,2,32768,1,7),
-(5013,1,85,256,2,32768,2,7),
-(5014,1,85,1024,2,32768,0,7),
-(5015,1,85,1024,2,32768,1,7),
-(5016,1,85,1024,2,32768,2,7),
-(5017,1,85,2048,2,32768,0,2),
-(5018,1,85,2048,2,32768,1,2),
-(5019,1,85,2048,2,32768,2,2),
-(5020,1,85,4096,2,32768,0,2),
-(5021,1,85,4096,2,32768,1,2),
-(5022,1,85,4096,2,32768,2,2),
-(5023,1,85,8192,2,32768,0,2),
-(5024,1,85,8192,2,32768,1,2),
-(5025,1,85,8192,2,32768,2,2),
-(5026,1,85,32,2,32768,0,5),
-(5027,1,85,32,2,32768,1,5),
-(5028,1,85,32,2,32768,2,5),
-(5029,1,85,512,2,32768,0,5),
-(5030,1,85,512,2,32768,1,5),
-(5031,1,85,512,2,32768,2,5),
-(5032,1,85,2,2,32768,0,4),
-(5033,1,85,2,2,32768,1,4),
-(5034,1,85,2,2,32768,2,4),
-(5035,1,85,0,2,8,0,23),
-(5036,1,85,1,2,8,0,3),
-(5037,1,85,1,2,8,1,3),
-(5038,1,85,1,2,8,2,3),
-(5039,1,85,16,2,8,0,2),
-(5040,1,85,16,2,8,1,2),
-(5041,1,85,16,2,8,2,2),
-(5042,1,85,128,2,8,0,23),
-(5043,1,85,128,2,8,1,23),
-(5044,1,85,128,2,8,2,23),
-(5045,1,85,256,2,8,0,23),
-(5046,1,85,256,2,8,1,23),
-(5047,1,85,256,2,8,2,23),
-(5048,1,85,1024,2,8,0,7),
-(5049,1,85,1024,2,8,1,7),
-(5050,1,85,1024,2,8,2,7),
-(5051,1,85,2048,2,8,0,2),
-(5052,1,85,2048,2,8,1,2),
-(5053,1,85,2048,2,8,2,2),
-(5054,1,85,4096,2,8,0,2),
-(5055,1,85,4096,2,8,1,2),
-(5056,1,85,4096,2,8,2,2),
-(5057,1,85,8192,2,8,0,2),
-(5058,1,85,8192,2,8,1,2),
-(5059,1,85,8192,2,8,2,2),
-(5060,1,85,32,2,8,0,21),
-(5061,1,85,32,2,8,1,21),
-(5062,1,85,32,2,8,2,21),
-(5063,1,85,512,2,8,0,21),
-(5064,1,85,512,2,8,1,21),
-(5065,1,85,512,2,8,2,21),
-(5066,1,85,2,2,8,0,20),
-(5067,1,85,2,2,8,1,20),
-(5068,1,85,2,2,8,2,20),
-(5069,1,85,0,2,8,0,23),
-(5070,1,85,1,2,8,0,3),
-(5071,1,85,1,2,8,1,3),
-(5072,1,85,1,2,8,2,3),
-(5073,1,85,16,2,8,0,2),
-(5074,1,85,16,2,8,1,2),
-(5075,1,85,16,2,8,2,2),
-(5076,1,85,128,2,8,0,23),
-(5077,1,85,128,2,8,1,23),
-(5078,1,85,128,2,8,2,23),
-(5079,1,85,256,2,8,0,23),
-(5080,1,85,256,2,8,1,23),
-(5081,1,85,256,2,8,2,23),
-(5082,1,85,1024,2,8,0,7),
-(5083,1,85,1024,2,8,1,7),
-(5084,1,85,1024,2,8,2,7),
-(5085,1,85,2048,2,8,0,2),
-(5086,1,85,2048,2,8,1,2),
-(5087,1,85,2048,2,8,2,2),
-(5088,1,85,4096,2,8,0,2),
-(5089,1,85,4096,2,8,1,2),
-(5090,1,85,4096,2,8,2,2),
-(5091,1,85,8192,2,8,0,2),
-(5092,1,85,8192,2,8,1,2),
-(5093,1,85,8192,2,8,2,2),
-(5094,1,85,32,2,8,0,21),
-(5095,1,85,32,2,8,1,21),
-(5096,1,85,32,2,8,2,21),
-(5097,1,85,512,2,8,0,21),
-(5098,1,85,512,2,8,1,21),
-(5099,1,85,512,2,8,2,21),
-(5100,1,85,2,2,8,0,20),
-(5101,1,85,2,2,8,1,20),
-(5102,1,85,2,2,8,2,20),
-(5103,1,85,0,2,8,0,23),
-(5104,1,85,1,2,8,0,3),
-(5105,1,85,1,2,8,1,3),
-(5106,1,85,1,2,8,2,3),
-(5107,1,85,16,2,8,0,2),
-(5108,1,85,16,2,8,1,2),
-(5109,1,85,16,2,8,2,2),
-(5110,1,85,128,2,8,0,23),
-(5111,1,85,128,2,8,1,23),
-(5112,1,85,128,2,8,2,23),
-(5113,1,85,256,2,8,0,23),
-(5114,1,85,256,2,8,1,23),
-(5115,1,85,256,2,8,2,23),
-(5116,1,85,1024,2,8,0,7),
-(5117,1,85,1024,2,8,1,7),
-(5118,1,85,1024,2,8,2,7),
-(5119,1,85,2048,2,8,0,2),
-(5120,1,85,2048,2,8,1,2),
-(5121,1,85,2048,2,8,2,2),
-(5122,1,85,4096,2,8,0,2),
-(5123,1,85,4096,2,8,1,2),
-(5124,1,85,4096,2,8,2,2),
-(5125,1,85,8192,2,8,0,2),
-(5126,1,85,8192,2,8,1,2),
-(5127,1,85,8192,2,8,2,2),
-(5128,1,85,32,2,8,0,21),
-(5129,1,85,32,2,8,1,21),
-(5130,1,85,32,2,8,2,21),
-(5131,1,85,512,2,8,0,21),
-(5132,1,85,512,2,8,1,21),
-(5133,1,85,512,2,8,2,21),
-(5134,1,85,2,2,8,0,20),
-(5135,1,85,2,2,8,1,20),
-(5136,1,85,2,2,8,2,20),
-(5137,1,85,0,2,8,0,23),
-(5138,1,85,1,2,8,0,3),
-(5139,1,85,1,2,8,1,3),
-(5140,1,85,1,2,8,2,3),
-(5141,1,85,16,2,8,0,2),
-(5142,1,85,16,2,8,1,2),
-(5143,1,85,16,2,8,2,2),
-(5144,1,85,128,2,8,0,23),
-(5145,1,85,128,2,8,1,23),
-(5146,1,85,128,2,8,2,23),
-(5147,1,85,256,2,8,0,23),
-(5148,1,85,256,2,8,1,23),
-(5149,1,85,256,2,8,2,23),
-(5150,1,85,1024,2,8,0,7),
-(5151,1,85,1024,2,8,1,7),
-(5152,1,85,1024,2,8,2,7),
-(5153,1,85,2048,2,8,0,2),
-(5154,1,85,2048,2,8,1,2),
-(5155,1,85,2048,2,8,2,2),
-(5156,1,85,4096,2,8,0,2),
-(5157,1,85,4096,2,8,1,2),
-(5158,1,85,4096,2,8,2,2),
-(5159,1,85,8192,2,8,0,2),
-(5160,1,85,8192,2,8,1,2),
-(5161,1,85,8192,2,8,2,2),
-(5162,1,85,32,2,8,0,21),
-(5163,1,85,32,2,8,1,21),
-(5164,1,85,32,2,8,2,21),
-(5165,1,85,512,2,8,0,21),
-(5166,1,85,512,2,8,1,21),
-(5167,1,85,512,2,8,2,21),
-(5168,1,85,2,2,8,0,20),
-(5169,1,85,2,2,8,1,20),
-(5170,1,85,2,2,8,2,20),
-(5171,1,85,0,2,8,0,23),
-(5172,1,85,1,2,8,0,3),
-(5173,1,85,1,2,8,1,3),
-(5174,1,85,1,2,8,2,3),
-(5175,1,85,16,2,8,0,2),
-(5176,1,85,16,2,8,1,2),
-(5177,1,85,16,2,8,2,2),
-(5178,1,85,128,2,8,0,23),
-(5179,1,85,128,2,8,1,23),
-(5180,1,85,128,2,8,2,23),
-(5181,1,85,256,2,8,0,23),
-(5182,1,85,256,2,8,1,23),
-(5183,1,85,256,2,8,2,23),
-(5184,1,85,1024,2,8,0,7),
-(5185,1,85,1024,2,8,1,7),
-(5186,1,85,1024,2,8,2,7),
-(5187,1,85,2048,2,8,0,2),
-(5188,1,85,2048,2,8,1,2),
-(5189,1,85,2048,2,8,2,2),
-(5190,1,85,4096,2,8,0,2),
-(5191,1,85,4096,2,8,1,2),
-(5192,1,85,4096,2,8,2,2),
-(5193,1,85,8192,2,8,0,2),
-(5194,1,85,8192,2,8,1,2),
-(5195,1,85,8192,2,8,2,2),
-(5196,1,85,32,2,8,0,21),
-(5197,1,85,32,2,8,1,21),
-(5198,1,85,32,2,8,2,21),
-(5199,1,85,512,2,8,0,21),
-(5200,1,85,512,2,8,1,21),
-(5201,1,85,512,2,8,2,21),
-(5202,1,85,2,2,8,0,20),
-(5203,1,85,2,2,8,1,20),
-(5204,1,85,2,2,8,2,20),
-(5205,1,85,0,2,8,0,23),
-(5206,1,85,1,2,8,0,3),
-(5207,1,85,1,2,8,1,3),
-(5208,1,85,1,2,8,2,3),
-(5209,1,85,16,2,8,0,2),
-(5210,1,85,16,2,8,1,2),
-(5211,1,85,16,2,8,2,2),
-(5212,1,85,128,2,8,0,23),
-(5213,1,85,128,2,8,1,23),
-(5214,1,85,128,2,8,2,23),
-(5215,1,85,256,2,8,0,23),
-(5216,1,85,256,2,8,1,23),
-(5217,1,85,256,2,8,2,23),
-(5218,1,85,1024,2,8,0,7),
-(5219,1,85,1024,2,8,1,7),
-(5220,1,85,1024,2,8,2,7),
-(5221,1,85,2048,2,8,0,2),
-(5222,1,85,2048,2,8,1,2),
-(5223,1,85,2048,2,8,2,2),
-(5224,1,85,4096,2,8,0,2),
-(5225,1,85,4096,2,8,1,2),
-(5226,1,85,4096,2,8,2,2),
-(5227,1,85,8192,2,8,0,2),
-(5228,1,85,8192,2,8,1,2),
-(5229,1,85,8192,2,8,2,2),
-(5230,1,85,32,2,8,0,21),
-(5231,1,85,32,2,8,1,21),
-(5232,1,85,32,2,8,2,21),
-(5233,1,85,512,2,8,0,21),
-(5234,1,85,512,2,8,1,21),
-(5235,1,85,512,2,8,2,21),
-(5236,1,85,2,2,8,0,20),
-(5237,1,85,2,2,8,1,20),
-(5238,1,85,2,2,8,2,20),
-(5239,1,85,0,2,8,0,23),
-(5240,1,85,1,2,8,0,3),
-(5241,1,85,1,2,8,1,3),
-(5242,1,85,1,2,8,2,3),
-(5243,1,85,16,2,8,0,2),
-(5244,1,85,16,2,8,1,2),
-(5245,1,85,16,2,8,2,2),
-(5246,1,85,128,2,8,0,23),
-(5247,1,85,128,2,8,1,23),
-(5248,1,85,128,2,8,2,23),
-(5249,1,85,256,2,8,0,23),
-(5250,1,85,256,2,8,1,23),
-(5251,1,85,256,2,8,2,23),
-(5252,1,85,1024,2,8,0,7),
-(5253,1,85,1024,2,8,1,7),
-(5254,1,85,1024,2,8,2,7),
-(5255,1,85,2048,2,8,0,2),
-(5256,1,85,2048,2,8,1,2),
-(5257,1,85,2048,2,8,2,2),
-(5258,1,85,4096,2,8,0,2),
-(5259,1,85,4096,2,8,1,2),
-(5260,1,85,4096,2,8,2,2),
-(5261,1,85,8192,2,8,0,2),
-(5262,1,85,8192,2,8,1,2),
-(5263,1,85,8192,2,8,2,2),
-(5264,1,85,32,2,8,0,21),
-(5265,1,85,32,2,8,1,21),
-(5266,1,85,32,2,8,2,21),
-(5267,1,85,512,2,8,0,21),
-(5268,1,85,512,2,8,1,21),
-(5269,1,85,512,2,8,2,21),
-(5270,1,85,2,2,8,0,20),
-(5271,1,85,2,2,8,1,20),
-(5272,1,85,2,2,8,2,20),
-(5273,1,85,0,2,4,0,23),
-(5274,1,85,1,2,4,0,3),
-(5275,1,85,1,2,4,1,3),
-(5276,1,85,1,2,4,2,3),
-(5277,1,85,16,2,4,0,2),
-(5278,1,85,16,2,4,1,2),
-(5279,1,85,16,2,4,2,2),
-(5280,1,85,128,2,4,0,23),
-(5281,1,85,128,2,4,1,23),
-(5282,1,85,128,2,4,2,23),
-(5283,1,85,256,2,4,0,23),
-(5284,1,85,256,2,4,1,23),
-(5285,1,85,256,2,4,2,23),
-(5286,1,85,1024,2,4,0,7),
-(5287,1,85,1024,2,4,1,7),
-(5288,1,85,1024,2,4,2,7),
-(5289,1,85,2048,2,4,0,2),
-(5290,1,85,2048,2,4,1,2),
-(5291,1,85,2048,2,4,2,2),
-(5292,1,85,4096,2,4,0,2),
-(5293,1,85,4096,2,4,1,2),
-(5294,1,85,4096,2,4,2,2),
-(5295,1,85,8192,2,4,0,2),
-(5296,1,85,8192,2,4,1,2),
-(5297,1,85,8192,2,4,2,2),
-(5298,1,85,32,2,4,0,21),
-(5299,1,85,32,2,4,1,21),
-(5300,1,85,32,2,4,2,21),
-(5301,1,85,512,2,4,0,21),
-(5302,1,85,512,2,4,1,21),
-(5303,1,85,512,2,4,2,21),
-(5304,1,85,2,2,4,0,20),
-(5305,1,85,2,2,4,1,20),
-(5306,1,85,2,2,4,2,20),
-(5307,1,85,0,2,4,0,23),
-(5308,1,85,1,2,4,0,3),
-(5309,1,85,1,2,4,1,3),
-(5310,1,85,1,2,4,2,3),
-(5311,1,85,16,2,4,0,2),
-(5312,1,85,16,2,4,1,2),
-(5313,1,85,16,2,4,2,2),
-(5314,1,85,128,2,4,0,23),
-(5315,1,85,128,2,4,1,23),
-(5316,1,85,128,2,4,2,23),
-(5317,1,85,256,2,4,0,23),
-(5318,1,85,256,2,4,1,23),
-(5319,1,85,256,2,4,2,23),
-(5320,1,85,1024,2,4,0,7),
-(5321,1,85,1024,2,4,1,7),
-(5322,1,85,1024,2,4,2,7),
-(5323,1,85,2048,2,4,0,2),
-(5324,1,85,2048,2,4,1,2),
-(5325,1,85,2048,2,4,2,2),
-(5326,1,85,4096,2,4,0,2),
-(5327,1,85,4096,2,4,1,2),
-(5328,1,85,4096,2,4,2,2),
-(5329,1,85,8192,2,4,0,2),
-(5330,1,85,8192,2,4,1,2),
-(5331,1,85,8192,2,4,2,2),
-(5332,1,85,32,2,4,0,21),
-(5333,1,85,32,2,4,1,21),
-(5334,1,85,32,2,4,2,21),
-(5335,1,85,512,2,4,0,21),
-(5336,1,85,512,2,4,1,21),
-(5337,1,85,512,2,4,2,21),
-(5338,1,85,2,2,4,0,20),
-(5339,1,85,2,2,4,1,20),
-(5340,1,85,2,2,4,2,20),
-(5341,1,85,0,2,4,0,23),
-(5342,1,85,1,2,4,0,3),
-(5343,1,85,1,2,4,1,3),
-(5344,1,85,1,2,4,2,3),
-(5345,1,85,16,2,4,0,2),
-(5346,1,85,16,2,4,1,2),
-(5347,1,85,16,2,4,2,2),
-(5348,1,85,128,2,4,0,23),
-(5349,1,85,128,2,4,1,23),
-(5350,1,85,128,2,4,2,23),
-(5351,1,85,256,2,4,0,23),
-(5352,1,85,256,2,4,1,23),
-(5353,1,85,256,2,4,2,23),
-(5354,1,85,1024,2,4,0,7),
-(5355,1,85,1024,2,4,1,7),
-(5356,1,85,1024,2,4,2,7),
-(5357,1,85,2048,2,4,0,2),
-(5358,1,85,2048,2,4,1,2),
-(5359,1,85,2048,2,4,2,2),
-(5360,1,85,4096,2,4,0,2),
-(5361,1,85,4096,2,4,1,2),
-(5362,1,85,4096,2,4,2,2),
-(5363,1,85,8192,2,4,0,2),
-(5364,1,85,8192,2,4,1,2),
-(5365,1,85,8192,2,4,2,2),
-(5366,1,85,32,2,4,0,21),
-(5367,1,85,32,2,4,1,21),
-(5368,1,85,32,2,4,2,21),
-(5369,1,85,512,2,4,0,21),
-(5370,1,85,512,2,4,1,21),
-(5371,1,85,512,2,4,2,21),
-(5372,1,85,2,2,4,0,20),
-(5373,1,85,2,2,4,1,20),
-(5374,1,85,2,2,4,2,20),
-(5375,1,85,0,2,4,0,23),
-(5376,1,85,1,2,4,0,3),
-(5377,1,85,1,2,4,1,3),
-(5378,1,85,1,2,4,2,3),
-(5379,1,85,16,2,4,0,2),
-(5380,1,85,16,2,4,1,2),
-(5381,1,85,16,2,4,2,2),
-(5382,1,85,128,2,4,0,23),
-(5383,1,85,128,2,4,1,23),
-(5384,1,85,128,2,4,2,23),
-(5385,1,85,256,2,4,0,23),
-(5386,1,85,256,2,4,1,23),
-(5387,1,85,256,2,4,2,23),
-(5388,1,85,1024,2,4,0,7),
-(5389,1,85,1024,2,4,1,7),
-(5390,1,85,1024,2,4,2,7),
-(5391,1,85,2048,2,4,0,2),
-(5392,1,85,2048,2,4,1,2),
-(5393,1,85,2048,2,4,2,2),
-(5394,1,85,4096,2,4,0,2),
-(5395,1,85,4096,2,4,1,2),
-(5396,1,85,4096,2,4,2,2),
-(5397,1,85,8192,2,4,0,2),
-(5398,1,85,8192,2,4,1,2),
-(5399,1,85,8192,2,4,2,2),
-(5400,1,85,32,2,4,0,21),
-(5401,1,85,32,2,4,1,21),
-(5402,1,85,32,2,4,2,21),
-(5403,1,85,512,2,4,0,21),
-(5404,1,85,512,2,4,1,21),
-(5405,1,85,512,2,4,2,21),
-(5406,1,85,2,2,4,0,20),
-(5407,1,85,2,2,4,1,20),
-(5408,1,85,2,2,4,2,20),
-(5409,1,85,0,2,4,0,23),
-(5410,1,85,1,2,4,0,3),
-(5411,1,85,1,2,4,1,3),
-(5412,1,85,1,2,4,2,3),
-(5413,1,85,16,2,4,0,2),
-(5414,1,85,16,2,4,1,2),
-(5415,1,85,16,2,4,2,2),
-(5416,1,85,128,2,4,0,23),
-(5417,1,85,128,2,4,1,23),
-(5418,1,85,128,2,4,2,23),
-(5419,1,85,256,2,4,0,23),
-(5420,1,85,256,2,4,1,23),
-(5421,1,85,256,2,4,2,23),
-(5422,1,85,1024,2,4,0,7),
-(5423,1,85,1024,2,4,1,7),
-(5424,1,85,1024,2,4,2,7),
-(5425,1,85,2048,2,4,0,2),
-(5426,1,85,2048,2,4,1,2),
-(5427,1,85,2048,2,4,2,2),
-(5428,1,85,4096,2,4,0,2),
-(5429,1,85,4096,2,4,1,2),
-(5430,1,85,4096,2,4,2,2),
-(5431,1,85,8192,2,4,0,2),
-(5432,1,85,8192,2,4,1,2),
-(5433,1,85,8192,2,4,2,2),
-(5434,1,85,32,2,4,0,21),
-(5435,1,85,32,2,4,1,21),
-(5436,1,85,32,2,4,2,21),
-(5437,1,85,512,2,4,0,21),
-(5438,1,85,512,2,4,1,21),
-(5439,1,85,512,2,4,2,21),
-(5440,1,85,2,2,4,0,20),
-(5441,1,85,2,2,4,1,20),
-(5442,1,85,2,2,4,2,20),
-(5443,1,85,0,2,4,0,23),
-(5444,1,85,1,2,4,0,3),
-(5445,1,85,1,2,4,1,3),
-(5446,1,85,1,2,4,2,3),
-(5447,1,85,16,2,4,0,2),
-(5448,1,85,16,2,4,1,2),
-(5449,1,85,16,2,4,2,2),
-(5450,1,85,128,2,4,0,23),
-(5451,1,85,128,2,4,1,23),
-(5452,1,85,128,2,4,2,23),
-(5453,1,85,256,2,4,0,23),
-(5454,1,85,256,2,4,1,23),
-(5455,1,85,256,2,4,2,23),
-(5456,1,85,1024,2,4,0,7),
-(5457,1,85,1024,2,4,1,7),
-(5458,1,85,1024,2,4,2,7),
-(5459,1,85,2048,2,4,0,2),
-(5460,1,85,2048,2,4,1,2),
-(5461,1,85,2048,2,4,2,2),
-(5462,1,85,4096,2,4,0,2),
-(5463,1,85,4096,2,4,1,2),
-(5464,1,85,4096,2,4,2,2),
-(5465,1,85,8192,2,4,0,2),
-(5466,1,85,8192,2,4,1,2),
-(5467,1,85,8192,2,4,2,2),
-(5468,1,85,32,2,4,0,21),
-(5469,1,85,32,2,4,1,21),
-(5470,1,85,32,2,4,2,21),
-(5471,1,85,512,2,4,0,21),
-(5472,1,85,512,2,4,1,21),
-(5473,1,85,512,2,4,2,21),
-(5474,1,85,2,2,4,0,20),
-(5475,1,85,2,2,4,1,20),
-(5476,1,85,2,2,4,2,20),
-(5477,1,85,0,2,4,0,23),
-(5478,1,85,1,2,4,0,3),
-(5479,1,85,1,2,4,1,3),
-(5480,1,85,1,2,4,2,3),
-(5481,1,85,16,2,4,0,2),
-(5482,1,85,16,2,4,1,2),
-(5483,1,85,16,2,4,2,2),
-(5484,1,85,128,2,4,0,23),
-(5485,1,85,128,2,4,1,23),
-(5486,1,85,128,2,4,2,23),
-(5487,1,85,256,2,4,0,23),
-(5488,1,85,256,2,4,1,23),
-(5489,1,85,256,2,4,2,23),
-(5490,1,85,1024,2,4,0,7),
-(5491,1,85,1024,2,4,1,7),
-(5492,1,85,1024,2,4,2,7),
-(5493,1,85,2048,2,4,0,2),
-(5494,1,85,2048,2,4,1,2),
-(5495,1,85,2048,2,4,2,2),
-(5496,1,85,4096,2,4,0,2),
-(5497,1,85,4096,2,4,1,2),
-(5498,1,85,4096,2,4,2,2),
-(5499,1,85,8192,2,4,0,2),
-(5500,1,85,8192,2,4,1,2),
-(5501,1,85,8192,2,4,2,2),
-(5502,1,85,32,2,4,0,21),
-(5503,1,85,32,2,4,1,21),
-(5504,1,85,32,2,4,2,21),
-(5505,1,85,512,2,4,0,21),
-(5506,1,85,512,2,4,1,21),
-(5507,1,85,512,2,4,2,21),
-(5508,1,85,2,2,4,0,20),
-(5509,1,85,2,2,4,1,20),
-(5510,1,85,2,2,4,2,20),
-(5511,30,39,0,2,41459,0,7),
-(5512,30,39,1,2,41459,0,3),
-(5513,30,39,1,2,41459,1,3),
-(5514,30,39,1,2,41459,2,3),
-(5515,30,39,16,2,41459,0,2),
-(5516,30,39,16,2,41459,1,2),
-(5517,30,39,16,2,41459,2,2),
-(5518,30,39,128,2,41459,0,7),
-(5519,30,39,128,2,41459,1,7),
-(5520,30,39,128,2,41459,2,7),
-(5521,30,39,256,2,41459,0,7),
-(5522,30,39,256,2,41459,1,7),
-(5523,30,39,256,2,41459,2,7),
-(5524,30,39,1024,2,41459,0,7),
-(5525,30,39,1024,2,41459,1,7),
-(5526,30,39,1024,2,41459,2,7),
-(5527,30,39,2048,2,41459,0,2),
-(5528,30,39,2048,2,41459,1,2),
-(5529,30,39,2048,2,41459,2,2),
-(5530,30,39,4096,2,41459,0,2),
-(5531,30,39,4096,2,41459,1,2),
-(5532,30,39,4096,2,41459,2,2),
-(5533,30,39,8192,2,41459,0,2),
-(5534,30,39,8192,2,41459,1,2),
-(5535,30,39,8192,2,41459,2,2),
-(5536,30,39,32,2,41459,0,5),
-(5537,30,39,32,2,41459,1,5),
-(5538,30,39,32,2,41459,2,5),
-(5539,30,39,512,2,41459,0,5),
-(5540,30,39,512,2,41459,1,5),
-(5541,30,39,512,2,41459,2,5),
-(5542,30,39,2,2,41459,0,4),
-(5543,30,39,2,2,41459,1,4),
-(5544,30,39,2,2,41459,2,4),
-(5545,40,49,0,2,41459,0,7),
-(5546,40,49,1,2,41459,0,3),
-(5547,40,49,1,2,41459,1,3),
-(5548,40,49,1,2,41459,2,3),
-(5549,40,49,16,2,41459,0,2),
-(5550,40,49,16,2,41459,1,2),
-(5551,40,49,16,2,41459,2,2),
-(5552,40,49,128,2,41459,0,7),
-(5553,40,49,128,2,41459,1,7),
-(5554,40,49,128,2,41459,2,7),
-(5555,40,49,256,2,41459,0,7),
-(5556,40,49,256,2,41459,1,7),
-(5557,40,49,256,2,41459,2,7),
-(5558,40,49,1024,2,41459,0,7),
-(5559,40,49,1024,2,41459,1,7),
-(5560,40,49,1024,2,41459,2,7),
-(5561,40,49,2048,2,41459,0,2),
-(5562,40,49,2048,2,41459,1,2),
-(5563,40,49,2048,2,41459,2,2),
-(5564,40,49,4096,2,41459,0,2),
-(5565,40,49,4096,2,41459,1,2),
-(5566,40,49,4096,2,41459,2,2),
-(5567,40,49,8192,2,41459,0,2),
-(5568,40,49,8192,2,41459,1,2),
-(5569,40,49,8192,2,41459,2,2),
-(5570,40,49,32,2,41459,0,5),
-(5571,40,49,32,2,41459,1,5),
-(5572,40,49,32,2,41459,2,5),
-(5573,40,49,512,2,41459,0,5),
-(5574,40,49,512,2,41459,1,5),
-(5575,40,49,512,2,41459,2,5),
-(5576,40,49,2,2,41459,0,4),
-(5577,40,49,2,2,41459,1,4),
-(5578,40,49,2,2,41459,2,4),
-(5579,1,12,0,2,41459,0,7),
-(5580,1,12,1,2,41459,0,3),
-(5581,1,12,1,2,41459,1,3),
-(5582,1,12,1,2,41459,2,3),
-(5583,1,12,16,2,41459,0,2),
-(5584,1,12,16,2,41459,1,2),
-(5585,1,12,16,2,41459,2,2),
-(5586,1,12,128,2,41459,0,7),
-(5587,1,12,128,2,41459,1,7),
-(5588,1,12,128,2,41459,2,7),
-(5589,1,12,256,2,41459,0,7),
-(5590,1,12,256,2,41459,1,7),
-(5591,1,12,256,2,41459,2,7),
-(5592,1,12,1024,2,41459,0,7),
-(5593,1,12,1024,2,41459,1,7),
-(5594,1,12,1024,2,41459,2,7),
-(5595,1,12,2048,2,41459,0,2),
-(5596,1,12,2048,2,41459,1,2),
-(5597,1,12,2048,2,41459,2,2),
-(5598,1,12,4096,2,41459,0,2),
-(5599,1,12,4096,2,41459,1,2),
-(5600,1,12,4096,2,41459,2,2),
-(5601,1,12,8192,2,41459,0,2),
-(5602,1,12,8192,2,41459,1,2),
-(5603,1,12,8192,2,41459,2,2),
-(5604,1,12,32,2,41459,0,5),
-(5605,1,12,32,2,41459,1,5),
-(5606,1,12,32,2,41459,2,5),
-(5607,1,12,512,2,41459,0,5),
-(5608,1,12,512,2,41459,1,5),
-(5609,1,12,512,2,41459,2,5),
-(5610,1,12,2,2,41459,0,4),
-(5611,1,12,2,2,41459,1,4),
-(5612,1,12,2,2,41459,2,4),
-(5613,7,16,0,2,41459,0,7),
-(5614,7,16,1,2,41459,0,3),
-(5615,7,16,1,2,41459,1,3),
-(5616,7,16,1,2,41459,2,3),
-(5617,7,16,16,2,41459,0,2),
-(5618,7,16,16,2,41459,1,2),
-(5619,7,16,16,2,41459,2,2),
-(5620,7,16,128,2,41459,0,7),
-(5621,7,16,128,2,41459,1,7),
-(5622,7,16,128,2,41459,2,7),
-(5623,7,16,256,2,41459,0,7),
-(5624,7,16,256,2,41459,1,7),
-(5625,7,16,256,2,41459,2,7),
-(5626,7,16,1024,2,41459,0,7),
-(5627,7,16,1024,2,41459,1,7),
-(5628,7,16,1024,2,41459,2,7),
-(5629,7,16,2048,2,41459,0,2),
-(5630,7,16,2048,2,41459,1,2),
-(5631,7,16,2048,2,41459,2,2),
-(5632,7,16,4096,2,41459,0,2),
-(5633,7,16,4096,2,41459,1,2),
-(5634,7,16,4096,2,41459,2,2),
-(5635,7,16,8192,2,41459,0,2),
-(5636,7,16,8192,2,41459,1,2),
-(5637,7,16,8192,2,41459,2,2),
-(5638,7,16,32,2,41459,0,5),
-(5639,7,16,32,2,41459,1,5),
-(5640,7,16,32,2,41459,2,5),
-(5641,7,16,512,2,41459,0,5),
-(5642,7,16,512,2,41459,1,5),
-(5643,7,16,512,2,41459,2,5),
-(5644,7,16,2,2,41459,0,4),
-(5645,7,16,2,2,41459,1,4),
-(5646,7,16,2,2,41459,2,4),
-(5647,10,25,0,2,41459,0,7),
-(5648,10,25,1,2,41459,0,3),
-(5649,10,25,1,2,41459,1,3),
-(5650,10,25,1,2,41459,2,3),
-(5651,10,25,16,2,41459,0,2),
-(5652,10,25,16,2,41459,1,2),
-(5653,10,25,16,2,41459,2,2),
-(5654,10,25,128,2,41459,0,7),
-(5655,10,25,128,2,41459,1,7),
-(5656,10,25,128,2,41459,2,7),
-(5657,10,25,256,2,41459,0,7),
-(5658,10,25,256,2,41459,1,7),
-(5659,10,25,256,2,41459,2,7),
-(5660,10,25,1024,2,41459,0,7),
-(5661,10,25,1024,2,41459,1,7),
-(5662,10,25,1024,2,41459,2,7),
-(5663,10,25,2048,2,41459,0,2),
-(5664,10,25,2048,2,41459,1,2),
-(5665,10,25,2048,2,41459,2,2),
-(5666,10,25,4096,2,41459,0,2),
-(5667,10,25,4096,2,41459,1,2),
-(5668,10,25,4096,2,41459,2,2),
-(5669,10,25,8192,2,41459,0,2),
-(5670,10,25,8192,2,41459,1,2),
-(5671,10,25,8192,2,41459,2,2),
-(5672,10,25,32,2,41459,0,5),
-(5673,10,25,32,2,41459,1,5),
-(5674,10,25,32,2,41459,2,5),
-(5675,10,25,512,2,41459,0,5),
-(5676,10,25,512,2,41459,1,5),
-(5677,10,25,512,2,41459,2,5),
-(5678,10,25,2,2,41459,0,4),
-(5679,10,25,2,2,41459,1,4),
-(5680,10,25,2,2,41459,2,4),
-(5681,20,35,0,2,41459,0,7),
-(5682,20,35,1,2,41459,0,3),
-(5683,20,35,1,2,41459,1,3),
-(5684,20,35,1,2,41459,2,3),
-(5685,20,35,16,2,41459,0,2),
-(5686,20,35,16,2,41459,1,2),
-(5687,20,35,16,2,41459,2,2),
-(5688,20,35,128,2,41459,0,7),
-(5689,20,35,128,2,41459,1,7),
-(5690,20,35,128,2,41459,2,7),
-(5691,20,35,256,2,41459,0,7),
-(5692,20,35,256,2,41459,1,7),
-(5693,20,35,256,2,41459,2,7),
-(5694,20,35,1024,2,41459,0,7),
-(5695,20,35,1024,2,41459,1,7),
-(5696,20,35,1024,2,41459,2,7),
-(5697,20,35,2048,2,41459,0,2),
-(5698,20,35,2048,2,41459,1,2),
-(5699,20,35,2048,2,41459,2,2),
-(5700,20,35,4096,2,41459,0,2),
-(5701,20,35,4096,2,41459,1,2),
-(5702,20,35,4096,2,41459,2,2),
-(5703,20,35,8192,2,41459,0,2),
-(5704,20,35,8192,2,41459,1,2),
-(5705,20,35,8192,2,41459,2,2),
-(5706,20,35,32,2,41459,0,5),
-(5707,20,35,32,2,41459,1,5),
-(5708,20,35,32,2,41459,2,5),
-(5709,20,35,512,2,41459,0,5),
-(5710,20,35,512,2,41459,1,5),
-(5711,20,35,512,2,41459,2,5),
-(5712,20,35,2,2,41459,0,4),
-(5713,20,35,2,2,41459,1,4),
-(5714,20,35,2,2,41459,2,4),
-(5715,30,45,0,2,41459,0,7),
-(5716,30,45,1,2,41459,0,3),
-(5717,30,45,1,2,41459,1,3),
-(5718,30,45,1,2,41459,2,3),
-(5719,30,45,16,2,41459,0,2),
-(5720,30,45,16,2,41459,1,2),
-(5721,30,45,16,2,41459,2,2),
-(5722,30,45,128,2,41459,0,7),
-(5723,30,45,128,2,41459,1,7),
-(5724,30,45,128,2,41459,2,7),
-(5725,30,45,256,2,41459,0,7),
-(5726,30,45,256,2,41459,1,7),
-(5727,30,45,256,2,41459,2,7),
-(5728,30,45,1024,2,41459,0,7),
-(5729,30,45,1024,2,41459,1,7),
-(5730,30,45,1024,2,41459,2,7),
-(5731,30,45,2048,2,41459,0,2),
-(5732,30,45,2048,2,41459,1,2),
-(5733,30,45,2048,2,41459,2,2),
-(5734,30,45,4096,2,41459,0,2),
-(5735,30,45,4096,2,41459,1,2),
-(5736,30,45,4096,2,41459,2,2),
-(5737,30,45,8192,2,41459,0,2),
-(5738,30,45,8192,2,41459,1,2),
-(5739,30,45,8192,2,41459,2,2),
-(5740,30,45,32,2,41459,0,5),
-(5741,30,45,32,2,41459,1,5),
-(5742,30,45,32,2,41459,2,5),
-(5743,30,45,512,2,41459,0,5),
-(5744,30,45,512,2,41459,1,5),
-(5745,30,45,512,2,41459,2,5),
-(5746,30,45,2,2,41459,0,4),
-(5747,30,45,2,2,41459,1,4),
-(5748,30,45,2,2,41459,2,4),
-(5749,40,55,0,2,41459,0,7),
-(5750,40,55,1,2,41459,0,3),
-(5751,40,55,1,2,41459,1,3),
-(5752,40,55,1,2,41459,2,3),
-(5753,40,55,16,2,41459,0,2),
-(5754,40,55,16,2,41459,1,2),
-(5755,40,55,16,2,41459,2,2),
-(5756,40,55,128,2,41459,0,7),
-(5757,40,55,128,2,41459,1,7),
-(5758,40,55,128,2,41459,2,7),
-(5759,40,55,256,2,41459,0,7),
-(5760,40,55,256,2,41459,1,7),
-(5761,40,55,256,2,41459,2,7),
-(5762,40,55,1024,2,41459,0,7),
-(5763,40,55,1024,2,41459,1,7),
-(5764,40,55,1024,2,41459,2,7),
-(5765,40,55,2048,2,41459,0,2),
-(5766,40,55,2048,2,41459,1,2),
-(5767,40,55,2048,2,41459,2,2),
-(5768,40,55,4096,2,41459,0,2),
-(5769,40,55,4096,2,41459,1,2),
-(5770,40,55,4096,2,41459,2,2),
-(5771,40,55,8192,2,41459,0,2),
-(5772,40,55,8192,2,41459,1,2),
-(5773,40,55,8192,2,41459,2,2),
-(5774,40,55,32,2,41459,0,5),
-(5775,40,55,32,2,41459,1,5),
-(5776,40,55,32,2,41459,2,5),
-(5777,40,55,512,2,41459,0,5),
-(5778,40,55,512,2,41459,1,5),
-(5779,40,55,512,2,41459,2,5),
-(5780,40,55,2,2,41459,0,4),
-(5781,40,55,2,2,41459,1,4),
-(5782,40,55,2,2,41459,2,4),
-(5783,50,65,0,2,41459,0,7),
-(5784,50,65,1,2,41459,0,3),
-(5785,50,65,1,2,41459,1,3),
-(5786,50,65,1,2,41459,2,3),
-(5787,50,65,16,2,41459,0,2),
-(5788,50,65,16,2,41459,1,2),
-(5789,50,65,16,2,41459,2,2),
-(5790,50,65,128,2,41459,0,7),
-(5791,50,65,128,2,41459,1,7),
-(5792,50,65,128,2,41459,2,7),
-(5793,50,65,256,2,41459,0,7),
-(5794,50,65,256,2,41459,1,7),
-(5795,50,65,256,2,41459,2,7),
-(5796,50,65,1024,2,41459,0,7),
-(5797,50,65,1024,2,41459,1,7),
-(5798,50,65,1024,2,41459,2,7),
-(5799,50,65,2048,2,41459,0,2),
-(5800,50,65,2048,2,41459,1,2),
-(5801,50,65,2048,2,41459,2,2),
-(5802,50,65,4096,2,41459,0,2),
-(5803,50,65,4096,2,41459,1,2),
-(5804,50,65,4096,2,41459,2,2),
-(5805,50,65,8192,2,41459,0,2),
-(5806,50,65,8192,2,41459,1,2),
-(5807,50,65,8192,2,41459,2,2),
-(5808,50,65,32,2,41459,0,5),
-(5809,50,65,32,2,41459,1,5),
-(5810,50,65,32,2,41459,2,5),
-(5811,50,65,512,2,41459,0,5),
-(5812,50,65,512,2,41459,1,5),
-(5813,50,65,512,2,41459,2,5),
-(5814,50,65,2,2,41459,0,4),
-(5815,50,65,2,2,41459,1,4),
-(5816,50,65,2,2,41459,2,4),
-(5817,20,27,0,2,41459,0,7),
-(5818,20,27,1,2,41459,0,3),
-(5819,20,27,1,2,41459,1,3),
-(5820,20,27,1,2,41459,2,3),
-(5821,20,27,16,2,41459,0,2),
-(5822,20,27,16,2,41459,1,2),
-(5823,20,27,16,2,41459,2,2),
-(5824,20,27,128,2,41459,0,7),
-(5825,20,27,128,2,41459,1,7),
-(5826,20,27,128,2,41459,2,7),
-(5827,20,27,256,2,41459,0,7),
-(5828,20,27,256,2,41459,1,7),
-(5829,20,27,256,2,41459,2,7),
-(5830,20,27,1024,2,41459,0,7),
-(5831,20,27,1024,2,41459,1,7),
-(5832,20,27,1024,2,41459,2,7),
-(5833,20,27,2048,2,41459,0,2),
-(5834,20,27,2048,2,41459,1,2),
-(5835,20,27,2048,2,41459,2,2),
-(5836,20,27,4096,2,41459,0,2),
-(5837,20,27,4096,2,41459,1,2),
-(5838,20,27,4096,2,41459,2,2),
-(5839,20,27,8192,2,41459,0,2),
-(5840,20,27,8192,2,41459,1,2),
-(5841,20,27,8192,2,41459,2,2),
-(5842,20,27,32,2,41459,0,5),
-(5843,20,27,32,2,41459,1,5),
-(5844,20,27,32,2,41459,2,5),
-(5845,20,27,512,2,41459,0,5),
-(5846,20,27,512,2,41459,1,5),
-(5847,20,27,512,2,41459,2,5),
-(5848,20,27,2,2,41459,0,4),
-(5849,20,27,2,2,41459,1,4),
-(5850,20,27,2,2,41459,2,4),
-(5851,28,35,0,2,41459,0,7),
-(5852,28,35,1,2,41459,0,3),
-(5853,28,35,1,2,41459,1,3),
-(5854,28,35,1,2,41459,2,3),
-(5855,28,35,16,2,41459,0,2),
-(5856,28,35,16,2,41459,1,2),
-(5857,28,35,16,2,41459,2,2),
-(5858,28,35,128,2,41459,0,7),
-(5859,28,35,128,2,41459,1,7),
-(5860,28,35,128,2,41459,2,7),
-(5861,28,35,256,2,41459,0,7),
-(5862,28,35,256,2,41459,1,7),
-(5863,28,35,256,2,41459,2,7),
-(5864,28,35,1024,2,41459,0,7),
-(5865,28,35,1024,2,41459,1,7),
-(5866,28,35,1024,2,41459,2,7),
-(5867,28,35,2048,2,41459,0,2),
-(5868,28,35,2048,2,41459,1,2),
-(5869,28,35,2048,2,41459,2,2),
-(5870,28,35,4096,2,41459,0,2),
-(5871,28,35,4096,2,41459,1,2),
-(5872,28,35,4096,2,41459,2,2),
-(5873,28,35,8192,2,41459,0,2),
-(5874,28,35,8192,2,41459,1,2),
-(5875,28,35,8192,2,41459,2,2),
-(5876,28,35,32,2,41459,0,5),
-(5877,28,35,32,2,41459,1,5),
-(5878,28,35,32,2,41459,2,5),
-(5879,28,35,512,2,41459,0,5),
-(5880,28,35,512,2,41459,1,5),
-(5881,28,35,512,2,41459,2,5),
-(5882,28,35,2,2,41459,0,4),
-(5883,28,35,2,2,41459,1,4),
-(5884,28,35,2,2,41459,2,4),
-(5885,36,43,0,2,41459,0,7),
-(5886,36,43,1,2,41459,0,3),
-(5887,36,43,1,2,41459,1,3),
-(5888,36,43,1,2,41459,2,3),
-(5889,36,43,16,2,41459,0,2),
-(5890,36,43,16,2,41459,1,2),
-(5891,36,43,16,2,41459,2,2),
-(5892,36,43,128,2,41459,0,7),
-(5893,36,43,128,2,41459,1,7),
-(5894,36,43,128,2,41459,2,7),
-(5895,36,43,256,2,41459,0,7),
-(5896,36,43,256,2,41459,1,7),
-(5897,36,43,256,2,41459,2,7),
-(5898,36,43,1024,2,41459,0,7),
-(5899,36,43,1024,2,41459,1,7),
-(5900,36,43,1024,2,41459,2,7),
-(5901,36,43,2048,2,41459,0,2),
-(5902,36,43,2048,2,41459,1,2),
-(5903,36,43,2048,2,41459,2,2),
-(5904,36,43,4096,2,41459,0,2),
-(5905,36,43,4096,2,41459,1,2),
-(5906,36,43,4096,2,41459,2,2),
-(5907,36,43,8192,2,41459,0,2),
-(5908,36,43,8192,2,41459,1,2),
-(5909,36,43,8192,2,41459,2,2),
-(5910,36,43,32,2,41459,0,5),
-(5911,36,43,32,2,41459,1,5),
-(5912,36,43,32,2,41459,2,5),
-(5913,36,43,512,2,41459,0,5),
-(5914,36,43,512,2,41459,1,5),
-(5915,36,43,512,2,41459,2,5),
-(5916,36,43,2,2,41459,0,4),
-(5917,36,43,2,2,41459,1,4),
-(5918,36,43,2,2,41459,2,4),
-(5919,25,34,0,2,164291,0,7),
-(5920,25,34,1,2,164291,0,3),
-(5921,25,34,1,2,164291,1,3),
-(5922,25,34,1,2,164291,2,3),
-(5923,25,34,16,2,164291,0,2),
-(5924,25,34,16,2,164291,1,2),
-(5925,25,34,16,2,164291,2,2),
-(5926,25,34,128,2,164291,0,7),
-(5927,25,34,128,2,164291,1,7),
-(5928,25,34,128,2,164291,2,7),
-(5929,25,34,256,2,164291,0,7),
-(5930,25,34,256,2,164291,1,7),
-(5931,25,34,256,2,164291,2,7),
-(5932,25,34,1024,2,164291,0,7),
-(5933,25,34,1024,2,164291,1,7),
-(5934,25,34,1024,2,164291,2,7),
-(5935,25,34,2048,2,164291,0,2),
-(5936,25,34,2048,2,164291,1,2),
-(5937,25,34,2048,2,164291,2,2),
-(5938,25,34,4096,2,164291,0,2),
-(5939,25,34,4096,2,164291,1,2),
-(5940,25,34,4096,2,164291,2,2),
-(5941,25,34,8192,2,164291,0,2),
-(5942,25,34,8192,2,164291,1,2),
-(5943,25,34,8192,2,164291,2,2),
-(5944,25,34,32,2,164291,0,5),
-(5945,25,34,32,2,164291,1,5),
-(5946,25,34,32,2,164291,2,5),
-(5947,25,34,512,2,164291,0,5),
-(5948,25,34,512,2,164291,1,5),
-(5949,25,34,512,2,164291,2,5),
-(5950,25,34,2,2,164291,0,4),
-(5951,25,34,2,2,164291,1,4),
-(5952,25,34,2,2,164291,2,4),
-(5953,25,34,0,2,9264,0,7),
-(5954,25,34,1,2,9264,0,3),
-(5955,25,34,1,2,9264,1,3),
-(5956,25,34,1,2,9264,2,3),
-(5957,25,34,16,2,9264,0,2),
-(5958,25,34,16,2,9264,1,2),
-(5959,25,34,16,2,9264,2,2),
-(5960,25,34,128,2,9264,0,7),
-(5961,25,34,128,2,9264,1,7),
-(5962,25,34,128,2,9264,2,7),
-(5963,25,34,256,2,9264,0,7),
-(5964,25,34,256,2,9264,1,7),
-(5965,25,34,256,2,9264,2,7),
-(5966,25,34,1024,2,9264,0,7),
-(5967,25,34,1024,2,9264,1,7),
-(5968,25,34,1024,2,9264,2,7),
-(5969,25,34,2048,2,9264,0,2),
-(5970,25,34,2048,2,9264,1,2),
-(5971,25,34,2048,2,9264,2,2),
-(5972,25,34,4096,2,9264,0,2),
-(5973,25,34,4096,2,9264,1,2),
-(5974,25,34,4096,2,9264,2,2),
-(5975,25,34,8192,2,9264,0,2),
-(5976,25,34,8192,2,9264,1,2),
-(5977,25,34,8192,2,9264,2,2),
-(5978,25,34,32,2,9264,0,5),
-(5979,25,34,32,2,9264,1,5),
-(5980,25,34,32,2,9264,2,5),
-(5981,25,34,512,2,9264,0,5),
-(5982,25,34,512,2,9264,1,5),
-(5983,25,34,512,2,9264,2,5),
-(5984,25,34,2,2,9264,0,4),
-(5985,25,34,2,2,9264,1,4),
-(5986,25,34,2,2,9264,2,4),
-(5987,36,45,0,2,41459,0,39),
-(5988,36,45,1,2,41459,0,3),
-(5989,36,45,1,2,41459,1,3),
-(5990,36,45,1,2,41459,2,3),
-(5991,36,45,16,2,41459,0,2),
-(5992,36,45,16,2,41459,1,2),
-(5993,36,45,16,2,41459,2,2),
-(5994,36,45,128,2,41459,0,39),
-(5995,36,45,128,2,41459,1,39),
-(5996,36,45,128,2,41459,2,39),
-(5997,36,45,256,2,41459,0,39),
-(5998,36,45,256,2,41459,1,39),
-(5999,36,45,256,2,41459,2,39),
-(6000,36,45,1024,2,41459,0,7),
-(6001,36,45,1024,2,41459,1,7),
-(6002,36,45,1024,2,41459,2,7),
-(6003,36,45,2048,2,41459,0,2),
-(6004,36,45,2048,2,41459,1,2),
-(6005,36,45,2048,2,41459,2,2),
-(6006,36,45,4096,2,41459,0,2),
-(6007,36,45,4096,2,41459,1,2),
-(6008,36,45,4096,2,41459,2,2),
-(6009,36,45,8192,2,41459,0,2),
-(6010,36,45,8192,2,41459,1,2),
-(6011,36,45,8192,2,41459,2,2),
-(6012,36,45,32,2,41459,0,5),
-(6013,36,45,32,2,41459,1,5),
-(6014,36,45,32,2,41459,2,5),
-(6015,36,45,512,2,41459,0,37),
-(6016,36,45,512,2,41459,1,37),
-(6017,36,45,512,2,41459,2,37),
-(6018,36,45,2,2,41459,0,4),
-(6019,36,45,2,2,41459,1,4),
-(6020,36,45,2,2,41459,2,4),
-(6021,36,45,4,2,41459,0,32),
-(6022,36,45,4,2,41459,1,32),
-(6023,36,45,4,2,41459,2,32),
-(6024,36,45,8,2,41459,0,32),
-(6025,36,45,8,2,41459,1,32),
-(6026,36,45,8,2,41459,2,32),
-(6027,36,45,64,2,41459,0,32),
-(6028,36,45,64,2,41459,1,32),
-(6029,36,45,64,2,41459,2,32),
-(6030,38,47,0,2,41459,0,7),
-(6031,38,47,1,2,41459,0,3),
-(6032,38,47,1,2,41459,1,3),
-(6033,38,47,1,2,41459,2,3),
-(6034,38,47,16,2,41459,0,2),
-(6035,38,47,16,2,41459,1,2),
-(6036,38,47,16,2,41459,2,2),
-(6037,38,47,128,2,41459,0,7),
-(6038,38,47,128,2,41459,1,7),
-(6039,38,47,128,2,41459,2,7),
-(6040,38,47,256,2,41459,0,7),
-(6041,38,47,256,2,41459,1,7),
-(6042,38,47,256,2,41459,2,7),
-(6043,38,47,1024,2,41459,0,7),
-(6044,38,47,1024,2,41459,1,7),
-(6045,38,47,1024,2,41459,2,7),
-(6046,38,47,2048,2,41459,0,2),
-(6047,38,47,2048,2,41459,1,2),
-(6048,38,47,2048,2,41459,2,2),
-(6049,38,47,4096,2,41459,0,2),
-(6050,38,47,4096,2,41459,1,2),
-(6051,38,47,4096,2,41459,2,2),
-(6052,38,47,8192,2,41459,0,2),
-(6053,38,47,8192,2,41459,1,2),
-(6054,38,47,8192,2,41459,2,2),
-(6055,38,47,32,2,41459,0,5),
-(6056,38,47,32,2,41459,1,5),
-(6057,38,47,32,2,41459,2,5),
-(6058,38,47,512,2,41459,0,5),
-(6059,38,47,512,2,41459,1,5),
-(6060,38,47,512,2,41459,2,5),
-(6061,38,47,2,2,41459,0,4),
-(6062,38,47,2,2,41459,1,4),
-(6063,38,47,2,2,41459,2,4),
-(6064,50,59,0,2,41459,0,7),
-(6065,50,59,1,2,41459,0,3),
-(6066,50,59,1,2,41459,1,3),
-(6067,50,59,1,2,41459,2,3),
-(6068,50,59,16,2,41459,0,2),
-(6069,50,59,16,2,41459,1,2),
-(6070,50,59,16,2,41459,2,2),
-(6071,50,59,128,2,41459,0,7),
-(6072,50,59,128,2,41459,1,7),
-(6073,50,59,128,2,41459,2,7),
-(6074,50,59,256,2,41459,0,7),
-(6075,50,59,256,2,41459,1,7),
-(6076,50,59,256,2,41459,2,7),
-(6077,50,59,1024,2,41459,0,7),
-(6078,50,59,1024,2,41459,1,7),
-(6079,50,59,1024,2,41459,2,7),
-(6080,50,59,2048,2,41459,0,2),
-(6081,50,59,2048,2,41459,1,2),
-(6082,50,59,2048,2,41459,2,2),
-(6083,50,59,4096,2,41459,0,2),
-(6084,50,59,4096,2,41459,1,2),
-(6085,50,59,4096,2,41459,2,2),
-(6086,50,59,8192,2,41459,0,2),
-(6087,50,59,8192,2,41459,1,2),
-(6088,50,59,8192,2,41459,2,2),
-(6089,50,59,32,2,41459,0,5),
-(6090,50,59,32,2,41459,1,5),
-(6091,50,59,32,2,41459,2,5),
-(6092,50,59,512,2,41459,0,5),
-(6093,50,59,512,2,41459,1,5),
-(6094,50,59,512,2,41459,2,5),
-(6095,50,59,2,2,41459,0,4),
-(6096,50,59,2,2,41459,1,4),
-(6097,50,59,2,2,41459,2,4),
-(6098,44,51,0,2,41459,0,7),
-(6099,44,51,1,2,41459,0,3),
-(6100,44,51,1,2,41459,1,3),
-(6101,44,51,1,2,41459,2,3),
-(6102,44,51,16,2,41459,0,2),
-(6103,44,51,16,2,41459,1,2),
-(6104,44,51,16,2,41459,2,2),
-(6105,44,51,128,2,41459,0,7),
-(6106,44,51,128,2,41459,1,7),
-(6107,44,51,128,2,41459,2,7),
-(6108,44,51,256,2,41459,0,7),
-(6109,44,51,256,2,41459,1,7),
-(6110,44,51,256,2,41459,2,7),
-(6111,44,51,1024,2,41459,0,7),
-(6112,44,51,1024,2,41459,1,7),
-(6113,44,51,1024,2,41459,2,7),
-(6114,44,51,2048,2,41459,0,2),
-(6115,44,51,2048,2,41459,1,2),
-(6116,44,51,2048,2,41459,2,2),
-(6117,44,51,4096,2,41459,0,2),
-(6118,44,51,4096,2,41459,1,2),
-(6119,44,51,4096,2,41459,2,2),
-(6120,44,51,8192,2,41459,0,2),
-(6121,44,51,8192,2,41459,1,2),
-(6122,44,51,8192,2,41459,2,2),
-(6123,44,51,32,2,41459,0,5),
-(6124,44,51,32,2,41459,1,5),
-(6125,44,51,32,2,41459,2,5),
-(6126,44,51,512,2,41459,0,5),
-(6127,44,51,512,2,41459,1,5),
-(6128,44,51,512,2,41459,2,5),
-(6129,44,51,2,2,41459,0,4),
-(6130,44,51,2,2,41459,1,4),
-(6131,44,51,2,2,41459,2,4),
-(6132,52,59,0,2,41459,0,7),
-(6133,52,59,1,2,41459,0,3),
-(6134,52,59,1,2,41459,1,3),
-(6135,52,59,1,2,41459,2,3),
-(6136,52,59,16,2,41459,0,2),
-(6137,52,59,16,2,41459,1,2),
-(6138,52,59,16,2,41459,2,2),
-(6139,52,59,128,2,41459,0,7),
-(6140,52,59,128,2,41459,1,7),
-(6141,52,59,128,2,41459,2,7),
-(6142,52,59,256,2,41459,0,7),
-(6143,52,59,256,2,41459,1,7),
-(6144,52,59,256,2,41459,2,7),
-(6145,52,59,1024,2,41459,0,7),
-(6146,52,59,1024,2,41459,1,7),
-(6147,52,59,1024,2,41459,2,7),
-(6148,52,59,2048,2,41459,0,2),
-(6149,52,59,2048,2,41459,1,2),
-(6150,52,59,2048,2,41459,2,2),
-(6151,52,59,4096,2,41459,0,2),
-(6152,52,59,4096,2,41459,1,2),
-(6153,52,59,4096,2,41459,2,2),
-(6154,52,59,8192,2,41459,0,2),
-(6155,52,59,8192,2,41459,1,2),
-(6156,52,59,8192,2,41459,2,2),
-(6157,52,59,32,2,41459,0,5),
-(6158,52,59,32,2,41459,1,5),
-(6159,52,59,32,2,41459,2,5),
-(6160,52,59,512,2,41459,0,5),
-(6161,52,59,512,2,41459,1,5),
-(6162,52,59,512,2,41459,2,5),
-(6163,52,59,2,2,41459,0,4),
-(6164,52,59,2,2,41459,1,4),
-(6165,52,59,2,2,41459,2,4),
-(6166,60,67,0,2,41459,0,7),
-(6167,60,67,1,2,41459,0,3),
-(6168,60,67,1,2,41459,1,3),
-(6169,60,67,1,2,41459,2,3),
-(6170,60,67,16,2,41459,0,2),
-(6171,60,67,16,2,41459,1,2),
-(6172,60,67,16,2,41459,2,2),
-(6173,60,67,128,2,41459,0,7),
-(6174,60,67,128,2,41459,1,7),
-(6175,60,67,128,2,41459,2,7),
-(6176,60,67,256,2,41459,0,7),
-(6177,60,67,256,2,41459,1,7),
-(6178,60,67,256,2,41459,2,7),
-(6179,60,67,1024,2,41459,0,7),
-(6180,60,67,1024,2,41459,1,7),
-(6181,60,67,1024,2,41459,2,7),
-(6182,60,67,2048,2,41459,0,2),
-(6183,60,67,2048,2,41459,1,2),
-(6184,60,67,2048,2,41459,2,2),
-(6185,60,67,4096,2,41459,0,2),
-(6186,60,67,4096,2,41459,1,2),
-(6187,60,67,4096,2,41459,2,2),
-(6188,60,67,8192,2,41459,0,2),
-(6189,60,67,8192,2,41459,1,2),
-(6190,60,67,8192,2,41459,2,2),
-(6191,60,67,32,2,41459,0,5),
-(6192,60,67,32,2,41459,1,5),
-(6193,60,67,32,2,41459,2,5),
-(6194,60,67,512,2,41459,0,5),
-(6195,60,67,512,2,41459,1,5),
-(6196,60,67,512,2,41459,2,5),
-(6197,60,67,2,2,41459,0,4),
-(6198,60,67,2,2,41459,1,4),
-(6199,60,67,2,2,41459,2,4),
-(6200,46,53,0,2,41459,0,7),
-(6201,46,53,1,2,41459,0,3),
-(6202,46,53,1,2,41459,1,3),
-(6203,46,53,1,2,41459,2,3),
-(6204,46,53,16,2,41459,0,2),
-(6205,46,53,16,2,41459,1,2),
-(6206,46,53,16,2,41459,2,2),
-(6207,46,53,128,2,41459,0,7),
-(6208,46,53,128,2,41459,1,7),
-(6209,46,53,128,2,41459,2,7),
-(6210,46,53,256,2,41459,0,7),
-(6211,46,53,256,2,41459,1,7),
-(6212,46,53,256,2,41459,2,7),
-(6213,46,53,1024,2,41459,0,7),
-(6214,46,53,1024,2,41459,1,7),
-(6215,46,53,1024,2,41459,2,7),
-(6216,46,53,2048,2,41459,0,2),
-(6217,46,53,2048,2,41459,1,2),
-(6218,46,53,2048,2,41459,2,2),
-(6219,46,53,4096,2,41459,0,2),
-(6220,46,53,4096,2,41459,1,2),
-(6221,46,53,4096,2,41459,2,2),
-(6222,46,53,8192,2,41459,0,2),
-(6223,46,53,8192,2,41459,1,2),
-(6224,46,53,8192,2,41459,2,2),
-(6225,46,53,32,2,41459,0,5),
-(6226,46,53,32,2,41459,1,5),
-(6227,46,53,32,2,41459,2,5),
-(6228,46,53,512,2,41459,0,5),
-(6229,46,53,512,2,41459,1,5),
-(6230,46,53,512,2,41459,2,5),
-(6231,46,53,2,2,41459,0,4),
-(6232,46,53,2,2,41459,1,4),
-(6233,46,53,2,2,41459,2,4),
-(6234,54,59,0,2,41459,0,7),
-(6235,54,59,1,2,41459,0,3),
-(6236,54,59,1,2,41459,1,3),
-(6237,54,59,1,2,41459,2,3),
-(6238,54,59,16,2,41459,0,2),
-(6239,54,59,16,2,41459,1,2),
-(6240,54,59,16,2,41459,2,2),
-(6241,54,59,128,2,41459,0,7),
-(6242,54,59,128,2,41459,1,7),
-(6243,54,59,128,2,41459,2,7),
-(6244,54,59,256,2,41459,0,7),
-(6245,54,59,256,2,41459,1,7),
-(6246,54,59,256,2,41459,2,7),
-(6247,54,59,1024,2,41459,0,7),
-(6248,54,59,1024,2,41459,1,7),
-(6249,54,59,1024,2,41459,2,7),
-(6250,54,59,2048,2,41459,0,2),
-(6251,54,59,2048,2,41459,1,2),
-(6252,54,59,2048,2,41459,2,2),
-(6253,54,59,4096,2,41459,0,2),
-(6254,54,59,4096,2,41459,1,2),
-(6255,54,59,4096,2,41459,2,2),
-(6256,54,59,8192,2,41459,0,2),
-(6257,54,59,8192,2,41459,1,2),
-(6258,54,59,8192,2,41459,2,2),
-(6259,54,59,32,2,41459,0,5),
-(6260,54,59,32,2,41459,1,5),
-(6261,54,59,32,2,41459,2,5),
-(6262,54,59,512,2,41459,0,5),
-(6263,54,59,512,2,41459,1,5),
-(6264,54,59,512,2,41459,2,5),
-(6265,54,59,2,2,41459,0,4),
-(6266,54,59,2,2,41459,1,4),
-(6267,54,59,2,2,41459,2,4),
-(6268,30,42,0,2,327692,0,23),
-(6269,30,42,1,2,327692,0,3),
-(6270,30,42,1,2,327692,1,3),
-(6271,30,42,1,2,327692,2,3),
-(6272,30,42,16,2,327692,0,2),
-(6273,30,42,16,2,327692,1,2),
-(6274,30,42,16,2,327692,2,2),
-(6275,30,42,128,2,327692,0,23),
-(6276,30,42,128,2,327692,1,23),
-(6277,30,42,128,2,327692,2,23),
-(6278,30,42,256,2,327692,0,23),
-(6279,30,42,256,2,327692,1,23),
-(6280,30,42,256,2,327692,2,23),
-(6281,30,42,1024,2,327692,0,7),
-(6282,30,42,1024,2,327692,1,7),
-(6283,30,42,1024,2,327692,2,7),
-(6284,30,42,2048,2,327692,0,2),
-(6285,30,42,2048,2,327692,1,2),
-(6286,30,42,2048,2,327692,2,2),
-(6287,30,42,4096,2,327692,0,2),
-(6288,30,42,4096,2,327692,1,2),
-(6289,30,42,4096,2,327692,2,2),
-(6290,30,42,8192,2,327692,0,2),
-(6291,30,42,8192,2,327692,1,2),
-(6292,30,42,8192,2,327692,2,2),
-(6293,30,42,32,2,327692,0,21),
-(6294,30,42,32,2,327692,1,21),
-(6295,30,42,32,2,327692,2,21),
-(6296,30,42,512,2,327692,0,21),
-(6297,30,42,512,2,327692,1,21),
-(6298,30,42,512,2,327692,2,21),
-(6299,30,42,2,2,327692,0,20),
-(6300,30,42,2,2,327692,1,20),
-(6301,30,42,2,2,327692,2,20),
-(6302,40,58,0,2,327692,0,23),
-(6303,40,58,1,2,327692,0,3),
-(6304,40,58,1,2,327692,1,3),
-(6305,40,58,1,2,327692,2,3),
-(6306,40,58,16,2,327692,0,2),
-(6307,40,58,16,2,327692,1,2),
-(6308,40,58,16,2,327692,2,2),
-(6309,40,58,128,2,327692,0,23),
-(6310,40,58,128,2,327692,1,23),
-(6311,40,58,128,2,327692,2,23),
-(6312,40,58,256,2,327692,0,23),
-(6313,40,58,256,2,327692,1,23),
-(6314,40,58,256,2,327692,2,23),
-(6315,40,58,1024,2,327692,0,7),
-(6316,40,58,1024,2,327692,1,7),
-(6317,40,58,1024,2,327692,2,7),
-(6318,40,58,2048,2,327692,0,2),
-(6319,40,58,2048,2,327692,1,2),
-(6320,40,58,2048,2,327692,2,2),
-(6321,40,58,4096,2,327692,0,2),
-(6322,40,58,4096,2,327692,1,2),
-(6323,40,58,4096,2,327692,2,2),
-(6324,40,58,8192,2,327692,0,2),
-(6325,40,58,8192,2,327692,1,2),
-(6326,40,58,8192,2,327692,2,2),
-(6327,40,58,32,2,327692,0,21),
-(6328,40,58,32,2,327692,1,21),
-(6329,40,58,32,2,327692,2,21),
-(6330,40,58,512,2,327692,0,21),
-(6331,40,58,512,2,327692,1,21),
-(6332,40,58,512,2,327692,2,21),
-(6333,40,58,2,2,327692,0,20),
-(6334,40,58,2,2,327692,1,20),
-(6335,40,58,2,2,327692,2,20),
-(6336,32,39,0,2,41459,0,7),
-(6337,32,39,1,2,41459,0,3),
-(6338,32,39,1,2,41459,1,3),
-(6339,32,39,1,2,41459,2,3),
-(6340,32,39,16,2,41459,0,2),
-(6341,32,39,16,2,41459,1,2),
-(6342,32,39,16,2,41459,2,2),
-(6343,32,39,128,2,41459,0,7),
-(6344,32,39,128,2,41459,1,7),
-(6345,32,39,128,2,41459,2,7),
-(6346,32,39,256,2,41459,0,7),
-(6347,32,39,256,2,41459,1,7),
-(6348,32,39,256,2,41459,2,7),
-(6349,32,39,1024,2,41459,0,7),
-(6350,32,39,1024,2,41459,1,7),
-(6351,32,39,1024,2,41459,2,7),
-(6352,32,39,2048,2,41459,0,2),
-(6353,32,39,2048,2,41459,1,2),
-(6354,32,39,2048,2,41459,2,2),
-(6355,32,39,4096,2,41459,0,2),
-(6356,32,39,4096,2,41459,1,2),
-(6357,32,39,4096,2,41459,2,2),
-(6358,32,39,8192,2,41459,0,2),
-(6359,32,39,8192,2,41459,1,2),
-(6360,32,39,8192,2,41459,2,2),
-(6361,32,39,32,2,41459,0,5),
-(6362,32,39,32,2,41459,1,5),
-(6363,32,39,32,2,41459,2,5),
-(6364,32,39,512,2,41459,0,5),
-(6365,32,39,512,2,41459,1,5),
-(6366,32,39,512,2,41459,2,5),
-(6367,32,39,2,2,41459,0,4),
-(6368,32,39,2,2,41459,1,4),
-(6369,32,39,2,2,41459,2,4),
-(6370,40,47,0,2,41459,0,7),
-(6371,40,47,1,2,41459,0,3),
-(6372,40,47,1,2,41459,1,3),
-(6373,40,47,1,2,41459,2,3),
-(6374,40,47,16,2,41459,0,2),
-(6375,40,47,16,2,41459,1,2),
-(6376,40,47,16,2,41459,2,2),
-(6377,40,47,128,2,41459,0,7),
-(6378,40,47,128,2,41459,1,7),
-(6379,40,47,128,2,41459,2,7),
-(6380,40,47,256,2,41459,0,7),
-(6381,40,47,256,2,41459,1,7),
-(6382,40,47,256,2,41459,2,7),
-(6383,40,47,1024,2,41459,0,7),
-(6384,40,47,1024,2,41459,1,7),
-(6385,40,47,1024,2,41459,2,7),
-(6386,40,47,2048,2,41459,0,2),
-(6387,40,47,2048,2,41459,1,2),
-(6388,40,47,2048,2,41459,2,2),
-(6389,40,47,4096,2,41459,0,2),
-(6390,40,47,4096,2,41459,1,2),
-(6391,40,47,4096,2,41459,2,2),
-(6392,40,47,8192,2,41459,0,2),
-(6393,40,47,8192,2,41459,1,2),
-(6394,40,47,8192,2,41459,2,2),
-(6395,40,47,32,2,41459,0,5),
-(6396,40,47,32,2,41459,1,5),
-(6397,40,47,32,2,41459,2,5),
-(6398,40,47,512,2,41459,0,5),
-(6399,40,47,512,2,41459,1,5),
-(6400,40,47,512,2,41459,2,5),
-(6401,40,47,2,2,41459,0,4),
-(6402,40,47,2,2,41459,1,4),
-(6403,40,47,2,2,41459,2,4),
-(6404,48,55,0,2,41459,0,7),
-(6405,48,55,1,2,41459,0,3),
-(6406,48,55,1,2,41459,1,3),
-(6407,48,55,1,2,41459,2,3),
-(6408,48,55,16,2,41459,0,2),
-(6409,48,55,16,2,41459,1,2),
-(6410,48,55,16,2,41459,2,2),
-(6411,48,55,128,2,41459,0,7),
-(6412,48,55,128,2,41459,1,7),
-(6413,48,55,128,2,41459,2,7),
-(6414,48,55,256,2,41459,0,7),
-(6415,48,55,256,2,41459,1,7),
-(6416,48,55,256,2,41459,2,7),
-(6417,48,55,1024,2,41459,0,7),
-(6418,48,55,1024,2,41459,1,7),
-(6419,48,55,1024,2,41459,2,7),
-(6420,48,55,2048,2,41459,0,2),
-(6421,48,55,2048,2,41459,1,2),
-(6422,48,55,2048,2,41459,2,2),
-(6423,48,55,4096,2,41459,0,2),
-(6424,48,55,4096,2,41459,1,2),
-(6425,48,55,4096,2,41459,2,2),
-(6426,48,55,8192,2,41459,0,2),
-(6427,48,55,8192,2,41459,1,2),
-(6428,48,55,8192,2,41459,2,2),
-(6429,48,55,32,2,41459,0,5),
-(6430,48,55,32,2,41459,1,5),
-(6431,48,55,32,2,41459,2,5),
-(6432,48,55,512,2,41459,0,5),
-(6433,48,55,512,2,41459,1,5),
-(6434,48,55,512,2,41459,2,5),
-(6435,48,55,2,2,41459,0,4),
-(6436,48,55,2,2,41459,1,4),
-(6437,48,55,2,2,41459,2,4),
-(6438,56,63,0,2,41459,0,7),
-(6439,56,63,1,2,41459,0,3),
-(6440,56,63,1,2,41459,1,3),
-(6441,56,63,1,2,41459,2,3),
-(6442,56,63,16,2,41459,0,2),
-(6443,56,63,16,2,41459,1,2),
-(6444,56,63,16,2,41459,2,2),
-(6445,56,63,128,2,41459,0,7),
-(6446,56,63,128,2,41459,1,7),
-(6447,56,63,128,2,41459,2,7),
-(6448,56,63,256,2,41459,0,7),
-(6449,56,63,256,2,41459,1,7),
-(6450,56,63,256,2,41459,2,7),
-(6451,56,63,1024,2,41459,0,7),
-(6452,56,63,1024,2,41459,1,7),
-(6453,56,63,1024,2,41459,2,7),
-(6454,56,63,2048,2,41459,0,2),
-(6455,56,63,2048,2,41459,1,2),
-(6456,56,63,2048,2,41459,2,2),
-(6457,56,63,4096,2,41459,0,2),
-(6458,56,63,4096,2,41459,1,2),
-(6459,56,63,4096,2,41459,2,2),
-(6460,56,63,8192,2,41459,0,2),
-(6461,56,63,8192,2,41459,1,2),
-(6462,56,63,8192,2,41459,2,2),
-(6463,56,63,32,2,41459,0,5),
-(6464,56,63,32,2,41459,1,5),
-(6465,56,63,32,2,41459,2,5),
-(6466,56,63,512,2,41459,0,5),
-(6467,56,63,512,2,41459,1,5),
-(6468,56,63,512,2,41459,2,5),
-(6469,56,63,2,2,41459,0,4),
-(6470,56,63,2,2,41459,1,4),
-(6471,56,63,2,2,41459,2,4),
-(6472,6,20,0,2,41459,0,7),
-(6473,6,20,1,2,41459,0,3),
-(6474,6,20,1,2,41459,1,3),
-(6475,6,20,1,2,41459,2,3),
-(6476,6,20,16,2,41459,0,2),
-(6477,6,20,16,2,41459,1,2),
-(6478,6,20,16,2,41459,2,2),
-(6479,6,20,128,2,41459,0,7),
-(6480,6,20,128,2,41459,1,7),
-(6481,6,20,128,2,41459,2,7),
-(6482,6,20,256,2,41459,0,7),
-(6483,6,20,256,2,41459,1,7),
-(6484,6,20,256,2,41459,2,7),
-(6485,6,20,1024,2,41459,0,7),
-(6486,6,20,1024,2,41459,1,7),
-(6487,6,20,1024,2,41459,2,7),
-(6488,6,20,2048,2,41459,0,2),
-(6489,6,20,2048,2,41459,1,2),
-(6490,6,20,2048,2,41459,2,2),
-(6491,6,20,4096,2,41459,0,2),
-(6492,6,20,4096,2,41459,1,2),
-(6493,6,20,4096,2,41459,2,2),
-(6494,6,20,8192,2,41459,0,2),
-(6495,6,20,8192,2,41459,1,2),
-(6496,6,20,8192,2,41459,2,2),
-(6497,6,20,32,2,41459,0,5),
-(6498,6,20,32,2,41459,1,5),
-(6499,6,20,32,2,41459,2,5),
-(6500,6,20,512,2,41459,0,5),
-(6501,6,20,512,2,41459,1,5),
-(6502,6,20,512,2,41459,2,5),
-(6503,6,20,2,2,41459,0,4),
-(6504,6,20,2,2,41459,1,4),
-(6505,6,20,2,2,41459,2,4),
-(6506,30,65,0,2,41459,0,7),
-(6507,30,65,1,2,41459,0,3),
-(6508,30,65,1,2,41459,1,3),
-(6509,30,65,1,2,41459,2,3),
-(6510,30,65,16,2,41459,0,2),
-(6511,30,65,16,2,41459,1,2),
-(6512,30,65,16,2,41459,2,2),
-(6513,30,65,128,2,41459,0,7),
-(6514,30,65,128,2,41459,1,7),
-(6515,30,65,128,2,41459,2,7),
-(6516,30,65,256,2,41459,0,7),
-(6517,30,65,256,2,41459,1,7),
-(6518,30,65,256,2,41459,2,7),
-(6519,30,65,1024,2,41459,0,7),
-(6520,30,65,1024,2,41459,1,7),
-(6521,30,65,1024,2,41459,2,7),
-(6522,30,65,2048,2,41459,0,2),
-(6523,30,65,2048,2,41459,1,2),
-(6524,30,65,2048,2,41459,2,2),
-(6525,30,65,4096,2,41459,0,2),
-(6526,30,65,4096,2,41459,1,2),
-(6527,30,65,4096,2,41459,2,2),
-(6528,30,65,8192,2,41459,0,2),
-(6529,30,65,8192,2,41459,1,2),
-(6530,30,65,8192,2,41459,2,2),
-(6531,30,65,32,2,41459,0,5),
-(6532,30,65,32,2,41459,1,5),
-(6533,30,65,32,2,41459,2,5),
-(6534,30,65,512,2,41459,0,5),
-(6535,30,65,512,2,41459,1,5),
-(6536,30,65,512,2,41459,2,5),
-(6537,30,65,2,2,41459,0,4),
-(6538,30,65,2,2,41459,1,4),
-(6539,30,65,2,2,41459,2,4),
-(6540,38,59,0,2,41459,0,7),
-(6541,38,59,1,2,41459,0,3),
-(6542,38,59,1,2,41459,1,3),
-(6543,38,59,1,2,41459,2,3),
-(6544,38,59,16,2,41459,0,2),
-(6545,38,59,16,2,41459,1,2),
-(6546,38,59,16,2,41459,2,2),
-(6547,38,59,128,2,41459,0,7),
-(6548,38,59,128,2,41459,1,7),
-(6549,38,59,128,2,41459,2,7),
-(6550,38,59,256,2,41459,0,7),
-(6551,38,59,256,2,41459,1,7),
-(6552,38,59,256,2,41459,2,7),
-(6553,38,59,1024,2,41459,0,7),
-(6554,38,59,1024,2,41459,1,7),
-(6555,38,59,1024,2,41459,2,7),
-(6556,38,59,2048,2,41459,0,2),
-(6557,38,59,2048,2,41459,1,2),
-(6558,38,59,2048,2,41459,2,2),
-(6559,38,59,4096,2,41459,0,2),
-(6560,38,59,4096,2,41459,1,2),
-(6561,38,59,4096,2,41459,2,2),
-(6562,38,59,8192,2,41459,0,2),
-(6563,38,59,8192,2,41459,1,2),
-(6564,38,59,8192,2,41459,2,2),
-(6565,38,59,32,2,41459,0,5),
-(6566,38,59,32,2,41459,1,5),
-(6567,38,59,32,2,41459,2,5),
-(6568,38,59,512,2,41459,0,5),
-(6569,38,59,512,2,41459,1,5),
-(6570,38,59,512,2,41459,2,5),
-(6571,38,59,2,2,41459,0,4),
-(6572,38,59,2,2,41459,1,4),
-(6573,38,59,2,2,41459,2,4),
-(6574,35,44,0,2,164291,0,7),
-(6575,35,44,1,2,164291,0,3),
-(6576,35,44,1,2,164291,1,3),
-(6577,35,44,1,2,164291,2,3),
-(6578,35,44,16,2,164291,0,2),
-(6579,35,44,16,2,164291,1,2),
-(6580,35,44,16,2,164291,2,2),
-(6581,35,44,128,2,164291,0,7),
-(6582,35,44,128,2,164291,1,7),
-(6583,35,44,128,2,164291,2,7),
-(6584,35,44,256,2,164291,0,7),
-(6585,35,44,256,2,164291,1,7),
-(6586,35,44,256,2,164291,2,7),
-(6587,35,44,1024,2,164291,0,7),
-(6588,35,44,1024,2,164291,1,7),
-(6589,35,44,1024,2,164291,2,7),
-(6590,35,44,2048,2,164291,0,2),
-(6591,35,44,2048,2,164291,1,2),
-(6592,35,44,2048,2,164291,2,2),
-(6593,35,44,4096,2,164291,0,2),
-(6594,35,44,4096,2,164291,1,2),
-(6595,35,44,4096,2,164291,2,2),
-(6596,35,44,8192,2,164291,0,2),
-(6597,35,44,8192,2,164291,1,2),
-(6598,35,44,8192,2,164291,2,2),
-(6599,35,44,32,2,164291,0,5),
-(6600,35,44,32,2,164291,1,5),
-(6601,35,44,32,2,164291,2,5),
-(6602,35,44,512,2,164291,0,5),
-(6603,35,44,512,2,164291,1,5),
-(6604,35,44,512,2,164291,2,5),
-(6605,35,44,2,2,164291,0,4),
-(6606,35,44,2,2,164291,1,4),
-(6607,35,44,2,2,164291,2,4),
-(6608,46,55,0,2,41459,0,39),
-(6609,46,55,1,2,41459,0,3),
-(6610,46,55,1,2,41459,1,3),
-(6611,46,55,1,2,41459,2,3),
-(6612,46,55,16,2,41459,0,2),
-(6613,46,55,16,2,41459,1,2),
-(6614,46,55,16,2,41459,2,2),
-(6615,46,55,128,2,41459,0,39),
-(6616,46,55,128,2,41459,1,39),
-(6617,46,55,128,2,41459,2,39),
-(6618,46,55,256,2,41459,0,39),
-(6619,46,55,256,2,41459,1,39),
-(6620,46,55,256,2,41459,2,39),
-(6621,46,55,1024,2,41459,0,7),
-(6622,46,55,1024,2,41459,1,7),
-(6623,46,55,1024,2,41459,2,7),
-(6624,46,55,2048,2,41459,0,2),
-(6625,46,55,2048,2,41459,1,2),
-(6626,46,55,2048,2,41459,2,2),
-(6627,46,55,4096,2,41459,0,2),
-(6628,46,55,4096,2,41459,1,2),
-(6629,46,55,4096,2,41459,2,2),
-(6630,46,55,8192,2,41459,0,2),
-(6631,46,55,8192,2,41459,1,2),
-(6632,46,55,8192,2,41459,2,2),
-(6633,46,55,32,2,41459,0,5),
-(6634,46,55,32,2,41459,1,5),
-(6635,46,55,32,2,41459,2,5),
-(6636,46,55,512,2,41459,0,37),
-(6637,46,55,512,2,41459,1,37),
-(6638,46,55,512,2,41459,2,37),
-(6639,46,55,2,2,41459,0,4),
-(6640,46,55,2,2,41459,1,4),
-(6641,46,55,2,2,41459,2,4),
-(6642,46,55,4,2,41459,0,32),
-(6643,46,55,4,2,41459,1,32),
-(6644,46,55,4,2,41459,2,32),
-(6645,46,55,8,2,41459,0,32),
-(6646,46,55,8,2,41459,1,32),
-(6647,46,55,8,2,41459,2,32),
-(6648,46,55,64,2,41459,0,32),
-(6649,46,55,64,2,41459,1,32),
-(6650,46,55,64,2,41459,2,32),
-(6651,56,63,0,2,41459,0,39),
-(6652,56,63,1,2,41459,0,3),
-(6653,56,63,1,2,41459,1,3),
-(6654,56,63,1,2,41459,2,3),
-(6655,56,63,16,2,41459,0,2),
-(6656,56,63,16,2,41459,1,2),
-(6657,56,63,16,2,41459,2,2),
-(6658,56,63,128,2,41459,0,39),
-(6659,56,63,128,2,41459,1,39),
-(6660,56,63,128,2,41459,2,39),
-(6661,56,63,256,2,41459,0,39),
-(6662,56,63,256,2,41459,1,39),
-(6663,56,63,256,2,41459,2,39),
-(6664,56,63,1024,2,41459,0,7),
-(6665,56,63,1024,2,41459,1,7),
-(6666,56,63,1024,2,41459,2,7),
-(6667,56,63,2048,2,41459,0,2),
-(6668,56,63,2048,2,41459,1,2),
-(6669,56,63,2048,2,41459,2,2),
-(6670,56,63,4096,2,41459,0,2),
-(6671,56,63,4096,2,41459,1,2),
-(6672,56,63,4096,2,41459,2,2),
-(6673,56,63,8192,2,41459,0,2),
-(6674,56,63,8192,2,41459,1,2),
-(6675,56,63,8192,2,41459,2,2),
-(6676,56,63,32,2,41459,0,5),
-(6677,56,63,32,2,41459,1,5),
-(6678,56,63,32,2,41459,2,5),
-(6679,56,63,512,2,41459,0,37),
-(6680,56,63,512,2,41459,1,37),
-(6681,56,63,512,2,41459,2,37),
-(6682,56,63,2,2,41459,0,4),
-(6683,56,63,2,2,41459,1,4),
-(6684,56,63,2,2,41459,2,4),
-(6685,56,63,4,2,41459,0,32),
-(6686,56,63,4,2,41459,1,32),
-(6687,56,63,4,2,41459,2,32),
-(6688,56,63,8,2,41459,0,32),
-(6689,56,63,8,2,41459,1,32),
-(6690,56,63,8,2,41459,2,32),
-(6691,56,63,64,2,41459,0,32),
-(6692,56,63,64,2,41459,1,32),
-(6693,56,63,64,2,41459,2,32),
-(6694,48,57,0,2,41459,0,7),
-(6695,48,57,1,2,41459,0,3),
-(6696,48,57,1,2,41459,1,3),
-(6697,48,57,1,2,41459,2,3),
-(6698,48,57,16,2,41459,0,2),
-(6699,48,57,16,2,41459,1,2),
-(6700,48,57,16,2,41459,2,2),
-(6701,48,57,128,2,41459,0,7),
-(6702,48,57,128,2,41459,1,7),
-(6703,48,57,128,2,41459,2,7),
-(6704,48,57,256,2,41459,0,7),
-(6705,48,57,256,2,41459,1,7),
-(6706,48,57,256,2,41459,2,7),
-(6707,48,57,1024,2,41459,0,7),
-(6708,48,57,1024,2,41459,1,7),
-(6709,48,57,1024,2,41459,2,7),
-(6710,48,57,2048,2,41459,0,2),
-(6711,48,57,2048,2,41459,1,2),
-(6712,48,57,2048,2,41459,2,2),
-(6713,48,57,4096,2,41459,0,2),
-(6714,48,57,4096,2,41459,1,2),
-(6715,48,57,4096,2,41459,2,2),
-(6716,48,57,8192,2,41459,0,2),
-(6717,48,57,8192,2,41459,1,2),
-(6718,48,57,8192,2,41459,2,2),
-(6719,48,57,32,2,41459,0,5),
-(6720,48,57,32,2,41459,1,5),
-(6721,48,57,32,2,41459,2,5),
-(6722,48,57,512,2,41459,0,5),
-(6723,48,57,512,2,41459,1,5),
-(6724,48,57,512,2,41459,2,5),
-(6725,48,57,2,2,41459,0,4),
-(6726,48,57,2,2,41459,1,4),
-(6727,48,57,2,2,41459,2,4),
-(6728,58,65,0,2,41459,0,7),
-(6729,58,65,1,2,41459,0,3),
-(6730,58,65,1,2,41459,1,3),
-(6731,58,65,1,2,41459,2,3),
-(6732,58,65,16,2,41459,0,2),
-(6733,58,65,16,2,41459,1,2),
-(6734,58,65,16,2,41459,2,2),
-(6735,58,65,128,2,41459,0,7),
-(6736,58,65,128,2,41459,1,7),
-(6737,58,65,128,2,41459,2,7),
-(6738,58,65,256,2,41459,0,7),
-(6739,58,65,256,2,41459,1,7),
-(6740,58,65,256,2,41459,2,7),
-(6741,58,65,1024,2,41459,0,7),
-(6742,58,65,1024,2,41459,1,7),
-(6743,58,65,1024,2,41459,2,7),
-(6744,58,65,2048,2,41459,0,2),
-(6745,58,65,2048,2,41459,1,2),
-(6746,58,65,2048,2,41459,2,2),
-(6747,58,65,4096,2,41459,0,2),
-(6748,58,65,4096,2,41459,1,2),
-(6749,58,65,4096,2,41459,2,2),
-(6750,58,65,8192,2,41459,0,2),
-(6751,58,65,8192,2,41459,1,2),
-(6752,58,65,8192,2,41459,2,2),
-(6753,58,65,32,2,41459,0,5),
-(6754,58,65,32,2,41459,1,5),
-(6755,58,65,32,2,41459,2,5),
-(6756,58,65,512,2,41459,0,5),
-(6757,58,65,512,2,41459,1,5),
-(6758,58,65,512,2,41459,2,5),
-(6759,58,65,2,2,41459,0,4),
-(6760,58,65,2,2,41459,1,4),
-(6761,58,65,2,2,41459,2,4),
-(6762,60,67,0,2,41459,0,7),
-(6763,60,67,1,2,41459,0,3),
-(6764,60,67,1,2,41459,1,3),
-(6765,60,67,1,2,41459,2,3),
-(6766,60,67,16,2,41459,0,2),
-(6767,60,67,16,2,41459,1,2),
-(6768,60,67,16,2,41459,2,2),
-(6769,60,67,128,2,41459,0,7),
-(6770,60,67,128,2,41459,1,7),
-(6771,60,67,128,2,41459,2,7),
-(6772,60,67,256,2,41459,0,7),
-(6773,60,67,256,2,41459,1,7),
-(6774,60,67,256,2,41459,2,7),
-(6775,60,67,1024,2,41459,0,7),
-(6776,60,67,1024,2,41459,1,7),
-(6777,60,67,1024,2,41459,2,7),
-(6778,60,67,2048,2,41459,0,2),
-(6779,60,67,2048,2,41459,1,2),
-(6780,60,67,2048,2,41459,2,2),
-(6781,60,67,4096,2,41459,0,2),
-(6782,60,67,4096,2,41459,1,2),
-(6783,60,67,4096,2,41459,2,2),
-(6784,60,67,8192,2,41459,0,2),
-(6785,60,67,8192,2,41459,1,2),
-(6786,60,67,8192,2,41459,2,2),
-(6787,60,67,32,2,41459,0,5),
-(6788,60,67,32,2,41459,1,5),
-(6789,60,67,32,2,41459,2,5),
-(6790,60,67,512,2,41459,0,5),
-(6791,60,67,512,2,41459,1,5),
-(6792,60,67,512,2,41459,2,5),
-(6793,60,67,2,2,41459,0,4),
-(6794,60,67,2,2,41459,1,4),
-(6795,60,67,2,2,41459,2,4),
-(6796,35,44,0,2,9264,0,7),
-(6797,35,44,1,2,9264,0,3),
-(6798,35,44,1,2,9264,1,3),
-(6799,35,44,1,2,9264,2,3),
-(6800,35,44,16,2,9264,0,2),
-(6801,35,44,16,2,9264,1,2),
-(6802,35,44,16,2,9264,2,2),
-(6803,35,44,128,2,9264,0,7),
-(6804,35,44,128,2,9264,1,7),
-(6805,35,44,128,2,9264,2,7),
-(6806,35,44,256,2,9264,0,7),
-(6807,35,44,256,2,9264,1,7),
-(6808,35,44,256,2,9264,2,7),
-(6809,35,44,1024,2,9264,0,7),
-(6810,35,44,1024,2,9264,1,7),
-(6811,35,44,1024,2,9264,2,7),
-(6812,35,44,2048,2,9264,0,2),
-(6813,35,44,2048,2,9264,1,2),
-(6814,35,44,2048,2,9264,2,2),
-(6815,35,44,4096,2,9264,0,2),
-(6816,35,44,4096,2,9264,1,2),
-(6817,35,44,4096,2,9264,2,2),
-(6818,35,44,8192,2,9264,0,2),
-(6819,35,44,8192,2,9264,1,2),
-(6820,35,44,8192,2,9264,2,2),
-(6821,35,44,32,2,9264,0,5),
-(6822,35,44,32,2,9264,1,5),
-(6823,35,44,32,2,9264,2,5),
-(6824,35,44,512,2,9264,0,5),
-(6825,35,44,512,2,9264,1,5),
-(6826,35,44,512,2,9264,2,5),
-(6827,35,44,2,2,9264,0,4),
-(6828,35,44,2,2,9264,1,4),
-(6829,35,44,2,2,9264,2,4),
-(6830,1,60,0,2,41459,0,7),
-(6831,1,60,1,2,41459,0,3),
-(6832,1,60,1,2,41459,1,3),
-(6833,1,60,1,2,41459,2,3),
-(6834,1,60,16,2,41459,0,2),
-(6835,1,60,16,2,41459,1,2),
-(6836,1,60,16,2,41459,2,2),
-(6837,1,60,128,2,41459,0,7),
-(6838,1,60,128,2,41459,1,7),
-(6839,1,60,128,2,41459,2,7),
-(6840,1,60,256,2,41459,0,7),
-(6841,1,60,256,2,41459,1,7),
-(6842,1,60,256,2,41459,2,7),
-(6843,1,60,1024,2,41459,0,7),
-(6844,1,60,1024,2,41459,1,7),
-(6845,1,60,1024,2,41459,2,7),
-(6846,1,60,2048,2,41459,0,2),
-(6847,1,60,2048,2,41459,1,2),
-(6848,1,60,2048,2,41459,2,2),
-(6849,1,60,4096,2,41459,0,2),
-(6850,1,60,4096,2,41459,1,2),
-(6851,1,60,4096,2,41459,2,2),
-(6852,1,60,8192,2,41459,0,2),
-(6853,1,60,8192,2,41459,1,2),
-(6854,1,60,8192,2,41459,2,2),
-(6855,1,60,32,2,41459,0,5),
-(6856,1,60,32,2,41459,1,5),
-(6857,1,60,32,2,41459,2,5),
-(6858,1,60,512,2,41459,0,5),
-(6859,1,60,512,2,41459,1,5),
-(6860,1,60,512,2,41459,2,5),
-(6861,1,60,2,2,41459,0,4),
-(6862,1,60,2,2,41459,1,4),
-(6863,1,60,2,2,41459,2,4),
-(6864,29,35,0,2,41459,0,7),
-(6865,29,35,1,2,41459,0,3),
-(6866,29,35,1,2,41459,1,3),
-(6867,29,35,1,2,41459,2,3),
-(6868,29,35,16,2,41459,0,2),
-(6869,29,35,16,2,41459,1,2),
-(6870,29,35,16,2,41459,2,2),
-(6871,29,35,128,2,41459,0,7),
-(6872,29,35,128,2,41459,1,7),
-(6873,29,35,128,2,41459,2,7),
-(6874,29,35,256,2,41459,0,7),
-(6875,29,35,256,2,41459,1,7),
-(6876,29,35,256,2,41459,2,7),
-(6877,29,35,1024,2,41459,0,7),
-(6878,29,35,1024,2,41459,1,7),
-(6879,29,35,1024,2,41459,2,7),
-(6880,29,35,2048,2,41459,0,2),
-(6881,29,35,2048,2,41459,1,2),
-(6882,29,35,2048,2,41459,2,2),
-(6883,29,35,4096,2,41459,0,2),
-(6884,29,35,4096,2,41459,1,2),
-(6885,29,35,4096,2,41459,2,2),
-(6886,29,35,8192,2,41459,0,2),
-(6887,29,35,8192,2,41459,1,2),
-(6888,29,35,8192,2,41459,2,2),
-(6889,29,35,32,2,41459,0,5),
-(6890,29,35,32,2,41459,1,5),
-(6891,29,35,32,2,41459,2,5),
-(6892,29,35,512,2,41459,0,5),
-(6893,29,35,512,2,41459,1,5),
-(6894,29,35,512,2,41459,2,5),
-(6895,29,35,2,2,41459,0,4),
-(6896,29,35,2,2,41459,1,4),
-(6897,29,35,2,2,41459,2,4),
-(6898,1,60,0,2,41459,0,7),
-(6899,1,60,1,2,41459,0,3),
-(6900,1,60,1,2,41459,1,3),
-(6901,1,60,1,2,41459,2,3),
-(6902,1,60,16,2,41459,0,2),
-(6903,1,60,16,2,41459,1,2),
-(6904,1,60,16,2,41459,2,2),
-(6905,1,60,128,2,41459,0,7),
-(6906,1,60,128,2,41459,1,7),
-(6907,1,60,128,2,41459,2,7),
-(6908,1,60,256,2,41459,0,7),
-(6909,1,60,256,2,41459,1,7),
-(6910,1,60,256,2,41459,2,7),
-(6911,1,60,1024,2,41459,0,7),
-(6912,1,60,1024,2,41459,1,7),
-(6913,1,60,1024,2,41459,2,7),
-(6914,1,60,2048,2,41459,0,2),
-(6915,1,60,2048,2,41459,1,2),
-(6916,1,60,2048,2,41459,2,2),
-(6917,1,60,4096,2,41459,0,2),
-(6918,1,60,4096,2,41459,1,2),
-(6919,1,60,4096,2,41459,2,2),
-(6920,1,60,8192,2,41459,0,2),
-(6921,1,60,8192,2,41459,1,2),
-(6922,1,60,8192,2,41459,2,2),
-(6923,1,60,32,2,41459,0,5),
-(6924,1,60,32,2,41459,1,5),
-(6925,1,60,32,2,41459,2,5),
-(6926,1,60,512,2,41459,0,5),
-(6927,1,60,512,2,41459,1,5),
-(6928,1,60,512,2,41459,2,5),
-(6929,1,60,2,2,41459,0,4),
-(6930,1,60,2,2,41459,1,4),
-(6931,1,60,2,2,41459,2,4),
-(6932,1,60,0,2,41459,0,7),
-(6933,1,60,1,2,41459,0,3),
-(6934,1,60,1,2,41459,1,3),
-(6935,1,60,1,2,41459,2,3),
-(6936,1,60,16,2,41459,0,2),
-(6937,1,60,16,2,41459,1,2),
-(6938,1,60,16,2,41459,2,2),
-(6939,1,60,128,2,41459,0,7),
-(6940,1,60,128,2,41459,1,7),
-(6941,1,60,128,2,41459,2,7),
-(6942,1,60,256,2,41459,0,7),
-(6943,1,60,256,2,41459,1,7),
-(6944,1,60,256,2,41459,2,7),
-(6945,1,60,1024,2,41459,0,7),
-(6946,1,60,1024,2,41459,1,7),
-(6947,1,60,1024,2,41459,2,7),
-(6948,1,60,2048,2,41459,0,2),
-(6949,1,60,2048,2,41459,1,2),
-(6950,1,60,2048,2,41459,2,2),
-(6951,1,60,4096,2,41459,0,2),
-(6952,1,60,4096,2,41459,1,2),
-(6953,1,60,4096,2,41459,2,2),
-(6954,1,60,8192,2,41459,0,2),
-(6955,1,60,8192,2,41459,1,2),
-(6956,1,60,8192,2,41459,2,2),
-(6957,1,60,32,2,41459,0,5),
-(6958,1,60,32,2,41459,1,5),
-(6959,1,60,32,2,41459,2,5),
-(6960,1,60,512,2,41459,0,5),
-(6961,1,60,512,2,41459,1,5),
-(6962,1,60,512,2,41459,2,5),
-(6963,1,60,2,2,41459,0,4),
-(6964,1,60,2,2,41459,1,4),
-(6965,1,60,2,2,41459,2,4),
-(6966,1,70,0,2,41459,0,7),
-(6967,1,70,1,2,41459,0,3),
-(6968,1,70,1,2,41459,1,3),
-(6969,1,70,1,2,41459,2,3),
-(6970,1,70,16,2,41459,0,2),
-(6971,1,70,16,2,41459,1,2),
-(6972,1,70,16,2,41459,2,2),
-(6973,1,70,128,2,41459,0,7),
-(6974,1,70,128,2,41459,1,7),
-(6975,1,70,128,2,41459,2,7),
-(6976,1,70,256,2,41459,0,7),
-(6977,1,70,256,2,41459,1,7),
-(6978,1,70,256,2,41459,2,7),
-(6979,1,70,1024,2,41459,0,7),
-(6980,1,70,1024,2,41459,1,7),
-(6981,1,70,1024,2,41459,2,7),
-(6982,1,70,2048,2,41459,0,2),
-(6983,1,70,2048,2,41459,1,2),
-(6984,1,70,2048,2,41459,2,2),
-(6985,1,70,4096,2,41459,0,2),
-(6986,1,70,4096,2,41459,1,2),
-(6987,1,70,4096,2,41459,2,2),
-(6988,1,70,8192,2,41459,0,2),
-(6989,1,70,8192,2,41459,1,2),
-(6990,1,70,8192,2,41459,2,2),
-(6991,1,70,32,2,41459,0,5),
-(6992,1,70,32,2,41459,1,5),
-(6993,1,70,32,2,41459,2,5),
-(6994,1,70,512,2,41459,0,5),
-(6995,1,70,512,2,41459,1,5),
-(6996,1,70,512,2,41459,2,5),
-(6997,1,70,2,2,41459,0,4),
-(6998,1,70,2,2,41459,1,4),
-(6999,1,70,2,2,41459,2,4),
-(7000,60,61,0,2,41459,0,7),
-(7001,60,61,1,2,41459,0,3),
-(7002,60,61,1,2,41459,1,3),
-(7003,60,61,1,2,41459,2,3),
-(7004,60,61,16,2,41459,0,2),
-(7005,60,61,16,2,41459,1,2),
-(7006,60,61,16,2,41459,2,2),
-(7007,60,61,128,2,41459,0,7),
-(7008,60,61,128,2,41459,1,7),
-(7009,60,61,128,2,41459,2,7),
-(7010,60,61,256,2,41459,0,7),
-(7011,60,61,256,2,41459,1,7),
-(7012,60,61,256,2,41459,2,7),
-(7013,60,61,1024,2,41459,0,7),
-(7014,60,61,1024,2,41459,1,7),
-(7015,60,61,1024,2,41459,2,7),
-(7016,60,61,2048,2,41459,0,2),
-(7017,60,61,2048,2,41459,1,2),
-(7018,60,61,2048,2,41459,2,2),
-(7019,60,61,4096,2,41459,0,2),
-(7020,60,61,4096,2,41459,1,2),
-(7021,60,61,4096,2,41459,2,2),
-(7022,60,61,8192,2,41459,0,2),
-(7023,60,61,8192,2,41459,1,2),
-(7024,60,61,8192,2,41459,2,2),
-(7025,60,61,32,2,41459,0,5),
-(7026,60,61,32,2,41459,1,5),
-(7027,60,61,32,2,41459,2,5),
-(7028,60,61,512,2,41459,0,5),
-(7029,60,61,512,2,41459,1,5),
-(7030,60,61,512,2,41459,2,5),
-(7031,60,61,2,2,41459,0,4),
-(7032,60,61,2,2,41459,1,4),
-(7033,60,61,2,2,41459,2,4),
-(7034,64,70,0,2,41459,0,39),
-(7035,64,70,1,2,41459,0,3),
-(7036,64,70,1,2,41459,1,3),
-(7037,64,70,1,2,41459,2,3),
-(7038,64,70,16,2,41459,0,2),
-(7039,64,70,16,2,41459,1,2),
-(7040,64,70,16,2,41459,2,2),
-(7041,64,70,128,2,41459,0,39),
-(7042,64,70,128,2,41459,1,39),
-(7043,64,70,128,2,41459,2,39),
-(7044,64,70,256,2,41459,0,39),
-(7045,64,70,256,2,41459,1,39),
-(7046,64,70,256,2,41459,2,39),
-(7047,64,70,1024,2,41459,0,7),
-(7048,64,70,1024,2,41459,1,7),
-(7049,64,70,1024,2,41459,2,7),
-(7050,64,70,2048,2,41459,0,2),
-(7051,64,70,2048,2,41459,1,2),
-(7052,64,70,2048,2,41459,2,2),
-(7053,64,70,4096,2,41459,0,2),
-(7054,64,70,4096,2,41459,1,2),
-(7055,64,70,4096,2,41459,2,2),
-(7056,64,70,8192,2,41459,0,2),
-(7057,64,70,8192,2,41459,1,2),
-(7058,64,70,8192,2,41459,2,2),
-(7059,64,70,32,2,41459,0,5),
-(7060,64,70,32,2,41459,1,5),
-(7061,64,70,32,2,41459,2,5),
-(7062,64,70,512,2,41459,0,37),
-(7063,64,70,512,2,41459,1,37),
-(7064,64,70,512,2,41459,2,37),
-(7065,64,70,2,2,41459,0,4),
-(7066,64,70,2,2,41459,1,4),
-(7067,64,70,2,2,41459,2,4),
-(7068,64,70,4,2,41459,0,32),
-(7069,64,70,4,2,41459,1,32),
-(7070,64,70,4,2,41459,2,32),
-(7071,64,70,8,2,41459,0,32),
-(7072,64,70,8,2,41459,1,32),
-(7073,64,70,8,2,41459,2,32),
-(7074,64,70,64,2,41459,0,32),
-(7075,64,70,64,2,41459,1,32),
-(7076,64,70,64,2,41459,2,32),
-(7077,66,70,0,2,41459,0,7),
-(7078,66,70,1,2,41459,0,3),
-(7079,66,70,1,2,41459,1,3),
-(7080,66,70,1,2,41459,2,3),
-(7081,66,70,16,2,41459,0,2),
-(7082,66,70,16,2,41459,1,2),
-(7083,66,70,16,2,41459,2,2),
-(7084,66,70,128,2,41459,0,7),
-(7085,66,70,128,2,41459,1,7),
-(7086,66,70,128,2,41459,2,7),
-(7087,66,70,256,2,41459,0,7),
-(7088,66,70,256,2,41459,1,7),
-(7089,66,70,256,2,41459,2,7),
-(7090,66,70,1024,2,41459,0,7),
-(7091,66,70,1024,2,41459,1,7),
-(7092,66,70,1024,2,41459,2,7),
-(7093,66,70,2048,2,41459,0,2),
-(7094,66,70,2048,2,41459,1,2),
-(7095,66,70,2048,2,41459,2,2),
-(7096,66,70,4096,2,41459,0,2),
-(7097,66,70,4096,2,41459,1,2),
-(7098,66,70,4096,2,41459,2,2),
-(7099,66,70,8192,2,41459,0,2),
-(7100,66,70,8192,2,41459,1,2),
-(7101,66,70,8192,2,41459,2,2),
-(7102,66,70,32,2,41459,0,5),
-(7103,66,70,32,2,41459,1,5),
-(7104,66,70,32,2,41459,2,5),
-(7105,66,70,512,2,41459,0,5),
-(7106,66,70,512,2,41459,1,5),
-(7107,66,70,512,2,41459,2,5),
-(7108,66,70,2,2,41459,0,4),
-(7109,66,70,2,2,41459,1,4),
-(7110,66,70,2,2,41459,2,4),
-(7111,68,70,0,2,41459,0,7),
-(7112,68,70,1,2,41459,0,3),
-(7113,68,70,1,2,41459,1,3),
-(7114,68,70,1,2,41459,2,3),
-(7115,68,70,16,2,41459,0,2),
-(7116,68,70,16,2,41459,1,2),
-(7117,68,70,16,2,41459,2,2),
-(7118,68,70,128,2,41459,0,7),
-(7119,68,70,128,2,41459,1,7),
-(7120,68,70,128,2,41459,2,7),
-(7121,68,70,256,2,41459,0,7),
-(7122,68,70,256,2,41459,1,7),
-(7123,68,70,256,2,41459,2,7),
-(7124,68,70,1024,2,41459,0,7),
-(7125,68,70,1024,2,41459,1,7),
-(7126,68,70,1024,2,41459,2,7),
-(7127,68,70,2048,2,41459,0,2),
-(7128,68,70,2048,2,41459,1,2),
-(7129,68,70,2048,2,41459,2,2),
-(7130,68,70,4096,2,41459,0,2),
-(7131,68,70,4096,2,41459,1,2),
-(7132,68,70,4096,2,41459,2,2),
-(7133,68,70,8192,2,41459,0,2),
-(7134,68,70,8192,2,41459,1,2),
-(7135,68,70,8192,2,41459,2,2),
-(7136,68,70,32,2,41459,0,5),
-(7137,68,70,32,2,41459,1,5),
-(7138,68,70,32,2,41459,2,5),
-(7139,68,70,512,2,41459,0,5),
-(7140,68,70,512,2,41459,1,5),
-(7141,68,70,512,2,41459,2,5),
-(7142,68,70,2,2,41459,0,4),
-(7143,68,70,2,2,41459,1,4),
-(7144,68,70,2,2,41459,2,4),
-(7145,68,76,0,2,41459,0,7),
-(7146,68,76,1,2,41459,0,3),
-(7147,68,76,1,2,41459,1,3),
-(7148,68,76,1,2,41459,2,3),
-(7149,68,76,16,2,41459,0,2),
-(7150,68,76,16,2,41459,1,2),
-(7151,68,76,16,2,41459,2,2),
-(7152,68,76,128,2,41459,0,7),
-(7153,68,76,128,2,41459,1,7),
-(7154,68,76,128,2,41459,2,7),
-(7155,68,76,256,2,41459,0,7),
-(7156,68,76,256,2,41459,1,7),
-(7157,68,76,256,2,41459,2,7),
-(7158,68,76,1024,2,41459,0,7),
-(7159,68,76,1024,2,41459,1,7),
-(7160,68,76,1024,2,41459,2,7),
-(7161,68,76,2048,2,41459,0,2),
-(7162,68,76,2048,2,41459,1,2),
-(7163,68,76,2048,2,41459,2,2),
-(7164,68,76,4096,2,41459,0,2),
-(7165,68,76,4096,2,41459,1,2),
-(7166,68,76,4096,2,41459,2,2),
-(7167,68,76,8192,2,41459,0,2),
-(7168,68,76,8192,2,41459,1,2),
-(7169,68,76,8192,2,41459,2,2),
-(7170,68,76,32,2,41459,0,5),
-(7171,68,76,32,2,41459,1,5),
-(7172,68,76,32,2,41459,2,5),
-(7173,68,76,512,2,41459,0,5),
-(7174,68,76,512,2,41459,1,5),
-(7175,68,76,512,2,41459,2,5),
-(7176,68,76,2,2,41459,0,4),
-(7177,68,76,2,2,41459,1,4),
-(7178,68,76,2,2,41459,2,4),
-(7179,68,72,0,2,41459,0,7),
-(7180,68,72,1,2,41459,0,3),
-(7181,68,72,1,2,41459,1,3),
-(7182,68,72,1,2,41459,2,3),
-(7183,68,72,16,2,41459,0,2),
-(7184,68,72,16,2,41459,1,2),
-(7185,68,72,16,2,41459,2,2),
-(7186,68,72,128,2,41459,0,7),
-(7187,68,72,128,2,41459,1,7),
-(7188,68,72,128,2,41459,2,7),
-(7189,68,72,256,2,41459,0,7),
-(7190,68,72,256,2,41459,1,7),
-(7191,68,72,256,2,41459,2,7),
-(7192,68,72,1024,2,41459,0,7),
-(7193,68,72,1024,2,41459,1,7),
-(7194,68,72,1024,2,41459,2,7),
-(7195,68,72,2048,2,41459,0,2),
-(7196,68,72,2048,2,41459,1,2),
-(7197,68,72,2048,2,41459,2,2),
-(7198,68,72,4096,2,41459,0,2),
-(7199,68,72,4096,2,41459,1,2),
-(7200,68,72,4096,2,41459,2,2),
-(7201,68,72,8192,2,41459,0,2),
-(7202,68,72,8192,2,41459,1,2),
-(7203,68,72,8192,2,41459,2,2),
-(7204,68,72,32,2,41459,0,5),
-(7205,68,72,32,2,41459,1,5),
-(7206,68,72,32,2,41459,2,5),
-(7207,68,72,512,2,41459,0,5),
-(7208,68,72,512,2,41459,1,5),
-(7209,68,72,512,2,41459,2,5),
-(7210,68,72,2,2,41459,0,4),
-(7211,68,72,2,2,41459,1,4),
-(7212,68,72,2,2,41459,2,4),
-(7213,62,69,0,2,41459,0,7),
-(7214,62,69,1,2,41459,0,3),
-(7215,62,69,1,2,41459,1,3),
-(7216,62,69,1,2,41459,2,3),
-(7217,62,69,16,2,41459,0,2),
-(7218,62,69,16,2,41459,1,2),
-(7219,62,69,16,2,41459,2,2),
-(7220,62,69,128,2,41459,0,7),
-(7221,62,69,128,2,41459,1,7),
-(7222,62,69,128,2,41459,2,7),
-(7223,62,69,256,2,41459,0,7),
-(7224,62,69,256,2,41459,1,7),
-(7225,62,69,256,2,41459,2,7),
-(7226,62,69,1024,2,41459,0,7),
-(7227,62,69,1024,2,41459,1,7),
-(7228,62,69,1024,2,41459,2,7),
-(7229,62,69,2048,2,41459,0,2),
-(7230,62,69,2048,2,41459,1,2),
-(7231,62,69,2048,2,41459,2,2),
-(7232,62,69,4096,2,41459,0,2),
-(7233,62,69,4096,2,41459,1,2),
-(7234,62,69,4096,2,41459,2,2),
-(7235,62,69,8192,2,41459,0,2),
-(7236,62,69,8192,2,41459,1,2),
-(7237,62,69,8192,2,41459,2,2),
-(7238,62,69,32,2,41459,0,5),
-(7239,62,69,32,2,41459,1,5),
-(7240,62,69,32,2,41459,2,5),
-(7241,62,69,512,2,41459,0,5),
-(7242,62,69,512,2,41459,1,5),
-(7243,62,69,512,2,41459,2,5),
-(7244,62,69,2,2,41459,0,4),
-(7245,62,69,2,2,41459,1,4),
-(7246,62,69,2,2,41459,2,4),
-(7247,70,75,0,2,41459,0,7),
-(7248,70,75,1,2,41459,0,3),
-(7249,70,75,1,2,41459,1,3),
-(7250,70,75,1,2,41459,2,3),
-(7251,70,75,16,2,41459,0,2),
-(7252,70,75,16,2,41459,1,2),
-(7253,70,75,16,2,41459,2,2),
-(7254,70,75,128,2,41459,0,7),
-(7255,70,75,128,2,41459,1,7),
-(7256,70,75,128,2,41459,2,7),
-(7257,70,75,256,2,41459,0,7),
-(7258,70,75,256,2,41459,1,7),
-(7259,70,75,256,2,41459,2,7),
-(7260,70,75,1024,2,41459,0,7),
-(7261,70,75,1024,2,41459,1,7),
-(7262,70,75,1024,2,41459,2,7),
-(7263,70,75,2048,2,41459,0,2),
-(7264,70,75,2048,2,41459,1,2),
-(7265,70,75,2048,2,41459,2,2),
-(7266,70,75,4096,2,41459,0,2),
-(7267,70,75,4096,2,41459,1,2),
-(7268,70,75,4096,2,41459,2,2),
-(7269,70,75,8192,2,41459,0,2),
-(7270,70,75,8192,2,41459,1,2),
-(7271,70,75,8192,2,41459,2,2),
-(7272,70,75,32,2,41459,0,5),
-(7273,70,75,32,2,41459,1,5),
-(7274,70,75,32,2,41459,2,5),
-(7275,70,75,512,2,41459,0,5),
-(7276,70,75,512,2,41459,1,5),
-(7277,70,75,512,2,41459,2,5),
-(7278,70,75,2,2,41459,0,4),
-(7279,70,75,2,2,41459,1,4),
-(7280,70,75,2,2,41459,2,4),
-(7281,64,71,0,2,41459,0,7),
-(7282,64,71,1,2,41459,0,3),
-(7283,64,71,1,2,41459,1,3),
-(7284,64,71,1,2,41459,2,3),
-(7285,64,71,16,2,41459,0,2),
-(7286,64,71,16,2,41459,1,2),
-(7287,64,71,16,2,41459,2,2),
-(7288,64,71,128,2,41459,0,7),
-(7289,64,71,128,2,41459,1,7),
-(7290,64,71,128,2,41459,2,7),
-(7291,64,71,256,2,41459,0,7),
-(7292,64,71,256,2,41459,1,7),
-(7293,64,71,256,2,41459,2,7),
-(7294,64,71,1024,2,41459,0,7),
-(7295,64,71,1024,2,41459,1,7),
-(7296,64,71,1024,2,41459,2,7),
-(7297,64,71,2048,2,41459,0,2),
-(7298,64,71,2048,2,41459,1,2),
-(7299,64,71,2048,2,41459,2,2),
-(7300,64,71,4096,2,41459,0,2),
-(7301,64,71,4096,2,41459,1,2),
-(7302,64,71,4096,2,41459,2,2),
-(7303,64,71,8192,2,41459,0,2),
-(7304,64,71,8192,2,41459,1,2),
-(7305,64,71,8192,2,41459,2,2),
-(7306,64,71,32,2,41459,0,5),
-(7307,64,71,32,2,41459,1,5),
-(7308,64,71,32,2,41459,2,5),
-(7309,64,71,512,2,41459,0,5),
-(7310,64,71,512,2,41459,1,5),
-(7311,64,71,512,2,41459,2,5),
-(7312,64,71,2,2,41459,0,4),
-(7313,64,71,2,2,41459,1,4),
-(7314,64,71,2,2,41459,2,4),
-(7315,35,83,0,2,41459,0,7),
-(7316,35,83,1,2,41459,0,3),
-(7317,35,83,1,2,41459,1,3),
-(7318,35,83,1,2,41459,2,3),
-(7319,35,83,16,2,41459,0,2),
-(7320,35,83,16,2,41459,1,2),
-(7321,35,83,16,2,41459,2,2),
-(7322,35,83,128,2,41459,0,7),
-(7323,35,83,128,2,41459,1,7),
-(7324,35,83,128,2,41459,2,7),
-(7325,35,83,256,2,41459,0,7),
-(7326,35,83,256,2,41459,1,7),
-(7327,35,83,256,2,41459,2,7),
-(7328,35,83,1024,2,41459,0,7),
-(7329,35,83,1024,2,41459,1,7),
-(7330,35,83,1024,2,41459,2,7),
-(7331,35,83,2048,2,41459,0,2),
-(7332,35,83,2048,2,41459,1,2),
-(7333,35,83,2048,2,41459,2,2),
-(7334,35,83,4096,2,41459,0,2),
-(7335,35,83,4096,2,41459,1,2),
-(7336,35,83,4096,2,41459,2,2),
-(7337,35,83,8192,2,41459,0,2),
-(7338,35,83,8192,2,41459,1,2),
-(7339,35,83,8192,2,41459,2,2),
-(7340,35,83,32,2,41459,0,5),
-(7341,35,83,32,2,41459,1,5),
-(7342,35,83,32,2,41459,2,5),
-(7343,35,83,512,2,41459,0,5),
-(7344,35,83,512,2,41459,1,5),
-(7345,35,83,512,2,41459,2,5),
-(7346,35,83,2,2,41459,0,4),
-(7347,35,83,2,2,41459,1,4),
-(7348,35,83,2,2,41459,2,4),
-(7349,35,73,0,2,41459,0,32),
-(7350,35,73,4,2,41459,0,32),
-(7351,35,73,4,2,41459,1,32),
-(7352,35,73,4,2,41459,2,32),
-(7353,35,73,8,2,41459,0,32),
-(7354,35,73,8,2,41459,1,32),
-(7355,35,73,8,2,41459,2,32),
-(7356,35,73,64,2,41459,0,32),
-(7357,35,73,64,2,41459,1,32),
-(7358,35,73,64,2,41459,2,32),
-(7359,35,73,128,2,41459,0,32),
-(7360,35,73,128,2,41459,1,32),
-(7361,35,73,128,2,41459,2,32),
-(7362,35,73,256,2,41459,0,32),
-(7363,35,73,256,2,41459,1,32),
-(7364,35,73,256,2,41459,2,32),
-(7365,35,73,512,2,41459,0,32),
-(7366,35,73,512,2,41459,1,32),
-(7367,35,73,512,2,41459,2,32),
-(7368,35,73,0,2,41459,0,7),
-(7369,35,73,1,2,41459,0,3),
-(7370,35,73,1,2,41459,1,3),
-(7371,35,73,1,2,41459,2,3),
-(7372,35,73,16,2,41459,0,2),
-(7373,35,73,16,2,41459,1,2),
-(7374,35,73,16,2,41459,2,2),
-(7375,35,73,128,2,41459,0,7),
-(7376,35,73,128,2,41459,1,7),
-(7377,35,73,128,2,41459,2,7),
-(7378,35,73,256,2,41459,0,7),
-(7379,35,73,256,2,41459,1,7),
-(7380,35,73,256,2,41459,2,7),
-(7381,35,73,1024,2,41459,0,7),
-(7382,35,73,1024,2,41459,1,7),
-(7383,35,73,1024,2,41459,2,7),
-(7384,35,73,2048,2,41459,0,2),
-(7385,35,73,2048,2,41459,1,2),
-(7386,35,73,2048,2,41459,2,2),
-(7387,35,73,4096,2,41459,0,2),
-(7388,35,73,4096,2,41459,1,2),
-(7389,35,73,4096,2,41459,2,2),
-(7390,35,73,8192,2,41459,0,2),
-(7391,35,73,8192,2,41459,1,2),
-(7392,35,73,8192,2,41459,2,2),
-(7393,35,73,32,2,41459,0,5),
-(7394,35,73,32,2,41459,1,5),
-(7395,35,73,32,2,41459,2,5),
-(7396,35,73,512,2,41459,0,5),
-(7397,35,73,512,2,41459,1,5),
-(7398,35,73,512,2,41459,2,5),
-(7399,35,73,2,2,41459,0,4),
-(7400,35,73,2,2,41459,1,4),
-(7401,35,73,2,2,41459,2,4),
-(7402,50,59,0,2,164291,0,7),
-(7403,50,59,1,2,164291,0,3),
-(7404,50,59,1,2,164291,1,3),
-(7405,50,59,1,2,164291,2,3),
-(7406,50,59,16,2,164291,0,2),
-(7407,50,59,16,2,164291,1,2),
-(7408,50,59,16,2,164291,2,2),
-(7409,50,59,128,2,164291,0,7),
-(7410,50,59,128,2,164291,1,7),
-(7411,50,59,128,2,164291,2,7),
-(7412,50,59,256,2,164291,0,7),
-(7413,50,59,256,2,164291,1,7),
-(7414,50,59,256,2,164291,2,7),
-(7415,50,59,1024,2,164291,0,7),
-(7416,50,59,1024,2,164291,1,7),
-(7417,50,59,1024,2,164291,2,7),
-(7418,50,59,2048,2,164291,0,2),
-(7419,50,59,2048,2,164291,1,2),
-(7420,50,59,2048,2,164291,2,2),
-(7421,50,59,4096,2,164291,0,2),
-(7422,50,59,4096,2,164291,1,2),
-(7423,50,59,4096,2,164291,2,2),
-(7424,50,59,8192,2,164291,0,2),
-(7425,50,59,8192,2,164291,1,2),
-(7426,50,59,8192,2,164291,2,2),
-(7427,50,59,32,2,164291,0,5),
-(7428,50,59,32,2,164291,1,5),
-(7429,50,59,32,2,164291,2,5),
-(7430,50,59,512,2,164291,0,5),
-(7431,50,59,512,2,164291,1,5),
-(7432,50,59,512,2,164291,2,5),
-(7433,50,59,2,2,164291,0,4),
-(7434,50,59,2,2,164291,1,4),
-(7435,50,59,2,2,164291,2,4),
-(7436,60,74,0,2,164291,0,7),
-(7437,60,74,1,2,164291,0,3),
-(7438,60,74,1,2,164291,1,3),
-(7439,60,74,1,2,164291,2,3),
-(7440,60,74,16,2,164291,0,2),
-(7441,60,74,16,2,164291,1,2),
-(7442,60,74,16,2,164291,2,2),
-(7443,60,74,128,2,164291,0,7),
-(7444,60,74,128,2,164291,1,7),
-(7445,60,74,128,2,164291,2,7),
-(7446,60,74,256,2,164291,0,7),
-(7447,60,74,256,2,164291,1,7),
-(7448,60,74,256,2,164291,2,7),
-(7449,60,74,1024,2,164291,0,7),
-(7450,60,74,1024,2,164291,1,7),
-(7451,60,74,1024,2,164291,2,7),
-(7452,60,74,2048,2,164291,0,2),
-(7453,60,74,2048,2,164291,1,2),
-(7454,60,74,2048,2,164291,2,2),
-(7455,60,74,4096,2,164291,0,2),
-(7456,60,74,4096,2,164291,1,2),
-(7457,60,74,4096,2,164291,2,2),
-(7458,60,74,8192,2,164291,0,2),
-(7459,60,74,8192,2,164291,1,2),
-(7460,60,74,8192,2,164291,2,2),
-(7461,60,74,32,2,164291,0,5),
-(7462,60,74,32,2,164291,1,5),
-(7463,60,74,32,2,164291,2,5),
-(7464,60,74,512,2,164291,0,5),
-(7465,60,74,512,2,164291,1,5),
-(7466,60,74,512,2,164291,2,5),
-(7467,60,74,2,2,164291,0,4),
-(7468,60,74,2,2,164291,1,4),
-(7469,60,74,2,2,164291,2,4),
-(7470,55,70,0,2,327692,0,23),
-(7471,55,70,1,2,327692,0,3),
-(7472,55,70,1,2,327692,1,3),
-(7473,55,70,1,2,327692,2,3),
-(7474,55,70,16,2,327692,0,2),
-(7475,55,70,16,2,327692,1,2),
-(7476,55,70,16,2,327692,2,2),
-(7477,55,70,128,2,327692,0,23),
-(7478,55,70,128,2,327692,1,23),
-(7479,55,70,128,2,327692,2,23),
-(7480,55,70,256,2,327692,0,23),
-(7481,55,70,256,2,327692,1,23),
-(7482,55,70,256,2,327692,2,23),
-(7483,55,70,1024,2,327692,0,7),
-(7484,55,70,1024,2,327692,1,7),
-(7485,55,70,1024,2,327692,2,7),
-(7486,55,70,2048,2,327692,0,2),
-(7487,55,70,2048,2,327692,1,2),
-(7488,55,70,2048,2,327692,2,2),
-(7489,55,70,4096,2,327692,0,2),
-(7490,55,70,4096,2,327692,1,2),
-(7491,55,70,4096,2,327692,2,2),
-(7492,55,70,8192,2,327692,0,2),
-(7493,55,70,8192,2,327692,1,2),
-(7494,55,70,8192,2,327692,2,2),
-(7495,55,70,32,2,327692,0,21),
-(7496,55,70,32,2,327692,1,21),
-(7497,55,70,32,2,327692,2,21),
-(7498,55,70,512,2,327692,0,21),
-(7499,55,70,512,2,327692,1,21),
-(7500,55,70,512,2,327692,2,21),
-(7501,55,70,2,2,327692,0,20),
-(7502,55,70,2,2,327692,1,20),
-(7503,55,70,2,2,327692,2,20),
-(7504,55,70,0,2,327692,0,23),
-(7505,55,70,1,2,327692,0,3),
-(7506,55,70,1,2,327692,1,3),
-(7507,55,70,1,2,327692,2,3),
-(7508,55,70,16,2,327692,0,2),
-(7509,55,70,16,2,327692,1,2),
-(7510,55,70,16,2,327692,2,2),
-(7511,55,70,128,2,327692,0,23),
-(7512,55,70,128,2,327692,1,23),
-(7513,55,70,128,2,327692,2,23),
-(7514,55,70,256,2,327692,0,23),
-(7515,55,70,256,2,327692,1,23),
-(7516,55,70,256,2,327692,2,23),
-(7517,55,70,1024,2,327692,0,7),
-(7518,55,70,1024,2,327692,1,7),
-(7519,55,70,1024,2,327692,2,7),
-(7520,55,70,2048,2,327692,0,2),
-(7521,55,70,2048,2,327692,1,2),
-(7522,55,70,2048,2,327692,2,2),
-(7523,55,70,4096,2,327692,0,2),
-(7524,55,70,4096,2,327692,1,2),
-(7525,55,70,4096,2,327692,2,2),
-(7526,55,70,8192,2,327692,0,2),
-(7527,55,70,8192,2,327692,1,2),
-(7528,55,70,8192,2,327692,2,2),
-(7529,55,70,32,2,327692,0,21),
-(7530,55,70,32,2,327692,1,21),
-(7531,55,70,32,2,327692,2,21),
-(7532,55,70,512,2,327692,0,21),
-(7533,55,70,512,2,327692,1,21),
-(7534,55,70,512,2,327692,2,21),
-(7535,55,70,2,2,327692,0,20),
-(7536,55,70,2,2,327692,1,20),
-(7537,55,70,2,2,327692,2,20),
-(7538,60,83,0,2,327692,0,23),
-(7539,60,83,1,2,327692,0,3),
-(7540,60,83,1,2,327692,1,3),
-(7541,60,83,1,2,327692,2,3),
-(7542,60,83,16,2,327692,0,2),
-(7543,60,83,16,2,327692,1,2),
-(7544,60,83,16,2,327692,2,2),
-(7545,60,83,128,2,327692,0,23),
-(7546,60,83,128,2,327692,1,23),
-(7547,60,83,128,2,327692,2,23),
-(7548,60,83,256,2,327692,0,23),
-(7549,60,83,256,2,327692,1,23),
-(7550,60,83,256,2,327692,2,23),
-(7551,60,83,1024,2,327692,0,7),
-(7552,60,83,1024,2,327692,1,7),
-(7553,60,83,1024,2,327692,2,7),
-(7554,60,83,2048,2,327692,0,2),
-(7555,60,83,2048,2,327692,1,2),
-(7556,60,83,2048,2,327692,2,2),
-(7557,60,83,4096,2,327692,0,2),
-(7558,60,83,4096,2,327692,1,2),
-(7559,60,83,4096,2,327692,2,2),
-(7560,60,83,8192,2,327692,0,2),
-(7561,60,83,8192,2,327692,1,2),
-(7562,60,83,8192,2,327692,2,2),
-(7563,60,83,32,2,327692,0,21),
-(7564,60,83,32,2,327692,1,21),
-(7565,60,83,32,2,327692,2,21),
-(7566,60,83,512,2,327692,0,21),
-(7567,60,83,512,2,327692,1,21),
-(7568,60,83,512,2,327692,2,21),
-(7569,60,83,2,2,327692,0,20),
-(7570,60,83,2,2,327692,1,20),
-(7571,60,83,2,2,327692,2,20),
-(7572,50,59,0,2,9264,0,7),
-(7573,50,59,1,2,9264,0,3),
-(7574,50,59,1,2,9264,1,3),
-(7575,50,59,1,2,9264,2,3),
-(7576,50,59,16,2,9264,0,2),
-(7577,50,59,16,2,9264,1,2),
-(7578,50,59,16,2,9264,2,2),
-(7579,50,59,128,2,9264,0,7),
-(7580,50,59,128,2,9264,1,7),
-(7581,50,59,128,2,9264,2,7),
-(7582,50,59,256,2,9264,0,7),
-(7583,50,59,256,2,9264,1,7),
-(7584,50,59,256,2,9264,2,7),
-(7585,50,59,1024,2,9264,0,7),
-(7586,50,59,1024,2,9264,1,7),
-(7587,50,59,1024,2,9264,2,7),
-(7588,50,59,2048,2,9264,0,2),
-(7589,50,59,2048,2,9264,1,2),
-(7590,50,59,2048,2,9264,2,2),
-(7591,50,59,4096,2,9264,0,2),
-(7592,50,59,4096,2,9264,1,2),
-(7593,50,59,4096,2,9264,2,2),
-(7594,50,59,8192,2,9264,0,2),
-(7595,50,59,8192,2,9264,1,2),
-(7596,50,59,8192,2,9264,2,2),
-(7597,50,59,32,2,9264,0,5),
-(7598,50,59,32,2,9264,1,5),
-(7599,50,59,32,2,9264,2,5),
-(7600,50,59,512,2,9264,0,5),
-(7601,50,59,512,2,9264,1,5),
-(7602,50,59,512,2,9264,2,5),
-(7603,50,59,2,2,9264,0,4),
-(7604,50,59,2,2,9264,1,4),
-(7605,50,59,2,2,9264,2,4),
-(7606,60,74,0,2,9264,0,7),
-(7607,60,74,1,2,9264,0,3),
-(7608,60,74,1,2,9264,1,3),
-(7609,60,74,1,2,9264,2,3),
-(7610,60,74,16,2,9264,0,2),
-(7611,60,74,16,2,9264,1,2),
-(7612,60,74,16,2,9264,2,2),
-(7613,60,74,128,2,9264,0,7),
-(7614,60,74,128,2,9264,1,7),
-(7615,60,74,128,2,9264,2,7),
-(7616,60,74,256,2,9264,0,7),
-(7617,60,74,256,2,9264,1,7),
-(7618,60,74,256,2,9264,2,7),
-(7619,60,74,1024,2,9264,0,7),
-(7620,60,74,1024,2,9264,1,7),
-(7621,60,74,1024,2,9264,2,7),
-(7622,60,74,2048,2,9264,0,2),
-(7623,60,74,2048,2,9264,1,2),
-(7624,60,74,2048,2,9264,2,2),
-(7625,60,74,4096,2,9264,0,2),
-(7626,60,74,4096,2,9264,1,2),
-(7627,60,74,4096,2,9264,2,2),
-(7628,60,74,8192,2,9264,0,2),
-(7629,60,74,8192,2,9264,1,2),
-(7630,60,74,8192,2,9264,2,2),
-(7631,60,74,32,2,9264,0,5),
-(7632,60,74,32,2,9264,1,5),
-(7633,60,74,32,2,9264,2,5),
-(7634,60,74,512,2,9264,0,5),
-(7635,60,74,512,2,9264,1,5),
-(7636,60,74,512,2,9264,2,5),
-(7637,60,74,2,2,9264,0,4),
-(7638,60,74,2,2,9264,1,4),
-(7639,60,74,2,2,9264,2,4),
-(7640,65,73,0,2,41459,0,7),
-(7641,65,73,1,2,41459,0,3),
-(7642,65,73,1,2,41459,1,3),
-(7643,65,73,1,2,41459,2,3),
-(7644,65,73,16,2,41459,0,2),
-(7645,65,73,16,2,41459,1,2),
-(7646,65,73,16,2,41459,2,2),
-(7647,65,73,128,2,41459,0,7),
-(7648,65,73,128,2,41459,1,7),
-(7649,65,73,128,2,41459,2,7),
-(7650,65,73,256,2,41459,0,7),
-(7651,65,73,256,2,41459,1,7),
-(7652,65,73,256,2,41459,2,7),
-(7653,65,73,1024,2,41459,0,7),
-(7654,65,73,1024,2,41459,1,7),
-(7655,65,73,1024,2,41459,2,7),
-(7656,65,73,2048,2,41459,0,2),
-(7657,65,73,2048,2,41459,1,2),
-(7658,65,73,2048,2,41459,2,2),
-(7659,65,73,4096,2,41459,0,2),
-(7660,65,73,4096,2,41459,1,2),
-(7661,65,73,4096,2,41459,2,2),
-(7662,65,73,8192,2,41459,0,2),
-(7663,65,73,8192,2,41459,1,2),
-(7664,65,73,8192,2,41459,2,2),
-(7665,65,73,32,2,41459,0,5),
-(7666,65,73,32,2,41459,1,5),
-(7667,65,73,32,2,41459,2,5),
-(7668,65,73,512,2,41459,0,5),
-(7669,65,73,512,2,41459,1,5),
-(7670,65,73,512,2,41459,2,5),
-(7671,65,73,2,2,41459,0,4),
-(7672,65,73,2,2,41459,1,4),
-(7673,65,73,2,2,41459,2,4),
-(7674,50,69,0,2,41459,0,7),
-(7675,50,69,1,2,41459,0,3),
-(7676,50,69,1,2,41459,1,3),
-(7677,50,69,1,2,41459,2,3),
-(7678,50,69,16,2,41459,0,2),
-(7679,50,69,16,2,41459,1,2),
-(7680,50,69,16,2,41459,2,2),
-(7681,50,69,128,2,41459,0,7),
-(7682,50,69,128,2,41459,1,7),
-(7683,50,69,128,2,41459,2,7),
-(7684,50,69,256,2,41459,0,7),
-(7685,50,69,256,2,41459,1,7),
-(7686,50,69,256,2,41459,2,7),
-(7687,50,69,1024,2,41459,0,7),
-(7688,50,69,1024,2,41459,1,7),
-(7689,50,69,1024,2,41459,2,7),
-(7690,50,69,2048,2,41459,0,2),
-(7691,50,69,2048,2,41459,1,2),
-(7692,50,69,2048,2,41459,2,2),
-(7693,50,69,4096,2,41459,0,2),
-(7694,50,69,4096,2,41459,1,2),
-(7695,50,69,4096,2,41459,2,2),
-(7696,50,69,8192,2,41459,0,2),
-(7697,50,69,8192,2,41459,1,2),
-(7698,50,69,8192,2,41459,2,2),
-(7699,50,69,32,2,41459,0,5),
-(7700,50,69,32,2,41459,1,5),
-(7701,50,69,32,2,41459,2,5),
-(7702,50,69,512,2,41459,0,5),
-(7703,50,69,512,2,41459,1,5),
-(7704,50,69,512,2,41459,2,5),
-(7705,50,69,2,2,41459,0,4),
-(7706,50,69,2,2,41459,1,4),
-(7707,50,69,2,2,41459,2,4),
-(7708,75,83,0,2,41459,0,5),
-(7709,75,83,1,2,41459,0,1),
-(7710,75,83,1,2,41459,1,1),
-(7711,75,83,1,2,41459,2,1),
-(7712,75,83,32,2,41459,0,5),
-(7713,75,83,32,2,41459,1,5),
-(7714,75,83,32,2,41459,2,5),
-(7715,75,83,128,2,41459,0,5),
-(7716,75,83,128,2,41459,1,5),
-(7717,75,83,128,2,41459,2,5),
-(7718,75,83,256,2,41459,0,5),
-(7719,75,83,256,2,41459,1,5),
-(7720,75,83,256,2,41459,2,5),
-(7721,75,83,512,2,41459,0,5),
-(7722,75,83,512,2,41459,1,5),
-(7723,75,83,512,2,41459,2,5),
-(7724,75,83,1024,2,41459,0,5),
-(7725,75,83,1024,2,41459,1,5),
-(7726,75,83,1024,2,41459,2,5),
-(7727,75,83,2,2,41459,0,4),
-(7728,75,83,2,2,41459,1,4),
-(7729,75,83,2,2,41459,2,4),
-(7730,30,45,0,2,41459,0,7),
-(7731,30,45,1,2,41459,0,3),
-(7732,30,45,1,2,41459,1,3),
-(7733,30,45,1,2,41459,2,3),
-(7734,30,45,16,2,41459,0,2),
-(7735,30,45,16,2,41459,1,2),
-(7736,30,45,16,2,41459,2,2),
-(7737,30,45,128,2,41459,0,7),
-(7738,30,45,128,2,41459,1,7),
-(7739,30,45,128,2,41459,2,7),
-(7740,30,45,256,2,41459,0,7),
-(7741,30,45,256,2,41459,1,7),
-(7742,30,45,256,2,41459,2,7),
-(7743,30,45,1024,2,41459,0,7),
-(7744,30,45,1024,2,41459,1,7),
-(7745,30,45,1024,2,41459,2,7),
-(7746,30,45,2048,2,41459,0,2),
-(7747,30,45,2048,2,41459,1,2),
-(7748,30,45,2048,2,41459,2,2),
-(7749,30,45,4096,2,41459,0,2),
-(7750,30,45,4096,2,41459,1,2),
-(7751,30,45,4096,2,41459,2,2),
-(7752,30,45,8192,2,41459,0,2),
-(7753,30,45,8192,2,41459,1,2),
-(7754,30,45,8192,2,41459,2,2),
-(7755,30,45,32,2,41459,0,5),
-(7756,30,45,32,2,41459,1,5),
-(7757,30,45,32,2,41459,2,5),
-(7758,30,45,512,2,41459,0,5),
-(7759,30,45,512,2,41459,1,5),
-(7760,30,45,512,2,41459,2,5),
-(7761,30,45,2,2,41459,0,4),
-(7762,30,45,2,2,41459,1,4),
-(7763,30,45,2,2,41459,2,4),
-(7764,70,83,0,2,41459,0,7),
-(7765,70,83,1,2,41459,0,3),
-(7766,70,83,1,2,41459,1,3),
-(7767,70,83,1,2,41459,2,3),
-(7768,70,83,16,2,41459,0,2),
-(7769,70,83,16,2,41459,1,2),
-(7770,70,83,16,2,41459,2,2),
-(7771,70,83,128,2,41459,0,7),
-(7772,70,83,128,2,41459,1,7),
-(7773,70,83,128,2,41459,2,7),
-(7774,70,83,256,2,41459,0,7),
-(7775,70,83,256,2,41459,1,7),
-(7776,70,83,256,2,41459,2,7),
-(7777,70,83,1024,2,41459,0,7),
-(7778,70,83,1024,2,41459,1,7),
-(7779,70,83,1024,2,41459,2,7),
-(7780,70,83,2048,2,41459,0,2),
-(7781,70,83,2048,2,41459,1,2),
-(7782,70,83,2048,2,41459,2,2),
-(7783,70,83,4096,2,41459,0,2),
-(7784,70,83,4096,2,41459,1,2),
-(7785,70,83,4096,2,41459,2,2),
-(7786,70,83,8192,2,41459,0,2),
-(7787,70,83,8192,2,41459,1,2),
-(7788,70,83,8192,2,41459,2,2),
-(7789,70,83,32,2,41459,0,5),
-(7790,70,83,32,2,41459,1,5),
-(7791,70,83,32,2,41459,2,5),
-(7792,70,83,512,2,41459,0,5),
-(7793,70,83,512,2,41459,1,5),
-(7794,70,83,512,2,41459,2,5),
-(7795,70,83,2,2,41459,0,4),
-(7796,70,83,2,2,41459,1,4),
-(7797,70,83,2,2,41459,2,4),
-(7798,73,80,0,2,41459,0,5),
-(7799,73,80,1,2,41459,0,1),
-(7800,73,80,1,2,41459,1,1),
-(7801,73,80,1,2,41459,2,1),
-(7802,73,80,32,2,41459,0,5),
-(7803,73,80,32,2,41459,1,5),
-(7804,73,80,32,2,41459,2,5),
-(7805,73,80,128,2,41459,0,5),
-(7806,73,80,128,2,41459,1,5),
-(7807,73,80,128,2,41459,2,5),
-(7808,73,80,256,2,41459,0,5),
-(7809,73,80,256,2,41459,1,5),
-(7810,73,80,256,2,41459,2,5),
-(7811,73,80,512,2,41459,0,5),
-(7812,73,80,512,2,41459,1,5),
-(7813,73,80,512,2,41459,2,5),
-(7814,73,80,1024,2,41459,0,5),
-(7815,73,80,1024,2,41459,1,5),
-(7816,73,80,1024,2,41459,2,5),
-(7817,73,80,2,2,41459,0,4),
-(7818,73,80,2,2,41459,1,4),
-(7819,73,80,2,2,41459,2,4),
-(7820,77,83,0,2,41459,0,7),
-(7821,77,83,1,2,41459,0,3),
-(7822,77,83,1,2,41459,1,3),
-(7823,77,83,1,2,41459,2,3),
-(7824,77,83,16,2,41459,0,2),
-(7825,77,83,16,2,41459,1,2),
-(7826,77,83,16,2,41459,2,2),
-(7827,77,83,128,2,41459,0,7),
-(7828,77,83,128,2,41459,1,7),
-(7829,77,83,128,2,41459,2,7),
-(7830,77,83,256,2,41459,0,7),
-(7831,77,83,256,2,41459,1,7),
-(7832,77,83,256,2,41459,2,7),
-(7833,77,83,1024,2,41459,0,7),
-(7834,77,83,1024,2,41459,1,7),
-(7835,77,83,1024,2,41459,2,7),
-(7836,77,83,2048,2,41459,0,2),
-(7837,77,83,2048,2,41459,1,2),
-(7838,77,83,2048,2,41459,2,2),
-(7839,77,83,4096,2,41459,0,2),
-(7840,77,83,4096,2,41459,1,2),
-(7841,77,83,4096,2,41459,2,2),
-(7842,77,83,8192,2,41459,0,2),
-(7843,77,83,8192,2,41459,1,2),
-(7844,77,83,8192,2,41459,2,2),
-(7845,77,83,32,2,41459,0,5),
-(7846,77,83,32,2,41459,1,5),
-(7847,77,83,32,2,41459,2,5),
-(7848,77,83,512,2,41459,0,5),
-(7849,77,83,512,2,41459,1,5),
-(7850,77,83,512,2,41459,2,5),
-(7851,77,83,2,2,41459,0,4),
-(7852,77,83,2,2,41459,1,4),
-(7853,77,83,2,2,41459,2,4),
-(7854,60,72,0,2,41459,0,39),
-(7855,60,72,1,2,41459,0,3),
-(7856,60,72,1,2,41459,1,3),
-(7857,60,72,1,2,41459,2,3),
-(7858,60,72,16,2,41459,0,2),
-(7859,60,72,16,2,41459,1,2),
-(7860,60,72,16,2,41459,2,2),
-(7861,60,72,128,2,41459,0,39),
-(7862,60,72,128,2,41459,1,39),
-(7863,60,72,128,2,41459,2,39),
-(7864,60,72,256,2,41459,0,39),
-(7865,60,72,256,2,41459,1,39),
-(7866,60,72,256,2,41459,2,39),
-(7867,60,72,1024,2,41459,0,7),
-(7868,60,72,1024,2,41459,1,7),
-(7869,60,72,1024,2,41459,2,7),
-(7870,60,72,2048,2,41459,0,2),
-(7871,60,72,2048,2,41459,1,2),
-(7872,60,72,2048,2,41459,2,2),
-(7873,60,72,4096,2,41459,0,2),
-(7874,60,72,4096,2,41459,1,2),
-(7875,60,72,4096,2,41459,2,2),
-(7876,60,72,8192,2,41459,0,2),
-(7877,60,72,8192,2,41459,1,2),
-(7878,60,72,8192,2,41459,2,2),
-(7879,60,72,32,2,41459,0,5),
-(7880,60,72,32,2,41459,1,5),
-(7881,60,72,32,2,41459,2,5),
-(7882,60,72,512,2,41459,0,37),
-(7883,60,72,512,2,41459,1,37),
-(7884,60,72,512,2,41459,2,37),
-(7885,60,72,2,2,41459,0,4),
-(7886,60,72,2,2,41459,1,4),
-(7887,60,72,2,2,41459,2,4),
-(7888,60,72,4,2,41459,0,32),
-(7889,60,72,4,2,41459,1,32),
-(7890,60,72,4,2,41459,2,32),
-(7891,60,72,8,2,41459,0,32),
-(7892,60,72,8,2,41459,1,32),
-(7893,60,72,8,2,41459,2,32),
-(7894,60,72,64,2,41459,0,32),
-(7895,60,72,64,2,41459,1,32),
-(7896,60,72,64,2,41459,2,32),
-(7897,55,59,0,2,41459,0,7),
-(7898,55,59,1,2,41459,0,3),
-(7899,55,59,1,2,41459,1,3),
-(7900,55,59,1,2,41459,2,3),
-(7901,55,59,16,2,41459,0,2),
-(7902,55,59,16,2,41459,1,2),
-(7903,55,59,16,2,41459,2,2),
-(7904,55,59,128,2,41459,0,7),
-(7905,55,59,128,2,41459,1,7),
-(7906,55,59,128,2,41459,2,7),
-(7907,55,59,256,2,41459,0,7),
-(7908,55,59,256,2,41459,1,7),
-(7909,55,59,256,2,41459,2,7),
-(7910,55,59,1024,2,41459,0,7),
-(7911,55,59,1024,2,41459,1,7),
-(7912,55,59,1024,2,41459,2,7),
-(7913,55,59,2048,2,41459,0,2),
-(7914,55,59,2048,2,41459,1,2),
-(7915,55,59,2048,2,41459,2,2),
-(7916,55,59,4096,2,41459,0,2),
-(7917,55,59,4096,2,41459,1,2),
-(7918,55,59,4096,2,41459,2,2),
-(7919,55,59,8192,2,41459,0,2),
-(7920,55,59,8192,2,41459,1,2),
-(7921,55,59,8192,2,41459,2,2),
-(7922,55,59,32,2,41459,0,5),
-(7923,55,59,32,2,41459,1,5),
-(7924,55,59,32,2,41459,2,5),
-(7925,55,59,512,2,41459,0,5),
-(7926,55,59,512,2,41459,1,5),
-(7927,55,59,512,2,41459,2,5),
-(7928,55,59,2,2,41459,0,4),
-(7929,55,59,2,2,41459,1,4),
-(7930,55,59,2,2,41459,2,4),
-(7931,60,69,0,2,41459,0,7),
-(7932,60,69,1,2,41459,0,3),
-(7933,60,69,1,2,41459,1,3),
-(7934,60,69,1,2,41459,2,3),
-(7935,60,69,16,2,41459,0,2),
-(7936,60,69,16,2,41459,1,2),
-(7937,60,69,16,2,41459,2,2),
-(7938,60,69,128,2,41459,0,7),
-(7939,60,69,128,2,41459,1,7),
-(7940,60,69,128,2,41459,2,7),
-(7941,60,69,256,2,41459,0,7),
-(7942,60,69,256,2,41459,1,7),
-(7943,60,69,256,2,41459,2,7),
-(7944,60,69,1024,2,41459,0,7),
-(7945,60,69,1024,2,41459,1,7),
-(7946,60,69,1024,2,41459,2,7),
-(7947,60,69,2048,2,41459,0,2),
-(7948,60,69,2048,2,41459,1,2),
-(7949,60,69,2048,2,41459,2,2),
-(7950,60,69,4096,2,41459,0,2),
-(7951,60,69,4096,2,41459,1,2),
-(7952,60,69,4096,2,41459,2,2),
-(7953,60,69,8192,2,41459,0,2),
-(7954,60,69,8192,2,41459,1,2),
-(7955,60,69,8192,2,41459,2,2),
-(7956,60,69,32,2,41459,0,5),
-(7957,60,69,32,2,41459,1,5),
-(7958,60,69,32,2,41459,2,5),
-(7959,60,69,512,2,41459,0,5),
-(7960,60,69,512,2,41459,1,5),
-(7961,60,69,512,2,41459,2,5),
-(7962,60,69,2,2,41459,0,4),
-(7963,60,69,2,2,41459,1,4),
-(7964,60,69,2,2,41459,2,4),
-(7965,70,74,0,2,41459,0,7),
-(7966,70,74,1,2,41459,0,3),
-(7967,70,74,1,2,41459,1,3),
-(7968,70,74,1,2,41459,2,3),
-(7969,70,74,16,2,41459,0,2),
-(7970,70,74,16,2,41459,1,2),
-(7971,70,74,16,2,41459,2,2),
-(7972,70,74,128,2,41459,0,7),
-(7973,70,74,128,2,41459,1,7),
-(7974,70,74,128,2,41459,2,7),
-(7975,70,74,256,2,41459,0,7),
-(7976,70,74,256,2,41459,1,7),
-(7977,70,74,256,2,41459,2,7),
-(7978,70,74,1024,2,41459,0,7),
-(7979,70,74,1024,2,41459,1,7),
-(7980,70,74,1024,2,41459,2,7),
-(7981,70,74,2048,2,41459,0,2),
-(7982,70,74,2048,2,41459,1,2),
-(7983,70,74,2048,2,41459,2,2),
-(7984,70,74,4096,2,41459,0,2),
-(7985,70,74,4096,2,41459,1,2),
-(7986,70,74,4096,2,41459,2,2),
-(7987,70,74,8192,2,41459,0,2),
-(7988,70,74,8192,2,41459,1,2),
-(7989,70,74,8192,2,41459,2,2),
-(7990,70,74,32,2,41459,0,5),
-(7991,70,74,32,2,41459,1,5),
-(7992,70,74,32,2,41459,2,5),
-(7993,70,74,512,2,41459,0,5),
-(7994,70,74,512,2,41459,1,5),
-(7995,70,74,512,2,41459,2,5),
-(7996,70,74,2,2,41459,0,4),
-(7997,70,74,2,2,41459,1,4),
-(7998,70,74,2,2,41459,2,4),
-(7999,75,79,0,2,41459,0,7),
-(8000,75,79,1,2,41459,0,3),
-(8001,75,79,1,2,41459,1,3),
-(8002,75,79,1,2,41459,2,3),
-(8003,75,79,16,2,41459,0,2),
-(8004,75,79,16,2,41459,1,2),
-(8005,75,79,16,2,41459,2,2),
-(8006,75,79,128,2,41459,0,7),
-(8007,75,79,128,2,41459,1,7),
-(8008,75,79,128,2,41459,2,7),
-(8009,75,79,256,2,41459,0,7),
-(8010,75,79,256,2,41459,1,7),
-(8011,75,79,256,2,41459,2,7),
-(8012,75,79,1024,2,41459,0,7),
-(8013,75,79,1024,2,41459,1,7),
-(8014,75,79,1024,2,41459,2,7),
-(8015,75,79,2048,2,41459,0,2),
-(8016,75,79,2048,2,41459,1,2),
-(8017,75,79,2048,2,41459,2,2),
-(8018,75,79,4096,2,41459,0,2),
-(8019,75,79,4096,2,41459,1,2),
-(8020,75,79,4096,2,41459,2,2),
-(8021,75,79,8192,2,41459,0,2),
-(8022,75,79,8192,2,41459,1,2),
-(8023,75,79,8192,2,41459,2,2),
-(8024,75,79,32,2,41459,0,5),
-(8025,75,79,32,2,41459,1,5),
-(8026,75,79,32,2,41459,2,5),
-(8027,75,79,512,2,41459,0,5),
-(8028,75,79,512,2,41459,1,5),
-(8029,75,79,512,2,41459,2,5),
-(8030,75,79,2,2,41459,0,4),
-(8031,75,79,2,2,41459,1,4),
-(8032,75,79,2,2,41459,2,4),
-(8033,80,83,0,2,41459,0,7),
-(8034,80,83,1,2,41459,0,3),
-(8035,80,83,1,2,41459,1,3),
-(8036,80,83,1,2,41459,2,3),
-(8037,80,83,16,2,41459,0,2),
-(8038,80,83,16,2,41459,1,2),
-(8039,80,83,16,2,41459,2,2),
-(8040,80,83,128,2,41459,0,7),
-(8041,80,83,128,2,41459,1,7),
-(8042,80,83,128,2,41459,2,7),
-(8043,80,83,256,2,41459,0,7),
-(8044,80,83,256,2,41459,1,7),
-(8045,80,83,256,2,41459,2,7),
-(8046,80,83,1024,2,41459,0,7),
-(8047,80,83,1024,2,41459,1,7),
-(8048,80,83,1024,2,41459,2,7),
-(8049,80,83,2048,2,41459,0,2),
-(8050,80,83,2048,2,41459,1,2),
-(8051,80,83,2048,2,41459,2,2),
-(8052,80,83,4096,2,41459,0,2),
-(8053,80,83,4096,2,41459,1,2),
-(8054,80,83,4096,2,41459,2,2),
-(8055,80,83,8192,2,41459,0,2),
-(8056,80,83,8192,2,41459,1,2),
-(8057,80,83,8192,2,41459,2,2),
-(8058,80,83,32,2,41459,0,5),
-(8059,80,83,32,2,41459,1,5),
-(8060,80,83,32,2,41459,2,5),
-(8061,80,83,512,2,41459,0,5),
-(8062,80,83,512,2,41459,1,5),
-(8063,80,83,512,2,41459,2,5),
-(8064,80,83,2,2,41459,0,4),
-(8065,80,83,2,2,41459,1,4),
-(8066,80,83,2,2,41459,2,4),
-(8067,30,39,0,2,41459,0,32),
-(8068,30,39,4,2,41459,0,32),
-(8069,30,39,4,2,41459,1,32),
-(8070,30,39,4,2,41459,2,32),
-(8071,30,39,8,2,41459,0,32),
-(8072,30,39,8,2,41459,1,32),
-(8073,30,39,8,2,41459,2,32),
-(8074,30,39,64,2,41459,0,32),
-(8075,30,39,64,2,41459,1,32),
-(8076,30,39,64,2,41459,2,32),
-(8077,30,39,128,2,41459,0,32),
-(8078,30,39,128,2,41459,1,32),
-(8079,30,39,128,2,41459,2,32),
-(8080,30,39,256,2,41459,0,32),
-(8081,30,39,256,2,41459,1,32),
-(8082,30,39,256,2,41459,2,32),
-(8083,30,39,512,2,41459,0,32),
-(8084,30,39,512,2,41459,1,32),
-(8085,30,39,512,2,41459,2,32),
-(8086,40,49,0,2,41459,0,32),
-(8087,40,49,4,2,41459,0,32),
-(8088,40,49,4,2,41459,1,32),
-(8089,40,49,4,2,41459,2,32),
-(8090,40,49,8,2,41459,0,32),
-(8091,40,49,8,2,41459,1,32),
-(8092,40,49,8,2,41459,2,32),
-(8093,40,49,64,2,41459,0,32),
-(8094,40,49,64,2,41459,1,32),
-(8095,40,49,64,2,41459,2,32),
-(8096,40,49,128,2,41459,0,32),
-(8097,40,49,128,2,41459,1,32),
-(8098,40,49,128,2,41459,2,32),
-(8099,40,49,256,2,41459,0,32),
-(8100,40,49,256,2,41459,1,32),
-(8101,40,49,256,2,41459,2,32),
-(8102,40,49,512,2,41459,0,32),
-(8103,40,49,512,2,41459,1,32),
-(8104,40,49,512,2,41459,2,32),
-(8105,50,59,0,2,41459,0,32),
-(8106,50,59,4,2,41459,0,32),
-(8107,50,59,4,2,41459,1,32),
-(8108,50,59,4,2,41459,2,32),
-(8109,50,59,8,2,41459,0,32),
-(8110,50,59,8,2,41459,1,32),
-(8111,50,59,8,2,41459,2,32),
-(8112,50,59,64,2,41459,0,32),
-(8113,50,59,64,2,41459,1,32),
-(8114,50,59,64,2,41459,2,32),
-(8115,50,59,128,2,41459,0,32),
-(8116,50,59,128,2,41459,1,32),
-(8117,50,59,128,2,41459,2,32),
-(8118,50,59,256,2,41459,0,32),
-(8119,50,59,256,2,41459,1,32),
-(8120,50,59,256,2,41459,2,32),
-(8121,50,59,512,2,41459,0,32),
-(8122,50,59,512,2,41459,1,32),
-(8123,50,59,512,2,41459,2,32),
-(8124,60,69,0,2,41459,0,32),
-(8125,60,69,4,2,41459,0,32),
-(8126,60,69,4,2,41459,1,32),
-(8127,60,69,4,2,41459,2,32),
-(8128,60,69,8,2,41459,0,32),
-(8129,60,69,8,2,41459,1,32),
-(8130,60,69,8,2,41459,2,32),
-(8131,60,69,64,2,41459,0,32),
-(8132,60,69,64,2,41459,1,32),
-(8133,60,69,64,2,41459,2,32),
-(8134,60,69,128,2,41459,0,32),
-(8135,60,69,128,2,41459,1,32),
-(8136,60,69,128,2,41459,2,32),
-(8137,60,69,256,2,41459,0,32),
-(8138,60,69,256,2,41459,1,32),
-(8139,60,69,256,2,41459,2,32),
-(8140,60,69,512,2,41459,0,32),
-(8141,60,69,512,2,41459,1,32),
-(8142,60,69,512,2,41459,2,32),
-(8143,70,79,0,2,41459,0,32),
-(8144,70,79,4,2,41459,0,32),
-(8145,70,79,4,2,41459,1,32),
-(8146,70,79,4,2,41459,2,32),
-(8147,70,79,8,2,41459,0,32),
-(8148,70,79,8,2,41459,1,32),
-(8149,70,79,8,2,41459,2,32),
-(8150,70,79,64,2,41459,0,32),
-(8151,70,79,64,2,41459,1,32),
-(8152,70,79,64,2,41459,2,32),
-(8153,70,79,128,2,41459,0,32),
-(8154,70,79,128,2,41459,1,32),
-(8155,70,79,128,2,41459,2,32),
-(8156,70,79,256,2,41459,0,32),
-(8157,70,79,256,2,41459,1,32),
-(8158,70,79,256,2,41459,2,32),
-(8159,70,79,512,2,41459,0,32),
-(8160,70,79,512,2,41459,1,32),
-(8161,70,79,512,2,41459,2,32),
-(8162,80,83,0,2,41459,0,32),
-(8163,80,83,4,2,41459,0,32),
-(8164,80,83,4,2,41459,1,32),
-(8165,80,83,4,2,41459,2,32),
-(8166,80,83,8,2,41459,0,32),
-(8167,80,83,8,2,41459,1,32),
-(8168,80,83,8,2,41459,2,32),
-(8169,80,83,64,2,41459,0,32),
-(8170,80,83,64,2,41459,1,32),
-(8171,80,83,64,2,41459,2,32),
-(8172,80,83,128,2,41459,0,32),
-(8173,80,83,128,2,41459,1,32),
-(8174,80,83,128,2,41459,2,32),
-(8175,80,83,256,2,41459,0,32),
-(8176,80,83,256,2,41459,1,32),
-(8177,80,83,256,2,41459,2,32),
-(8178,80,83,512,2,41459,0,32),
-(8179,80,83,512,2,41459,1,32),
-(8180,80,83,512,2,41459,2,32),
-(8181,66,73,0,2,41459,0,32),
-(8182,66,73,4,2,41459,0,32),
-(8183,66,73,4,2,41459,1,32),
-(8184,66,73,4,2,41459,2,32),
-(8185,66,73,8,2,41459,0,32),
-(8186,66,73,8,2,41459,1,32),
-(8187,66,73,8,2,41459,2,32),
-(8188,66,73,64,2,41459,0,32),
-(8189,66,73,64,2,41459,1,32),
-(8190,66,73,64,2,41459,2,32),
-(8191,66,73,128,2,41459,0,32),
-(8192,66,73,128,2,41459,1,32),
-(8193,66,73,128,2,41459,2,32),
-(8194,66,73,256,2,41459,0,32),
-(8195,66,73,256,2,41459,1,32),
-(8196,66,73,256,2,41459,2,32),
-(8197,66,73,512,2,41459,0,32),
-(8198,66,73,512,2,41459,1,32),
-(8199,66,73,512,2,41459,2,32),
-(8200,28,35,0,2,41459,0,32),
-(8201,28,35,4,2,41459,0,32),
-(8202,28,35,4,2,41459,1,32),
-(8203,28,35,4,2,41459,2,32),
-(8204,28,35,8,2,41459,0,32),
-(8205,28,35,8,2,41459,1,32),
-(8206,28,35,8,2,41459,2,32),
-(8207,28,35,64,2,41459,0,32),
-(8208,28,35,64,2,41459,1,32),
-(8209,28,35,64,2,41459,2,32),
-(8210,28,35,128,2,41459,0,32),
-(8211,28,35,128,2,41459,1,32),
-(8212,28,35,128,2,41459,2,32),
-(8213,28,35,256,2,41459,0,32),
-(8214,28,35,256,2,41459,1,32),
-(8215,28,35,256,2,41459,2,32),
-(8216,28,35,512,2,41459,0,32),
-(8217,28,35,512,2,41459,1,32),
-(8218,28,35,512,2,41459,2,32),
-(8219,36,45,0,2,41459,0,32),
-(8220,36,45,4,2,41459,0,32),
-(8221,36,45,4,2,41459,1,32),
-(8222,36,45,4,2,41459,2,32),
-(8223,36,45,8,2,41459,0,32),
-(8224,36,45,8,2,41459,1,32),
-(8225,36,45,8,2,41459,2,32),
-(8226,36,45,64,2,41459,0,32),
-(8227,36,45,64,2,41459,1,32),
-(8228,36,45,64,2,41459,2,32),
-(8229,36,45,128,2,41459,0,32),
-(8230,36,45,128,2,41459,1,32),
-(8231,36,45,128,2,41459,2,32),
-(8232,36,45,256,2,41459,0,32),
-(8233,36,45,256,2,41459,1,32),
-(8234,36,45,256,2,41459,2,32),
-(8235,36,45,512,2,41459,0,32),
-(8236,36,45,512,2,41459,1,32),
-(8237,36,45,512,2,41459,2,32),
-(8238,46,55,0,2,41459,0,32),
-(8239,46,55,4,2,41459,0,32),
-(8240,46,55,4,2,41459,1,32),
-(8241,46,55,4,2,41459,2,32),
-(8242,46,55,8,2,41459,0,32),
-(8243,46,55,8,2,41459,1,32),
-(8244,46,55,8,2,41459,2,32),
-(8245,46,55,64,2,41459,0,32),
-(8246,46,55,64,2,41459,1,32),
-(8247,46,55,64,2,41459,2,32),
-(8248,46,55,128,2,41459,0,32),
-(8249,46,55,128,2,41459,1,32),
-(8250,46,55,128,2,41459,2,32),
-(8251,46,55,256,2,41459,0,32),
-(8252,46,55,256,2,41459,1,32),
-(8253,46,55,256,2,41459,2,32),
-(8254,46,55,512,2,41459,0,32),
-(8255,46,55,512,2,41459,1,32),
-(8256,46,55,512,2,41459,2,32),
-(8257,56,65,0,2,41459,0,32),
-(8258,56,65,4,2,41459,0,32),
-(8259,56,65,4,2,41459,1,32),
-(8260,56,65,4,2,41459,2,32),
-(8261,56,65,8,2,41459,0,32),
-(8262,56,65,8,2,41459,1,32),
-(8263,56,65,8,2,41459,2,32),
-(8264,56,65,64,2,41459,0,32),
-(8265,56,65,64,2,41459,1,32),
-(8266,56,65,64,2,41459,2,32),
-(8267,56,65,128,2,41459,0,32),
-(8268,56,65,128,2,41459,1,32),
-(8269,56,65,128,2,41459,2,32),
-(8270,56,65,256,2,41459,0,32),
-(8271,56,65,256,2,41459,1,32),
-(8272,56,65,256,2,41459,2,32),
-(8273,56,65,512,2,41459,0,32),
-(8274,56,65,512,2,41459,1,32),
-(8275,56,65,512,2,41459,2,32),
-(8276,74,79,0,2,41459,0,32),
-(8277,74,79,4,2,41459,0,32),
-(8278,74,79,4,2,41459,1,32),
-(8279,74,79,4,2,41459,2,32),
-(8280,74,79,8,2,41459,0,32),
-(8281,74,79,8,2,41459,1,32),
-(8282,74,79,8,2,41459,2,32),
-(8283,74,79,64,2,41459,0,32),
-(8284,74,79,64,2,41459,1,32),
-(8285,74,79,64,2,41459,2,32),
-(8286,74,79,128,2,41459,0,32),
-(8287,74,79,128,2,41459,1,32),
-(8288,74,79,128,2,41459,2,32),
-(8289,74,79,256,2,41459,0,32),
-(8290,74,79,256,2,41459,1,32),
-(8291,74,79,256,2,41459,2,32),
-(8292,74,79,512,2,41459,0,32),
-(8293,74,79,512,2,41459,1,32),
-(8294,74,79,512,2,41459,2,32),
-(8295,80,83,0,2,41459,0,32),
-(8296,80,83,4,2,41459,0,32),
-(8297,80,83,4,2,41459,1,32),
-(8298,80,83,4,2,41459,2,32),
-(8299,80,83,8,2,41459,0,32),
-(8300,80,83,8,2,41459,1,32),
-(8301,80,83,8,2,41459,2,32),
-(8302,80,83,64,2,41459,0,32),
-(8303,80,83,64,2,41459,1,32),
-(8304,80,83,64,2,41459,2,32),
-(8305,80,83,128,2,41459,0,32),
-(8306,80,83,128,2,41459,1,32),
-(8307,80,83,128,2,41459,2,32),
-(8308,80,83,256,2,41459,0,32),
-(8309,80,83,256,2,41459,1,32),
-(8310,80,83,256,2,41459,2,32),
-(8311,80,83,512,2,41459,0,32),
-(8312,80,83,512,2,41459,1,32),
-(8313,80,83,512,2,41459,2,32),
-(8314,36,47,0,2,41459,0,32),
-(8315,36,47,4,2,41459,0,32),
-(8316,36,47,4,2,41459,1,32),
-(8317,36,47,4,2,41459,2,32),
-(8318,36,47,8,2,41459,0,32),
-(8319,36,47,8,2,41459,1,32),
-(8320,36,47,8,2,41459,2,32),
-(8321,36,47,64,2,41459,0,32),
-(8322,36,47,64,2,41459,1,32),
-(8323,36,47,64,2,41459,2,32),
-(8324,36,47,128,2,41459,0,32),
-(8325,36,47,128,2,41459,1,32),
-(8326,36,47,128,2,41459,2,32),
-(8327,36,47,256,2,41459,0,32),
-(8328,36,47,256,2,41459,1,32),
-(8329,36,47,256,2,41459,2,32),
-(8330,36,47,512,2,41459,0,32),
-(8331,36,47,512,2,41459,1,32),
-(8332,36,47,512,2,41459,2,32),
-(8333,48,59,0,2,41459,0,32),
-(8334,48,59,4,2,41459,0,32),
-(8335,48,59,4,2,41459,1,32),
-(8336,48,59,4,2,41459,2,32),
-(8337,48,59,8,2,41459,0,32),
-(8338,48,59,8,2,41459,1,32),
-(8339,48,59,8,2,41459,2,32),
-(8340,48,59,64,2,41459,0,32),
-(8341,48,59,64,2,41459,1,32),
-(8342,48,59,64,2,41459,2,32),
-(8343,48,59,128,2,41459,0,32),
-(8344,48,59,128,2,41459,1,32),
-(8345,48,59,128,2,41459,2,32),
-(8346,48,59,256,2,41459,0,32),
-(8347,48,59,256,2,41459,1,32),
-(8348,48,59,256,2,41459,2,32),
-(8349,48,59,512,2,41459,0,32),
-(8350,48,59,512,2,41459,1,32),
-(8351,48,59,512,2,41459,2,32),
-(8352,60,65,0,2,41459,0,32),
-(8353,60,65,4,2,41459,0,32),
-(8354,60,65,4,2,41459,1,32),
-(8355,60,65,4,2,41459,2,32),
-(8356,60,65,8,2,41459,0,32),
-(8357,60,65,8,2,41459,1,32),
-(8358,60,65,8,2,41459,2,32),
-(8359,60,65,64,2,41459,0,32),
-(8360,60,65,64,2,41459,1,32),
-(8361,60,65,64,2,41459,2,32),
-(8362,60,65,128,2,41459,0,32),
-(8363,60,65,128,2,41459,1,32),
-(8364,60,65,128,2,41459,2,32),
-(8365,60,65,256,2,41459,0,32),
-(8366,60,65,256,2,41459,1,32),
-(8367,60,65,256,2,41459,2,32),
-(8368,60,65,512,2,41459,0,32),
-(8369,60,65,512,2,41459,1,32),
-(8370,60,65,512,2,41459,2,32),
-(8371,66,71,0,2,41459,0,32),
-(8372,66,71,4,2,41459,0,32),
-(8373,66,71,4,2,41459,1,32),
-(8374,66,71,4,2,41459,2,32),
-(8375,66,71,8,2,41459,0,32),
-(8376,66,71,8,2,41459,1,32),
-(8377,66,71,8,2,41459,2,32),
-(8378,66,71,64,2,41459,0,32),
-(8379,66,71,64,2,41459,1,32),
-(8380,66,71,64,2,41459,2,32),
-(8381,66,71,128,2,41459,0,32),
-(8382,66,71,128,2,41459,1,32),
-(8383,66,71,128,2,41459,2,32),
-(8384,66,71,256,2,41459,0,32),
-(8385,66,71,256,2,41459,1,32),
-(8386,66,71,256,2,41459,2,32),
-(8387,66,71,512,2,41459,0,32),
-(8388,66,71,512,2,41459,1,32),
-(8389,66,71,512,2,41459,2,32),
-(8390,72,77,0,2,41459,0,32),
-(8391,72,77,4,2,41459,0,32),
-(8392,72,77,4,2,41459,1,32),
-(8393,72,77,4,2,41459,2,32),
-(8394,72,77,8,2,41459,0,32),
-(8395,72,77,8,2,41459,1,32),
-(8396,72,77,8,2,41459,2,32),
-(8397,72,77,64,2,41459,0,32),
-(8398,72,77,64,2,41459,1,32),
-(8399,72,77,64,2,41459,2,32),
-(8400,72,77,128,2,41459,0,32),
-(8401,72,77,128,2,41459,1,32),
-(8402,72,77,128,2,41459,2,32),
-(8403,72,77,256,2,41459,0,32),
-(8404,72,77,256,2,41459,1,32),
-(8405,72,77,256,2,41459,2,32),
-(8406,72,77,512,2,41459,0,32),
-(8407,72,77,512,2,41459,1,32),
-(8408,72,77,512,2,41459,2,32),
-(8409,78,83,0,2,41459,0,32),
-(8410,78,83,4,2,41459,0,32),
-(8411,78,83,4,2,41459,1,32),
-(8412,78,83,4,2,41459,2,32),
-(8413,78,83,8,2,41459,0,32),
-(8414,78,83,8,2,41459,1,32),
-(8415,78,83,8,2,41459,2,32),
-(8416,78,83,64,2,41459,0,32),
-(8417,78,83,64,2,41459,1,32),
-(8418,78,83,64,2,41459,2,32),
-(8419,78,83,128,2,41459,0,32),
-(8420,78,83,128,2,41459,1,32),
-(8421,78,83,128,2,41459,2,32),
-(8422,78,83,256,2,41459,0,32),
-(8423,78,83,256,2,41459,1,32),
-(8424,78,83,256,2,41459,2,32),
-(8425,78,83,512,2,41459,0,32),
-(8426,78,83,512,2,41459,1,32),
-(8427,78,83,512,2,41459,2,32),
-(8428,70,83,0,2,41459,0,7),
-(8429,70,83,1,2,41459,0,3),
-(8430,70,83,1,2,41459,1,3),
-(8431,70,83,1,2,41459,2,3),
-(8432,70,83,16,2,41459,0,2),
-(8433,70,83,16,2,41459,1,2),
-(8434,70,83,16,2,41459,2,2),
-(8435,70,83,128,2,41459,0,7),
-(8436,70,83,128,2,41459,1,7),
-(8437,70,83,128,2,41459,2,7),
-(8438,70,83,256,2,41459,0,7),
-(8439,70,83,256,2,41459,1,7),
-(8440,70,83,256,2,41459,2,7),
-(8441,70,83,1024,2,41459,0,7),
-(8442,70,83,1024,2,41459,1,7),
-(8443,70,83,1024,2,41459,2,7),
-(8444,70,83,2048,2,41459,0,2),
-(8445,70,83,2048,2,41459,1,2),
-(8446,70,83,2048,2,41459,2,2),
-(8447,70,83,4096,2,41459,0,2),
-(8448,70,83,4096,2,41459,1,2),
-(8449,70,83,4096,2,41459,2,2),
-(8450,70,83,8192,2,41459,0,2),
-(8451,70,83,8192,2,41459,1,2),
-(8452,70,83,8192,2,41459,2,2),
-(8453,70,83,32,2,41459,0,5),
-(8454,70,83,32,2,41459,1,5),
-(8455,70,83,32,2,41459,2,5),
-(8456,70,83,512,2,41459,0,5),
-(8457,70,83,512,2,41459,1,5),
-(8458,70,83,512,2,41459,2,5),
-(8459,70,83,2,2,41459,0,4),
-(8460,70,83,2,2,41459,1,4),
-(8461,70,83,2,2,41459,2,4),
-(8462,73,78,0,2,41459,0,7),
-(8463,73,78,1,2,41459,0,3),
-(8464,73,78,1,2,41459,1,3),
-(8465,73,78,1,2,41459,2,3),
-(8466,73,78,16,2,41459,0,2),
-(8467,73,78,16,2,41459,1,2),
-(8468,73,78,16,2,41459,2,2),
-(8469,73,78,128,2,41459,0,7),
-(8470,73,78,128,2,41459,1,7),
-(8471,73,78,128,2,41459,2,7),
-(8472,73,78,256,2,41459,0,7),
-(8473,73,78,256,2,41459,1,7),
-(8474,73,78,256,2,41459,2,7),
-(8475,73,78,1024,2,41459,0,7),
-(8476,73,78,1024,2,41459,1,7),
-(8477,73,78,1024,2,41459,2,7),
-(8478,73,78,2048,2,41459,0,2),
-(8479,73,78,2048,2,41459,1,2),
-(8480,73,78,2048,2,41459,2,2),
-(8481,73,78,4096,2,41459,0,2),
-(8482,73,78,4096,2,41459,1,2),
-(8483,73,78,4096,2,41459,2,2),
-(8484,73,78,8192,2,41459,0,2),
-(8485,73,78,8192,2,41459,1,2),
-(8486,73,78,8192,2,41459,2,2),
-(8487,73,78,32,2,41459,0,5),
-(8488,73,78,32,2,41459,1,5),
-(8489,73,78,32,2,41459,2,5),
-(8490,73,78,512,2,41459,0,5),
-(8491,73,78,512,2,41459,1,5),
-(8492,73,78,512,2,41459,2,5),
-(8493,73,78,2,2,41459,0,4),
-(8494,73,78,2,2,41459,1,4),
-(8495,73,78,2,2,41459,2,4),
-(8496,79,83,0,2,41459,0,7),
-(8497,79,83,1,2,41459,0,3),
-(8498,79,83,1,2,41459,1,3),
-(8499,79,83,1,2,41459,2,3),
-(8500,79,83,16,2,41459,0,2),
-(8501,79,83,16,2,41459,1,2),
-(8502,79,83,16,2,41459,2,2),
-(8503,79,83,128,2,41459,0,7),
-(8504,79,83,128,2,41459,1,7),
-(8505,79,83,128,2,41459,2,7),
-(8506,79,83,256,2,41459,0,7),
-(8507,79,83,256,2,41459,1,7),
-(8508,79,83,256,2,41459,2,7),
-(8509,79,83,1024,2,41459,0,7),
-(8510,79,83,1024,2,41459,1,7),
-(8511,79,83,1024,2,41459,2,7),
-(8512,79,83,2048,2,41459,0,2),
-(8513,79,83,2048,2,41459,1,2),
-(8514,79,83,2048,2,41459,2,2),
-(8515,79,83,4096,2,41459,0,2),
-(8516,79,83,4096,2,41459,1,2),
-(8517,79,83,4096,2,41459,2,2),
-(8518,79,83,8192,2,41459,0,2),
-(8519,79,83,8192,2,41459,1,2),
-(8520,79,83,8192,2,41459,2,2),
-(8521,79,83,32,2,41459,0,5),
-(8522,79,83,32,2,41459,1,5),
-(8523,79,83,32,2,41459,2,5),
-(8524,79,83,512,2,41459,0,5),
-(8525,79,83,512,2,41459,1,5),
-(8526,79,83,512,2,41459,2,5),
-(8527,79,83,2,2,41459,0,4),
-(8528,79,83,2,2,41459,1,4),
-(8529,79,83,2,2,41459,2,4),
-(8530,76,79,0,2,41459,0,7),
-(8531,76,79,1,2,41459,0,3),
-(8532,76,79,1,2,41459,1,3),
-(8533,76,79,1,2,41459,2,3),
-(8534,76,79,16,2,41459,0,2),
-(8535,76,79,16,2,41459,1,2),
-(8536,76,79,16,2,41459,2,2),
-(8537,76,79,128,2,41459,0,7),
-(8538,76,79,128,2,41459,1,7),
-(8539,76,79,128,2,41459,2,7),
-(8540,76,79,256,2,41459,0,7),
-(8541,76,79,256,2,41459,1,7),
-(8542,76,79,256,2,41459,2,7),
-(8543,76,79,1024,2,41459,0,7),
-(8544,76,79,1024,2,41459,1,7),
-(8545,76,79,1024,2,41459,2,7),
-(8546,76,79,2048,2,41459,0,2),
-(8547,76,79,2048,2,41459,1,2),
-(8548,76,79,2048,2,41459,2,2),
-(8549,76,79,4096,2,41459,0,2),
-(8550,76,79,4096,2,41459,1,2),
-(8551,76,79,4096,2,41459,2,2),
-(8552,76,79,8192,2,41459,0,2),
-(8553,76,79,8192,2,41459,1,2),
-(8554,76,79,8192,2,41459,2,2),
-(8555,76,79,32,2,41459,0,5),
-(8556,76,79,32,2,41459,1,5),
-(8557,76,79,32,2,41459,2,5),
-(8558,76,79,512,2,41459,0,5),
-(8559,76,79,512,2,41459,1,5),
-(8560,76,79,512,2,41459,2,5),
-(8561,76,79,2,2,41459,0,4),
-(8562,76,79,2,2,41459,1,4),
-(8563,76,79,2,2,41459,2,4),
-(8564,80,83,0,2,41459,0,7),
-(8565,80,83,1,2,41459,0,3),
-(8566,80,83,1,2,41459,1,3),
-(8567,80,83,1,2,41459,2,3),
-(8568,80,83,16,2,41459,0,2),
-(8569,80,83,16,2,41459,1,2),
-(8570,80,83,16,2,41459,2,2),
-(8571,80,83,128,2,41459,0,7),
-(8572,80,83,128,2,41459,1,7),
-(8573,80,83,128,2,41459,2,7),
-(8574,80,83,256,2,41459,0,7),
-(8575,80,83,256,2,41459,1,7),
-(8576,80,83,256,2,41459,2,7),
-(8577,80,83,1024,2,41459,0,7),
-(8578,80,83,1024,2,41459,1,7),
-(8579,80,83,1024,2,41459,2,7),
-(8580,80,83,2048,2,41459,0,2),
-(8581,80,83,2048,2,41459,1,2),
-(8582,80,83,2048,2,41459,2,2),
-(8583,80,83,4096,2,41459,0,2),
-(8584,80,83,4096,2,41459,1,2),
-(8585,80,83,4096,2,41459,2,2),
-(8586,80,83,8192,2,41459,0,2),
-(8587,80,83,8192,2,41459,1,2),
-(8588,80,83,8192,2,41459,2,2),
-(8589,80,83,32,2,41459,0,5),
-(8590,80,83,32,2,41459,1,5),
-(8591,80,83,32,2,41459,2,5),
-(8592,80,83,512,2,41459,0,5),
-(8593,80,83,512,2,41459,1,5),
-(8594,80,83,512,2,41459,2,5),
-(8595,80,83,2,2,41459,0,4),
-(8596,80,83,2,2,41459,1,4),
-(8597,80,83,2,2,41459,2,4),
-(8598,72,77,0,2,41459,0,7),
-(8599,72,77,1,2,41459,0,3),
-(8600,72,77,1,2,41459,1,3),
-(8601,72,77,1,2,41459,2,3),
-(8602,72,77,16,2,41459,0,2),
-(8603,72,77,16,2,41459,1,2),
-(8604,72,77,16,2,41459,2,2),
-(8605,72,77,128,2,41459,0,7),
-(8606,72,77,128,2,41459,1,7),
-(8607,72,77,128,2,41459,2,7),
-(8608,72,77,256,2,41459,0,7),
-(8609,72,77,256,2,41459,1,7),
-(8610,72,77,256,2,41459,2,7),
-(8611,72,77,1024,2,41459,0,7),
-(8612,72,77,1024,2,41459,1,7),
-(8613,72,77,1024,2,41459,2,7),
-(8614,72,77,2048,2,41459,0,2),
-(8615,72,77,2048,2,41459,1,2),
-(8616,72,77,2048,2,41459,2,2),
-(8617,72,77,4096,2,41459,0,2),
-(8618,72,77,4096,2,41459,1,2),
-(8619,72,77,4096,2,41459,2,2),
-(8620,72,77,8192,2,41459,0,2),
-(8621,72,77,8192,2,41459,1,2),
-(8622,72,77,8192,2,41459,2,2),
-(8623,72,77,32,2,41459,0,5),
-(8624,72,77,32,2,41459,1,5),
-(8625,72,77,32,2,41459,2,5),
-(8626,72,77,512,2,41459,0,5),
-(8627,72,77,512,2,41459,1,5),
-(8628,72,77,512,2,41459,2,5),
-(8629,72,77,2,2,41459,0,4),
-(8630,72,77,2,2,41459,1,4),
-(8631,72,77,2,2,41459,2,4),
-(8632,78,83,0,2,41459,0,7),
-(8633,78,83,1,2,41459,0,3),
-(8634,78,83,1,2,41459,1,3),
-(8635,78,83,1,2,41459,2,3),
-(8636,78,83,16,2,41459,0,2),
-(8637,78,83,16,2,41459,1,2),
-(8638,78,83,16,2,41459,2,2),
-(8639,78,83,128,2,41459,0,7),
-(8640,78,83,128,2,41459,1,7),
-(8641,78,83,128,2,41459,2,7),
-(8642,78,83,256,2,41459,0,7),
-(8643,78,83,256,2,41459,1,7),
-(8644,78,83,256,2,41459,2,7),
-(8645,78,83,1024,2,41459,0,7),
-(8646,78,83,1024,2,41459,1,7),
-(8647,78,83,1024,2,41459,2,7),
-(8648,78,83,2048,2,41459,0,2),
-(8649,78,83,2048,2,41459,1,2),
-(8650,78,83,2048,2,41459,2,2),
-(8651,78,83,4096,2,41459,0,2),
-(8652,78,83,4096,2,41459,1,2),
-(8653,78,83,4096,2,41459,2,2),
-(8654,78,83,8192,2,41459,0,2),
-(8655,78,83,8192,2,41459,1,2),
-(8656,78,83,8192,2,41459,2,2),
-(8657,78,83,32,2,41459,0,5),
-(8658,78,83,32,2,41459,1,5),
-(8659,78,83,32,2,41459,2,5),
-(8660,78,83,512,2,41459,0,5),
-(8661,78,83,512,2,41459,1,5),
-(8662,78,83,512,2,41459,2,5),
-(8663,78,83,2,2,41459,0,4),
-(8664,78,83,2,2,41459,1,4),
-(8665,78,83,2,2,41459,2,4),
-(8666,77,83,0,2,41459,0,7),
-(8667,77,83,1,2,41459,0,3),
-(8668,77,83,1,2,41459,1,3),
-(8669,77,83,1,2,41459,2,3),
-(8670,77,83,16,2,41459,0,2),
-(8671,77,83,16,2,41459,1,2),
-(8672,77,83,16,2,41459,2,2),
-(8673,77,83,128,2,41459,0,7),
-(8674,77,83,128,2,41459,1,7),
-(8675,77,83,128,2,41459,2,7),
-(8676,77,83,256,2,41459,0,7),
-(8677,77,83,256,2,41459,1,7),
-(8678,77,83,256,2,41459,2,7),
-(8679,77,83,1024,2,41459,0,7),
-(8680,77,83,1024,2,41459,1,7),
-(8681,77,83,1024,2,41459,2,7),
-(8682,77,83,2048,2,41459,0,2),
-(8683,77,83,2048,2,41459,1,2),
-(8684,77,83,2048,2,41459,2,2),
-(8685,77,83,4096,2,41459,0,2),
-(8686,77,83,4096,2,41459,1,2),
-(8687,77,83,4096,2,41459,2,2),
-(8688,77,83,8192,2,41459,0,2),
-(8689,77,83,8192,2,41459,1,2),
-(8690,77,83,8192,2,41459,2,2),
-(8691,77,83,32,2,41459,0,5),
-(8692,77,83,32,2,41459,1,5),
-(8693,77,83,32,2,41459,2,5),
-(8694,77,83,512,2,41459,0,5),
-(8695,77,83,512,2,41459,1,5),
-(8696,77,83,512,2,41459,2,5),
-(8697,77,83,2,2,41459,0,4),
-(8698,77,83,2,2,41459,1,4),
-(8699,77,83,2,2,41459,2,4),
-(8700,71,75,0,2,41459,0,39),
-(8701,71,75,1,2,41459,0,3),
-(8702,71,75,1,2,41459,1,3),
-(8703,71,75,1,2,41459,2,3),
-(8704,71,75,16,2,41459,0,2),
-(8705,71,75,16,2,41459,1,2),
-(8706,71,75,16,2,41459,2,2),
-(8707,71,75,128,2,41459,0,39),
-(8708,71,75,128,2,41459,1,39),
-(8709,71,75,128,2,41459,2,39),
-(8710,71,75,256,2,41459,0,39),
-(8711,71,75,256,2,41459,1,39),
-(8712,71,75,256,2,41459,2,39),
-(8713,71,75,1024,2,41459,0,7),
-(8714,71,75,1024,2,41459,1,7),
-(8715,71,75,1024,2,41459,2,7),
-(8716,71,75,2048,2,41459,0,2),
-(8717,71,75,2048,2,41459,1,2),
-(8718,71,75,2048,2,41459,2,2),
-(8719,71,75,4096,2,41459,0,2),
-(8720,71,75,4096,2,41459,1,2),
-(8721,71,75,4096,2,41459,2,2),
-(8722,71,75,8192,2,41459,0,2),
-(8723,71,75,8192,2,41459,1,2),
-(8724,71,75,8192,2,41459,2,2),
-(8725,71,75,32,2,41459,0,5),
-(8726,71,75,32,2,41459,1,5),
-(8727,71,75,32,2,41459,2,5),
-(8728,71,75,512,2,41459,0,37),
-(8729,71,75,512,2,41459,1,37),
-(8730,71,75,512,2,41459,2,37),
-(8731,71,75,2,2,41459,0,4),
-(8732,71,75,2,2,41459,1,4),
-(8733,71,75,2,2,41459,2,4),
-(8734,71,75,4,2,41459,0,32),
-(8735,71,75,4,2,41459,1,32),
-(8736,71,75,4,2,41459,2,32),
-(8737,71,75,8,2,41459,0,32),
-(8738,71,75,8,2,41459,1,32),
-(8739,71,75,8,2,41459,2,32),
-(8740,71,75,64,2,41459,0,32),
-(8741,71,75,64,2,41459,1,32),
-(8742,71,75,64,2,41459,2,32),
-(8743,76,79,0,2,41459,0,39),
-(8744,76,79,1,2,41459,0,3),
-(8745,76,79,1,2,41459,1,3),
-(8746,76,79,1,2,41459,2,3),
-(8747,76,79,16,2,41459,0,2),
-(8748,76,79,16,2,41459,1,2),
-(8749,76,79,16,2,41459,2,2),
-(8750,76,79,128,2,41459,0,39),
-(8751,76,79,128,2,41459,1,39),
-(8752,76,79,128,2,41459,2,39),
-(8753,76,79,256,2,41459,0,39),
-(8754,76,79,256,2,41459,1,39),
-(8755,76,79,256,2,41459,2,39),
-(8756,76,79,1024,2,41459,0,7),
-(8757,76,79,1024,2,41459,1,7),
-(8758,76,79,1024,2,41459,2,7),
-(8759,76,79,2048,2,41459,0,2),
-(8760,76,79,2048,2,41459,1,2),
-(8761,76,79,2048,2,41459,2,2),
-(8762,76,79,4096,2,41459,0,2),
-(8763,76,79,4096,2,41459,1,2),
-(8764,76,79,4096,2,41459,2,2),
-(8765,76,79,8192,2,41459,0,2),
-(8766,76,79,8192,2,41459,1,2),
-(8767,76,79,8192,2,41459,2,2),
-(8768,76,79,32,2,41459,0,5),
-(8769,76,79,32,2,41459,1,5),
-(8770,76,79,32,2,41459,2,5),
-(8771,76,79,512,2,41459,0,37),
-(8772,76,79,512,2,41459,1,37),
-(8773,76,79,512,2,41459,2,37),
-(8774,76,79,2,2,41459,0,4),
-(8775,76,79,2,2,41459,1,4),
-(8776,76,79,2,2,41459,2,4),
-(8777,76,79,4,2,41459,0,32),
-(8778,76,79,4,2,41459,1,32),
-(8779,76,79,4,2,41459,2,32),
-(8780,76,79,8,2,41459,0,32),
-(8781,76,79,8,2,41459,1,32),
-(8782,76,79,8,2,41459,2,32),
-(8783,76,79,64,2,41459,0,32),
-(8784,76,79,64,2,41459,1,32),
-(8785,76,79,64,2,41459,2,32),
-(8786,80,83,0,2,41459,0,39),
-(8787,80,83,1,2,41459,0,3),
-(8788,80,83,1,2,41459,1,3),
-(8789,80,83,1,2,41459,2,3),
-(8790,80,83,16,2,41459,0,2),
-(8791,80,83,16,2,41459,1,2),
-(8792,80,83,16,2,41459,2,2),
-(8793,80,83,128,2,41459,0,39),
-(8794,80,83,128,2,41459,1,39),
-(8795,80,83,128,2,41459,2,39),
-(8796,80,83,256,2,41459,0,39),
-(8797,80,83,256,2,41459,1,39),
-(8798,80,83,256,2,41459,2,39),
-(8799,80,83,1024,2,41459,0,7),
-(8800,80,83,1024,2,41459,1,7),
-(8801,80,83,1024,2,41459,2,7),
-(8802,80,83,2048,2,41459,0,2),
-(8803,80,83,2048,2,41459,1,2),
-(8804,80,83,2048,2,41459,2,2),
-(8805,80,83,4096,2,41459,0,2),
-(8806,80,83,4096,2,41459,1,2),
-(8807,80,83,4096,2,41459,2,2),
-(8808,80,83,8192,2,41459,0,2),
-(8809,80,83,8192,2,41459,1,2),
-(8810,80,83,8192,2,41459,2,2),
-(8811,80,83,32,2,41459,0,5),
-(8812,80,83,32,2,41459,1,5),
-(8813,80,83,32,2,41459,2,5),
-(8814,80,83,512,2,41459,0,37),
-(8815,80,83,512,2,41459,1,37),
-(8816,80,83,512,2,41459,2,37),
-(8817,80,83,2,2,41459,0,4),
-(8818,80,83,2,2,41459,1,4),
-(8819,80,83,2,2,41459,2,4),
-(8820,80,83,4,2,41459,0,32),
-(8821,80,83,4,2,41459,1,32),
-(8822,80,83,4,2,41459,2,32),
-(8823,80,83,8,2,41459,0,32),
-(8824,80,83,8,2,41459,1,32),
-(8825,80,83,8,2,41459,2,32),
-(8826,80,83,64,2,41459,0,32),
-(8827,80,83,64,2,41459,1,32),
-(8828,80,83,64,2,41459,2,32),
-(8829,71,75,0,2,41459,0,7),
-(8830,71,75,1,2,41459,0,3),
-(8831,71,75,1,2,41459,1,3),
-(8832,71,75,1,2,41459,2,3),
-(8833,71,75,16,2,41459,0,2),
-(8834,71,75,16,2,41459,1,2),
-(8835,71,75,16,2,41459,2,2),
-(8836,71,75,128,2,41459,0,7),
-(8837,71,75,128,2,41459,1,7),
-(8838,71,75,128,2,41459,2,7),
-(8839,71,75,256,2,41459,0,7),
-(8840,71,75,256,2,41459,1,7),
-(8841,71,75,256,2,41459,2,7),
-(8842,71,75,1024,2,41459,0,7),
-(8843,71,75,1024,2,41459,1,7),
-(8844,71,75,1024,2,41459,2,7),
-(8845,71,75,2048,2,41459,0,2),
-(8846,71,75,2048,2,41459,1,2),
-(8847,71,75,2048,2,41459,2,2),
-(8848,71,75,4096,2,41459,0,2),
-(8849,71,75,4096,2,41459,1,2),
-(8850,71,75,4096,2,41459,2,2),
-(8851,71,75,8192,2,41459,0,2),
-(8852,71,75,8192,2,41459,1,2),
-(8853,71,75,8192,2,41459,2,2),
-(8854,71,75,32,2,41459,0,5),
-(8855,71,75,32,2,41459,1,5),
-(8856,71,75,32,2,41459,2,5),
-(8857,71,75,512,2,41459,0,5),
-(8858,71,75,512,2,41459,1,5),
-(8859,71,75,512,2,41459,2,5),
-(8860,71,75,2,2,41459,0,4),
-(8861,71,75,2,2,41459,1,4),
-(8862,71,75,2,2,41459,2,4),
-(8863,76,79,0,2,41459,0,7),
-(8864,76,79,1,2,41459,0,3),
-(8865,76,79,1,2,41459,1,3),
-(8866,76,79,1,2,41459,2,3),
-(8867,76,79,16,2,41459,0,2),
-(8868,76,79,16,2,41459,1,2),
-(8869,76,79,16,2,41459,2,2),
-(8870,76,79,128,2,41459,0,7),
-(8871,76,79,128,2,41459,1,7),
-(8872,76,79,128,2,41459,2,7),
-(8873,76,79,256,2,41459,0,7),
-(8874,76,79,256,2,41459,1,7),
-(8875,76,79,256,2,41459,2,7),
-(8876,76,79,1024,2,41459,0,7),
-(8877,76,79,1024,2,41459,1,7),
-(8878,76,79,1024,2,41459,2,7),
-(8879,76,79,2048,2,41459,0,2),
-(8880,76,79,2048,2,41459,1,2),
-(8881,76,79,2048,2,41459,2,2),
-(8882,76,79,4096,2,41459,0,2),
-(8883,76,79,4096,2,41459,1,2),
-(8884,76,79,4096,2,41459,2,2),
-(8885,76,79,8192,2,41459,0,2),
-(8886,76,79,8192,2,41459,1,2),
-(8887,76,79,8192,2,41459,2,2),
-(8888,76,79,32,2,41459,0,5),
-(8889,76,79,32,2,41459,1,5),
-(8890,76,79,32,2,41459,2,5),
-(8891,76,79,512,2,41459,0,5),
-(8892,76,79,512,2,41459,1,5),
-(8893,76,79,512,2,41459,2,5),
-(8894,76,79,2,2,41459,0,4),
-(8895,76,79,2,2,41459,1,4),
-(8896,76,79,2,2,41459,2,4),
-(8897,80,83,0,2,41459,0,7),
-(8898,80,83,1,2,41459,0,3),
-(8899,80,83,1,2,41459,1,3),
-(8900,80,83,1,2,41459,2,3),
-(8901,80,83,16,2,41459,0,2),
-(8902,80,83,16,2,41459,1,2),
-(8903,80,83,16,2,41459,2,2),
-(8904,80,83,128,2,41459,0,7),
-(8905,80,83,128,2,41459,1,7),
-(8906,80,83,128,2,41459,2,7),
-(8907,80,83,256,2,41459,0,7),
-(8908,80,83,256,2,41459,1,7),
-(8909,80,83,256,2,41459,2,7),
-(8910,80,83,1024,2,41459,0,7),
-(8911,80,83,1024,2,41459,1,7),
-(8912,80,83,1024,2,41459,2,7),
-(8913,80,83,2048,2,41459,0,2),
-(8914,80,83,2048,2,41459,1,2),
-(8915,80,83,2048,2,41459,2,2),
-(8916,80,83,4096,2,41459,0,2),
-(8917,80,83,4096,2,41459,1,2),
-(8918,80,83,4096,2,41459,2,2),
-(8919,80,83,8192,2,41459,0,2),
-(8920,80,83,8192,2,41459,1,2),
-(8921,80,83,8192,2,41459,2,2),
-(8922,80,83,32,2,41459,0,5),
-(8923,80,83,32,2,41459,1,5),
-(8924,80,83,32,2,41459,2,5),
-(8925,80,83,512,2,41459,0,5),
-(8926,80,83,512,2,41459,1,5),
-(8927,80,83,512,2,41459,2,5),
-(8928,80,83,2,2,41459,0,4),
-(8929,80,83,2,2,41459,1,4),
-(8930,80,83,2,2,41459,2,4),
-(8931,71,75,0,2,41459,0,7),
-(8932,71,75,1,2,41459,0,3),
-(8933,71,75,1,2,41459,1,3),
-(8934,71,75,1,2,41459,2,3),
-(8935,71,75,16,2,41459,0,2),
-(8936,71,75,16,2,41459,1,2),
-(8937,71,75,16,2,41459,2,2),
-(8938,71,75,128,2,41459,0,7),
-(8939,71,75,128,2,41459,1,7),
-(8940,71,75,128,2,41459,2,7),
-(8941,71,75,256,2,41459,0,7),
-(8942,71,75,256,2,41459,1,7),
-(8943,71,75,256,2,41459,2,7),
-(8944,71,75,1024,2,41459,0,7),
-(8945,71,75,1024,2,41459,1,7),
-(8946,71,75,1024,2,41459,2,7),
-(8947,71,75,2048,2,41459,0,2),
-(8948,71,75,2048,2,41459,1,2),
-(8949,71,75,2048,2,41459,2,2),
-(8950,71,75,4096,2,41459,0,2),
-(8951,71,75,4096,2,41459,1,2),
-(8952,71,75,4096,2,41459,2,2),
-(8953,71,75,8192,2,41459,0,2),
-(8954,71,75,8192,2,41459,1,2),
-(8955,71,75,8192,2,41459,2,2),
-(8956,71,75,32,2,41459,0,5),
-(8957,71,75,32,2,41459,1,5),
-(8958,71,75,32,2,41459,2,5),
-(8959,71,75,512,2,41459,0,5),
-(8960,71,75,512,2,41459,1,5),
-(8961,71,75,512,2,41459,2,5),
-(8962,71,75,2,2,41459,0,4),
-(8963,71,75,2,2,41459,1,4),
-(8964,71,75,2,2,41459,2,4),
-(8965,76,79,0,2,41459,0,7),
-(8966,76,79,1,2,41459,0,3),
-(8967,76,79,1,2,41459,1,3),
-(8968,76,79,1,2,41459,2,3),
-(8969,76,79,16,2,41459,0,2),
-(8970,76,79,16,2,41459,1,2),
-(8971,76,79,16,2,41459,2,2),
-(8972,76,79,128,2,41459,0,7),
-(8973,76,79,128,2,41459,1,7),
-(8974,76,79,128,2,41459,2,7),
-(8975,76,79,256,2,41459,0,7),
-(8976,76,79,256,2,41459,1,7),
-(8977,76,79,256,2,41459,2,7),
-(8978,76,79,1024,2,41459,0,7),
-(8979,76,79,1024,2,41459,1,7),
-(8980,76,79,1024,2,41459,2,7),
-(8981,76,79,2048,2,41459,0,2),
-(8982,76,79,2048,2,41459,1,2),
-(8983,76,79,2048,2,41459,2,2),
-(8984,76,79,4096,2,41459,0,2),
-(8985,76,79,4096,2,41459,1,2),
-(8986,76,79,4096,2,41459,2,2),
-(8987,76,79,8192,2,41459,0,2),
-(8988,76,79,8192,2,41459,1,2),
-(8989,76,79,8192,2,41459,2,2),
-(8990,76,79,32,2,41459,0,5),
-(8991,76,79,32,2,41459,1,5),
-(8992,76,79,32,2,41459,2,5),
-(8993,76,79,512,2,41459,0,5),
-(8994,76,79,512,2,41459,1,5),
-(8995,76,79,512,2,41459,2,5),
-(8996,76,79,2,2,41459,0,4),
-(8997,76,79,2,2,41459,1,4),
-(8998,76,79,2,2,41459,2,4),
-(8999,80,83,0,2,41459,0,7),
-(9000,80,83,1,2,41459,0,3),
-(9001,80,83,1,2,41459,1,3),
-(9002,80,83,1,2,41459,2,3),
-(9003,80,83,16,2,41459,0,2),
-(9004,80,83,16,2,41459,1,2),
-(9005,80,83,16,2,41459,2,2),
-(9006,80,83,128,2,41459,0,7),
-(9007,80,83,128,2,41459,1,7),
-(9008,80,83,128,2,41459,2,7),
-(9009,80,83,256,2,41459,0,7),
-(9010,80,83,256,2,41459,1,7),
-(9011,80,83,256,2,41459,2,7),
-(9012,80,83,1024,2,41459,0,7),
-(9013,80,83,1024,2,41459,1,7),
-(9014,80,83,1024,2,41459,2,7),
-(9015,80,83,2048,2,41459,0,2),
-(9016,80,83,2048,2,41459,1,2),
-(9017,80,83,2048,2,41459,2,2),
-(9018,80,83,4096,2,41459,0,2),
-(9019,80,83,4096,2,41459,1,2),
-(9020,80,83,4096,2,41459,2,2),
-(9021,80,83,8192,2,41459,0,2),
-(9022,80,83,8192,2,41459,1,2),
-(9023,80,83,8192,2,41459,2,2),
-(9024,80,83,32,2,41459,0,5),
-(9025,80,83,32,2,41459,1,5),
-(9026,80,83,32,2,41459,2,5),
-(9027,80,83,512,2,41459,0,5),
-(9028,80,83,512,2,41459,1,5),
-(9029,80,83,512,2,41459,2,5),
-(9030,80,83,2,2,41459,0,4),
-(9031,80,83,2,2,41459,1,4),
-(9032,80,83,2,2,41459,2,4),
-(9033,60,83,0,2,41459,0,7),
-(9034,60,83,1,2,41459,0,3),
-(9035,60,83,1,2,41459,1,3),
-(9036,60,83,1,2,41459,2,3),
-(9037,60,83,16,2,41459,0,2),
-(9038,60,83,16,2,41459,1,2),
-(9039,60,83,16,2,41459,2,2),
-(9040,60,83,128,2,41459,0,7),
-(9041,60,83,128,2,41459,1,7),
-(9042,60,83,128,2,41459,2,7),
-(9043,60,83,256,2,41459,0,7),
-(9044,60,83,256,2,41459,1,7),
-(9045,60,83,256,2,41459,2,7),
-(9046,60,83,1024,2,41459,0,7),
-(9047,60,83,1024,2,41459,1,7),
-(9048,60,83,1024,2,41459,2,7),
-(9049,60,83,2048,2,41459,0,2),
-(9050,60,83,2048,2,41459,1,2),
-(9051,60,83,2048,2,41459,2,2),
-(9052,60,83,4096,2,41459,0,2),
-(9053,60,83,4096,2,41459,1,2),
-(9054,60,83,4096,2,41459,2,2),
-(9055,60,83,8192,2,41459,0,2),
-(9056,60,83,8192,2,41459,1,2),
-(9057,60,83,8192,2,41459,2,2),
-(9058,60,83,32,2,41459,0,5),
-(9059,60,83,32,2,41459,1,5),
-(9060,60,83,32,2,41459,2,5),
-(9061,60,83,512,2,41459,0,5),
-(9062,60,83,512,2,41459,1,5),
-(9063,60,83,512,2,41459,2,5),
-(9064,60,83,2,2,41459,0,4),
-(9065,60,83,2,2,41459,1,4),
-(9066,60,83,2,2,41459,2,4),
-(9067,60,83,0,2,41459,0,32),
-(9068,60,83,4,2,41459,0,32),
-(9069,60,83,4,2,41459,1,32),
-(9070,60,83,4,2,41459,2,32),
-(9071,60,83,8,2,41459,0,32),
-(9072,60,83,8,2,41459,1,32),
-(9073,60,83,8,2,41459,2,32),
-(9074,60,83,64,2,41459,0,32),
-(9075,60,83,64,2,41459,1,32),
-(9076,60,83,64,2,41459,2,32),
-(9077,60,83,128,2,41459,0,32),
-(9078,60,83,128,2,41459,1,32),
-(9079,60,83,128,2,41459,2,32),
-(9080,60,83,256,2,41459,0,32),
-(9081,60,83,256,2,41459,1,32),
-(9082,60,83,256,2,41459,2,32),
-(9083,60,83,512,2,41459,0,32),
-(9084,60,83,512,2,41459,1,32),
-(9085,60,83,512,2,41459,2,32),
-(9086,70,80,0,2,327692,0,23),
-(9087,70,80,1,2,327692,0,3),
-(9088,70,80,1,2,327692,1,3),
-(9089,70,80,1,2,327692,2,3),
-(9090,70,80,16,2,327692,0,2),
-(9091,70,80,16,2,327692,1,2),
-(9092,70,80,16,2,327692,2,2),
-(9093,70,80,128,2,327692,0,23),
-(9094,70,80,128,2,327692,1,23),
-(9095,70,80,128,2,327692,2,23),
-(9096,70,80,256,2,327692,0,23),
-(9097,70,80,256,2,327692,1,23),
-(9098,70,80,256,2,327692,2,23),
-(9099,70,80,1024,2,327692,0,7),
-(9100,70,80,1024,2,327692,1,7),
-(9101,70,80,1024,2,327692,2,7),
-(9102,70,80,2048,2,327692,0,2),
-(9103,70,80,2048,2,327692,1,2),
-(9104,70,80,2048,2,327692,2,2),
-(9105,70,80,4096,2,327692,0,2),
-(9106,70,80,4096,2,327692,1,2),
-(9107,70,80,4096,2,327692,2,2),
-(9108,70,80,8192,2,327692,0,2),
-(9109,70,80,8192,2,327692,1,2),
-(9110,70,80,8192,2,327692,2,2),
-(9111,70,80,32,2,327692,0,21),
-(9112,70,80,32,2,327692,1,21),
-(9113,70,80,32,2,327692,2,21),
-(9114,70,80,512,2,327692,0,21),
-(9115,70,80,512,2,327692,1,21),
-(9116,70,80,512,2,327692,2,21),
-(9117,70,80,2,2,327692,0,20),
-(9118,70,80,2,2,327692,1,20),
-(9119,70,80,2,2,327692,2,20),
-(9120,75,83,0,2,41459,0,2),
-(9121,75,83,1,2,41459,0,2),
-(9122,75,83,1,2,41459,1,2),
-(9123,75,83,1,2,41459,2,2),
-(9124,75,83,16,2,41459,0,2),
-(9125,75,83,16,2,41459,1,2),
-(9126,75,83,16,2,41459,2,2),
-(9127,75,83,128,2,41459,0,2),
-(9128,75,83,128,2,41459,1,2),
-(9129,75,83,128,2,41459,2,2),
-(9130,75,83,256,2,41459,0,2),
-(9131,75,83,256,2,41459,1,2),
-(9132,75,83,256,2,41459,2,2),
-(9133,75,83,1024,2,41459,0,2),
-(9134,75,83,1024,2,41459,1,2),
-(9135,75,83,1024,2,41459,2,2),
-(9136,75,83,2048,2,41459,0,2),
-(9137,75,83,2048,2,41459,1,2),
-(9138,75,83,2048,2,41459,2,2),
-(9139,75,83,4096,2,41459,0,2),
-(9140,75,83,4096,2,41459,1,2),
-(9141,75,83,4096,2,41459,2,2),
-(9142,75,83,8192,2,41459,0,2),
-(9143,75,83,8192,2,41459,1,2),
-(9144,75,83,8192,2,41459,2,2),
-(9145,75,83,0,2,41459,0,10),
-(9146,75,83,1,2,41459,0,2),
-(9147,75,83,1,2,41459,1,2),
-(9148,75,83,1,2,41459,2,2),
-(9149,75,83,16,2,41459,0,10),
-(9150,75,83,16,2,41459,1,10),
-(9151,75,83,16,2,41459,2,10),
-(9152,75,83,128,2,41459,0,10),
-(9153,75,83,128,2,41459,1,10),
-(9154,75,83,128,2,41459,2,10),
-(9155,75,83,256,2,41459,0,10),
-(9156,75,83,256,2,41459,1,10),
-(9157,75,83,256,2,41459,2,10),
-(9158,75,83,1024,2,41459,0,10),
-(9159,75,83,1024,2,41459,1,10),
-(9160,75,83,1024,2,41459,2,10),
-(9161,75,83,2048,2,41459,0,10),
-(9162,75,83,2048,2,41459,1,10),
-(9163,75,83,2048,2,41459,2,10),
-(9164,75,83,4096,2,41459,0,10),
-(9165,75,83,4096,2,41459,1,10),
-(9166,75,83,4096,2,41459,2,10),
-(9167,75,83,8192,2,41459,0,2),
-(9168,75,83,8192,2,41459,1,2),
-(9169,75,83,8192,2,41459,2,2),
-(9170,75,83,2,2,41459,0,8),
-(9171,75,83,2,2,41459,1,8),
-(9172,75,83,2,2,41459,2,8);
+(1000,0,0,1,0,0,0,0,1),
+(1001,0,0,1,0,0,1,0,1),
+(1002,0,0,1,0,0,2,0,1),
+(1003,0,0,1,0,0,3,0,1),
+(1004,0,0,2,0,0,0,0,1),
+(1005,0,0,2,0,0,1,0,1),
+(1006,0,0,2,0,0,2,0,1),
+(1007,0,0,2,0,0,3,0,1),
+(1008,0,0,4,0,0,0,0,1),
+(1009,0,0,4,0,0,1,0,1),
+(1010,0,0,4,0,0,2,0,1),
+(1011,0,0,4,0,0,3,0,1),
+(1012,0,0,8,0,0,0,0,1),
+(1013,0,0,8,0,0,1,0,1),
+(1014,0,0,8,0,0,2,0,1),
+(1015,0,0,8,0,0,3,0,1),
+(1016,0,0,16,0,0,0,0,1),
+(1017,0,0,16,0,0,1,0,1),
+(1018,0,0,16,0,0,2,0,1),
+(1019,0,0,16,0,0,3,0,1),
+(1020,0,0,32,0,0,0,0,1),
+(1021,0,0,32,0,0,1,0,1),
+(1022,0,0,32,0,0,2,0,1),
+(1023,0,0,32,0,0,3,0,1),
+(1024,0,0,64,0,0,0,0,1),
+(1025,0,0,64,0,0,1,0,1),
+(1026,0,0,64,0,0,2,0,1),
+(1027,0,0,64,0,0,3,0,1),
+(1028,0,0,128,0,0,0,0,1),
+(1029,0,0,128,0,0,1,0,1),
+(1030,0,0,128,0,0,2,0,1),
+(1031,0,0,128,0,0,3,0,1),
+(1032,0,0,256,0,0,0,0,1),
+(1033,0,0,256,0,0,1,0,1),
+(1034,0,0,256,0,0,2,0,1),
+(1035,0,0,256,0,0,3,0,1),
+(1036,0,0,512,0,0,0,0,1),
+(1037,0,0,512,0,0,1,0,1),
+(1038,0,0,512,0,0,2,0,1),
+(1039,0,0,512,0,0,3,0,1),
+(1040,0,0,1024,0,0,0,0,1),
+(1041,0,0,1024,0,0,1,0,1),
+(1042,0,0,1024,0,0,2,0,1),
+(1043,0,0,1024,0,0,3,0,1),
+(1044,0,0,2048,0,0,0,0,1),
+(1045,0,0,2048,0,0,1,0,1),
+(1046,0,0,2048,0,0,2,0,1),
+(1047,0,0,2048,0,0,3,0,1),
+(1048,0,0,4096,0,0,0,0,1),
+(1049,0,0,4096,0,0,1,0,1),
+(1050,0,0,4096,0,0,2,0,1),
+(1051,0,0,4096,0,0,3,0,1),
+(1052,0,0,8192,0,0,0,0,1),
+(1053,0,0,8192,0,0,1,0,1),
+(1054,0,0,8192,0,0,2,0,1),
+(1055,0,0,8192,0,0,3,0,1),
+(1056,0,0,3,0,0,0,0,1),
+(1057,0,0,3,0,0,1,0,1),
+(1058,0,0,3,0,0,2,0,1),
+(1059,0,0,3,0,0,3,0,1),
+(1060,0,0,5,0,0,0,0,1),
+(1061,0,0,5,0,0,1,0,1),
+(1062,0,0,5,0,0,2,0,1),
+(1063,0,0,5,0,0,3,0,1),
+(1064,0,0,17,0,0,0,0,1),
+(1065,0,0,17,0,0,1,0,1),
+(1066,0,0,17,0,0,2,0,1),
+(1067,0,0,17,0,0,3,0,1),
+(1068,0,0,33,0,0,0,0,1),
+(1069,0,0,33,0,0,1,0,1),
+(1070,0,0,33,0,0,2,0,1),
+(1071,0,0,33,0,0,3,0,1),
+(1072,0,0,65,0,0,0,0,1),
+(1073,0,0,65,0,0,1,0,1),
+(1074,0,0,65,0,0,2,0,1),
+(1075,0,0,65,0,0,3,0,1),
+(1076,0,0,129,0,0,0,0,1),
+(1077,0,0,129,0,0,1,0,1),
+(1078,0,0,129,0,0,2,0,1),
+(1079,0,0,129,0,0,3,0,1),
+(1080,0,0,257,0,0,0,0,1),
+(1081,0,0,257,0,0,1,0,1),
+(1082,0,0,257,0,0,2,0,1),
+(1083,0,0,257,0,0,3,0,1),
+(1084,0,0,513,0,0,0,0,1),
+(1085,0,0,513,0,0,1,0,1),
+(1086,0,0,513,0,0,2,0,1),
+(1087,0,0,513,0,0,3,0,1),
+(1088,0,0,1025,0,0,0,0,1),
+(1089,0,0,1025,0,0,1,0,1),
+(1090,0,0,1025,0,0,2,0,1),
+(1091,0,0,1025,0,0,3,0,1),
+(1092,0,0,2049,0,0,0,0,1),
+(1093,0,0,2049,0,0,1,0,1),
+(1094,0,0,2049,0,0,2,0,1),
+(1095,0,0,2049,0,0,3,0,1),
+(1096,0,0,4097,0,0,0,0,1),
+(1097,0,0,4097,0,0,1,0,1),
+(1098,0,0,4097,0,0,2,0,1),
+(1099,0,0,4097,0,0,3,0,1),
+(1100,0,0,8193,0,0,0,0,1),
+(1101,0,0,8193,0,0,1,0,1),
+(1102,0,0,8193,0,0,2,0,1),
+(1103,0,0,8193,0,0,3,0,1),
+(1104,0,0,6,0,0,0,0,1),
+(1105,0,0,6,0,0,1,0,1),
+(1106,0,0,6,0,0,2,0,1),
+(1107,0,0,6,0,0,3,0,1),
+(1108,0,0,18,0,0,0,0,1),
+(1109,0,0,18,0,0,1,0,1),
+(1110,0,0,18,0,0,2,0,1),
+(1111,0,0,18,0,0,3,0,1),
+(1112,0,0,34,0,0,0,0,1),
+(1113,0,0,34,0,0,1,0,1),
+(1114,0,0,34,0,0,2,0,1),
+(1115,0,0,34,0,0,3,0,1),
+(1116,0,0,66,0,0,0,0,1),
+(1117,0,0,66,0,0,1,0,1),
+(1118,0,0,66,0,0,2,0,1),
+(1119,0,0,66,0,0,3,0,1),
+(1120,0,0,130,0,0,0,0,1),
+(1121,0,0,130,0,0,1,0,1),
+(1122,0,0,130,0,0,2,0,1),
+(1123,0,0,130,0,0,3,0,1),
+(1124,0,0,258,0,0,0,0,1),
+(1125,0,0,258,0,0,1,0,1),
+(1126,0,0,258,0,0,2,0,1),
+(1127,0,0,258,0,0,3,0,1),
+(1128,0,0,514,0,0,0,0,1),
+(1129,0,0,514,0,0,1,0,1),
+(1130,0,0,514,0,0,2,0,1),
+(1131,0,0,514,0,0,3,0,1),
+(1132,0,0,1026,0,0,0,0,1),
+(1133,0,0,1026,0,0,1,0,1),
+(1134,0,0,1026,0,0,2,0,1),
+(1135,0,0,1026,0,0,3,0,1),
+(1136,0,0,2050,0,0,0,0,1),
+(1137,0,0,2050,0,0,1,0,1),
+(1138,0,0,2050,0,0,2,0,1),
+(1139,0,0,2050,0,0,3,0,1),
+(1140,0,0,4098,0,0,0,0,1),
+(1141,0,0,4098,0,0,1,0,1),
+(1142,0,0,4098,0,0,2,0,1),
+(1143,0,0,4098,0,0,3,0,1),
+(1144,0,0,12,0,0,0,0,1),
+(1145,0,0,12,0,0,1,0,1),
+(1146,0,0,12,0,0,2,0,1),
+(1147,0,0,12,0,0,3,0,1),
+(1148,0,0,20,0,0,0,0,1),
+(1149,0,0,20,0,0,1,0,1),
+(1150,0,0,20,0,0,2,0,1),
+(1151,0,0,20,0,0,3,0,1),
+(1152,0,0,68,0,0,0,0,1),
+(1153,0,0,68,0,0,1,0,1),
+(1154,0,0,68,0,0,2,0,1),
+(1155,0,0,68,0,0,3,0,1),
+(1156,0,0,132,0,0,0,0,1),
+(1157,0,0,132,0,0,1,0,1),
+(1158,0,0,132,0,0,2,0,1),
+(1159,0,0,132,0,0,3,0,1),
+(1160,0,0,260,0,0,0,0,1),
+(1161,0,0,260,0,0,1,0,1),
+(1162,0,0,260,0,0,2,0,1),
+(1163,0,0,260,0,0,3,0,1),
+(1164,0,0,516,0,0,0,0,1),
+(1165,0,0,516,0,0,1,0,1),
+(1166,0,0,516,0,0,2,0,1),
+(1167,0,0,516,0,0,3,0,1),
+(1168,0,0,24,0,0,0,0,1),
+(1169,0,0,24,0,0,1,0,1),
+(1170,0,0,24,0,0,2,0,1),
+(1171,0,0,24,0,0,3,0,1),
+(1172,0,0,72,0,0,0,0,1),
+(1173,0,0,72,0,0,1,0,1),
+(1174,0,0,72,0,0,2,0,1),
+(1175,0,0,72,0,0,3,0,1),
+(1176,0,0,136,0,0,0,0,1),
+(1177,0,0,136,0,0,1,0,1),
+(1178,0,0,136,0,0,2,0,1),
+(1179,0,0,136,0,0,3,0,1),
+(1180,0,0,264,0,0,0,0,1),
+(1181,0,0,264,0,0,1,0,1),
+(1182,0,0,264,0,0,2,0,1),
+(1183,0,0,264,0,0,3,0,1),
+(1184,0,0,520,0,0,0,0,1),
+(1185,0,0,520,0,0,1,0,1),
+(1186,0,0,520,0,0,2,0,1),
+(1187,0,0,520,0,0,3,0,1),
+(1188,0,0,48,0,0,0,0,1),
+(1189,0,0,48,0,0,1,0,1),
+(1190,0,0,48,0,0,2,0,1),
+(1191,0,0,48,0,0,3,0,1),
+(1192,0,0,80,0,0,0,0,1),
+(1193,0,0,80,0,0,1,0,1),
+(1194,0,0,80,0,0,2,0,1),
+(1195,0,0,80,0,0,3,0,1),
+(1196,0,0,144,0,0,0,0,1),
+(1197,0,0,144,0,0,1,0,1),
+(1198,0,0,144,0,0,2,0,1),
+(1199,0,0,144,0,0,3,0,1),
+(1200,0,0,272,0,0,0,0,1),
+(1201,0,0,272,0,0,1,0,1),
+(1202,0,0,272,0,0,2,0,1),
+(1203,0,0,272,0,0,3,0,1),
+(1204,0,0,528,0,0,0,0,1),
+(1205,0,0,528,0,0,1,0,1),
+(1206,0,0,528,0,0,2,0,1),
+(1207,0,0,528,0,0,3,0,1),
+(1208,0,0,1040,0,0,0,0,1),
+(1209,0,0,1040,0,0,1,0,1),
+(1210,0,0,1040,0,0,2,0,1),
+(1211,0,0,1040,0,0,3,0,1),
+(1212,0,0,2064,0,0,0,0,1),
+(1213,0,0,2064,0,0,1,0,1),
+(1214,0,0,2064,0,0,2,0,1),
+(1215,0,0,2064,0,0,3,0,1),
+(1216,0,0,4112,0,0,0,0,1),
+(1217,0,0,4112,0,0,1,0,1),
+(1218,0,0,4112,0,0,2,0,1),
+(1219,0,0,4112,0,0,3,0,1),
+(1220,0,0,8208,0,0,0,0,1),
+(1221,0,0,8208,0,0,1,0,1),
+(1222,0,0,8208,0,0,2,0,1),
+(1223,0,0,8208,0,0,3,0,1),
+(1224,0,0,160,0,0,0,0,1),
+(1225,0,0,160,0,0,1,0,1),
+(1226,0,0,160,0,0,2,0,1),
+(1227,0,0,160,0,0,3,0,1),
+(1228,0,0,288,0,0,0,0,1),
+(1229,0,0,288,0,0,1,0,1),
+(1230,0,0,288,0,0,2,0,1),
+(1231,0,0,288,0,0,3,0,1),
+(1232,0,0,544,0,0,0,0,1),
+(1233,0,0,544,0,0,1,0,1),
+(1234,0,0,544,0,0,2,0,1),
+(1235,0,0,544,0,0,3,0,1),
+(1236,0,0,1056,0,0,0,0,1),
+(1237,0,0,1056,0,0,1,0,1),
+(1238,0,0,1056,0,0,2,0,1),
+(1239,0,0,1056,0,0,3,0,1),
+(1240,0,0,2080,0,0,0,0,1),
+(1241,0,0,2080,0,0,1,0,1),
+(1242,0,0,2080,0,0,2,0,1),
+(1243,0,0,2080,0,0,3,0,1),
+(1244,0,0,4128,0,0,0,0,1),
+(1245,0,0,4128,0,0,1,0,1),
+(1246,0,0,4128,0,0,2,0,1),
+(1247,0,0,4128,0,0,3,0,1),
+(1248,0,0,8224,0,0,0,0,1),
+(1249,0,0,8224,0,0,1,0,1),
+(1250,0,0,8224,0,0,2,0,1),
+(1251,0,0,8224,0,0,3,0,1),
+(1252,0,0,192,0,0,0,0,1),
+(1253,0,0,192,0,0,1,0,1),
+(1254,0,0,192,0,0,2,0,1),
+(1255,0,0,192,0,0,3,0,1),
+(1256,0,0,320,0,0,0,0,1),
+(1257,0,0,320,0,0,1,0,1),
+(1258,0,0,320,0,0,2,0,1),
+(1259,0,0,320,0,0,3,0,1),
+(1260,0,0,576,0,0,0,0,1),
+(1261,0,0,576,0,0,1,0,1),
+(1262,0,0,576,0,0,2,0,1),
+(1263,0,0,576,0,0,3,0,1),
+(1264,0,0,384,0,0,0,0,1),
+(1265,0,0,384,0,0,1,0,1),
+(1266,0,0,384,0,0,2,0,1),
+(1267,0,0,384,0,0,3,0,1),
+(1268,0,0,640,0,0,0,0,1),
+(1269,0,0,640,0,0,1,0,1),
+(1270,0,0,640,0,0,2,0,1),
+(1271,0,0,640,0,0,3,0,1),
+(1272,0,0,1152,0,0,0,0,1),
+(1273,0,0,1152,0,0,1,0,1),
+(1274,0,0,1152,0,0,2,0,1),
+(1275,0,0,1152,0,0,3,0,1),
+(1276,0,0,2176,0,0,0,0,1),
+(1277,0,0,2176,0,0,1,0,1),
+(1278,0,0,2176,0,0,2,0,1),
+(1279,0,0,2176,0,0,3,0,1),
+(1280,0,0,4224,0,0,0,0,1),
+(1281,0,0,4224,0,0,1,0,1),
+(1282,0,0,4224,0,0,2,0,1),
+(1283,0,0,4224,0,0,3,0,1),
+(1284,0,0,8320,0,0,0,0,1),
+(1285,0,0,8320,0,0,1,0,1),
+(1286,0,0,8320,0,0,2,0,1),
+(1287,0,0,8320,0,0,3,0,1),
+(1288,0,0,768,0,0,0,0,1),
+(1289,0,0,768,0,0,1,0,1),
+(1290,0,0,768,0,0,2,0,1),
+(1291,0,0,768,0,0,3,0,1),
+(1292,0,0,1280,0,0,0,0,1),
+(1293,0,0,1280,0,0,1,0,1),
+(1294,0,0,1280,0,0,2,0,1),
+(1295,0,0,1280,0,0,3,0,1),
+(1296,0,0,2304,0,0,0,0,1),
+(1297,0,0,2304,0,0,1,0,1),
+(1298,0,0,2304,0,0,2,0,1),
+(1299,0,0,2304,0,0,3,0,1),
+(1300,0,0,4352,0,0,0,0,1),
+(1301,0,0,4352,0,0,1,0,1),
+(1302,0,0,4352,0,0,2,0,1),
+(1303,0,0,4352,0,0,3,0,1),
+(1304,0,0,8448,0,0,0,0,1),
+(1305,0,0,8448,0,0,1,0,1),
+(1306,0,0,8448,0,0,2,0,1),
+(1307,0,0,8448,0,0,3,0,1),
+(1308,0,0,1536,0,0,0,0,1),
+(1309,0,0,1536,0,0,1,0,1),
+(1310,0,0,1536,0,0,2,0,1),
+(1311,0,0,1536,0,0,3,0,1),
+(1312,0,0,2560,0,0,0,0,1),
+(1313,0,0,2560,0,0,1,0,1),
+(1314,0,0,2560,0,0,2,0,1),
+(1315,0,0,2560,0,0,3,0,1),
+(1316,0,0,4608,0,0,0,0,1),
+(1317,0,0,4608,0,0,1,0,1),
+(1318,0,0,4608,0,0,2,0,1),
+(1319,0,0,4608,0,0,3,0,1),
+(1320,0,0,8704,0,0,0,0,1),
+(1321,0,0,8704,0,0,1,0,1),
+(1322,0,0,8704,0,0,2,0,1),
+(1323,0,0,8704,0,0,3,0,1),
+(1324,0,0,3072,0,0,0,0,1),
+(1325,0,0,3072,0,0,1,0,1),
+(1326,0,0,3072,0,0,2,0,1),
+(1327,0,0,3072,0,0,3,0,1),
+(1328,0,0,5120,0,0,0,0,1),
+(1329,0,0,5120,0,0,1,0,1),
+(1330,0,0,5120,0,0,2,0,1),
+(1331,0,0,5120,0,0,3,0,1),
+(1332,0,0,9216,0,0,0,0,1),
+(1333,0,0,9216,0,0,1,0,1),
+(1334,0,0,9216,0,0,2,0,1),
+(1335,0,0,9216,0,0,3,0,1),
+(1336,0,0,6144,0,0,0,0,1),
+(1337,0,0,6144,0,0,1,0,1),
+(1338,0,0,6144,0,0,2,0,1),
+(1339,0,0,6144,0,0,3,0,1),
+(1340,0,0,10240,0,0,0,0,1),
+(1341,0,0,10240,0,0,1,0,1),
+(1342,0,0,10240,0,0,2,0,1),
+(1343,0,0,10240,0,0,3,0,1),
+(1344,0,0,12288,0,0,0,0,1),
+(1345,0,0,12288,0,0,1,0,1),
+(1346,0,0,12288,0,0,2,0,1),
+(1347,0,0,12288,0,0,3,0,1),
+(1348,0,0,19,0,0,0,0,1),
+(1349,0,0,19,0,0,1,0,1),
+(1350,0,0,19,0,0,2,0,1),
+(1351,0,0,19,0,0,3,0,1),
+(1352,0,0,35,0,0,0,0,1),
+(1353,0,0,35,0,0,1,0,1),
+(1354,0,0,35,0,0,2,0,1),
+(1355,0,0,35,0,0,3,0,1),
+(1356,0,0,67,0,0,0,0,1),
+(1357,0,0,67,0,0,1,0,1),
+(1358,0,0,67,0,0,2,0,1),
+(1359,0,0,67,0,0,3,0,1),
+(1360,0,0,131,0,0,0,0,1),
+(1361,0,0,131,0,0,1,0,1),
+(1362,0,0,131,0,0,2,0,1),
+(1363,0,0,131,0,0,3,0,1),
+(1364,0,0,259,0,0,0,0,1),
+(1365,0,0,259,0,0,1,0,1),
+(1366,0,0,259,0,0,2,0,1),
+(1367,0,0,259,0,0,3,0,1),
+(1368,0,0,515,0,0,0,0,1),
+(1369,0,0,515,0,0,1,0,1),
+(1370,0,0,515,0,0,2,0,1),
+(1371,0,0,515,0,0,3,0,1),
+(1372,0,0,1027,0,0,0,0,1),
+(1373,0,0,1027,0,0,1,0,1),
+(1374,0,0,1027,0,0,2,0,1),
+(1375,0,0,1027,0,0,3,0,1),
+(1376,0,0,2051,0,0,0,0,1),
+(1377,0,0,2051,0,0,1,0,1),
+(1378,0,0,2051,0,0,2,0,1),
+(1379,0,0,2051,0,0,3,0,1),
+(1380,0,0,4099,0,0,0,0,1),
+(1381,0,0,4099,0,0,1,0,1),
+(1382,0,0,4099,0,0,2,0,1),
+(1383,0,0,4099,0,0,3,0,1),
+(1384,0,0,21,0,0,0,0,1),
+(1385,0,0,21,0,0,1,0,1),
+(1386,0,0,21,0,0,2,0,1),
+(1387,0,0,21,0,0,3,0,1),
+(1388,0,0,37,0,0,0,0,1),
+(1389,0,0,37,0,0,1,0,1),
+(1390,0,0,37,0,0,2,0,1),
+(1391,0,0,37,0,0,3,0,1),
+(1392,0,0,69,0,0,0,0,1),
+(1393,0,0,69,0,0,1,0,1),
+(1394,0,0,69,0,0,2,0,1),
+(1395,0,0,69,0,0,3,0,1),
+(1396,0,0,133,0,0,0,0,1),
+(1397,0,0,133,0,0,1,0,1),
+(1398,0,0,133,0,0,2,0,1),
+(1399,0,0,133,0,0,3,0,1),
+(1400,0,0,261,0,0,0,0,1),
+(1401,0,0,261,0,0,1,0,1),
+(1402,0,0,261,0,0,2,0,1),
+(1403,0,0,261,0,0,3,0,1),
+(1404,0,0,517,0,0,0,0,1),
+(1405,0,0,517,0,0,1,0,1),
+(1406,0,0,517,0,0,2,0,1),
+(1407,0,0,517,0,0,3,0,1),
+(1408,0,0,1029,0,0,0,0,1),
+(1409,0,0,1029,0,0,1,0,1),
+(1410,0,0,1029,0,0,2,0,1),
+(1411,0,0,1029,0,0,3,0,1),
+(1412,0,0,2053,0,0,0,0,1),
+(1413,0,0,2053,0,0,1,0,1),
+(1414,0,0,2053,0,0,2,0,1),
+(1415,0,0,2053,0,0,3,0,1),
+(1416,0,0,4101,0,0,0,0,1),
+(1417,0,0,4101,0,0,1,0,1),
+(1418,0,0,4101,0,0,2,0,1),
+(1419,0,0,4101,0,0,3,0,1),
+(1420,0,0,8197,0,0,0,0,1),
+(1421,0,0,8197,0,0,1,0,1),
+(1422,0,0,8197,0,0,2,0,1),
+(1423,0,0,8197,0,0,3,0,1),
+(1424,0,0,49,0,0,0,0,1),
+(1425,0,0,49,0,0,1,0,1),
+(1426,0,0,49,0,0,2,0,1),
+(1427,0,0,49,0,0,3,0,1),
+(1428,0,0,81,0,0,0,0,1),
+(1429,0,0,81,0,0,1,0,1),
+(1430,0,0,81,0,0,2,0,1),
+(1431,0,0,81,0,0,3,0,1),
+(1432,0,0,145,0,0,0,0,1),
+(1433,0,0,145,0,0,1,0,1),
+(1434,0,0,145,0,0,2,0,1),
+(1435,0,0,145,0,0,3,0,1),
+(1436,0,0,273,0,0,0,0,1),
+(1437,0,0,273,0,0,1,0,1),
+(1438,0,0,273,0,0,2,0,1),
+(1439,0,0,273,0,0,3,0,1),
+(1440,0,0,529,0,0,0,0,1),
+(1441,0,0,529,0,0,1,0,1),
+(1442,0,0,529,0,0,2,0,1),
+(1443,0,0,529,0,0,3,0,1),
+(1444,0,0,1041,0,0,0,0,1),
+(1445,0,0,1041,0,0,1,0,1),
+(1446,0,0,1041,0,0,2,0,1),
+(1447,0,0,1041,0,0,3,0,1),
+(1448,0,0,2065,0,0,0,0,1),
+(1449,0,0,2065,0,0,1,0,1),
+(1450,0,0,2065,0,0,2,0,1),
+(1451,0,0,2065,0,0,3,0,1),
+(1452,0,0,4113,0,0,0,0,1),
+(1453,0,0,4113,0,0,1,0,1),
+(1454,0,0,4113,0,0,2,0,1),
+(1455,0,0,4113,0,0,3,0,1),
+(1456,0,0,8209,0,0,0,0,1),
+(1457,0,0,8209,0,0,1,0,1),
+(1458,0,0,8209,0,0,2,0,1),
+(1459,0,0,8209,0,0,3,0,1),
+(1460,0,0,97,0,0,0,0,1),
+(1461,0,0,97,0,0,1,0,1),
+(1462,0,0,97,0,0,2,0,1),
+(1463,0,0,97,0,0,3,0,1),
+(1464,0,0,161,0,0,0,0,1),
+(1465,0,0,161,0,0,1,0,1),
+(1466,0,0,161,0,0,2,0,1),
+(1467,0,0,161,0,0,3,0,1),
+(1468,0,0,289,0,0,0,0,1),
+(1469,0,0,289,0,0,1,0,1),
+(1470,0,0,289,0,0,2,0,1),
+(1471,0,0,289,0,0,3,0,1),
+(1472,0,0,545,0,0,0,0,1),
+(1473,0,0,545,0,0,1,0,1),
+(1474,0,0,545,0,0,2,0,1),
+(1475,0,0,545,0,0,3,0,1),
+(1476,0,0,1057,0,0,0,0,1),
+(1477,0,0,1057,0,0,1,0,1),
+(1478,0,0,1057,0,0,2,0,1),
+(1479,0,0,1057,0,0,3,0,1),
+(1480,0,0,2081,0,0,0,0,1),
+(1481,0,0,2081,0,0,1,0,1),
+(1482,0,0,2081,0,0,2,0,1),
+(1483,0,0,2081,0,0,3,0,1),
+(1484,0,0,4129,0,0,0,0,1),
+(1485,0,0,4129,0,0,1,0,1),
+(1486,0,0,4129,0,0,2,0,1),
+(1487,0,0,4129,0,0,3,0,1),
+(1488,0,0,8225,0,0,0,0,1),
+(1489,0,0,8225,0,0,1,0,1),
+(1490,0,0,8225,0,0,2,0,1),
+(1491,0,0,8225,0,0,3,0,1),
+(1492,0,0,193,0,0,0,0,1),
+(1493,0,0,193,0,0,1,0,1),
+(1494,0,0,193,0,0,2,0,1),
+(1495,0,0,193,0,0,3,0,1),
+(1496,0,0,321,0,0,0,0,1),
+(1497,0,0,321,0,0,1,0,1),
+(1498,0,0,321,0,0,2,0,1),
+(1499,0,0,321,0,0,3,0,1),
+(1500,0,0,577,0,0,0,0,1),
+(1501,0,0,577,0,0,1,0,1),
+(1502,0,0,577,0,0,2,0,1),
+(1503,0,0,577,0,0,3,0,1),
+(1504,0,0,1089,0,0,0,0,1),
+(1505,0,0,1089,0,0,1,0,1),
+(1506,0,0,1089,0,0,2,0,1),
+(1507,0,0,1089,0,0,3,0,1),
+(1508,0,0,2113,0,0,0,0,1),
+(1509,0,0,2113,0,0,1,0,1),
+(1510,0,0,2113,0,0,2,0,1),
+(1511,0,0,2113,0,0,3,0,1),
+(1512,0,0,4161,0,0,0,0,1),
+(1513,0,0,4161,0,0,1,0,1),
+(1514,0,0,4161,0,0,2,0,1),
+(1515,0,0,4161,0,0,3,0,1),
+(1516,0,0,8257,0,0,0,0,1),
+(1517,0,0,8257,0,0,1,0,1),
+(1518,0,0,8257,0,0,2,0,1),
+(1519,0,0,8257,0,0,3,0,1),
+(1520,0,0,385,0,0,0,0,1),
+(1521,0,0,385,0,0,1,0,1),
+(1522,0,0,385,0,0,2,0,1),
+(1523,0,0,385,0,0,3,0,1),
+(1524,0,0,641,0,0,0,0,1),
+(1525,0,0,641,0,0,1,0,1),
+(1526,0,0,641,0,0,2,0,1),
+(1527,0,0,641,0,0,3,0,1),
+(1528,0,0,1153,0,0,0,0,1),
+(1529,0,0,1153,0,0,1,0,1),
+(1530,0,0,1153,0,0,2,0,1),
+(1531,0,0,1153,0,0,3,0,1),
+(1532,0,0,2177,0,0,0,0,1),
+(1533,0,0,2177,0,0,1,0,1),
+(1534,0,0,2177,0,0,2,0,1),
+(1535,0,0,2177,0,0,3,0,1),
+(1536,0,0,4225,0,0,0,0,1),
+(1537,0,0,4225,0,0,1,0,1),
+(1538,0,0,4225,0,0,2,0,1),
+(1539,0,0,4225,0,0,3,0,1),
+(1540,0,0,8321,0,0,0,0,1),
+(1541,0,0,8321,0,0,1,0,1),
+(1542,0,0,8321,0,0,2,0,1),
+(1543,0,0,8321,0,0,3,0,1),
+(1544,0,0,769,0,0,0,0,1),
+(1545,0,0,769,0,0,1,0,1),
+(1546,0,0,769,0,0,2,0,1),
+(1547,0,0,769,0,0,3,0,1),
+(1548,0,0,1281,0,0,0,0,1),
+(1549,0,0,1281,0,0,1,0,1),
+(1550,0,0,1281,0,0,2,0,1),
+(1551,0,0,1281,0,0,3,0,1),
+(1552,0,0,2305,0,0,0,0,1),
+(1553,0,0,2305,0,0,1,0,1),
+(1554,0,0,2305,0,0,2,0,1),
+(1555,0,0,2305,0,0,3,0,1),
+(1556,0,0,4353,0,0,0,0,1),
+(1557,0,0,4353,0,0,1,0,1),
+(1558,0,0,4353,0,0,2,0,1),
+(1559,0,0,4353,0,0,3,0,1),
+(1560,0,0,8449,0,0,0,0,1),
+(1561,0,0,8449,0,0,1,0,1),
+(1562,0,0,8449,0,0,2,0,1),
+(1563,0,0,8449,0,0,3,0,1),
+(1564,0,0,1537,0,0,0,0,1),
+(1565,0,0,1537,0,0,1,0,1),
+(1566,0,0,1537,0,0,2,0,1),
+(1567,0,0,1537,0,0,3,0,1),
+(1568,0,0,2561,0,0,0,0,1),
+(1569,0,0,2561,0,0,1,0,1),
+(1570,0,0,2561,0,0,2,0,1),
+(1571,0,0,2561,0,0,3,0,1),
+(1572,0,0,4609,0,0,0,0,1),
+(1573,0,0,4609,0,0,1,0,1),
+(1574,0,0,4609,0,0,2,0,1),
+(1575,0,0,4609,0,0,3,0,1),
+(1576,0,0,8705,0,0,0,0,1),
+(1577,0,0,8705,0,0,1,0,1),
+(1578,0,0,8705,0,0,2,0,1),
+(1579,0,0,8705,0,0,3,0,1),
+(1580,0,0,3073,0,0,0,0,1),
+(1581,0,0,3073,0,0,1,0,1),
+(1582,0,0,3073,0,0,2,0,1),
+(1583,0,0,3073,0,0,3,0,1),
+(1584,0,0,5121,0,0,0,0,1),
+(1585,0,0,5121,0,0,1,0,1),
+(1586,0,0,5121,0,0,2,0,1),
+(1587,0,0,5121,0,0,3,0,1),
+(1588,0,0,9217,0,0,0,0,1),
+(1589,0,0,9217,0,0,1,0,1),
+(1590,0,0,9217,0,0,2,0,1),
+(1591,0,0,9217,0,0,3,0,1),
+(1592,0,0,6145,0,0,0,0,1),
+(1593,0,0,6145,0,0,1,0,1),
+(1594,0,0,6145,0,0,2,0,1),
+(1595,0,0,6145,0,0,3,0,1),
+(1596,0,0,10241,0,0,0,0,1),
+(1597,0,0,10241,0,0,1,0,1),
+(1598,0,0,10241,0,0,2,0,1),
+(1599,0,0,10241,0,0,3,0,1),
+(1600,0,0,12289,0,0,0,0,1),
+(1601,0,0,12289,0,0,1,0,1),
+(1602,0,0,12289,0,0,2,0,1),
+(1603,0,0,12289,0,0,3,0,1),
+(1604,0,0,22,0,0,0,0,1),
+(1605,0,0,22,0,0,1,0,1),
+(1606,0,0,22,0,0,2,0,1),
+(1607,0,0,22,0,0,3,0,1),
+(1608,0,0,38,0,0,0,0,1),
+(1609,0,0,38,0,0,1,0,1),
+(1610,0,0,38,0,0,2,0,1),
+(1611,0,0,38,0,0,3,0,1),
+(1612,0,0,70,0,0,0,0,1),
+(1613,0,0,70,0,0,1,0,1),
+(1614,0,0,70,0,0,2,0,1),
+(1615,0,0,70,0,0,3,0,1),
+(1616,0,0,134,0,0,0,0,1),
+(1617,0,0,134,0,0,1,0,1),
+(1618,0,0,134,0,0,2,0,1),
+(1619,0,0,134,0,0,3,0,1),
+(1620,0,0,262,0,0,0,0,1),
+(1621,0,0,262,0,0,1,0,1),
+(1622,0,0,262,0,0,2,0,1),
+(1623,0,0,262,0,0,3,0,1),
+(1624,0,0,518,0,0,0,0,1),
+(1625,0,0,518,0,0,1,0,1),
+(1626,0,0,518,0,0,2,0,1),
+(1627,0,0,518,0,0,3,0,1),
+(1628,0,0,1030,0,0,0,0,1),
+(1629,0,0,1030,0,0,1,0,1),
+(1630,0,0,1030,0,0,2,0,1),
+(1631,0,0,1030,0,0,3,0,1),
+(1632,0,0,50,0,0,0,0,1),
+(1633,0,0,50,0,0,1,0,1),
+(1634,0,0,50,0,0,2,0,1),
+(1635,0,0,50,0,0,3,0,1),
+(1636,0,0,82,0,0,0,0,1),
+(1637,0,0,82,0,0,1,0,1),
+(1638,0,0,82,0,0,2,0,1),
+(1639,0,0,82,0,0,3,0,1),
+(1640,0,0,146,0,0,0,0,1),
+(1641,0,0,146,0,0,1,0,1),
+(1642,0,0,146,0,0,2,0,1),
+(1643,0,0,146,0,0,3,0,1),
+(1644,0,0,274,0,0,0,0,1),
+(1645,0,0,274,0,0,1,0,1),
+(1646,0,0,274,0,0,2,0,1),
+(1647,0,0,274,0,0,3,0,1),
+(1648,0,0,530,0,0,0,0,1),
+(1649,0,0,530,0,0,1,0,1),
+(1650,0,0,530,0,0,2,0,1),
+(1651,0,0,530,0,0,3,0,1),
+(1652,0,0,1042,0,0,0,0,1),
+(1653,0,0,1042,0,0,1,0,1),
+(1654,0,0,1042,0,0,2,0,1),
+(1655,0,0,1042,0,0,3,0,1),
+(1656,0,0,2066,0,0,0,0,1),
+(1657,0,0,2066,0,0,1,0,1),
+(1658,0,0,2066,0,0,2,0,1),
+(1659,0,0,2066,0,0,3,0,1),
+(1660,0,0,4114,0,0,0,0,1),
+(1661,0,0,4114,0,0,1,0,1),
+(1662,0,0,4114,0,0,2,0,1),
+(1663,0,0,4114,0,0,3,0,1),
+(1664,0,0,98,0,0,0,0,1),
+(1665,0,0,98,0,0,1,0,1),
+(1666,0,0,98,0,0,2,0,1),
+(1667,0,0,98,0,0,3,0,1),
+(1668,0,0,162,0,0,0,0,1),
+(1669,0,0,162,0,0,1,0,1),
+(1670,0,0,162,0,0,2,0,1),
+(1671,0,0,162,0,0,3,0,1),
+(1672,0,0,290,0,0,0,0,1),
+(1673,0,0,290,0,0,1,0,1),
+(1674,0,0,290,0,0,2,0,1),
+(1675,0,0,290,0,0,3,0,1),
+(1676,0,0,546,0,0,0,0,1),
+(1677,0,0,546,0,0,1,0,1),
+(1678,0,0,546,0,0,2,0,1),
+(1679,0,0,546,0,0,3,0,1),
+(1680,0,0,1058,0,0,0,0,1),
+(1681,0,0,1058,0,0,1,0,1),
+(1682,0,0,1058,0,0,2,0,1),
+(1683,0,0,1058,0,0,3,0,1),
+(1684,0,0,2082,0,0,0,0,1),
+(1685,0,0,2082,0,0,1,0,1),
+(1686,0,0,2082,0,0,2,0,1),
+(1687,0,0,2082,0,0,3,0,1),
+(1688,0,0,4130,0,0,0,0,1),
+(1689,0,0,4130,0,0,1,0,1),
+(1690,0,0,4130,0,0,2,0,1),
+(1691,0,0,4130,0,0,3,0,1),
+(1692,0,0,194,0,0,0,0,1),
+(1693,0,0,194,0,0,1,0,1),
+(1694,0,0,194,0,0,2,0,1),
+(1695,0,0,194,0,0,3,0,1),
+(1696,0,0,322,0,0,0,0,1),
+(1697,0,0,322,0,0,1,0,1),
+(1698,0,0,322,0,0,2,0,1),
+(1699,0,0,322,0,0,3,0,1),
+(1700,0,0,578,0,0,0,0,1),
+(1701,0,0,578,0,0,1,0,1),
+(1702,0,0,578,0,0,2,0,1),
+(1703,0,0,578,0,0,3,0,1),
+(1704,0,0,1090,0,0,0,0,1),
+(1705,0,0,1090,0,0,1,0,1),
+(1706,0,0,1090,0,0,2,0,1),
+(1707,0,0,1090,0,0,3,0,1),
+(1708,0,0,386,0,0,0,0,1),
+(1709,0,0,386,0,0,1,0,1),
+(1710,0,0,386,0,0,2,0,1),
+(1711,0,0,386,0,0,3,0,1),
+(1712,0,0,642,0,0,0,0,1),
+(1713,0,0,642,0,0,1,0,1),
+(1714,0,0,642,0,0,2,0,1),
+(1715,0,0,642,0,0,3,0,1),
+(1716,0,0,1154,0,0,0,0,1),
+(1717,0,0,1154,0,0,1,0,1),
+(1718,0,0,1154,0,0,2,0,1),
+(1719,0,0,1154,0,0,3,0,1),
+(1720,0,0,2178,0,0,0,0,1),
+(1721,0,0,2178,0,0,1,0,1),
+(1722,0,0,2178,0,0,2,0,1),
+(1723,0,0,2178,0,0,3,0,1),
+(1724,0,0,4226,0,0,0,0,1),
+(1725,0,0,4226,0,0,1,0,1),
+(1726,0,0,4226,0,0,2,0,1),
+(1727,0,0,4226,0,0,3,0,1),
+(1728,0,0,770,0,0,0,0,1),
+(1729,0,0,770,0,0,1,0,1),
+(1730,0,0,770,0,0,2,0,1),
+(1731,0,0,770,0,0,3,0,1),
+(1732,0,0,1282,0,0,0,0,1),
+(1733,0,0,1282,0,0,1,0,1),
+(1734,0,0,1282,0,0,2,0,1),
+(1735,0,0,1282,0,0,3,0,1),
+(1736,0,0,2306,0,0,0,0,1),
+(1737,0,0,2306,0,0,1,0,1),
+(1738,0,0,2306,0,0,2,0,1),
+(1739,0,0,2306,0,0,3,0,1),
+(1740,0,0,4354,0,0,0,0,1),
+(1741,0,0,4354,0,0,1,0,1),
+(1742,0,0,4354,0,0,2,0,1),
+(1743,0,0,4354,0,0,3,0,1),
+(1744,0,0,1538,0,0,0,0,1),
+(1745,0,0,1538,0,0,1,0,1),
+(1746,0,0,1538,0,0,2,0,1),
+(1747,0,0,1538,0,0,3,0,1),
+(1748,0,0,2562,0,0,0,0,1),
+(1749,0,0,2562,0,0,1,0,1),
+(1750,0,0,2562,0,0,2,0,1),
+(1751,0,0,2562,0,0,3,0,1),
+(1752,0,0,4610,0,0,0,0,1),
+(1753,0,0,4610,0,0,1,0,1),
+(1754,0,0,4610,0,0,2,0,1),
+(1755,0,0,4610,0,0,3,0,1),
+(1756,0,0,6146,0,0,0,0,1),
+(1757,0,0,6146,0,0,1,0,1),
+(1758,0,0,6146,0,0,2,0,1),
+(1759,0,0,6146,0,0,3,0,1),
+(1760,0,0,28,0,0,0,0,1),
+(1761,0,0,28,0,0,1,0,1),
+(1762,0,0,28,0,0,2,0,1),
+(1763,0,0,28,0,0,3,0,1),
+(1764,0,0,76,0,0,0,0,1),
+(1765,0,0,76,0,0,1,0,1),
+(1766,0,0,76,0,0,2,0,1),
+(1767,0,0,76,0,0,3,0,1),
+(1768,0,0,140,0,0,0,0,1),
+(1769,0,0,140,0,0,1,0,1),
+(1770,0,0,140,0,0,2,0,1),
+(1771,0,0,140,0,0,3,0,1),
+(1772,0,0,268,0,0,0,0,1),
+(1773,0,0,268,0,0,1,0,1),
+(1774,0,0,268,0,0,2,0,1),
+(1775,0,0,268,0,0,3,0,1),
+(1776,0,0,524,0,0,0,0,1),
+(1777,0,0,524,0,0,1,0,1),
+(1778,0,0,524,0,0,2,0,1),
+(1779,0,0,524,0,0,3,0,1),
+(1780,0,0,84,0,0,0,0,1),
+(1781,0,0,84,0,0,1,0,1),
+(1782,0,0,84,0,0,2,0,1),
+(1783,0,0,84,0,0,3,0,1),
+(1784,0,0,148,0,0,0,0,1),
+(1785,0,0,148,0,0,1,0,1),
+(1786,0,0,148,0,0,2,0,1),
+(1787,0,0,148,0,0,3,0,1),
+(1788,0,0,276,0,0,0,0,1),
+(1789,0,0,276,0,0,1,0,1),
+(1790,0,0,276,0,0,2,0,1),
+(1791,0,0,276,0,0,3,0,1),
+(1792,0,0,532,0,0,0,0,1),
+(1793,0,0,532,0,0,1,0,1),
+(1794,0,0,532,0,0,2,0,1),
+(1795,0,0,532,0,0,3,0,1),
+(1796,0,0,196,0,0,0,0,1),
+(1797,0,0,196,0,0,1,0,1),
+(1798,0,0,196,0,0,2,0,1),
+(1799,0,0,196,0,0,3,0,1),
+(1800,0,0,324,0,0,0,0,1),
+(1801,0,0,324,0,0,1,0,1),
+(1802,0,0,324,0,0,2,0,1),
+(1803,0,0,324,0,0,3,0,1),
+(1804,0,0,580,0,0,0,0,1),
+(1805,0,0,580,0,0,1,0,1),
+(1806,0,0,580,0,0,2,0,1),
+(1807,0,0,580,0,0,3,0,1),
+(1808,0,0,388,0,0,0,0,1),
+(1809,0,0,388,0,0,1,0,1),
+(1810,0,0,388,0,0,2,0,1),
+(1811,0,0,388,0,0,3,0,1),
+(1812,0,0,644,0,0,0,0,1),
+(1813,0,0,644,0,0,1,0,1),
+(1814,0,0,644,0,0,2,0,1),
+(1815,0,0,644,0,0,3,0,1),
+(1816,0,0,772,0,0,0,0,1),
+(1817,0,0,772,0,0,1,0,1),
+(1818,0,0,772,0,0,2,0,1),
+(1819,0,0,772,0,0,3,0,1),
+(1820,0,0,88,0,0,0,0,1),
+(1821,0,0,88,0,0,1,0,1),
+(1822,0,0,88,0,0,2,0,1),
+(1823,0,0,88,0,0,3,0,1),
+(1824,0,0,152,0,0,0,0,1),
+(1825,0,0,152,0,0,1,0,1),
+(1826,0,0,152,0,0,2,0,1),
+(1827,0,0,152,0,0,3,0,1),
+(1828,0,0,280,0,0,0,0,1),
+(1829,0,0,280,0,0,1,0,1),
+(1830,0,0,280,0,0,2,0,1),
+(1831,0,0,280,0,0,3,0,1),
+(1832,0,0,536,0,0,0,0,1),
+(1833,0,0,536,0,0,1,0,1),
+(1834,0,0,536,0,0,2,0,1),
+(1835,0,0,536,0,0,3,0,1),
+(1836,0,0,200,0,0,0,0,1),
+(1837,0,0,200,0,0,1,0,1),
+(1838,0,0,200,0,0,2,0,1),
+(1839,0,0,200,0,0,3,0,1),
+(1840,0,0,328,0,0,0,0,1),
+(1841,0,0,328,0,0,1,0,1),
+(1842,0,0,328,0,0,2,0,1),
+(1843,0,0,328,0,0,3,0,1),
+(1844,0,0,584,0,0,0,0,1),
+(1845,0,0,584,0,0,1,0,1),
+(1846,0,0,584,0,0,2,0,1),
+(1847,0,0,584,0,0,3,0,1),
+(1848,0,0,392,0,0,0,0,1),
+(1849,0,0,392,0,0,1,0,1),
+(1850,0,0,392,0,0,2,0,1),
+(1851,0,0,392,0,0,3,0,1),
+(1852,0,0,648,0,0,0,0,1),
+(1853,0,0,648,0,0,1,0,1),
+(1854,0,0,648,0,0,2,0,1),
+(1855,0,0,648,0,0,3,0,1),
+(1856,0,0,776,0,0,0,0,1),
+(1857,0,0,776,0,0,1,0,1),
+(1858,0,0,776,0,0,2,0,1),
+(1859,0,0,776,0,0,3,0,1),
+(1860,0,0,176,0,0,0,0,1),
+(1861,0,0,176,0,0,1,0,1),
+(1862,0,0,176,0,0,2,0,1),
+(1863,0,0,176,0,0,3,0,1),
+(1864,0,0,304,0,0,0,0,1),
+(1865,0,0,304,0,0,1,0,1),
+(1866,0,0,304,0,0,2,0,1),
+(1867,0,0,304,0,0,3,0,1),
+(1868,0,0,560,0,0,0,0,1),
+(1869,0,0,560,0,0,1,0,1),
+(1870,0,0,560,0,0,2,0,1),
+(1871,0,0,560,0,0,3,0,1),
+(1872,0,0,1072,0,0,0,0,1),
+(1873,0,0,1072,0,0,1,0,1),
+(1874,0,0,1072,0,0,2,0,1),
+(1875,0,0,1072,0,0,3,0,1),
+(1876,0,0,2096,0,0,0,0,1),
+(1877,0,0,2096,0,0,1,0,1),
+(1878,0,0,2096,0,0,2,0,1),
+(1879,0,0,2096,0,0,3,0,1),
+(1880,0,0,4144,0,0,0,0,1),
+(1881,0,0,4144,0,0,1,0,1),
+(1882,0,0,4144,0,0,2,0,1),
+(1883,0,0,4144,0,0,3,0,1),
+(1884,0,0,8240,0,0,0,0,1),
+(1885,0,0,8240,0,0,1,0,1),
+(1886,0,0,8240,0,0,2,0,1),
+(1887,0,0,8240,0,0,3,0,1),
+(1888,0,0,208,0,0,0,0,1),
+(1889,0,0,208,0,0,1,0,1),
+(1890,0,0,208,0,0,2,0,1),
+(1891,0,0,208,0,0,3,0,1),
+(1892,0,0,336,0,0,0,0,1),
+(1893,0,0,336,0,0,1,0,1),
+(1894,0,0,336,0,0,2,0,1),
+(1895,0,0,336,0,0,3,0,1),
+(1896,0,0,592,0,0,0,0,1),
+(1897,0,0,592,0,0,1,0,1),
+(1898,0,0,592,0,0,2,0,1),
+(1899,0,0,592,0,0,3,0,1),
+(1900,0,0,400,0,0,0,0,1),
+(1901,0,0,400,0,0,1,0,1),
+(1902,0,0,400,0,0,2,0,1),
+(1903,0,0,400,0,0,3,0,1),
+(1904,0,0,656,0,0,0,0,1),
+(1905,0,0,656,0,0,1,0,1),
+(1906,0,0,656,0,0,2,0,1),
+(1907,0,0,656,0,0,3,0,1),
+(1908,0,0,1168,0,0,0,0,1),
+(1909,0,0,1168,0,0,1,0,1),
+(1910,0,0,1168,0,0,2,0,1),
+(1911,0,0,1168,0,0,3,0,1),
+(1912,0,0,2192,0,0,0,0,1),
+(1913,0,0,2192,0,0,1,0,1),
+(1914,0,0,2192,0,0,2,0,1),
+(1915,0,0,2192,0,0,3,0,1),
+(1916,0,0,4240,0,0,0,0,1),
+(1917,0,0,4240,0,0,1,0,1),
+(1918,0,0,4240,0,0,2,0,1),
+(1919,0,0,4240,0,0,3,0,1),
+(1920,0,0,8336,0,0,0,0,1),
+(1921,0,0,8336,0,0,1,0,1),
+(1922,0,0,8336,0,0,2,0,1),
+(1923,0,0,8336,0,0,3,0,1),
+(1924,0,0,784,0,0,0,0,1),
+(1925,0,0,784,0,0,1,0,1),
+(1926,0,0,784,0,0,2,0,1),
+(1927,0,0,784,0,0,3,0,1),
+(1928,0,0,1296,0,0,0,0,1),
+(1929,0,0,1296,0,0,1,0,1),
+(1930,0,0,1296,0,0,2,0,1),
+(1931,0,0,1296,0,0,3,0,1),
+(1932,0,0,2320,0,0,0,0,1),
+(1933,0,0,2320,0,0,1,0,1),
+(1934,0,0,2320,0,0,2,0,1),
+(1935,0,0,2320,0,0,3,0,1),
+(1936,0,0,4368,0,0,0,0,1),
+(1937,0,0,4368,0,0,1,0,1),
+(1938,0,0,4368,0,0,2,0,1),
+(1939,0,0,4368,0,0,3,0,1),
+(1940,0,0,8464,0,0,0,0,1),
+(1941,0,0,8464,0,0,1,0,1),
+(1942,0,0,8464,0,0,2,0,1),
+(1943,0,0,8464,0,0,3,0,1),
+(1944,0,0,1552,0,0,0,0,1),
+(1945,0,0,1552,0,0,1,0,1),
+(1946,0,0,1552,0,0,2,0,1),
+(1947,0,0,1552,0,0,3,0,1),
+(1948,0,0,2576,0,0,0,0,1),
+(1949,0,0,2576,0,0,1,0,1),
+(1950,0,0,2576,0,0,2,0,1),
+(1951,0,0,2576,0,0,3,0,1),
+(1952,0,0,4624,0,0,0,0,1),
+(1953,0,0,4624,0,0,1,0,1),
+(1954,0,0,4624,0,0,2,0,1),
+(1955,0,0,4624,0,0,3,0,1),
+(1956,0,0,8720,0,0,0,0,1),
+(1957,0,0,8720,0,0,1,0,1),
+(1958,0,0,8720,0,0,2,0,1),
+(1959,0,0,8720,0,0,3,0,1),
+(1960,0,0,3088,0,0,0,0,1),
+(1961,0,0,3088,0,0,1,0,1),
+(1962,0,0,3088,0,0,2,0,1),
+(1963,0,0,3088,0,0,3,0,1),
+(1964,0,0,5136,0,0,0,0,1),
+(1965,0,0,5136,0,0,1,0,1),
+(1966,0,0,5136,0,0,2,0,1),
+(1967,0,0,5136,0,0,3,0,1),
+(1968,0,0,9232,0,0,0,0,1),
+(1969,0,0,9232,0,0,1,0,1),
+(1970,0,0,9232,0,0,2,0,1),
+(1971,0,0,9232,0,0,3,0,1),
+(1972,0,0,6160,0,0,0,0,1),
+(1973,0,0,6160,0,0,1,0,1),
+(1974,0,0,6160,0,0,2,0,1),
+(1975,0,0,6160,0,0,3,0,1),
+(1976,0,0,10256,0,0,0,0,1),
+(1977,0,0,10256,0,0,1,0,1),
+(1978,0,0,10256,0,0,2,0,1),
+(1979,0,0,10256,0,0,3,0,1),
+(1980,0,0,12304,0,0,0,0,1),
+(1981,0,0,12304,0,0,1,0,1),
+(1982,0,0,12304,0,0,2,0,1),
+(1983,0,0,12304,0,0,3,0,1),
+(1984,0,0,416,0,0,0,0,1),
+(1985,0,0,416,0,0,1,0,1),
+(1986,0,0,416,0,0,2,0,1),
+(1987,0,0,416,0,0,3,0,1),
+(1988,0,0,672,0,0,0,0,1),
+(1989,0,0,672,0,0,1,0,1),
+(1990,0,0,672,0,0,2,0,1),
+(1991,0,0,672,0,0,3,0,1),
+(1992,0,0,1184,0,0,0,0,1),
+(1993,0,0,1184,0,0,1,0,1),
+(1994,0,0,1184,0,0,2,0,1),
+(1995,0,0,1184,0,0,3,0,1),
+(1996,0,0,2208,0,0,0,0,1),
+(1997,0,0,2208,0,0,1,0,1),
+(1998,0,0,2208,0,0,2,0,1),
+(1999,0,0,2208,0,0,3,0,1),
+(2000,0,0,4256,0,0,0,0,1),
+(2001,0,0,4256,0,0,1,0,1),
+(2002,0,0,4256,0,0,2,0,1),
+(2003,0,0,4256,0,0,3,0,1),
+(2004,0,0,8352,0,0,0,0,1),
+(2005,0,0,8352,0,0,1,0,1),
+(2006,0,0,8352,0,0,2,0,1),
+(2007,0,0,8352,0,0,3,0,1),
+(2008,0,0,800,0,0,0,0,1),
+(2009,0,0,800,0,0,1,0,1),
+(2010,0,0,800,0,0,2,0,1),
+(2011,0,0,800,0,0,3,0,1),
+(2012,0,0,1312,0,0,0,0,1),
+(2013,0,0,1312,0,0,1,0,1),
+(2014,0,0,1312,0,0,2,0,1),
+(2015,0,0,1312,0,0,3,0,1),
+(2016,0,0,2336,0,0,0,0,1),
+(2017,0,0,2336,0,0,1,0,1),
+(2018,0,0,2336,0,0,2,0,1),
+(2019,0,0,2336,0,0,3,0,1),
+(2020,0,0,4384,0,0,0,0,1),
+(2021,0,0,4384,0,0,1,0,1),
+(2022,0,0,4384,0,0,2,0,1),
+(2023,0,0,4384,0,0,3,0,1),
+(2024,0,0,8480,0,0,0,0,1),
+(2025,0,0,8480,0,0,1,0,1),
+(2026,0,0,8480,0,0,2,0,1),
+(2027,0,0,8480,0,0,3,0,1),
+(2028,0,0,1568,0,0,0,0,1),
+(2029,0,0,1568,0,0,1,0,1),
+(2030,0,0,1568,0,0,2,0,1),
+(2031,0,0,1568,0,0,3,0,1),
+(2032,0,0,2592,0,0,0,0,1),
+(2033,0,0,2592,0,0,1,0,1),
+(2034,0,0,2592,0,0,2,0,1),
+(2035,0,0,2592,0,0,3,0,1),
+(2036,0,0,4640,0,0,0,0,1),
+(2037,0,0,4640,0,0,1,0,1),
+(2038,0,0,4640,0,0,2,0,1),
+(2039,0,0,4640,0,0,3,0,1),
+(2040,0,0,8736,0,0,0,0,1),
+(2041,0,0,8736,0,0,1,0,1),
+(2042,0,0,8736,0,0,2,0,1),
+(2043,0,0,8736,0,0,3,0,1),
+(2044,0,0,3104,0,0,0,0,1),
+(2045,0,0,3104,0,0,1,0,1),
+(2046,0,0,3104,0,0,2,0,1),
+(2047,0,0,3104,0,0,3,0,1),
+(2048,0,0,5152,0,0,0,0,1),
+(2049,0,0,5152,0,0,1,0,1),
+(2050,0,0,5152,0,0,2,0,1),
+(2051,0,0,5152,0,0,3,0,1),
+(2052,0,0,9248,0,0,0,0,1),
+(2053,0,0,9248,0,0,1,0,1),
+(2054,0,0,9248,0,0,2,0,1),
+(2055,0,0,9248,0,0,3,0,1),
+(2056,0,0,6176,0,0,0,0,1),
+(2057,0,0,6176,0,0,1,0,1),
+(2058,0,0,6176,0,0,2,0,1),
+(2059,0,0,6176,0,0,3,0,1),
+(2060,0,0,10272,0,0,0,0,1),
+(2061,0,0,10272,0,0,1,0,1),
+(2062,0,0,10272,0,0,2,0,1),
+(2063,0,0,10272,0,0,3,0,1),
+(2064,0,0,12320,0,0,0,0,1),
+(2065,0,0,12320,0,0,1,0,1),
+(2066,0,0,12320,0,0,2,0,1),
+(2067,0,0,12320,0,0,3,0,1),
+(2068,0,0,448,0,0,0,0,1),
+(2069,0,0,448,0,0,1,0,1),
+(2070,0,0,448,0,0,2,0,1),
+(2071,0,0,448,0,0,3,0,1),
+(2072,0,0,704,0,0,0,0,1),
+(2073,0,0,704,0,0,1,0,1),
+(2074,0,0,704,0,0,2,0,1),
+(2075,0,0,704,0,0,3,0,1),
+(2076,0,0,832,0,0,0,0,1),
+(2077,0,0,832,0,0,1,0,1),
+(2078,0,0,832,0,0,2,0,1),
+(2079,0,0,832,0,0,3,0,1),
+(2080,0,0,896,0,0,0,0,1),
+(2081,0,0,896,0,0,1,0,1),
+(2082,0,0,896,0,0,2,0,1),
+(2083,0,0,896,0,0,3,0,1),
+(2084,0,0,1408,0,0,0,0,1),
+(2085,0,0,1408,0,0,1,0,1),
+(2086,0,0,1408,0,0,2,0,1),
+(2087,0,0,1408,0,0,3,0,1),
+(2088,0,0,2432,0,0,0,0,1),
+(2089,0,0,2432,0,0,1,0,1),
+(2090,0,0,2432,0,0,2,0,1),
+(2091,0,0,2432,0,0,3,0,1),
+(2092,0,0,4480,0,0,0,0,1),
+(2093,0,0,4480,0,0,1,0,1),
+(2094,0,0,4480,0,0,2,0,1),
+(2095,0,0,4480,0,0,3,0,1),
+(2096,0,0,8576,0,0,0,0,1),
+(2097,0,0,8576,0,0,1,0,1),
+(2098,0,0,8576,0,0,2,0,1),
+(2099,0,0,8576,0,0,3,0,1),
+(2100,0,0,1664,0,0,0,0,1),
+(2101,0,0,1664,0,0,1,0,1),
+(2102,0,0,1664,0,0,2,0,1),
+(2103,0,0,1664,0,0,3,0,1),
+(2104,0,0,2688,0,0,0,0,1),
+(2105,0,0,2688,0,0,1,0,1),
+(2106,0,0,2688,0,0,2,0,1),
+(2107,0,0,2688,0,0,3,0,1),
+(2108,0,0,4736,0,0,0,0,1),
+(2109,0,0,4736,0,0,1,0,1),
+(2110,0,0,4736,0,0,2,0,1),
+(2111,0,0,4736,0,0,3,0,1),
+(2112,0,0,8832,0,0,0,0,1),
+(2113,0,0,8832,0,0,1,0,1),
+(2114,0,0,8832,0,0,2,0,1),
+(2115,0,0,8832,0,0,3,0,1),
+(2116,0,0,3200,0,0,0,0,1),
+(2117,0,0,3200,0,0,1,0,1),
+(2118,0,0,3200,0,0,2,0,1),
+(2119,0,0,3200,0,0,3,0,1),
+(2120,0,0,5248,0,0,0,0,1),
+(2121,0,0,5248,0,0,1,0,1),
+(2122,0,0,5248,0,0,2,0,1),
+(2123,0,0,5248,0,0,3,0,1),
+(2124,0,0,9344,0,0,0,0,1),
+(2125,0,0,9344,0,0,1,0,1),
+(2126,0,0,9344,0,0,2,0,1),
+(2127,0,0,9344,0,0,3,0,1),
+(2128,0,0,6272,0,0,0,0,1),
+(2129,0,0,6272,0,0,1,0,1),
+(2130,0,0,6272,0,0,2,0,1),
+(2131,0,0,6272,0,0,3,0,1),
+(2132,0,0,10368,0,0,0,0,1),
+(2133,0,0,10368,0,0,1,0,1),
+(2134,0,0,10368,0,0,2,0,1),
+(2135,0,0,10368,0,0,3,0,1),
+(2136,0,0,12416,0,0,0,0,1),
+(2137,0,0,12416,0,0,1,0,1),
+(2138,0,0,12416,0,0,2,0,1),
+(2139,0,0,12416,0,0,3,0,1),
+(2140,0,0,1792,0,0,0,0,1),
+(2141,0,0,1792,0,0,1,0,1),
+(2142,0,0,1792,0,0,2,0,1),
+(2143,0,0,1792,0,0,3,0,1),
+(2144,0,0,2816,0,0,0,0,1),
+(2145,0,0,2816,0,0,1,0,1),
+(2146,0,0,2816,0,0,2,0,1),
+(2147,0,0,2816,0,0,3,0,1),
+(2148,0,0,4864,0,0,0,0,1),
+(2149,0,0,4864,0,0,1,0,1),
+(2150,0,0,4864,0,0,2,0,1),
+(2151,0,0,4864,0,0,3,0,1),
+(2152,0,0,8960,0,0,0,0,1),
+(2153,0,0,8960,0,0,1,0,1),
+(2154,0,0,8960,0,0,2,0,1),
+(2155,0,0,8960,0,0,3,0,1),
+(2156,0,0,3328,0,0,0,0,1),
+(2157,0,0,3328,0,0,1,0,1),
+(2158,0,0,3328,0,0,2,0,1),
+(2159,0,0,3328,0,0,3,0,1),
+(2160,0,0,5376,0,0,0,0,1),
+(2161,0,0,5376,0,0,1,0,1),
+(2162,0,0,5376,0,0,2,0,1),
+(2163,0,0,5376,0,0,3,0,1),
+(2164,0,0,9472,0,0,0,0,1),
+(2165,0,0,9472,0,0,1,0,1),
+(2166,0,0,9472,0,0,2,0,1),
+(2167,0,0,9472,0,0,3,0,1),
+(2168,0,0,6400,0,0,0,0,1),
+(2169,0,0,6400,0,0,1,0,1),
+(2170,0,0,6400,0,0,2,0,1),
+(2171,0,0,6400,0,0,3,0,1),
+(2172,0,0,10496,0,0,0,0,1),
+(2173,0,0,10496,0,0,1,0,1),
+(2174,0,0,10496,0,0,2,0,1),
+(2175,0,0,10496,0,0,3,0,1),
+(2176,0,0,12544,0,0,0,0,1),
+(2177,0,0,12544,0,0,1,0,1),
+(2178,0,0,12544,0,0,2,0,1),
+(2179,0,0,12544,0,0,3,0,1),
+(2180,0,0,3584,0,0,0,0,1),
+(2181,0,0,3584,0,0,1,0,1),
+(2182,0,0,3584,0,0,2,0,1),
+(2183,0,0,3584,0,0,3,0,1),
+(2184,0,0,5632,0,0,0,0,1),
+(2185,0,0,5632,0,0,1,0,1),
+(2186,0,0,5632,0,0,2,0,1),
+(2187,0,0,5632,0,0,3,0,1),
+(2188,0,0,9728,0,0,0,0,1),
+(2189,0,0,9728,0,0,1,0,1),
+(2190,0,0,9728,0,0,2,0,1),
+(2191,0,0,9728,0,0,3,0,1),
+(2192,0,0,6656,0,0,0,0,1),
+(2193,0,0,6656,0,0,1,0,1),
+(2194,0,0,6656,0,0,2,0,1),
+(2195,0,0,6656,0,0,3,0,1),
+(2196,0,0,10752,0,0,0,0,1),
+(2197,0,0,10752,0,0,1,0,1),
+(2198,0,0,10752,0,0,2,0,1),
+(2199,0,0,10752,0,0,3,0,1),
+(2200,0,0,12800,0,0,0,0,1),
+(2201,0,0,12800,0,0,1,0,1),
+(2202,0,0,12800,0,0,2,0,1),
+(2203,0,0,12800,0,0,3,0,1),
+(2204,0,0,7168,0,0,0,0,1),
+(2205,0,0,7168,0,0,1,0,1),
+(2206,0,0,7168,0,0,2,0,1),
+(2207,0,0,7168,0,0,3,0,1),
+(2208,0,0,11264,0,0,0,0,1),
+(2209,0,0,11264,0,0,1,0,1),
+(2210,0,0,11264,0,0,2,0,1),
+(2211,0,0,11264,0,0,3,0,1),
+(2212,0,0,13312,0,0,0,0,1),
+(2213,0,0,13312,0,0,1,0,1),
+(2214,0,0,13312,0,0,2,0,1),
+(2215,0,0,13312,0,0,3,0,1),
+(2216,0,0,14336,0,0,0,0,1),
+(2217,0,0,14336,0,0,1,0,1),
+(2218,0,0,14336,0,0,2,0,1),
+(2219,0,0,14336,0,0,3,0,1),
+(2220,20,27,0,2,41459,0,7,1),
+(2221,20,27,1,2,41459,0,3,1),
+(2222,20,27,1,2,41459,1,3,1),
+(2223,20,27,1,2,41459,2,3,1),
+(2224,20,27,16,2,41459,0,2,1),
+(2225,20,27,16,2,41459,1,2,1),
+(2226,20,27,16,2,41459,2,2,1),
+(2227,20,27,128,2,41459,0,7,1),
+(2228,20,27,128,2,41459,1,7,1),
+(2229,20,27,128,2,41459,2,7,1),
+(2230,20,27,256,2,41459,0,7,1),
+(2231,20,27,256,2,41459,1,7,1),
+(2232,20,27,256,2,41459,2,7,1),
+(2233,20,27,1024,2,41459,0,7,1),
+(2234,20,27,1024,2,41459,1,7,1),
+(2235,20,27,1024,2,41459,2,7,1),
+(2236,20,27,2048,2,41459,0,2,1),
+(2237,20,27,2048,2,41459,1,2,1),
+(2238,20,27,2048,2,41459,2,2,1),
+(2239,20,27,4096,2,41459,0,2,1),
+(2240,20,27,4096,2,41459,1,2,1),
+(2241,20,27,4096,2,41459,2,2,1),
+(2242,20,27,8192,2,41459,0,2,1),
+(2243,20,27,8192,2,41459,1,2,1),
+(2244,20,27,8192,2,41459,2,2,1),
+(2245,20,27,32,2,41459,0,5,1),
+(2246,20,27,32,2,41459,1,5,1),
+(2247,20,27,32,2,41459,2,5,1),
+(2248,20,27,512,2,41459,0,5,1),
+(2249,20,27,512,2,41459,1,5,1),
+(2250,20,27,512,2,41459,2,5,1),
+(2251,20,27,2,2,41459,0,4,1),
+(2252,20,27,2,2,41459,1,4,1),
+(2253,20,27,2,2,41459,2,4,1),
+(2254,26,35,0,2,41459,0,39,1),
+(2255,26,35,1,2,41459,0,3,1),
+(2256,26,35,1,2,41459,1,3,1),
+(2257,26,35,1,2,41459,2,3,1),
+(2258,26,35,16,2,41459,0,2,1),
+(2259,26,35,16,2,41459,1,2,1),
+(2260,26,35,16,2,41459,2,2,1),
+(2261,26,35,128,2,41459,0,39,1),
+(2262,26,35,128,2,41459,1,39,1),
+(2263,26,35,128,2,41459,2,39,1),
+(2264,26,35,256,2,41459,0,39,1),
+(2265,26,35,256,2,41459,1,39,1),
+(2266,26,35,256,2,41459,2,39,1),
+(2267,26,35,1024,2,41459,0,7,1),
+(2268,26,35,1024,2,41459,1,7,1),
+(2269,26,35,1024,2,41459,2,7,1),
+(2270,26,35,2048,2,41459,0,2,1),
+(2271,26,35,2048,2,41459,1,2,1),
+(2272,26,35,2048,2,41459,2,2,1),
+(2273,26,35,4096,2,41459,0,2,1),
+(2274,26,35,4096,2,41459,1,2,1),
+(2275,26,35,4096,2,41459,2,2,1),
+(2276,26,35,8192,2,41459,0,2,1),
+(2277,26,35,8192,2,41459,1,2,1),
+(2278,26,35,8192,2,41459,2,2,1),
+(2279,26,35,32,2,41459,0,5,1),
+(2280,26,35,32,2,41459,1,5,1),
+(2281,26,35,32,2,41459,2,5,1),
+(2282,26,35,512,2,41459,0,37,1),
+(2283,26,35,512,2,41459,1,37,1),
+(2284,26,35,512,2,41459,2,37,1),
+(2285,26,35,2,2,41459,0,4,1),
+(2286,26,35,2,2,41459,1,4,1),
+(2287,26,35,2,2,41459,2,4,1),
+(2288,26,35,4,2,41459,0,32,1),
+(2289,26,35,4,2,41459,1,32,1),
+(2290,26,35,4,2,41459,2,32,1),
+(2291,26,35,8,2,41459,0,32,1),
+(2292,26,35,8,2,41459,1,32,1),
+(2293,26,35,8,2,41459,2,32,1),
+(2294,26,35,64,2,41459,0,32,1),
+(2295,26,35,64,2,41459,1,32,1),
+(2296,26,35,64,2,41459,2,32,1),
+(2297,18,25,0,2,41459,0,39,1),
+(2298,18,25,1,2,41459,0,3,1),
+(2299,18,25,1,2,41459,1,3,1),
+(2300,18,25,1,2,41459,2,3,1),
+(2301,18,25,16,2,41459,0,2,1),
+(2302,18,25,16,2,41459,1,2,1),
+(2303,18,25,16,2,41459,2,2,1),
+(2304,18,25,128,2,41459,0,39,1),
+(2305,18,25,128,2,41459,1,39,1),
+(2306,18,25,128,2,41459,2,39,1),
+(2307,18,25,256,2,41459,0,39,1),
+(2308,18,25,256,2,41459,1,39,1),
+(2309,18,25,256,2,41459,2,39,1),
+(2310,18,25,1024,2,41459,0,7,1),
+(2311,18,25,1024,2,41459,1,7,1),
+(2312,18,25,1024,2,41459,2,7,1),
+(2313,18,25,2048,2,41459,0,2,1),
+(2314,18,25,2048,2,41459,1,2,1),
+(2315,18,25,2048,2,41459,2,2,1),
+(2316,18,25,4096,2,41459,0,2,1),
+(2317,18,25,4096,2,41459,1,2,1),
+(2318,18,25,4096,2,41459,2,2,1),
+(2319,18,25,8192,2,41459,0,2,1),
+(2320,18,25,8192,2,41459,1,2,1),
+(2321,18,25,8192,2,41459,2,2,1),
+(2322,18,25,32,2,41459,0,5,1),
+(2323,18,25,32,2,41459,1,5,1),
+(2324,18,25,32,2,41459,2,5,1),
+(2325,18,25,512,2,41459,0,37,1),
+(2326,18,25,512,2,41459,1,37,1),
+(2327,18,25,512,2,41459,2,37,1),
+(2328,18,25,2,2,41459,0,4,1),
+(2329,18,25,2,2,41459,1,4,1),
+(2330,18,25,2,2,41459,2,4,1),
+(2331,18,25,4,2,41459,0,32,1),
+(2332,18,25,4,2,41459,1,32,1),
+(2333,18,25,4,2,41459,2,32,1),
+(2334,18,25,8,2,41459,0,32,1),
+(2335,18,25,8,2,41459,1,32,1),
+(2336,18,25,8,2,41459,2,32,1),
+(2337,18,25,64,2,41459,0,32,1),
+(2338,18,25,64,2,41459,1,32,1),
+(2339,18,25,64,2,41459,2,32,1),
+(2340,10,17,0,2,41459,0,39,1),
+(2341,10,17,1,2,41459,0,3,1),
+(2342,10,17,1,2,41459,1,3,1),
+(2343,10,17,1,2,41459,2,3,1),
+(2344,10,17,16,2,41459,0,2,1),
+(2345,10,17,16,2,41459,1,2,1),
+(2346,10,17,16,2,41459,2,2,1),
+(2347,10,17,128,2,41459,0,39,1),
+(2348,10,17,128,2,41459,1,39,1),
+(2349,10,17,128,2,41459,2,39,1),
+(2350,10,17,256,2,41459,0,39,1),
+(2351,10,17,256,2,41459,1,39,1),
+(2352,10,17,256,2,41459,2,39,1),
+(2353,10,17,1024,2,41459,0,7,1),
+(2354,10,17,1024,2,41459,1,7,1),
+(2355,10,17,1024,2,41459,2,7,1),
+(2356,10,17,2048,2,41459,0,2,1),
+(2357,10,17,2048,2,41459,1,2,1),
+(2358,10,17,2048,2,41459,2,2,1),
+(2359,10,17,4096,2,41459,0,2,1),
+(2360,10,17,4096,2,41459,1,2,1),
+(2361,10,17,4096,2,41459,2,2,1),
+(2362,10,17,8192,2,41459,0,2,1),
+(2363,10,17,8192,2,41459,1,2,1),
+(2364,10,17,8192,2,41459,2,2,1),
+(2365,10,17,32,2,41459,0,5,1),
+(2366,10,17,32,2,41459,1,5,1),
+(2367,10,17,32,2,41459,2,5,1),
+(2368,10,17,512,2,41459,0,37,1),
+(2369,10,17,512,2,41459,1,37,1),
+(2370,10,17,512,2,41459,2,37,1),
+(2371,10,17,2,2,41459,0,4,1),
+(2372,10,17,2,2,41459,1,4,1),
+(2373,10,17,2,2,41459,2,4,1),
+(2374,10,17,4,2,41459,0,32,1),
+(2375,10,17,4,2,41459,1,32,1),
+(2376,10,17,4,2,41459,2,32,1),
+(2377,10,17,8,2,41459,0,32,1),
+(2378,10,17,8,2,41459,1,32,1),
+(2379,10,17,8,2,41459,2,32,1),
+(2380,10,17,64,2,41459,0,32,1),
+(2381,10,17,64,2,41459,1,32,1),
+(2382,10,17,64,2,41459,2,32,1),
+(2383,30,37,0,2,41459,0,7,1),
+(2384,30,37,1,2,41459,0,3,1),
+(2385,30,37,1,2,41459,1,3,1),
+(2386,30,37,1,2,41459,2,3,1),
+(2387,30,37,16,2,41459,0,2,1),
+(2388,30,37,16,2,41459,1,2,1),
+(2389,30,37,16,2,41459,2,2,1),
+(2390,30,37,128,2,41459,0,7,1),
+(2391,30,37,128,2,41459,1,7,1),
+(2392,30,37,128,2,41459,2,7,1),
+(2393,30,37,256,2,41459,0,7,1),
+(2394,30,37,256,2,41459,1,7,1),
+(2395,30,37,256,2,41459,2,7,1),
+(2396,30,37,1024,2,41459,0,7,1),
+(2397,30,37,1024,2,41459,1,7,1),
+(2398,30,37,1024,2,41459,2,7,1),
+(2399,30,37,2048,2,41459,0,2,1),
+(2400,30,37,2048,2,41459,1,2,1),
+(2401,30,37,2048,2,41459,2,2,1),
+(2402,30,37,4096,2,41459,0,2,1),
+(2403,30,37,4096,2,41459,1,2,1),
+(2404,30,37,4096,2,41459,2,2,1),
+(2405,30,37,8192,2,41459,0,2,1),
+(2406,30,37,8192,2,41459,1,2,1),
+(2407,30,37,8192,2,41459,2,2,1),
+(2408,30,37,32,2,41459,0,5,1),
+(2409,30,37,32,2,41459,1,5,1),
+(2410,30,37,32,2,41459,2,5,1),
+(2411,30,37,512,2,41459,0,5,1),
+(2412,30,37,512,2,41459,1,5,1),
+(2413,30,37,512,2,41459,2,5,1),
+(2414,30,37,2,2,41459,0,4,1),
+(2415,30,37,2,2,41459,1,4,1),
+(2416,30,37,2,2,41459,2,4,1),
+(2417,38,45,0,2,41459,0,7,1),
+(2418,38,45,1,2,41459,0,3,1),
+(2419,38,45,1,2,41459,1,3,1),
+(2420,38,45,1,2,41459,2,3,1),
+(2421,38,45,16,2,41459,0,2,1),
+(2422,38,45,16,2,41459,1,2,1),
+(2423,38,45,16,2,41459,2,2,1),
+(2424,38,45,128,2,41459,0,7,1),
+(2425,38,45,128,2,41459,1,7,1),
+(2426,38,45,128,2,41459,2,7,1),
+(2427,38,45,256,2,41459,0,7,1),
+(2428,38,45,256,2,41459,1,7,1),
+(2429,38,45,256,2,41459,2,7,1),
+(2430,38,45,1024,2,41459,0,7,1),
+(2431,38,45,1024,2,41459,1,7,1),
+(2432,38,45,1024,2,41459,2,7,1),
+(2433,38,45,2048,2,41459,0,2,1),
+(2434,38,45,2048,2,41459,1,2,1),
+(2435,38,45,2048,2,41459,2,2,1),
+(2436,38,45,4096,2,41459,0,2,1),
+(2437,38,45,4096,2,41459,1,2,1),
+(2438,38,45,4096,2,41459,2,2,1),
+(2439,38,45,8192,2,41459,0,2,1),
+(2440,38,45,8192,2,41459,1,2,1),
+(2441,38,45,8192,2,41459,2,2,1),
+(2442,38,45,32,2,41459,0,5,1),
+(2443,38,45,32,2,41459,1,5,1),
+(2444,38,45,32,2,41459,2,5,1),
+(2445,38,45,512,2,41459,0,5,1),
+(2446,38,45,512,2,41459,1,5,1),
+(2447,38,45,512,2,41459,2,5,1),
+(2448,38,45,2,2,41459,0,4,1),
+(2449,38,45,2,2,41459,1,4,1),
+(2450,38,45,2,2,41459,2,4,1),
+(2451,20,27,0,2,41459,0,7,1),
+(2452,20,27,1,2,41459,0,3,1),
+(2453,20,27,1,2,41459,1,3,1),
+(2454,20,27,1,2,41459,2,3,1),
+(2455,20,27,16,2,41459,0,2,1),
+(2456,20,27,16,2,41459,1,2,1),
+(2457,20,27,16,2,41459,2,2,1),
+(2458,20,27,128,2,41459,0,7,1),
+(2459,20,27,128,2,41459,1,7,1),
+(2460,20,27,128,2,41459,2,7,1),
+(2461,20,27,256,2,41459,0,7,1),
+(2462,20,27,256,2,41459,1,7,1),
+(2463,20,27,256,2,41459,2,7,1),
+(2464,20,27,1024,2,41459,0,7,1),
+(2465,20,27,1024,2,41459,1,7,1),
+(2466,20,27,1024,2,41459,2,7,1),
+(2467,20,27,2048,2,41459,0,2,1),
+(2468,20,27,2048,2,41459,1,2,1),
+(2469,20,27,2048,2,41459,2,2,1),
+(2470,20,27,4096,2,41459,0,2,1),
+(2471,20,27,4096,2,41459,1,2,1),
+(2472,20,27,4096,2,41459,2,2,1),
+(2473,20,27,8192,2,41459,0,2,1),
+(2474,20,27,8192,2,41459,1,2,1),
+(2475,20,27,8192,2,41459,2,2,1),
+(2476,20,27,32,2,41459,0,5,1),
+(2477,20,27,32,2,41459,1,5,1),
+(2478,20,27,32,2,41459,2,5,1),
+(2479,20,27,512,2,41459,0,5,1),
+(2480,20,27,512,2,41459,1,5,1),
+(2481,20,27,512,2,41459,2,5,1),
+(2482,20,27,2,2,41459,0,4,1),
+(2483,20,27,2,2,41459,1,4,1),
+(2484,20,27,2,2,41459,2,4,1),
+(2485,28,32,0,2,41459,0,7,1),
+(2486,28,32,1,2,41459,0,3,1),
+(2487,28,32,1,2,41459,1,3,1),
+(2488,28,32,1,2,41459,2,3,1),
+(2489,28,32,16,2,41459,0,2,1),
+(2490,28,32,16,2,41459,1,2,1),
+(2491,28,32,16,2,41459,2,2,1),
+(2492,28,32,128,2,41459,0,7,1),
+(2493,28,32,128,2,41459,1,7,1),
+(2494,28,32,128,2,41459,2,7,1),
+(2495,28,32,256,2,41459,0,7,1),
+(2496,28,32,256,2,41459,1,7,1),
+(2497,28,32,256,2,41459,2,7,1),
+(2498,28,32,1024,2,41459,0,7,1),
+(2499,28,32,1024,2,41459,1,7,1),
+(2500,28,32,1024,2,41459,2,7,1),
+(2501,28,32,2048,2,41459,0,2,1),
+(2502,28,32,2048,2,41459,1,2,1),
+(2503,28,32,2048,2,41459,2,2,1),
+(2504,28,32,4096,2,41459,0,2,1),
+(2505,28,32,4096,2,41459,1,2,1),
+(2506,28,32,4096,2,41459,2,2,1),
+(2507,28,32,8192,2,41459,0,2,1),
+(2508,28,32,8192,2,41459,1,2,1),
+(2509,28,32,8192,2,41459,2,2,1),
+(2510,28,32,32,2,41459,0,5,1),
+(2511,28,32,32,2,41459,1,5,1),
+(2512,28,32,32,2,41459,2,5,1),
+(2513,28,32,512,2,41459,0,5,1),
+(2514,28,32,512,2,41459,1,5,1),
+(2515,28,32,512,2,41459,2,5,1),
+(2516,28,32,2,2,41459,0,4,1),
+(2517,28,32,2,2,41459,1,4,1),
+(2518,28,32,2,2,41459,2,4,1),
+(2519,33,35,0,2,41459,0,7,1),
+(2520,33,35,1,2,41459,0,3,1),
+(2521,33,35,1,2,41459,1,3,1),
+(2522,33,35,1,2,41459,2,3,1),
+(2523,33,35,16,2,41459,0,2,1),
+(2524,33,35,16,2,41459,1,2,1),
+(2525,33,35,16,2,41459,2,2,1),
+(2526,33,35,128,2,41459,0,7,1),
+(2527,33,35,128,2,41459,1,7,1),
+(2528,33,35,128,2,41459,2,7,1),
+(2529,33,35,256,2,41459,0,7,1),
+(2530,33,35,256,2,41459,1,7,1),
+(2531,33,35,256,2,41459,2,7,1),
+(2532,33,35,1024,2,41459,0,7,1),
+(2533,33,35,1024,2,41459,1,7,1),
+(2534,33,35,1024,2,41459,2,7,1),
+(2535,33,35,2048,2,41459,0,2,1),
+(2536,33,35,2048,2,41459,1,2,1),
+(2537,33,35,2048,2,41459,2,2,1),
+(2538,33,35,4096,2,41459,0,2,1),
+(2539,33,35,4096,2,41459,1,2,1),
+(2540,33,35,4096,2,41459,2,2,1),
+(2541,33,35,8192,2,41459,0,2,1),
+(2542,33,35,8192,2,41459,1,2,1),
+(2543,33,35,8192,2,41459,2,2,1),
+(2544,33,35,32,2,41459,0,5,1),
+(2545,33,35,32,2,41459,1,5,1),
+(2546,33,35,32,2,41459,2,5,1),
+(2547,33,35,512,2,41459,0,5,1),
+(2548,33,35,512,2,41459,1,5,1),
+(2549,33,35,512,2,41459,2,5,1),
+(2550,33,35,2,2,41459,0,4,1),
+(2551,33,35,2,2,41459,1,4,1),
+(2552,33,35,2,2,41459,2,4,1),
+(2553,28,37,0,2,41459,0,7,1),
+(2554,28,37,1,2,41459,0,3,1),
+(2555,28,37,1,2,41459,1,3,1),
+(2556,28,37,1,2,41459,2,3,1),
+(2557,28,37,16,2,41459,0,2,1),
+(2558,28,37,16,2,41459,1,2,1),
+(2559,28,37,16,2,41459,2,2,1),
+(2560,28,37,128,2,41459,0,7,1),
+(2561,28,37,128,2,41459,1,7,1),
+(2562,28,37,128,2,41459,2,7,1),
+(2563,28,37,256,2,41459,0,7,1),
+(2564,28,37,256,2,41459,1,7,1),
+(2565,28,37,256,2,41459,2,7,1),
+(2566,28,37,1024,2,41459,0,7,1),
+(2567,28,37,1024,2,41459,1,7,1),
+(2568,28,37,1024,2,41459,2,7,1),
+(2569,28,37,2048,2,41459,0,2,1),
+(2570,28,37,2048,2,41459,1,2,1),
+(2571,28,37,2048,2,41459,2,2,1),
+(2572,28,37,4096,2,41459,0,2,1),
+(2573,28,37,4096,2,41459,1,2,1),
+(2574,28,37,4096,2,41459,2,2,1),
+(2575,28,37,8192,2,41459,0,2,1),
+(2576,28,37,8192,2,41459,1,2,1),
+(2577,28,37,8192,2,41459,2,2,1),
+(2578,28,37,32,2,41459,0,5,1),
+(2579,28,37,32,2,41459,1,5,1),
+(2580,28,37,32,2,41459,2,5,1),
+(2581,28,37,512,2,41459,0,5,1),
+(2582,28,37,512,2,41459,1,5,1),
+(2583,28,37,512,2,41459,2,5,1),
+(2584,28,37,2,2,41459,0,4,1),
+(2585,28,37,2,2,41459,1,4,1),
+(2586,28,37,2,2,41459,2,4,1),
+(2587,5,14,0,2,164291,0,7,1),
+(2588,5,14,1,2,164291,0,3,1),
+(2589,5,14,1,2,164291,1,3,1),
+(2590,5,14,1,2,164291,2,3,1),
+(2591,5,14,16,2,164291,0,2,1),
+(2592,5,14,16,2,164291,1,2,1),
+(2593,5,14,16,2,164291,2,2,1),
+(2594,5,14,128,2,164291,0,7,1),
+(2595,5,14,128,2,164291,1,7,1),
+(2596,5,14,128,2,164291,2,7,1),
+(2597,5,14,256,2,164291,0,7,1),
+(2598,5,14,256,2,164291,1,7,1),
+(2599,5,14,256,2,164291,2,7,1),
+(2600,5,14,1024,2,164291,0,7,1),
+(2601,5,14,1024,2,164291,1,7,1),
+(2602,5,14,1024,2,164291,2,7,1),
+(2603,5,14,2048,2,164291,0,2,1),
+(2604,5,14,2048,2,164291,1,2,1),
+(2605,5,14,2048,2,164291,2,2,1),
+(2606,5,14,4096,2,164291,0,2,1),
+(2607,5,14,4096,2,164291,1,2,1),
+(2608,5,14,4096,2,164291,2,2,1),
+(2609,5,14,8192,2,164291,0,2,1),
+(2610,5,14,8192,2,164291,1,2,1),
+(2611,5,14,8192,2,164291,2,2,1),
+(2612,5,14,32,2,164291,0,5,1),
+(2613,5,14,32,2,164291,1,5,1),
+(2614,5,14,32,2,164291,2,5,1),
+(2615,5,14,512,2,164291,0,5,1),
+(2616,5,14,512,2,164291,1,5,1),
+(2617,5,14,512,2,164291,2,5,1),
+(2618,5,14,2,2,164291,0,4,1),
+(2619,5,14,2,2,164291,1,4,1),
+(2620,5,14,2,2,164291,2,4,1),
+(2621,15,24,0,2,164291,0,7,1),
+(2622,15,24,1,2,164291,0,3,1),
+(2623,15,24,1,2,164291,1,3,1),
+(2624,15,24,1,2,164291,2,3,1),
+(2625,15,24,16,2,164291,0,2,1),
+(2626,15,24,16,2,164291,1,2,1),
+(2627,15,24,16,2,164291,2,2,1),
+(2628,15,24,128,2,164291,0,7,1),
+(2629,15,24,128,2,164291,1,7,1),
+(2630,15,24,128,2,164291,2,7,1),
+(2631,15,24,256,2,164291,0,7,1),
+(2632,15,24,256,2,164291,1,7,1),
+(2633,15,24,256,2,164291,2,7,1),
+(2634,15,24,1024,2,164291,0,7,1),
+(2635,15,24,1024,2,164291,1,7,1),
+(2636,15,24,1024,2,164291,2,7,1),
+(2637,15,24,2048,2,164291,0,2,1),
+(2638,15,24,2048,2,164291,1,2,1),
+(2639,15,24,2048,2,164291,2,2,1),
+(2640,15,24,4096,2,164291,0,2,1),
+(2641,15,24,4096,2,164291,1,2,1),
+(2642,15,24,4096,2,164291,2,2,1),
+(2643,15,24,8192,2,164291,0,2,1),
+(2644,15,24,8192,2,164291,1,2,1),
+(2645,15,24,8192,2,164291,2,2,1),
+(2646,15,24,32,2,164291,0,5,1),
+(2647,15,24,32,2,164291,1,5,1),
+(2648,15,24,32,2,164291,2,5,1),
+(2649,15,24,512,2,164291,0,5,1),
+(2650,15,24,512,2,164291,1,5,1),
+(2651,15,24,512,2,164291,2,5,1),
+(2652,15,24,2,2,164291,0,4,1),
+(2653,15,24,2,2,164291,1,4,1),
+(2654,15,24,2,2,164291,2,4,1),
+(2655,1,4,0,2,9264,0,7,1),
+(2656,1,4,1,2,9264,0,3,1),
+(2657,1,4,1,2,9264,1,3,1),
+(2658,1,4,1,2,9264,2,3,1),
+(2659,1,4,16,2,9264,0,2,1),
+(2660,1,4,16,2,9264,1,2,1),
+(2661,1,4,16,2,9264,2,2,1),
+(2662,1,4,128,2,9264,0,7,1),
+(2663,1,4,128,2,9264,1,7,1),
+(2664,1,4,128,2,9264,2,7,1),
+(2665,1,4,256,2,9264,0,7,1),
+(2666,1,4,256,2,9264,1,7,1),
+(2667,1,4,256,2,9264,2,7,1),
+(2668,1,4,1024,2,9264,0,7,1),
+(2669,1,4,1024,2,9264,1,7,1),
+(2670,1,4,1024,2,9264,2,7,1),
+(2671,1,4,2048,2,9264,0,2,1),
+(2672,1,4,2048,2,9264,1,2,1),
+(2673,1,4,2048,2,9264,2,2,1),
+(2674,1,4,4096,2,9264,0,2,1),
+(2675,1,4,4096,2,9264,1,2,1),
+(2676,1,4,4096,2,9264,2,2,1),
+(2677,1,4,8192,2,9264,0,2,1),
+(2678,1,4,8192,2,9264,1,2,1),
+(2679,1,4,8192,2,9264,2,2,1),
+(2680,1,4,32,2,9264,0,5,1),
+(2681,1,4,32,2,9264,1,5,1),
+(2682,1,4,32,2,9264,2,5,1),
+(2683,1,4,512,2,9264,0,5,1),
+(2684,1,4,512,2,9264,1,5,1),
+(2685,1,4,512,2,9264,2,5,1),
+(2686,1,4,2,2,9264,0,4,1),
+(2687,1,4,2,2,9264,1,4,1),
+(2688,1,4,2,2,9264,2,4,1),
+(2689,5,14,0,2,9264,0,7,1),
+(2690,5,14,1,2,9264,0,3,1),
+(2691,5,14,1,2,9264,1,3,1),
+(2692,5,14,1,2,9264,2,3,1),
+(2693,5,14,16,2,9264,0,2,1),
+(2694,5,14,16,2,9264,1,2,1),
+(2695,5,14,16,2,9264,2,2,1),
+(2696,5,14,128,2,9264,0,7,1),
+(2697,5,14,128,2,9264,1,7,1),
+(2698,5,14,128,2,9264,2,7,1),
+(2699,5,14,256,2,9264,0,7,1),
+(2700,5,14,256,2,9264,1,7,1),
+(2701,5,14,256,2,9264,2,7,1),
+(2702,5,14,1024,2,9264,0,7,1),
+(2703,5,14,1024,2,9264,1,7,1),
+(2704,5,14,1024,2,9264,2,7,1),
+(2705,5,14,2048,2,9264,0,2,1),
+(2706,5,14,2048,2,9264,1,2,1),
+(2707,5,14,2048,2,9264,2,2,1),
+(2708,5,14,4096,2,9264,0,2,1),
+(2709,5,14,4096,2,9264,1,2,1),
+(2710,5,14,4096,2,9264,2,2,1),
+(2711,5,14,8192,2,9264,0,2,1),
+(2712,5,14,8192,2,9264,1,2,1),
+(2713,5,14,8192,2,9264,2,2,1),
+(2714,5,14,32,2,9264,0,5,1),
+(2715,5,14,32,2,9264,1,5,1),
+(2716,5,14,32,2,9264,2,5,1),
+(2717,5,14,512,2,9264,0,5,1),
+(2718,5,14,512,2,9264,1,5,1),
+(2719,5,14,512,2,9264,2,5,1),
+(2720,5,14,2,2,9264,0,4,1),
+(2721,5,14,2,2,9264,1,4,1),
+(2722,5,14,2,2,9264,2,4,1),
+(2723,15,24,0,2,9264,0,7,1),
+(2724,15,24,1,2,9264,0,3,1),
+(2725,15,24,1,2,9264,1,3,1),
+(2726,15,24,1,2,9264,2,3,1),
+(2727,15,24,16,2,9264,0,2,1),
+(2728,15,24,16,2,9264,1,2,1),
+(2729,15,24,16,2,9264,2,2,1),
+(2730,15,24,128,2,9264,0,7,1),
+(2731,15,24,128,2,9264,1,7,1),
+(2732,15,24,128,2,9264,2,7,1),
+(2733,15,24,256,2,9264,0,7,1),
+(2734,15,24,256,2,9264,1,7,1),
+(2735,15,24,256,2,9264,2,7,1),
+(2736,15,24,1024,2,9264,0,7,1),
+(2737,15,24,1024,2,9264,1,7,1),
+(2738,15,24,1024,2,9264,2,7,1),
+(2739,15,24,2048,2,9264,0,2,1),
+(2740,15,24,2048,2,9264,1,2,1),
+(2741,15,24,2048,2,9264,2,2,1),
+(2742,15,24,4096,2,9264,0,2,1),
+(2743,15,24,4096,2,9264,1,2,1),
+(2744,15,24,4096,2,9264,2,2,1),
+(2745,15,24,8192,2,9264,0,2,1),
+(2746,15,24,8192,2,9264,1,2,1),
+(2747,15,24,8192,2,9264,2,2,1),
+(2748,15,24,32,2,9264,0,5,1),
+(2749,15,24,32,2,9264,1,5,1),
+(2750,15,24,32,2,9264,2,5,1),
+(2751,15,24,512,2,9264,0,5,1),
+(2752,15,24,512,2,9264,1,5,1),
+(2753,15,24,512,2,9264,2,5,1),
+(2754,15,24,2,2,9264,0,4,1),
+(2755,15,24,2,2,9264,1,4,1),
+(2756,15,24,2,2,9264,2,4,1),
+(2757,20,83,0,2,41459,0,7,1),
+(2758,20,83,1,2,41459,0,3,1),
+(2759,20,83,1,2,41459,1,3,1),
+(2760,20,83,1,2,41459,2,3,1),
+(2761,20,83,16,2,41459,0,2,1),
+(2762,20,83,16,2,41459,1,2,1),
+(2763,20,83,16,2,41459,2,2,1),
+(2764,20,83,128,2,41459,0,7,1),
+(2765,20,83,128,2,41459,1,7,1),
+(2766,20,83,128,2,41459,2,7,1),
+(2767,20,83,256,2,41459,0,7,1),
+(2768,20,83,256,2,41459,1,7,1),
+(2769,20,83,256,2,41459,2,7,1),
+(2770,20,83,1024,2,41459,0,7,1),
+(2771,20,83,1024,2,41459,1,7,1),
+(2772,20,83,1024,2,41459,2,7,1),
+(2773,20,83,2048,2,41459,0,2,1),
+(2774,20,83,2048,2,41459,1,2,1),
+(2775,20,83,2048,2,41459,2,2,1),
+(2776,20,83,4096,2,41459,0,2,1),
+(2777,20,83,4096,2,41459,1,2,1),
+(2778,20,83,4096,2,41459,2,2,1),
+(2779,20,83,8192,2,41459,0,2,1),
+(2780,20,83,8192,2,41459,1,2,1),
+(2781,20,83,8192,2,41459,2,2,1),
+(2782,20,83,32,2,41459,0,5,1),
+(2783,20,83,32,2,41459,1,5,1),
+(2784,20,83,32,2,41459,2,5,1),
+(2785,20,83,512,2,41459,0,5,1),
+(2786,20,83,512,2,41459,1,5,1),
+(2787,20,83,512,2,41459,2,5,1),
+(2788,20,83,2,2,41459,0,4,1),
+(2789,20,83,2,2,41459,1,4,1),
+(2790,20,83,2,2,41459,2,4,1),
+(2791,24,69,0,2,41459,0,7,1),
+(2792,24,69,1,2,41459,0,3,1),
+(2793,24,69,1,2,41459,1,3,1),
+(2794,24,69,1,2,41459,2,3,1),
+(2795,24,69,16,2,41459,0,2,1),
+(2796,24,69,16,2,41459,1,2,1),
+(2797,24,69,16,2,41459,2,2,1),
+(2798,24,69,128,2,41459,0,7,1),
+(2799,24,69,128,2,41459,1,7,1),
+(2800,24,69,128,2,41459,2,7,1),
+(2801,24,69,256,2,41459,0,7,1),
+(2802,24,69,256,2,41459,1,7,1),
+(2803,24,69,256,2,41459,2,7,1),
+(2804,24,69,1024,2,41459,0,7,1),
+(2805,24,69,1024,2,41459,1,7,1),
+(2806,24,69,1024,2,41459,2,7,1),
+(2807,24,69,2048,2,41459,0,2,1),
+(2808,24,69,2048,2,41459,1,2,1),
+(2809,24,69,2048,2,41459,2,2,1),
+(2810,24,69,4096,2,41459,0,2,1),
+(2811,24,69,4096,2,41459,1,2,1),
+(2812,24,69,4096,2,41459,2,2,1),
+(2813,24,69,8192,2,41459,0,2,1),
+(2814,24,69,8192,2,41459,1,2,1),
+(2815,24,69,8192,2,41459,2,2,1),
+(2816,24,69,32,2,41459,0,5,1),
+(2817,24,69,32,2,41459,1,5,1),
+(2818,24,69,32,2,41459,2,5,1),
+(2819,24,69,512,2,41459,0,5,1),
+(2820,24,69,512,2,41459,1,5,1),
+(2821,24,69,512,2,41459,2,5,1),
+(2822,24,69,2,2,41459,0,4,1),
+(2823,24,69,2,2,41459,1,4,1),
+(2824,24,69,2,2,41459,2,4,1),
+(2825,40,69,0,2,41459,0,7,1),
+(2826,40,69,1,2,41459,0,3,1),
+(2827,40,69,1,2,41459,1,3,1),
+(2828,40,69,1,2,41459,2,3,1),
+(2829,40,69,16,2,41459,0,2,1),
+(2830,40,69,16,2,41459,1,2,1),
+(2831,40,69,16,2,41459,2,2,1),
+(2832,40,69,128,2,41459,0,7,1),
+(2833,40,69,128,2,41459,1,7,1),
+(2834,40,69,128,2,41459,2,7,1),
+(2835,40,69,256,2,41459,0,7,1),
+(2836,40,69,256,2,41459,1,7,1),
+(2837,40,69,256,2,41459,2,7,1),
+(2838,40,69,1024,2,41459,0,7,1),
+(2839,40,69,1024,2,41459,1,7,1),
+(2840,40,69,1024,2,41459,2,7,1),
+(2841,40,69,2048,2,41459,0,2,1),
+(2842,40,69,2048,2,41459,1,2,1),
+(2843,40,69,2048,2,41459,2,2,1),
+(2844,40,69,4096,2,41459,0,2,1),
+(2845,40,69,4096,2,41459,1,2,1),
+(2846,40,69,4096,2,41459,2,2,1),
+(2847,40,69,8192,2,41459,0,2,1),
+(2848,40,69,8192,2,41459,1,2,1),
+(2849,40,69,8192,2,41459,2,2,1),
+(2850,40,69,32,2,41459,0,5,1),
+(2851,40,69,32,2,41459,1,5,1),
+(2852,40,69,32,2,41459,2,5,1),
+(2853,40,69,512,2,41459,0,5,1),
+(2854,40,69,512,2,41459,1,5,1),
+(2855,40,69,512,2,41459,2,5,1),
+(2856,40,69,2,2,41459,0,4,1),
+(2857,40,69,2,2,41459,1,4,1),
+(2858,40,69,2,2,41459,2,4,1),
+(2859,5,12,0,2,327692,0,23,1),
+(2860,5,12,1,2,327692,0,3,1),
+(2861,5,12,1,2,327692,1,3,1),
+(2862,5,12,1,2,327692,2,3,1),
+(2863,5,12,16,2,327692,0,2,1),
+(2864,5,12,16,2,327692,1,2,1),
+(2865,5,12,16,2,327692,2,2,1),
+(2866,5,12,128,2,327692,0,23,1),
+(2867,5,12,128,2,327692,1,23,1),
+(2868,5,12,128,2,327692,2,23,1),
+(2869,5,12,256,2,327692,0,23,1),
+(2870,5,12,256,2,327692,1,23,1),
+(2871,5,12,256,2,327692,2,23,1),
+(2872,5,12,1024,2,327692,0,7,1),
+(2873,5,12,1024,2,327692,1,7,1),
+(2874,5,12,1024,2,327692,2,7,1),
+(2875,5,12,2048,2,327692,0,2,1),
+(2876,5,12,2048,2,327692,1,2,1),
+(2877,5,12,2048,2,327692,2,2,1),
+(2878,5,12,4096,2,327692,0,2,1),
+(2879,5,12,4096,2,327692,1,2,1),
+(2880,5,12,4096,2,327692,2,2,1),
+(2881,5,12,8192,2,327692,0,2,1),
+(2882,5,12,8192,2,327692,1,2,1),
+(2883,5,12,8192,2,327692,2,2,1),
+(2884,5,12,32,2,327692,0,21,1),
+(2885,5,12,32,2,327692,1,21,1),
+(2886,5,12,32,2,327692,2,21,1),
+(2887,5,12,512,2,327692,0,21,1),
+(2888,5,12,512,2,327692,1,21,1),
+(2889,5,12,512,2,327692,2,21,1),
+(2890,5,12,2,2,327692,0,20,1),
+(2891,5,12,2,2,327692,1,20,1),
+(2892,5,12,2,2,327692,2,20,1),
+(2893,10,22,0,2,327692,0,23,1),
+(2894,10,22,1,2,327692,0,3,1),
+(2895,10,22,1,2,327692,1,3,1),
+(2896,10,22,1,2,327692,2,3,1),
+(2897,10,22,16,2,327692,0,2,1),
+(2898,10,22,16,2,327692,1,2,1),
+(2899,10,22,16,2,327692,2,2,1),
+(2900,10,22,128,2,327692,0,23,1),
+(2901,10,22,128,2,327692,1,23,1),
+(2902,10,22,128,2,327692,2,23,1),
+(2903,10,22,256,2,327692,0,23,1),
+(2904,10,22,256,2,327692,1,23,1),
+(2905,10,22,256,2,327692,2,23,1),
+(2906,10,22,1024,2,327692,0,7,1),
+(2907,10,22,1024,2,327692,1,7,1),
+(2908,10,22,1024,2,327692,2,7,1),
+(2909,10,22,2048,2,327692,0,2,1),
+(2910,10,22,2048,2,327692,1,2,1),
+(2911,10,22,2048,2,327692,2,2,1),
+(2912,10,22,4096,2,327692,0,2,1),
+(2913,10,22,4096,2,327692,1,2,1),
+(2914,10,22,4096,2,327692,2,2,1),
+(2915,10,22,8192,2,327692,0,2,1),
+(2916,10,22,8192,2,327692,1,2,1),
+(2917,10,22,8192,2,327692,2,2,1),
+(2918,10,22,32,2,327692,0,21,1),
+(2919,10,22,32,2,327692,1,21,1),
+(2920,10,22,32,2,327692,2,21,1),
+(2921,10,22,512,2,327692,0,21,1),
+(2922,10,22,512,2,327692,1,21,1),
+(2923,10,22,512,2,327692,2,21,1),
+(2924,10,22,2,2,327692,0,20,1),
+(2925,10,22,2,2,327692,1,20,1),
+(2926,10,22,2,2,327692,2,20,1),
+(2927,20,36,0,2,327692,0,23,1),
+(2928,20,36,1,2,327692,0,3,1),
+(2929,20,36,1,2,327692,1,3,1),
+(2930,20,36,1,2,327692,2,3,1),
+(2931,20,36,16,2,327692,0,2,1),
+(2932,20,36,16,2,327692,1,2,1),
+(2933,20,36,16,2,327692,2,2,1),
+(2934,20,36,128,2,327692,0,23,1),
+(2935,20,36,128,2,327692,1,23,1),
+(2936,20,36,128,2,327692,2,23,1),
+(2937,20,36,256,2,327692,0,23,1),
+(2938,20,36,256,2,327692,1,23,1),
+(2939,20,36,256,2,327692,2,23,1),
+(2940,20,36,1024,2,327692,0,7,1),
+(2941,20,36,1024,2,327692,1,7,1),
+(2942,20,36,1024,2,327692,2,7,1),
+(2943,20,36,2048,2,327692,0,2,1),
+(2944,20,36,2048,2,327692,1,2,1),
+(2945,20,36,2048,2,327692,2,2,1),
+(2946,20,36,4096,2,327692,0,2,1),
+(2947,20,36,4096,2,327692,1,2,1),
+(2948,20,36,4096,2,327692,2,2,1),
+(2949,20,36,8192,2,327692,0,2,1),
+(2950,20,36,8192,2,327692,1,2,1),
+(2951,20,36,8192,2,327692,2,2,1),
+(2952,20,36,32,2,327692,0,21,1),
+(2953,20,36,32,2,327692,1,21,1),
+(2954,20,36,32,2,327692,2,21,1),
+(2955,20,36,512,2,327692,0,21,1),
+(2956,20,36,512,2,327692,1,21,1),
+(2957,20,36,512,2,327692,2,21,1),
+(2958,20,36,2,2,327692,0,20,1),
+(2959,20,36,2,2,327692,1,20,1),
+(2960,20,36,2,2,327692,2,20,1),
+(2961,24,83,0,2,41459,0,7,1),
+(2962,24,83,1,2,41459,0,3,1),
+(2963,24,83,1,2,41459,1,3,1),
+(2964,24,83,1,2,41459,2,3,1),
+(2965,24,83,16,2,41459,0,2,1),
+(2966,24,83,16,2,41459,1,2,1),
+(2967,24,83,16,2,41459,2,2,1),
+(2968,24,83,128,2,41459,0,7,1),
+(2969,24,83,128,2,41459,1,7,1),
+(2970,24,83,128,2,41459,2,7,1),
+(2971,24,83,256,2,41459,0,7,1),
+(2972,24,83,256,2,41459,1,7,1),
+(2973,24,83,256,2,41459,2,7,1),
+(2974,24,83,1024,2,41459,0,7,1),
+(2975,24,83,1024,2,41459,1,7,1),
+(2976,24,83,1024,2,41459,2,7,1),
+(2977,24,83,2048,2,41459,0,2,1),
+(2978,24,83,2048,2,41459,1,2,1),
+(2979,24,83,2048,2,41459,2,2,1),
+(2980,24,83,4096,2,41459,0,2,1),
+(2981,24,83,4096,2,41459,1,2,1),
+(2982,24,83,4096,2,41459,2,2,1),
+(2983,24,83,8192,2,41459,0,2,1),
+(2984,24,83,8192,2,41459,1,2,1),
+(2985,24,83,8192,2,41459,2,2,1),
+(2986,24,83,32,2,41459,0,5,1),
+(2987,24,83,32,2,41459,1,5,1),
+(2988,24,83,32,2,41459,2,5,1),
+(2989,24,83,512,2,41459,0,5,1),
+(2990,24,83,512,2,41459,1,5,1),
+(2991,24,83,512,2,41459,2,5,1),
+(2992,24,83,2,2,41459,0,4,1),
+(2993,24,83,2,2,41459,1,4,1),
+(2994,24,83,2,2,41459,2,4,1),
+(2995,40,65,0,2,41459,0,7,1),
+(2996,40,65,1,2,41459,0,3,1),
+(2997,40,65,1,2,41459,1,3,1),
+(2998,40,65,1,2,41459,2,3,1),
+(2999,40,65,16,2,41459,0,2,1),
+(3000,40,65,16,2,41459,1,2,1),
+(3001,40,65,16,2,41459,2,2,1),
+(3002,40,65,128,2,41459,0,7,1),
+(3003,40,65,128,2,41459,1,7,1),
+(3004,40,65,128,2,41459,2,7,1),
+(3005,40,65,256,2,41459,0,7,1),
+(3006,40,65,256,2,41459,1,7,1),
+(3007,40,65,256,2,41459,2,7,1),
+(3008,40,65,1024,2,41459,0,7,1),
+(3009,40,65,1024,2,41459,1,7,1),
+(3010,40,65,1024,2,41459,2,7,1),
+(3011,40,65,2048,2,41459,0,2,1),
+(3012,40,65,2048,2,41459,1,2,1),
+(3013,40,65,2048,2,41459,2,2,1),
+(3014,40,65,4096,2,41459,0,2,1),
+(3015,40,65,4096,2,41459,1,2,1),
+(3016,40,65,4096,2,41459,2,2,1),
+(3017,40,65,8192,2,41459,0,2,1),
+(3018,40,65,8192,2,41459,1,2,1),
+(3019,40,65,8192,2,41459,2,2,1),
+(3020,40,65,32,2,41459,0,5,1),
+(3021,40,65,32,2,41459,1,5,1),
+(3022,40,65,32,2,41459,2,5,1),
+(3023,40,65,512,2,41459,0,5,1),
+(3024,40,65,512,2,41459,1,5,1),
+(3025,40,65,512,2,41459,2,5,1),
+(3026,40,65,2,2,41459,0,4,1),
+(3027,40,65,2,2,41459,1,4,1),
+(3028,40,65,2,2,41459,2,4,1),
+(3029,1,59,0,2,41459,0,7,1),
+(3030,1,59,1,2,41459,0,3,1),
+(3031,1,59,1,2,41459,1,3,1),
+(3032,1,59,1,2,41459,2,3,1),
+(3033,1,59,16,2,41459,0,2,1),
+(3034,1,59,16,2,41459,1,2,1),
+(3035,1,59,16,2,41459,2,2,1),
+(3036,1,59,128,2,41459,0,7,1),
+(3037,1,59,128,2,41459,1,7,1),
+(3038,1,59,128,2,41459,2,7,1),
+(3039,1,59,256,2,41459,0,7,1),
+(3040,1,59,256,2,41459,1,7,1),
+(3041,1,59,256,2,41459,2,7,1),
+(3042,1,59,1024,2,41459,0,7,1),
+(3043,1,59,1024,2,41459,1,7,1),
+(3044,1,59,1024,2,41459,2,7,1),
+(3045,1,59,2048,2,41459,0,2,1),
+(3046,1,59,2048,2,41459,1,2,1),
+(3047,1,59,2048,2,41459,2,2,1),
+(3048,1,59,4096,2,41459,0,2,1),
+(3049,1,59,4096,2,41459,1,2,1),
+(3050,1,59,4096,2,41459,2,2,1),
+(3051,1,59,8192,2,41459,0,2,1),
+(3052,1,59,8192,2,41459,1,2,1),
+(3053,1,59,8192,2,41459,2,2,1),
+(3054,1,59,32,2,41459,0,5,1),
+(3055,1,59,32,2,41459,1,5,1),
+(3056,1,59,32,2,41459,2,5,1),
+(3057,1,59,512,2,41459,0,5,1),
+(3058,1,59,512,2,41459,1,5,1),
+(3059,1,59,512,2,41459,2,5,1),
+(3060,1,59,2,2,41459,0,4,1),
+(3061,1,59,2,2,41459,1,4,1),
+(3062,1,59,2,2,41459,2,4,1),
+(3063,1,4,0,2,164291,0,7,1),
+(3064,1,4,1,2,164291,0,3,1),
+(3065,1,4,1,2,164291,1,3,1),
+(3066,1,4,1,2,164291,2,3,1),
+(3067,1,4,16,2,164291,0,2,1),
+(3068,1,4,16,2,164291,1,2,1),
+(3069,1,4,16,2,164291,2,2,1),
+(3070,1,4,128,2,164291,0,7,1),
+(3071,1,4,128,2,164291,1,7,1),
+(3072,1,4,128,2,164291,2,7,1),
+(3073,1,4,256,2,164291,0,7,1),
+(3074,1,4,256,2,164291,1,7,1),
+(3075,1,4,256,2,164291,2,7,1),
+(3076,1,4,1024,2,164291,0,7,1),
+(3077,1,4,1024,2,164291,1,7,1),
+(3078,1,4,1024,2,164291,2,7,1),
+(3079,1,4,2048,2,164291,0,2,1),
+(3080,1,4,2048,2,164291,1,2,1),
+(3081,1,4,2048,2,164291,2,2,1),
+(3082,1,4,4096,2,164291,0,2,1),
+(3083,1,4,4096,2,164291,1,2,1),
+(3084,1,4,4096,2,164291,2,2,1),
+(3085,1,4,8192,2,164291,0,2,1),
+(3086,1,4,8192,2,164291,1,2,1),
+(3087,1,4,8192,2,164291,2,2,1),
+(3088,1,4,32,2,164291,0,5,1),
+(3089,1,4,32,2,164291,1,5,1),
+(3090,1,4,32,2,164291,2,5,1),
+(3091,1,4,512,2,164291,0,5,1),
+(3092,1,4,512,2,164291,1,5,1),
+(3093,1,4,512,2,164291,2,5,1),
+(3094,1,4,2,2,164291,0,4,1),
+(3095,1,4,2,2,164291,1,4,1),
+(3096,1,4,2,2,164291,2,4,1),
+(3097,28,36,0,2,41459,0,7,1),
+(3098,28,36,1,2,41459,0,3,1),
+(3099,28,36,1,2,41459,1,3,1),
+(3100,28,36,1,2,41459,2,3,1),
+(3101,28,36,16,2,41459,0,2,1),
+(3102,28,36,16,2,41459,1,2,1),
+(3103,28,36,16,2,41459,2,2,1),
+(3104,28,36,128,2,41459,0,7,1),
+(3105,28,36,128,2,41459,1,7,1),
+(3106,28,36,128,2,41459,2,7,1),
+(3107,28,36,256,2,41459,0,7,1),
+(3108,28,36,256,2,41459,1,7,1),
+(3109,28,36,256,2,41459,2,7,1),
+(3110,28,36,1024,2,41459,0,7,1),
+(3111,28,36,1024,2,41459,1,7,1),
+(3112,28,36,1024,2,41459,2,7,1),
+(3113,28,36,2048,2,41459,0,2,1),
+(3114,28,36,2048,2,41459,1,2,1),
+(3115,28,36,2048,2,41459,2,2,1),
+(3116,28,36,4096,2,41459,0,2,1),
+(3117,28,36,4096,2,41459,1,2,1),
+(3118,28,36,4096,2,41459,2,2,1),
+(3119,28,36,8192,2,41459,0,2,1),
+(3120,28,36,8192,2,41459,1,2,1),
+(3121,28,36,8192,2,41459,2,2,1),
+(3122,28,36,32,2,41459,0,5,1),
+(3123,28,36,32,2,41459,1,5,1),
+(3124,28,36,32,2,41459,2,5,1),
+(3125,28,36,512,2,41459,0,5,1),
+(3126,28,36,512,2,41459,1,5,1),
+(3127,28,36,512,2,41459,2,5,1),
+(3128,28,36,2,2,41459,0,4,1),
+(3129,28,36,2,2,41459,1,4,1),
+(3130,28,36,2,2,41459,2,4,1),
+(3131,1,6,0,2,41459,0,7,1),
+(3132,1,6,1,2,41459,0,3,1),
+(3133,1,6,1,2,41459,1,3,1),
+(3134,1,6,1,2,41459,2,3,1),
+(3135,1,6,16,2,41459,0,2,1),
+(3136,1,6,16,2,41459,1,2,1),
+(3137,1,6,16,2,41459,2,2,1),
+(3138,1,6,128,2,41459,0,7,1),
+(3139,1,6,128,2,41459,1,7,1),
+(3140,1,6,128,2,41459,2,7,1),
+(3141,1,6,256,2,41459,0,7,1),
+(3142,1,6,256,2,41459,1,7,1),
+(3143,1,6,256,2,41459,2,7,1),
+(3144,1,6,1024,2,41459,0,7,1),
+(3145,1,6,1024,2,41459,1,7,1),
+(3146,1,6,1024,2,41459,2,7,1),
+(3147,1,6,2048,2,41459,0,2,1),
+(3148,1,6,2048,2,41459,1,2,1),
+(3149,1,6,2048,2,41459,2,2,1),
+(3150,1,6,4096,2,41459,0,2,1),
+(3151,1,6,4096,2,41459,1,2,1),
+(3152,1,6,4096,2,41459,2,2,1),
+(3153,1,6,8192,2,41459,0,2,1),
+(3154,1,6,8192,2,41459,1,2,1),
+(3155,1,6,8192,2,41459,2,2,1),
+(3156,1,6,32,2,41459,0,5,1),
+(3157,1,6,32,2,41459,1,5,1),
+(3158,1,6,32,2,41459,2,5,1),
+(3159,1,6,512,2,41459,0,5,1),
+(3160,1,6,512,2,41459,1,5,1),
+(3161,1,6,512,2,41459,2,5,1),
+(3162,1,6,2,2,41459,0,4,1),
+(3163,1,6,2,2,41459,1,4,1),
+(3164,1,6,2,2,41459,2,4,1),
+(3165,1,12,0,2,41459,0,7,1),
+(3166,1,12,1,2,41459,0,3,1),
+(3167,1,12,1,2,41459,1,3,1),
+(3168,1,12,1,2,41459,2,3,1),
+(3169,1,12,16,2,41459,0,2,1),
+(3170,1,12,16,2,41459,1,2,1),
+(3171,1,12,16,2,41459,2,2,1),
+(3172,1,12,128,2,41459,0,7,1),
+(3173,1,12,128,2,41459,1,7,1),
+(3174,1,12,128,2,41459,2,7,1),
+(3175,1,12,256,2,41459,0,7,1),
+(3176,1,12,256,2,41459,1,7,1),
+(3177,1,12,256,2,41459,2,7,1),
+(3178,1,12,1024,2,41459,0,7,1),
+(3179,1,12,1024,2,41459,1,7,1),
+(3180,1,12,1024,2,41459,2,7,1),
+(3181,1,12,2048,2,41459,0,2,1),
+(3182,1,12,2048,2,41459,1,2,1),
+(3183,1,12,2048,2,41459,2,2,1),
+(3184,1,12,4096,2,41459,0,2,1),
+(3185,1,12,4096,2,41459,1,2,1),
+(3186,1,12,4096,2,41459,2,2,1),
+(3187,1,12,8192,2,41459,0,2,1),
+(3188,1,12,8192,2,41459,1,2,1),
+(3189,1,12,8192,2,41459,2,2,1),
+(3190,1,12,32,2,41459,0,5,1),
+(3191,1,12,32,2,41459,1,5,1),
+(3192,1,12,32,2,41459,2,5,1),
+(3193,1,12,512,2,41459,0,5,1),
+(3194,1,12,512,2,41459,1,5,1),
+(3195,1,12,512,2,41459,2,5,1),
+(3196,1,12,2,2,41459,0,4,1),
+(3197,1,12,2,2,41459,1,4,1),
+(3198,1,12,2,2,41459,2,4,1),
+(3199,5,13,0,2,41459,0,7,1),
+(3200,5,13,1,2,41459,0,3,1),
+(3201,5,13,1,2,41459,1,3,1),
+(3202,5,13,1,2,41459,2,3,1),
+(3203,5,13,16,2,41459,0,2,1),
+(3204,5,13,16,2,41459,1,2,1),
+(3205,5,13,16,2,41459,2,2,1),
+(3206,5,13,128,2,41459,0,7,1),
+(3207,5,13,128,2,41459,1,7,1),
+(3208,5,13,128,2,41459,2,7,1),
+(3209,5,13,256,2,41459,0,7,1),
+(3210,5,13,256,2,41459,1,7,1),
+(3211,5,13,256,2,41459,2,7,1),
+(3212,5,13,1024,2,41459,0,7,1),
+(3213,5,13,1024,2,41459,1,7,1),
+(3214,5,13,1024,2,41459,2,7,1),
+(3215,5,13,2048,2,41459,0,2,1),
+(3216,5,13,2048,2,41459,1,2,1),
+(3217,5,13,2048,2,41459,2,2,1),
+(3218,5,13,4096,2,41459,0,2,1),
+(3219,5,13,4096,2,41459,1,2,1),
+(3220,5,13,4096,2,41459,2,2,1),
+(3221,5,13,8192,2,41459,0,2,1),
+(3222,5,13,8192,2,41459,1,2,1),
+(3223,5,13,8192,2,41459,2,2,1),
+(3224,5,13,32,2,41459,0,5,1),
+(3225,5,13,32,2,41459,1,5,1),
+(3226,5,13,32,2,41459,2,5,1),
+(3227,5,13,512,2,41459,0,5,1),
+(3228,5,13,512,2,41459,1,5,1),
+(3229,5,13,512,2,41459,2,5,1),
+(3230,5,13,2,2,41459,0,4,1),
+(3231,5,13,2,2,41459,1,4,1),
+(3232,5,13,2,2,41459,2,4,1),
+(3233,7,16,0,2,41459,0,7,1),
+(3234,7,16,1,2,41459,0,3,1),
+(3235,7,16,1,2,41459,1,3,1),
+(3236,7,16,1,2,41459,2,3,1),
+(3237,7,16,16,2,41459,0,2,1),
+(3238,7,16,16,2,41459,1,2,1),
+(3239,7,16,16,2,41459,2,2,1),
+(3240,7,16,128,2,41459,0,7,1),
+(3241,7,16,128,2,41459,1,7,1),
+(3242,7,16,128,2,41459,2,7,1),
+(3243,7,16,256,2,41459,0,7,1),
+(3244,7,16,256,2,41459,1,7,1),
+(3245,7,16,256,2,41459,2,7,1),
+(3246,7,16,1024,2,41459,0,7,1),
+(3247,7,16,1024,2,41459,1,7,1),
+(3248,7,16,1024,2,41459,2,7,1),
+(3249,7,16,2048,2,41459,0,2,1),
+(3250,7,16,2048,2,41459,1,2,1),
+(3251,7,16,2048,2,41459,2,2,1),
+(3252,7,16,4096,2,41459,0,2,1),
+(3253,7,16,4096,2,41459,1,2,1),
+(3254,7,16,4096,2,41459,2,2,1),
+(3255,7,16,8192,2,41459,0,2,1),
+(3256,7,16,8192,2,41459,1,2,1),
+(3257,7,16,8192,2,41459,2,2,1),
+(3258,7,16,32,2,41459,0,5,1),
+(3259,7,16,32,2,41459,1,5,1),
+(3260,7,16,32,2,41459,2,5,1),
+(3261,7,16,512,2,41459,0,5,1),
+(3262,7,16,512,2,41459,1,5,1),
+(3263,7,16,512,2,41459,2,5,1),
+(3264,7,16,2,2,41459,0,4,1),
+(3265,7,16,2,2,41459,1,4,1),
+(3266,7,16,2,2,41459,2,4,1),
+(3267,9,18,0,2,41459,0,7,1),
+(3268,9,18,1,2,41459,0,3,1),
+(3269,9,18,1,2,41459,1,3,1),
+(3270,9,18,1,2,41459,2,3,1),
+(3271,9,18,16,2,41459,0,2,1),
+(3272,9,18,16,2,41459,1,2,1),
+(3273,9,18,16,2,41459,2,2,1),
+(3274,9,18,128,2,41459,0,7,1),
+(3275,9,18,128,2,41459,1,7,1),
+(3276,9,18,128,2,41459,2,7,1),
+(3277,9,18,256,2,41459,0,7,1),
+(3278,9,18,256,2,41459,1,7,1),
+(3279,9,18,256,2,41459,2,7,1),
+(3280,9,18,1024,2,41459,0,7,1),
+(3281,9,18,1024,2,41459,1,7,1),
+(3282,9,18,1024,2,41459,2,7,1),
+(3283,9,18,2048,2,41459,0,2,1),
+(3284,9,18,2048,2,41459,1,2,1),
+(3285,9,18,2048,2,41459,2,2,1),
+(3286,9,18,4096,2,41459,0,2,1),
+(3287,9,18,4096,2,41459,1,2,1),
+(3288,9,18,4096,2,41459,2,2,1),
+(3289,9,18,8192,2,41459,0,2,1),
+(3290,9,18,8192,2,41459,1,2,1),
+(3291,9,18,8192,2,41459,2,2,1),
+(3292,9,18,32,2,41459,0,5,1),
+(3293,9,18,32,2,41459,1,5,1),
+(3294,9,18,32,2,41459,2,5,1),
+(3295,9,18,512,2,41459,0,5,1),
+(3296,9,18,512,2,41459,1,5,1),
+(3297,9,18,512,2,41459,2,5,1),
+(3298,9,18,2,2,41459,0,4,1),
+(3299,9,18,2,2,41459,1,4,1),
+(3300,9,18,2,2,41459,2,4,1),
+(3301,10,25,0,2,41459,0,7,1),
+(3302,10,25,1,2,41459,0,3,1),
+(3303,10,25,1,2,41459,1,3,1),
+(3304,10,25,1,2,41459,2,3,1),
+(3305,10,25,16,2,41459,0,2,1),
+(3306,10,25,16,2,41459,1,2,1),
+(3307,10,25,16,2,41459,2,2,1),
+(3308,10,25,128,2,41459,0,7,1),
+(3309,10,25,128,2,41459,1,7,1),
+(3310,10,25,128,2,41459,2,7,1),
+(3311,10,25,256,2,41459,0,7,1),
+(3312,10,25,256,2,41459,1,7,1),
+(3313,10,25,256,2,41459,2,7,1),
+(3314,10,25,1024,2,41459,0,7,1),
+(3315,10,25,1024,2,41459,1,7,1),
+(3316,10,25,1024,2,41459,2,7,1),
+(3317,10,25,2048,2,41459,0,2,1),
+(3318,10,25,2048,2,41459,1,2,1),
+(3319,10,25,2048,2,41459,2,2,1),
+(3320,10,25,4096,2,41459,0,2,1),
+(3321,10,25,4096,2,41459,1,2,1),
+(3322,10,25,4096,2,41459,2,2,1),
+(3323,10,25,8192,2,41459,0,2,1),
+(3324,10,25,8192,2,41459,1,2,1),
+(3325,10,25,8192,2,41459,2,2,1),
+(3326,10,25,32,2,41459,0,5,1),
+(3327,10,25,32,2,41459,1,5,1),
+(3328,10,25,32,2,41459,2,5,1),
+(3329,10,25,512,2,41459,0,5,1),
+(3330,10,25,512,2,41459,1,5,1),
+(3331,10,25,512,2,41459,2,5,1),
+(3332,10,25,2,2,41459,0,4,1),
+(3333,10,25,2,2,41459,1,4,1),
+(3334,10,25,2,2,41459,2,4,1),
+(3335,20,33,0,2,41459,0,7,1),
+(3336,20,33,1,2,41459,0,3,1),
+(3337,20,33,1,2,41459,1,3,1),
+(3338,20,33,1,2,41459,2,3,1),
+(3339,20,33,16,2,41459,0,2,1),
+(3340,20,33,16,2,41459,1,2,1),
+(3341,20,33,16,2,41459,2,2,1),
+(3342,20,33,128,2,41459,0,7,1),
+(3343,20,33,128,2,41459,1,7,1),
+(3344,20,33,128,2,41459,2,7,1),
+(3345,20,33,256,2,41459,0,7,1),
+(3346,20,33,256,2,41459,1,7,1),
+(3347,20,33,256,2,41459,2,7,1),
+(3348,20,33,1024,2,41459,0,7,1),
+(3349,20,33,1024,2,41459,1,7,1),
+(3350,20,33,1024,2,41459,2,7,1),
+(3351,20,33,2048,2,41459,0,2,1),
+(3352,20,33,2048,2,41459,1,2,1),
+(3353,20,33,2048,2,41459,2,2,1),
+(3354,20,33,4096,2,41459,0,2,1),
+(3355,20,33,4096,2,41459,1,2,1),
+(3356,20,33,4096,2,41459,2,2,1),
+(3357,20,33,8192,2,41459,0,2,1),
+(3358,20,33,8192,2,41459,1,2,1),
+(3359,20,33,8192,2,41459,2,2,1),
+(3360,20,33,32,2,41459,0,5,1),
+(3361,20,33,32,2,41459,1,5,1),
+(3362,20,33,32,2,41459,2,5,1),
+(3363,20,33,512,2,41459,0,5,1),
+(3364,20,33,512,2,41459,1,5,1),
+(3365,20,33,512,2,41459,2,5,1),
+(3366,20,33,2,2,41459,0,4,1),
+(3367,20,33,2,2,41459,1,4,1),
+(3368,20,33,2,2,41459,2,4,1),
+(3369,1,85,0,2,128,0,7,1),
+(3370,1,85,1,2,128,0,3,1),
+(3371,1,85,1,2,128,1,3,1),
+(3372,1,85,1,2,128,2,3,1),
+(3373,1,85,16,2,128,0,2,1),
+(3374,1,85,16,2,128,1,2,1),
+(3375,1,85,16,2,128,2,2,1),
+(3376,1,85,128,2,128,0,7,1),
+(3377,1,85,128,2,128,1,7,1),
+(3378,1,85,128,2,128,2,7,1),
+(3379,1,85,256,2,128,0,7,1),
+(3380,1,85,256,2,128,1,7,1),
+(3381,1,85,256,2,128,2,7,1),
+(3382,1,85,1024,2,128,0,7,1),
+(3383,1,85,1024,2,128,1,7,1),
+(3384,1,85,1024,2,128,2,7,1),
+(3385,1,85,2048,2,128,0,2,1),
+(3386,1,85,2048,2,128,1,2,1),
+(3387,1,85,2048,2,128,2,2,1),
+(3388,1,85,4096,2,128,0,2,1),
+(3389,1,85,4096,2,128,1,2,1),
+(3390,1,85,4096,2,128,2,2,1),
+(3391,1,85,8192,2,128,0,2,1),
+(3392,1,85,8192,2,128,1,2,1),
+(3393,1,85,8192,2,128,2,2,1),
+(3394,1,85,32,2,128,0,5,1),
+(3395,1,85,32,2,128,1,5,1),
+(3396,1,85,32,2,128,2,5,1),
+(3397,1,85,512,2,128,0,5,1),
+(3398,1,85,512,2,128,1,5,1),
+(3399,1,85,512,2,128,2,5,1),
+(3400,1,85,2,2,128,0,4,1),
+(3401,1,85,2,2,128,1,4,1),
+(3402,1,85,2,2,128,2,4,1),
+(3403,1,85,0,2,128,0,7,1),
+(3404,1,85,1,2,128,0,3,1),
+(3405,1,85,1,2,128,1,3,1),
+(3406,1,85,1,2,128,2,3,1),
+(3407,1,85,16,2,128,0,2,1),
+(3408,1,85,16,2,128,1,2,1),
+(3409,1,85,16,2,128,2,2,1),
+(3410,1,85,128,2,128,0,7,1),
+(3411,1,85,128,2,128,1,7,1),
+(3412,1,85,128,2,128,2,7,1),
+(3413,1,85,256,2,128,0,7,1),
+(3414,1,85,256,2,128,1,7,1),
+(3415,1,85,256,2,128,2,7,1),
+(3416,1,85,1024,2,128,0,7,1),
+(3417,1,85,1024,2,128,1,7,1),
+(3418,1,85,1024,2,128,2,7,1),
+(3419,1,85,2048,2,128,0,2,1),
+(3420,1,85,2048,2,128,1,2,1),
+(3421,1,85,2048,2,128,2,2,1),
+(3422,1,85,4096,2,128,0,2,1),
+(3423,1,85,4096,2,128,1,2,1),
+(3424,1,85,4096,2,128,2,2,1),
+(3425,1,85,8192,2,128,0,2,1),
+(3426,1,85,8192,2,128,1,2,1),
+(3427,1,85,8192,2,128,2,2,1),
+(3428,1,85,32,2,128,0,5,1),
+(3429,1,85,32,2,128,1,5,1),
+(3430,1,85,32,2,128,2,5,1),
+(3431,1,85,512,2,128,0,5,1),
+(3432,1,85,512,2,128,1,5,1),
+(3433,1,85,512,2,128,2,5,1),
+(3434,1,85,2,2,128,0,4,1),
+(3435,1,85,2,2,128,1,4,1),
+(3436,1,85,2,2,128,2,4,1),
+(3437,1,85,0,2,128,0,7,1),
+(3438,1,85,1,2,128,0,3,1),
+(3439,1,85,1,2,128,1,3,1),
+(3440,1,85,1,2,128,2,3,1),
+(3441,1,85,16,2,128,0,2,1),
+(3442,1,85,16,2,128,1,2,1),
+(3443,1,85,16,2,128,2,2,1),
+(3444,1,85,128,2,128,0,7,1),
+(3445,1,85,128,2,128,1,7,1),
+(3446,1,85,128,2,128,2,7,1),
+(3447,1,85,256,2,128,0,7,1),
+(3448,1,85,256,2,128,1,7,1),
+(3449,1,85,256,2,128,2,7,1),
+(3450,1,85,1024,2,128,0,7,1),
+(3451,1,85,1024,2,128,1,7,1),
+(3452,1,85,1024,2,128,2,7,1),
+(3453,1,85,2048,2,128,0,2,1),
+(3454,1,85,2048,2,128,1,2,1),
+(3455,1,85,2048,2,128,2,2,1),
+(3456,1,85,4096,2,128,0,2,1),
+(3457,1,85,4096,2,128,1,2,1),
+(3458,1,85,4096,2,128,2,2,1),
+(3459,1,85,8192,2,128,0,2,1),
+(3460,1,85,8192,2,128,1,2,1),
+(3461,1,85,8192,2,128,2,2,1),
+(3462,1,85,32,2,128,0,5,1),
+(3463,1,85,32,2,128,1,5,1),
+(3464,1,85,32,2,128,2,5,1),
+(3465,1,85,512,2,128,0,5,1),
+(3466,1,85,512,2,128,1,5,1),
+(3467,1,85,512,2,128,2,5,1),
+(3468,1,85,2,2,128,0,4,1),
+(3469,1,85,2,2,128,1,4,1),
+(3470,1,85,2,2,128,2,4,1),
+(3471,1,85,0,2,128,0,7,1),
+(3472,1,85,1,2,128,0,3,1),
+(3473,1,85,1,2,128,1,3,1),
+(3474,1,85,1,2,128,2,3,1),
+(3475,1,85,16,2,128,0,2,1),
+(3476,1,85,16,2,128,1,2,1),
+(3477,1,85,16,2,128,2,2,1),
+(3478,1,85,128,2,128,0,7,1),
+(3479,1,85,128,2,128,1,7,1),
+(3480,1,85,128,2,128,2,7,1),
+(3481,1,85,256,2,128,0,7,1),
+(3482,1,85,256,2,128,1,7,1),
+(3483,1,85,256,2,128,2,7,1),
+(3484,1,85,1024,2,128,0,7,1),
+(3485,1,85,1024,2,128,1,7,1),
+(3486,1,85,1024,2,128,2,7,1),
+(3487,1,85,2048,2,128,0,2,1),
+(3488,1,85,2048,2,128,1,2,1),
+(3489,1,85,2048,2,128,2,2,1),
+(3490,1,85,4096,2,128,0,2,1),
+(3491,1,85,4096,2,128,1,2,1),
+(3492,1,85,4096,2,128,2,2,1),
+(3493,1,85,8192,2,128,0,2,1),
+(3494,1,85,8192,2,128,1,2,1),
+(3495,1,85,8192,2,128,2,2,1),
+(3496,1,85,32,2,128,0,5,1),
+(3497,1,85,32,2,128,1,5,1),
+(3498,1,85,32,2,128,2,5,1),
+(3499,1,85,512,2,128,0,5,1),
+(3500,1,85,512,2,128,1,5,1),
+(3501,1,85,512,2,128,2,5,1),
+(3502,1,85,2,2,128,0,4,1),
+(3503,1,85,2,2,128,1,4,1),
+(3504,1,85,2,2,128,2,4,1),
+(3505,1,85,0,2,128,0,7,1),
+(3506,1,85,1,2,128,0,3,1),
+(3507,1,85,1,2,128,1,3,1),
+(3508,1,85,1,2,128,2,3,1),
+(3509,1,85,16,2,128,0,2,1),
+(3510,1,85,16,2,128,1,2,1),
+(3511,1,85,16,2,128,2,2,1),
+(3512,1,85,128,2,128,0,7,1),
+(3513,1,85,128,2,128,1,7,1),
+(3514,1,85,128,2,128,2,7,1),
+(3515,1,85,256,2,128,0,7,1),
+(3516,1,85,256,2,128,1,7,1),
+(3517,1,85,256,2,128,2,7,1),
+(3518,1,85,1024,2,128,0,7,1),
+(3519,1,85,1024,2,128,1,7,1),
+(3520,1,85,1024,2,128,2,7,1),
+(3521,1,85,2048,2,128,0,2,1),
+(3522,1,85,2048,2,128,1,2,1),
+(3523,1,85,2048,2,128,2,2,1),
+(3524,1,85,4096,2,128,0,2,1),
+(3525,1,85,4096,2,128,1,2,1),
+(3526,1,85,4096,2,128,2,2,1),
+(3527,1,85,8192,2,128,0,2,1),
+(3528,1,85,8192,2,128,1,2,1),
+(3529,1,85,8192,2,128,2,2,1),
+(3530,1,85,32,2,128,0,5,1),
+(3531,1,85,32,2,128,1,5,1),
+(3532,1,85,32,2,128,2,5,1),
+(3533,1,85,512,2,128,0,5,1),
+(3534,1,85,512,2,128,1,5,1),
+(3535,1,85,512,2,128,2,5,1),
+(3536,1,85,2,2,128,0,4,1),
+(3537,1,85,2,2,128,1,4,1),
+(3538,1,85,2,2,128,2,4,1),
+(3539,1,85,0,2,128,0,7,1),
+(3540,1,85,1,2,128,0,3,1),
+(3541,1,85,1,2,128,1,3,1),
+(3542,1,85,1,2,128,2,3,1),
+(3543,1,85,16,2,128,0,2,1),
+(3544,1,85,16,2,128,1,2,1),
+(3545,1,85,16,2,128,2,2,1),
+(3546,1,85,128,2,128,0,7,1),
+(3547,1,85,128,2,128,1,7,1),
+(3548,1,85,128,2,128,2,7,1),
+(3549,1,85,256,2,128,0,7,1),
+(3550,1,85,256,2,128,1,7,1),
+(3551,1,85,256,2,128,2,7,1),
+(3552,1,85,1024,2,128,0,7,1),
+(3553,1,85,1024,2,128,1,7,1),
+(3554,1,85,1024,2,128,2,7,1),
+(3555,1,85,2048,2,128,0,2,1),
+(3556,1,85,2048,2,128,1,2,1),
+(3557,1,85,2048,2,128,2,2,1),
+(3558,1,85,4096,2,128,0,2,1),
+(3559,1,85,4096,2,128,1,2,1),
+(3560,1,85,4096,2,128,2,2,1),
+(3561,1,85,8192,2,128,0,2,1),
+(3562,1,85,8192,2,128,1,2,1),
+(3563,1,85,8192,2,128,2,2,1),
+(3564,1,85,32,2,128,0,5,1),
+(3565,1,85,32,2,128,1,5,1),
+(3566,1,85,32,2,128,2,5,1),
+(3567,1,85,512,2,128,0,5,1),
+(3568,1,85,512,2,128,1,5,1),
+(3569,1,85,512,2,128,2,5,1),
+(3570,1,85,2,2,128,0,4,1),
+(3571,1,85,2,2,128,1,4,1),
+(3572,1,85,2,2,128,2,4,1),
+(3573,1,85,0,2,128,0,7,1),
+(3574,1,85,1,2,128,0,3,1),
+(3575,1,85,1,2,128,1,3,1),
+(3576,1,85,1,2,128,2,3,1),
+(3577,1,85,16,2,128,0,2,1),
+(3578,1,85,16,2,128,1,2,1),
+(3579,1,85,16,2,128,2,2,1),
+(3580,1,85,128,2,128,0,7,1),
+(3581,1,85,128,2,128,1,7,1),
+(3582,1,85,128,2,128,2,7,1),
+(3583,1,85,256,2,128,0,7,1),
+(3584,1,85,256,2,128,1,7,1),
+(3585,1,85,256,2,128,2,7,1),
+(3586,1,85,1024,2,128,0,7,1),
+(3587,1,85,1024,2,128,1,7,1),
+(3588,1,85,1024,2,128,2,7,1),
+(3589,1,85,2048,2,128,0,2,1),
+(3590,1,85,2048,2,128,1,2,1),
+(3591,1,85,2048,2,128,2,2,1),
+(3592,1,85,4096,2,128,0,2,1),
+(3593,1,85,4096,2,128,1,2,1),
+(3594,1,85,4096,2,128,2,2,1),
+(3595,1,85,8192,2,128,0,2,1),
+(3596,1,85,8192,2,128,1,2,1),
+(3597,1,85,8192,2,128,2,2,1),
+(3598,1,85,32,2,128,0,5,1),
+(3599,1,85,32,2,128,1,5,1),
+(3600,1,85,32,2,128,2,5,1),
+(3601,1,85,512,2,128,0,5,1),
+(3602,1,85,512,2,128,1,5,1),
+(3603,1,85,512,2,128,2,5,1),
+(3604,1,85,2,2,128,0,4,1),
+(3605,1,85,2,2,128,1,4,1),
+(3606,1,85,2,2,128,2,4,1),
+(3607,1,85,0,2,256,0,7,1),
+(3608,1,85,1,2,256,0,3,1),
+(3609,1,85,1,2,256,1,3,1),
+(3610,1,85,1,2,256,2,3,1),
+(3611,1,85,16,2,256,0,2,1),
+(3612,1,85,16,2,256,1,2,1),
+(3613,1,85,16,2,256,2,2,1),
+(3614,1,85,128,2,256,0,7,1),
+(3615,1,85,128,2,256,1,7,1),
+(3616,1,85,128,2,256,2,7,1),
+(3617,1,85,256,2,256,0,7,1),
+(3618,1,85,256,2,256,1,7,1),
+(3619,1,85,256,2,256,2,7,1),
+(3620,1,85,1024,2,256,0,7,1),
+(3621,1,85,1024,2,256,1,7,1),
+(3622,1,85,1024,2,256,2,7,1),
+(3623,1,85,2048,2,256,0,2,1),
+(3624,1,85,2048,2,256,1,2,1),
+(3625,1,85,2048,2,256,2,2,1),
+(3626,1,85,4096,2,256,0,2,1),
+(3627,1,85,4096,2,256,1,2,1),
+(3628,1,85,4096,2,256,2,2,1),
+(3629,1,85,8192,2,256,0,2,1),
+(3630,1,85,8192,2,256,1,2,1),
+(3631,1,85,8192,2,256,2,2,1),
+(3632,1,85,32,2,256,0,5,1),
+(3633,1,85,32,2,256,1,5,1),
+(3634,1,85,32,2,256,2,5,1),
+(3635,1,85,512,2,256,0,5,1),
+(3636,1,85,512,2,256,1,5,1),
+(3637,1,85,512,2,256,2,5,1),
+(3638,1,85,2,2,256,0,4,1),
+(3639,1,85,2,2,256,1,4,1),
+(3640,1,85,2,2,256,2,4,1),
+(3641,1,85,0,2,256,0,7,1),
+(3642,1,85,1,2,256,0,3,1),
+(3643,1,85,1,2,256,1,3,1),
+(3644,1,85,1,2,256,2,3,1),
+(3645,1,85,16,2,256,0,2,1),
+(3646,1,85,16,2,256,1,2,1),
+(3647,1,85,16,2,256,2,2,1),
+(3648,1,85,128,2,256,0,7,1),
+(3649,1,85,128,2,256,1,7,1),
+(3650,1,85,128,2,256,2,7,1),
+(3651,1,85,256,2,256,0,7,1),
+(3652,1,85,256,2,256,1,7,1),
+(3653,1,85,256,2,256,2,7,1),
+(3654,1,85,1024,2,256,0,7,1),
+(3655,1,85,1024,2,256,1,7,1),
+(3656,1,85,1024,2,256,2,7,1),
+(3657,1,85,2048,2,256,0,2,1),
+(3658,1,85,2048,2,256,1,2,1),
+(3659,1,85,2048,2,256,2,2,1),
+(3660,1,85,4096,2,256,0,2,1),
+(3661,1,85,4096,2,256,1,2,1),
+(3662,1,85,4096,2,256,2,2,1),
+(3663,1,85,8192,2,256,0,2,1),
+(3664,1,85,8192,2,256,1,2,1),
+(3665,1,85,8192,2,256,2,2,1),
+(3666,1,85,32,2,256,0,5,1),
+(3667,1,85,32,2,256,1,5,1),
+(3668,1,85,32,2,256,2,5,1),
+(3669,1,85,512,2,256,0,5,1),
+(3670,1,85,512,2,256,1,5,1),
+(3671,1,85,512,2,256,2,5,1),
+(3672,1,85,2,2,256,0,4,1),
+(3673,1,85,2,2,256,1,4,1),
+(3674,1,85,2,2,256,2,4,1),
+(3675,1,85,0,2,256,0,7,1),
+(3676,1,85,1,2,256,0,3,1),
+(3677,1,85,1,2,256,1,3,1),
+(3678,1,85,1,2,256,2,3,1),
+(3679,1,85,16,2,256,0,2,1),
+(3680,1,85,16,2,256,1,2,1),
+(3681,1,85,16,2,256,2,2,1),
+(3682,1,85,128,2,256,0,7,1),
+(3683,1,85,128,2,256,1,7,1),
+(3684,1,85,128,2,256,2,7,1),
+(3685,1,85,256,2,256,0,7,1),
+(3686,1,85,256,2,256,1,7,1),
+(3687,1,85,256,2,256,2,7,1),
+(3688,1,85,1024,2,256,0,7,1),
+(3689,1,85,1024,2,256,1,7,1),
+(3690,1,85,1024,2,256,2,7,1),
+(3691,1,85,2048,2,256,0,2,1),
+(3692,1,85,2048,2,256,1,2,1),
+(3693,1,85,2048,2,256,2,2,1),
+(3694,1,85,4096,2,256,0,2,1),
+(3695,1,85,4096,2,256,1,2,1),
+(3696,1,85,4096,2,256,2,2,1),
+(3697,1,85,8192,2,256,0,2,1),
+(3698,1,85,8192,2,256,1,2,1),
+(3699,1,85,8192,2,256,2,2,1),
+(3700,1,85,32,2,256,0,5,1),
+(3701,1,85,32,2,256,1,5,1),
+(3702,1,85,32,2,256,2,5,1),
+(3703,1,85,512,2,256,0,5,1),
+(3704,1,85,512,2,256,1,5,1),
+(3705,1,85,512,2,256,2,5,1),
+(3706,1,85,2,2,256,0,4,1),
+(3707,1,85,2,2,256,1,4,1),
+(3708,1,85,2,2,256,2,4,1),
+(3709,1,85,0,2,256,0,7,1),
+(3710,1,85,1,2,256,0,3,1),
+(3711,1,85,1,2,256,1,3,1),
+(3712,1,85,1,2,256,2,3,1),
+(3713,1,85,16,2,256,0,2,1),
+(3714,1,85,16,2,256,1,2,1),
+(3715,1,85,16,2,256,2,2,1),
+(3716,1,85,128,2,256,0,7,1),
+(3717,1,85,128,2,256,1,7,1),
+(3718,1,85,128,2,256,2,7,1),
+(3719,1,85,256,2,256,0,7,1),
+(3720,1,85,256,2,256,1,7,1),
+(3721,1,85,256,2,256,2,7,1),
+(3722,1,85,1024,2,256,0,7,1),
+(3723,1,85,1024,2,256,1,7,1),
+(3724,1,85,1024,2,256,2,7,1),
+(3725,1,85,2048,2,256,0,2,1),
+(3726,1,85,2048,2,256,1,2,1),
+(3727,1,85,2048,2,256,2,2,1),
+(3728,1,85,4096,2,256,0,2,1),
+(3729,1,85,4096,2,256,1,2,1),
+(3730,1,85,4096,2,256,2,2,1),
+(3731,1,85,8192,2,256,0,2,1),
+(3732,1,85,8192,2,256,1,2,1),
+(3733,1,85,8192,2,256,2,2,1),
+(3734,1,85,32,2,256,0,5,1),
+(3735,1,85,32,2,256,1,5,1),
+(3736,1,85,32,2,256,2,5,1),
+(3737,1,85,512,2,256,0,5,1),
+(3738,1,85,512,2,256,1,5,1),
+(3739,1,85,512,2,256,2,5,1),
+(3740,1,85,2,2,256,0,4,1),
+(3741,1,85,2,2,256,1,4,1),
+(3742,1,85,2,2,256,2,4,1),
+(3743,1,85,0,2,256,0,7,1),
+(3744,1,85,1,2,256,0,3,1),
+(3745,1,85,1,2,256,1,3,1),
+(3746,1,85,1,2,256,2,3,1),
+(3747,1,85,16,2,256,0,2,1),
+(3748,1,85,16,2,256,1,2,1),
+(3749,1,85,16,2,256,2,2,1),
+(3750,1,85,128,2,256,0,7,1),
+(3751,1,85,128,2,256,1,7,1),
+(3752,1,85,128,2,256,2,7,1),
+(3753,1,85,256,2,256,0,7,1),
+(3754,1,85,256,2,256,1,7,1),
+(3755,1,85,256,2,256,2,7,1),
+(3756,1,85,1024,2,256,0,7,1),
+(3757,1,85,1024,2,256,1,7,1),
+(3758,1,85,1024,2,256,2,7,1),
+(3759,1,85,2048,2,256,0,2,1),
+(3760,1,85,2048,2,256,1,2,1),
+(3761,1,85,2048,2,256,2,2,1),
+(3762,1,85,4096,2,256,0,2,1),
+(3763,1,85,4096,2,256,1,2,1),
+(3764,1,85,4096,2,256,2,2,1),
+(3765,1,85,8192,2,256,0,2,1),
+(3766,1,85,8192,2,256,1,2,1),
+(3767,1,85,8192,2,256,2,2,1),
+(3768,1,85,32,2,256,0,5,1),
+(3769,1,85,32,2,256,1,5,1),
+(3770,1,85,32,2,256,2,5,1),
+(3771,1,85,512,2,256,0,5,1),
+(3772,1,85,512,2,256,1,5,1),
+(3773,1,85,512,2,256,2,5,1),
+(3774,1,85,2,2,256,0,4,1),
+(3775,1,85,2,2,256,1,4,1),
+(3776,1,85,2,2,256,2,4,1),
+(3777,1,85,0,2,256,0,7,1),
+(3778,1,85,1,2,256,0,3,1),
+(3779,1,85,1,2,256,1,3,1),
+(3780,1,85,1,2,256,2,3,1),
+(3781,1,85,16,2,256,0,2,1),
+(3782,1,85,16,2,256,1,2,1),
+(3783,1,85,16,2,256,2,2,1),
+(3784,1,85,128,2,256,0,7,1),
+(3785,1,85,128,2,256,1,7,1),
+(3786,1,85,128,2,256,2,7,1),
+(3787,1,85,256,2,256,0,7,1),
+(3788,1,85,256,2,256,1,7,1),
+(3789,1,85,256,2,256,2,7,1),
+(3790,1,85,1024,2,256,0,7,1),
+(3791,1,85,1024,2,256,1,7,1),
+(3792,1,85,1024,2,256,2,7,1),
+(3793,1,85,2048,2,256,0,2,1),
+(3794,1,85,2048,2,256,1,2,1),
+(3795,1,85,2048,2,256,2,2,1),
+(3796,1,85,4096,2,256,0,2,1),
+(3797,1,85,4096,2,256,1,2,1),
+(3798,1,85,4096,2,256,2,2,1),
+(3799,1,85,8192,2,256,0,2,1),
+(3800,1,85,8192,2,256,1,2,1),
+(3801,1,85,8192,2,256,2,2,1),
+(3802,1,85,32,2,256,0,5,1),
+(3803,1,85,32,2,256,1,5,1),
+(3804,1,85,32,2,256,2,5,1),
+(3805,1,85,512,2,256,0,5,1),
+(3806,1,85,512,2,256,1,5,1),
+(3807,1,85,512,2,256,2,5,1),
+(3808,1,85,2,2,256,0,4,1),
+(3809,1,85,2,2,256,1,4,1),
+(3810,1,85,2,2,256,2,4,1),
+(3811,1,85,0,2,256,0,7,1),
+(3812,1,85,1,2,256,0,3,1),
+(3813,1,85,1,2,256,1,3,1),
+(3814,1,85,1,2,256,2,3,1),
+(3815,1,85,16,2,256,0,2,1),
+(3816,1,85,16,2,256,1,2,1),
+(3817,1,85,16,2,256,2,2,1),
+(3818,1,85,128,2,256,0,7,1),
+(3819,1,85,128,2,256,1,7,1),
+(3820,1,85,128,2,256,2,7,1),
+(3821,1,85,256,2,256,0,7,1),
+(3822,1,85,256,2,256,1,7,1),
+(3823,1,85,256,2,256,2,7,1),
+(3824,1,85,1024,2,256,0,7,1),
+(3825,1,85,1024,2,256,1,7,1),
+(3826,1,85,1024,2,256,2,7,1),
+(3827,1,85,2048,2,256,0,2,1),
+(3828,1,85,2048,2,256,1,2,1),
+(3829,1,85,2048,2,256,2,2,1),
+(3830,1,85,4096,2,256,0,2,1),
+(3831,1,85,4096,2,256,1,2,1),
+(3832,1,85,4096,2,256,2,2,1),
+(3833,1,85,8192,2,256,0,2,1),
+(3834,1,85,8192,2,256,1,2,1),
+(3835,1,85,8192,2,256,2,2,1),
+(3836,1,85,32,2,256,0,5,1),
+(3837,1,85,32,2,256,1,5,1),
+(3838,1,85,32,2,256,2,5,1),
+(3839,1,85,512,2,256,0,5,1),
+(3840,1,85,512,2,256,1,5,1),
+(3841,1,85,512,2,256,2,5,1),
+(3842,1,85,2,2,256,0,4,1),
+(3843,1,85,2,2,256,1,4,1),
+(3844,1,85,2,2,256,2,4,1),
+(3845,1,85,0,2,16,0,7,1),
+(3846,1,85,1,2,16,0,3,1),
+(3847,1,85,1,2,16,1,3,1),
+(3848,1,85,1,2,16,2,3,1),
+(3849,1,85,16,2,16,0,2,1),
+(3850,1,85,16,2,16,1,2,1),
+(3851,1,85,16,2,16,2,2,1),
+(3852,1,85,128,2,16,0,7,1),
+(3853,1,85,128,2,16,1,7,1),
+(3854,1,85,128,2,16,2,7,1),
+(3855,1,85,256,2,16,0,7,1),
+(3856,1,85,256,2,16,1,7,1),
+(3857,1,85,256,2,16,2,7,1),
+(3858,1,85,1024,2,16,0,7,1),
+(3859,1,85,1024,2,16,1,7,1),
+(3860,1,85,1024,2,16,2,7,1),
+(3861,1,85,2048,2,16,0,2,1),
+(3862,1,85,2048,2,16,1,2,1),
+(3863,1,85,2048,2,16,2,2,1),
+(3864,1,85,4096,2,16,0,2,1),
+(3865,1,85,4096,2,16,1,2,1),
+(3866,1,85,4096,2,16,2,2,1),
+(3867,1,85,8192,2,16,0,2,1),
+(3868,1,85,8192,2,16,1,2,1),
+(3869,1,85,8192,2,16,2,2,1),
+(3870,1,85,32,2,16,0,5,1),
+(3871,1,85,32,2,16,1,5,1),
+(3872,1,85,32,2,16,2,5,1),
+(3873,1,85,512,2,16,0,5,1),
+(3874,1,85,512,2,16,1,5,1),
+(3875,1,85,512,2,16,2,5,1),
+(3876,1,85,2,2,16,0,4,1),
+(3877,1,85,2,2,16,1,4,1),
+(3878,1,85,2,2,16,2,4,1),
+(3879,1,85,0,2,16,0,7,1),
+(3880,1,85,1,2,16,0,3,1),
+(3881,1,85,1,2,16,1,3,1),
+(3882,1,85,1,2,16,2,3,1),
+(3883,1,85,16,2,16,0,2,1),
+(3884,1,85,16,2,16,1,2,1),
+(3885,1,85,16,2,16,2,2,1),
+(3886,1,85,128,2,16,0,7,1),
+(3887,1,85,128,2,16,1,7,1),
+(3888,1,85,128,2,16,2,7,1),
+(3889,1,85,256,2,16,0,7,1),
+(3890,1,85,256,2,16,1,7,1),
+(3891,1,85,256,2,16,2,7,1),
+(3892,1,85,1024,2,16,0,7,1),
+(3893,1,85,1024,2,16,1,7,1),
+(3894,1,85,1024,2,16,2,7,1),
+(3895,1,85,2048,2,16,0,2,1),
+(3896,1,85,2048,2,16,1,2,1),
+(3897,1,85,2048,2,16,2,2,1),
+(3898,1,85,4096,2,16,0,2,1),
+(3899,1,85,4096,2,16,1,2,1),
+(3900,1,85,4096,2,16,2,2,1),
+(3901,1,85,8192,2,16,0,2,1),
+(3902,1,85,8192,2,16,1,2,1),
+(3903,1,85,8192,2,16,2,2,1),
+(3904,1,85,32,2,16,0,5,1),
+(3905,1,85,32,2,16,1,5,1),
+(3906,1,85,32,2,16,2,5,1),
+(3907,1,85,512,2,16,0,5,1),
+(3908,1,85,512,2,16,1,5,1),
+(3909,1,85,512,2,16,2,5,1),
+(3910,1,85,2,2,16,0,4,1),
+(3911,1,85,2,2,16,1,4,1),
+(3912,1,85,2,2,16,2,4,1),
+(3913,1,85,0,2,16,0,7,1),
+(3914,1,85,1,2,16,0,3,1),
+(3915,1,85,1,2,16,1,3,1),
+(3916,1,85,1,2,16,2,3,1),
+(3917,1,85,16,2,16,0,2,1),
+(3918,1,85,16,2,16,1,2,1),
+(3919,1,85,16,2,16,2,2,1),
+(3920,1,85,128,2,16,0,7,1),
+(3921,1,85,128,2,16,1,7,1),
+(3922,1,85,128,2,16,2,7,1),
+(3923,1,85,256,2,16,0,7,1),
+(3924,1,85,256,2,16,1,7,1),
+(3925,1,85,256,2,16,2,7,1),
+(3926,1,85,1024,2,16,0,7,1),
+(3927,1,85,1024,2,16,1,7,1),
+(3928,1,85,1024,2,16,2,7,1),
+(3929,1,85,2048,2,16,0,2,1),
+(3930,1,85,2048,2,16,1,2,1),
+(3931,1,85,2048,2,16,2,2,1),
+(3932,1,85,4096,2,16,0,2,1),
+(3933,1,85,4096,2,16,1,2,1),
+(3934,1,85,4096,2,16,2,2,1),
+(3935,1,85,8192,2,16,0,2,1),
+(3936,1,85,8192,2,16,1,2,1),
+(3937,1,85,8192,2,16,2,2,1),
+(3938,1,85,32,2,16,0,5,1),
+(3939,1,85,32,2,16,1,5,1),
+(3940,1,85,32,2,16,2,5,1),
+(3941,1,85,512,2,16,0,5,1),
+(3942,1,85,512,2,16,1,5,1),
+(3943,1,85,512,2,16,2,5,1),
+(3944,1,85,2,2,16,0,4,1),
+(3945,1,85,2,2,16,1,4,1),
+(3946,1,85,2,2,16,2,4,1),
+(3947,1,85,0,2,16,0,7,1),
+(3948,1,85,1,2,16,0,3,1),
+(3949,1,85,1,2,16,1,3,1),
+(3950,1,85,1,2,16,2,3,1),
+(3951,1,85,16,2,16,0,2,1),
+(3952,1,85,16,2,16,1,2,1),
+(3953,1,85,16,2,16,2,2,1),
+(3954,1,85,128,2,16,0,7,1),
+(3955,1,85,128,2,16,1,7,1),
+(3956,1,85,128,2,16,2,7,1),
+(3957,1,85,256,2,16,0,7,1),
+(3958,1,85,256,2,16,1,7,1),
+(3959,1,85,256,2,16,2,7,1),
+(3960,1,85,1024,2,16,0,7,1),
+(3961,1,85,1024,2,16,1,7,1),
+(3962,1,85,1024,2,16,2,7,1),
+(3963,1,85,2048,2,16,0,2,1),
+(3964,1,85,2048,2,16,1,2,1),
+(3965,1,85,2048,2,16,2,2,1),
+(3966,1,85,4096,2,16,0,2,1),
+(3967,1,85,4096,2,16,1,2,1),
+(3968,1,85,4096,2,16,2,2,1),
+(3969,1,85,8192,2,16,0,2,1),
+(3970,1,85,8192,2,16,1,2,1),
+(3971,1,85,8192,2,16,2,2,1),
+(3972,1,85,32,2,16,0,5,1),
+(3973,1,85,32,2,16,1,5,1),
+(3974,1,85,32,2,16,2,5,1),
+(3975,1,85,512,2,16,0,5,1),
+(3976,1,85,512,2,16,1,5,1),
+(3977,1,85,512,2,16,2,5,1),
+(3978,1,85,2,2,16,0,4,1),
+(3979,1,85,2,2,16,1,4,1),
+(3980,1,85,2,2,16,2,4,1),
+(3981,1,85,0,2,16,0,7,1),
+(3982,1,85,1,2,16,0,3,1),
+(3983,1,85,1,2,16,1,3,1),
+(3984,1,85,1,2,16,2,3,1),
+(3985,1,85,16,2,16,0,2,1),
+(3986,1,85,16,2,16,1,2,1),
+(3987,1,85,16,2,16,2,2,1),
+(3988,1,85,128,2,16,0,7,1),
+(3989,1,85,128,2,16,1,7,1),
+(3990,1,85,128,2,16,2,7,1),
+(3991,1,85,256,2,16,0,7,1),
+(3992,1,85,256,2,16,1,7,1),
+(3993,1,85,256,2,16,2,7,1),
+(3994,1,85,1024,2,16,0,7,1),
+(3995,1,85,1024,2,16,1,7,1),
+(3996,1,85,1024,2,16,2,7,1),
+(3997,1,85,2048,2,16,0,2,1),
+(3998,1,85,2048,2,16,1,2,1),
+(3999,1,85,2048,2,16,2,2,1),
+(4000,1,85,4096,2,16,0,2,1),
+(4001,1,85,4096,2,16,1,2,1),
+(4002,1,85,4096,2,16,2,2,1),
+(4003,1,85,8192,2,16,0,2,1),
+(4004,1,85,8192,2,16,1,2,1),
+(4005,1,85,8192,2,16,2,2,1),
+(4006,1,85,32,2,16,0,5,1),
+(4007,1,85,32,2,16,1,5,1),
+(4008,1,85,32,2,16,2,5,1),
+(4009,1,85,512,2,16,0,5,1),
+(4010,1,85,512,2,16,1,5,1),
+(4011,1,85,512,2,16,2,5,1),
+(4012,1,85,2,2,16,0,4,1),
+(4013,1,85,2,2,16,1,4,1),
+(4014,1,85,2,2,16,2,4,1),
+(4015,1,85,0,2,16,0,7,1),
+(4016,1,85,1,2,16,0,3,1),
+(4017,1,85,1,2,16,1,3,1),
+(4018,1,85,1,2,16,2,3,1),
+(4019,1,85,16,2,16,0,2,1),
+(4020,1,85,16,2,16,1,2,1),
+(4021,1,85,16,2,16,2,2,1),
+(4022,1,85,128,2,16,0,7,1),
+(4023,1,85,128,2,16,1,7,1),
+(4024,1,85,128,2,16,2,7,1),
+(4025,1,85,256,2,16,0,7,1),
+(4026,1,85,256,2,16,1,7,1),
+(4027,1,85,256,2,16,2,7,1),
+(4028,1,85,1024,2,16,0,7,1),
+(4029,1,85,1024,2,16,1,7,1),
+(4030,1,85,1024,2,16,2,7,1),
+(4031,1,85,2048,2,16,0,2,1),
+(4032,1,85,2048,2,16,1,2,1),
+(4033,1,85,2048,2,16,2,2,1),
+(4034,1,85,4096,2,16,0,2,1),
+(4035,1,85,4096,2,16,1,2,1),
+(4036,1,85,4096,2,16,2,2,1),
+(4037,1,85,8192,2,16,0,2,1),
+(4038,1,85,8192,2,16,1,2,1),
+(4039,1,85,8192,2,16,2,2,1),
+(4040,1,85,32,2,16,0,5,1),
+(4041,1,85,32,2,16,1,5,1),
+(4042,1,85,32,2,16,2,5,1),
+(4043,1,85,512,2,16,0,5,1),
+(4044,1,85,512,2,16,1,5,1),
+(4045,1,85,512,2,16,2,5,1),
+(4046,1,85,2,2,16,0,4,1),
+(4047,1,85,2,2,16,1,4,1),
+(4048,1,85,2,2,16,2,4,1),
+(4049,1,85,0,2,16,0,7,1),
+(4050,1,85,1,2,16,0,3,1),
+(4051,1,85,1,2,16,1,3,1),
+(4052,1,85,1,2,16,2,3,1),
+(4053,1,85,16,2,16,0,2,1),
+(4054,1,85,16,2,16,1,2,1),
+(4055,1,85,16,2,16,2,2,1),
+(4056,1,85,128,2,16,0,7,1),
+(4057,1,85,128,2,16,1,7,1),
+(4058,1,85,128,2,16,2,7,1),
+(4059,1,85,256,2,16,0,7,1),
+(4060,1,85,256,2,16,1,7,1),
+(4061,1,85,256,2,16,2,7,1),
+(4062,1,85,1024,2,16,0,7,1),
+(4063,1,85,1024,2,16,1,7,1),
+(4064,1,85,1024,2,16,2,7,1),
+(4065,1,85,2048,2,16,0,2,1),
+(4066,1,85,2048,2,16,1,2,1),
+(4067,1,85,2048,2,16,2,2,1),
+(4068,1,85,4096,2,16,0,2,1),
+(4069,1,85,4096,2,16,1,2,1),
+(4070,1,85,4096,2,16,2,2,1),
+(4071,1,85,8192,2,16,0,2,1),
+(4072,1,85,8192,2,16,1,2,1),
+(4073,1,85,8192,2,16,2,2,1),
+(4074,1,85,32,2,16,0,5,1),
+(4075,1,85,32,2,16,1,5,1),
+(4076,1,85,32,2,16,2,5,1),
+(4077,1,85,512,2,16,0,5,1),
+(4078,1,85,512,2,16,1,5,1),
+(4079,1,85,512,2,16,2,5,1),
+(4080,1,85,2,2,16,0,4,1),
+(4081,1,85,2,2,16,1,4,1),
+(4082,1,85,2,2,16,2,4,1),
+(4083,1,85,0,2,32,0,7,1),
+(4084,1,85,1,2,32,0,3,1),
+(4085,1,85,1,2,32,1,3,1),
+(4086,1,85,1,2,32,2,3,1),
+(4087,1,85,16,2,32,0,2,1),
+(4088,1,85,16,2,32,1,2,1),
+(4089,1,85,16,2,32,2,2,1),
+(4090,1,85,128,2,32,0,7,1),
+(4091,1,85,128,2,32,1,7,1),
+(4092,1,85,128,2,32,2,7,1),
+(4093,1,85,256,2,32,0,7,1),
+(4094,1,85,256,2,32,1,7,1),
+(4095,1,85,256,2,32,2,7,1),
+(4096,1,85,1024,2,32,0,7,1),
+(4097,1,85,1024,2,32,1,7,1),
+(4098,1,85,1024,2,32,2,7,1),
+(4099,1,85,2048,2,32,0,2,1),
+(4100,1,85,2048,2,32,1,2,1),
+(4101,1,85,2048,2,32,2,2,1),
+(4102,1,85,4096,2,32,0,2,1),
+(4103,1,85,4096,2,32,1,2,1),
+(4104,1,85,4096,2,32,2,2,1),
+(4105,1,85,8192,2,32,0,2,1),
+(4106,1,85,8192,2,32,1,2,1),
+(4107,1,85,8192,2,32,2,2,1),
+(4108,1,85,32,2,32,0,5,1),
+(4109,1,85,32,2,32,1,5,1),
+(4110,1,85,32,2,32,2,5,1),
+(4111,1,85,512,2,32,0,5,1),
+(4112,1,85,512,2,32,1,5,1),
+(4113,1,85,512,2,32,2,5,1),
+(4114,1,85,2,2,32,0,4,1),
+(4115,1,85,2,2,32,1,4,1),
+(4116,1,85,2,2,32,2,4,1),
+(4117,1,85,0,2,32,0,7,1),
+(4118,1,85,1,2,32,0,3,1),
+(4119,1,85,1,2,32,1,3,1),
+(4120,1,85,1,2,32,2,3,1),
+(4121,1,85,16,2,32,0,2,1),
+(4122,1,85,16,2,32,1,2,1),
+(4123,1,85,16,2,32,2,2,1),
+(4124,1,85,128,2,32,0,7,1),
+(4125,1,85,128,2,32,1,7,1),
+(4126,1,85,128,2,32,2,7,1),
+(4127,1,85,256,2,32,0,7,1),
+(4128,1,85,256,2,32,1,7,1),
+(4129,1,85,256,2,32,2,7,1),
+(4130,1,85,1024,2,32,0,7,1),
+(4131,1,85,1024,2,32,1,7,1),
+(4132,1,85,1024,2,32,2,7,1),
+(4133,1,85,2048,2,32,0,2,1),
+(4134,1,85,2048,2,32,1,2,1),
+(4135,1,85,2048,2,32,2,2,1),
+(4136,1,85,4096,2,32,0,2,1),
+(4137,1,85,4096,2,32,1,2,1),
+(4138,1,85,4096,2,32,2,2,1),
+(4139,1,85,8192,2,32,0,2,1),
+(4140,1,85,8192,2,32,1,2,1),
+(4141,1,85,8192,2,32,2,2,1),
+(4142,1,85,32,2,32,0,5,1),
+(4143,1,85,32,2,32,1,5,1),
+(4144,1,85,32,2,32,2,5,1),
+(4145,1,85,512,2,32,0,5,1),
+(4146,1,85,512,2,32,1,5,1),
+(4147,1,85,512,2,32,2,5,1),
+(4148,1,85,2,2,32,0,4,1),
+(4149,1,85,2,2,32,1,4,1),
+(4150,1,85,2,2,32,2,4,1),
+(4151,1,85,0,2,32,0,7,1),
+(4152,1,85,1,2,32,0,3,1),
+(4153,1,85,1,2,32,1,3,1),
+(4154,1,85,1,2,32,2,3,1),
+(4155,1,85,16,2,32,0,2,1),
+(4156,1,85,16,2,32,1,2,1),
+(4157,1,85,16,2,32,2,2,1),
+(4158,1,85,128,2,32,0,7,1),
+(4159,1,85,128,2,32,1,7,1),
+(4160,1,85,128,2,32,2,7,1),
+(4161,1,85,256,2,32,0,7,1),
+(4162,1,85,256,2,32,1,7,1),
+(4163,1,85,256,2,32,2,7,1),
+(4164,1,85,1024,2,32,0,7,1),
+(4165,1,85,1024,2,32,1,7,1),
+(4166,1,85,1024,2,32,2,7,1),
+(4167,1,85,2048,2,32,0,2,1),
+(4168,1,85,2048,2,32,1,2,1),
+(4169,1,85,2048,2,32,2,2,1),
+(4170,1,85,4096,2,32,0,2,1),
+(4171,1,85,4096,2,32,1,2,1),
+(4172,1,85,4096,2,32,2,2,1),
+(4173,1,85,8192,2,32,0,2,1),
+(4174,1,85,8192,2,32,1,2,1),
+(4175,1,85,8192,2,32,2,2,1),
+(4176,1,85,32,2,32,0,5,1),
+(4177,1,85,32,2,32,1,5,1),
+(4178,1,85,32,2,32,2,5,1),
+(4179,1,85,512,2,32,0,5,1),
+(4180,1,85,512,2,32,1,5,1),
+(4181,1,85,512,2,32,2,5,1),
+(4182,1,85,2,2,32,0,4,1),
+(4183,1,85,2,2,32,1,4,1),
+(4184,1,85,2,2,32,2,4,1),
+(4185,1,85,0,2,32,0,7,1),
+(4186,1,85,1,2,32,0,3,1),
+(4187,1,85,1,2,32,1,3,1),
+(4188,1,85,1,2,32,2,3,1),
+(4189,1,85,16,2,32,0,2,1),
+(4190,1,85,16,2,32,1,2,1),
+(4191,1,85,16,2,32,2,2,1),
+(4192,1,85,128,2,32,0,7,1),
+(4193,1,85,128,2,32,1,7,1),
+(4194,1,85,128,2,32,2,7,1),
+(4195,1,85,256,2,32,0,7,1),
+(4196,1,85,256,2,32,1,7,1),
+(4197,1,85,256,2,32,2,7,1),
+(4198,1,85,1024,2,32,0,7,1),
+(4199,1,85,1024,2,32,1,7,1),
+(4200,1,85,1024,2,32,2,7,1),
+(4201,1,85,2048,2,32,0,2,1),
+(4202,1,85,2048,2,32,1,2,1),
+(4203,1,85,2048,2,32,2,2,1),
+(4204,1,85,4096,2,32,0,2,1),
+(4205,1,85,4096,2,32,1,2,1),
+(4206,1,85,4096,2,32,2,2,1),
+(4207,1,85,8192,2,32,0,2,1),
+(4208,1,85,8192,2,32,1,2,1),
+(4209,1,85,8192,2,32,2,2,1),
+(4210,1,85,32,2,32,0,5,1),
+(4211,1,85,32,2,32,1,5,1),
+(4212,1,85,32,2,32,2,5,1),
+(4213,1,85,512,2,32,0,5,1),
+(4214,1,85,512,2,32,1,5,1),
+(4215,1,85,512,2,32,2,5,1),
+(4216,1,85,2,2,32,0,4,1),
+(4217,1,85,2,2,32,1,4,1),
+(4218,1,85,2,2,32,2,4,1),
+(4219,1,85,0,2,32,0,7,1),
+(4220,1,85,1,2,32,0,3,1),
+(4221,1,85,1,2,32,1,3,1),
+(4222,1,85,1,2,32,2,3,1),
+(4223,1,85,16,2,32,0,2,1),
+(4224,1,85,16,2,32,1,2,1),
+(4225,1,85,16,2,32,2,2,1),
+(4226,1,85,128,2,32,0,7,1),
+(4227,1,85,128,2,32,1,7,1),
+(4228,1,85,128,2,32,2,7,1),
+(4229,1,85,256,2,32,0,7,1),
+(4230,1,85,256,2,32,1,7,1),
+(4231,1,85,256,2,32,2,7,1),
+(4232,1,85,1024,2,32,0,7,1),
+(4233,1,85,1024,2,32,1,7,1),
+(4234,1,85,1024,2,32,2,7,1),
+(4235,1,85,2048,2,32,0,2,1),
+(4236,1,85,2048,2,32,1,2,1),
+(4237,1,85,2048,2,32,2,2,1),
+(4238,1,85,4096,2,32,0,2,1),
+(4239,1,85,4096,2,32,1,2,1),
+(4240,1,85,4096,2,32,2,2,1),
+(4241,1,85,8192,2,32,0,2,1),
+(4242,1,85,8192,2,32,1,2,1),
+(4243,1,85,8192,2,32,2,2,1),
+(4244,1,85,32,2,32,0,5,1),
+(4245,1,85,32,2,32,1,5,1),
+(4246,1,85,32,2,32,2,5,1),
+(4247,1,85,512,2,32,0,5,1),
+(4248,1,85,512,2,32,1,5,1),
+(4249,1,85,512,2,32,2,5,1),
+(4250,1,85,2,2,32,0,4,1),
+(4251,1,85,2,2,32,1,4,1),
+(4252,1,85,2,2,32,2,4,1),
+(4253,1,85,0,2,32,0,7,1),
+(4254,1,85,1,2,32,0,3,1),
+(4255,1,85,1,2,32,1,3,1),
+(4256,1,85,1,2,32,2,3,1),
+(4257,1,85,16,2,32,0,2,1),
+(4258,1,85,16,2,32,1,2,1),
+(4259,1,85,16,2,32,2,2,1),
+(4260,1,85,128,2,32,0,7,1),
+(4261,1,85,128,2,32,1,7,1),
+(4262,1,85,128,2,32,2,7,1),
+(4263,1,85,256,2,32,0,7,1),
+(4264,1,85,256,2,32,1,7,1),
+(4265,1,85,256,2,32,2,7,1),
+(4266,1,85,1024,2,32,0,7,1),
+(4267,1,85,1024,2,32,1,7,1),
+(4268,1,85,1024,2,32,2,7,1),
+(4269,1,85,2048,2,32,0,2,1),
+(4270,1,85,2048,2,32,1,2,1),
+(4271,1,85,2048,2,32,2,2,1),
+(4272,1,85,4096,2,32,0,2,1),
+(4273,1,85,4096,2,32,1,2,1),
+(4274,1,85,4096,2,32,2,2,1),
+(4275,1,85,8192,2,32,0,2,1),
+(4276,1,85,8192,2,32,1,2,1),
+(4277,1,85,8192,2,32,2,2,1),
+(4278,1,85,32,2,32,0,5,1),
+(4279,1,85,32,2,32,1,5,1),
+(4280,1,85,32,2,32,2,5,1),
+(4281,1,85,512,2,32,0,5,1),
+(4282,1,85,512,2,32,1,5,1),
+(4283,1,85,512,2,32,2,5,1),
+(4284,1,85,2,2,32,0,4,1),
+(4285,1,85,2,2,32,1,4,1),
+(4286,1,85,2,2,32,2,4,1),
+(4287,1,85,0,2,32,0,7,1),
+(4288,1,85,1,2,32,0,3,1),
+(4289,1,85,1,2,32,1,3,1),
+(4290,1,85,1,2,32,2,3,1),
+(4291,1,85,16,2,32,0,2,1),
+(4292,1,85,16,2,32,1,2,1),
+(4293,1,85,16,2,32,2,2,1),
+(4294,1,85,128,2,32,0,7,1),
+(4295,1,85,128,2,32,1,7,1),
+(4296,1,85,128,2,32,2,7,1),
+(4297,1,85,256,2,32,0,7,1),
+(4298,1,85,256,2,32,1,7,1),
+(4299,1,85,256,2,32,2,7,1),
+(4300,1,85,1024,2,32,0,7,1),
+(4301,1,85,1024,2,32,1,7,1),
+(4302,1,85,1024,2,32,2,7,1),
+(4303,1,85,2048,2,32,0,2,1),
+(4304,1,85,2048,2,32,1,2,1),
+(4305,1,85,2048,2,32,2,2,1),
+(4306,1,85,4096,2,32,0,2,1),
+(4307,1,85,4096,2,32,1,2,1),
+(4308,1,85,4096,2,32,2,2,1),
+(4309,1,85,8192,2,32,0,2,1),
+(4310,1,85,8192,2,32,1,2,1),
+(4311,1,85,8192,2,32,2,2,1),
+(4312,1,85,32,2,32,0,5,1),
+(4313,1,85,32,2,32,1,5,1),
+(4314,1,85,32,2,32,2,5,1),
+(4315,1,85,512,2,32,0,5,1),
+(4316,1,85,512,2,32,1,5,1),
+(4317,1,85,512,2,32,2,5,1),
+(4318,1,85,2,2,32,0,4,1),
+(4319,1,85,2,2,32,1,4,1),
+(4320,1,85,2,2,32,2,4,1),
+(4321,1,85,0,2,1,0,7,1),
+(4322,1,85,1,2,1,0,3,1),
+(4323,1,85,1,2,1,1,3,1),
+(4324,1,85,1,2,1,2,3,1),
+(4325,1,85,16,2,1,0,2,1),
+(4326,1,85,16,2,1,1,2,1),
+(4327,1,85,16,2,1,2,2,1),
+(4328,1,85,128,2,1,0,7,1),
+(4329,1,85,128,2,1,1,7,1),
+(4330,1,85,128,2,1,2,7,1),
+(4331,1,85,256,2,1,0,7,1),
+(4332,1,85,256,2,1,1,7,1),
+(4333,1,85,256,2,1,2,7,1),
+(4334,1,85,1024,2,1,0,7,1),
+(4335,1,85,1024,2,1,1,7,1),
+(4336,1,85,1024,2,1,2,7,1),
+(4337,1,85,2048,2,1,0,2,1),
+(4338,1,85,2048,2,1,1,2,1),
+(4339,1,85,2048,2,1,2,2,1),
+(4340,1,85,4096,2,1,0,2,1),
+(4341,1,85,4096,2,1,1,2,1),
+(4342,1,85,4096,2,1,2,2,1),
+(4343,1,85,8192,2,1,0,2,1),
+(4344,1,85,8192,2,1,1,2,1),
+(4345,1,85,8192,2,1,2,2,1),
+(4346,1,85,32,2,1,0,5,1),
+(4347,1,85,32,2,1,1,5,1),
+(4348,1,85,32,2,1,2,5,1),
+(4349,1,85,512,2,1,0,5,1),
+(4350,1,85,512,2,1,1,5,1),
+(4351,1,85,512,2,1,2,5,1),
+(4352,1,85,2,2,1,0,4,1),
+(4353,1,85,2,2,1,1,4,1),
+(4354,1,85,2,2,1,2,4,1),
+(4355,1,85,0,2,1,0,7,1),
+(4356,1,85,1,2,1,0,3,1),
+(4357,1,85,1,2,1,1,3,1),
+(4358,1,85,1,2,1,2,3,1),
+(4359,1,85,16,2,1,0,2,1),
+(4360,1,85,16,2,1,1,2,1),
+(4361,1,85,16,2,1,2,2,1),
+(4362,1,85,128,2,1,0,7,1),
+(4363,1,85,128,2,1,1,7,1),
+(4364,1,85,128,2,1,2,7,1),
+(4365,1,85,256,2,1,0,7,1),
+(4366,1,85,256,2,1,1,7,1),
+(4367,1,85,256,2,1,2,7,1),
+(4368,1,85,1024,2,1,0,7,1),
+(4369,1,85,1024,2,1,1,7,1),
+(4370,1,85,1024,2,1,2,7,1),
+(4371,1,85,2048,2,1,0,2,1),
+(4372,1,85,2048,2,1,1,2,1),
+(4373,1,85,2048,2,1,2,2,1),
+(4374,1,85,4096,2,1,0,2,1),
+(4375,1,85,4096,2,1,1,2,1),
+(4376,1,85,4096,2,1,2,2,1),
+(4377,1,85,8192,2,1,0,2,1),
+(4378,1,85,8192,2,1,1,2,1),
+(4379,1,85,8192,2,1,2,2,1),
+(4380,1,85,32,2,1,0,5,1),
+(4381,1,85,32,2,1,1,5,1),
+(4382,1,85,32,2,1,2,5,1),
+(4383,1,85,512,2,1,0,5,1),
+(4384,1,85,512,2,1,1,5,1),
+(4385,1,85,512,2,1,2,5,1),
+(4386,1,85,2,2,1,0,4,1),
+(4387,1,85,2,2,1,1,4,1),
+(4388,1,85,2,2,1,2,4,1),
+(4389,1,85,0,2,1,0,7,1),
+(4390,1,85,1,2,1,0,3,1),
+(4391,1,85,1,2,1,1,3,1),
+(4392,1,85,1,2,1,2,3,1),
+(4393,1,85,16,2,1,0,2,1),
+(4394,1,85,16,2,1,1,2,1),
+(4395,1,85,16,2,1,2,2,1),
+(4396,1,85,128,2,1,0,7,1),
+(4397,1,85,128,2,1,1,7,1),
+(4398,1,85,128,2,1,2,7,1),
+(4399,1,85,256,2,1,0,7,1),
+(4400,1,85,256,2,1,1,7,1),
+(4401,1,85,256,2,1,2,7,1),
+(4402,1,85,1024,2,1,0,7,1),
+(4403,1,85,1024,2,1,1,7,1),
+(4404,1,85,1024,2,1,2,7,1),
+(4405,1,85,2048,2,1,0,2,1),
+(4406,1,85,2048,2,1,1,2,1),
+(4407,1,85,2048,2,1,2,2,1),
+(4408,1,85,4096,2,1,0,2,1),
+(4409,1,85,4096,2,1,1,2,1),
+(4410,1,85,4096,2,1,2,2,1),
+(4411,1,85,8192,2,1,0,2,1),
+(4412,1,85,8192,2,1,1,2,1),
+(4413,1,85,8192,2,1,2,2,1),
+(4414,1,85,32,2,1,0,5,1),
+(4415,1,85,32,2,1,1,5,1),
+(4416,1,85,32,2,1,2,5,1),
+(4417,1,85,512,2,1,0,5,1),
+(4418,1,85,512,2,1,1,5,1),
+(4419,1,85,512,2,1,2,5,1),
+(4420,1,85,2,2,1,0,4,1),
+(4421,1,85,2,2,1,1,4,1),
+(4422,1,85,2,2,1,2,4,1),
+(4423,1,85,0,2,1,0,7,1),
+(4424,1,85,1,2,1,0,3,1),
+(4425,1,85,1,2,1,1,3,1),
+(4426,1,85,1,2,1,2,3,1),
+(4427,1,85,16,2,1,0,2,1),
+(4428,1,85,16,2,1,1,2,1),
+(4429,1,85,16,2,1,2,2,1),
+(4430,1,85,128,2,1,0,7,1),
+(4431,1,85,128,2,1,1,7,1),
+(4432,1,85,128,2,1,2,7,1),
+(4433,1,85,256,2,1,0,7,1),
+(4434,1,85,256,2,1,1,7,1),
+(4435,1,85,256,2,1,2,7,1),
+(4436,1,85,1024,2,1,0,7,1),
+(4437,1,85,1024,2,1,1,7,1),
+(4438,1,85,1024,2,1,2,7,1),
+(4439,1,85,2048,2,1,0,2,1),
+(4440,1,85,2048,2,1,1,2,1),
+(4441,1,85,2048,2,1,2,2,1),
+(4442,1,85,4096,2,1,0,2,1),
+(4443,1,85,4096,2,1,1,2,1),
+(4444,1,85,4096,2,1,2,2,1),
+(4445,1,85,8192,2,1,0,2,1),
+(4446,1,85,8192,2,1,1,2,1),
+(4447,1,85,8192,2,1,2,2,1),
+(4448,1,85,32,2,1,0,5,1),
+(4449,1,85,32,2,1,1,5,1),
+(4450,1,85,32,2,1,2,5,1),
+(4451,1,85,512,2,1,0,5,1),
+(4452,1,85,512,2,1,1,5,1),
+(4453,1,85,512,2,1,2,5,1),
+(4454,1,85,2,2,1,0,4,1),
+(4455,1,85,2,2,1,1,4,1),
+(4456,1,85,2,2,1,2,4,1),
+(4457,1,85,0,2,1,0,7,1),
+(4458,1,85,1,2,1,0,3,1),
+(4459,1,85,1,2,1,1,3,1),
+(4460,1,85,1,2,1,2,3,1),
+(4461,1,85,16,2,1,0,2,1),
+(4462,1,85,16,2,1,1,2,1),
+(4463,1,85,16,2,1,2,2,1),
+(4464,1,85,128,2,1,0,7,1),
+(4465,1,85,128,2,1,1,7,1),
+(4466,1,85,128,2,1,2,7,1),
+(4467,1,85,256,2,1,0,7,1),
+(4468,1,85,256,2,1,1,7,1),
+(4469,1,85,256,2,1,2,7,1),
+(4470,1,85,1024,2,1,0,7,1),
+(4471,1,85,1024,2,1,1,7,1),
+(4472,1,85,1024,2,1,2,7,1),
+(4473,1,85,2048,2,1,0,2,1),
+(4474,1,85,2048,2,1,1,2,1),
+(4475,1,85,2048,2,1,2,2,1),
+(4476,1,85,4096,2,1,0,2,1),
+(4477,1,85,4096,2,1,1,2,1),
+(4478,1,85,4096,2,1,2,2,1),
+(4479,1,85,8192,2,1,0,2,1),
+(4480,1,85,8192,2,1,1,2,1),
+(4481,1,85,8192,2,1,2,2,1),
+(4482,1,85,32,2,1,0,5,1),
+(4483,1,85,32,2,1,1,5,1),
+(4484,1,85,32,2,1,2,5,1),
+(4485,1,85,512,2,1,0,5,1),
+(4486,1,85,512,2,1,1,5,1),
+(4487,1,85,512,2,1,2,5,1),
+(4488,1,85,2,2,1,0,4,1),
+(4489,1,85,2,2,1,1,4,1),
+(4490,1,85,2,2,1,2,4,1),
+(4491,1,85,0,2,1,0,7,1),
+(4492,1,85,1,2,1,0,3,1),
+(4493,1,85,1,2,1,1,3,1),
+(4494,1,85,1,2,1,2,3,1),
+(4495,1,85,16,2,1,0,2,1),
+(4496,1,85,16,2,1,1,2,1),
+(4497,1,85,16,2,1,2,2,1),
+(4498,1,85,128,2,1,0,7,1),
+(4499,1,85,128,2,1,1,7,1),
+(4500,1,85,128,2,1,2,7,1),
+(4501,1,85,256,2,1,0,7,1),
+(4502,1,85,256,2,1,1,7,1),
+(4503,1,85,256,2,1,2,7,1),
+(4504,1,85,1024,2,1,0,7,1),
+(4505,1,85,1024,2,1,1,7,1),
+(4506,1,85,1024,2,1,2,7,1),
+(4507,1,85,2048,2,1,0,2,1),
+(4508,1,85,2048,2,1,1,2,1),
+(4509,1,85,2048,2,1,2,2,1),
+(4510,1,85,4096,2,1,0,2,1),
+(4511,1,85,4096,2,1,1,2,1),
+(4512,1,85,4096,2,1,2,2,1),
+(4513,1,85,8192,2,1,0,2,1),
+(4514,1,85,8192,2,1,1,2,1),
+(4515,1,85,8192,2,1,2,2,1),
+(4516,1,85,32,2,1,0,5,1),
+(4517,1,85,32,2,1,1,5,1),
+(4518,1,85,32,2,1,2,5,1),
+(4519,1,85,512,2,1,0,5,1),
+(4520,1,85,512,2,1,1,5,1),
+(4521,1,85,512,2,1,2,5,1),
+(4522,1,85,2,2,1,0,4,1),
+(4523,1,85,2,2,1,1,4,1),
+(4524,1,85,2,2,1,2,4,1),
+(4525,1,85,0,2,1,0,7,1),
+(4526,1,85,1,2,1,0,3,1),
+(4527,1,85,1,2,1,1,3,1),
+(4528,1,85,1,2,1,2,3,1),
+(4529,1,85,16,2,1,0,2,1),
+(4530,1,85,16,2,1,1,2,1),
+(4531,1,85,16,2,1,2,2,1),
+(4532,1,85,128,2,1,0,7,1),
+(4533,1,85,128,2,1,1,7,1),
+(4534,1,85,128,2,1,2,7,1),
+(4535,1,85,256,2,1,0,7,1),
+(4536,1,85,256,2,1,1,7,1),
+(4537,1,85,256,2,1,2,7,1),
+(4538,1,85,1024,2,1,0,7,1),
+(4539,1,85,1024,2,1,1,7,1),
+(4540,1,85,1024,2,1,2,7,1),
+(4541,1,85,2048,2,1,0,2,1),
+(4542,1,85,2048,2,1,1,2,1),
+(4543,1,85,2048,2,1,2,2,1),
+(4544,1,85,4096,2,1,0,2,1),
+(4545,1,85,4096,2,1,1,2,1),
+(4546,1,85,4096,2,1,2,2,1),
+(4547,1,85,8192,2,1,0,2,1),
+(4548,1,85,8192,2,1,1,2,1),
+(4549,1,85,8192,2,1,2,2,1),
+(4550,1,85,32,2,1,0,5,1),
+(4551,1,85,32,2,1,1,5,1),
+(4552,1,85,32,2,1,2,5,1),
+(4553,1,85,512,2,1,0,5,1),
+(4554,1,85,512,2,1,1,5,1),
+(4555,1,85,512,2,1,2,5,1),
+(4556,1,85,2,2,1,0,4,1),
+(4557,1,85,2,2,1,1,4,1),
+(4558,1,85,2,2,1,2,4,1),
+(4559,1,85,0,2,2,0,7,1),
+(4560,1,85,1,2,2,0,3,1),
+(4561,1,85,1,2,2,1,3,1),
+(4562,1,85,1,2,2,2,3,1),
+(4563,1,85,16,2,2,0,2,1),
+(4564,1,85,16,2,2,1,2,1),
+(4565,1,85,16,2,2,2,2,1),
+(4566,1,85,128,2,2,0,7,1),
+(4567,1,85,128,2,2,1,7,1),
+(4568,1,85,128,2,2,2,7,1),
+(4569,1,85,256,2,2,0,7,1),
+(4570,1,85,256,2,2,1,7,1),
+(4571,1,85,256,2,2,2,7,1),
+(4572,1,85,1024,2,2,0,7,1),
+(4573,1,85,1024,2,2,1,7,1),
+(4574,1,85,1024,2,2,2,7,1),
+(4575,1,85,2048,2,2,0,2,1),
+(4576,1,85,2048,2,2,1,2,1),
+(4577,1,85,2048,2,2,2,2,1),
+(4578,1,85,4096,2,2,0,2,1),
+(4579,1,85,4096,2,2,1,2,1),
+(4580,1,85,4096,2,2,2,2,1),
+(4581,1,85,8192,2,2,0,2,1),
+(4582,1,85,8192,2,2,1,2,1),
+(4583,1,85,8192,2,2,2,2,1),
+(4584,1,85,32,2,2,0,5,1),
+(4585,1,85,32,2,2,1,5,1),
+(4586,1,85,32,2,2,2,5,1),
+(4587,1,85,512,2,2,0,5,1),
+(4588,1,85,512,2,2,1,5,1),
+(4589,1,85,512,2,2,2,5,1),
+(4590,1,85,2,2,2,0,4,1),
+(4591,1,85,2,2,2,1,4,1),
+(4592,1,85,2,2,2,2,4,1),
+(4593,1,85,0,2,2,0,7,1),
+(4594,1,85,1,2,2,0,3,1),
+(4595,1,85,1,2,2,1,3,1),
+(4596,1,85,1,2,2,2,3,1),
+(4597,1,85,16,2,2,0,2,1),
+(4598,1,85,16,2,2,1,2,1),
+(4599,1,85,16,2,2,2,2,1),
+(4600,1,85,128,2,2,0,7,1),
+(4601,1,85,128,2,2,1,7,1),
+(4602,1,85,128,2,2,2,7,1),
+(4603,1,85,256,2,2,0,7,1),
+(4604,1,85,256,2,2,1,7,1),
+(4605,1,85,256,2,2,2,7,1),
+(4606,1,85,1024,2,2,0,7,1),
+(4607,1,85,1024,2,2,1,7,1),
+(4608,1,85,1024,2,2,2,7,1),
+(4609,1,85,2048,2,2,0,2,1),
+(4610,1,85,2048,2,2,1,2,1),
+(4611,1,85,2048,2,2,2,2,1),
+(4612,1,85,4096,2,2,0,2,1),
+(4613,1,85,4096,2,2,1,2,1),
+(4614,1,85,4096,2,2,2,2,1),
+(4615,1,85,8192,2,2,0,2,1),
+(4616,1,85,8192,2,2,1,2,1),
+(4617,1,85,8192,2,2,2,2,1),
+(4618,1,85,32,2,2,0,5,1),
+(4619,1,85,32,2,2,1,5,1),
+(4620,1,85,32,2,2,2,5,1),
+(4621,1,85,512,2,2,0,5,1),
+(4622,1,85,512,2,2,1,5,1),
+(4623,1,85,512,2,2,2,5,1),
+(4624,1,85,2,2,2,0,4,1),
+(4625,1,85,2,2,2,1,4,1),
+(4626,1,85,2,2,2,2,4,1),
+(4627,1,85,0,2,2,0,7,1),
+(4628,1,85,1,2,2,0,3,1),
+(4629,1,85,1,2,2,1,3,1),
+(4630,1,85,1,2,2,2,3,1),
+(4631,1,85,16,2,2,0,2,1),
+(4632,1,85,16,2,2,1,2,1),
+(4633,1,85,16,2,2,2,2,1),
+(4634,1,85,128,2,2,0,7,1),
+(4635,1,85,128,2,2,1,7,1),
+(4636,1,85,128,2,2,2,7,1),
+(4637,1,85,256,2,2,0,7,1),
+(4638,1,85,256,2,2,1,7,1),
+(4639,1,85,256,2,2,2,7,1),
+(4640,1,85,1024,2,2,0,7,1),
+(4641,1,85,1024,2,2,1,7,1),
+(4642,1,85,1024,2,2,2,7,1),
+(4643,1,85,2048,2,2,0,2,1),
+(4644,1,85,2048,2,2,1,2,1),
+(4645,1,85,2048,2,2,2,2,1),
+(4646,1,85,4096,2,2,0,2,1),
+(4647,1,85,4096,2,2,1,2,1),
+(4648,1,85,4096,2,2,2,2,1),
+(4649,1,85,8192,2,2,0,2,1),
+(4650,1,85,8192,2,2,1,2,1),
+(4651,1,85,8192,2,2,2,2,1),
+(4652,1,85,32,2,2,0,5,1),
+(4653,1,85,32,2,2,1,5,1),
+(4654,1,85,32,2,2,2,5,1),
+(4655,1,85,512,2,2,0,5,1),
+(4656,1,85,512,2,2,1,5,1),
+(4657,1,85,512,2,2,2,5,1),
+(4658,1,85,2,2,2,0,4,1),
+(4659,1,85,2,2,2,1,4,1),
+(4660,1,85,2,2,2,2,4,1),
+(4661,1,85,0,2,2,0,7,1),
+(4662,1,85,1,2,2,0,3,1),
+(4663,1,85,1,2,2,1,3,1),
+(4664,1,85,1,2,2,2,3,1),
+(4665,1,85,16,2,2,0,2,1),
+(4666,1,85,16,2,2,1,2,1),
+(4667,1,85,16,2,2,2,2,1),
+(4668,1,85,128,2,2,0,7,1),
+(4669,1,85,128,2,2,1,7,1),
+(4670,1,85,128,2,2,2,7,1),
+(4671,1,85,256,2,2,0,7,1),
+(4672,1,85,256,2,2,1,7,1),
+(4673,1,85,256,2,2,2,7,1),
+(4674,1,85,1024,2,2,0,7,1),
+(4675,1,85,1024,2,2,1,7,1),
+(4676,1,85,1024,2,2,2,7,1),
+(4677,1,85,2048,2,2,0,2,1),
+(4678,1,85,2048,2,2,1,2,1),
+(4679,1,85,2048,2,2,2,2,1),
+(4680,1,85,4096,2,2,0,2,1),
+(4681,1,85,4096,2,2,1,2,1),
+(4682,1,85,4096,2,2,2,2,1),
+(4683,1,85,8192,2,2,0,2,1),
+(4684,1,85,8192,2,2,1,2,1),
+(4685,1,85,8192,2,2,2,2,1),
+(4686,1,85,32,2,2,0,5,1),
+(4687,1,85,32,2,2,1,5,1),
+(4688,1,85,32,2,2,2,5,1),
+(4689,1,85,512,2,2,0,5,1),
+(4690,1,85,512,2,2,1,5,1),
+(4691,1,85,512,2,2,2,5,1),
+(4692,1,85,2,2,2,0,4,1),
+(4693,1,85,2,2,2,1,4,1),
+(4694,1,85,2,2,2,2,4,1),
+(4695,1,85,0,2,2,0,7,1),
+(4696,1,85,1,2,2,0,3,1),
+(4697,1,85,1,2,2,1,3,1),
+(4698,1,85,1,2,2,2,3,1),
+(4699,1,85,16,2,2,0,2,1),
+(4700,1,85,16,2,2,1,2,1),
+(4701,1,85,16,2,2,2,2,1),
+(4702,1,85,128,2,2,0,7,1),
+(4703,1,85,128,2,2,1,7,1),
+(4704,1,85,128,2,2,2,7,1),
+(4705,1,85,256,2,2,0,7,1),
+(4706,1,85,256,2,2,1,7,1),
+(4707,1,85,256,2,2,2,7,1),
+(4708,1,85,1024,2,2,0,7,1),
+(4709,1,85,1024,2,2,1,7,1),
+(4710,1,85,1024,2,2,2,7,1),
+(4711,1,85,2048,2,2,0,2,1),
+(4712,1,85,2048,2,2,1,2,1),
+(4713,1,85,2048,2,2,2,2,1),
+(4714,1,85,4096,2,2,0,2,1),
+(4715,1,85,4096,2,2,1,2,1),
+(4716,1,85,4096,2,2,2,2,1),
+(4717,1,85,8192,2,2,0,2,1),
+(4718,1,85,8192,2,2,1,2,1),
+(4719,1,85,8192,2,2,2,2,1),
+(4720,1,85,32,2,2,0,5,1),
+(4721,1,85,32,2,2,1,5,1),
+(4722,1,85,32,2,2,2,5,1),
+(4723,1,85,512,2,2,0,5,1),
+(4724,1,85,512,2,2,1,5,1),
+(4725,1,85,512,2,2,2,5,1),
+(4726,1,85,2,2,2,0,4,1),
+(4727,1,85,2,2,2,1,4,1),
+(4728,1,85,2,2,2,2,4,1),
+(4729,1,85,0,2,2,0,7,1),
+(4730,1,85,1,2,2,0,3,1),
+(4731,1,85,1,2,2,1,3,1),
+(4732,1,85,1,2,2,2,3,1),
+(4733,1,85,16,2,2,0,2,1),
+(4734,1,85,16,2,2,1,2,1),
+(4735,1,85,16,2,2,2,2,1),
+(4736,1,85,128,2,2,0,7,1),
+(4737,1,85,128,2,2,1,7,1),
+(4738,1,85,128,2,2,2,7,1),
+(4739,1,85,256,2,2,0,7,1),
+(4740,1,85,256,2,2,1,7,1),
+(4741,1,85,256,2,2,2,7,1),
+(4742,1,85,1024,2,2,0,7,1),
+(4743,1,85,1024,2,2,1,7,1),
+(4744,1,85,1024,2,2,2,7,1),
+(4745,1,85,2048,2,2,0,2,1),
+(4746,1,85,2048,2,2,1,2,1),
+(4747,1,85,2048,2,2,2,2,1),
+(4748,1,85,4096,2,2,0,2,1),
+(4749,1,85,4096,2,2,1,2,1),
+(4750,1,85,4096,2,2,2,2,1),
+(4751,1,85,8192,2,2,0,2,1),
+(4752,1,85,8192,2,2,1,2,1),
+(4753,1,85,8192,2,2,2,2,1),
+(4754,1,85,32,2,2,0,5,1),
+(4755,1,85,32,2,2,1,5,1),
+(4756,1,85,32,2,2,2,5,1),
+(4757,1,85,512,2,2,0,5,1),
+(4758,1,85,512,2,2,1,5,1),
+(4759,1,85,512,2,2,2,5,1),
+(4760,1,85,2,2,2,0,4,1),
+(4761,1,85,2,2,2,1,4,1),
+(4762,1,85,2,2,2,2,4,1),
+(4763,1,85,0,2,2,0,7,1),
+(4764,1,85,1,2,2,0,3,1),
+(4765,1,85,1,2,2,1,3,1),
+(4766,1,85,1,2,2,2,3,1),
+(4767,1,85,16,2,2,0,2,1),
+(4768,1,85,16,2,2,1,2,1),
+(4769,1,85,16,2,2,2,2,1),
+(4770,1,85,128,2,2,0,7,1),
+(4771,1,85,128,2,2,1,7,1),
+(4772,1,85,128,2,2,2,7,1),
+(4773,1,85,256,2,2,0,7,1),
+(4774,1,85,256,2,2,1,7,1),
+(4775,1,85,256,2,2,2,7,1),
+(4776,1,85,1024,2,2,0,7,1),
+(4777,1,85,1024,2,2,1,7,1),
+(4778,1,85,1024,2,2,2,7,1),
+(4779,1,85,2048,2,2,0,2,1),
+(4780,1,85,2048,2,2,1,2,1),
+(4781,1,85,2048,2,2,2,2,1),
+(4782,1,85,4096,2,2,0,2,1),
+(4783,1,85,4096,2,2,1,2,1),
+(4784,1,85,4096,2,2,2,2,1),
+(4785,1,85,8192,2,2,0,2,1),
+(4786,1,85,8192,2,2,1,2,1),
+(4787,1,85,8192,2,2,2,2,1),
+(4788,1,85,32,2,2,0,5,1),
+(4789,1,85,32,2,2,1,5,1),
+(4790,1,85,32,2,2,2,5,1),
+(4791,1,85,512,2,2,0,5,1),
+(4792,1,85,512,2,2,1,5,1),
+(4793,1,85,512,2,2,2,5,1),
+(4794,1,85,2,2,2,0,4,1),
+(4795,1,85,2,2,2,1,4,1),
+(4796,1,85,2,2,2,2,4,1),
+(4797,1,85,0,2,32768,0,7,1),
+(4798,1,85,1,2,32768,0,3,1),
+(4799,1,85,1,2,32768,1,3,1),
+(4800,1,85,1,2,32768,2,3,1),
+(4801,1,85,16,2,32768,0,2,1),
+(4802,1,85,16,2,32768,1,2,1),
+(4803,1,85,16,2,32768,2,2,1),
+(4804,1,85,128,2,32768,0,7,1),
+(4805,1,85,128,2,32768,1,7,1),
+(4806,1,85,128,2,32768,2,7,1),
+(4807,1,85,256,2,32768,0,7,1),
+(4808,1,85,256,2,32768,1,7,1),
+(4809,1,85,256,2,32768,2,7,1),
+(4810,1,85,1024,2,32768,0,7,1),
+(4811,1,85,1024,2,32768,1,7,1),
+(4812,1,85,1024,2,32768,2,7,1),
+(4813,1,85,2048,2,32768,0,2,1),
+(4814,1,85,2048,2,32768,1,2,1),
+(4815,1,85,2048,2,32768,2,2,1),
+(4816,1,85,4096,2,32768,0,2,1),
+(4817,1,85,4096,2,32768,1,2,1),
+(4818,1,85,4096,2,32768,2,2,1),
+(4819,1,85,8192,2,32768,0,2,1),
+(4820,1,85,8192,2,32768,1,2,1),
+(4821,1,85,8192,2,32768,2,2,1),
+(4822,1,85,32,2,32768,0,5,1),
+(4823,1,85,32,2,32768,1,5,1),
+(4824,1,85,32,2,32768,2,5,1),
+(4825,1,85,512,2,32768,0,5,1),
+(4826,1,85,512,2,32768,1,5,1),
+(4827,1,85,512,2,32768,2,5,1),
+(4828,1,85,2,2,32768,0,4,1),
+(4829,1,85,2,2,32768,1,4,1),
+(4830,1,85,2,2,32768,2,4,1),
+(4831,1,85,0,2,32768,0,7,1),
+(4832,1,85,1,2,32768,0,3,1),
+(4833,1,85,1,2,32768,1,3,1),
+(4834,1,85,1,2,32768,2,3,1),
+(4835,1,85,16,2,32768,0,2,1),
+(4836,1,85,16,2,32768,1,2,1),
+(4837,1,85,16,2,32768,2,2,1),
+(4838,1,85,128,2,32768,0,7,1),
+(4839,1,85,128,2,32768,1,7,1),
+(4840,1,85,128,2,32768,2,7,1),
+(4841,1,85,256,2,32768,0,7,1),
+(4842,1,85,256,2,32768,1,7,1),
+(4843,1,85,256,2,32768,2,7,1),
+(4844,1,85,1024,2,32768,0,7,1),
+(4845,1,85,1024,2,32768,1,7,1),
+(4846,1,85,1024,2,32768,2,7,1),
+(4847,1,85,2048,2,32768,0,2,1),
+(4848,1,85,2048,2,32768,1,2,1),
+(4849,1,85,2048,2,32768,2,2,1),
+(4850,1,85,4096,2,32768,0,2,1),
+(4851,1,85,4096,2,32768,1,2,1),
+(4852,1,85,4096,2,32768,2,2,1),
+(4853,1,85,8192,2,32768,0,2,1),
+(4854,1,85,8192,2,32768,1,2,1),
+(4855,1,85,8192,2,32768,2,2,1),
+(4856,1,85,32,2,32768,0,5,1),
+(4857,1,85,32,2,32768,1,5,1),
+(4858,1,85,32,2,32768,2,5,1),
+(4859,1,85,512,2,32768,0,5,1),
+(4860,1,85,512,2,32768,1,5,1),
+(4861,1,85,512,2,32768,2,5,1),
+(4862,1,85,2,2,32768,0,4,1),
+(4863,1,85,2,2,32768,1,4,1),
+(4864,1,85,2,2,32768,2,4,1),
+(4865,1,85,0,2,32768,0,7,1),
+(4866,1,85,1,2,32768,0,3,1),
+(4867,1,85,1,2,32768,1,3,1),
+(4868,1,85,1,2,32768,2,3,1),
+(4869,1,85,16,2,32768,0,2,1),
+(4870,1,85,16,2,32768,1,2,1),
+(4871,1,85,16,2,32768,2,2,1),
+(4872,1,85,128,2,32768,0,7,1),
+(4873,1,85,128,2,32768,1,7,1),
+(4874,1,85,128,2,32768,2,7,1),
+(4875,1,85,256,2,32768,0,7,1),
+(4876,1,85,256,2,32768,1,7,1),
+(4877,1,85,256,2,32768,2,7,1),
+(4878,1,85,1024,2,32768,0,7,1),
+(4879,1,85,1024,2,32768,1,7,1),
+(4880,1,85,1024,2,32768,2,7,1),
+(4881,1,85,2048,2,32768,0,2,1),
+(4882,1,85,2048,2,32768,1,2,1),
+(4883,1,85,2048,2,32768,2,2,1),
+(4884,1,85,4096,2,32768,0,2,1),
+(4885,1,85,4096,2,32768,1,2,1),
+(4886,1,85,4096,2,32768,2,2,1),
+(4887,1,85,8192,2,32768,0,2,1),
+(4888,1,85,8192,2,32768,1,2,1),
+(4889,1,85,8192,2,32768,2,2,1),
+(4890,1,85,32,2,32768,0,5,1),
+(4891,1,85,32,2,32768,1,5,1),
+(4892,1,85,32,2,32768,2,5,1),
+(4893,1,85,512,2,32768,0,5,1),
+(4894,1,85,512,2,32768,1,5,1),
+(4895,1,85,512,2,32768,2,5,1),
+(4896,1,85,2,2,32768,0,4,1),
+(4897,1,85,2,2,32768,1,4,1),
+(4898,1,85,2,2,32768,2,4,1),
+(4899,1,85,0,2,32768,0,7,1),
+(4900,1,85,1,2,32768,0,3,1),
+(4901,1,85,1,2,32768,1,3,1),
+(4902,1,85,1,2,32768,2,3,1),
+(4903,1,85,16,2,32768,0,2,1),
+(4904,1,85,16,2,32768,1,2,1),
+(4905,1,85,16,2,32768,2,2,1),
+(4906,1,85,128,2,32768,0,7,1),
+(4907,1,85,128,2,32768,1,7,1),
+(4908,1,85,128,2,32768,2,7,1),
+(4909,1,85,256,2,32768,0,7,1),
+(4910,1,85,256,2,32768,1,7,1),
+(4911,1,85,256,2,32768,2,7,1),
+(4912,1,85,1024,2,32768,0,7,1),
+(4913,1,85,1024,2,32768,1,7,1),
+(4914,1,85,1024,2,32768,2,7,1),
+(4915,1,85,2048,2,32768,0,2,1),
+(4916,1,85,2048,2,32768,1,2,1),
+(4917,1,85,2048,2,32768,2,2,1),
+(4918,1,85,4096,2,32768,0,2,1),
+(4919,1,85,4096,2,32768,1,2,1),
+(4920,1,85,4096,2,32768,2,2,1),
+(4921,1,85,8192,2,32768,0,2,1),
+(4922,1,85,8192,2,32768,1,2,1),
+(4923,1,85,8192,2,32768,2,2,1),
+(4924,1,85,32,2,32768,0,5,1),
+(4925,1,85,32,2,32768,1,5,1),
+(4926,1,85,32,2,32768,2,5,1),
+(4927,1,85,512,2,32768,0,5,1),
+(4928,1,85,512,2,32768,1,5,1),
+(4929,1,85,512,2,32768,2,5,1),
+(4930,1,85,2,2,32768,0,4,1),
+(4931,1,85,2,2,32768,1,4,1),
+(4932,1,85,2,2,32768,2,4,1),
+(4933,1,85,0,2,32768,0,7,1),
+(4934,1,85,1,2,32768,0,3,1),
+(4935,1,85,1,2,32768,1,3,1),
+(4936,1,85,1,2,32768,2,3,1),
+(4937,1,85,16,2,32768,0,2,1),
+(4938,1,85,16,2,32768,1,2,1),
+(4939,1,85,16,2,32768,2,2,1),
+(4940,1,85,128,2,32768,0,7,1),
+(4941,1,85,128,2,32768,1,7,1),
+(4942,1,85,128,2,32768,2,7,1),
+(4943,1,85,256,2,32768,0,7,1),
+(4944,1,85,256,2,32768,1,7,1),
+(4945,1,85,256,2,32768,2,7,1),
+(4946,1,85,1024,2,32768,0,7,1),
+(4947,1,85,1024,2,32768,1,7,1),
+(4948,1,85,1024,2,32768,2,7,1),
+(4949,1,85,2048,2,32768,0,2,1),
+(4950,1,85,2048,2,32768,1,2,1),
+(4951,1,85,2048,2,32768,2,2,1),
+(4952,1,85,4096,2,32768,0,2,1),
+(4953,1,85,4096,2,32768,1,2,1),
+(4954,1,85,4096,2,32768,2,2,1),
+(4955,1,85,8192,2,32768,0,2,1),
+(4956,1,85,8192,2,32768,1,2,1),
+(4957,1,85,8192,2,32768,2,2,1),
+(4958,1,85,32,2,32768,0,5,1),
+(4959,1,85,32,2,32768,1,5,1),
+(4960,1,85,32,2,32768,2,5,1),
+(4961,1,85,512,2,32768,0,5,1),
+(4962,1,85,512,2,32768,1,5,1),
+(4963,1,85,512,2,32768,2,5,1),
+(4964,1,85,2,2,32768,0,4,1),
+(4965,1,85,2,2,32768,1,4,1),
+(4966,1,85,2,2,32768,2,4,1),
+(4967,1,85,0,2,32768,0,7,1),
+(4968,1,85,1,2,32768,0,3,1),
+(4969,1,85,1,2,32768,1,3,1),
+(4970,1,85,1,2,32768,2,3,1),
+(4971,1,85,16,2,32768,0,2,1),
+(4972,1,85,16,2,32768,1,2,1),
+(4973,1,85,16,2,32768,2,2,1),
+(4974,1,85,128,2,32768,0,7,1),
+(4975,1,85,128,2,32768,1,7,1),
+(4976,1,85,128,2,32768,2,7,1),
+(4977,1,85,256,2,32768,0,7,1),
+(4978,1,85,256,2,32768,1,7,1),
+(4979,1,85,256,2,32768,2,7,1),
+(4980,1,85,1024,2,32768,0,7,1),
+(4981,1,85,1024,2,32768,1,7,1),
+(4982,1,85,1024,2,32768,2,7,1),
+(4983,1,85,2048,2,32768,0,2,1),
+(4984,1,85,2048,2,32768,1,2,1),
+(4985,1,85,2048,2,32768,2,2,1),
+(4986,1,85,4096,2,32768,0,2,1),
+(4987,1,85,4096,2,32768,1,2,1),
+(4988,1,85,4096,2,32768,2,2,1),
+(4989,1,85,8192,2,32768,0,2,1),
+(4990,1,85,8192,2,32768,1,2,1),
+(4991,1,85,8192,2,32768,2,2,1),
+(4992,1,85,32,2,32768,0,5,1),
+(4993,1,85,32,2,32768,1,5,1),
+(4994,1,85,32,2,32768,2,5,1),
+(4995,1,85,512,2,32768,0,5,1),
+(4996,1,85,512,2,32768,1,5,1),
+(4997,1,85,512,2,32768,2,5,1),
+(4998,1,85,2,2,32768,0,4,1),
+(4999,1,85,2,2,32768,1,4,1),
+(5000,1,85,2,2,32768,2,4,1),
+(5001,1,85,0,2,32768,0,7,1),
+(5002,1,85,1,2,32768,0,3,1),
+(5003,1,85,1,2,32768,1,3,1),
+(5004,1,85,1,2,32768,2,3,1),
+(5005,1,85,16,2,32768,0,2,1),
+(5006,1,85,16,2,32768,1,2,1),
+(5007,1,85,16,2,32768,2,2,1),
+(5008,1,85,128,2,32768,0,7,1),
+(5009,1,85,128,2,32768,1,7,1),
+(5010,1,85,128,2,32768,2,7,1),
+(5011,1,85,256,2,32768,0,7,1),
+(5012,1,85,256,2,32768,1,7,1),
+(5013,1,85,256,2,32768,2,7,1),
+(5014,1,85,1024,2,32768,0,7,1),
+(5015,1,85,1024,2,32768,1,7,1),
+(5016,1,85,1024,2,32768,2,7,1),
+(5017,1,85,2048,2,32768,0,2,1),
+(5018,1,85,2048,2,32768,1,2,1),
+(5019,1,85,2048,2,32768,2,2,1),
+(5020,1,85,4096,2,32768,0,2,1),
+(5021,1,85,4096,2,32768,1,2,1),
+(5022,1,85,4096,2,32768,2,2,1),
+(5023,1,85,8192,2,32768,0,2,1),
+(5024,1,85,8192,2,32768,1,2,1),
+(5025,1,85,8192,2,32768,2,2,1),
+(5026,1,85,32,2,32768,0,5,1),
+(5027,1,85,32,2,32768,1,5,1),
+(5028,1,85,32,2,32768,2,5,1),
+(5029,1,85,512,2,32768,0,5,1),
+(5030,1,85,512,2,32768,1,5,1),
+(5031,1,85,512,2,32768,2,5,1),
+(5032,1,85,2,2,32768,0,4,1),
+(5033,1,85,2,2,32768,1,4,1),
+(5034,1,85,2,2,32768,2,4,1),
+(5035,1,85,0,2,8,0,23,1),
+(5036,1,85,1,2,8,0,3,1),
+(5037,1,85,1,2,8,1,3,1),
+(5038,1,85,1,2,8,2,3,1),
+(5039,1,85,16,2,8,0,2,1),
+(5040,1,85,16,2,8,1,2,1),
+(5041,1,85,16,2,8,2,2,1),
+(5042,1,85,128,2,8,0,23,1),
+(5043,1,85,128,2,8,1,23,1),
+(5044,1,85,128,2,8,2,23,1),
+(5045,1,85,256,2,8,0,23,1),
+(5046,1,85,256,2,8,1,23,1),
+(5047,1,85,256,2,8,2,23,1),
+(5048,1,85,1024,2,8,0,7,1),
+(5049,1,85,1024,2,8,1,7,1),
+(5050,1,85,1024,2,8,2,7,1),
+(5051,1,85,2048,2,8,0,2,1),
+(5052,1,85,2048,2,8,1,2,1),
+(5053,1,85,2048,2,8,2,2,1),
+(5054,1,85,4096,2,8,0,2,1),
+(5055,1,85,4096,2,8,1,2,1),
+(5056,1,85,4096,2,8,2,2,1),
+(5057,1,85,8192,2,8,0,2,1),
+(5058,1,85,8192,2,8,1,2,1),
+(5059,1,85,8192,2,8,2,2,1),
+(5060,1,85,32,2,8,0,21,1),
+(5061,1,85,32,2,8,1,21,1),
+(5062,1,85,32,2,8,2,21,1),
+(5063,1,85,512,2,8,0,21,1),
+(5064,1,85,512,2,8,1,21,1),
+(5065,1,85,512,2,8,2,21,1),
+(5066,1,85,2,2,8,0,20,1),
+(5067,1,85,2,2,8,1,20,1),
+(5068,1,85,2,2,8,2,20,1),
+(5069,1,85,0,2,8,0,23,1),
+(5070,1,85,1,2,8,0,3,1),
+(5071,1,85,1,2,8,1,3,1),
+(5072,1,85,1,2,8,2,3,1),
+(5073,1,85,16,2,8,0,2,1),
+(5074,1,85,16,2,8,1,2,1),
+(5075,1,85,16,2,8,2,2,1),
+(5076,1,85,128,2,8,0,23,1),
+(5077,1,85,128,2,8,1,23,1),
+(5078,1,85,128,2,8,2,23,1),
+(5079,1,85,256,2,8,0,23,1),
+(5080,1,85,256,2,8,1,23,1),
+(5081,1,85,256,2,8,2,23,1),
+(5082,1,85,1024,2,8,0,7,1),
+(5083,1,85,1024,2,8,1,7,1),
+(5084,1,85,1024,2,8,2,7,1),
+(5085,1,85,2048,2,8,0,2,1),
+(5086,1,85,2048,2,8,1,2,1),
+(5087,1,85,2048,2,8,2,2,1),
+(5088,1,85,4096,2,8,0,2,1),
+(5089,1,85,4096,2,8,1,2,1),
+(5090,1,85,4096,2,8,2,2,1),
+(5091,1,85,8192,2,8,0,2,1),
+(5092,1,85,8192,2,8,1,2,1),
+(5093,1,85,8192,2,8,2,2,1),
+(5094,1,85,32,2,8,0,21,1),
+(5095,1,85,32,2,8,1,21,1),
+(5096,1,85,32,2,8,2,21,1),
+(5097,1,85,512,2,8,0,21,1),
+(5098,1,85,512,2,8,1,21,1),
+(5099,1,85,512,2,8,2,21,1),
+(5100,1,85,2,2,8,0,20,1),
+(5101,1,85,2,2,8,1,20,1),
+(5102,1,85,2,2,8,2,20,1),
+(5103,1,85,0,2,8,0,23,1),
+(5104,1,85,1,2,8,0,3,1),
+(5105,1,85,1,2,8,1,3,1),
+(5106,1,85,1,2,8,2,3,1),
+(5107,1,85,16,2,8,0,2,1),
+(5108,1,85,16,2,8,1,2,1),
+(5109,1,85,16,2,8,2,2,1),
+(5110,1,85,128,2,8,0,23,1),
+(5111,1,85,128,2,8,1,23,1),
+(5112,1,85,128,2,8,2,23,1),
+(5113,1,85,256,2,8,0,23,1),
+(5114,1,85,256,2,8,1,23,1),
+(5115,1,85,256,2,8,2,23,1),
+(5116,1,85,1024,2,8,0,7,1),
+(5117,1,85,1024,2,8,1,7,1),
+(5118,1,85,1024,2,8,2,7,1),
+(5119,1,85,2048,2,8,0,2,1),
+(5120,1,85,2048,2,8,1,2,1),
+(5121,1,85,2048,2,8,2,2,1),
+(5122,1,85,4096,2,8,0,2,1),
+(5123,1,85,4096,2,8,1,2,1),
+(5124,1,85,4096,2,8,2,2,1),
+(5125,1,85,8192,2,8,0,2,1),
+(5126,1,85,8192,2,8,1,2,1),
+(5127,1,85,8192,2,8,2,2,1),
+(5128,1,85,32,2,8,0,21,1),
+(5129,1,85,32,2,8,1,21,1),
+(5130,1,85,32,2,8,2,21,1),
+(5131,1,85,512,2,8,0,21,1),
+(5132,1,85,512,2,8,1,21,1),
+(5133,1,85,512,2,8,2,21,1),
+(5134,1,85,2,2,8,0,20,1),
+(5135,1,85,2,2,8,1,20,1),
+(5136,1,85,2,2,8,2,20,1),
+(5137,1,85,0,2,8,0,23,1),
+(5138,1,85,1,2,8,0,3,1),
+(5139,1,85,1,2,8,1,3,1),
+(5140,1,85,1,2,8,2,3,1),
+(5141,1,85,16,2,8,0,2,1),
+(5142,1,85,16,2,8,1,2,1),
+(5143,1,85,16,2,8,2,2,1),
+(5144,1,85,128,2,8,0,23,1),
+(5145,1,85,128,2,8,1,23,1),
+(5146,1,85,128,2,8,2,23,1),
+(5147,1,85,256,2,8,0,23,1),
+(5148,1,85,256,2,8,1,23,1),
+(5149,1,85,256,2,8,2,23,1),
+(5150,1,85,1024,2,8,0,7,1),
+(5151,1,85,1024,2,8,1,7,1),
+(5152,1,85,1024,2,8,2,7,1),
+(5153,1,85,2048,2,8,0,2,1),
+(5154,1,85,2048,2,8,1,2,1),
+(5155,1,85,2048,2,8,2,2,1),
+(5156,1,85,4096,2,8,0,2,1),
+(5157,1,85,4096,2,8,1,2,1),
+(5158,1,85,4096,2,8,2,2,1),
+(5159,1,85,8192,2,8,0,2,1),
+(5160,1,85,8192,2,8,1,2,1),
+(5161,1,85,8192,2,8,2,2,1),
+(5162,1,85,32,2,8,0,21,1),
+(5163,1,85,32,2,8,1,21,1),
+(5164,1,85,32,2,8,2,21,1),
+(5165,1,85,512,2,8,0,21,1),
+(5166,1,85,512,2,8,1,21,1),
+(5167,1,85,512,2,8,2,21,1),
+(5168,1,85,2,2,8,0,20,1),
+(5169,1,85,2,2,8,1,20,1),
+(5170,1,85,2,2,8,2,20,1),
+(5171,1,85,0,2,8,0,23,1),
+(5172,1,85,1,2,8,0,3,1),
+(5173,1,85,1,2,8,1,3,1),
+(5174,1,85,1,2,8,2,3,1),
+(5175,1,85,16,2,8,0,2,1),
+(5176,1,85,16,2,8,1,2,1),
+(5177,1,85,16,2,8,2,2,1),
+(5178,1,85,128,2,8,0,23,1),
+(5179,1,85,128,2,8,1,23,1),
+(5180,1,85,128,2,8,2,23,1),
+(5181,1,85,256,2,8,0,23,1),
+(5182,1,85,256,2,8,1,23,1),
+(5183,1,85,256,2,8,2,23,1),
+(5184,1,85,1024,2,8,0,7,1),
+(5185,1,85,1024,2,8,1,7,1),
+(5186,1,85,1024,2,8,2,7,1),
+(5187,1,85,2048,2,8,0,2,1),
+(5188,1,85,2048,2,8,1,2,1),
+(5189,1,85,2048,2,8,2,2,1),
+(5190,1,85,4096,2,8,0,2,1),
+(5191,1,85,4096,2,8,1,2,1),
+(5192,1,85,4096,2,8,2,2,1),
+(5193,1,85,8192,2,8,0,2,1),
+(5194,1,85,8192,2,8,1,2,1),
+(5195,1,85,8192,2,8,2,2,1),
+(5196,1,85,32,2,8,0,21,1),
+(5197,1,85,32,2,8,1,21,1),
+(5198,1,85,32,2,8,2,21,1),
+(5199,1,85,512,2,8,0,21,1),
+(5200,1,85,512,2,8,1,21,1),
+(5201,1,85,512,2,8,2,21,1),
+(5202,1,85,2,2,8,0,20,1),
+(5203,1,85,2,2,8,1,20,1),
+(5204,1,85,2,2,8,2,20,1),
+(5205,1,85,0,2,8,0,23,1),
+(5206,1,85,1,2,8,0,3,1),
+(5207,1,85,1,2,8,1,3,1),
+(5208,1,85,1,2,8,2,3,1),
+(5209,1,85,16,2,8,0,2,1),
+(5210,1,85,16,2,8,1,2,1),
+(5211,1,85,16,2,8,2,2,1),
+(5212,1,85,128,2,8,0,23,1),
+(5213,1,85,128,2,8,1,23,1),
+(5214,1,85,128,2,8,2,23,1),
+(5215,1,85,256,2,8,0,23,1),
+(5216,1,85,256,2,8,1,23,1),
+(5217,1,85,256,2,8,2,23,1),
+(5218,1,85,1024,2,8,0,7,1),
+(5219,1,85,1024,2,8,1,7,1),
+(5220,1,85,1024,2,8,2,7,1),
+(5221,1,85,2048,2,8,0,2,1),
+(5222,1,85,2048,2,8,1,2,1),
+(5223,1,85,2048,2,8,2,2,1),
+(5224,1,85,4096,2,8,0,2,1),
+(5225,1,85,4096,2,8,1,2,1),
+(5226,1,85,4096,2,8,2,2,1),
+(5227,1,85,8192,2,8,0,2,1),
+(5228,1,85,8192,2,8,1,2,1),
+(5229,1,85,8192,2,8,2,2,1),
+(5230,1,85,32,2,8,0,21,1),
+(5231,1,85,32,2,8,1,21,1),
+(5232,1,85,32,2,8,2,21,1),
+(5233,1,85,512,2,8,0,21,1),
+(5234,1,85,512,2,8,1,21,1),
+(5235,1,85,512,2,8,2,21,1),
+(5236,1,85,2,2,8,0,20,1),
+(5237,1,85,2,2,8,1,20,1),
+(5238,1,85,2,2,8,2,20,1),
+(5239,1,85,0,2,8,0,23,1),
+(5240,1,85,1,2,8,0,3,1),
+(5241,1,85,1,2,8,1,3,1),
+(5242,1,85,1,2,8,2,3,1),
+(5243,1,85,16,2,8,0,2,1),
+(5244,1,85,16,2,8,1,2,1),
+(5245,1,85,16,2,8,2,2,1),
+(5246,1,85,128,2,8,0,23,1),
+(5247,1,85,128,2,8,1,23,1),
+(5248,1,85,128,2,8,2,23,1),
+(5249,1,85,256,2,8,0,23,1),
+(5250,1,85,256,2,8,1,23,1),
+(5251,1,85,256,2,8,2,23,1),
+(5252,1,85,1024,2,8,0,7,1),
+(5253,1,85,1024,2,8,1,7,1),
+(5254,1,85,1024,2,8,2,7,1),
+(5255,1,85,2048,2,8,0,2,1),
+(5256,1,85,2048,2,8,1,2,1),
+(5257,1,85,2048,2,8,2,2,1),
+(5258,1,85,4096,2,8,0,2,1),
+(5259,1,85,4096,2,8,1,2,1),
+(5260,1,85,4096,2,8,2,2,1),
+(5261,1,85,8192,2,8,0,2,1),
+(5262,1,85,8192,2,8,1,2,1),
+(5263,1,85,8192,2,8,2,2,1),
+(5264,1,85,32,2,8,0,21,1),
+(5265,1,85,32,2,8,1,21,1),
+(5266,1,85,32,2,8,2,21,1),
+(5267,1,85,512,2,8,0,21,1),
+(5268,1,85,512,2,8,1,21,1),
+(5269,1,85,512,2,8,2,21,1),
+(5270,1,85,2,2,8,0,20,1),
+(5271,1,85,2,2,8,1,20,1),
+(5272,1,85,2,2,8,2,20,1),
+(5273,1,85,0,2,4,0,23,1),
+(5274,1,85,1,2,4,0,3,1),
+(5275,1,85,1,2,4,1,3,1),
+(5276,1,85,1,2,4,2,3,1),
+(5277,1,85,16,2,4,0,2,1),
+(5278,1,85,16,2,4,1,2,1),
+(5279,1,85,16,2,4,2,2,1),
+(5280,1,85,128,2,4,0,23,1),
+(5281,1,85,128,2,4,1,23,1),
+(5282,1,85,128,2,4,2,23,1),
+(5283,1,85,256,2,4,0,23,1),
+(5284,1,85,256,2,4,1,23,1),
+(5285,1,85,256,2,4,2,23,1),
+(5286,1,85,1024,2,4,0,7,1),
+(5287,1,85,1024,2,4,1,7,1),
+(5288,1,85,1024,2,4,2,7,1),
+(5289,1,85,2048,2,4,0,2,1),
+(5290,1,85,2048,2,4,1,2,1),
+(5291,1,85,2048,2,4,2,2,1),
+(5292,1,85,4096,2,4,0,2,1),
+(5293,1,85,4096,2,4,1,2,1),
+(5294,1,85,4096,2,4,2,2,1),
+(5295,1,85,8192,2,4,0,2,1),
+(5296,1,85,8192,2,4,1,2,1),
+(5297,1,85,8192,2,4,2,2,1),
+(5298,1,85,32,2,4,0,21,1),
+(5299,1,85,32,2,4,1,21,1),
+(5300,1,85,32,2,4,2,21,1),
+(5301,1,85,512,2,4,0,21,1),
+(5302,1,85,512,2,4,1,21,1),
+(5303,1,85,512,2,4,2,21,1),
+(5304,1,85,2,2,4,0,20,1),
+(5305,1,85,2,2,4,1,20,1),
+(5306,1,85,2,2,4,2,20,1),
+(5307,1,85,0,2,4,0,23,1),
+(5308,1,85,1,2,4,0,3,1),
+(5309,1,85,1,2,4,1,3,1),
+(5310,1,85,1,2,4,2,3,1),
+(5311,1,85,16,2,4,0,2,1),
+(5312,1,85,16,2,4,1,2,1),
+(5313,1,85,16,2,4,2,2,1),
+(5314,1,85,128,2,4,0,23,1),
+(5315,1,85,128,2,4,1,23,1),
+(5316,1,85,128,2,4,2,23,1),
+(5317,1,85,256,2,4,0,23,1),
+(5318,1,85,256,2,4,1,23,1),
+(5319,1,85,256,2,4,2,23,1),
+(5320,1,85,1024,2,4,0,7,1),
+(5321,1,85,1024,2,4,1,7,1),
+(5322,1,85,1024,2,4,2,7,1),
+(5323,1,85,2048,2,4,0,2,1),
+(5324,1,85,2048,2,4,1,2,1),
+(5325,1,85,2048,2,4,2,2,1),
+(5326,1,85,4096,2,4,0,2,1),
+(5327,1,85,4096,2,4,1,2,1),
+(5328,1,85,4096,2,4,2,2,1),
+(5329,1,85,8192,2,4,0,2,1),
+(5330,1,85,8192,2,4,1,2,1),
+(5331,1,85,8192,2,4,2,2,1),
+(5332,1,85,32,2,4,0,21,1),
+(5333,1,85,32,2,4,1,21,1),
+(5334,1,85,32,2,4,2,21,1),
+(5335,1,85,512,2,4,0,21,1),
+(5336,1,85,512,2,4,1,21,1),
+(5337,1,85,512,2,4,2,21,1),
+(5338,1,85,2,2,4,0,20,1),
+(5339,1,85,2,2,4,1,20,1),
+(5340,1,85,2,2,4,2,20,1),
+(5341,1,85,0,2,4,0,23,1),
+(5342,1,85,1,2,4,0,3,1),
+(5343,1,85,1,2,4,1,3,1),
+(5344,1,85,1,2,4,2,3,1),
+(5345,1,85,16,2,4,0,2,1),
+(5346,1,85,16,2,4,1,2,1),
+(5347,1,85,16,2,4,2,2,1),
+(5348,1,85,128,2,4,0,23,1),
+(5349,1,85,128,2,4,1,23,1),
+(5350,1,85,128,2,4,2,23,1),
+(5351,1,85,256,2,4,0,23,1),
+(5352,1,85,256,2,4,1,23,1),
+(5353,1,85,256,2,4,2,23,1),
+(5354,1,85,1024,2,4,0,7,1),
+(5355,1,85,1024,2,4,1,7,1),
+(5356,1,85,1024,2,4,2,7,1),
+(5357,1,85,2048,2,4,0,2,1),
+(5358,1,85,2048,2,4,1,2,1),
+(5359,1,85,2048,2,4,2,2,1),
+(5360,1,85,4096,2,4,0,2,1),
+(5361,1,85,4096,2,4,1,2,1),
+(5362,1,85,4096,2,4,2,2,1),
+(5363,1,85,8192,2,4,0,2,1),
+(5364,1,85,8192,2,4,1,2,1),
+(5365,1,85,8192,2,4,2,2,1),
+(5366,1,85,32,2,4,0,21,1),
+(5367,1,85,32,2,4,1,21,1),
+(5368,1,85,32,2,4,2,21,1),
+(5369,1,85,512,2,4,0,21,1),
+(5370,1,85,512,2,4,1,21,1),
+(5371,1,85,512,2,4,2,21,1),
+(5372,1,85,2,2,4,0,20,1),
+(5373,1,85,2,2,4,1,20,1),
+(5374,1,85,2,2,4,2,20,1),
+(5375,1,85,0,2,4,0,23,1),
+(5376,1,85,1,2,4,0,3,1),
+(5377,1,85,1,2,4,1,3,1),
+(5378,1,85,1,2,4,2,3,1),
+(5379,1,85,16,2,4,0,2,1),
+(5380,1,85,16,2,4,1,2,1),
+(5381,1,85,16,2,4,2,2,1),
+(5382,1,85,128,2,4,0,23,1),
+(5383,1,85,128,2,4,1,23,1),
+(5384,1,85,128,2,4,2,23,1),
+(5385,1,85,256,2,4,0,23,1),
+(5386,1,85,256,2,4,1,23,1),
+(5387,1,85,256,2,4,2,23,1),
+(5388,1,85,1024,2,4,0,7,1),
+(5389,1,85,1024,2,4,1,7,1),
+(5390,1,85,1024,2,4,2,7,1),
+(5391,1,85,2048,2,4,0,2,1),
+(5392,1,85,2048,2,4,1,2,1),
+(5393,1,85,2048,2,4,2,2,1),
+(5394,1,85,4096,2,4,0,2,1),
+(5395,1,85,4096,2,4,1,2,1),
+(5396,1,85,4096,2,4,2,2,1),
+(5397,1,85,8192,2,4,0,2,1),
+(5398,1,85,8192,2,4,1,2,1),
+(5399,1,85,8192,2,4,2,2,1),
+(5400,1,85,32,2,4,0,21,1),
+(5401,1,85,32,2,4,1,21,1),
+(5402,1,85,32,2,4,2,21,1),
+(5403,1,85,512,2,4,0,21,1),
+(5404,1,85,512,2,4,1,21,1),
+(5405,1,85,512,2,4,2,21,1),
+(5406,1,85,2,2,4,0,20,1),
+(5407,1,85,2,2,4,1,20,1),
+(5408,1,85,2,2,4,2,20,1),
+(5409,1,85,0,2,4,0,23,1),
+(5410,1,85,1,2,4,0,3,1),
+(5411,1,85,1,2,4,1,3,1),
+(5412,1,85,1,2,4,2,3,1),
+(5413,1,85,16,2,4,0,2,1),
+(5414,1,85,16,2,4,1,2,1),
+(5415,1,85,16,2,4,2,2,1),
+(5416,1,85,128,2,4,0,23,1),
+(5417,1,85,128,2,4,1,23,1),
+(5418,1,85,128,2,4,2,23,1),
+(5419,1,85,256,2,4,0,23,1),
+(5420,1,85,256,2,4,1,23,1),
+(5421,1,85,256,2,4,2,23,1),
+(5422,1,85,1024,2,4,0,7,1),
+(5423,1,85,1024,2,4,1,7,1),
+(5424,1,85,1024,2,4,2,7,1),
+(5425,1,85,2048,2,4,0,2,1),
+(5426,1,85,2048,2,4,1,2,1),
+(5427,1,85,2048,2,4,2,2,1),
+(5428,1,85,4096,2,4,0,2,1),
+(5429,1,85,4096,2,4,1,2,1),
+(5430,1,85,4096,2,4,2,2,1),
+(5431,1,85,8192,2,4,0,2,1),
+(5432,1,85,8192,2,4,1,2,1),
+(5433,1,85,8192,2,4,2,2,1),
+(5434,1,85,32,2,4,0,21,1),
+(5435,1,85,32,2,4,1,21,1),
+(5436,1,85,32,2,4,2,21,1),
+(5437,1,85,512,2,4,0,21,1),
+(5438,1,85,512,2,4,1,21,1),
+(5439,1,85,512,2,4,2,21,1),
+(5440,1,85,2,2,4,0,20,1),
+(5441,1,85,2,2,4,1,20,1),
+(5442,1,85,2,2,4,2,20,1),
+(5443,1,85,0,2,4,0,23,1),
+(5444,1,85,1,2,4,0,3,1),
+(5445,1,85,1,2,4,1,3,1),
+(5446,1,85,1,2,4,2,3,1),
+(5447,1,85,16,2,4,0,2,1),
+(5448,1,85,16,2,4,1,2,1),
+(5449,1,85,16,2,4,2,2,1),
+(5450,1,85,128,2,4,0,23,1),
+(5451,1,85,128,2,4,1,23,1),
+(5452,1,85,128,2,4,2,23,1),
+(5453,1,85,256,2,4,0,23,1),
+(5454,1,85,256,2,4,1,23,1),
+(5455,1,85,256,2,4,2,23,1),
+(5456,1,85,1024,2,4,0,7,1),
+(5457,1,85,1024,2,4,1,7,1),
+(5458,1,85,1024,2,4,2,7,1),
+(5459,1,85,2048,2,4,0,2,1),
+(5460,1,85,2048,2,4,1,2,1),
+(5461,1,85,2048,2,4,2,2,1),
+(5462,1,85,4096,2,4,0,2,1),
+(5463,1,85,4096,2,4,1,2,1),
+(5464,1,85,4096,2,4,2,2,1),
+(5465,1,85,8192,2,4,0,2,1),
+(5466,1,85,8192,2,4,1,2,1),
+(5467,1,85,8192,2,4,2,2,1),
+(5468,1,85,32,2,4,0,21,1),
+(5469,1,85,32,2,4,1,21,1),
+(5470,1,85,32,2,4,2,21,1),
+(5471,1,85,512,2,4,0,21,1),
+(5472,1,85,512,2,4,1,21,1),
+(5473,1,85,512,2,4,2,21,1),
+(5474,1,85,2,2,4,0,20,1),
+(5475,1,85,2,2,4,1,20,1),
+(5476,1,85,2,2,4,2,20,1),
+(5477,1,85,0,2,4,0,23,1),
+(5478,1,85,1,2,4,0,3,1),
+(5479,1,85,1,2,4,1,3,1),
+(5480,1,85,1,2,4,2,3,1),
+(5481,1,85,16,2,4,0,2,1),
+(5482,1,85,16,2,4,1,2,1),
+(5483,1,85,16,2,4,2,2,1),
+(5484,1,85,128,2,4,0,23,1),
+(5485,1,85,128,2,4,1,23,1),
+(5486,1,85,128,2,4,2,23,1),
+(5487,1,85,256,2,4,0,23,1),
+(5488,1,85,256,2,4,1,23,1),
+(5489,1,85,256,2,4,2,23,1),
+(5490,1,85,1024,2,4,0,7,1),
+(5491,1,85,1024,2,4,1,7,1),
+(5492,1,85,1024,2,4,2,7,1),
+(5493,1,85,2048,2,4,0,2,1),
+(5494,1,85,2048,2,4,1,2,1),
+(5495,1,85,2048,2,4,2,2,1),
+(5496,1,85,4096,2,4,0,2,1),
+(5497,1,85,4096,2,4,1,2,1),
+(5498,1,85,4096,2,4,2,2,1),
+(5499,1,85,8192,2,4,0,2,1),
+(5500,1,85,8192,2,4,1,2,1),
+(5501,1,85,8192,2,4,2,2,1),
+(5502,1,85,32,2,4,0,21,1),
+(5503,1,85,32,2,4,1,21,1),
+(5504,1,85,32,2,4,2,21,1),
+(5505,1,85,512,2,4,0,21,1),
+(5506,1,85,512,2,4,1,21,1),
+(5507,1,85,512,2,4,2,21,1),
+(5508,1,85,2,2,4,0,20,1),
+(5509,1,85,2,2,4,1,20,1),
+(5510,1,85,2,2,4,2,20,1),
+(5511,30,39,0,2,41459,0,7,1),
+(5512,30,39,1,2,41459,0,3,1),
+(5513,30,39,1,2,41459,1,3,1),
+(5514,30,39,1,2,41459,2,3,1),
+(5515,30,39,16,2,41459,0,2,1),
+(5516,30,39,16,2,41459,1,2,1),
+(5517,30,39,16,2,41459,2,2,1),
+(5518,30,39,128,2,41459,0,7,1),
+(5519,30,39,128,2,41459,1,7,1),
+(5520,30,39,128,2,41459,2,7,1),
+(5521,30,39,256,2,41459,0,7,1),
+(5522,30,39,256,2,41459,1,7,1),
+(5523,30,39,256,2,41459,2,7,1),
+(5524,30,39,1024,2,41459,0,7,1),
+(5525,30,39,1024,2,41459,1,7,1),
+(5526,30,39,1024,2,41459,2,7,1),
+(5527,30,39,2048,2,41459,0,2,1),
+(5528,30,39,2048,2,41459,1,2,1),
+(5529,30,39,2048,2,41459,2,2,1),
+(5530,30,39,4096,2,41459,0,2,1),
+(5531,30,39,4096,2,41459,1,2,1),
+(5532,30,39,4096,2,41459,2,2,1),
+(5533,30,39,8192,2,41459,0,2,1),
+(5534,30,39,8192,2,41459,1,2,1),
+(5535,30,39,8192,2,41459,2,2,1),
+(5536,30,39,32,2,41459,0,5,1),
+(5537,30,39,32,2,41459,1,5,1),
+(5538,30,39,32,2,41459,2,5,1),
+(5539,30,39,512,2,41459,0,5,1),
+(5540,30,39,512,2,41459,1,5,1),
+(5541,30,39,512,2,41459,2,5,1),
+(5542,30,39,2,2,41459,0,4,1),
+(5543,30,39,2,2,41459,1,4,1),
+(5544,30,39,2,2,41459,2,4,1),
+(5545,40,49,0,2,41459,0,7,1),
+(5546,40,49,1,2,41459,0,3,1),
+(5547,40,49,1,2,41459,1,3,1),
+(5548,40,49,1,2,41459,2,3,1),
+(5549,40,49,16,2,41459,0,2,1),
+(5550,40,49,16,2,41459,1,2,1),
+(5551,40,49,16,2,41459,2,2,1),
+(5552,40,49,128,2,41459,0,7,1),
+(5553,40,49,128,2,41459,1,7,1),
+(5554,40,49,128,2,41459,2,7,1),
+(5555,40,49,256,2,41459,0,7,1),
+(5556,40,49,256,2,41459,1,7,1),
+(5557,40,49,256,2,41459,2,7,1),
+(5558,40,49,1024,2,41459,0,7,1),
+(5559,40,49,1024,2,41459,1,7,1),
+(5560,40,49,1024,2,41459,2,7,1),
+(5561,40,49,2048,2,41459,0,2,1),
+(5562,40,49,2048,2,41459,1,2,1),
+(5563,40,49,2048,2,41459,2,2,1),
+(5564,40,49,4096,2,41459,0,2,1),
+(5565,40,49,4096,2,41459,1,2,1),
+(5566,40,49,4096,2,41459,2,2,1),
+(5567,40,49,8192,2,41459,0,2,1),
+(5568,40,49,8192,2,41459,1,2,1),
+(5569,40,49,8192,2,41459,2,2,1),
+(5570,40,49,32,2,41459,0,5,1),
+(5571,40,49,32,2,41459,1,5,1),
+(5572,40,49,32,2,41459,2,5,1),
+(5573,40,49,512,2,41459,0,5,1),
+(5574,40,49,512,2,41459,1,5,1),
+(5575,40,49,512,2,41459,2,5,1),
+(5576,40,49,2,2,41459,0,4,1),
+(5577,40,49,2,2,41459,1,4,1),
+(5578,40,49,2,2,41459,2,4,1),
+(5579,1,12,0,2,41459,0,7,1),
+(5580,1,12,1,2,41459,0,3,1),
+(5581,1,12,1,2,41459,1,3,1),
+(5582,1,12,1,2,41459,2,3,1),
+(5583,1,12,16,2,41459,0,2,1),
+(5584,1,12,16,2,41459,1,2,1),
+(5585,1,12,16,2,41459,2,2,1),
+(5586,1,12,128,2,41459,0,7,1),
+(5587,1,12,128,2,41459,1,7,1),
+(5588,1,12,128,2,41459,2,7,1),
+(5589,1,12,256,2,41459,0,7,1),
+(5590,1,12,256,2,41459,1,7,1),
+(5591,1,12,256,2,41459,2,7,1),
+(5592,1,12,1024,2,41459,0,7,1),
+(5593,1,12,1024,2,41459,1,7,1),
+(5594,1,12,1024,2,41459,2,7,1),
+(5595,1,12,2048,2,41459,0,2,1),
+(5596,1,12,2048,2,41459,1,2,1),
+(5597,1,12,2048,2,41459,2,2,1),
+(5598,1,12,4096,2,41459,0,2,1),
+(5599,1,12,4096,2,41459,1,2,1),
+(5600,1,12,4096,2,41459,2,2,1),
+(5601,1,12,8192,2,41459,0,2,1),
+(5602,1,12,8192,2,41459,1,2,1),
+(5603,1,12,8192,2,41459,2,2,1),
+(5604,1,12,32,2,41459,0,5,1),
+(5605,1,12,32,2,41459,1,5,1),
+(5606,1,12,32,2,41459,2,5,1),
+(5607,1,12,512,2,41459,0,5,1),
+(5608,1,12,512,2,41459,1,5,1),
+(5609,1,12,512,2,41459,2,5,1),
+(5610,1,12,2,2,41459,0,4,1),
+(5611,1,12,2,2,41459,1,4,1),
+(5612,1,12,2,2,41459,2,4,1),
+(5613,7,16,0,2,41459,0,7,1),
+(5614,7,16,1,2,41459,0,3,1),
+(5615,7,16,1,2,41459,1,3,1),
+(5616,7,16,1,2,41459,2,3,1),
+(5617,7,16,16,2,41459,0,2,1),
+(5618,7,16,16,2,41459,1,2,1),
+(5619,7,16,16,2,41459,2,2,1),
+(5620,7,16,128,2,41459,0,7,1),
+(5621,7,16,128,2,41459,1,7,1),
+(5622,7,16,128,2,41459,2,7,1),
+(5623,7,16,256,2,41459,0,7,1),
+(5624,7,16,256,2,41459,1,7,1),
+(5625,7,16,256,2,41459,2,7,1),
+(5626,7,16,1024,2,41459,0,7,1),
+(5627,7,16,1024,2,41459,1,7,1),
+(5628,7,16,1024,2,41459,2,7,1),
+(5629,7,16,2048,2,41459,0,2,1),
+(5630,7,16,2048,2,41459,1,2,1),
+(5631,7,16,2048,2,41459,2,2,1),
+(5632,7,16,4096,2,41459,0,2,1),
+(5633,7,16,4096,2,41459,1,2,1),
+(5634,7,16,4096,2,41459,2,2,1),
+(5635,7,16,8192,2,41459,0,2,1),
+(5636,7,16,8192,2,41459,1,2,1),
+(5637,7,16,8192,2,41459,2,2,1),
+(5638,7,16,32,2,41459,0,5,1),
+(5639,7,16,32,2,41459,1,5,1),
+(5640,7,16,32,2,41459,2,5,1),
+(5641,7,16,512,2,41459,0,5,1),
+(5642,7,16,512,2,41459,1,5,1),
+(5643,7,16,512,2,41459,2,5,1),
+(5644,7,16,2,2,41459,0,4,1),
+(5645,7,16,2,2,41459,1,4,1),
+(5646,7,16,2,2,41459,2,4,1),
+(5647,10,25,0,2,41459,0,7,1),
+(5648,10,25,1,2,41459,0,3,1),
+(5649,10,25,1,2,41459,1,3,1),
+(5650,10,25,1,2,41459,2,3,1),
+(5651,10,25,16,2,41459,0,2,1),
+(5652,10,25,16,2,41459,1,2,1),
+(5653,10,25,16,2,41459,2,2,1),
+(5654,10,25,128,2,41459,0,7,1),
+(5655,10,25,128,2,41459,1,7,1),
+(5656,10,25,128,2,41459,2,7,1),
+(5657,10,25,256,2,41459,0,7,1),
+(5658,10,25,256,2,41459,1,7,1),
+(5659,10,25,256,2,41459,2,7,1),
+(5660,10,25,1024,2,41459,0,7,1),
+(5661,10,25,1024,2,41459,1,7,1),
+(5662,10,25,1024,2,41459,2,7,1),
+(5663,10,25,2048,2,41459,0,2,1),
+(5664,10,25,2048,2,41459,1,2,1),
+(5665,10,25,2048,2,41459,2,2,1),
+(5666,10,25,4096,2,41459,0,2,1),
+(5667,10,25,4096,2,41459,1,2,1),
+(5668,10,25,4096,2,41459,2,2,1),
+(5669,10,25,8192,2,41459,0,2,1),
+(5670,10,25,8192,2,41459,1,2,1),
+(5671,10,25,8192,2,41459,2,2,1),
+(5672,10,25,32,2,41459,0,5,1),
+(5673,10,25,32,2,41459,1,5,1),
+(5674,10,25,32,2,41459,2,5,1),
+(5675,10,25,512,2,41459,0,5,1),
+(5676,10,25,512,2,41459,1,5,1),
+(5677,10,25,512,2,41459,2,5,1),
+(5678,10,25,2,2,41459,0,4,1),
+(5679,10,25,2,2,41459,1,4,1),
+(5680,10,25,2,2,41459,2,4,1),
+(5681,20,35,0,2,41459,0,7,1),
+(5682,20,35,1,2,41459,0,3,1),
+(5683,20,35,1,2,41459,1,3,1),
+(5684,20,35,1,2,41459,2,3,1),
+(5685,20,35,16,2,41459,0,2,1),
+(5686,20,35,16,2,41459,1,2,1),
+(5687,20,35,16,2,41459,2,2,1),
+(5688,20,35,128,2,41459,0,7,1),
+(5689,20,35,128,2,41459,1,7,1),
+(5690,20,35,128,2,41459,2,7,1),
+(5691,20,35,256,2,41459,0,7,1),
+(5692,20,35,256,2,41459,1,7,1),
+(5693,20,35,256,2,41459,2,7,1),
+(5694,20,35,1024,2,41459,0,7,1),
+(5695,20,35,1024,2,41459,1,7,1),
+(5696,20,35,1024,2,41459,2,7,1),
+(5697,20,35,2048,2,41459,0,2,1),
+(5698,20,35,2048,2,41459,1,2,1),
+(5699,20,35,2048,2,41459,2,2,1),
+(5700,20,35,4096,2,41459,0,2,1),
+(5701,20,35,4096,2,41459,1,2,1),
+(5702,20,35,4096,2,41459,2,2,1),
+(5703,20,35,8192,2,41459,0,2,1),
+(5704,20,35,8192,2,41459,1,2,1),
+(5705,20,35,8192,2,41459,2,2,1),
+(5706,20,35,32,2,41459,0,5,1),
+(5707,20,35,32,2,41459,1,5,1),
+(5708,20,35,32,2,41459,2,5,1),
+(5709,20,35,512,2,41459,0,5,1),
+(5710,20,35,512,2,41459,1,5,1),
+(5711,20,35,512,2,41459,2,5,1),
+(5712,20,35,2,2,41459,0,4,1),
+(5713,20,35,2,2,41459,1,4,1),
+(5714,20,35,2,2,41459,2,4,1),
+(5715,30,45,0,2,41459,0,7,1),
+(5716,30,45,1,2,41459,0,3,1),
+(5717,30,45,1,2,41459,1,3,1),
+(5718,30,45,1,2,41459,2,3,1),
+(5719,30,45,16,2,41459,0,2,1),
+(5720,30,45,16,2,41459,1,2,1),
+(5721,30,45,16,2,41459,2,2,1),
+(5722,30,45,128,2,41459,0,7,1),
+(5723,30,45,128,2,41459,1,7,1),
+(5724,30,45,128,2,41459,2,7,1),
+(5725,30,45,256,2,41459,0,7,1),
+(5726,30,45,256,2,41459,1,7,1),
+(5727,30,45,256,2,41459,2,7,1),
+(5728,30,45,1024,2,41459,0,7,1),
+(5729,30,45,1024,2,41459,1,7,1),
+(5730,30,45,1024,2,41459,2,7,1),
+(5731,30,45,2048,2,41459,0,2,1),
+(5732,30,45,2048,2,41459,1,2,1),
+(5733,30,45,2048,2,41459,2,2,1),
+(5734,30,45,4096,2,41459,0,2,1),
+(5735,30,45,4096,2,41459,1,2,1),
+(5736,30,45,4096,2,41459,2,2,1),
+(5737,30,45,8192,2,41459,0,2,1),
+(5738,30,45,8192,2,41459,1,2,1),
+(5739,30,45,8192,2,41459,2,2,1),
+(5740,30,45,32,2,41459,0,5,1),
+(5741,30,45,32,2,41459,1,5,1),
+(5742,30,45,32,2,41459,2,5,1),
+(5743,30,45,512,2,41459,0,5,1),
+(5744,30,45,512,2,41459,1,5,1),
+(5745,30,45,512,2,41459,2,5,1),
+(5746,30,45,2,2,41459,0,4,1),
+(5747,30,45,2,2,41459,1,4,1),
+(5748,30,45,2,2,41459,2,4,1),
+(5749,40,55,0,2,41459,0,7,1),
+(5750,40,55,1,2,41459,0,3,1),
+(5751,40,55,1,2,41459,1,3,1),
+(5752,40,55,1,2,41459,2,3,1),
+(5753,40,55,16,2,41459,0,2,1),
+(5754,40,55,16,2,41459,1,2,1),
+(5755,40,55,16,2,41459,2,2,1),
+(5756,40,55,128,2,41459,0,7,1),
+(5757,40,55,128,2,41459,1,7,1),
+(5758,40,55,128,2,41459,2,7,1),
+(5759,40,55,256,2,41459,0,7,1),
+(5760,40,55,256,2,41459,1,7,1),
+(5761,40,55,256,2,41459,2,7,1),
+(5762,40,55,1024,2,41459,0,7,1),
+(5763,40,55,1024,2,41459,1,7,1),
+(5764,40,55,1024,2,41459,2,7,1),
+(5765,40,55,2048,2,41459,0,2,1),
+(5766,40,55,2048,2,41459,1,2,1),
+(5767,40,55,2048,2,41459,2,2,1),
+(5768,40,55,4096,2,41459,0,2,1),
+(5769,40,55,4096,2,41459,1,2,1),
+(5770,40,55,4096,2,41459,2,2,1),
+(5771,40,55,8192,2,41459,0,2,1),
+(5772,40,55,8192,2,41459,1,2,1),
+(5773,40,55,8192,2,41459,2,2,1),
+(5774,40,55,32,2,41459,0,5,1),
+(5775,40,55,32,2,41459,1,5,1),
+(5776,40,55,32,2,41459,2,5,1),
+(5777,40,55,512,2,41459,0,5,1),
+(5778,40,55,512,2,41459,1,5,1),
+(5779,40,55,512,2,41459,2,5,1),
+(5780,40,55,2,2,41459,0,4,1),
+(5781,40,55,2,2,41459,1,4,1),
+(5782,40,55,2,2,41459,2,4,1),
+(5783,50,65,0,2,41459,0,7,1),
+(5784,50,65,1,2,41459,0,3,1),
+(5785,50,65,1,2,41459,1,3,1),
+(5786,50,65,1,2,41459,2,3,1),
+(5787,50,65,16,2,41459,0,2,1),
+(5788,50,65,16,2,41459,1,2,1),
+(5789,50,65,16,2,41459,2,2,1),
+(5790,50,65,128,2,41459,0,7,1),
+(5791,50,65,128,2,41459,1,7,1),
+(5792,50,65,128,2,41459,2,7,1),
+(5793,50,65,256,2,41459,0,7,1),
+(5794,50,65,256,2,41459,1,7,1),
+(5795,50,65,256,2,41459,2,7,1),
+(5796,50,65,1024,2,41459,0,7,1),
+(5797,50,65,1024,2,41459,1,7,1),
+(5798,50,65,1024,2,41459,2,7,1),
+(5799,50,65,2048,2,41459,0,2,1),
+(5800,50,65,2048,2,41459,1,2,1),
+(5801,50,65,2048,2,41459,2,2,1),
+(5802,50,65,4096,2,41459,0,2,1),
+(5803,50,65,4096,2,41459,1,2,1),
+(5804,50,65,4096,2,41459,2,2,1),
+(5805,50,65,8192,2,41459,0,2,1),
+(5806,50,65,8192,2,41459,1,2,1),
+(5807,50,65,8192,2,41459,2,2,1),
+(5808,50,65,32,2,41459,0,5,1),
+(5809,50,65,32,2,41459,1,5,1),
+(5810,50,65,32,2,41459,2,5,1),
+(5811,50,65,512,2,41459,0,5,1),
+(5812,50,65,512,2,41459,1,5,1),
+(5813,50,65,512,2,41459,2,5,1),
+(5814,50,65,2,2,41459,0,4,1),
+(5815,50,65,2,2,41459,1,4,1),
+(5816,50,65,2,2,41459,2,4,1),
+(5817,20,27,0,2,41459,0,7,1),
+(5818,20,27,1,2,41459,0,3,1),
+(5819,20,27,1,2,41459,1,3,1),
+(5820,20,27,1,2,41459,2,3,1),
+(5821,20,27,16,2,41459,0,2,1),
+(5822,20,27,16,2,41459,1,2,1),
+(5823,20,27,16,2,41459,2,2,1),
+(5824,20,27,128,2,41459,0,7,1),
+(5825,20,27,128,2,41459,1,7,1),
+(5826,20,27,128,2,41459,2,7,1),
+(5827,20,27,256,2,41459,0,7,1),
+(5828,20,27,256,2,41459,1,7,1),
+(5829,20,27,256,2,41459,2,7,1),
+(5830,20,27,1024,2,41459,0,7,1),
+(5831,20,27,1024,2,41459,1,7,1),
+(5832,20,27,1024,2,41459,2,7,1),
+(5833,20,27,2048,2,41459,0,2,1),
+(5834,20,27,2048,2,41459,1,2,1),
+(5835,20,27,2048,2,41459,2,2,1),
+(5836,20,27,4096,2,41459,0,2,1),
+(5837,20,27,4096,2,41459,1,2,1),
+(5838,20,27,4096,2,41459,2,2,1),
+(5839,20,27,8192,2,41459,0,2,1),
+(5840,20,27,8192,2,41459,1,2,1),
+(5841,20,27,8192,2,41459,2,2,1),
+(5842,20,27,32,2,41459,0,5,1),
+(5843,20,27,32,2,41459,1,5,1),
+(5844,20,27,32,2,41459,2,5,1),
+(5845,20,27,512,2,41459,0,5,1),
+(5846,20,27,512,2,41459,1,5,1),
+(5847,20,27,512,2,41459,2,5,1),
+(5848,20,27,2,2,41459,0,4,1),
+(5849,20,27,2,2,41459,1,4,1),
+(5850,20,27,2,2,41459,2,4,1),
+(5851,28,35,0,2,41459,0,7,1),
+(5852,28,35,1,2,41459,0,3,1),
+(5853,28,35,1,2,41459,1,3,1),
+(5854,28,35,1,2,41459,2,3,1),
+(5855,28,35,16,2,41459,0,2,1),
+(5856,28,35,16,2,41459,1,2,1),
+(5857,28,35,16,2,41459,2,2,1),
+(5858,28,35,128,2,41459,0,7,1),
+(5859,28,35,128,2,41459,1,7,1),
+(5860,28,35,128,2,41459,2,7,1),
+(5861,28,35,256,2,41459,0,7,1),
+(5862,28,35,256,2,41459,1,7,1),
+(5863,28,35,256,2,41459,2,7,1),
+(5864,28,35,1024,2,41459,0,7,1),
+(5865,28,35,1024,2,41459,1,7,1),
+(5866,28,35,1024,2,41459,2,7,1),
+(5867,28,35,2048,2,41459,0,2,1),
+(5868,28,35,2048,2,41459,1,2,1),
+(5869,28,35,2048,2,41459,2,2,1),
+(5870,28,35,4096,2,41459,0,2,1),
+(5871,28,35,4096,2,41459,1,2,1),
+(5872,28,35,4096,2,41459,2,2,1),
+(5873,28,35,8192,2,41459,0,2,1),
+(5874,28,35,8192,2,41459,1,2,1),
+(5875,28,35,8192,2,41459,2,2,1),
+(5876,28,35,32,2,41459,0,5,1),
+(5877,28,35,32,2,41459,1,5,1),
+(5878,28,35,32,2,41459,2,5,1),
+(5879,28,35,512,2,41459,0,5,1),
+(5880,28,35,512,2,41459,1,5,1),
+(5881,28,35,512,2,41459,2,5,1),
+(5882,28,35,2,2,41459,0,4,1),
+(5883,28,35,2,2,41459,1,4,1),
+(5884,28,35,2,2,41459,2,4,1),
+(5885,36,43,0,2,41459,0,7,1),
+(5886,36,43,1,2,41459,0,3,1),
+(5887,36,43,1,2,41459,1,3,1),
+(5888,36,43,1,2,41459,2,3,1),
+(5889,36,43,16,2,41459,0,2,1),
+(5890,36,43,16,2,41459,1,2,1),
+(5891,36,43,16,2,41459,2,2,1),
+(5892,36,43,128,2,41459,0,7,1),
+(5893,36,43,128,2,41459,1,7,1),
+(5894,36,43,128,2,41459,2,7,1),
+(5895,36,43,256,2,41459,0,7,1),
+(5896,36,43,256,2,41459,1,7,1),
+(5897,36,43,256,2,41459,2,7,1),
+(5898,36,43,1024,2,41459,0,7,1),
+(5899,36,43,1024,2,41459,1,7,1),
+(5900,36,43,1024,2,41459,2,7,1),
+(5901,36,43,2048,2,41459,0,2,1),
+(5902,36,43,2048,2,41459,1,2,1),
+(5903,36,43,2048,2,41459,2,2,1),
+(5904,36,43,4096,2,41459,0,2,1),
+(5905,36,43,4096,2,41459,1,2,1),
+(5906,36,43,4096,2,41459,2,2,1),
+(5907,36,43,8192,2,41459,0,2,1),
+(5908,36,43,8192,2,41459,1,2,1),
+(5909,36,43,8192,2,41459,2,2,1),
+(5910,36,43,32,2,41459,0,5,1),
+(5911,36,43,32,2,41459,1,5,1),
+(5912,36,43,32,2,41459,2,5,1),
+(5913,36,43,512,2,41459,0,5,1),
+(5914,36,43,512,2,41459,1,5,1),
+(5915,36,43,512,2,41459,2,5,1),
+(5916,36,43,2,2,41459,0,4,1),
+(5917,36,43,2,2,41459,1,4,1),
+(5918,36,43,2,2,41459,2,4,1),
+(5919,25,34,0,2,164291,0,7,1),
+(5920,25,34,1,2,164291,0,3,1),
+(5921,25,34,1,2,164291,1,3,1),
+(5922,25,34,1,2,164291,2,3,1),
+(5923,25,34,16,2,164291,0,2,1),
+(5924,25,34,16,2,164291,1,2,1),
+(5925,25,34,16,2,164291,2,2,1),
+(5926,25,34,128,2,164291,0,7,1),
+(5927,25,34,128,2,164291,1,7,1),
+(5928,25,34,128,2,164291,2,7,1),
+(5929,25,34,256,2,164291,0,7,1),
+(5930,25,34,256,2,164291,1,7,1),
+(5931,25,34,256,2,164291,2,7,1),
+(5932,25,34,1024,2,164291,0,7,1),
+(5933,25,34,1024,2,164291,1,7,1),
+(5934,25,34,1024,2,164291,2,7,1),
+(5935,25,34,2048,2,164291,0,2,1),
+(5936,25,34,2048,2,164291,1,2,1),
+(5937,25,34,2048,2,164291,2,2,1),
+(5938,25,34,4096,2,164291,0,2,1),
+(5939,25,34,4096,2,164291,1,2,1),
+(5940,25,34,4096,2,164291,2,2,1),
+(5941,25,34,8192,2,164291,0,2,1),
+(5942,25,34,8192,2,164291,1,2,1),
+(5943,25,34,8192,2,164291,2,2,1),
+(5944,25,34,32,2,164291,0,5,1),
+(5945,25,34,32,2,164291,1,5,1),
+(5946,25,34,32,2,164291,2,5,1),
+(5947,25,34,512,2,164291,0,5,1),
+(5948,25,34,512,2,164291,1,5,1),
+(5949,25,34,512,2,164291,2,5,1),
+(5950,25,34,2,2,164291,0,4,1),
+(5951,25,34,2,2,164291,1,4,1),
+(5952,25,34,2,2,164291,2,4,1),
+(5953,25,34,0,2,9264,0,7,1),
+(5954,25,34,1,2,9264,0,3,1),
+(5955,25,34,1,2,9264,1,3,1),
+(5956,25,34,1,2,9264,2,3,1),
+(5957,25,34,16,2,9264,0,2,1),
+(5958,25,34,16,2,9264,1,2,1),
+(5959,25,34,16,2,9264,2,2,1),
+(5960,25,34,128,2,9264,0,7,1),
+(5961,25,34,128,2,9264,1,7,1),
+(5962,25,34,128,2,9264,2,7,1),
+(5963,25,34,256,2,9264,0,7,1),
+(5964,25,34,256,2,9264,1,7,1),
+(5965,25,34,256,2,9264,2,7,1),
+(5966,25,34,1024,2,9264,0,7,1),
+(5967,25,34,1024,2,9264,1,7,1),
+(5968,25,34,1024,2,9264,2,7,1),
+(5969,25,34,2048,2,9264,0,2,1),
+(5970,25,34,2048,2,9264,1,2,1),
+(5971,25,34,2048,2,9264,2,2,1),
+(5972,25,34,4096,2,9264,0,2,1),
+(5973,25,34,4096,2,9264,1,2,1),
+(5974,25,34,4096,2,9264,2,2,1),
+(5975,25,34,8192,2,9264,0,2,1),
+(5976,25,34,8192,2,9264,1,2,1),
+(5977,25,34,8192,2,9264,2,2,1),
+(5978,25,34,32,2,9264,0,5,1),
+(5979,25,34,32,2,9264,1,5,1),
+(5980,25,34,32,2,9264,2,5,1),
+(5981,25,34,512,2,9264,0,5,1),
+(5982,25,34,512,2,9264,1,5,1),
+(5983,25,34,512,2,9264,2,5,1),
+(5984,25,34,2,2,9264,0,4,1),
+(5985,25,34,2,2,9264,1,4,1),
+(5986,25,34,2,2,9264,2,4,1),
+(5987,36,45,0,2,41459,0,39,1),
+(5988,36,45,1,2,41459,0,3,1),
+(5989,36,45,1,2,41459,1,3,1),
+(5990,36,45,1,2,41459,2,3,1),
+(5991,36,45,16,2,41459,0,2,1),
+(5992,36,45,16,2,41459,1,2,1),
+(5993,36,45,16,2,41459,2,2,1),
+(5994,36,45,128,2,41459,0,39,1),
+(5995,36,45,128,2,41459,1,39,1),
+(5996,36,45,128,2,41459,2,39,1),
+(5997,36,45,256,2,41459,0,39,1),
+(5998,36,45,256,2,41459,1,39,1),
+(5999,36,45,256,2,41459,2,39,1),
+(6000,36,45,1024,2,41459,0,7,1),
+(6001,36,45,1024,2,41459,1,7,1),
+(6002,36,45,1024,2,41459,2,7,1),
+(6003,36,45,2048,2,41459,0,2,1),
+(6004,36,45,2048,2,41459,1,2,1),
+(6005,36,45,2048,2,41459,2,2,1),
+(6006,36,45,4096,2,41459,0,2,1),
+(6007,36,45,4096,2,41459,1,2,1),
+(6008,36,45,4096,2,41459,2,2,1),
+(6009,36,45,8192,2,41459,0,2,1),
+(6010,36,45,8192,2,41459,1,2,1),
+(6011,36,45,8192,2,41459,2,2,1),
+(6012,36,45,32,2,41459,0,5,1),
+(6013,36,45,32,2,41459,1,5,1),
+(6014,36,45,32,2,41459,2,5,1),
+(6015,36,45,512,2,41459,0,37,1),
+(6016,36,45,512,2,41459,1,37,1),
+(6017,36,45,512,2,41459,2,37,1),
+(6018,36,45,2,2,41459,0,4,1),
+(6019,36,45,2,2,41459,1,4,1),
+(6020,36,45,2,2,41459,2,4,1),
+(6021,36,45,4,2,41459,0,32,1),
+(6022,36,45,4,2,41459,1,32,1),
+(6023,36,45,4,2,41459,2,32,1),
+(6024,36,45,8,2,41459,0,32,1),
+(6025,36,45,8,2,41459,1,32,1),
+(6026,36,45,8,2,41459,2,32,1),
+(6027,36,45,64,2,41459,0,32,1),
+(6028,36,45,64,2,41459,1,32,1),
+(6029,36,45,64,2,41459,2,32,1),
+(6030,38,47,0,2,41459,0,7,1),
+(6031,38,47,1,2,41459,0,3,1),
+(6032,38,47,1,2,41459,1,3,1),
+(6033,38,47,1,2,41459,2,3,1),
+(6034,38,47,16,2,41459,0,2,1),
+(6035,38,47,16,2,41459,1,2,1),
+(6036,38,47,16,2,41459,2,2,1),
+(6037,38,47,128,2,41459,0,7,1),
+(6038,38,47,128,2,41459,1,7,1),
+(6039,38,47,128,2,41459,2,7,1),
+(6040,38,47,256,2,41459,0,7,1),
+(6041,38,47,256,2,41459,1,7,1),
+(6042,38,47,256,2,41459,2,7,1),
+(6043,38,47,1024,2,41459,0,7,1),
+(6044,38,47,1024,2,41459,1,7,1),
+(6045,38,47,1024,2,41459,2,7,1),
+(6046,38,47,2048,2,41459,0,2,1),
+(6047,38,47,2048,2,41459,1,2,1),
+(6048,38,47,2048,2,41459,2,2,1),
+(6049,38,47,4096,2,41459,0,2,1),
+(6050,38,47,4096,2,41459,1,2,1),
+(6051,38,47,4096,2,41459,2,2,1),
+(6052,38,47,8192,2,41459,0,2,1),
+(6053,38,47,8192,2,41459,1,2,1),
+(6054,38,47,8192,2,41459,2,2,1),
+(6055,38,47,32,2,41459,0,5,1),
+(6056,38,47,32,2,41459,1,5,1),
+(6057,38,47,32,2,41459,2,5,1),
+(6058,38,47,512,2,41459,0,5,1),
+(6059,38,47,512,2,41459,1,5,1),
+(6060,38,47,512,2,41459,2,5,1),
+(6061,38,47,2,2,41459,0,4,1),
+(6062,38,47,2,2,41459,1,4,1),
+(6063,38,47,2,2,41459,2,4,1),
+(6064,50,59,0,2,41459,0,7,1),
+(6065,50,59,1,2,41459,0,3,1),
+(6066,50,59,1,2,41459,1,3,1),
+(6067,50,59,1,2,41459,2,3,1),
+(6068,50,59,16,2,41459,0,2,1),
+(6069,50,59,16,2,41459,1,2,1),
+(6070,50,59,16,2,41459,2,2,1),
+(6071,50,59,128,2,41459,0,7,1),
+(6072,50,59,128,2,41459,1,7,1),
+(6073,50,59,128,2,41459,2,7,1),
+(6074,50,59,256,2,41459,0,7,1),
+(6075,50,59,256,2,41459,1,7,1),
+(6076,50,59,256,2,41459,2,7,1),
+(6077,50,59,1024,2,41459,0,7,1),
+(6078,50,59,1024,2,41459,1,7,1),
+(6079,50,59,1024,2,41459,2,7,1),
+(6080,50,59,2048,2,41459,0,2,1),
+(6081,50,59,2048,2,41459,1,2,1),
+(6082,50,59,2048,2,41459,2,2,1),
+(6083,50,59,4096,2,41459,0,2,1),
+(6084,50,59,4096,2,41459,1,2,1),
+(6085,50,59,4096,2,41459,2,2,1),
+(6086,50,59,8192,2,41459,0,2,1),
+(6087,50,59,8192,2,41459,1,2,1),
+(6088,50,59,8192,2,41459,2,2,1),
+(6089,50,59,32,2,41459,0,5,1),
+(6090,50,59,32,2,41459,1,5,1),
+(6091,50,59,32,2,41459,2,5,1),
+(6092,50,59,512,2,41459,0,5,1),
+(6093,50,59,512,2,41459,1,5,1),
+(6094,50,59,512,2,41459,2,5,1),
+(6095,50,59,2,2,41459,0,4,1),
+(6096,50,59,2,2,41459,1,4,1),
+(6097,50,59,2,2,41459,2,4,1),
+(6098,44,51,0,2,41459,0,7,1),
+(6099,44,51,1,2,41459,0,3,1),
+(6100,44,51,1,2,41459,1,3,1),
+(6101,44,51,1,2,41459,2,3,1),
+(6102,44,51,16,2,41459,0,2,1),
+(6103,44,51,16,2,41459,1,2,1),
+(6104,44,51,16,2,41459,2,2,1),
+(6105,44,51,128,2,41459,0,7,1),
+(6106,44,51,128,2,41459,1,7,1),
+(6107,44,51,128,2,41459,2,7,1),
+(6108,44,51,256,2,41459,0,7,1),
+(6109,44,51,256,2,41459,1,7,1),
+(6110,44,51,256,2,41459,2,7,1),
+(6111,44,51,1024,2,41459,0,7,1),
+(6112,44,51,1024,2,41459,1,7,1),
+(6113,44,51,1024,2,41459,2,7,1),
+(6114,44,51,2048,2,41459,0,2,1),
+(6115,44,51,2048,2,41459,1,2,1),
+(6116,44,51,2048,2,41459,2,2,1),
+(6117,44,51,4096,2,41459,0,2,1),
+(6118,44,51,4096,2,41459,1,2,1),
+(6119,44,51,4096,2,41459,2,2,1),
+(6120,44,51,8192,2,41459,0,2,1),
+(6121,44,51,8192,2,41459,1,2,1),
+(6122,44,51,8192,2,41459,2,2,1),
+(6123,44,51,32,2,41459,0,5,1),
+(6124,44,51,32,2,41459,1,5,1),
+(6125,44,51,32,2,41459,2,5,1),
+(6126,44,51,512,2,41459,0,5,1),
+(6127,44,51,512,2,41459,1,5,1),
+(6128,44,51,512,2,41459,2,5,1),
+(6129,44,51,2,2,41459,0,4,1),
+(6130,44,51,2,2,41459,1,4,1),
+(6131,44,51,2,2,41459,2,4,1),
+(6132,52,59,0,2,41459,0,7,1),
+(6133,52,59,1,2,41459,0,3,1),
+(6134,52,59,1,2,41459,1,3,1),
+(6135,52,59,1,2,41459,2,3,1),
+(6136,52,59,16,2,41459,0,2,1),
+(6137,52,59,16,2,41459,1,2,1),
+(6138,52,59,16,2,41459,2,2,1),
+(6139,52,59,128,2,41459,0,7,1),
+(6140,52,59,128,2,41459,1,7,1),
+(6141,52,59,128,2,41459,2,7,1),
+(6142,52,59,256,2,41459,0,7,1),
+(6143,52,59,256,2,41459,1,7,1),
+(6144,52,59,256,2,41459,2,7,1),
+(6145,52,59,1024,2,41459,0,7,1),
+(6146,52,59,1024,2,41459,1,7,1),
+(6147,52,59,1024,2,41459,2,7,1),
+(6148,52,59,2048,2,41459,0,2,1),
+(6149,52,59,2048,2,41459,1,2,1),
+(6150,52,59,2048,2,41459,2,2,1),
+(6151,52,59,4096,2,41459,0,2,1),
+(6152,52,59,4096,2,41459,1,2,1),
+(6153,52,59,4096,2,41459,2,2,1),
+(6154,52,59,8192,2,41459,0,2,1),
+(6155,52,59,8192,2,41459,1,2,1),
+(6156,52,59,8192,2,41459,2,2,1),
+(6157,52,59,32,2,41459,0,5,1),
+(6158,52,59,32,2,41459,1,5,1),
+(6159,52,59,32,2,41459,2,5,1),
+(6160,52,59,512,2,41459,0,5,1),
+(6161,52,59,512,2,41459,1,5,1),
+(6162,52,59,512,2,41459,2,5,1),
+(6163,52,59,2,2,41459,0,4,1),
+(6164,52,59,2,2,41459,1,4,1),
+(6165,52,59,2,2,41459,2,4,1),
+(6166,60,67,0,2,41459,0,7,1),
+(6167,60,67,1,2,41459,0,3,1),
+(6168,60,67,1,2,41459,1,3,1),
+(6169,60,67,1,2,41459,2,3,1),
+(6170,60,67,16,2,41459,0,2,1),
+(6171,60,67,16,2,41459,1,2,1),
+(6172,60,67,16,2,41459,2,2,1),
+(6173,60,67,128,2,41459,0,7,1),
+(6174,60,67,128,2,41459,1,7,1),
+(6175,60,67,128,2,41459,2,7,1),
+(6176,60,67,256,2,41459,0,7,1),
+(6177,60,67,256,2,41459,1,7,1),
+(6178,60,67,256,2,41459,2,7,1),
+(6179,60,67,1024,2,41459,0,7,1),
+(6180,60,67,1024,2,41459,1,7,1),
+(6181,60,67,1024,2,41459,2,7,1),
+(6182,60,67,2048,2,41459,0,2,1),
+(6183,60,67,2048,2,41459,1,2,1),
+(6184,60,67,2048,2,41459,2,2,1),
+(6185,60,67,4096,2,41459,0,2,1),
+(6186,60,67,4096,2,41459,1,2,1),
+(6187,60,67,4096,2,41459,2,2,1),
+(6188,60,67,8192,2,41459,0,2,1),
+(6189,60,67,8192,2,41459,1,2,1),
+(6190,60,67,8192,2,41459,2,2,1),
+(6191,60,67,32,2,41459,0,5,1),
+(6192,60,67,32,2,41459,1,5,1),
+(6193,60,67,32,2,41459,2,5,1),
+(6194,60,67,512,2,41459,0,5,1),
+(6195,60,67,512,2,41459,1,5,1),
+(6196,60,67,512,2,41459,2,5,1),
+(6197,60,67,2,2,41459,0,4,1),
+(6198,60,67,2,2,41459,1,4,1),
+(6199,60,67,2,2,41459,2,4,1),
+(6200,46,53,0,2,41459,0,7,1),
+(6201,46,53,1,2,41459,0,3,1),
+(6202,46,53,1,2,41459,1,3,1),
+(6203,46,53,1,2,41459,2,3,1),
+(6204,46,53,16,2,41459,0,2,1),
+(6205,46,53,16,2,41459,1,2,1),
+(6206,46,53,16,2,41459,2,2,1),
+(6207,46,53,128,2,41459,0,7,1),
+(6208,46,53,128,2,41459,1,7,1),
+(6209,46,53,128,2,41459,2,7,1),
+(6210,46,53,256,2,41459,0,7,1),
+(6211,46,53,256,2,41459,1,7,1),
+(6212,46,53,256,2,41459,2,7,1),
+(6213,46,53,1024,2,41459,0,7,1),
+(6214,46,53,1024,2,41459,1,7,1),
+(6215,46,53,1024,2,41459,2,7,1),
+(6216,46,53,2048,2,41459,0,2,1),
+(6217,46,53,2048,2,41459,1,2,1),
+(6218,46,53,2048,2,41459,2,2,1),
+(6219,46,53,4096,2,41459,0,2,1),
+(6220,46,53,4096,2,41459,1,2,1),
+(6221,46,53,4096,2,41459,2,2,1),
+(6222,46,53,8192,2,41459,0,2,1),
+(6223,46,53,8192,2,41459,1,2,1),
+(6224,46,53,8192,2,41459,2,2,1),
+(6225,46,53,32,2,41459,0,5,1),
+(6226,46,53,32,2,41459,1,5,1),
+(6227,46,53,32,2,41459,2,5,1),
+(6228,46,53,512,2,41459,0,5,1),
+(6229,46,53,512,2,41459,1,5,1),
+(6230,46,53,512,2,41459,2,5,1),
+(6231,46,53,2,2,41459,0,4,1),
+(6232,46,53,2,2,41459,1,4,1),
+(6233,46,53,2,2,41459,2,4,1),
+(6234,54,59,0,2,41459,0,7,1),
+(6235,54,59,1,2,41459,0,3,1),
+(6236,54,59,1,2,41459,1,3,1),
+(6237,54,59,1,2,41459,2,3,1),
+(6238,54,59,16,2,41459,0,2,1),
+(6239,54,59,16,2,41459,1,2,1),
+(6240,54,59,16,2,41459,2,2,1),
+(6241,54,59,128,2,41459,0,7,1),
+(6242,54,59,128,2,41459,1,7,1),
+(6243,54,59,128,2,41459,2,7,1),
+(6244,54,59,256,2,41459,0,7,1),
+(6245,54,59,256,2,41459,1,7,1),
+(6246,54,59,256,2,41459,2,7,1),
+(6247,54,59,1024,2,41459,0,7,1),
+(6248,54,59,1024,2,41459,1,7,1),
+(6249,54,59,1024,2,41459,2,7,1),
+(6250,54,59,2048,2,41459,0,2,1),
+(6251,54,59,2048,2,41459,1,2,1),
+(6252,54,59,2048,2,41459,2,2,1),
+(6253,54,59,4096,2,41459,0,2,1),
+(6254,54,59,4096,2,41459,1,2,1),
+(6255,54,59,4096,2,41459,2,2,1),
+(6256,54,59,8192,2,41459,0,2,1),
+(6257,54,59,8192,2,41459,1,2,1),
+(6258,54,59,8192,2,41459,2,2,1),
+(6259,54,59,32,2,41459,0,5,1),
+(6260,54,59,32,2,41459,1,5,1),
+(6261,54,59,32,2,41459,2,5,1),
+(6262,54,59,512,2,41459,0,5,1),
+(6263,54,59,512,2,41459,1,5,1),
+(6264,54,59,512,2,41459,2,5,1),
+(6265,54,59,2,2,41459,0,4,1),
+(6266,54,59,2,2,41459,1,4,1),
+(6267,54,59,2,2,41459,2,4,1),
+(6268,30,42,0,2,327692,0,23,1),
+(6269,30,42,1,2,327692,0,3,1),
+(6270,30,42,1,2,327692,1,3,1),
+(6271,30,42,1,2,327692,2,3,1),
+(6272,30,42,16,2,327692,0,2,1),
+(6273,30,42,16,2,327692,1,2,1),
+(6274,30,42,16,2,327692,2,2,1),
+(6275,30,42,128,2,327692,0,23,1),
+(6276,30,42,128,2,327692,1,23,1),
+(6277,30,42,128,2,327692,2,23,1),
+(6278,30,42,256,2,327692,0,23,1),
+(6279,30,42,256,2,327692,1,23,1),
+(6280,30,42,256,2,327692,2,23,1),
+(6281,30,42,1024,2,327692,0,7,1),
+(6282,30,42,1024,2,327692,1,7,1),
+(6283,30,42,1024,2,327692,2,7,1),
+(6284,30,42,2048,2,327692,0,2,1),
+(6285,30,42,2048,2,327692,1,2,1),
+(6286,30,42,2048,2,327692,2,2,1),
+(6287,30,42,4096,2,327692,0,2,1),
+(6288,30,42,4096,2,327692,1,2,1),
+(6289,30,42,4096,2,327692,2,2,1),
+(6290,30,42,8192,2,327692,0,2,1),
+(6291,30,42,8192,2,327692,1,2,1),
+(6292,30,42,8192,2,327692,2,2,1),
+(6293,30,42,32,2,327692,0,21,1),
+(6294,30,42,32,2,327692,1,21,1),
+(6295,30,42,32,2,327692,2,21,1),
+(6296,30,42,512,2,327692,0,21,1),
+(6297,30,42,512,2,327692,1,21,1),
+(6298,30,42,512,2,327692,2,21,1),
+(6299,30,42,2,2,327692,0,20,1),
+(6300,30,42,2,2,327692,1,20,1),
+(6301,30,42,2,2,327692,2,20,1),
+(6302,40,58,0,2,327692,0,23,1),
+(6303,40,58,1,2,327692,0,3,1),
+(6304,40,58,1,2,327692,1,3,1),
+(6305,40,58,1,2,327692,2,3,1),
+(6306,40,58,16,2,327692,0,2,1),
+(6307,40,58,16,2,327692,1,2,1),
+(6308,40,58,16,2,327692,2,2,1),
+(6309,40,58,128,2,327692,0,23,1),
+(6310,40,58,128,2,327692,1,23,1),
+(6311,40,58,128,2,327692,2,23,1),
+(6312,40,58,256,2,327692,0,23,1),
+(6313,40,58,256,2,327692,1,23,1),
+(6314,40,58,256,2,327692,2,23,1),
+(6315,40,58,1024,2,327692,0,7,1),
+(6316,40,58,1024,2,327692,1,7,1),
+(6317,40,58,1024,2,327692,2,7,1),
+(6318,40,58,2048,2,327692,0,2,1),
+(6319,40,58,2048,2,327692,1,2,1),
+(6320,40,58,2048,2,327692,2,2,1),
+(6321,40,58,4096,2,327692,0,2,1),
+(6322,40,58,4096,2,327692,1,2,1),
+(6323,40,58,4096,2,327692,2,2,1),
+(6324,40,58,8192,2,327692,0,2,1),
+(6325,40,58,8192,2,327692,1,2,1),
+(6326,40,58,8192,2,327692,2,2,1),
+(6327,40,58,32,2,327692,0,21,1),
+(6328,40,58,32,2,327692,1,21,1),
+(6329,40,58,32,2,327692,2,21,1),
+(6330,40,58,512,2,327692,0,21,1),
+(6331,40,58,512,2,327692,1,21,1),
+(6332,40,58,512,2,327692,2,21,1),
+(6333,40,58,2,2,327692,0,20,1),
+(6334,40,58,2,2,327692,1,20,1),
+(6335,40,58,2,2,327692,2,20,1),
+(6336,32,39,0,2,41459,0,7,1),
+(6337,32,39,1,2,41459,0,3,1),
+(6338,32,39,1,2,41459,1,3,1),
+(6339,32,39,1,2,41459,2,3,1),
+(6340,32,39,16,2,41459,0,2,1),
+(6341,32,39,16,2,41459,1,2,1),
+(6342,32,39,16,2,41459,2,2,1),
+(6343,32,39,128,2,41459,0,7,1),
+(6344,32,39,128,2,41459,1,7,1),
+(6345,32,39,128,2,41459,2,7,1),
+(6346,32,39,256,2,41459,0,7,1),
+(6347,32,39,256,2,41459,1,7,1),
+(6348,32,39,256,2,41459,2,7,1),
+(6349,32,39,1024,2,41459,0,7,1),
+(6350,32,39,1024,2,41459,1,7,1),
+(6351,32,39,1024,2,41459,2,7,1),
+(6352,32,39,2048,2,41459,0,2,1),
+(6353,32,39,2048,2,41459,1,2,1),
+(6354,32,39,2048,2,41459,2,2,1),
+(6355,32,39,4096,2,41459,0,2,1),
+(6356,32,39,4096,2,41459,1,2,1),
+(6357,32,39,4096,2,41459,2,2,1),
+(6358,32,39,8192,2,41459,0,2,1),
+(6359,32,39,8192,2,41459,1,2,1),
+(6360,32,39,8192,2,41459,2,2,1),
+(6361,32,39,32,2,41459,0,5,1),
+(6362,32,39,32,2,41459,1,5,1),
+(6363,32,39,32,2,41459,2,5,1),
+(6364,32,39,512,2,41459,0,5,1),
+(6365,32,39,512,2,41459,1,5,1),
+(6366,32,39,512,2,41459,2,5,1),
+(6367,32,39,2,2,41459,0,4,1),
+(6368,32,39,2,2,41459,1,4,1),
+(6369,32,39,2,2,41459,2,4,1),
+(6370,40,47,0,2,41459,0,7,1),
+(6371,40,47,1,2,41459,0,3,1),
+(6372,40,47,1,2,41459,1,3,1),
+(6373,40,47,1,2,41459,2,3,1),
+(6374,40,47,16,2,41459,0,2,1),
+(6375,40,47,16,2,41459,1,2,1),
+(6376,40,47,16,2,41459,2,2,1),
+(6377,40,47,128,2,41459,0,7,1),
+(6378,40,47,128,2,41459,1,7,1),
+(6379,40,47,128,2,41459,2,7,1),
+(6380,40,47,256,2,41459,0,7,1),
+(6381,40,47,256,2,41459,1,7,1),
+(6382,40,47,256,2,41459,2,7,1),
+(6383,40,47,1024,2,41459,0,7,1),
+(6384,40,47,1024,2,41459,1,7,1),
+(6385,40,47,1024,2,41459,2,7,1),
+(6386,40,47,2048,2,41459,0,2,1),
+(6387,40,47,2048,2,41459,1,2,1),
+(6388,40,47,2048,2,41459,2,2,1),
+(6389,40,47,4096,2,41459,0,2,1),
+(6390,40,47,4096,2,41459,1,2,1),
+(6391,40,47,4096,2,41459,2,2,1),
+(6392,40,47,8192,2,41459,0,2,1),
+(6393,40,47,8192,2,41459,1,2,1),
+(6394,40,47,8192,2,41459,2,2,1),
+(6395,40,47,32,2,41459,0,5,1),
+(6396,40,47,32,2,41459,1,5,1),
+(6397,40,47,32,2,41459,2,5,1),
+(6398,40,47,512,2,41459,0,5,1),
+(6399,40,47,512,2,41459,1,5,1),
+(6400,40,47,512,2,41459,2,5,1),
+(6401,40,47,2,2,41459,0,4,1),
+(6402,40,47,2,2,41459,1,4,1),
+(6403,40,47,2,2,41459,2,4,1),
+(6404,48,55,0,2,41459,0,7,1),
+(6405,48,55,1,2,41459,0,3,1),
+(6406,48,55,1,2,41459,1,3,1),
+(6407,48,55,1,2,41459,2,3,1),
+(6408,48,55,16,2,41459,0,2,1),
+(6409,48,55,16,2,41459,1,2,1),
+(6410,48,55,16,2,41459,2,2,1),
+(6411,48,55,128,2,41459,0,7,1),
+(6412,48,55,128,2,41459,1,7,1),
+(6413,48,55,128,2,41459,2,7,1),
+(6414,48,55,256,2,41459,0,7,1),
+(6415,48,55,256,2,41459,1,7,1),
+(6416,48,55,256,2,41459,2,7,1),
+(6417,48,55,1024,2,41459,0,7,1),
+(6418,48,55,1024,2,41459,1,7,1),
+(6419,48,55,1024,2,41459,2,7,1),
+(6420,48,55,2048,2,41459,0,2,1),
+(6421,48,55,2048,2,41459,1,2,1),
+(6422,48,55,2048,2,41459,2,2,1),
+(6423,48,55,4096,2,41459,0,2,1),
+(6424,48,55,4096,2,41459,1,2,1),
+(6425,48,55,4096,2,41459,2,2,1),
+(6426,48,55,8192,2,41459,0,2,1),
+(6427,48,55,8192,2,41459,1,2,1),
+(6428,48,55,8192,2,41459,2,2,1),
+(6429,48,55,32,2,41459,0,5,1),
+(6430,48,55,32,2,41459,1,5,1),
+(6431,48,55,32,2,41459,2,5,1),
+(6432,48,55,512,2,41459,0,5,1),
+(6433,48,55,512,2,41459,1,5,1),
+(6434,48,55,512,2,41459,2,5,1),
+(6435,48,55,2,2,41459,0,4,1),
+(6436,48,55,2,2,41459,1,4,1),
+(6437,48,55,2,2,41459,2,4,1),
+(6438,56,63,0,2,41459,0,7,1),
+(6439,56,63,1,2,41459,0,3,1),
+(6440,56,63,1,2,41459,1,3,1),
+(6441,56,63,1,2,41459,2,3,1),
+(6442,56,63,16,2,41459,0,2,1),
+(6443,56,63,16,2,41459,1,2,1),
+(6444,56,63,16,2,41459,2,2,1),
+(6445,56,63,128,2,41459,0,7,1),
+(6446,56,63,128,2,41459,1,7,1),
+(6447,56,63,128,2,41459,2,7,1),
+(6448,56,63,256,2,41459,0,7,1),
+(6449,56,63,256,2,41459,1,7,1),
+(6450,56,63,256,2,41459,2,7,1),
+(6451,56,63,1024,2,41459,0,7,1),
+(6452,56,63,1024,2,41459,1,7,1),
+(6453,56,63,1024,2,41459,2,7,1),
+(6454,56,63,2048,2,41459,0,2,1),
+(6455,56,63,2048,2,41459,1,2,1),
+(6456,56,63,2048,2,41459,2,2,1),
+(6457,56,63,4096,2,41459,0,2,1),
+(6458,56,63,4096,2,41459,1,2,1),
+(6459,56,63,4096,2,41459,2,2,1),
+(6460,56,63,8192,2,41459,0,2,1),
+(6461,56,63,8192,2,41459,1,2,1),
+(6462,56,63,8192,2,41459,2,2,1),
+(6463,56,63,32,2,41459,0,5,1),
+(6464,56,63,32,2,41459,1,5,1),
+(6465,56,63,32,2,41459,2,5,1),
+(6466,56,63,512,2,41459,0,5,1),
+(6467,56,63,512,2,41459,1,5,1),
+(6468,56,63,512,2,41459,2,5,1),
+(6469,56,63,2,2,41459,0,4,1),
+(6470,56,63,2,2,41459,1,4,1),
+(6471,56,63,2,2,41459,2,4,1),
+(6472,6,20,0,2,41459,0,7,1),
+(6473,6,20,1,2,41459,0,3,1),
+(6474,6,20,1,2,41459,1,3,1),
+(6475,6,20,1,2,41459,2,3,1),
+(6476,6,20,16,2,41459,0,2,1),
+(6477,6,20,16,2,41459,1,2,1),
+(6478,6,20,16,2,41459,2,2,1),
+(6479,6,20,128,2,41459,0,7,1),
+(6480,6,20,128,2,41459,1,7,1),
+(6481,6,20,128,2,41459,2,7,1),
+(6482,6,20,256,2,41459,0,7,1),
+(6483,6,20,256,2,41459,1,7,1),
+(6484,6,20,256,2,41459,2,7,1),
+(6485,6,20,1024,2,41459,0,7,1),
+(6486,6,20,1024,2,41459,1,7,1),
+(6487,6,20,1024,2,41459,2,7,1),
+(6488,6,20,2048,2,41459,0,2,1),
+(6489,6,20,2048,2,41459,1,2,1),
+(6490,6,20,2048,2,41459,2,2,1),
+(6491,6,20,4096,2,41459,0,2,1),
+(6492,6,20,4096,2,41459,1,2,1),
+(6493,6,20,4096,2,41459,2,2,1),
+(6494,6,20,8192,2,41459,0,2,1),
+(6495,6,20,8192,2,41459,1,2,1),
+(6496,6,20,8192,2,41459,2,2,1),
+(6497,6,20,32,2,41459,0,5,1),
+(6498,6,20,32,2,41459,1,5,1),
+(6499,6,20,32,2,41459,2,5,1),
+(6500,6,20,512,2,41459,0,5,1),
+(6501,6,20,512,2,41459,1,5,1),
+(6502,6,20,512,2,41459,2,5,1),
+(6503,6,20,2,2,41459,0,4,1),
+(6504,6,20,2,2,41459,1,4,1),
+(6505,6,20,2,2,41459,2,4,1),
+(6506,30,65,0,2,41459,0,7,1),
+(6507,30,65,1,2,41459,0,3,1),
+(6508,30,65,1,2,41459,1,3,1),
+(6509,30,65,1,2,41459,2,3,1),
+(6510,30,65,16,2,41459,0,2,1),
+(6511,30,65,16,2,41459,1,2,1),
+(6512,30,65,16,2,41459,2,2,1),
+(6513,30,65,128,2,41459,0,7,1),
+(6514,30,65,128,2,41459,1,7,1),
+(6515,30,65,128,2,41459,2,7,1),
+(6516,30,65,256,2,41459,0,7,1),
+(6517,30,65,256,2,41459,1,7,1),
+(6518,30,65,256,2,41459,2,7,1),
+(6519,30,65,1024,2,41459,0,7,1),
+(6520,30,65,1024,2,41459,1,7,1),
+(6521,30,65,1024,2,41459,2,7,1),
+(6522,30,65,2048,2,41459,0,2,1),
+(6523,30,65,2048,2,41459,1,2,1),
+(6524,30,65,2048,2,41459,2,2,1),
+(6525,30,65,4096,2,41459,0,2,1),
+(6526,30,65,4096,2,41459,1,2,1),
+(6527,30,65,4096,2,41459,2,2,1),
+(6528,30,65,8192,2,41459,0,2,1),
+(6529,30,65,8192,2,41459,1,2,1),
+(6530,30,65,8192,2,41459,2,2,1),
+(6531,30,65,32,2,41459,0,5,1),
+(6532,30,65,32,2,41459,1,5,1),
+(6533,30,65,32,2,41459,2,5,1),
+(6534,30,65,512,2,41459,0,5,1),
+(6535,30,65,512,2,41459,1,5,1),
+(6536,30,65,512,2,41459,2,5,1),
+(6537,30,65,2,2,41459,0,4,1),
+(6538,30,65,2,2,41459,1,4,1),
+(6539,30,65,2,2,41459,2,4,1),
+(6540,38,59,0,2,41459,0,7,1),
+(6541,38,59,1,2,41459,0,3,1),
+(6542,38,59,1,2,41459,1,3,1),
+(6543,38,59,1,2,41459,2,3,1),
+(6544,38,59,16,2,41459,0,2,1),
+(6545,38,59,16,2,41459,1,2,1),
+(6546,38,59,16,2,41459,2,2,1),
+(6547,38,59,128,2,41459,0,7,1),
+(6548,38,59,128,2,41459,1,7,1),
+(6549,38,59,128,2,41459,2,7,1),
+(6550,38,59,256,2,41459,0,7,1),
+(6551,38,59,256,2,41459,1,7,1),
+(6552,38,59,256,2,41459,2,7,1),
+(6553,38,59,1024,2,41459,0,7,1),
+(6554,38,59,1024,2,41459,1,7,1),
+(6555,38,59,1024,2,41459,2,7,1),
+(6556,38,59,2048,2,41459,0,2,1),
+(6557,38,59,2048,2,41459,1,2,1),
+(6558,38,59,2048,2,41459,2,2,1),
+(6559,38,59,4096,2,41459,0,2,1),
+(6560,38,59,4096,2,41459,1,2,1),
+(6561,38,59,4096,2,41459,2,2,1),
+(6562,38,59,8192,2,41459,0,2,1),
+(6563,38,59,8192,2,41459,1,2,1),
+(6564,38,59,8192,2,41459,2,2,1),
+(6565,38,59,32,2,41459,0,5,1),
+(6566,38,59,32,2,41459,1,5,1),
+(6567,38,59,32,2,41459,2,5,1),
+(6568,38,59,512,2,41459,0,5,1),
+(6569,38,59,512,2,41459,1,5,1),
+(6570,38,59,512,2,41459,2,5,1),
+(6571,38,59,2,2,41459,0,4,1),
+(6572,38,59,2,2,41459,1,4,1),
+(6573,38,59,2,2,41459,2,4,1),
+(6574,35,44,0,2,164291,0,7,1),
+(6575,35,44,1,2,164291,0,3,1),
+(6576,35,44,1,2,164291,1,3,1),
+(6577,35,44,1,2,164291,2,3,1),
+(6578,35,44,16,2,164291,0,2,1),
+(6579,35,44,16,2,164291,1,2,1),
+(6580,35,44,16,2,164291,2,2,1),
+(6581,35,44,128,2,164291,0,7,1),
+(6582,35,44,128,2,164291,1,7,1),
+(6583,35,44,128,2,164291,2,7,1),
+(6584,35,44,256,2,164291,0,7,1),
+(6585,35,44,256,2,164291,1,7,1),
+(6586,35,44,256,2,164291,2,7,1),
+(6587,35,44,1024,2,164291,0,7,1),
+(6588,35,44,1024,2,164291,1,7,1),
+(6589,35,44,1024,2,164291,2,7,1),
+(6590,35,44,2048,2,164291,0,2,1),
+(6591,35,44,2048,2,164291,1,2,1),
+(6592,35,44,2048,2,164291,2,2,1),
+(6593,35,44,4096,2,164291,0,2,1),
+(6594,35,44,4096,2,164291,1,2,1),
+(6595,35,44,4096,2,164291,2,2,1),
+(6596,35,44,8192,2,164291,0,2,1),
+(6597,35,44,8192,2,164291,1,2,1),
+(6598,35,44,8192,2,164291,2,2,1),
+(6599,35,44,32,2,164291,0,5,1),
+(6600,35,44,32,2,164291,1,5,1),
+(6601,35,44,32,2,164291,2,5,1),
+(6602,35,44,512,2,164291,0,5,1),
+(6603,35,44,512,2,164291,1,5,1),
+(6604,35,44,512,2,164291,2,5,1),
+(6605,35,44,2,2,164291,0,4,1),
+(6606,35,44,2,2,164291,1,4,1),
+(6607,35,44,2,2,164291,2,4,1),
+(6608,46,55,0,2,41459,0,39,1),
+(6609,46,55,1,2,41459,0,3,1),
+(6610,46,55,1,2,41459,1,3,1),
+(6611,46,55,1,2,41459,2,3,1),
+(6612,46,55,16,2,41459,0,2,1),
+(6613,46,55,16,2,41459,1,2,1),
+(6614,46,55,16,2,41459,2,2,1),
+(6615,46,55,128,2,41459,0,39,1),
+(6616,46,55,128,2,41459,1,39,1),
+(6617,46,55,128,2,41459,2,39,1),
+(6618,46,55,256,2,41459,0,39,1),
+(6619,46,55,256,2,41459,1,39,1),
+(6620,46,55,256,2,41459,2,39,1),
+(6621,46,55,1024,2,41459,0,7,1),
+(6622,46,55,1024,2,41459,1,7,1),
+(6623,46,55,1024,2,41459,2,7,1),
+(6624,46,55,2048,2,41459,0,2,1),
+(6625,46,55,2048,2,41459,1,2,1),
+(6626,46,55,2048,2,41459,2,2,1),
+(6627,46,55,4096,2,41459,0,2,1),
+(6628,46,55,4096,2,41459,1,2,1),
+(6629,46,55,4096,2,41459,2,2,1),
+(6630,46,55,8192,2,41459,0,2,1),
+(6631,46,55,8192,2,41459,1,2,1),
+(6632,46,55,8192,2,41459,2,2,1),
+(6633,46,55,32,2,41459,0,5,1),
+(6634,46,55,32,2,41459,1,5,1),
+(6635,46,55,32,2,41459,2,5,1),
+(6636,46,55,512,2,41459,0,37,1),
+(6637,46,55,512,2,41459,1,37,1),
+(6638,46,55,512,2,41459,2,37,1),
+(6639,46,55,2,2,41459,0,4,1),
+(6640,46,55,2,2,41459,1,4,1),
+(6641,46,55,2,2,41459,2,4,1),
+(6642,46,55,4,2,41459,0,32,1),
+(6643,46,55,4,2,41459,1,32,1),
+(6644,46,55,4,2,41459,2,32,1),
+(6645,46,55,8,2,41459,0,32,1),
+(6646,46,55,8,2,41459,1,32,1),
+(6647,46,55,8,2,41459,2,32,1),
+(6648,46,55,64,2,41459,0,32,1),
+(6649,46,55,64,2,41459,1,32,1),
+(6650,46,55,64,2,41459,2,32,1),
+(6651,56,63,0,2,41459,0,39,1),
+(6652,56,63,1,2,41459,0,3,1),
+(6653,56,63,1,2,41459,1,3,1),
+(6654,56,63,1,2,41459,2,3,1),
+(6655,56,63,16,2,41459,0,2,1),
+(6656,56,63,16,2,41459,1,2,1),
+(6657,56,63,16,2,41459,2,2,1),
+(6658,56,63,128,2,41459,0,39,1),
+(6659,56,63,128,2,41459,1,39,1),
+(6660,56,63,128,2,41459,2,39,1),
+(6661,56,63,256,2,41459,0,39,1),
+(6662,56,63,256,2,41459,1,39,1),
+(6663,56,63,256,2,41459,2,39,1),
+(6664,56,63,1024,2,41459,0,7,1),
+(6665,56,63,1024,2,41459,1,7,1),
+(6666,56,63,1024,2,41459,2,7,1),
+(6667,56,63,2048,2,41459,0,2,1),
+(6668,56,63,2048,2,41459,1,2,1),
+(6669,56,63,2048,2,41459,2,2,1),
+(6670,56,63,4096,2,41459,0,2,1),
+(6671,56,63,4096,2,41459,1,2,1),
+(6672,56,63,4096,2,41459,2,2,1),
+(6673,56,63,8192,2,41459,0,2,1),
+(6674,56,63,8192,2,41459,1,2,1),
+(6675,56,63,8192,2,41459,2,2,1),
+(6676,56,63,32,2,41459,0,5,1),
+(6677,56,63,32,2,41459,1,5,1),
+(6678,56,63,32,2,41459,2,5,1),
+(6679,56,63,512,2,41459,0,37,1),
+(6680,56,63,512,2,41459,1,37,1),
+(6681,56,63,512,2,41459,2,37,1),
+(6682,56,63,2,2,41459,0,4,1),
+(6683,56,63,2,2,41459,1,4,1),
+(6684,56,63,2,2,41459,2,4,1),
+(6685,56,63,4,2,41459,0,32,1),
+(6686,56,63,4,2,41459,1,32,1),
+(6687,56,63,4,2,41459,2,32,1),
+(6688,56,63,8,2,41459,0,32,1),
+(6689,56,63,8,2,41459,1,32,1),
+(6690,56,63,8,2,41459,2,32,1),
+(6691,56,63,64,2,41459,0,32,1),
+(6692,56,63,64,2,41459,1,32,1),
+(6693,56,63,64,2,41459,2,32,1),
+(6694,48,57,0,2,41459,0,7,1),
+(6695,48,57,1,2,41459,0,3,1),
+(6696,48,57,1,2,41459,1,3,1),
+(6697,48,57,1,2,41459,2,3,1),
+(6698,48,57,16,2,41459,0,2,1),
+(6699,48,57,16,2,41459,1,2,1),
+(6700,48,57,16,2,41459,2,2,1),
+(6701,48,57,128,2,41459,0,7,1),
+(6702,48,57,128,2,41459,1,7,1),
+(6703,48,57,128,2,41459,2,7,1),
+(6704,48,57,256,2,41459,0,7,1),
+(6705,48,57,256,2,41459,1,7,1),
+(6706,48,57,256,2,41459,2,7,1),
+(6707,48,57,1024,2,41459,0,7,1),
+(6708,48,57,1024,2,41459,1,7,1),
+(6709,48,57,1024,2,41459,2,7,1),
+(6710,48,57,2048,2,41459,0,2,1),
+(6711,48,57,2048,2,41459,1,2,1),
+(6712,48,57,2048,2,41459,2,2,1),
+(6713,48,57,4096,2,41459,0,2,1),
+(6714,48,57,4096,2,41459,1,2,1),
+(6715,48,57,4096,2,41459,2,2,1),
+(6716,48,57,8192,2,41459,0,2,1),
+(6717,48,57,8192,2,41459,1,2,1),
+(6718,48,57,8192,2,41459,2,2,1),
+(6719,48,57,32,2,41459,0,5,1),
+(6720,48,57,32,2,41459,1,5,1),
+(6721,48,57,32,2,41459,2,5,1),
+(6722,48,57,512,2,41459,0,5,1),
+(6723,48,57,512,2,41459,1,5,1),
+(6724,48,57,512,2,41459,2,5,1),
+(6725,48,57,2,2,41459,0,4,1),
+(6726,48,57,2,2,41459,1,4,1),
+(6727,48,57,2,2,41459,2,4,1),
+(6728,58,65,0,2,41459,0,7,1),
+(6729,58,65,1,2,41459,0,3,1),
+(6730,58,65,1,2,41459,1,3,1),
+(6731,58,65,1,2,41459,2,3,1),
+(6732,58,65,16,2,41459,0,2,1),
+(6733,58,65,16,2,41459,1,2,1),
+(6734,58,65,16,2,41459,2,2,1),
+(6735,58,65,128,2,41459,0,7,1),
+(6736,58,65,128,2,41459,1,7,1),
+(6737,58,65,128,2,41459,2,7,1),
+(6738,58,65,256,2,41459,0,7,1),
+(6739,58,65,256,2,41459,1,7,1),
+(6740,58,65,256,2,41459,2,7,1),
+(6741,58,65,1024,2,41459,0,7,1),
+(6742,58,65,1024,2,41459,1,7,1),
+(6743,58,65,1024,2,41459,2,7,1),
+(6744,58,65,2048,2,41459,0,2,1),
+(6745,58,65,2048,2,41459,1,2,1),
+(6746,58,65,2048,2,41459,2,2,1),
+(6747,58,65,4096,2,41459,0,2,1),
+(6748,58,65,4096,2,41459,1,2,1),
+(6749,58,65,4096,2,41459,2,2,1),
+(6750,58,65,8192,2,41459,0,2,1),
+(6751,58,65,8192,2,41459,1,2,1),
+(6752,58,65,8192,2,41459,2,2,1),
+(6753,58,65,32,2,41459,0,5,1),
+(6754,58,65,32,2,41459,1,5,1),
+(6755,58,65,32,2,41459,2,5,1),
+(6756,58,65,512,2,41459,0,5,1),
+(6757,58,65,512,2,41459,1,5,1),
+(6758,58,65,512,2,41459,2,5,1),
+(6759,58,65,2,2,41459,0,4,1),
+(6760,58,65,2,2,41459,1,4,1),
+(6761,58,65,2,2,41459,2,4,1),
+(6762,60,67,0,2,41459,0,7,1),
+(6763,60,67,1,2,41459,0,3,1),
+(6764,60,67,1,2,41459,1,3,1),
+(6765,60,67,1,2,41459,2,3,1),
+(6766,60,67,16,2,41459,0,2,1),
+(6767,60,67,16,2,41459,1,2,1),
+(6768,60,67,16,2,41459,2,2,1),
+(6769,60,67,128,2,41459,0,7,1),
+(6770,60,67,128,2,41459,1,7,1),
+(6771,60,67,128,2,41459,2,7,1),
+(6772,60,67,256,2,41459,0,7,1),
+(6773,60,67,256,2,41459,1,7,1),
+(6774,60,67,256,2,41459,2,7,1),
+(6775,60,67,1024,2,41459,0,7,1),
+(6776,60,67,1024,2,41459,1,7,1),
+(6777,60,67,1024,2,41459,2,7,1),
+(6778,60,67,2048,2,41459,0,2,1),
+(6779,60,67,2048,2,41459,1,2,1),
+(6780,60,67,2048,2,41459,2,2,1),
+(6781,60,67,4096,2,41459,0,2,1),
+(6782,60,67,4096,2,41459,1,2,1),
+(6783,60,67,4096,2,41459,2,2,1),
+(6784,60,67,8192,2,41459,0,2,1),
+(6785,60,67,8192,2,41459,1,2,1),
+(6786,60,67,8192,2,41459,2,2,1),
+(6787,60,67,32,2,41459,0,5,1),
+(6788,60,67,32,2,41459,1,5,1),
+(6789,60,67,32,2,41459,2,5,1),
+(6790,60,67,512,2,41459,0,5,1),
+(6791,60,67,512,2,41459,1,5,1),
+(6792,60,67,512,2,41459,2,5,1),
+(6793,60,67,2,2,41459,0,4,1),
+(6794,60,67,2,2,41459,1,4,1),
+(6795,60,67,2,2,41459,2,4,1),
+(6796,35,44,0,2,9264,0,7,1),
+(6797,35,44,1,2,9264,0,3,1),
+(6798,35,44,1,2,9264,1,3,1),
+(6799,35,44,1,2,9264,2,3,1),
+(6800,35,44,16,2,9264,0,2,1),
+(6801,35,44,16,2,9264,1,2,1),
+(6802,35,44,16,2,9264,2,2,1),
+(6803,35,44,128,2,9264,0,7,1),
+(6804,35,44,128,2,9264,1,7,1),
+(6805,35,44,128,2,9264,2,7,1),
+(6806,35,44,256,2,9264,0,7,1),
+(6807,35,44,256,2,9264,1,7,1),
+(6808,35,44,256,2,9264,2,7,1),
+(6809,35,44,1024,2,9264,0,7,1),
+(6810,35,44,1024,2,9264,1,7,1),
+(6811,35,44,1024,2,9264,2,7,1),
+(6812,35,44,2048,2,9264,0,2,1),
+(6813,35,44,2048,2,9264,1,2,1),
+(6814,35,44,2048,2,9264,2,2,1),
+(6815,35,44,4096,2,9264,0,2,1),
+(6816,35,44,4096,2,9264,1,2,1),
+(6817,35,44,4096,2,9264,2,2,1),
+(6818,35,44,8192,2,9264,0,2,1),
+(6819,35,44,8192,2,9264,1,2,1),
+(6820,35,44,8192,2,9264,2,2,1),
+(6821,35,44,32,2,9264,0,5,1),
+(6822,35,44,32,2,9264,1,5,1),
+(6823,35,44,32,2,9264,2,5,1),
+(6824,35,44,512,2,9264,0,5,1),
+(6825,35,44,512,2,9264,1,5,1),
+(6826,35,44,512,2,9264,2,5,1),
+(6827,35,44,2,2,9264,0,4,1),
+(6828,35,44,2,2,9264,1,4,1),
+(6829,35,44,2,2,9264,2,4,1),
+(6830,1,60,0,2,41459,0,7,1),
+(6831,1,60,1,2,41459,0,3,1),
+(6832,1,60,1,2,41459,1,3,1),
+(6833,1,60,1,2,41459,2,3,1),
+(6834,1,60,16,2,41459,0,2,1),
+(6835,1,60,16,2,41459,1,2,1),
+(6836,1,60,16,2,41459,2,2,1),
+(6837,1,60,128,2,41459,0,7,1),
+(6838,1,60,128,2,41459,1,7,1),
+(6839,1,60,128,2,41459,2,7,1),
+(6840,1,60,256,2,41459,0,7,1),
+(6841,1,60,256,2,41459,1,7,1),
+(6842,1,60,256,2,41459,2,7,1),
+(6843,1,60,1024,2,41459,0,7,1),
+(6844,1,60,1024,2,41459,1,7,1),
+(6845,1,60,1024,2,41459,2,7,1),
+(6846,1,60,2048,2,41459,0,2,1),
+(6847,1,60,2048,2,41459,1,2,1),
+(6848,1,60,2048,2,41459,2,2,1),
+(6849,1,60,4096,2,41459,0,2,1),
+(6850,1,60,4096,2,41459,1,2,1),
+(6851,1,60,4096,2,41459,2,2,1),
+(6852,1,60,8192,2,41459,0,2,1),
+(6853,1,60,8192,2,41459,1,2,1),
+(6854,1,60,8192,2,41459,2,2,1),
+(6855,1,60,32,2,41459,0,5,1),
+(6856,1,60,32,2,41459,1,5,1),
+(6857,1,60,32,2,41459,2,5,1),
+(6858,1,60,512,2,41459,0,5,1),
+(6859,1,60,512,2,41459,1,5,1),
+(6860,1,60,512,2,41459,2,5,1),
+(6861,1,60,2,2,41459,0,4,1),
+(6862,1,60,2,2,41459,1,4,1),
+(6863,1,60,2,2,41459,2,4,1),
+(6864,29,35,0,2,41459,0,7,1),
+(6865,29,35,1,2,41459,0,3,1),
+(6866,29,35,1,2,41459,1,3,1),
+(6867,29,35,1,2,41459,2,3,1),
+(6868,29,35,16,2,41459,0,2,1),
+(6869,29,35,16,2,41459,1,2,1),
+(6870,29,35,16,2,41459,2,2,1),
+(6871,29,35,128,2,41459,0,7,1),
+(6872,29,35,128,2,41459,1,7,1),
+(6873,29,35,128,2,41459,2,7,1),
+(6874,29,35,256,2,41459,0,7,1),
+(6875,29,35,256,2,41459,1,7,1),
+(6876,29,35,256,2,41459,2,7,1),
+(6877,29,35,1024,2,41459,0,7,1),
+(6878,29,35,1024,2,41459,1,7,1),
+(6879,29,35,1024,2,41459,2,7,1),
+(6880,29,35,2048,2,41459,0,2,1),
+(6881,29,35,2048,2,41459,1,2,1),
+(6882,29,35,2048,2,41459,2,2,1),
+(6883,29,35,4096,2,41459,0,2,1),
+(6884,29,35,4096,2,41459,1,2,1),
+(6885,29,35,4096,2,41459,2,2,1),
+(6886,29,35,8192,2,41459,0,2,1),
+(6887,29,35,8192,2,41459,1,2,1),
+(6888,29,35,8192,2,41459,2,2,1),
+(6889,29,35,32,2,41459,0,5,1),
+(6890,29,35,32,2,41459,1,5,1),
+(6891,29,35,32,2,41459,2,5,1),
+(6892,29,35,512,2,41459,0,5,1),
+(6893,29,35,512,2,41459,1,5,1),
+(6894,29,35,512,2,41459,2,5,1),
+(6895,29,35,2,2,41459,0,4,1),
+(6896,29,35,2,2,41459,1,4,1),
+(6897,29,35,2,2,41459,2,4,1),
+(6898,1,60,0,2,41459,0,7,1),
+(6899,1,60,1,2,41459,0,3,1),
+(6900,1,60,1,2,41459,1,3,1),
+(6901,1,60,1,2,41459,2,3,1),
+(6902,1,60,16,2,41459,0,2,1),
+(6903,1,60,16,2,41459,1,2,1),
+(6904,1,60,16,2,41459,2,2,1),
+(6905,1,60,128,2,41459,0,7,1),
+(6906,1,60,128,2,41459,1,7,1),
+(6907,1,60,128,2,41459,2,7,1),
+(6908,1,60,256,2,41459,0,7,1),
+(6909,1,60,256,2,41459,1,7,1),
+(6910,1,60,256,2,41459,2,7,1),
+(6911,1,60,1024,2,41459,0,7,1),
+(6912,1,60,1024,2,41459,1,7,1),
+(6913,1,60,1024,2,41459,2,7,1),
+(6914,1,60,2048,2,41459,0,2,1),
+(6915,1,60,2048,2,41459,1,2,1),
+(6916,1,60,2048,2,41459,2,2,1),
+(6917,1,60,4096,2,41459,0,2,1),
+(6918,1,60,4096,2,41459,1,2,1),
+(6919,1,60,4096,2,41459,2,2,1),
+(6920,1,60,8192,2,41459,0,2,1),
+(6921,1,60,8192,2,41459,1,2,1),
+(6922,1,60,8192,2,41459,2,2,1),
+(6923,1,60,32,2,41459,0,5,1),
+(6924,1,60,32,2,41459,1,5,1),
+(6925,1,60,32,2,41459,2,5,1),
+(6926,1,60,512,2,41459,0,5,1),
+(6927,1,60,512,2,41459,1,5,1),
+(6928,1,60,512,2,41459,2,5,1),
+(6929,1,60,2,2,41459,0,4,1),
+(6930,1,60,2,2,41459,1,4,1),
+(6931,1,60,2,2,41459,2,4,1),
+(6932,1,60,0,2,41459,0,7,1),
+(6933,1,60,1,2,41459,0,3,1),
+(6934,1,60,1,2,41459,1,3,1),
+(6935,1,60,1,2,41459,2,3,1),
+(6936,1,60,16,2,41459,0,2,1),
+(6937,1,60,16,2,41459,1,2,1),
+(6938,1,60,16,2,41459,2,2,1),
+(6939,1,60,128,2,41459,0,7,1),
+(6940,1,60,128,2,41459,1,7,1),
+(6941,1,60,128,2,41459,2,7,1),
+(6942,1,60,256,2,41459,0,7,1),
+(6943,1,60,256,2,41459,1,7,1),
+(6944,1,60,256,2,41459,2,7,1),
+(6945,1,60,1024,2,41459,0,7,1),
+(6946,1,60,1024,2,41459,1,7,1),
+(6947,1,60,1024,2,41459,2,7,1),
+(6948,1,60,2048,2,41459,0,2,1),
+(6949,1,60,2048,2,41459,1,2,1),
+(6950,1,60,2048,2,41459,2,2,1),
+(6951,1,60,4096,2,41459,0,2,1),
+(6952,1,60,4096,2,41459,1,2,1),
+(6953,1,60,4096,2,41459,2,2,1),
+(6954,1,60,8192,2,41459,0,2,1),
+(6955,1,60,8192,2,41459,1,2,1),
+(6956,1,60,8192,2,41459,2,2,1),
+(6957,1,60,32,2,41459,0,5,1),
+(6958,1,60,32,2,41459,1,5,1),
+(6959,1,60,32,2,41459,2,5,1),
+(6960,1,60,512,2,41459,0,5,1),
+(6961,1,60,512,2,41459,1,5,1),
+(6962,1,60,512,2,41459,2,5,1),
+(6963,1,60,2,2,41459,0,4,1),
+(6964,1,60,2,2,41459,1,4,1),
+(6965,1,60,2,2,41459,2,4,1),
+(6966,1,70,0,2,41459,0,7,1),
+(6967,1,70,1,2,41459,0,3,1),
+(6968,1,70,1,2,41459,1,3,1),
+(6969,1,70,1,2,41459,2,3,1),
+(6970,1,70,16,2,41459,0,2,1),
+(6971,1,70,16,2,41459,1,2,1),
+(6972,1,70,16,2,41459,2,2,1),
+(6973,1,70,128,2,41459,0,7,1),
+(6974,1,70,128,2,41459,1,7,1),
+(6975,1,70,128,2,41459,2,7,1),
+(6976,1,70,256,2,41459,0,7,1),
+(6977,1,70,256,2,41459,1,7,1),
+(6978,1,70,256,2,41459,2,7,1),
+(6979,1,70,1024,2,41459,0,7,1),
+(6980,1,70,1024,2,41459,1,7,1),
+(6981,1,70,1024,2,41459,2,7,1),
+(6982,1,70,2048,2,41459,0,2,1),
+(6983,1,70,2048,2,41459,1,2,1),
+(6984,1,70,2048,2,41459,2,2,1),
+(6985,1,70,4096,2,41459,0,2,1),
+(6986,1,70,4096,2,41459,1,2,1),
+(6987,1,70,4096,2,41459,2,2,1),
+(6988,1,70,8192,2,41459,0,2,1),
+(6989,1,70,8192,2,41459,1,2,1),
+(6990,1,70,8192,2,41459,2,2,1),
+(6991,1,70,32,2,41459,0,5,1),
+(6992,1,70,32,2,41459,1,5,1),
+(6993,1,70,32,2,41459,2,5,1),
+(6994,1,70,512,2,41459,0,5,1),
+(6995,1,70,512,2,41459,1,5,1),
+(6996,1,70,512,2,41459,2,5,1),
+(6997,1,70,2,2,41459,0,4,1),
+(6998,1,70,2,2,41459,1,4,1),
+(6999,1,70,2,2,41459,2,4,1),
+(7000,60,61,0,2,41459,0,7,1),
+(7001,60,61,1,2,41459,0,3,1),
+(7002,60,61,1,2,41459,1,3,1),
+(7003,60,61,1,2,41459,2,3,1),
+(7004,60,61,16,2,41459,0,2,1),
+(7005,60,61,16,2,41459,1,2,1),
+(7006,60,61,16,2,41459,2,2,1),
+(7007,60,61,128,2,41459,0,7,1),
+(7008,60,61,128,2,41459,1,7,1),
+(7009,60,61,128,2,41459,2,7,1),
+(7010,60,61,256,2,41459,0,7,1),
+(7011,60,61,256,2,41459,1,7,1),
+(7012,60,61,256,2,41459,2,7,1),
+(7013,60,61,1024,2,41459,0,7,1),
+(7014,60,61,1024,2,41459,1,7,1),
+(7015,60,61,1024,2,41459,2,7,1),
+(7016,60,61,2048,2,41459,0,2,1),
+(7017,60,61,2048,2,41459,1,2,1),
+(7018,60,61,2048,2,41459,2,2,1),
+(7019,60,61,4096,2,41459,0,2,1),
+(7020,60,61,4096,2,41459,1,2,1),
+(7021,60,61,4096,2,41459,2,2,1),
+(7022,60,61,8192,2,41459,0,2,1),
+(7023,60,61,8192,2,41459,1,2,1),
+(7024,60,61,8192,2,41459,2,2,1),
+(7025,60,61,32,2,41459,0,5,1),
+(7026,60,61,32,2,41459,1,5,1),
+(7027,60,61,32,2,41459,2,5,1),
+(7028,60,61,512,2,41459,0,5,1),
+(7029,60,61,512,2,41459,1,5,1),
+(7030,60,61,512,2,41459,2,5,1),
+(7031,60,61,2,2,41459,0,4,1),
+(7032,60,61,2,2,41459,1,4,1),
+(7033,60,61,2,2,41459,2,4,1),
+(7034,64,70,0,2,41459,0,39,1),
+(7035,64,70,1,2,41459,0,3,1),
+(7036,64,70,1,2,41459,1,3,1),
+(7037,64,70,1,2,41459,2,3,1),
+(7038,64,70,16,2,41459,0,2,1),
+(7039,64,70,16,2,41459,1,2,1),
+(7040,64,70,16,2,41459,2,2,1),
+(7041,64,70,128,2,41459,0,39,1),
+(7042,64,70,128,2,41459,1,39,1),
+(7043,64,70,128,2,41459,2,39,1),
+(7044,64,70,256,2,41459,0,39,1),
+(7045,64,70,256,2,41459,1,39,1),
+(7046,64,70,256,2,41459,2,39,1),
+(7047,64,70,1024,2,41459,0,7,1),
+(7048,64,70,1024,2,41459,1,7,1),
+(7049,64,70,1024,2,41459,2,7,1),
+(7050,64,70,2048,2,41459,0,2,1),
+(7051,64,70,2048,2,41459,1,2,1),
+(7052,64,70,2048,2,41459,2,2,1),
+(7053,64,70,4096,2,41459,0,2,1),
+(7054,64,70,4096,2,41459,1,2,1),
+(7055,64,70,4096,2,41459,2,2,1),
+(7056,64,70,8192,2,41459,0,2,1),
+(7057,64,70,8192,2,41459,1,2,1),
+(7058,64,70,8192,2,41459,2,2,1),
+(7059,64,70,32,2,41459,0,5,1),
+(7060,64,70,32,2,41459,1,5,1),
+(7061,64,70,32,2,41459,2,5,1),
+(7062,64,70,512,2,41459,0,37,1),
+(7063,64,70,512,2,41459,1,37,1),
+(7064,64,70,512,2,41459,2,37,1),
+(7065,64,70,2,2,41459,0,4,1),
+(7066,64,70,2,2,41459,1,4,1),
+(7067,64,70,2,2,41459,2,4,1),
+(7068,64,70,4,2,41459,0,32,1),
+(7069,64,70,4,2,41459,1,32,1),
+(7070,64,70,4,2,41459,2,32,1),
+(7071,64,70,8,2,41459,0,32,1),
+(7072,64,70,8,2,41459,1,32,1),
+(7073,64,70,8,2,41459,2,32,1),
+(7074,64,70,64,2,41459,0,32,1),
+(7075,64,70,64,2,41459,1,32,1),
+(7076,64,70,64,2,41459,2,32,1),
+(7077,66,70,0,2,41459,0,7,1),
+(7078,66,70,1,2,41459,0,3,1),
+(7079,66,70,1,2,41459,1,3,1),
+(7080,66,70,1,2,41459,2,3,1),
+(7081,66,70,16,2,41459,0,2,1),
+(7082,66,70,16,2,41459,1,2,1),
+(7083,66,70,16,2,41459,2,2,1),
+(7084,66,70,128,2,41459,0,7,1),
+(7085,66,70,128,2,41459,1,7,1),
+(7086,66,70,128,2,41459,2,7,1),
+(7087,66,70,256,2,41459,0,7,1),
+(7088,66,70,256,2,41459,1,7,1),
+(7089,66,70,256,2,41459,2,7,1),
+(7090,66,70,1024,2,41459,0,7,1),
+(7091,66,70,1024,2,41459,1,7,1),
+(7092,66,70,1024,2,41459,2,7,1),
+(7093,66,70,2048,2,41459,0,2,1),
+(7094,66,70,2048,2,41459,1,2,1),
+(7095,66,70,2048,2,41459,2,2,1),
+(7096,66,70,4096,2,41459,0,2,1),
+(7097,66,70,4096,2,41459,1,2,1),
+(7098,66,70,4096,2,41459,2,2,1),
+(7099,66,70,8192,2,41459,0,2,1),
+(7100,66,70,8192,2,41459,1,2,1),
+(7101,66,70,8192,2,41459,2,2,1),
+(7102,66,70,32,2,41459,0,5,1),
+(7103,66,70,32,2,41459,1,5,1),
+(7104,66,70,32,2,41459,2,5,1),
+(7105,66,70,512,2,41459,0,5,1),
+(7106,66,70,512,2,41459,1,5,1),
+(7107,66,70,512,2,41459,2,5,1),
+(7108,66,70,2,2,41459,0,4,1),
+(7109,66,70,2,2,41459,1,4,1),
+(7110,66,70,2,2,41459,2,4,1),
+(7111,68,70,0,2,41459,0,7,1),
+(7112,68,70,1,2,41459,0,3,1),
+(7113,68,70,1,2,41459,1,3,1),
+(7114,68,70,1,2,41459,2,3,1),
+(7115,68,70,16,2,41459,0,2,1),
+(7116,68,70,16,2,41459,1,2,1),
+(7117,68,70,16,2,41459,2,2,1),
+(7118,68,70,128,2,41459,0,7,1),
+(7119,68,70,128,2,41459,1,7,1),
+(7120,68,70,128,2,41459,2,7,1),
+(7121,68,70,256,2,41459,0,7,1),
+(7122,68,70,256,2,41459,1,7,1),
+(7123,68,70,256,2,41459,2,7,1),
+(7124,68,70,1024,2,41459,0,7,1),
+(7125,68,70,1024,2,41459,1,7,1),
+(7126,68,70,1024,2,41459,2,7,1),
+(7127,68,70,2048,2,41459,0,2,1),
+(7128,68,70,2048,2,41459,1,2,1),
+(7129,68,70,2048,2,41459,2,2,1),
+(7130,68,70,4096,2,41459,0,2,1),
+(7131,68,70,4096,2,41459,1,2,1),
+(7132,68,70,4096,2,41459,2,2,1),
+(7133,68,70,8192,2,41459,0,2,1),
+(7134,68,70,8192,2,41459,1,2,1),
+(7135,68,70,8192,2,41459,2,2,1),
+(7136,68,70,32,2,41459,0,5,1),
+(7137,68,70,32,2,41459,1,5,1),
+(7138,68,70,32,2,41459,2,5,1),
+(7139,68,70,512,2,41459,0,5,1),
+(7140,68,70,512,2,41459,1,5,1),
+(7141,68,70,512,2,41459,2,5,1),
+(7142,68,70,2,2,41459,0,4,1),
+(7143,68,70,2,2,41459,1,4,1),
+(7144,68,70,2,2,41459,2,4,1),
+(7145,68,76,0,2,41459,0,7,1),
+(7146,68,76,1,2,41459,0,3,1),
+(7147,68,76,1,2,41459,1,3,1),
+(7148,68,76,1,2,41459,2,3,1),
+(7149,68,76,16,2,41459,0,2,1),
+(7150,68,76,16,2,41459,1,2,1),
+(7151,68,76,16,2,41459,2,2,1),
+(7152,68,76,128,2,41459,0,7,1),
+(7153,68,76,128,2,41459,1,7,1),
+(7154,68,76,128,2,41459,2,7,1),
+(7155,68,76,256,2,41459,0,7,1),
+(7156,68,76,256,2,41459,1,7,1),
+(7157,68,76,256,2,41459,2,7,1),
+(7158,68,76,1024,2,41459,0,7,1),
+(7159,68,76,1024,2,41459,1,7,1),
+(7160,68,76,1024,2,41459,2,7,1),
+(7161,68,76,2048,2,41459,0,2,1),
+(7162,68,76,2048,2,41459,1,2,1),
+(7163,68,76,2048,2,41459,2,2,1),
+(7164,68,76,4096,2,41459,0,2,1),
+(7165,68,76,4096,2,41459,1,2,1),
+(7166,68,76,4096,2,41459,2,2,1),
+(7167,68,76,8192,2,41459,0,2,1),
+(7168,68,76,8192,2,41459,1,2,1),
+(7169,68,76,8192,2,41459,2,2,1),
+(7170,68,76,32,2,41459,0,5,1),
+(7171,68,76,32,2,41459,1,5,1),
+(7172,68,76,32,2,41459,2,5,1),
+(7173,68,76,512,2,41459,0,5,1),
+(7174,68,76,512,2,41459,1,5,1),
+(7175,68,76,512,2,41459,2,5,1),
+(7176,68,76,2,2,41459,0,4,1),
+(7177,68,76,2,2,41459,1,4,1),
+(7178,68,76,2,2,41459,2,4,1),
+(7179,68,72,0,2,41459,0,7,1),
+(7180,68,72,1,2,41459,0,3,1),
+(7181,68,72,1,2,41459,1,3,1),
+(7182,68,72,1,2,41459,2,3,1),
+(7183,68,72,16,2,41459,0,2,1),
+(7184,68,72,16,2,41459,1,2,1),
+(7185,68,72,16,2,41459,2,2,1),
+(7186,68,72,128,2,41459,0,7,1),
+(7187,68,72,128,2,41459,1,7,1),
+(7188,68,72,128,2,41459,2,7,1),
+(7189,68,72,256,2,41459,0,7,1),
+(7190,68,72,256,2,41459,1,7,1),
+(7191,68,72,256,2,41459,2,7,1),
+(7192,68,72,1024,2,41459,0,7,1),
+(7193,68,72,1024,2,41459,1,7,1),
+(7194,68,72,1024,2,41459,2,7,1),
+(7195,68,72,2048,2,41459,0,2,1),
+(7196,68,72,2048,2,41459,1,2,1),
+(7197,68,72,2048,2,41459,2,2,1),
+(7198,68,72,4096,2,41459,0,2,1),
+(7199,68,72,4096,2,41459,1,2,1),
+(7200,68,72,4096,2,41459,2,2,1),
+(7201,68,72,8192,2,41459,0,2,1),
+(7202,68,72,8192,2,41459,1,2,1),
+(7203,68,72,8192,2,41459,2,2,1),
+(7204,68,72,32,2,41459,0,5,1),
+(7205,68,72,32,2,41459,1,5,1),
+(7206,68,72,32,2,41459,2,5,1),
+(7207,68,72,512,2,41459,0,5,1),
+(7208,68,72,512,2,41459,1,5,1),
+(7209,68,72,512,2,41459,2,5,1),
+(7210,68,72,2,2,41459,0,4,1),
+(7211,68,72,2,2,41459,1,4,1),
+(7212,68,72,2,2,41459,2,4,1),
+(7213,62,69,0,2,41459,0,7,1),
+(7214,62,69,1,2,41459,0,3,1),
+(7215,62,69,1,2,41459,1,3,1),
+(7216,62,69,1,2,41459,2,3,1),
+(7217,62,69,16,2,41459,0,2,1),
+(7218,62,69,16,2,41459,1,2,1),
+(7219,62,69,16,2,41459,2,2,1),
+(7220,62,69,128,2,41459,0,7,1),
+(7221,62,69,128,2,41459,1,7,1),
+(7222,62,69,128,2,41459,2,7,1),
+(7223,62,69,256,2,41459,0,7,1),
+(7224,62,69,256,2,41459,1,7,1),
+(7225,62,69,256,2,41459,2,7,1),
+(7226,62,69,1024,2,41459,0,7,1),
+(7227,62,69,1024,2,41459,1,7,1),
+(7228,62,69,1024,2,41459,2,7,1),
+(7229,62,69,2048,2,41459,0,2,1),
+(7230,62,69,2048,2,41459,1,2,1),
+(7231,62,69,2048,2,41459,2,2,1),
+(7232,62,69,4096,2,41459,0,2,1),
+(7233,62,69,4096,2,41459,1,2,1),
+(7234,62,69,4096,2,41459,2,2,1),
+(7235,62,69,8192,2,41459,0,2,1),
+(7236,62,69,8192,2,41459,1,2,1),
+(7237,62,69,8192,2,41459,2,2,1),
+(7238,62,69,32,2,41459,0,5,1),
+(7239,62,69,32,2,41459,1,5,1),
+(7240,62,69,32,2,41459,2,5,1),
+(7241,62,69,512,2,41459,0,5,1),
+(7242,62,69,512,2,41459,1,5,1),
+(7243,62,69,512,2,41459,2,5,1),
+(7244,62,69,2,2,41459,0,4,1),
+(7245,62,69,2,2,41459,1,4,1),
+(7246,62,69,2,2,41459,2,4,1),
+(7247,70,75,0,2,41459,0,7,1),
+(7248,70,75,1,2,41459,0,3,1),
+(7249,70,75,1,2,41459,1,3,1),
+(7250,70,75,1,2,41459,2,3,1),
+(7251,70,75,16,2,41459,0,2,1),
+(7252,70,75,16,2,41459,1,2,1),
+(7253,70,75,16,2,41459,2,2,1),
+(7254,70,75,128,2,41459,0,7,1),
+(7255,70,75,128,2,41459,1,7,1),
+(7256,70,75,128,2,41459,2,7,1),
+(7257,70,75,256,2,41459,0,7,1),
+(7258,70,75,256,2,41459,1,7,1),
+(7259,70,75,256,2,41459,2,7,1),
+(7260,70,75,1024,2,41459,0,7,1),
+(7261,70,75,1024,2,41459,1,7,1),
+(7262,70,75,1024,2,41459,2,7,1),
+(7263,70,75,2048,2,41459,0,2,1),
+(7264,70,75,2048,2,41459,1,2,1),
+(7265,70,75,2048,2,41459,2,2,1),
+(7266,70,75,4096,2,41459,0,2,1),
+(7267,70,75,4096,2,41459,1,2,1),
+(7268,70,75,4096,2,41459,2,2,1),
+(7269,70,75,8192,2,41459,0,2,1),
+(7270,70,75,8192,2,41459,1,2,1),
+(7271,70,75,8192,2,41459,2,2,1),
+(7272,70,75,32,2,41459,0,5,1),
+(7273,70,75,32,2,41459,1,5,1),
+(7274,70,75,32,2,41459,2,5,1),
+(7275,70,75,512,2,41459,0,5,1),
+(7276,70,75,512,2,41459,1,5,1),
+(7277,70,75,512,2,41459,2,5,1),
+(7278,70,75,2,2,41459,0,4,1),
+(7279,70,75,2,2,41459,1,4,1),
+(7280,70,75,2,2,41459,2,4,1),
+(7281,64,71,0,2,41459,0,7,1),
+(7282,64,71,1,2,41459,0,3,1),
+(7283,64,71,1,2,41459,1,3,1),
+(7284,64,71,1,2,41459,2,3,1),
+(7285,64,71,16,2,41459,0,2,1),
+(7286,64,71,16,2,41459,1,2,1),
+(7287,64,71,16,2,41459,2,2,1),
+(7288,64,71,128,2,41459,0,7,1),
+(7289,64,71,128,2,41459,1,7,1),
+(7290,64,71,128,2,41459,2,7,1),
+(7291,64,71,256,2,41459,0,7,1),
+(7292,64,71,256,2,41459,1,7,1),
+(7293,64,71,256,2,41459,2,7,1),
+(7294,64,71,1024,2,41459,0,7,1),
+(7295,64,71,1024,2,41459,1,7,1),
+(7296,64,71,1024,2,41459,2,7,1),
+(7297,64,71,2048,2,41459,0,2,1),
+(7298,64,71,2048,2,41459,1,2,1),
+(7299,64,71,2048,2,41459,2,2,1),
+(7300,64,71,4096,2,41459,0,2,1),
+(7301,64,71,4096,2,41459,1,2,1),
+(7302,64,71,4096,2,41459,2,2,1),
+(7303,64,71,8192,2,41459,0,2,1),
+(7304,64,71,8192,2,41459,1,2,1),
+(7305,64,71,8192,2,41459,2,2,1),
+(7306,64,71,32,2,41459,0,5,1),
+(7307,64,71,32,2,41459,1,5,1),
+(7308,64,71,32,2,41459,2,5,1),
+(7309,64,71,512,2,41459,0,5,1),
+(7310,64,71,512,2,41459,1,5,1),
+(7311,64,71,512,2,41459,2,5,1),
+(7312,64,71,2,2,41459,0,4,1),
+(7313,64,71,2,2,41459,1,4,1),
+(7314,64,71,2,2,41459,2,4,1),
+(7315,35,83,0,2,41459,0,7,1),
+(7316,35,83,1,2,41459,0,3,1),
+(7317,35,83,1,2,41459,1,3,1),
+(7318,35,83,1,2,41459,2,3,1),
+(7319,35,83,16,2,41459,0,2,1),
+(7320,35,83,16,2,41459,1,2,1),
+(7321,35,83,16,2,41459,2,2,1),
+(7322,35,83,128,2,41459,0,7,1),
+(7323,35,83,128,2,41459,1,7,1),
+(7324,35,83,128,2,41459,2,7,1),
+(7325,35,83,256,2,41459,0,7,1),
+(7326,35,83,256,2,41459,1,7,1),
+(7327,35,83,256,2,41459,2,7,1),
+(7328,35,83,1024,2,41459,0,7,1),
+(7329,35,83,1024,2,41459,1,7,1),
+(7330,35,83,1024,2,41459,2,7,1),
+(7331,35,83,2048,2,41459,0,2,1),
+(7332,35,83,2048,2,41459,1,2,1),
+(7333,35,83,2048,2,41459,2,2,1),
+(7334,35,83,4096,2,41459,0,2,1),
+(7335,35,83,4096,2,41459,1,2,1),
+(7336,35,83,4096,2,41459,2,2,1),
+(7337,35,83,8192,2,41459,0,2,1),
+(7338,35,83,8192,2,41459,1,2,1),
+(7339,35,83,8192,2,41459,2,2,1),
+(7340,35,83,32,2,41459,0,5,1),
+(7341,35,83,32,2,41459,1,5,1),
+(7342,35,83,32,2,41459,2,5,1),
+(7343,35,83,512,2,41459,0,5,1),
+(7344,35,83,512,2,41459,1,5,1),
+(7345,35,83,512,2,41459,2,5,1),
+(7346,35,83,2,2,41459,0,4,1),
+(7347,35,83,2,2,41459,1,4,1),
+(7348,35,83,2,2,41459,2,4,1),
+(7349,35,73,0,2,41459,0,32,1),
+(7350,35,73,4,2,41459,0,32,1),
+(7351,35,73,4,2,41459,1,32,1),
+(7352,35,73,4,2,41459,2,32,1),
+(7353,35,73,8,2,41459,0,32,1),
+(7354,35,73,8,2,41459,1,32,1),
+(7355,35,73,8,2,41459,2,32,1),
+(7356,35,73,64,2,41459,0,32,1),
+(7357,35,73,64,2,41459,1,32,1),
+(7358,35,73,64,2,41459,2,32,1),
+(7359,35,73,128,2,41459,0,32,1),
+(7360,35,73,128,2,41459,1,32,1),
+(7361,35,73,128,2,41459,2,32,1),
+(7362,35,73,256,2,41459,0,32,1),
+(7363,35,73,256,2,41459,1,32,1),
+(7364,35,73,256,2,41459,2,32,1),
+(7365,35,73,512,2,41459,0,32,1),
+(7366,35,73,512,2,41459,1,32,1),
+(7367,35,73,512,2,41459,2,32,1),
+(7368,35,73,0,2,41459,0,7,1),
+(7369,35,73,1,2,41459,0,3,1),
+(7370,35,73,1,2,41459,1,3,1),
+(7371,35,73,1,2,41459,2,3,1),
+(7372,35,73,16,2,41459,0,2,1),
+(7373,35,73,16,2,41459,1,2,1),
+(7374,35,73,16,2,41459,2,2,1),
+(7375,35,73,128,2,41459,0,7,1),
+(7376,35,73,128,2,41459,1,7,1),
+(7377,35,73,128,2,41459,2,7,1),
+(7378,35,73,256,2,41459,0,7,1),
+(7379,35,73,256,2,41459,1,7,1),
+(7380,35,73,256,2,41459,2,7,1),
+(7381,35,73,1024,2,41459,0,7,1),
+(7382,35,73,1024,2,41459,1,7,1),
+(7383,35,73,1024,2,41459,2,7,1),
+(7384,35,73,2048,2,41459,0,2,1),
+(7385,35,73,2048,2,41459,1,2,1),
+(7386,35,73,2048,2,41459,2,2,1),
+(7387,35,73,4096,2,41459,0,2,1),
+(7388,35,73,4096,2,41459,1,2,1),
+(7389,35,73,4096,2,41459,2,2,1),
+(7390,35,73,8192,2,41459,0,2,1),
+(7391,35,73,8192,2,41459,1,2,1),
+(7392,35,73,8192,2,41459,2,2,1),
+(7393,35,73,32,2,41459,0,5,1),
+(7394,35,73,32,2,41459,1,5,1),
+(7395,35,73,32,2,41459,2,5,1),
+(7396,35,73,512,2,41459,0,5,1),
+(7397,35,73,512,2,41459,1,5,1),
+(7398,35,73,512,2,41459,2,5,1),
+(7399,35,73,2,2,41459,0,4,1),
+(7400,35,73,2,2,41459,1,4,1),
+(7401,35,73,2,2,41459,2,4,1),
+(7402,50,59,0,2,164291,0,7,1),
+(7403,50,59,1,2,164291,0,3,1),
+(7404,50,59,1,2,164291,1,3,1),
+(7405,50,59,1,2,164291,2,3,1),
+(7406,50,59,16,2,164291,0,2,1),
+(7407,50,59,16,2,164291,1,2,1),
+(7408,50,59,16,2,164291,2,2,1),
+(7409,50,59,128,2,164291,0,7,1),
+(7410,50,59,128,2,164291,1,7,1),
+(7411,50,59,128,2,164291,2,7,1),
+(7412,50,59,256,2,164291,0,7,1),
+(7413,50,59,256,2,164291,1,7,1),
+(7414,50,59,256,2,164291,2,7,1),
+(7415,50,59,1024,2,164291,0,7,1),
+(7416,50,59,1024,2,164291,1,7,1),
+(7417,50,59,1024,2,164291,2,7,1),
+(7418,50,59,2048,2,164291,0,2,1),
+(7419,50,59,2048,2,164291,1,2,1),
+(7420,50,59,2048,2,164291,2,2,1),
+(7421,50,59,4096,2,164291,0,2,1),
+(7422,50,59,4096,2,164291,1,2,1),
+(7423,50,59,4096,2,164291,2,2,1),
+(7424,50,59,8192,2,164291,0,2,1),
+(7425,50,59,8192,2,164291,1,2,1),
+(7426,50,59,8192,2,164291,2,2,1),
+(7427,50,59,32,2,164291,0,5,1),
+(7428,50,59,32,2,164291,1,5,1),
+(7429,50,59,32,2,164291,2,5,1),
+(7430,50,59,512,2,164291,0,5,1),
+(7431,50,59,512,2,164291,1,5,1),
+(7432,50,59,512,2,164291,2,5,1),
+(7433,50,59,2,2,164291,0,4,1),
+(7434,50,59,2,2,164291,1,4,1),
+(7435,50,59,2,2,164291,2,4,1),
+(7436,60,74,0,2,164291,0,7,1),
+(7437,60,74,1,2,164291,0,3,1),
+(7438,60,74,1,2,164291,1,3,1),
+(7439,60,74,1,2,164291,2,3,1),
+(7440,60,74,16,2,164291,0,2,1),
+(7441,60,74,16,2,164291,1,2,1),
+(7442,60,74,16,2,164291,2,2,1),
+(7443,60,74,128,2,164291,0,7,1),
+(7444,60,74,128,2,164291,1,7,1),
+(7445,60,74,128,2,164291,2,7,1),
+(7446,60,74,256,2,164291,0,7,1),
+(7447,60,74,256,2,164291,1,7,1),
+(7448,60,74,256,2,164291,2,7,1),
+(7449,60,74,1024,2,164291,0,7,1),
+(7450,60,74,1024,2,164291,1,7,1),
+(7451,60,74,1024,2,164291,2,7,1),
+(7452,60,74,2048,2,164291,0,2,1),
+(7453,60,74,2048,2,164291,1,2,1),
+(7454,60,74,2048,2,164291,2,2,1),
+(7455,60,74,4096,2,164291,0,2,1),
+(7456,60,74,4096,2,164291,1,2,1),
+(7457,60,74,4096,2,164291,2,2,1),
+(7458,60,74,8192,2,164291,0,2,1),
+(7459,60,74,8192,2,164291,1,2,1),
+(7460,60,74,8192,2,164291,2,2,1),
+(7461,60,74,32,2,164291,0,5,1),
+(7462,60,74,32,2,164291,1,5,1),
+(7463,60,74,32,2,164291,2,5,1),
+(7464,60,74,512,2,164291,0,5,1),
+(7465,60,74,512,2,164291,1,5,1),
+(7466,60,74,512,2,164291,2,5,1),
+(7467,60,74,2,2,164291,0,4,1),
+(7468,60,74,2,2,164291,1,4,1),
+(7469,60,74,2,2,164291,2,4,1),
+(7470,55,70,0,2,327692,0,23,1),
+(7471,55,70,1,2,327692,0,3,1),
+(7472,55,70,1,2,327692,1,3,1),
+(7473,55,70,1,2,327692,2,3,1),
+(7474,55,70,16,2,327692,0,2,1),
+(7475,55,70,16,2,327692,1,2,1),
+(7476,55,70,16,2,327692,2,2,1),
+(7477,55,70,128,2,327692,0,23,1),
+(7478,55,70,128,2,327692,1,23,1),
+(7479,55,70,128,2,327692,2,23,1),
+(7480,55,70,256,2,327692,0,23,1),
+(7481,55,70,256,2,327692,1,23,1),
+(7482,55,70,256,2,327692,2,23,1),
+(7483,55,70,1024,2,327692,0,7,1),
+(7484,55,70,1024,2,327692,1,7,1),
+(7485,55,70,1024,2,327692,2,7,1),
+(7486,55,70,2048,2,327692,0,2,1),
+(7487,55,70,2048,2,327692,1,2,1),
+(7488,55,70,2048,2,327692,2,2,1),
+(7489,55,70,4096,2,327692,0,2,1),
+(7490,55,70,4096,2,327692,1,2,1),
+(7491,55,70,4096,2,327692,2,2,1),
+(7492,55,70,8192,2,327692,0,2,1),
+(7493,55,70,8192,2,327692,1,2,1),
+(7494,55,70,8192,2,327692,2,2,1),
+(7495,55,70,32,2,327692,0,21,1),
+(7496,55,70,32,2,327692,1,21,1),
+(7497,55,70,32,2,327692,2,21,1),
+(7498,55,70,512,2,327692,0,21,1),
+(7499,55,70,512,2,327692,1,21,1),
+(7500,55,70,512,2,327692,2,21,1),
+(7501,55,70,2,2,327692,0,20,1),
+(7502,55,70,2,2,327692,1,20,1),
+(7503,55,70,2,2,327692,2,20,1),
+(7504,55,70,0,2,327692,0,23,1),
+(7505,55,70,1,2,327692,0,3,1),
+(7506,55,70,1,2,327692,1,3,1),
+(7507,55,70,1,2,327692,2,3,1),
+(7508,55,70,16,2,327692,0,2,1),
+(7509,55,70,16,2,327692,1,2,1),
+(7510,55,70,16,2,327692,2,2,1),
+(7511,55,70,128,2,327692,0,23,1),
+(7512,55,70,128,2,327692,1,23,1),
+(7513,55,70,128,2,327692,2,23,1),
+(7514,55,70,256,2,327692,0,23,1),
+(7515,55,70,256,2,327692,1,23,1),
+(7516,55,70,256,2,327692,2,23,1),
+(7517,55,70,1024,2,327692,0,7,1),
+(7518,55,70,1024,2,327692,1,7,1),
+(7519,55,70,1024,2,327692,2,7,1),
+(7520,55,70,2048,2,327692,0,2,1),
+(7521,55,70,2048,2,327692,1,2,1),
+(7522,55,70,2048,2,327692,2,2,1),
+(7523,55,70,4096,2,327692,0,2,1),
+(7524,55,70,4096,2,327692,1,2,1),
+(7525,55,70,4096,2,327692,2,2,1),
+(7526,55,70,8192,2,327692,0,2,1),
+(7527,55,70,8192,2,327692,1,2,1),
+(7528,55,70,8192,2,327692,2,2,1),
+(7529,55,70,32,2,327692,0,21,1),
+(7530,55,70,32,2,327692,1,21,1),
+(7531,55,70,32,2,327692,2,21,1),
+(7532,55,70,512,2,327692,0,21,1),
+(7533,55,70,512,2,327692,1,21,1),
+(7534,55,70,512,2,327692,2,21,1),
+(7535,55,70,2,2,327692,0,20,1),
+(7536,55,70,2,2,327692,1,20,1),
+(7537,55,70,2,2,327692,2,20,1),
+(7538,60,83,0,2,327692,0,23,1),
+(7539,60,83,1,2,327692,0,3,1),
+(7540,60,83,1,2,327692,1,3,1),
+(7541,60,83,1,2,327692,2,3,1),
+(7542,60,83,16,2,327692,0,2,1),
+(7543,60,83,16,2,327692,1,2,1),
+(7544,60,83,16,2,327692,2,2,1),
+(7545,60,83,128,2,327692,0,23,1),
+(7546,60,83,128,2,327692,1,23,1),
+(7547,60,83,128,2,327692,2,23,1),
+(7548,60,83,256,2,327692,0,23,1),
+(7549,60,83,256,2,327692,1,23,1),
+(7550,60,83,256,2,327692,2,23,1),
+(7551,60,83,1024,2,327692,0,7,1),
+(7552,60,83,1024,2,327692,1,7,1),
+(7553,60,83,1024,2,327692,2,7,1),
+(7554,60,83,2048,2,327692,0,2,1),
+(7555,60,83,2048,2,327692,1,2,1),
+(7556,60,83,2048,2,327692,2,2,1),
+(7557,60,83,4096,2,327692,0,2,1),
+(7558,60,83,4096,2,327692,1,2,1),
+(7559,60,83,4096,2,327692,2,2,1),
+(7560,60,83,8192,2,327692,0,2,1),
+(7561,60,83,8192,2,327692,1,2,1),
+(7562,60,83,8192,2,327692,2,2,1),
+(7563,60,83,32,2,327692,0,21,1),
+(7564,60,83,32,2,327692,1,21,1),
+(7565,60,83,32,2,327692,2,21,1),
+(7566,60,83,512,2,327692,0,21,1),
+(7567,60,83,512,2,327692,1,21,1),
+(7568,60,83,512,2,327692,2,21,1),
+(7569,60,83,2,2,327692,0,20,1),
+(7570,60,83,2,2,327692,1,20,1),
+(7571,60,83,2,2,327692,2,20,1),
+(7572,50,59,0,2,9264,0,7,1),
+(7573,50,59,1,2,9264,0,3,1),
+(7574,50,59,1,2,9264,1,3,1),
+(7575,50,59,1,2,9264,2,3,1),
+(7576,50,59,16,2,9264,0,2,1),
+(7577,50,59,16,2,9264,1,2,1),
+(7578,50,59,16,2,9264,2,2,1),
+(7579,50,59,128,2,9264,0,7,1),
+(7580,50,59,128,2,9264,1,7,1),
+(7581,50,59,128,2,9264,2,7,1),
+(7582,50,59,256,2,9264,0,7,1),
+(7583,50,59,256,2,9264,1,7,1),
+(7584,50,59,256,2,9264,2,7,1),
+(7585,50,59,1024,2,9264,0,7,1),
+(7586,50,59,1024,2,9264,1,7,1),
+(7587,50,59,1024,2,9264,2,7,1),
+(7588,50,59,2048,2,9264,0,2,1),
+(7589,50,59,2048,2,9264,1,2,1),
+(7590,50,59,2048,2,9264,2,2,1),
+(7591,50,59,4096,2,9264,0,2,1),
+(7592,50,59,4096,2,9264,1,2,1),
+(7593,50,59,4096,2,9264,2,2,1),
+(7594,50,59,8192,2,9264,0,2,1),
+(7595,50,59,8192,2,9264,1,2,1),
+(7596,50,59,8192,2,9264,2,2,1),
+(7597,50,59,32,2,9264,0,5,1),
+(7598,50,59,32,2,9264,1,5,1),
+(7599,50,59,32,2,9264,2,5,1),
+(7600,50,59,512,2,9264,0,5,1),
+(7601,50,59,512,2,9264,1,5,1),
+(7602,50,59,512,2,9264,2,5,1),
+(7603,50,59,2,2,9264,0,4,1),
+(7604,50,59,2,2,9264,1,4,1),
+(7605,50,59,2,2,9264,2,4,1),
+(7606,60,74,0,2,9264,0,7,1),
+(7607,60,74,1,2,9264,0,3,1),
+(7608,60,74,1,2,9264,1,3,1),
+(7609,60,74,1,2,9264,2,3,1),
+(7610,60,74,16,2,9264,0,2,1),
+(7611,60,74,16,2,9264,1,2,1),
+(7612,60,74,16,2,9264,2,2,1),
+(7613,60,74,128,2,9264,0,7,1),
+(7614,60,74,128,2,9264,1,7,1),
+(7615,60,74,128,2,9264,2,7,1),
+(7616,60,74,256,2,9264,0,7,1),
+(7617,60,74,256,2,9264,1,7,1),
+(7618,60,74,256,2,9264,2,7,1),
+(7619,60,74,1024,2,9264,0,7,1),
+(7620,60,74,1024,2,9264,1,7,1),
+(7621,60,74,1024,2,9264,2,7,1),
+(7622,60,74,2048,2,9264,0,2,1),
+(7623,60,74,2048,2,9264,1,2,1),
+(7624,60,74,2048,2,9264,2,2,1),
+(7625,60,74,4096,2,9264,0,2,1),
+(7626,60,74,4096,2,9264,1,2,1),
+(7627,60,74,4096,2,9264,2,2,1),
+(7628,60,74,8192,2,9264,0,2,1),
+(7629,60,74,8192,2,9264,1,2,1),
+(7630,60,74,8192,2,9264,2,2,1),
+(7631,60,74,32,2,9264,0,5,1),
+(7632,60,74,32,2,9264,1,5,1),
+(7633,60,74,32,2,9264,2,5,1),
+(7634,60,74,512,2,9264,0,5,1),
+(7635,60,74,512,2,9264,1,5,1),
+(7636,60,74,512,2,9264,2,5,1),
+(7637,60,74,2,2,9264,0,4,1),
+(7638,60,74,2,2,9264,1,4,1),
+(7639,60,74,2,2,9264,2,4,1),
+(7640,65,73,0,2,41459,0,7,1),
+(7641,65,73,1,2,41459,0,3,1),
+(7642,65,73,1,2,41459,1,3,1),
+(7643,65,73,1,2,41459,2,3,1),
+(7644,65,73,16,2,41459,0,2,1),
+(7645,65,73,16,2,41459,1,2,1),
+(7646,65,73,16,2,41459,2,2,1),
+(7647,65,73,128,2,41459,0,7,1),
+(7648,65,73,128,2,41459,1,7,1),
+(7649,65,73,128,2,41459,2,7,1),
+(7650,65,73,256,2,41459,0,7,1),
+(7651,65,73,256,2,41459,1,7,1),
+(7652,65,73,256,2,41459,2,7,1),
+(7653,65,73,1024,2,41459,0,7,1),
+(7654,65,73,1024,2,41459,1,7,1),
+(7655,65,73,1024,2,41459,2,7,1),
+(7656,65,73,2048,2,41459,0,2,1),
+(7657,65,73,2048,2,41459,1,2,1),
+(7658,65,73,2048,2,41459,2,2,1),
+(7659,65,73,4096,2,41459,0,2,1),
+(7660,65,73,4096,2,41459,1,2,1),
+(7661,65,73,4096,2,41459,2,2,1),
+(7662,65,73,8192,2,41459,0,2,1),
+(7663,65,73,8192,2,41459,1,2,1),
+(7664,65,73,8192,2,41459,2,2,1),
+(7665,65,73,32,2,41459,0,5,1),
+(7666,65,73,32,2,41459,1,5,1),
+(7667,65,73,32,2,41459,2,5,1),
+(7668,65,73,512,2,41459,0,5,1),
+(7669,65,73,512,2,41459,1,5,1),
+(7670,65,73,512,2,41459,2,5,1),
+(7671,65,73,2,2,41459,0,4,1),
+(7672,65,73,2,2,41459,1,4,1),
+(7673,65,73,2,2,41459,2,4,1),
+(7674,50,69,0,2,41459,0,7,1),
+(7675,50,69,1,2,41459,0,3,1),
+(7676,50,69,1,2,41459,1,3,1),
+(7677,50,69,1,2,41459,2,3,1),
+(7678,50,69,16,2,41459,0,2,1),
+(7679,50,69,16,2,41459,1,2,1),
+(7680,50,69,16,2,41459,2,2,1),
+(7681,50,69,128,2,41459,0,7,1),
+(7682,50,69,128,2,41459,1,7,1),
+(7683,50,69,128,2,41459,2,7,1),
+(7684,50,69,256,2,41459,0,7,1),
+(7685,50,69,256,2,41459,1,7,1),
+(7686,50,69,256,2,41459,2,7,1),
+(7687,50,69,1024,2,41459,0,7,1),
+(7688,50,69,1024,2,41459,1,7,1),
+(7689,50,69,1024,2,41459,2,7,1),
+(7690,50,69,2048,2,41459,0,2,1),
+(7691,50,69,2048,2,41459,1,2,1),
+(7692,50,69,2048,2,41459,2,2,1),
+(7693,50,69,4096,2,41459,0,2,1),
+(7694,50,69,4096,2,41459,1,2,1),
+(7695,50,69,4096,2,41459,2,2,1),
+(7696,50,69,8192,2,41459,0,2,1),
+(7697,50,69,8192,2,41459,1,2,1),
+(7698,50,69,8192,2,41459,2,2,1),
+(7699,50,69,32,2,41459,0,5,1),
+(7700,50,69,32,2,41459,1,5,1),
+(7701,50,69,32,2,41459,2,5,1),
+(7702,50,69,512,2,41459,0,5,1),
+(7703,50,69,512,2,41459,1,5,1),
+(7704,50,69,512,2,41459,2,5,1),
+(7705,50,69,2,2,41459,0,4,1),
+(7706,50,69,2,2,41459,1,4,1),
+(7707,50,69,2,2,41459,2,4,1),
+(7708,75,83,0,2,41459,0,5,1),
+(7709,75,83,1,2,41459,0,1,1),
+(7710,75,83,1,2,41459,1,1,1),
+(7711,75,83,1,2,41459,2,1,1),
+(7712,75,83,32,2,41459,0,5,1),
+(7713,75,83,32,2,41459,1,5,1),
+(7714,75,83,32,2,41459,2,5,1),
+(7715,75,83,128,2,41459,0,5,1),
+(7716,75,83,128,2,41459,1,5,1),
+(7717,75,83,128,2,41459,2,5,1),
+(7718,75,83,256,2,41459,0,5,1),
+(7719,75,83,256,2,41459,1,5,1),
+(7720,75,83,256,2,41459,2,5,1),
+(7721,75,83,512,2,41459,0,5,1),
+(7722,75,83,512,2,41459,1,5,1),
+(7723,75,83,512,2,41459,2,5,1),
+(7724,75,83,1024,2,41459,0,5,1),
+(7725,75,83,1024,2,41459,1,5,1),
+(7726,75,83,1024,2,41459,2,5,1),
+(7727,75,83,2,2,41459,0,4,1),
+(7728,75,83,2,2,41459,1,4,1),
+(7729,75,83,2,2,41459,2,4,1),
+(7730,30,45,0,2,41459,0,7,1),
+(7731,30,45,1,2,41459,0,3,1),
+(7732,30,45,1,2,41459,1,3,1),
+(7733,30,45,1,2,41459,2,3,1),
+(7734,30,45,16,2,41459,0,2,1),
+(7735,30,45,16,2,41459,1,2,1),
+(7736,30,45,16,2,41459,2,2,1),
+(7737,30,45,128,2,41459,0,7,1),
+(7738,30,45,128,2,41459,1,7,1),
+(7739,30,45,128,2,41459,2,7,1),
+(7740,30,45,256,2,41459,0,7,1),
+(7741,30,45,256,2,41459,1,7,1),
+(7742,30,45,256,2,41459,2,7,1),
+(7743,30,45,1024,2,41459,0,7,1),
+(7744,30,45,1024,2,41459,1,7,1),
+(7745,30,45,1024,2,41459,2,7,1),
+(7746,30,45,2048,2,41459,0,2,1),
+(7747,30,45,2048,2,41459,1,2,1),
+(7748,30,45,2048,2,41459,2,2,1),
+(7749,30,45,4096,2,41459,0,2,1),
+(7750,30,45,4096,2,41459,1,2,1),
+(7751,30,45,4096,2,41459,2,2,1),
+(7752,30,45,8192,2,41459,0,2,1),
+(7753,30,45,8192,2,41459,1,2,1),
+(7754,30,45,8192,2,41459,2,2,1),
+(7755,30,45,32,2,41459,0,5,1),
+(7756,30,45,32,2,41459,1,5,1),
+(7757,30,45,32,2,41459,2,5,1),
+(7758,30,45,512,2,41459,0,5,1),
+(7759,30,45,512,2,41459,1,5,1),
+(7760,30,45,512,2,41459,2,5,1),
+(7761,30,45,2,2,41459,0,4,1),
+(7762,30,45,2,2,41459,1,4,1),
+(7763,30,45,2,2,41459,2,4,1),
+(7764,70,83,0,2,41459,0,7,1),
+(7765,70,83,1,2,41459,0,3,1),
+(7766,70,83,1,2,41459,1,3,1),
+(7767,70,83,1,2,41459,2,3,1),
+(7768,70,83,16,2,41459,0,2,1),
+(7769,70,83,16,2,41459,1,2,1),
+(7770,70,83,16,2,41459,2,2,1),
+(7771,70,83,128,2,41459,0,7,1),
+(7772,70,83,128,2,41459,1,7,1),
+(7773,70,83,128,2,41459,2,7,1),
+(7774,70,83,256,2,41459,0,7,1),
+(7775,70,83,256,2,41459,1,7,1),
+(7776,70,83,256,2,41459,2,7,1),
+(7777,70,83,1024,2,41459,0,7,1),
+(7778,70,83,1024,2,41459,1,7,1),
+(7779,70,83,1024,2,41459,2,7,1),
+(7780,70,83,2048,2,41459,0,2,1),
+(7781,70,83,2048,2,41459,1,2,1),
+(7782,70,83,2048,2,41459,2,2,1),
+(7783,70,83,4096,2,41459,0,2,1),
+(7784,70,83,4096,2,41459,1,2,1),
+(7785,70,83,4096,2,41459,2,2,1),
+(7786,70,83,8192,2,41459,0,2,1),
+(7787,70,83,8192,2,41459,1,2,1),
+(7788,70,83,8192,2,41459,2,2,1),
+(7789,70,83,32,2,41459,0,5,1),
+(7790,70,83,32,2,41459,1,5,1),
+(7791,70,83,32,2,41459,2,5,1),
+(7792,70,83,512,2,41459,0,5,1),
+(7793,70,83,512,2,41459,1,5,1),
+(7794,70,83,512,2,41459,2,5,1),
+(7795,70,83,2,2,41459,0,4,1),
+(7796,70,83,2,2,41459,1,4,1),
+(7797,70,83,2,2,41459,2,4,1),
+(7798,73,80,0,2,41459,0,5,1),
+(7799,73,80,1,2,41459,0,1,1),
+(7800,73,80,1,2,41459,1,1,1),
+(7801,73,80,1,2,41459,2,1,1),
+(7802,73,80,32,2,41459,0,5,1),
+(7803,73,80,32,2,41459,1,5,1),
+(7804,73,80,32,2,41459,2,5,1),
+(7805,73,80,128,2,41459,0,5,1),
+(7806,73,80,128,2,41459,1,5,1),
+(7807,73,80,128,2,41459,2,5,1),
+(7808,73,80,256,2,41459,0,5,1),
+(7809,73,80,256,2,41459,1,5,1),
+(7810,73,80,256,2,41459,2,5,1),
+(7811,73,80,512,2,41459,0,5,1),
+(7812,73,80,512,2,41459,1,5,1),
+(7813,73,80,512,2,41459,2,5,1),
+(7814,73,80,1024,2,41459,0,5,1),
+(7815,73,80,1024,2,41459,1,5,1),
+(7816,73,80,1024,2,41459,2,5,1),
+(7817,73,80,2,2,41459,0,4,1),
+(7818,73,80,2,2,41459,1,4,1),
+(7819,73,80,2,2,41459,2,4,1),
+(7820,77,83,0,2,41459,0,7,1),
+(7821,77,83,1,2,41459,0,3,1),
+(7822,77,83,1,2,41459,1,3,1),
+(7823,77,83,1,2,41459,2,3,1),
+(7824,77,83,16,2,41459,0,2,1),
+(7825,77,83,16,2,41459,1,2,1),
+(7826,77,83,16,2,41459,2,2,1),
+(7827,77,83,128,2,41459,0,7,1),
+(7828,77,83,128,2,41459,1,7,1),
+(7829,77,83,128,2,41459,2,7,1),
+(7830,77,83,256,2,41459,0,7,1),
+(7831,77,83,256,2,41459,1,7,1),
+(7832,77,83,256,2,41459,2,7,1),
+(7833,77,83,1024,2,41459,0,7,1),
+(7834,77,83,1024,2,41459,1,7,1),
+(7835,77,83,1024,2,41459,2,7,1),
+(7836,77,83,2048,2,41459,0,2,1),
+(7837,77,83,2048,2,41459,1,2,1),
+(7838,77,83,2048,2,41459,2,2,1),
+(7839,77,83,4096,2,41459,0,2,1),
+(7840,77,83,4096,2,41459,1,2,1),
+(7841,77,83,4096,2,41459,2,2,1),
+(7842,77,83,8192,2,41459,0,2,1),
+(7843,77,83,8192,2,41459,1,2,1),
+(7844,77,83,8192,2,41459,2,2,1),
+(7845,77,83,32,2,41459,0,5,1),
+(7846,77,83,32,2,41459,1,5,1),
+(7847,77,83,32,2,41459,2,5,1),
+(7848,77,83,512,2,41459,0,5,1),
+(7849,77,83,512,2,41459,1,5,1),
+(7850,77,83,512,2,41459,2,5,1),
+(7851,77,83,2,2,41459,0,4,1),
+(7852,77,83,2,2,41459,1,4,1),
+(7853,77,83,2,2,41459,2,4,1),
+(7854,60,72,0,2,41459,0,39,1),
+(7855,60,72,1,2,41459,0,3,1),
+(7856,60,72,1,2,41459,1,3,1),
+(7857,60,72,1,2,41459,2,3,1),
+(7858,60,72,16,2,41459,0,2,1),
+(7859,60,72,16,2,41459,1,2,1),
+(7860,60,72,16,2,41459,2,2,1),
+(7861,60,72,128,2,41459,0,39,1),
+(7862,60,72,128,2,41459,1,39,1),
+(7863,60,72,128,2,41459,2,39,1),
+(7864,60,72,256,2,41459,0,39,1),
+(7865,60,72,256,2,41459,1,39,1),
+(7866,60,72,256,2,41459,2,39,1),
+(7867,60,72,1024,2,41459,0,7,1),
+(7868,60,72,1024,2,41459,1,7,1),
+(7869,60,72,1024,2,41459,2,7,1),
+(7870,60,72,2048,2,41459,0,2,1),
+(7871,60,72,2048,2,41459,1,2,1),
+(7872,60,72,2048,2,41459,2,2,1),
+(7873,60,72,4096,2,41459,0,2,1),
+(7874,60,72,4096,2,41459,1,2,1),
+(7875,60,72,4096,2,41459,2,2,1),
+(7876,60,72,8192,2,41459,0,2,1),
+(7877,60,72,8192,2,41459,1,2,1),
+(7878,60,72,8192,2,41459,2,2,1),
+(7879,60,72,32,2,41459,0,5,1),
+(7880,60,72,32,2,41459,1,5,1),
+(7881,60,72,32,2,41459,2,5,1),
+(7882,60,72,512,2,41459,0,37,1),
+(7883,60,72,512,2,41459,1,37,1),
+(7884,60,72,512,2,41459,2,37,1),
+(7885,60,72,2,2,41459,0,4,1),
+(7886,60,72,2,2,41459,1,4,1),
+(7887,60,72,2,2,41459,2,4,1),
+(7888,60,72,4,2,41459,0,32,1),
+(7889,60,72,4,2,41459,1,32,1),
+(7890,60,72,4,2,41459,2,32,1),
+(7891,60,72,8,2,41459,0,32,1),
+(7892,60,72,8,2,41459,1,32,1),
+(7893,60,72,8,2,41459,2,32,1),
+(7894,60,72,64,2,41459,0,32,1),
+(7895,60,72,64,2,41459,1,32,1),
+(7896,60,72,64,2,41459,2,32,1),
+(7897,55,59,0,2,41459,0,7,1),
+(7898,55,59,1,2,41459,0,3,1),
+(7899,55,59,1,2,41459,1,3,1),
+(7900,55,59,1,2,41459,2,3,1),
+(7901,55,59,16,2,41459,0,2,1),
+(7902,55,59,16,2,41459,1,2,1),
+(7903,55,59,16,2,41459,2,2,1),
+(7904,55,59,128,2,41459,0,7,1),
+(7905,55,59,128,2,41459,1,7,1),
+(7906,55,59,128,2,41459,2,7,1),
+(7907,55,59,256,2,41459,0,7,1),
+(7908,55,59,256,2,41459,1,7,1),
+(7909,55,59,256,2,41459,2,7,1),
+(7910,55,59,1024,2,41459,0,7,1),
+(7911,55,59,1024,2,41459,1,7,1),
+(7912,55,59,1024,2,41459,2,7,1),
+(7913,55,59,2048,2,41459,0,2,1),
+(7914,55,59,2048,2,41459,1,2,1),
+(7915,55,59,2048,2,41459,2,2,1),
+(7916,55,59,4096,2,41459,0,2,1),
+(7917,55,59,4096,2,41459,1,2,1),
+(7918,55,59,4096,2,41459,2,2,1),
+(7919,55,59,8192,2,41459,0,2,1),
+(7920,55,59,8192,2,41459,1,2,1),
+(7921,55,59,8192,2,41459,2,2,1),
+(7922,55,59,32,2,41459,0,5,1),
+(7923,55,59,32,2,41459,1,5,1),
+(7924,55,59,32,2,41459,2,5,1),
+(7925,55,59,512,2,41459,0,5,1),
+(7926,55,59,512,2,41459,1,5,1),
+(7927,55,59,512,2,41459,2,5,1),
+(7928,55,59,2,2,41459,0,4,1),
+(7929,55,59,2,2,41459,1,4,1),
+(7930,55,59,2,2,41459,2,4,1),
+(7931,60,69,0,2,41459,0,7,1),
+(7932,60,69,1,2,41459,0,3,1),
+(7933,60,69,1,2,41459,1,3,1),
+(7934,60,69,1,2,41459,2,3,1),
+(7935,60,69,16,2,41459,0,2,1),
+(7936,60,69,16,2,41459,1,2,1),
+(7937,60,69,16,2,41459,2,2,1),
+(7938,60,69,128,2,41459,0,7,1),
+(7939,60,69,128,2,41459,1,7,1),
+(7940,60,69,128,2,41459,2,7,1),
+(7941,60,69,256,2,41459,0,7,1),
+(7942,60,69,256,2,41459,1,7,1),
+(7943,60,69,256,2,41459,2,7,1),
+(7944,60,69,1024,2,41459,0,7,1),
+(7945,60,69,1024,2,41459,1,7,1),
+(7946,60,69,1024,2,41459,2,7,1),
+(7947,60,69,2048,2,41459,0,2,1),
+(7948,60,69,2048,2,41459,1,2,1),
+(7949,60,69,2048,2,41459,2,2,1),
+(7950,60,69,4096,2,41459,0,2,1),
+(7951,60,69,4096,2,41459,1,2,1),
+(7952,60,69,4096,2,41459,2,2,1),
+(7953,60,69,8192,2,41459,0,2,1),
+(7954,60,69,8192,2,41459,1,2,1),
+(7955,60,69,8192,2,41459,2,2,1),
+(7956,60,69,32,2,41459,0,5,1),
+(7957,60,69,32,2,41459,1,5,1),
+(7958,60,69,32,2,41459,2,5,1),
+(7959,60,69,512,2,41459,0,5,1),
+(7960,60,69,512,2,41459,1,5,1),
+(7961,60,69,512,2,41459,2,5,1),
+(7962,60,69,2,2,41459,0,4,1),
+(7963,60,69,2,2,41459,1,4,1),
+(7964,60,69,2,2,41459,2,4,1),
+(7965,70,74,0,2,41459,0,7,1),
+(7966,70,74,1,2,41459,0,3,1),
+(7967,70,74,1,2,41459,1,3,1),
+(7968,70,74,1,2,41459,2,3,1),
+(7969,70,74,16,2,41459,0,2,1),
+(7970,70,74,16,2,41459,1,2,1),
+(7971,70,74,16,2,41459,2,2,1),
+(7972,70,74,128,2,41459,0,7,1),
+(7973,70,74,128,2,41459,1,7,1),
+(7974,70,74,128,2,41459,2,7,1),
+(7975,70,74,256,2,41459,0,7,1),
+(7976,70,74,256,2,41459,1,7,1),
+(7977,70,74,256,2,41459,2,7,1),
+(7978,70,74,1024,2,41459,0,7,1),
+(7979,70,74,1024,2,41459,1,7,1),
+(7980,70,74,1024,2,41459,2,7,1),
+(7981,70,74,2048,2,41459,0,2,1),
+(7982,70,74,2048,2,41459,1,2,1),
+(7983,70,74,2048,2,41459,2,2,1),
+(7984,70,74,4096,2,41459,0,2,1),
+(7985,70,74,4096,2,41459,1,2,1),
+(7986,70,74,4096,2,41459,2,2,1),
+(7987,70,74,8192,2,41459,0,2,1),
+(7988,70,74,8192,2,41459,1,2,1),
+(7989,70,74,8192,2,41459,2,2,1),
+(7990,70,74,32,2,41459,0,5,1),
+(7991,70,74,32,2,41459,1,5,1),
+(7992,70,74,32,2,41459,2,5,1),
+(7993,70,74,512,2,41459,0,5,1),
+(7994,70,74,512,2,41459,1,5,1),
+(7995,70,74,512,2,41459,2,5,1),
+(7996,70,74,2,2,41459,0,4,1),
+(7997,70,74,2,2,41459,1,4,1),
+(7998,70,74,2,2,41459,2,4,1),
+(7999,75,79,0,2,41459,0,7,1),
+(8000,75,79,1,2,41459,0,3,1),
+(8001,75,79,1,2,41459,1,3,1),
+(8002,75,79,1,2,41459,2,3,1),
+(8003,75,79,16,2,41459,0,2,1),
+(8004,75,79,16,2,41459,1,2,1),
+(8005,75,79,16,2,41459,2,2,1),
+(8006,75,79,128,2,41459,0,7,1),
+(8007,75,79,128,2,41459,1,7,1),
+(8008,75,79,128,2,41459,2,7,1),
+(8009,75,79,256,2,41459,0,7,1),
+(8010,75,79,256,2,41459,1,7,1),
+(8011,75,79,256,2,41459,2,7,1),
+(8012,75,79,1024,2,41459,0,7,1),
+(8013,75,79,1024,2,41459,1,7,1),
+(8014,75,79,1024,2,41459,2,7,1),
+(8015,75,79,2048,2,41459,0,2,1),
+(8016,75,79,2048,2,41459,1,2,1),
+(8017,75,79,2048,2,41459,2,2,1),
+(8018,75,79,4096,2,41459,0,2,1),
+(8019,75,79,4096,2,41459,1,2,1),
+(8020,75,79,4096,2,41459,2,2,1),
+(8021,75,79,8192,2,41459,0,2,1),
+(8022,75,79,8192,2,41459,1,2,1),
+(8023,75,79,8192,2,41459,2,2,1),
+(8024,75,79,32,2,41459,0,5,1),
+(8025,75,79,32,2,41459,1,5,1),
+(8026,75,79,32,2,41459,2,5,1),
+(8027,75,79,512,2,41459,0,5,1),
+(8028,75,79,512,2,41459,1,5,1),
+(8029,75,79,512,2,41459,2,5,1),
+(8030,75,79,2,2,41459,0,4,1),
+(8031,75,79,2,2,41459,1,4,1),
+(8032,75,79,2,2,41459,2,4,1),
+(8033,80,83,0,2,41459,0,7,1),
+(8034,80,83,1,2,41459,0,3,1),
+(8035,80,83,1,2,41459,1,3,1),
+(8036,80,83,1,2,41459,2,3,1),
+(8037,80,83,16,2,41459,0,2,1),
+(8038,80,83,16,2,41459,1,2,1),
+(8039,80,83,16,2,41459,2,2,1),
+(8040,80,83,128,2,41459,0,7,1),
+(8041,80,83,128,2,41459,1,7,1),
+(8042,80,83,128,2,41459,2,7,1),
+(8043,80,83,256,2,41459,0,7,1),
+(8044,80,83,256,2,41459,1,7,1),
+(8045,80,83,256,2,41459,2,7,1),
+(8046,80,83,1024,2,41459,0,7,1),
+(8047,80,83,1024,2,41459,1,7,1),
+(8048,80,83,1024,2,41459,2,7,1),
+(8049,80,83,2048,2,41459,0,2,1),
+(8050,80,83,2048,2,41459,1,2,1),
+(8051,80,83,2048,2,41459,2,2,1),
+(8052,80,83,4096,2,41459,0,2,1),
+(8053,80,83,4096,2,41459,1,2,1),
+(8054,80,83,4096,2,41459,2,2,1),
+(8055,80,83,8192,2,41459,0,2,1),
+(8056,80,83,8192,2,41459,1,2,1),
+(8057,80,83,8192,2,41459,2,2,1),
+(8058,80,83,32,2,41459,0,5,1),
+(8059,80,83,32,2,41459,1,5,1),
+(8060,80,83,32,2,41459,2,5,1),
+(8061,80,83,512,2,41459,0,5,1),
+(8062,80,83,512,2,41459,1,5,1),
+(8063,80,83,512,2,41459,2,5,1),
+(8064,80,83,2,2,41459,0,4,1),
+(8065,80,83,2,2,41459,1,4,1),
+(8066,80,83,2,2,41459,2,4,1),
+(8067,30,39,0,2,41459,0,32,1),
+(8068,30,39,4,2,41459,0,32,1),
+(8069,30,39,4,2,41459,1,32,1),
+(8070,30,39,4,2,41459,2,32,1),
+(8071,30,39,8,2,41459,0,32,1),
+(8072,30,39,8,2,41459,1,32,1),
+(8073,30,39,8,2,41459,2,32,1),
+(8074,30,39,64,2,41459,0,32,1),
+(8075,30,39,64,2,41459,1,32,1),
+(8076,30,39,64,2,41459,2,32,1),
+(8077,30,39,128,2,41459,0,32,1),
+(8078,30,39,128,2,41459,1,32,1),
+(8079,30,39,128,2,41459,2,32,1),
+(8080,30,39,256,2,41459,0,32,1),
+(8081,30,39,256,2,41459,1,32,1),
+(8082,30,39,256,2,41459,2,32,1),
+(8083,30,39,512,2,41459,0,32,1),
+(8084,30,39,512,2,41459,1,32,1),
+(8085,30,39,512,2,41459,2,32,1),
+(8086,40,49,0,2,41459,0,32,1),
+(8087,40,49,4,2,41459,0,32,1),
+(8088,40,49,4,2,41459,1,32,1),
+(8089,40,49,4,2,41459,2,32,1),
+(8090,40,49,8,2,41459,0,32,1),
+(8091,40,49,8,2,41459,1,32,1),
+(8092,40,49,8,2,41459,2,32,1),
+(8093,40,49,64,2,41459,0,32,1),
+(8094,40,49,64,2,41459,1,32,1),
+(8095,40,49,64,2,41459,2,32,1),
+(8096,40,49,128,2,41459,0,32,1),
+(8097,40,49,128,2,41459,1,32,1),
+(8098,40,49,128,2,41459,2,32,1),
+(8099,40,49,256,2,41459,0,32,1),
+(8100,40,49,256,2,41459,1,32,1),
+(8101,40,49,256,2,41459,2,32,1),
+(8102,40,49,512,2,41459,0,32,1),
+(8103,40,49,512,2,41459,1,32,1),
+(8104,40,49,512,2,41459,2,32,1),
+(8105,50,59,0,2,41459,0,32,1),
+(8106,50,59,4,2,41459,0,32,1),
+(8107,50,59,4,2,41459,1,32,1),
+(8108,50,59,4,2,41459,2,32,1),
+(8109,50,59,8,2,41459,0,32,1),
+(8110,50,59,8,2,41459,1,32,1),
+(8111,50,59,8,2,41459,2,32,1),
+(8112,50,59,64,2,41459,0,32,1),
+(8113,50,59,64,2,41459,1,32,1),
+(8114,50,59,64,2,41459,2,32,1),
+(8115,50,59,128,2,41459,0,32,1),
+(8116,50,59,128,2,41459,1,32,1),
+(8117,50,59,128,2,41459,2,32,1),
+(8118,50,59,256,2,41459,0,32,1),
+(8119,50,59,256,2,41459,1,32,1),
+(8120,50,59,256,2,41459,2,32,1),
+(8121,50,59,512,2,41459,0,32,1),
+(8122,50,59,512,2,41459,1,32,1),
+(8123,50,59,512,2,41459,2,32,1),
+(8124,60,69,0,2,41459,0,32,1),
+(8125,60,69,4,2,41459,0,32,1),
+(8126,60,69,4,2,41459,1,32,1),
+(8127,60,69,4,2,41459,2,32,1),
+(8128,60,69,8,2,41459,0,32,1),
+(8129,60,69,8,2,41459,1,32,1),
+(8130,60,69,8,2,41459,2,32,1),
+(8131,60,69,64,2,41459,0,32,1),
+(8132,60,69,64,2,41459,1,32,1),
+(8133,60,69,64,2,41459,2,32,1),
+(8134,60,69,128,2,41459,0,32,1),
+(8135,60,69,128,2,41459,1,32,1),
+(8136,60,69,128,2,41459,2,32,1),
+(8137,60,69,256,2,41459,0,32,1),
+(8138,60,69,256,2,41459,1,32,1),
+(8139,60,69,256,2,41459,2,32,1),
+(8140,60,69,512,2,41459,0,32,1),
+(8141,60,69,512,2,41459,1,32,1),
+(8142,60,69,512,2,41459,2,32,1),
+(8143,70,79,0,2,41459,0,32,1),
+(8144,70,79,4,2,41459,0,32,1),
+(8145,70,79,4,2,41459,1,32,1),
+(8146,70,79,4,2,41459,2,32,1),
+(8147,70,79,8,2,41459,0,32,1),
+(8148,70,79,8,2,41459,1,32,1),
+(8149,70,79,8,2,41459,2,32,1),
+(8150,70,79,64,2,41459,0,32,1),
+(8151,70,79,64,2,41459,1,32,1),
+(8152,70,79,64,2,41459,2,32,1),
+(8153,70,79,128,2,41459,0,32,1),
+(8154,70,79,128,2,41459,1,32,1),
+(8155,70,79,128,2,41459,2,32,1),
+(8156,70,79,256,2,41459,0,32,1),
+(8157,70,79,256,2,41459,1,32,1),
+(8158,70,79,256,2,41459,2,32,1),
+(8159,70,79,512,2,41459,0,32,1),
+(8160,70,79,512,2,41459,1,32,1),
+(8161,70,79,512,2,41459,2,32,1),
+(8162,80,83,0,2,41459,0,32,1),
+(8163,80,83,4,2,41459,0,32,1),
+(8164,80,83,4,2,41459,1,32,1),
+(8165,80,83,4,2,41459,2,32,1),
+(8166,80,83,8,2,41459,0,32,1),
+(8167,80,83,8,2,41459,1,32,1),
+(8168,80,83,8,2,41459,2,32,1),
+(8169,80,83,64,2,41459,0,32,1),
+(8170,80,83,64,2,41459,1,32,1),
+(8171,80,83,64,2,41459,2,32,1),
+(8172,80,83,128,2,41459,0,32,1),
+(8173,80,83,128,2,41459,1,32,1),
+(8174,80,83,128,2,41459,2,32,1),
+(8175,80,83,256,2,41459,0,32,1),
+(8176,80,83,256,2,41459,1,32,1),
+(8177,80,83,256,2,41459,2,32,1),
+(8178,80,83,512,2,41459,0,32,1),
+(8179,80,83,512,2,41459,1,32,1),
+(8180,80,83,512,2,41459,2,32,1),
+(8181,66,73,0,2,41459,0,32,1),
+(8182,66,73,4,2,41459,0,32,1),
+(8183,66,73,4,2,41459,1,32,1),
+(8184,66,73,4,2,41459,2,32,1),
+(8185,66,73,8,2,41459,0,32,1),
+(8186,66,73,8,2,41459,1,32,1),
+(8187,66,73,8,2,41459,2,32,1),
+(8188,66,73,64,2,41459,0,32,1),
+(8189,66,73,64,2,41459,1,32,1),
+(8190,66,73,64,2,41459,2,32,1),
+(8191,66,73,128,2,41459,0,32,1),
+(8192,66,73,128,2,41459,1,32,1),
+(8193,66,73,128,2,41459,2,32,1),
+(8194,66,73,256,2,41459,0,32,1),
+(8195,66,73,256,2,41459,1,32,1),
+(8196,66,73,256,2,41459,2,32,1),
+(8197,66,73,512,2,41459,0,32,1),
+(8198,66,73,512,2,41459,1,32,1),
+(8199,66,73,512,2,41459,2,32,1),
+(8200,28,35,0,2,41459,0,32,1),
+(8201,28,35,4,2,41459,0,32,1),
+(8202,28,35,4,2,41459,1,32,1),
+(8203,28,35,4,2,41459,2,32,1),
+(8204,28,35,8,2,41459,0,32,1),
+(8205,28,35,8,2,41459,1,32,1),
+(8206,28,35,8,2,41459,2,32,1),
+(8207,28,35,64,2,41459,0,32,1),
+(8208,28,35,64,2,41459,1,32,1),
+(8209,28,35,64,2,41459,2,32,1),
+(8210,28,35,128,2,41459,0,32,1),
+(8211,28,35,128,2,41459,1,32,1),
+(8212,28,35,128,2,41459,2,32,1),
+(8213,28,35,256,2,41459,0,32,1),
+(8214,28,35,256,2,41459,1,32,1),
+(8215,28,35,256,2,41459,2,32,1),
+(8216,28,35,512,2,41459,0,32,1),
+(8217,28,35,512,2,41459,1,32,1),
+(8218,28,35,512,2,41459,2,32,1),
+(8219,36,45,0,2,41459,0,32,1),
+(8220,36,45,4,2,41459,0,32,1),
+(8221,36,45,4,2,41459,1,32,1),
+(8222,36,45,4,2,41459,2,32,1),
+(8223,36,45,8,2,41459,0,32,1),
+(8224,36,45,8,2,41459,1,32,1),
+(8225,36,45,8,2,41459,2,32,1),
+(8226,36,45,64,2,41459,0,32,1),
+(8227,36,45,64,2,41459,1,32,1),
+(8228,36,45,64,2,41459,2,32,1),
+(8229,36,45,128,2,41459,0,32,1),
+(8230,36,45,128,2,41459,1,32,1),
+(8231,36,45,128,2,41459,2,32,1),
+(8232,36,45,256,2,41459,0,32,1),
+(8233,36,45,256,2,41459,1,32,1),
+(8234,36,45,256,2,41459,2,32,1),
+(8235,36,45,512,2,41459,0,32,1),
+(8236,36,45,512,2,41459,1,32,1),
+(8237,36,45,512,2,41459,2,32,1),
+(8238,46,55,0,2,41459,0,32,1),
+(8239,46,55,4,2,41459,0,32,1),
+(8240,46,55,4,2,41459,1,32,1),
+(8241,46,55,4,2,41459,2,32,1),
+(8242,46,55,8,2,41459,0,32,1),
+(8243,46,55,8,2,41459,1,32,1),
+(8244,46,55,8,2,41459,2,32,1),
+(8245,46,55,64,2,41459,0,32,1),
+(8246,46,55,64,2,41459,1,32,1),
+(8247,46,55,64,2,41459,2,32,1),
+(8248,46,55,128,2,41459,0,32,1),
+(8249,46,55,128,2,41459,1,32,1),
+(8250,46,55,128,2,41459,2,32,1),
+(8251,46,55,256,2,41459,0,32,1),
+(8252,46,55,256,2,41459,1,32,1),
+(8253,46,55,256,2,41459,2,32,1),
+(8254,46,55,512,2,41459,0,32,1),
+(8255,46,55,512,2,41459,1,32,1),
+(8256,46,55,512,2,41459,2,32,1),
+(8257,56,65,0,2,41459,0,32,1),
+(8258,56,65,4,2,41459,0,32,1),
+(8259,56,65,4,2,41459,1,32,1),
+(8260,56,65,4,2,41459,2,32,1),
+(8261,56,65,8,2,41459,0,32,1),
+(8262,56,65,8,2,41459,1,32,1),
+(8263,56,65,8,2,41459,2,32,1),
+(8264,56,65,64,2,41459,0,32,1),
+(8265,56,65,64,2,41459,1,32,1),
+(8266,56,65,64,2,41459,2,32,1),
+(8267,56,65,128,2,41459,0,32,1),
+(8268,56,65,128,2,41459,1,32,1),
+(8269,56,65,128,2,41459,2,32,1),
+(8270,56,65,256,2,41459,0,32,1),
+(8271,56,65,256,2,41459,1,32,1),
+(8272,56,65,256,2,41459,2,32,1),
+(8273,56,65,512,2,41459,0,32,1),
+(8274,56,65,512,2,41459,1,32,1),
+(8275,56,65,512,2,41459,2,32,1),
+(8276,74,79,0,2,41459,0,32,1),
+(8277,74,79,4,2,41459,0,32,1),
+(8278,74,79,4,2,41459,1,32,1),
+(8279,74,79,4,2,41459,2,32,1),
+(8280,74,79,8,2,41459,0,32,1),
+(8281,74,79,8,2,41459,1,32,1),
+(8282,74,79,8,2,41459,2,32,1),
+(8283,74,79,64,2,41459,0,32,1),
+(8284,74,79,64,2,41459,1,32,1),
+(8285,74,79,64,2,41459,2,32,1),
+(8286,74,79,128,2,41459,0,32,1),
+(8287,74,79,128,2,41459,1,32,1),
+(8288,74,79,128,2,41459,2,32,1),
+(8289,74,79,256,2,41459,0,32,1),
+(8290,74,79,256,2,41459,1,32,1),
+(8291,74,79,256,2,41459,2,32,1),
+(8292,74,79,512,2,41459,0,32,1),
+(8293,74,79,512,2,41459,1,32,1),
+(8294,74,79,512,2,41459,2,32,1),
+(8295,80,83,0,2,41459,0,32,1),
+(8296,80,83,4,2,41459,0,32,1),
+(8297,80,83,4,2,41459,1,32,1),
+(8298,80,83,4,2,41459,2,32,1),
+(8299,80,83,8,2,41459,0,32,1),
+(8300,80,83,8,2,41459,1,32,1),
+(8301,80,83,8,2,41459,2,32,1),
+(8302,80,83,64,2,41459,0,32,1),
+(8303,80,83,64,2,41459,1,32,1),
+(8304,80,83,64,2,41459,2,32,1),
+(8305,80,83,128,2,41459,0,32,1),
+(8306,80,83,128,2,41459,1,32,1),
+(8307,80,83,128,2,41459,2,32,1),
+(8308,80,83,256,2,41459,0,32,1),
+(8309,80,83,256,2,41459,1,32,1),
+(8310,80,83,256,2,41459,2,32,1),
+(8311,80,83,512,2,41459,0,32,1),
+(8312,80,83,512,2,41459,1,32,1),
+(8313,80,83,512,2,41459,2,32,1),
+(8314,36,47,0,2,41459,0,32,1),
+(8315,36,47,4,2,41459,0,32,1),
+(8316,36,47,4,2,41459,1,32,1),
+(8317,36,47,4,2,41459,2,32,1),
+(8318,36,47,8,2,41459,0,32,1),
+(8319,36,47,8,2,41459,1,32,1),
+(8320,36,47,8,2,41459,2,32,1),
+(8321,36,47,64,2,41459,0,32,1),
+(8322,36,47,64,2,41459,1,32,1),
+(8323,36,47,64,2,41459,2,32,1),
+(8324,36,47,128,2,41459,0,32,1),
+(8325,36,47,128,2,41459,1,32,1),
+(8326,36,47,128,2,41459,2,32,1),
+(8327,36,47,256,2,41459,0,32,1),
+(8328,36,47,256,2,41459,1,32,1),
+(8329,36,47,256,2,41459,2,32,1),
+(8330,36,47,512,2,41459,0,32,1),
+(8331,36,47,512,2,41459,1,32,1),
+(8332,36,47,512,2,41459,2,32,1),
+(8333,48,59,0,2,41459,0,32,1),
+(8334,48,59,4,2,41459,0,32,1),
+(8335,48,59,4,2,41459,1,32,1),
+(8336,48,59,4,2,41459,2,32,1),
+(8337,48,59,8,2,41459,0,32,1),
+(8338,48,59,8,2,41459,1,32,1),
+(8339,48,59,8,2,41459,2,32,1),
+(8340,48,59,64,2,41459,0,32,1),
+(8341,48,59,64,2,41459,1,32,1),
+(8342,48,59,64,2,41459,2,32,1),
+(8343,48,59,128,2,41459,0,32,1),
+(8344,48,59,128,2,41459,1,32,1),
+(8345,48,59,128,2,41459,2,32,1),
+(8346,48,59,256,2,41459,0,32,1),
+(8347,48,59,256,2,41459,1,32,1),
+(8348,48,59,256,2,41459,2,32,1),
+(8349,48,59,512,2,41459,0,32,1),
+(8350,48,59,512,2,41459,1,32,1),
+(8351,48,59,512,2,41459,2,32,1),
+(8352,60,65,0,2,41459,0,32,1),
+(8353,60,65,4,2,41459,0,32,1),
+(8354,60,65,4,2,41459,1,32,1),
+(8355,60,65,4,2,41459,2,32,1),
+(8356,60,65,8,2,41459,0,32,1),
+(8357,60,65,8,2,41459,1,32,1),
+(8358,60,65,8,2,41459,2,32,1),
+(8359,60,65,64,2,41459,0,32,1),
+(8360,60,65,64,2,41459,1,32,1),
+(8361,60,65,64,2,41459,2,32,1),
+(8362,60,65,128,2,41459,0,32,1),
+(8363,60,65,128,2,41459,1,32,1),
+(8364,60,65,128,2,41459,2,32,1),
+(8365,60,65,256,2,41459,0,32,1),
+(8366,60,65,256,2,41459,1,32,1),
+(8367,60,65,256,2,41459,2,32,1),
+(8368,60,65,512,2,41459,0,32,1),
+(8369,60,65,512,2,41459,1,32,1),
+(8370,60,65,512,2,41459,2,32,1),
+(8371,66,71,0,2,41459,0,32,1),
+(8372,66,71,4,2,41459,0,32,1),
+(8373,66,71,4,2,41459,1,32,1),
+(8374,66,71,4,2,41459,2,32,1),
+(8375,66,71,8,2,41459,0,32,1),
+(8376,66,71,8,2,41459,1,32,1),
+(8377,66,71,8,2,41459,2,32,1),
+(8378,66,71,64,2,41459,0,32,1),
+(8379,66,71,64,2,41459,1,32,1),
+(8380,66,71,64,2,41459,2,32,1),
+(8381,66,71,128,2,41459,0,32,1),
+(8382,66,71,128,2,41459,1,32,1),
+(8383,66,71,128,2,41459,2,32,1),
+(8384,66,71,256,2,41459,0,32,1),
+(8385,66,71,256,2,41459,1,32,1),
+(8386,66,71,256,2,41459,2,32,1),
+(8387,66,71,512,2,41459,0,32,1),
+(8388,66,71,512,2,41459,1,32,1),
+(8389,66,71,512,2,41459,2,32,1),
+(8390,72,77,0,2,41459,0,32,1),
+(8391,72,77,4,2,41459,0,32,1),
+(8392,72,77,4,2,41459,1,32,1),
+(8393,72,77,4,2,41459,2,32,1),
+(8394,72,77,8,2,41459,0,32,1),
+(8395,72,77,8,2,41459,1,32,1),
+(8396,72,77,8,2,41459,2,32,1),
+(8397,72,77,64,2,41459,0,32,1),
+(8398,72,77,64,2,41459,1,32,1),
+(8399,72,77,64,2,41459,2,32,1),
+(8400,72,77,128,2,41459,0,32,1),
+(8401,72,77,128,2,41459,1,32,1),
+(8402,72,77,128,2,41459,2,32,1),
+(8403,72,77,256,2,41459,0,32,1),
+(8404,72,77,256,2,41459,1,32,1),
+(8405,72,77,256,2,41459,2,32,1),
+(8406,72,77,512,2,41459,0,32,1),
+(8407,72,77,512,2,41459,1,32,1),
+(8408,72,77,512,2,41459,2,32,1),
+(8409,78,83,0,2,41459,0,32,1),
+(8410,78,83,4,2,41459,0,32,1),
+(8411,78,83,4,2,41459,1,32,1),
+(8412,78,83,4,2,41459,2,32,1),
+(8413,78,83,8,2,41459,0,32,1),
+(8414,78,83,8,2,41459,1,32,1),
+(8415,78,83,8,2,41459,2,32,1),
+(8416,78,83,64,2,41459,0,32,1),
+(8417,78,83,64,2,41459,1,32,1),
+(8418,78,83,64,2,41459,2,32,1),
+(8419,78,83,128,2,41459,0,32,1),
+(8420,78,83,128,2,41459,1,32,1),
+(8421,78,83,128,2,41459,2,32,1),
+(8422,78,83,256,2,41459,0,32,1),
+(8423,78,83,256,2,41459,1,32,1),
+(8424,78,83,256,2,41459,2,32,1),
+(8425,78,83,512,2,41459,0,32,1),
+(8426,78,83,512,2,41459,1,32,1),
+(8427,78,83,512,2,41459,2,32,1),
+(8428,70,83,0,2,41459,0,7,1),
+(8429,70,83,1,2,41459,0,3,1),
+(8430,70,83,1,2,41459,1,3,1),
+(8431,70,83,1,2,41459,2,3,1),
+(8432,70,83,16,2,41459,0,2,1),
+(8433,70,83,16,2,41459,1,2,1),
+(8434,70,83,16,2,41459,2,2,1),
+(8435,70,83,128,2,41459,0,7,1),
+(8436,70,83,128,2,41459,1,7,1),
+(8437,70,83,128,2,41459,2,7,1),
+(8438,70,83,256,2,41459,0,7,1),
+(8439,70,83,256,2,41459,1,7,1),
+(8440,70,83,256,2,41459,2,7,1),
+(8441,70,83,1024,2,41459,0,7,1),
+(8442,70,83,1024,2,41459,1,7,1),
+(8443,70,83,1024,2,41459,2,7,1),
+(8444,70,83,2048,2,41459,0,2,1),
+(8445,70,83,2048,2,41459,1,2,1),
+(8446,70,83,2048,2,41459,2,2,1),
+(8447,70,83,4096,2,41459,0,2,1),
+(8448,70,83,4096,2,41459,1,2,1),
+(8449,70,83,4096,2,41459,2,2,1),
+(8450,70,83,8192,2,41459,0,2,1),
+(8451,70,83,8192,2,41459,1,2,1),
+(8452,70,83,8192,2,41459,2,2,1),
+(8453,70,83,32,2,41459,0,5,1),
+(8454,70,83,32,2,41459,1,5,1),
+(8455,70,83,32,2,41459,2,5,1),
+(8456,70,83,512,2,41459,0,5,1),
+(8457,70,83,512,2,41459,1,5,1),
+(8458,70,83,512,2,41459,2,5,1),
+(8459,70,83,2,2,41459,0,4,1),
+(8460,70,83,2,2,41459,1,4,1),
+(8461,70,83,2,2,41459,2,4,1),
+(8462,73,78,0,2,41459,0,7,1),
+(8463,73,78,1,2,41459,0,3,1),
+(8464,73,78,1,2,41459,1,3,1),
+(8465,73,78,1,2,41459,2,3,1),
+(8466,73,78,16,2,41459,0,2,1),
+(8467,73,78,16,2,41459,1,2,1),
+(8468,73,78,16,2,41459,2,2,1),
+(8469,73,78,128,2,41459,0,7,1),
+(8470,73,78,128,2,41459,1,7,1),
+(8471,73,78,128,2,41459,2,7,1),
+(8472,73,78,256,2,41459,0,7,1),
+(8473,73,78,256,2,41459,1,7,1),
+(8474,73,78,256,2,41459,2,7,1),
+(8475,73,78,1024,2,41459,0,7,1),
+(8476,73,78,1024,2,41459,1,7,1),
+(8477,73,78,1024,2,41459,2,7,1),
+(8478,73,78,2048,2,41459,0,2,1),
+(8479,73,78,2048,2,41459,1,2,1),
+(8480,73,78,2048,2,41459,2,2,1),
+(8481,73,78,4096,2,41459,0,2,1),
+(8482,73,78,4096,2,41459,1,2,1),
+(8483,73,78,4096,2,41459,2,2,1),
+(8484,73,78,8192,2,41459,0,2,1),
+(8485,73,78,8192,2,41459,1,2,1),
+(8486,73,78,8192,2,41459,2,2,1),
+(8487,73,78,32,2,41459,0,5,1),
+(8488,73,78,32,2,41459,1,5,1),
+(8489,73,78,32,2,41459,2,5,1),
+(8490,73,78,512,2,41459,0,5,1),
+(8491,73,78,512,2,41459,1,5,1),
+(8492,73,78,512,2,41459,2,5,1),
+(8493,73,78,2,2,41459,0,4,1),
+(8494,73,78,2,2,41459,1,4,1),
+(8495,73,78,2,2,41459,2,4,1),
+(8496,79,83,0,2,41459,0,7,1),
+(8497,79,83,1,2,41459,0,3,1),
+(8498,79,83,1,2,41459,1,3,1),
+(8499,79,83,1,2,41459,2,3,1),
+(8500,79,83,16,2,41459,0,2,1),
+(8501,79,83,16,2,41459,1,2,1),
+(8502,79,83,16,2,41459,2,2,1),
+(8503,79,83,128,2,41459,0,7,1),
+(8504,79,83,128,2,41459,1,7,1),
+(8505,79,83,128,2,41459,2,7,1),
+(8506,79,83,256,2,41459,0,7,1),
+(8507,79,83,256,2,41459,1,7,1),
+(8508,79,83,256,2,41459,2,7,1),
+(8509,79,83,1024,2,41459,0,7,1),
+(8510,79,83,1024,2,41459,1,7,1),
+(8511,79,83,1024,2,41459,2,7,1),
+(8512,79,83,2048,2,41459,0,2,1),
+(8513,79,83,2048,2,41459,1,2,1),
+(8514,79,83,2048,2,41459,2,2,1),
+(8515,79,83,4096,2,41459,0,2,1),
+(8516,79,83,4096,2,41459,1,2,1),
+(8517,79,83,4096,2,41459,2,2,1),
+(8518,79,83,8192,2,41459,0,2,1),
+(8519,79,83,8192,2,41459,1,2,1),
+(8520,79,83,8192,2,41459,2,2,1),
+(8521,79,83,32,2,41459,0,5,1),
+(8522,79,83,32,2,41459,1,5,1),
+(8523,79,83,32,2,41459,2,5,1),
+(8524,79,83,512,2,41459,0,5,1),
+(8525,79,83,512,2,41459,1,5,1),
+(8526,79,83,512,2,41459,2,5,1),
+(8527,79,83,2,2,41459,0,4,1),
+(8528,79,83,2,2,41459,1,4,1),
+(8529,79,83,2,2,41459,2,4,1),
+(8530,76,79,0,2,41459,0,7,1),
+(8531,76,79,1,2,41459,0,3,1),
+(8532,76,79,1,2,41459,1,3,1),
+(8533,76,79,1,2,41459,2,3,1),
+(8534,76,79,16,2,41459,0,2,1),
+(8535,76,79,16,2,41459,1,2,1),
+(8536,76,79,16,2,41459,2,2,1),
+(8537,76,79,128,2,41459,0,7,1),
+(8538,76,79,128,2,41459,1,7,1),
+(8539,76,79,128,2,41459,2,7,1),
+(8540,76,79,256,2,41459,0,7,1),
+(8541,76,79,256,2,41459,1,7,1),
+(8542,76,79,256,2,41459,2,7,1),
+(8543,76,79,1024,2,41459,0,7,1),
+(8544,76,79,1024,2,41459,1,7,1),
+(8545,76,79,1024,2,41459,2,7,1),
+(8546,76,79,2048,2,41459,0,2,1),
+(8547,76,79,2048,2,41459,1,2,1),
+(8548,76,79,2048,2,41459,2,2,1),
+(8549,76,79,4096,2,41459,0,2,1),
+(8550,76,79,4096,2,41459,1,2,1),
+(8551,76,79,4096,2,41459,2,2,1),
+(8552,76,79,8192,2,41459,0,2,1),
+(8553,76,79,8192,2,41459,1,2,1),
+(8554,76,79,8192,2,41459,2,2,1),
+(8555,76,79,32,2,41459,0,5,1),
+(8556,76,79,32,2,41459,1,5,1),
+(8557,76,79,32,2,41459,2,5,1),
+(8558,76,79,512,2,41459,0,5,1),
+(8559,76,79,512,2,41459,1,5,1),
+(8560,76,79,512,2,41459,2,5,1),
+(8561,76,79,2,2,41459,0,4,1),
+(8562,76,79,2,2,41459,1,4,1),
+(8563,76,79,2,2,41459,2,4,1),
+(8564,80,83,0,2,41459,0,7,1),
+(8565,80,83,1,2,41459,0,3,1),
+(8566,80,83,1,2,41459,1,3,1),
+(8567,80,83,1,2,41459,2,3,1),
+(8568,80,83,16,2,41459,0,2,1),
+(8569,80,83,16,2,41459,1,2,1),
+(8570,80,83,16,2,41459,2,2,1),
+(8571,80,83,128,2,41459,0,7,1),
+(8572,80,83,128,2,41459,1,7,1),
+(8573,80,83,128,2,41459,2,7,1),
+(8574,80,83,256,2,41459,0,7,1),
+(8575,80,83,256,2,41459,1,7,1),
+(8576,80,83,256,2,41459,2,7,1),
+(8577,80,83,1024,2,41459,0,7,1),
+(8578,80,83,1024,2,41459,1,7,1),
+(8579,80,83,1024,2,41459,2,7,1),
+(8580,80,83,2048,2,41459,0,2,1),
+(8581,80,83,2048,2,41459,1,2,1),
+(8582,80,83,2048,2,41459,2,2,1),
+(8583,80,83,4096,2,41459,0,2,1),
+(8584,80,83,4096,2,41459,1,2,1),
+(8585,80,83,4096,2,41459,2,2,1),
+(8586,80,83,8192,2,41459,0,2,1),
+(8587,80,83,8192,2,41459,1,2,1),
+(8588,80,83,8192,2,41459,2,2,1),
+(8589,80,83,32,2,41459,0,5,1),
+(8590,80,83,32,2,41459,1,5,1),
+(8591,80,83,32,2,41459,2,5,1),
+(8592,80,83,512,2,41459,0,5,1),
+(8593,80,83,512,2,41459,1,5,1),
+(8594,80,83,512,2,41459,2,5,1),
+(8595,80,83,2,2,41459,0,4,1),
+(8596,80,83,2,2,41459,1,4,1),
+(8597,80,83,2,2,41459,2,4,1),
+(8598,72,77,0,2,41459,0,7,1),
+(8599,72,77,1,2,41459,0,3,1),
+(8600,72,77,1,2,41459,1,3,1),
+(8601,72,77,1,2,41459,2,3,1),
+(8602,72,77,16,2,41459,0,2,1),
+(8603,72,77,16,2,41459,1,2,1),
+(8604,72,77,16,2,41459,2,2,1),
+(8605,72,77,128,2,41459,0,7,1),
+(8606,72,77,128,2,41459,1,7,1),
+(8607,72,77,128,2,41459,2,7,1),
+(8608,72,77,256,2,41459,0,7,1),
+(8609,72,77,256,2,41459,1,7,1),
+(8610,72,77,256,2,41459,2,7,1),
+(8611,72,77,1024,2,41459,0,7,1),
+(8612,72,77,1024,2,41459,1,7,1),
+(8613,72,77,1024,2,41459,2,7,1),
+(8614,72,77,2048,2,41459,0,2,1),
+(8615,72,77,2048,2,41459,1,2,1),
+(8616,72,77,2048,2,41459,2,2,1),
+(8617,72,77,4096,2,41459,0,2,1),
+(8618,72,77,4096,2,41459,1,2,1),
+(8619,72,77,4096,2,41459,2,2,1),
+(8620,72,77,8192,2,41459,0,2,1),
+(8621,72,77,8192,2,41459,1,2,1),
+(8622,72,77,8192,2,41459,2,2,1),
+(8623,72,77,32,2,41459,0,5,1),
+(8624,72,77,32,2,41459,1,5,1),
+(8625,72,77,32,2,41459,2,5,1),
+(8626,72,77,512,2,41459,0,5,1),
+(8627,72,77,512,2,41459,1,5,1),
+(8628,72,77,512,2,41459,2,5,1),
+(8629,72,77,2,2,41459,0,4,1),
+(8630,72,77,2,2,41459,1,4,1),
+(8631,72,77,2,2,41459,2,4,1),
+(8632,78,83,0,2,41459,0,7,1),
+(8633,78,83,1,2,41459,0,3,1),
+(8634,78,83,1,2,41459,1,3,1),
+(8635,78,83,1,2,41459,2,3,1),
+(8636,78,83,16,2,41459,0,2,1),
+(8637,78,83,16,2,41459,1,2,1),
+(8638,78,83,16,2,41459,2,2,1),
+(8639,78,83,128,2,41459,0,7,1),
+(8640,78,83,128,2,41459,1,7,1),
+(8641,78,83,128,2,41459,2,7,1),
+(8642,78,83,256,2,41459,0,7,1),
+(8643,78,83,256,2,41459,1,7,1),
+(8644,78,83,256,2,41459,2,7,1),
+(8645,78,83,1024,2,41459,0,7,1),
+(8646,78,83,1024,2,41459,1,7,1),
+(8647,78,83,1024,2,41459,2,7,1),
+(8648,78,83,2048,2,41459,0,2,1),
+(8649,78,83,2048,2,41459,1,2,1),
+(8650,78,83,2048,2,41459,2,2,1),
+(8651,78,83,4096,2,41459,0,2,1),
+(8652,78,83,4096,2,41459,1,2,1),
+(8653,78,83,4096,2,41459,2,2,1),
+(8654,78,83,8192,2,41459,0,2,1),
+(8655,78,83,8192,2,41459,1,2,1),
+(8656,78,83,8192,2,41459,2,2,1),
+(8657,78,83,32,2,41459,0,5,1),
+(8658,78,83,32,2,41459,1,5,1),
+(8659,78,83,32,2,41459,2,5,1),
+(8660,78,83,512,2,41459,0,5,1),
+(8661,78,83,512,2,41459,1,5,1),
+(8662,78,83,512,2,41459,2,5,1),
+(8663,78,83,2,2,41459,0,4,1),
+(8664,78,83,2,2,41459,1,4,1),
+(8665,78,83,2,2,41459,2,4,1),
+(8666,77,83,0,2,41459,0,7,1),
+(8667,77,83,1,2,41459,0,3,1),
+(8668,77,83,1,2,41459,1,3,1),
+(8669,77,83,1,2,41459,2,3,1),
+(8670,77,83,16,2,41459,0,2,1),
+(8671,77,83,16,2,41459,1,2,1),
+(8672,77,83,16,2,41459,2,2,1),
+(8673,77,83,128,2,41459,0,7,1),
+(8674,77,83,128,2,41459,1,7,1),
+(8675,77,83,128,2,41459,2,7,1),
+(8676,77,83,256,2,41459,0,7,1),
+(8677,77,83,256,2,41459,1,7,1),
+(8678,77,83,256,2,41459,2,7,1),
+(8679,77,83,1024,2,41459,0,7,1),
+(8680,77,83,1024,2,41459,1,7,1),
+(8681,77,83,1024,2,41459,2,7,1),
+(8682,77,83,2048,2,41459,0,2,1),
+(8683,77,83,2048,2,41459,1,2,1),
+(8684,77,83,2048,2,41459,2,2,1),
+(8685,77,83,4096,2,41459,0,2,1),
+(8686,77,83,4096,2,41459,1,2,1),
+(8687,77,83,4096,2,41459,2,2,1),
+(8688,77,83,8192,2,41459,0,2,1),
+(8689,77,83,8192,2,41459,1,2,1),
+(8690,77,83,8192,2,41459,2,2,1),
+(8691,77,83,32,2,41459,0,5,1),
+(8692,77,83,32,2,41459,1,5,1),
+(8693,77,83,32,2,41459,2,5,1),
+(8694,77,83,512,2,41459,0,5,1),
+(8695,77,83,512,2,41459,1,5,1),
+(8696,77,83,512,2,41459,2,5,1),
+(8697,77,83,2,2,41459,0,4,1),
+(8698,77,83,2,2,41459,1,4,1),
+(8699,77,83,2,2,41459,2,4,1),
+(8700,71,75,0,2,41459,0,39,1),
+(8701,71,75,1,2,41459,0,3,1),
+(8702,71,75,1,2,41459,1,3,1),
+(8703,71,75,1,2,41459,2,3,1),
+(8704,71,75,16,2,41459,0,2,1),
+(8705,71,75,16,2,41459,1,2,1),
+(8706,71,75,16,2,41459,2,2,1),
+(8707,71,75,128,2,41459,0,39,1),
+(8708,71,75,128,2,41459,1,39,1),
+(8709,71,75,128,2,41459,2,39,1),
+(8710,71,75,256,2,41459,0,39,1),
+(8711,71,75,256,2,41459,1,39,1),
+(8712,71,75,256,2,41459,2,39,1),
+(8713,71,75,1024,2,41459,0,7,1),
+(8714,71,75,1024,2,41459,1,7,1),
+(8715,71,75,1024,2,41459,2,7,1),
+(8716,71,75,2048,2,41459,0,2,1),
+(8717,71,75,2048,2,41459,1,2,1),
+(8718,71,75,2048,2,41459,2,2,1),
+(8719,71,75,4096,2,41459,0,2,1),
+(8720,71,75,4096,2,41459,1,2,1),
+(8721,71,75,4096,2,41459,2,2,1),
+(8722,71,75,8192,2,41459,0,2,1),
+(8723,71,75,8192,2,41459,1,2,1),
+(8724,71,75,8192,2,41459,2,2,1),
+(8725,71,75,32,2,41459,0,5,1),
+(8726,71,75,32,2,41459,1,5,1),
+(8727,71,75,32,2,41459,2,5,1),
+(8728,71,75,512,2,41459,0,37,1),
+(8729,71,75,512,2,41459,1,37,1),
+(8730,71,75,512,2,41459,2,37,1),
+(8731,71,75,2,2,41459,0,4,1),
+(8732,71,75,2,2,41459,1,4,1),
+(8733,71,75,2,2,41459,2,4,1),
+(8734,71,75,4,2,41459,0,32,1),
+(8735,71,75,4,2,41459,1,32,1),
+(8736,71,75,4,2,41459,2,32,1),
+(8737,71,75,8,2,41459,0,32,1),
+(8738,71,75,8,2,41459,1,32,1),
+(8739,71,75,8,2,41459,2,32,1),
+(8740,71,75,64,2,41459,0,32,1),
+(8741,71,75,64,2,41459,1,32,1),
+(8742,71,75,64,2,41459,2,32,1),
+(8743,76,79,0,2,41459,0,39,1),
+(8744,76,79,1,2,41459,0,3,1),
+(8745,76,79,1,2,41459,1,3,1),
+(8746,76,79,1,2,41459,2,3,1),
+(8747,76,79,16,2,41459,0,2,1),
+(8748,76,79,16,2,41459,1,2,1),
+(8749,76,79,16,2,41459,2,2,1),
+(8750,76,79,128,2,41459,0,39,1),
+(8751,76,79,128,2,41459,1,39,1),
+(8752,76,79,128,2,41459,2,39,1),
+(8753,76,79,256,2,41459,0,39,1),
+(8754,76,79,256,2,41459,1,39,1),
+(8755,76,79,256,2,41459,2,39,1),
+(8756,76,79,1024,2,41459,0,7,1),
+(8757,76,79,1024,2,41459,1,7,1),
+(8758,76,79,1024,2,41459,2,7,1),
+(8759,76,79,2048,2,41459,0,2,1),
+(8760,76,79,2048,2,41459,1,2,1),
+(8761,76,79,2048,2,41459,2,2,1),
+(8762,76,79,4096,2,41459,0,2,1),
+(8763,76,79,4096,2,41459,1,2,1),
+(8764,76,79,4096,2,41459,2,2,1),
+(8765,76,79,8192,2,41459,0,2,1),
+(8766,76,79,8192,2,41459,1,2,1),
+(8767,76,79,8192,2,41459,2,2,1),
+(8768,76,79,32,2,41459,0,5,1),
+(8769,76,79,32,2,41459,1,5,1),
+(8770,76,79,32,2,41459,2,5,1),
+(8771,76,79,512,2,41459,0,37,1),
+(8772,76,79,512,2,41459,1,37,1),
+(8773,76,79,512,2,41459,2,37,1),
+(8774,76,79,2,2,41459,0,4,1),
+(8775,76,79,2,2,41459,1,4,1),
+(8776,76,79,2,2,41459,2,4,1),
+(8777,76,79,4,2,41459,0,32,1),
+(8778,76,79,4,2,41459,1,32,1),
+(8779,76,79,4,2,41459,2,32,1),
+(8780,76,79,8,2,41459,0,32,1),
+(8781,76,79,8,2,41459,1,32,1),
+(8782,76,79,8,2,41459,2,32,1),
+(8783,76,79,64,2,41459,0,32,1),
+(8784,76,79,64,2,41459,1,32,1),
+(8785,76,79,64,2,41459,2,32,1),
+(8786,80,83,0,2,41459,0,39,1),
+(8787,80,83,1,2,41459,0,3,1),
+(8788,80,83,1,2,41459,1,3,1),
+(8789,80,83,1,2,41459,2,3,1),
+(8790,80,83,16,2,41459,0,2,1),
+(8791,80,83,16,2,41459,1,2,1),
+(8792,80,83,16,2,41459,2,2,1),
+(8793,80,83,128,2,41459,0,39,1),
+(8794,80,83,128,2,41459,1,39,1),
+(8795,80,83,128,2,41459,2,39,1),
+(8796,80,83,256,2,41459,0,39,1),
+(8797,80,83,256,2,41459,1,39,1),
+(8798,80,83,256,2,41459,2,39,1),
+(8799,80,83,1024,2,41459,0,7,1),
+(8800,80,83,1024,2,41459,1,7,1),
+(8801,80,83,1024,2,41459,2,7,1),
+(8802,80,83,2048,2,41459,0,2,1),
+(8803,80,83,2048,2,41459,1,2,1),
+(8804,80,83,2048,2,41459,2,2,1),
+(8805,80,83,4096,2,41459,0,2,1),
+(8806,80,83,4096,2,41459,1,2,1),
+(8807,80,83,4096,2,41459,2,2,1),
+(8808,80,83,8192,2,41459,0,2,1),
+(8809,80,83,8192,2,41459,1,2,1),
+(8810,80,83,8192,2,41459,2,2,1),
+(8811,80,83,32,2,41459,0,5,1),
+(8812,80,83,32,2,41459,1,5,1),
+(8813,80,83,32,2,41459,2,5,1),
+(8814,80,83,512,2,41459,0,37,1),
+(8815,80,83,512,2,41459,1,37,1),
+(8816,80,83,512,2,41459,2,37,1),
+(8817,80,83,2,2,41459,0,4,1),
+(8818,80,83,2,2,41459,1,4,1),
+(8819,80,83,2,2,41459,2,4,1),
+(8820,80,83,4,2,41459,0,32,1),
+(8821,80,83,4,2,41459,1,32,1),
+(8822,80,83,4,2,41459,2,32,1),
+(8823,80,83,8,2,41459,0,32,1),
+(8824,80,83,8,2,41459,1,32,1),
+(8825,80,83,8,2,41459,2,32,1),
+(8826,80,83,64,2,41459,0,32,1),
+(8827,80,83,64,2,41459,1,32,1),
+(8828,80,83,64,2,41459,2,32,1),
+(8829,71,75,0,2,41459,0,7,1),
+(8830,71,75,1,2,41459,0,3,1),
+(8831,71,75,1,2,41459,1,3,1),
+(8832,71,75,1,2,41459,2,3,1),
+(8833,71,75,16,2,41459,0,2,1),
+(8834,71,75,16,2,41459,1,2,1),
+(8835,71,75,16,2,41459,2,2,1),
+(8836,71,75,128,2,41459,0,7,1),
+(8837,71,75,128,2,41459,1,7,1),
+(8838,71,75,128,2,41459,2,7,1),
+(8839,71,75,256,2,41459,0,7,1),
+(8840,71,75,256,2,41459,1,7,1),
+(8841,71,75,256,2,41459,2,7,1),
+(8842,71,75,1024,2,41459,0,7,1),
+(8843,71,75,1024,2,41459,1,7,1),
+(8844,71,75,1024,2,41459,2,7,1),
+(8845,71,75,2048,2,41459,0,2,1),
+(8846,71,75,2048,2,41459,1,2,1),
+(8847,71,75,2048,2,41459,2,2,1),
+(8848,71,75,4096,2,41459,0,2,1),
+(8849,71,75,4096,2,41459,1,2,1),
+(8850,71,75,4096,2,41459,2,2,1),
+(8851,71,75,8192,2,41459,0,2,1),
+(8852,71,75,8192,2,41459,1,2,1),
+(8853,71,75,8192,2,41459,2,2,1),
+(8854,71,75,32,2,41459,0,5,1),
+(8855,71,75,32,2,41459,1,5,1),
+(8856,71,75,32,2,41459,2,5,1),
+(8857,71,75,512,2,41459,0,5,1),
+(8858,71,75,512,2,41459,1,5,1),
+(8859,71,75,512,2,41459,2,5,1),
+(8860,71,75,2,2,41459,0,4,1),
+(8861,71,75,2,2,41459,1,4,1),
+(8862,71,75,2,2,41459,2,4,1),
+(8863,76,79,0,2,41459,0,7,1),
+(8864,76,79,1,2,41459,0,3,1),
+(8865,76,79,1,2,41459,1,3,1),
+(8866,76,79,1,2,41459,2,3,1),
+(8867,76,79,16,2,41459,0,2,1),
+(8868,76,79,16,2,41459,1,2,1),
+(8869,76,79,16,2,41459,2,2,1),
+(8870,76,79,128,2,41459,0,7,1),
+(8871,76,79,128,2,41459,1,7,1),
+(8872,76,79,128,2,41459,2,7,1),
+(8873,76,79,256,2,41459,0,7,1),
+(8874,76,79,256,2,41459,1,7,1),
+(8875,76,79,256,2,41459,2,7,1),
+(8876,76,79,1024,2,41459,0,7,1),
+(8877,76,79,1024,2,41459,1,7,1),
+(8878,76,79,1024,2,41459,2,7,1),
+(8879,76,79,2048,2,41459,0,2,1),
+(8880,76,79,2048,2,41459,1,2,1),
+(8881,76,79,2048,2,41459,2,2,1),
+(8882,76,79,4096,2,41459,0,2,1),
+(8883,76,79,4096,2,41459,1,2,1),
+(8884,76,79,4096,2,41459,2,2,1),
+(8885,76,79,8192,2,41459,0,2,1),
+(8886,76,79,8192,2,41459,1,2,1),
+(8887,76,79,8192,2,41459,2,2,1),
+(8888,76,79,32,2,41459,0,5,1),
+(8889,76,79,32,2,41459,1,5,1),
+(8890,76,79,32,2,41459,2,5,1),
+(8891,76,79,512,2,41459,0,5,1),
+(8892,76,79,512,2,41459,1,5,1),
+(8893,76,79,512,2,41459,2,5,1),
+(8894,76,79,2,2,41459,0,4,1),
+(8895,76,79,2,2,41459,1,4,1),
+(8896,76,79,2,2,41459,2,4,1),
+(8897,80,83,0,2,41459,0,7,1),
+(8898,80,83,1,2,41459,0,3,1),
+(8899,80,83,1,2,41459,1,3,1),
+(8900,80,83,1,2,41459,2,3,1),
+(8901,80,83,16,2,41459,0,2,1),
+(8902,80,83,16,2,41459,1,2,1),
+(8903,80,83,16,2,41459,2,2,1),
+(8904,80,83,128,2,41459,0,7,1),
+(8905,80,83,128,2,41459,1,7,1),
+(8906,80,83,128,2,41459,2,7,1),
+(8907,80,83,256,2,41459,0,7,1),
+(8908,80,83,256,2,41459,1,7,1),
+(8909,80,83,256,2,41459,2,7,1),
+(8910,80,83,1024,2,41459,0,7,1),
+(8911,80,83,1024,2,41459,1,7,1),
+(8912,80,83,1024,2,41459,2,7,1),
+(8913,80,83,2048,2,41459,0,2,1),
+(8914,80,83,2048,2,41459,1,2,1),
+(8915,80,83,2048,2,41459,2,2,1),
+(8916,80,83,4096,2,41459,0,2,1),
+(8917,80,83,4096,2,41459,1,2,1),
+(8918,80,83,4096,2,41459,2,2,1),
+(8919,80,83,8192,2,41459,0,2,1),
+(8920,80,83,8192,2,41459,1,2,1),
+(8921,80,83,8192,2,41459,2,2,1),
+(8922,80,83,32,2,41459,0,5,1),
+(8923,80,83,32,2,41459,1,5,1),
+(8924,80,83,32,2,41459,2,5,1),
+(8925,80,83,512,2,41459,0,5,1),
+(8926,80,83,512,2,41459,1,5,1),
+(8927,80,83,512,2,41459,2,5,1),
+(8928,80,83,2,2,41459,0,4,1),
+(8929,80,83,2,2,41459,1,4,1),
+(8930,80,83,2,2,41459,2,4,1),
+(8931,71,75,0,2,41459,0,7,1),
+(8932,71,75,1,2,41459,0,3,1),
+(8933,71,75,1,2,41459,1,3,1),
+(8934,71,75,1,2,41459,2,3,1),
+(8935,71,75,16,2,41459,0,2,1),
+(8936,71,75,16,2,41459,1,2,1),
+(8937,71,75,16,2,41459,2,2,1),
+(8938,71,75,128,2,41459,0,7,1),
+(8939,71,75,128,2,41459,1,7,1),
+(8940,71,75,128,2,41459,2,7,1),
+(8941,71,75,256,2,41459,0,7,1),
+(8942,71,75,256,2,41459,1,7,1),
+(8943,71,75,256,2,41459,2,7,1),
+(8944,71,75,1024,2,41459,0,7,1),
+(8945,71,75,1024,2,41459,1,7,1),
+(8946,71,75,1024,2,41459,2,7,1),
+(8947,71,75,2048,2,41459,0,2,1),
+(8948,71,75,2048,2,41459,1,2,1),
+(8949,71,75,2048,2,41459,2,2,1),
+(8950,71,75,4096,2,41459,0,2,1),
+(8951,71,75,4096,2,41459,1,2,1),
+(8952,71,75,4096,2,41459,2,2,1),
+(8953,71,75,8192,2,41459,0,2,1),
+(8954,71,75,8192,2,41459,1,2,1),
+(8955,71,75,8192,2,41459,2,2,1),
+(8956,71,75,32,2,41459,0,5,1),
+(8957,71,75,32,2,41459,1,5,1),
+(8958,71,75,32,2,41459,2,5,1),
+(8959,71,75,512,2,41459,0,5,1),
+(8960,71,75,512,2,41459,1,5,1),
+(8961,71,75,512,2,41459,2,5,1),
+(8962,71,75,2,2,41459,0,4,1),
+(8963,71,75,2,2,41459,1,4,1),
+(8964,71,75,2,2,41459,2,4,1),
+(8965,76,79,0,2,41459,0,7,1),
+(8966,76,79,1,2,41459,0,3,1),
+(8967,76,79,1,2,41459,1,3,1),
+(8968,76,79,1,2,41459,2,3,1),
+(8969,76,79,16,2,41459,0,2,1),
+(8970,76,79,16,2,41459,1,2,1),
+(8971,76,79,16,2,41459,2,2,1),
+(8972,76,79,128,2,41459,0,7,1),
+(8973,76,79,128,2,41459,1,7,1),
+(8974,76,79,128,2,41459,2,7,1),
+(8975,76,79,256,2,41459,0,7,1),
+(8976,76,79,256,2,41459,1,7,1),
+(8977,76,79,256,2,41459,2,7,1),
+(8978,76,79,1024,2,41459,0,7,1),
+(8979,76,79,1024,2,41459,1,7,1),
+(8980,76,79,1024,2,41459,2,7,1),
+(8981,76,79,2048,2,41459,0,2,1),
+(8982,76,79,2048,2,41459,1,2,1),
+(8983,76,79,2048,2,41459,2,2,1),
+(8984,76,79,4096,2,41459,0,2,1),
+(8985,76,79,4096,2,41459,1,2,1),
+(8986,76,79,4096,2,41459,2,2,1),
+(8987,76,79,8192,2,41459,0,2,1),
+(8988,76,79,8192,2,41459,1,2,1),
+(8989,76,79,8192,2,41459,2,2,1),
+(8990,76,79,32,2,41459,0,5,1),
+(8991,76,79,32,2,41459,1,5,1),
+(8992,76,79,32,2,41459,2,5,1),
+(8993,76,79,512,2,41459,0,5,1),
+(8994,76,79,512,2,41459,1,5,1),
+(8995,76,79,512,2,41459,2,5,1),
+(8996,76,79,2,2,41459,0,4,1),
+(8997,76,79,2,2,41459,1,4,1),
+(8998,76,79,2,2,41459,2,4,1),
+(8999,80,83,0,2,41459,0,7,1),
+(9000,80,83,1,2,41459,0,3,1),
+(9001,80,83,1,2,41459,1,3,1),
+(9002,80,83,1,2,41459,2,3,1),
+(9003,80,83,16,2,41459,0,2,1),
+(9004,80,83,16,2,41459,1,2,1),
+(9005,80,83,16,2,41459,2,2,1),
+(9006,80,83,128,2,41459,0,7,1),
+(9007,80,83,128,2,41459,1,7,1),
+(9008,80,83,128,2,41459,2,7,1),
+(9009,80,83,256,2,41459,0,7,1),
+(9010,80,83,256,2,41459,1,7,1),
+(9011,80,83,256,2,41459,2,7,1),
+(9012,80,83,1024,2,41459,0,7,1),
+(9013,80,83,1024,2,41459,1,7,1),
+(9014,80,83,1024,2,41459,2,7,1),
+(9015,80,83,2048,2,41459,0,2,1),
+(9016,80,83,2048,2,41459,1,2,1),
+(9017,80,83,2048,2,41459,2,2,1),
+(9018,80,83,4096,2,41459,0,2,1),
+(9019,80,83,4096,2,41459,1,2,1),
+(9020,80,83,4096,2,41459,2,2,1),
+(9021,80,83,8192,2,41459,0,2,1),
+(9022,80,83,8192,2,41459,1,2,1),
+(9023,80,83,8192,2,41459,2,2,1),
+(9024,80,83,32,2,41459,0,5,1),
+(9025,80,83,32,2,41459,1,5,1),
+(9026,80,83,32,2,41459,2,5,1),
+(9027,80,83,512,2,41459,0,5,1),
+(9028,80,83,512,2,41459,1,5,1),
+(9029,80,83,512,2,41459,2,5,1),
+(9030,80,83,2,2,41459,0,4,1),
+(9031,80,83,2,2,41459,1,4,1),
+(9032,80,83,2,2,41459,2,4,1),
+(9033,60,83,0,2,41459,0,7,1),
+(9034,60,83,1,2,41459,0,3,1),
+(9035,60,83,1,2,41459,1,3,1),
+(9036,60,83,1,2,41459,2,3,1),
+(9037,60,83,16,2,41459,0,2,1),
+(9038,60,83,16,2,41459,1,2,1),
+(9039,60,83,16,2,41459,2,2,1),
+(9040,60,83,128,2,41459,0,7,1),
+(9041,60,83,128,2,41459,1,7,1),
+(9042,60,83,128,2,41459,2,7,1),
+(9043,60,83,256,2,41459,0,7,1),
+(9044,60,83,256,2,41459,1,7,1),
+(9045,60,83,256,2,41459,2,7,1),
+(9046,60,83,1024,2,41459,0,7,1),
+(9047,60,83,1024,2,41459,1,7,1),
+(9048,60,83,1024,2,41459,2,7,1),
+(9049,60,83,2048,2,41459,0,2,1),
+(9050,60,83,2048,2,41459,1,2,1),
+(9051,60,83,2048,2,41459,2,2,1),
+(9052,60,83,4096,2,41459,0,2,1),
+(9053,60,83,4096,2,41459,1,2,1),
+(9054,60,83,4096,2,41459,2,2,1),
+(9055,60,83,8192,2,41459,0,2,1),
+(9056,60,83,8192,2,41459,1,2,1),
+(9057,60,83,8192,2,41459,2,2,1),
+(9058,60,83,32,2,41459,0,5,1),
+(9059,60,83,32,2,41459,1,5,1),
+(9060,60,83,32,2,41459,2,5,1),
+(9061,60,83,512,2,41459,0,5,1),
+(9062,60,83,512,2,41459,1,5,1),
+(9063,60,83,512,2,41459,2,5,1),
+(9064,60,83,2,2,41459,0,4,1),
+(9065,60,83,2,2,41459,1,4,1),
+(9066,60,83,2,2,41459,2,4,1),
+(9067,60,83,0,2,41459,0,32,1),
+(9068,60,83,4,2,41459,0,32,1),
+(9069,60,83,4,2,41459,1,32,1),
+(9070,60,83,4,2,41459,2,32,1),
+(9071,60,83,8,2,41459,0,32,1),
+(9072,60,83,8,2,41459,1,32,1),
+(9073,60,83,8,2,41459,2,32,1),
+(9074,60,83,64,2,41459,0,32,1),
+(9075,60,83,64,2,41459,1,32,1),
+(9076,60,83,64,2,41459,2,32,1),
+(9077,60,83,128,2,41459,0,32,1),
+(9078,60,83,128,2,41459,1,32,1),
+(9079,60,83,128,2,41459,2,32,1),
+(9080,60,83,256,2,41459,0,32,1),
+(9081,60,83,256,2,41459,1,32,1),
+(9082,60,83,256,2,41459,2,32,1),
+(9083,60,83,512,2,41459,0,32,1),
+(9084,60,83,512,2,41459,1,32,1),
+(9085,60,83,512,2,41459,2,32,1),
+(9086,70,80,0,2,327692,0,23,1),
+(9087,70,80,1,2,327692,0,3,1),
+(9088,70,80,1,2,327692,1,3,1),
+(9089,70,80,1,2,327692,2,3,1),
+(9090,70,80,16,2,327692,0,2,1),
+(9091,70,80,16,2,327692,1,2,1),
+(9092,70,80,16,2,327692,2,2,1),
+(9093,70,80,128,2,327692,0,23,1),
+(9094,70,80,128,2,327692,1,23,1),
+(9095,70,80,128,2,327692,2,23,1),
+(9096,70,80,256,2,327692,0,23,1),
+(9097,70,80,256,2,327692,1,23,1),
+(9098,70,80,256,2,327692,2,23,1),
+(9099,70,80,1024,2,327692,0,7,1),
+(9100,70,80,1024,2,327692,1,7,1),
+(9101,70,80,1024,2,327692,2,7,1),
+(9102,70,80,2048,2,327692,0,2,1),
+(9103,70,80,2048,2,327692,1,2,1),
+(9104,70,80,2048,2,327692,2,2,1),
+(9105,70,80,4096,2,327692,0,2,1),
+(9106,70,80,4096,2,327692,1,2,1),
+(9107,70,80,4096,2,327692,2,2,1),
+(9108,70,80,8192,2,327692,0,2,1),
+(9109,70,80,8192,2,327692,1,2,1),
+(9110,70,80,8192,2,327692,2,2,1),
+(9111,70,80,32,2,327692,0,21,1),
+(9112,70,80,32,2,327692,1,21,1),
+(9113,70,80,32,2,327692,2,21,1),
+(9114,70,80,512,2,327692,0,21,1),
+(9115,70,80,512,2,327692,1,21,1),
+(9116,70,80,512,2,327692,2,21,1),
+(9117,70,80,2,2,327692,0,20,1),
+(9118,70,80,2,2,327692,1,20,1),
+(9119,70,80,2,2,327692,2,20,1),
+(9120,75,83,0,2,41459,0,2,1),
+(9121,75,83,1,2,41459,0,2,1),
+(9122,75,83,1,2,41459,1,2,1),
+(9123,75,83,1,2,41459,2,2,1),
+(9124,75,83,16,2,41459,0,2,1),
+(9125,75,83,16,2,41459,1,2,1),
+(9126,75,83,16,2,41459,2,2,1),
+(9127,75,83,128,2,41459,0,2,1),
+(9128,75,83,128,2,41459,1,2,1),
+(9129,75,83,128,2,41459,2,2,1),
+(9130,75,83,256,2,41459,0,2,1),
+(9131,75,83,256,2,41459,1,2,1),
+(9132,75,83,256,2,41459,2,2,1),
+(9133,75,83,1024,2,41459,0,2,1),
+(9134,75,83,1024,2,41459,1,2,1),
+(9135,75,83,1024,2,41459,2,2,1),
+(9136,75,83,2048,2,41459,0,2,1),
+(9137,75,83,2048,2,41459,1,2,1),
+(9138,75,83,2048,2,41459,2,2,1),
+(9139,75,83,4096,2,41459,0,2,1),
+(9140,75,83,4096,2,41459,1,2,1),
+(9141,75,83,4096,2,41459,2,2,1),
+(9142,75,83,8192,2,41459,0,2,1),
+(9143,75,83,8192,2,41459,1,2,1),
+(9144,75,83,8192,2,41459,2,2,1),
+(9145,75,83,0,2,41459,0,10,1),
+(9146,75,83,1,2,41459,0,2,1),
+(9147,75,83,1,2,41459,1,2,1),
+(9148,75,83,1,2,41459,2,2,1),
+(9149,75,83,16,2,41459,0,10,1),
+(9150,75,83,16,2,41459,1,10,1),
+(9151,75,83,16,2,41459,2,10,1),
+(9152,75,83,128,2,41459,0,10,1),
+(9153,75,83,128,2,41459,1,10,1),
+(9154,75,83,128,2,41459,2,10,1),
+(9155,75,83,256,2,41459,0,10,1),
+(9156,75,83,256,2,41459,1,10,1),
+(9157,75,83,256,2,41459,2,10,1),
+(9158,75,83,1024,2,41459,0,10,1),
+(9159,75,83,1024,2,41459,1,10,1),
+(9160,75,83,1024,2,41459,2,10,1),
+(9161,75,83,2048,2,41459,0,10,1),
+(9162,75,83,2048,2,41459,1,10,1),
+(9163,75,83,2048,2,41459,2,10,1),
+(9164,75,83,4096,2,41459,0,10,1),
+(9165,75,83,4096,2,41459,1,10,1),
+(9166,75,83,4096,2,41459,2,10,1),
+(9167,75,83,8192,2,41459,0,2,1),
+(9168,75,83,8192,2,41459,1,2,1),
+(9169,75,83,8192,2,41459,2,2,1),
+(9170,75,83,2,2,41459,0,8,1),
+(9171,75,83,2,2,41459,1,8,1),
+(9172,75,83,2,2,41459,2,8,1);
 
@@ -0,0 +1,227 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// dbcstructgen generates a typed Go record struct for every DBC schema in a directory, along with
+// unrolled little-endian decode and encode methods so that the records never go through interface{}.
+package main
+
+import (
+	"bytes"
+	"flag"
+	"fmt"
+	"go/format"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"text/template"
+	"unicode"
+
+	"github.com/lohvht/logi"
+	"github.com/lohvht/logi/iface"
+	"github.com/lohvht/mod-random-suffix/golang/pkg/dbc"
+)
+
+var log iface.Logger = logi.Get().Named("cmd_dbcstructgen")
+
+type genField struct {
+	GoName     string
+	SchemaName string
+	Type       dbc.DBCSchemaFieldType
+	GoType     string
+	TypeConst  string
+	Offset     uint32
+}
+
+type genRecord struct {
+	Name       string
+	SchemaFile string
+	Fields     []genField
+	RecordSize uint32
+}
+
+type genData struct {
+	Package     string
+	Records     []genRecord
+	NeedsMath   bool
+	NeedsErrors bool
+}
+
+var goTypes = map[dbc.DBCSchemaFieldType]string{
+	dbc.DBCSchemaFieldInt32:        "int32",
+	dbc.DBCSchemaFieldUint8:        "uint8",
+	dbc.DBCSchemaFieldUint32:       "uint32",
+	dbc.DBCSchemaFieldFloat32:      "float32",
+	dbc.DBCSchemaFieldFloat64:      "float64",
+	dbc.DBCSchemaFieldStringOffset: "string",
+	dbc.DBCSchemaFieldUnknown:      "int32",
+}
+
+var typeConsts = map[dbc.DBCSchemaFieldType]string{
+	dbc.DBCSchemaFieldInt32:        "DBCSchemaFieldInt32",
+	dbc.DBCSchemaFieldUint8:        "DBCSchemaFieldUint8",
+	dbc.DBCSchemaFieldUint32:       "DBCSchemaFieldUint32",
+	dbc.DBCSchemaFieldFloat32:      "DBCSchemaFieldFloat32",
+	dbc.DBCSchemaFieldFloat64:      "DBCSchemaFieldFloat64",
+	dbc.DBCSchemaFieldStringOffset: "DBCSchemaFieldStringOffset",
+	dbc.DBCSchemaFieldUnknown:      "DBCSchemaFieldUnknown",
+}
+
+// goFieldName exports the schema field name, unnamed fields get the same field_<i> name the CSV export uses
+func goFieldName(schema dbc.DBCSchema, fi int) string {
+	name := []rune(schema.FieldName(fi))
+	name[0] = unicode.ToUpper(name[0])
+	return string(name)
+}
+
+func loadRecord(schemaPath string) (genRecord, error) {
+	schemafp, err := os.Open(schemaPath)
+	if err != nil {
+		return genRecord{}, err
+	}
+	defer schemafp.Close()
+	var schema dbc.DBCSchema
+	if err = schema.FromJSONReader(schemafp); err != nil {
+		return genRecord{}, err
+	}
+	r := genRecord{
+		Name:       strings.TrimSuffix(filepath.Base(schemaPath), ".dbc.json"),
+		SchemaFile: filepath.Base(schemaPath),
+	}
+	for fi, f := range schema.Fields {
+		r.Fields = append(r.Fields, genField{
+			GoName:     goFieldName(schema, fi),
+			SchemaName: f.Name,
+			Type:       f.Type,
+			GoType:     goTypes[f.Type],
+			TypeConst:  typeConsts[f.Type],
+			Offset:     r.RecordSize,
+		})
+		r.RecordSize += f.Type.SizeOf()
+	}
+	return r, nil
+}
+
+var recordsTemplate = template.Must(template.New("").Parse(`// Code generated by dbcstructgen. DO NOT EDIT.
+
+package {{.Package}}
+
+import (
+	"encoding/binary"
+{{- if .NeedsMath}}
+	"math"
+{{- end}}
+{{- if .NeedsErrors}}
+
+	"github.com/pkg/errors"
+{{- end}}
+)
+{{range $r := .Records}}
+// {{$r.Name}}Record is a record of {{$r.Name}}.dbc, generated from {{$r.SchemaFile}}
+type {{$r.Name}}Record struct {
+{{- range $r.Fields}}
+	{{.GoName}} {{.GoType}}
+{{- end}}
+}
+
+const {{$r.Name}}RecordSize = {{$r.RecordSize}}
+
+var {{$r.Name}}Schema = DBCSchema{Fields: []DBCSchemaField{
+{{- range $r.Fields}}
+	{Type: {{.TypeConst}}, Name: {{printf "%q" .SchemaName}}},
+{{- end}}
+}}
+
+func ({{$r.Name}}Record) dbcSchema() DBCSchema { return {{$r.Name}}Schema }
+
+func (r *{{$r.Name}}Record) decodeDBC(b []byte, stringBlock []byte) (err error) {
+	_ = b[{{$r.Name}}RecordSize-1]
+{{- range $r.Fields}}
+{{- if eq .GoType "int32"}}
+	r.{{.GoName}} = int32(binary.LittleEndian.Uint32(b[{{.Offset}}:]))
+{{- else if eq .GoType "uint8"}}
+	r.{{.GoName}} = b[{{.Offset}}]
+{{- else if eq .GoType "uint32"}}
+	r.{{.GoName}} = binary.LittleEndian.Uint32(b[{{.Offset}}:])
+{{- else if eq .GoType "float32"}}
+	r.{{.GoName}} = math.Float32frombits(binary.LittleEndian.Uint32(b[{{.Offset}}:]))
+{{- else if eq .GoType "float64"}}
+	r.{{.GoName}} = math.Float64frombits(binary.LittleEndian.Uint64(b[{{.Offset}}:]))
+{{- else}}
+	if r.{{.GoName}}, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[{{.Offset}}:])); err != nil {
+		return errors.Wrap(err, "field {{.GoName}}")
+	}
+{{- end}}
+{{- end}}
+	return nil
+}
+
+func (r {{$r.Name}}Record) visitDBCStrings(visit func(str string)) {
+{{- range $r.Fields}}
+{{- if eq .GoType "string"}}
+	visit(r.{{.GoName}})
+{{- end}}
+{{- end}}
+}
+
+func (r {{$r.Name}}Record) encodeDBC(b []byte, strs stringOffsetter) {
+	_ = b[{{$r.Name}}RecordSize-1]
+{{- range $r.Fields}}
+{{- if eq .GoType "int32"}}
+	binary.LittleEndian.PutUint32(b[{{.Offset}}:], uint32(r.{{.GoName}}))
+{{- else if eq .GoType "uint8"}}
+	b[{{.Offset}}] = r.{{.GoName}}
+{{- else if eq .GoType "uint32"}}
+	binary.LittleEndian.PutUint32(b[{{.Offset}}:], r.{{.GoName}})
+{{- else if eq .GoType "float32"}}
+	binary.LittleEndian.PutUint32(b[{{.Offset}}:], math.Float32bits(r.{{.GoName}}))
+{{- else if eq .GoType "float64"}}
+	binary.LittleEndian.PutUint64(b[{{.Offset}}:], math.Float64bits(r.{{.GoName}}))
+{{- else}}
+	binary.LittleEndian.PutUint32(b[{{.Offset}}:], strs.Offset(r.{{.GoName}}))
+{{- end}}
+{{- end}}
+}
+{{end}}`))
+
+func main() {
+	schemaDir := flag.String("schemas", "../../data/3.3.5.12340/schemas", "The directory of the *.dbc.json schemas to generate records for")
+	out := flag.String("out", "records_gen.go", "The Go file to generate")
+	pkg := flag.String("package", "dbc", "The package of the generated file")
+	flag.Parse()
+
+	schemaPaths, err := filepath.Glob(filepath.Join(*schemaDir, "*.dbc.json"))
+	if err != nil {
+		log.Panic("cannot list schemas", "schemas", *schemaDir, "err", err)
+	}
+	sort.Strings(schemaPaths)
+	data := genData{Package: *pkg}
+	for _, p := range schemaPaths {
+		r, err := loadRecord(p)
+		if err != nil {
+			log.Panic("cannot load schema", "path", p, "err", err)
+		}
+		for _, f := range r.Fields {
+			switch f.Type {
+			case dbc.DBCSchemaFieldFloat32, dbc.DBCSchemaFieldFloat64:
+				data.NeedsMath = true
+			case dbc.DBCSchemaFieldStringOffset:
+				data.NeedsErrors = true
+			}
+		}
+		data.Records = append(data.Records, r)
+	}
+	var buf bytes.Buffer
+	if err = recordsTemplate.Execute(&buf, &data); err != nil {
+		log.Panic("cannot generate records", "err", err)
+	}
+	src, err := format.Source(buf.Bytes())
+	if err != nil {
+		log.Panic("generated records do not compile", "err", err)
+	}
+	if err = os.WriteFile(*out, src, 0644); err != nil {
+		log.Panic("cannot write records", "out", *out, "err", err)
+	}
+	fmt.Printf("generated %d records into %s\n", len(data.Records), *out)
+}
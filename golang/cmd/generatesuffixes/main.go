@@ -31,9 +31,20 @@ func mkDirAndReadFile(path string) *os.File {
 
 func main() {
 	cfgPath := flag.String("config", "./generatesuffixes.conf.yaml", "The config file to read generate from")
+	plan := flag.Bool("plan", false, "Print the rows, DBC bytes, SQL bytes and server memory of each section of the config without generating anything")
 	flag.Parse()
 	cfgFile := mkDirAndReadFile(*cfgPath)
 	var cfg acoremodrandomsuffix.Config
+	if *plan {
+		p, err := cfg.PlanFromReader(cfgFile)
+		if err != nil {
+			log.Panic("plan cfg error", "err", err)
+		}
+		if err = p.Print(os.Stdout); err != nil {
+			log.Panic("print plan error", "err", err)
+		}
+		return
+	}
 	pcfg, err := cfg.ProcessFromReader(cfgFile)
 	if err != nil {
 		log.Panic("read and process cfg error", "err", err)
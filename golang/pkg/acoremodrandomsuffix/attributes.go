@@ -112,16 +112,39 @@ func (aa Attributes) IsValid() bool {
 	return true
 }
 
+// attributeCombinations lazily enumerates the n sized combinations of a set of attributes, in the same
+// order that combin.Combinations lists them
+type attributeCombinations struct {
+	gen           *combin.CombinationGenerator
+	attrsToChoose Attributes
+	idxs          []int
+}
+
+func newAttributeCombinations(n int, attrsToChoose Attributes) *attributeCombinations {
+	return &attributeCombinations{
+		gen:           combin.NewCombinationGenerator(len(attrsToChoose), n),
+		attrsToChoose: attrsToChoose,
+		idxs:          make([]int, n),
+	}
+}
+
+// Next returns the next combination, false once all of them have been returned
+func (c *attributeCombinations) Next() (Attributes, bool) {
+	if !c.gen.Next() {
+		return nil, false
+	}
+	c.idxs = c.gen.Combination(c.idxs)
+	attrs := make(Attributes, 0, len(c.idxs))
+	for _, attrIdx := range c.idxs {
+		attrs = append(attrs, c.attrsToChoose[attrIdx])
+	}
+	return attrs, true
+}
+
 func generateAttributeCombinations(n int, attrsToChoose Attributes) []Attributes {
-	// The integer slices returned from Combinations can be used to index
-	// into a data structure.
 	var attrss []Attributes
-	cs := combin.Combinations(len(attrsToChoose), n)
-	for _, c := range cs {
-		attrs := make(Attributes, 0, n)
-		for _, attrIdx := range c {
-			attrs = append(attrs, attrsToChoose[attrIdx])
-		}
+	combis := newAttributeCombinations(n, attrsToChoose)
+	for attrs, ok := combis.Next(); ok; attrs, ok = combis.Next() {
 		attrss = append(attrss, attrs)
 	}
 	return attrss
@@ -0,0 +1,268 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+
+	"github.com/pkg/errors"
+)
+
+// generationCacheVersion is part of every hash in the generation cache, bump it whenever a change to the
+// generator changes its output for the same config
+const generationCacheVersion = 2
+
+// The outputs of a generation, each one is only written again when its inputs or its files changed
+const (
+	outputWorldSQL            = "world-sql"
+	outputItemSuffixDBC       = "item-suffix-dbc"
+	outputSpellItemEnchantDBC = "spell-item-enchant-dbc"
+)
+
+// cachedOutput is the hash of the inputs an output was generated from, along with the hash of each of
+// its files as they were written
+type cachedOutput struct {
+	InputHash string
+	Files     map[string]string
+}
+
+// cachedSegment is a suffixSegment as it was generated, along with the IDs its suffixes were given
+type cachedSegment struct {
+	Key     string
+	Hash    string
+	Entries []customRandomSuffixEntry
+}
+
+// generationCache is what generate-cache keeps between generations. It lets an unchanged config skip
+// generation entirely, and lets a config change generate again only the segments it touches. Suffixes
+// keep their IDs across generations so that suffixes already on items keep their meaning, NextID is
+// past every ID ever handed out so an ID that is gone is not given to another suffix.
+type generationCache struct {
+	Version  int
+	StartID  int32
+	NextID   int32
+	Outputs  map[string]cachedOutput
+	Segments []cachedSegment
+}
+
+// hashConfigSection hashes the JSON of the values along with generationCacheVersion
+func hashConfigSection(values ...interface{}) string {
+	b, err := json.Marshal(append([]interface{}{generationCacheVersion}, values...))
+	if err != nil {
+		log.Panic("cannot hash config section", "err", err)
+	}
+	sum := sha256.Sum256(b)
+	return hex.EncodeToString(sum[:])
+}
+
+func hashFile(path string) (string, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return "", err
+	}
+	defer f.Close()
+	h := sha256.New()
+	if _, err = io.Copy(h, f); err != nil {
+		return "", err
+	}
+	return hex.EncodeToString(h.Sum(nil)), nil
+}
+
+// prepareGenerationCache works out the inputs of every output and loads the cache of the last
+// generation, it has to run before any output is opened
+func (p *ProcessedConfig) prepareGenerationCache(c *Config) error {
+	p.cachePath = c.GenerateCache
+	var segmentHashes [][2]string
+	for _, seg := range p.suffixSegments() {
+		segmentHashes = append(segmentHashes, [2]string{seg.key, seg.hash})
+	}
+	inputFiles := map[string]string{}
+	for _, path := range []string{c.SrcItemSuffixDBC, c.SrcItemSuffixSchema, c.SrcSpellItemEnchantDBC, c.SrcSpellItemEnchantSchema} {
+		h, err := hashFile(path)
+		if err != nil {
+			return errors.Wrapf(err, "cannot hash generation input %s", path)
+		}
+		inputFiles[path] = h
+	}
+	var itemTemplateDumpHash string
+	if c.ItemTemplateDump != "" {
+		h, err := hashFile(c.ItemTemplateDump)
+		if err != nil {
+			return errors.Wrapf(err, "cannot hash generation input %s", c.ItemTemplateDump)
+		}
+		itemTemplateDumpHash = h
+	}
+	compaction := []interface{}{c.CompactSuffixes, itemTemplateDumpHash}
+	worldSQLFiles := map[string]string{c.DstGeneratedWorldSQL: ""}
+	if c.CompactSuffixes {
+		worldSQLFiles[c.DstGeneratedSuffixRemap] = ""
+	}
+	if c.WorldSQLFormat == WorldSQLFormatLoadData {
+		for _, name := range []string{spellItemEnchantmentTSVName, itemRandomSuffixTSVName, itemEnchantmentRandomSuffixesTSVName} {
+			worldSQLFiles[filepath.Join(c.DstGeneratedWorldTSVDir, name)] = ""
+		}
+	}
+	p.outputs = map[string]cachedOutput{
+		outputWorldSQL: {
+			InputHash: hashConfigSection(c.ItemRandomSuffixDBCCustomStartID, segmentHashes, customSpellItemEnchantRecords, c.WorldSQLFormat, c.WorldSQLBatchRows, c.DstGeneratedWorldTSVDir, compaction),
+			Files:     worldSQLFiles,
+		},
+		outputItemSuffixDBC: {
+			InputHash: hashConfigSection(inputFiles[c.SrcItemSuffixDBC], inputFiles[c.SrcItemSuffixSchema], c.ItemRandomSuffixDBCCustomStartID, segmentHashes, compaction),
+			Files:     map[string]string{c.DstGeneratedItemSuffixDBC: ""},
+		},
+		outputSpellItemEnchantDBC: {
+			InputHash: hashConfigSection(inputFiles[c.SrcSpellItemEnchantDBC], inputFiles[c.SrcSpellItemEnchantSchema], customSpellItemEnchantRecords),
+			Files:     map[string]string{c.DstGeneratedSpellItemEnchantDBC: ""},
+		},
+	}
+
+	b, err := os.ReadFile(p.cachePath)
+	if os.IsNotExist(err) {
+		return nil
+	}
+	if err != nil {
+		return errors.Wrapf(err, "cannot read generation cache %s", p.cachePath)
+	}
+	var prev generationCache
+	if err = json.Unmarshal(b, &prev); err != nil || prev.Version != generationCacheVersion {
+		log.Warn("generation cache is unreadable or from another version, generating everything", "path", p.cachePath, "err", err)
+		return nil
+	}
+	if prev.StartID != c.ItemRandomSuffixDBCCustomStartID {
+		log.Warn("item-random-suffix-dbc-custom-start-id changed, every suffix ID is handed out again", "old_start_id", prev.StartID)
+		prev.Segments, prev.NextID = nil, 0
+	}
+	p.prevCache = &prev
+	p.upToDate = make(map[string]bool, len(p.outputs))
+	for output := range p.outputs {
+		p.upToDate[output] = p.checkOutputUpToDate(output)
+	}
+	return nil
+}
+
+// outputUpToDate is true if the output does not have to be generated again
+func (p *ProcessedConfig) outputUpToDate(output string) bool {
+	return p.upToDate[output]
+}
+
+// checkOutputUpToDate is true if the output was generated from the same inputs last time and none of
+// its files have been changed since
+func (p *ProcessedConfig) checkOutputUpToDate(output string) bool {
+	prev, ok := p.prevCache.Outputs[output]
+	if !ok || prev.InputHash != p.outputs[output].InputHash || len(prev.Files) != len(p.outputs[output].Files) {
+		return false
+	}
+	for path := range p.outputs[output].Files {
+		h, err := hashFile(path)
+		if err != nil || h != prev.Files[path] {
+			return false
+		}
+	}
+	return true
+}
+
+// layoutSegments hands out the IDs of every suffix. A segment that has not changed is taken from the
+// cache as it is. A changed segment is generated again, its suffixes that were there before keep their
+// IDs and new ones get IDs after the highest ID ever handed out. It returns the segments and the next
+// free ID.
+func (p *ProcessedConfig) layoutSegments(segments []suffixSegment) ([]cachedSegment, int32, error) {
+	nextID := p.ItemRandomSuffixDBCCustomStartID
+	prevSegments := make(map[string]cachedSegment)
+	if p.prevCache != nil {
+		for _, s := range p.prevCache.Segments {
+			prevSegments[s.Key] = s
+		}
+		if p.prevCache.NextID > nextID {
+			nextID = p.prevCache.NextID
+		}
+	}
+	layout := make([]cachedSegment, 0, len(segments))
+	for _, seg := range segments {
+		prev, ok := prevSegments[seg.key]
+		if ok && prev.Hash == seg.hash {
+			layout = append(layout, prev)
+			continue
+		}
+		// Names are not unique, every tier of an attribute set shares one, so a suffix is matched on what
+		// it rolls. Suffixes that roll the same thing take the old IDs in generation order.
+		prevIDs := make(map[string][]int32, len(prev.Entries))
+		for _, e := range prev.Entries {
+			k := e.layoutKey()
+			prevIDs[k] = append(prevIDs[k], e.ID)
+		}
+		s := cachedSegment{Key: seg.key, Hash: seg.hash}
+		kept := 0
+		err := seg.generate(func(e customRandomSuffixEntry) error {
+			k := e.layoutKey()
+			if ids := prevIDs[k]; len(ids) > 0 {
+				e.ID, prevIDs[k] = ids[0], ids[1:]
+				kept++
+			} else {
+				e.ID = nextID
+				nextID++
+			}
+			s.Entries = append(s.Entries, e)
+			return nil
+		})
+		if err != nil {
+			return nil, 0, err
+		}
+		if ok {
+			log.Info("suffix segment changed, generated again", "segment", seg.key, "kept", kept, "added", len(s.Entries)-kept, "retired", len(prev.Entries)-kept)
+		}
+		layout = append(layout, s)
+	}
+	return layout, nextID, nil
+}
+
+// layoutKey identifies a suffix across generations by its name and what it rolls
+func (e customRandomSuffixEntry) layoutKey() string {
+	return fmt.Sprint(e.Name, e.EnchantIDs, e.AllocationPcts, e.AttrMask, e.EnchantQuality)
+}
+
+// saveGenerationCache records the inputs and files of every output along with the segment layout, a nil
+// layout keeps the one of the last generation
+func (p *ProcessedConfig) saveGenerationCache(layout []cachedSegment, nextID int32) error {
+	if p.cachePath == "" {
+		return nil
+	}
+	c := generationCache{
+		Version:  generationCacheVersion,
+		StartID:  p.ItemRandomSuffixDBCCustomStartID,
+		NextID:   nextID,
+		Outputs:  make(map[string]cachedOutput, len(p.outputs)),
+		Segments: layout,
+	}
+	if layout == nil && p.prevCache != nil {
+		c.Segments, c.NextID = p.prevCache.Segments, p.prevCache.NextID
+	}
+	for output, o := range p.outputs {
+		files := make(map[string]string, len(o.Files))
+		for path := range o.Files {
+			h, err := hashFile(path)
+			if err != nil {
+				return errors.Wrapf(err, "cannot hash generated output %s", path)
+			}
+			files[path] = h
+		}
+		c.Outputs[output] = cachedOutput{InputHash: o.InputHash, Files: files}
+	}
+	b, err := json.Marshal(&c)
+	if err != nil {
+		return errors.Wrap(err, "cannot encode generation cache")
+	}
+	tmp := p.cachePath + ".tmp"
+	if err = os.WriteFile(tmp, b, 0644); err != nil {
+		return errors.Wrapf(err, "cannot write generation cache %s", tmp)
+	}
+	return errors.Wrapf(os.Rename(tmp, p.cachePath), "cannot replace generation cache %s", p.cachePath)
+}
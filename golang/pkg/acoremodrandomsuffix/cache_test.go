@@ -0,0 +1,96 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"testing"
+)
+
+// tierEntries are the tiers of one attribute set, they all share a name like the generated ones do
+func tierEntries(name string, attrMask uint, pcts ...int32) []customRandomSuffixEntry {
+	entries := make([]customRandomSuffixEntry, 0, len(pcts))
+	for _, pct := range pcts {
+		entries = append(entries, customRandomSuffixEntry{
+			Name:           name,
+			EnchantIDs:     []int32{1, 2},
+			AllocationPcts: []int32{pct, pct},
+			AttrMask:       attrMask,
+		})
+	}
+	return entries
+}
+
+func testSegment(key, hash string, entries []customRandomSuffixEntry) suffixSegment {
+	return suffixSegment{key: key, hash: hash, generate: func(emit func(e customRandomSuffixEntry) error) error {
+		for _, e := range entries {
+			if err := emit(e); err != nil {
+				return err
+			}
+		}
+		return nil
+	}}
+}
+
+func TestLayoutSegmentsKeepsIDsOfSharedNames(t *testing.T) {
+	p := &ProcessedConfig{ItemRandomSuffixDBCCustomStartID: 100}
+	first := append(tierEntries("[ I]", 0x3, 1000, 2000, 3000), tierEntries("[ II]", 0x5, 1000, 2000)...)
+	layout, nextID, err := p.layoutSegments([]suffixSegment{testSegment("attributes", "a", first)})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if nextID != 105 {
+		t.Fatalf("next ID after a fresh layout = %d, want 105", nextID)
+	}
+	prevIDs := make(map[string]int32)
+	for _, e := range layout[0].Entries {
+		prevIDs[e.layoutKey()] = e.ID
+	}
+
+	// The segment changes, a tier is added in front of the others and one is dropped, the remaining
+	// suffixes must keep the IDs they had and not the ID of whichever suffix had their name last
+	second := append(tierEntries("[ I]", 0x3, 500, 1000, 3000), tierEntries("[ II]", 0x5, 2000, 1000)...)
+	p.prevCache = &generationCache{StartID: 100, NextID: nextID, Segments: layout}
+	layout, nextID, err = p.layoutSegments([]suffixSegment{testSegment("attributes", "b", second)})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if nextID != 106 {
+		t.Fatalf("next ID after adding one suffix = %d, want 106", nextID)
+	}
+	seen := make(map[int32]bool)
+	for _, e := range layout[0].Entries {
+		if seen[e.ID] {
+			t.Fatalf("ID %d is handed out twice", e.ID)
+		}
+		seen[e.ID] = true
+		id, existed := prevIDs[e.layoutKey()]
+		switch {
+		case existed && e.ID != id:
+			t.Errorf("%s %v has ID %d, want its old ID %d", e.Name, e.AllocationPcts, e.ID, id)
+		case !existed && e.ID != 105:
+			t.Errorf("new suffix %s %v has ID %d, want 105", e.Name, e.AllocationPcts, e.ID)
+		}
+	}
+}
+
+func TestLayoutSegmentsSameSuffixTwice(t *testing.T) {
+	p := &ProcessedConfig{ItemRandomSuffixDBCCustomStartID: 100}
+	dup := tierEntries("[ I]", 0x3, 1000, 1000)
+	layout, nextID, err := p.layoutSegments([]suffixSegment{testSegment("attributes", "a", dup)})
+	if err != nil {
+		t.Fatal(err)
+	}
+	p.prevCache = &generationCache{StartID: 100, NextID: nextID, Segments: layout}
+	layout, nextID, err = p.layoutSegments([]suffixSegment{testSegment("attributes", "b", dup)})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if nextID != 102 {
+		t.Fatalf("next ID = %d, want 102", nextID)
+	}
+	if got := layout[0].Entries; got[0].ID != 100 || got[1].ID != 101 {
+		t.Fatalf("IDs = %d, %d, want 100, 101 in generation order", got[0].ID, got[1].ID)
+	}
+}
@@ -0,0 +1,259 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"bufio"
+	"math"
+	"os"
+	"strconv"
+	"strings"
+
+	"github.com/pkg/errors"
+)
+
+var ErrItemTemplateDumpMissingColumn = errors.New("item template dump is missing a column")
+
+// Item classes and inventory types of item_template, as used by isRollableItemTemplate in the module
+const (
+	itemClassWeapon = 2
+	itemClassArmor  = 4
+
+	itemQualityUncommon  = 2
+	itemQualityLegendary = 5
+
+	invTypeNonEquip = 0
+	invTypeBag      = 18
+	invTypeTabard   = 19
+	invTypeAmmo     = 24
+	invTypeQuiver   = 27
+
+	// maxPlayerLevel is the default CONFIG_MAX_PLAYER_LEVEL, the player level of items without any
+	// required level to go by
+	maxPlayerLevel = 80
+)
+
+// dumpedItem is a row of an item_template dump
+type dumpedItem struct {
+	class, subclass, quality, invType, itemLevel, requiredLevel int
+}
+
+// rollable is the same check as isRollableItemTemplate in the module
+func (it dumpedItem) rollable() bool {
+	switch it.invType {
+	case invTypeNonEquip, invTypeBag, invTypeTabard, invTypeAmmo, invTypeQuiver:
+		return false
+	}
+	return it.quality >= itemQualityUncommon && it.quality <= itemQualityLegendary &&
+		(it.class == itemClassWeapon || it.class == itemClassArmor)
+}
+
+// Server memory of one row of sItemRandomSuffixStore on a 64 bit worldserver. The store keeps a pointer per
+// ID up to the highest ID, and a record laid out by the DBC format "nssssssssssssssssxxiiiiiiiiii": the ID,
+// 16 name pointers and the 10 enchantment and allocation fields, padded to 8 bytes.
+const (
+	suffixStoreIndexSize  = 8
+	suffixStoreRecordSize = 176
+	dbcHeaderSize         = 20
+)
+
+// itemRollTarget is a class, subclass and player level that a rollable item of item_template rolls
+// suffixes for
+type itemRollTarget struct {
+	class    int
+	subclass int
+	level    int
+}
+
+// itemReachability is every itemRollTarget of an item_template dump
+type itemReachability struct {
+	targets []itemRollTarget
+}
+
+// loadItemTemplateDump reads a tab separated item_template dump with a header row, such as the output of
+//
+//	mysql --batch -e "SELECT entry, name, class, subclass, Quality, InventoryType, ItemLevel, RequiredLevel FROM item_template" acore_world
+//
+// The player level of an item is worked out the same way as the module does it: its RequiredLevel, or the
+// average RequiredLevel of weapons and armor of its ItemLevel, or the max player level.
+func loadItemTemplateDump(path string) (*itemReachability, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, errors.Wrapf(err, "cannot open item template dump %s", path)
+	}
+	defer f.Close()
+	var items []dumpedItem
+	columns := []string{"name", "class", "subclass", "Quality", "InventoryType", "ItemLevel", "RequiredLevel"}
+	colIdxs := make([]int, len(columns))
+	// Sum and count of RequiredLevel by ItemLevel, the same as RandomEnchantsMgr::LoadItemLevelRequirements
+	levelSums := make(map[int][2]int)
+	sc := bufio.NewScanner(f)
+	sc.Buffer(make([]byte, 64*1024), 1024*1024)
+	for line := 0; sc.Scan(); line++ {
+		fields := strings.Split(sc.Text(), "\t")
+		if line == 0 {
+			for i, col := range columns {
+				colIdxs[i] = -1
+				for j, field := range fields {
+					if strings.EqualFold(field, col) {
+						colIdxs[i] = j
+					}
+				}
+				if colIdxs[i] < 0 {
+					return nil, errors.Wrapf(ErrItemTemplateDumpMissingColumn, "column %s of %s", col, path)
+				}
+			}
+			continue
+		}
+		var vals [6]int
+		for i, colIdx := range colIdxs[1:] {
+			if colIdx >= len(fields) {
+				return nil, errors.Errorf("item template dump %s line %d has %d columns", path, line+1, len(fields))
+			}
+			if vals[i], err = strconv.Atoi(fields[colIdx]); err != nil {
+				return nil, errors.Wrapf(err, "item template dump %s line %d column %s", path, line+1, columns[i+1])
+			}
+		}
+		it := dumpedItem{class: vals[0], subclass: vals[1], quality: vals[2], invType: vals[3], itemLevel: vals[4], requiredLevel: vals[5]}
+		items = append(items, it)
+		name := strings.ToLower(fields[colIdxs[0]])
+		if (it.class == itemClassWeapon || it.class == itemClassArmor) && it.requiredLevel != 0 &&
+			!strings.Contains(name, "qa") && !strings.Contains(name, "test") && !strings.Contains(name, "debug") &&
+			!strings.Contains(name, "internal") && !strings.Contains(name, "demo") {
+			s := levelSums[it.itemLevel]
+			levelSums[it.itemLevel] = [2]int{s[0] + it.requiredLevel, s[1] + 1}
+		}
+	}
+	if err = sc.Err(); err != nil {
+		return nil, errors.Wrapf(err, "cannot read item template dump %s", path)
+	}
+
+	seen := make(map[itemRollTarget]struct{})
+	r := &itemReachability{}
+	for _, it := range items {
+		if !it.rollable() {
+			continue
+		}
+		t := itemRollTarget{class: it.class, subclass: it.subclass, level: it.requiredLevel}
+		if t.level == 0 {
+			if s, ok := levelSums[it.itemLevel]; ok {
+				t.level = int(math.Ceil(float64(s[0]) / float64(s[1])))
+			} else {
+				t.level = maxPlayerLevel
+			}
+		}
+		if _, ok := seen[t]; !ok {
+			seen[t] = struct{}{}
+			r.targets = append(r.targets, t)
+		}
+	}
+	log.Info("loaded item template dump", "path", path, "items", len(items), "roll_targets", len(r.targets))
+	return r, nil
+}
+
+// reachable is true if some item rolls for a suffix with the level, class and subclass conditions of e.
+// The conditions are those of the roll query of the module.
+func (r *itemReachability) reachable(e customRandomSuffixEntry) bool {
+	for _, t := range r.targets {
+		if !((e.MinLevel <= t.level && t.level <= e.MaxLevel) || (e.MinLevel == 0 && e.MaxLevel == 0)) {
+			continue
+		}
+		if e.ItemClass == 0 || (e.ItemClass == t.class && (e.ItemSubclassMask == 0 || e.ItemSubclassMask&(1<<uint(t.subclass)) > 0)) {
+			return true
+		}
+	}
+	return false
+}
+
+// suffixPayload is what an item gets from a suffix, its enchantments and their allocations
+type suffixPayload [2 * maxEnchantsForSuffix]int32
+
+func (e customRandomSuffixEntry) payload() suffixPayload {
+	var p suffixPayload
+	copy(p[:maxEnchantsForSuffix], e.EnchantIDs)
+	copy(p[maxEnchantsForSuffix:], e.AllocationPcts)
+	return p
+}
+
+// suffixRemap is a suffix ID that compaction took out, NewID is the suffix it merged into or 0 if it
+// was pruned
+type suffixRemap struct {
+	OldID int32
+	NewID int32
+}
+
+// suffixCompactor collapses suffixes as they are generated. A suffix with the same payload as an earlier
+// one merges into it: its row of item_enchantment_random_suffixes is kept but points at the earlier
+// suffix, so rolls pick the payload as often as before. With an item_template dump, a suffix that no item
+// can roll is pruned. Suffixes are never renumbered, every suffix taken out is listed in the remap.
+type suffixCompactor struct {
+	reachability *itemReachability
+	payloads     map[suffixPayload]int32
+	remap        []suffixRemap
+	rows         int
+	// strBytes are the bytes of the names of the suffixes in the DBC string block, before and after
+	strBytesBefore int64
+	strBytesAfter  int64
+	maxIDBefore    int32
+	maxIDAfter     int32
+}
+
+func newSuffixCompactor(reachability *itemReachability) *suffixCompactor {
+	return &suffixCompactor{reachability: reachability, payloads: make(map[suffixPayload]int32)}
+}
+
+// compact works out what becomes of a suffix. Its ID is changed to the suffix it merged into if it
+// merged, keepSuffix is false if it merged or was pruned and keepRow is false if it was pruned.
+func (c *suffixCompactor) compact(e *customRandomSuffixEntry) (keepSuffix, keepRow bool) {
+	c.rows++
+	strBytes := int64(len(e.displayName()) + len(e.internalName()) + 2)
+	c.strBytesBefore += strBytes
+	c.maxIDBefore = e.ID
+	if c.reachability != nil && !c.reachability.reachable(*e) {
+		c.remap = append(c.remap, suffixRemap{OldID: e.ID})
+		return false, false
+	}
+	payload := e.payload()
+	if id, ok := c.payloads[payload]; ok {
+		c.remap = append(c.remap, suffixRemap{OldID: e.ID, NewID: id})
+		e.ID = id
+		return false, true
+	}
+	c.payloads[payload] = e.ID
+	c.strBytesAfter += strBytes
+	c.maxIDAfter = e.ID
+	return true, true
+}
+
+// report logs the suffix rows, DBC size and sItemRandomSuffixStore memory before and after compaction.
+// dbcSize, sourceRows and sourceMaxID describe the DBC as written, dbcSize is 0 if the DBC was not.
+func (c *suffixCompactor) report(dbcSize int64, recordSize int, sourceRows int, sourceMaxID int32) {
+	merged, pruned := 0, 0
+	for _, r := range c.remap {
+		if r.NewID == 0 {
+			pruned++
+		} else {
+			merged++
+		}
+	}
+	rowsAfter := c.rows - merged - pruned
+	log.Info("compacted suffixes", "rows_before", c.rows, "rows_after", rowsAfter, "merged", merged, "pruned", pruned)
+	if dbcSize == 0 {
+		return
+	}
+	dbcSizeBefore := dbcSize + int64(c.rows-rowsAfter)*int64(recordSize) + c.strBytesBefore - c.strBytesAfter
+	storeSize := func(rows int, maxID int32, dbcSize int64) int64 {
+		if sourceMaxID > maxID {
+			maxID = sourceMaxID
+		}
+		rows += sourceRows
+		strs := dbcSize - dbcHeaderSize - int64(rows)*int64(recordSize)
+		return int64(maxID+1)*suffixStoreIndexSize + int64(rows)*suffixStoreRecordSize + strs
+	}
+	log.Info("compacted ItemRandomSuffix DBC",
+		"dbc_bytes_before", dbcSizeBefore, "dbc_bytes_after", dbcSize,
+		"store_bytes_before", storeSize(c.rows, c.maxIDBefore, dbcSizeBefore), "store_bytes_after", storeSize(rowsAfter, c.maxIDAfter, dbcSize),
+	)
+}
@@ -6,6 +6,7 @@ package acoremodrandomsuffix
 
 import (
 	"io"
+	"path/filepath"
 
 	"github.com/lohvht/mod-random-suffix/golang/pkg/dbc"
 	"github.com/pkg/errors"
@@ -14,8 +15,23 @@ import (
 
 var (
 	ErrConfigHasDuplicateAttributeMix = errors.New("Entry of the same mask already exists, check the suffixes again")
+	ErrConfigInvalidWorldSQLFormat    = errors.New("world-sql-format should be either insert or load-data")
+	ErrConfigMissingSuffixRemap       = errors.New("compact-suffixes needs dst-generated-suffix-remap to be set")
+	ErrConfigItemTemplateDumpUnused   = errors.New("item-template-dump is only used with compact-suffixes")
+	ErrConfigUnknownSuffixWeight      = errors.New("suffix-weights names a suffix that is not in suffixes")
 )
 
+const (
+	// WorldSQLFormatInsert writes the generated world SQL as INSERT statements
+	WorldSQLFormatInsert = "insert"
+	// WorldSQLFormatLoadData writes the generated rows as tab separated files, along with world SQL that
+	// loads them with LOAD DATA LOCAL INFILE
+	WorldSQLFormatLoadData = "load-data"
+)
+
+// defaultSuffixWeight is the weight of a suffix without one in the config
+const defaultSuffixWeight uint32 = 1
+
 type WeaponSuffix struct {
 	Name              string            `yaml:"name"`
 	MinLevel          int               `yaml:"minlvl"`
@@ -23,6 +39,17 @@ type WeaponSuffix struct {
 	ItemClass         int               `yaml:"itemclass"`
 	ItemSubClasses    ItemSubclasses    `yaml:"itemsubclasses"`
 	EnchantCategories EnchantCategories `yaml:"enchantcats"`
+	// Weight is how likely the suffixes of the weapon suffix are picked against the other candidates of a
+	// roll, nil for defaultSuffixWeight
+	Weight *uint32 `yaml:"weight,omitempty"`
+}
+
+// weight is the Weight of every suffix of the weapon suffix
+func (ws WeaponSuffix) weight() uint32 {
+	if ws.Weight == nil {
+		return defaultSuffixWeight
+	}
+	return *ws.Weight
 }
 
 // Config contains the configuration of suffix generation taken from yaml.
@@ -34,8 +61,10 @@ type Config struct {
 	SrcSpellItemEnchantSchema string `yaml:"src-spell-item-enchant-schema"`
 	// Destination
 	DstGeneratedWorldSQL            string `yaml:"dst-generated-world-sql"`
+	DstGeneratedWorldTSVDir         string `yaml:"dst-generated-world-tsv-dir"`
 	DstGeneratedItemSuffixDBC       string `yaml:"dst-generated-item-suffix-dbc"`
 	DstGeneratedSpellItemEnchantDBC string `yaml:"dst-generated-spell-item-enchant-dbc"`
+	DstGeneratedSuffixRemap         string `yaml:"dst-generated-suffix-remap"`
 	// Generate configuration
 	ItemRandomSuffixDBCCustomStartID int32                  `yaml:"item-random-suffix-dbc-custom-start-id"`
 	NumberOfAttributes               int                    `yaml:"number-of-attributes"`
@@ -43,51 +72,133 @@ type Config struct {
 	StatPointAllocTiers              []int                  `yaml:"stat-point-alloc-tiers"`
 	WeaponStatPenalty                float64                `yaml:"weapon-stat-penalty"`
 	Suffixes                         map[string]Attributes  `yaml:"suffixes"`
+	SuffixWeights                    map[string]uint32      `yaml:"suffix-weights"`
 	WeaponSuffixes                   map[int32]WeaponSuffix `yaml:"weaponsuffixes"`
+	WorldSQLFormat                   string                 `yaml:"world-sql-format"`
+	WorldSQLBatchRows                int                    `yaml:"world-sql-batch-rows"`
+	GenerateCache                    string                 `yaml:"generate-cache"`
+	CompactSuffixes                  bool                   `yaml:"compact-suffixes"`
+	ItemTemplateDump                 string                 `yaml:"item-template-dump"`
 }
 
 // ProcessFromReader processes the suffix generation config from a reader and spits out a processed config
 func (c *Config) ProcessFromReader(cfgfile io.Reader) (*ProcessedConfig, error) {
+	if err := c.decode(cfgfile); err != nil {
+		return nil, err
+	}
+	return c.Process()
+}
+
+func (c *Config) decode(cfgfile io.Reader) error {
 	ymlCfgFile := yaml.NewDecoder(cfgfile)
 	err := ymlCfgFile.Decode(c)
-	if err != nil {
-		return nil, errors.Wrap(err, "unable to marshal config")
+	return errors.Wrap(err, "unable to marshal config")
+}
+
+// validate checks the config and fills in its defaults
+func (c *Config) validate() error {
+	switch c.WorldSQLFormat {
+	case "":
+		c.WorldSQLFormat = WorldSQLFormatInsert
+	case WorldSQLFormatInsert, WorldSQLFormatLoadData:
+	default:
+		return errors.Wrapf(ErrConfigInvalidWorldSQLFormat, "world-sql-format was '%s'", c.WorldSQLFormat)
 	}
-	irsDBC, err := dbc.NewDBCFromFile(c.SrcItemSuffixDBC, c.SrcItemSuffixSchema)
-	if err != nil {
-		return nil, errors.Wrapf(err, "Error open source ItemSuffix DBC - dbcpath '%s', schemapath '%s'", c.SrcItemSuffixDBC, c.SrcItemSuffixSchema)
+	if c.DstGeneratedWorldTSVDir == "" {
+		c.DstGeneratedWorldTSVDir = filepath.Dir(c.DstGeneratedWorldSQL)
+	}
+	if c.CompactSuffixes && c.DstGeneratedSuffixRemap == "" {
+		return ErrConfigMissingSuffixRemap
+	}
+	if !c.CompactSuffixes && c.ItemTemplateDump != "" {
+		return ErrConfigItemTemplateDumpUnused
+	}
+	for name := range c.SuffixWeights {
+		if _, ok := c.Suffixes[name]; !ok {
+			return errors.Wrapf(ErrConfigUnknownSuffixWeight, "suffix-weights has '%s'", name)
+		}
 	}
-	sieDBC, err := dbc.NewDBCFromFile(c.SrcSpellItemEnchantDBC, c.SrcSpellItemEnchantSchema)
+	return nil
+}
+
+// newProcessedConfig is the processed config without any of its sources or destinations
+func (c *Config) newProcessedConfig() *ProcessedConfig {
+	return &ProcessedConfig{
+		DstGeneratedWorldTSVDir:          c.DstGeneratedWorldTSVDir,
+		ItemRandomSuffixDBCCustomStartID: c.ItemRandomSuffixDBCCustomStartID,
+		NumberOfAttributes:               c.NumberOfAttributes,
+		NumberOfAttributesWeapons:        c.NumberOfAttributesWeapons,
+		StatPointAllocTiers:              c.StatPointAllocTiers,
+		WeaponStatPenalty:                c.WeaponStatPenalty,
+		Suffixes:                         c.Suffixes,
+		SuffixWeights:                    c.SuffixWeights,
+		WeaponSuffixes:                   c.WeaponSuffixes,
+		WorldSQLFormat:                   c.WorldSQLFormat,
+		WorldSQLBatchRows:                c.WorldSQLBatchRows,
+		CompactSuffixes:                  c.CompactSuffixes,
+	}
+}
+
+// Process reads the sources of a decoded config and opens its destinations
+func (c *Config) Process() (*ProcessedConfig, error) {
+	err := c.validate()
 	if err != nil {
-		return nil, errors.Wrapf(err, "Error open source SpellItemEnchantment DBC - dbcpath '%s', schemapath '%s'", c.SrcSpellItemEnchantDBC, c.SrcSpellItemEnchantSchema)
+		return nil, err
+	}
+	p := c.newProcessedConfig()
+	if c.GenerateCache != "" {
+		// Has to come before the destinations are opened, opening them truncates them
+		if err = p.prepareGenerationCache(c); err != nil {
+			return nil, err
+		}
+	}
+	if !p.outputUpToDate(outputItemSuffixDBC) {
+		p.SrcItemSuffixDBC, err = dbc.ReadTableFromFile[dbc.ItemRandomSuffixRecord](c.SrcItemSuffixDBC)
+		if err == nil {
+			err = p.SrcItemSuffixDBC.CheckSchemaFile(c.SrcItemSuffixSchema)
+		}
+		if err != nil {
+			return nil, errors.Wrapf(err, "Error open source ItemSuffix DBC - dbcpath '%s', schemapath '%s'", c.SrcItemSuffixDBC, c.SrcItemSuffixSchema)
+		}
+	}
+	if c.ItemTemplateDump != "" && (!p.outputUpToDate(outputWorldSQL) || !p.outputUpToDate(outputItemSuffixDBC)) {
+		if p.itemReachability, err = loadItemTemplateDump(c.ItemTemplateDump); err != nil {
+			return nil, err
+		}
+	}
+	if !p.outputUpToDate(outputSpellItemEnchantDBC) {
+		p.SrcSpellItemEnchantDBC, err = dbc.ReadTableFromFile[dbc.SpellItemEnchantmentRecord](c.SrcSpellItemEnchantDBC)
+		if err == nil {
+			err = p.SrcSpellItemEnchantDBC.CheckSchemaFile(c.SrcSpellItemEnchantSchema)
+		}
+		if err != nil {
+			return nil, errors.Wrapf(err, "Error open source SpellItemEnchantment DBC - dbcpath '%s', schemapath '%s'", c.SrcSpellItemEnchantDBC, c.SrcSpellItemEnchantSchema)
+		}
 	}
 	// Destination DBCs
-	dstWorldSQL, err := mkDirAndOpenFile(c.DstGeneratedWorldSQL)
-	if err != nil {
-		return nil, errors.Wrapf(err, "error open destination world SQL, path - '%s'", c.DstGeneratedWorldSQL)
+	if !p.outputUpToDate(outputWorldSQL) {
+		p.DstGeneratedWorldSQL, err = mkDirAndOpenFile(c.DstGeneratedWorldSQL)
+		if err != nil {
+			return nil, errors.Wrapf(err, "error open destination world SQL, path - '%s'", c.DstGeneratedWorldSQL)
+		}
+		if c.CompactSuffixes {
+			p.DstGeneratedSuffixRemap, err = mkDirAndOpenFile(c.DstGeneratedSuffixRemap)
+			if err != nil {
+				return nil, errors.Wrapf(err, "error open destination suffix remap SQL, path - '%s'", c.DstGeneratedSuffixRemap)
+			}
+		}
 	}
-	dstIrsDBC, err := mkDirAndOpenFile(c.DstGeneratedItemSuffixDBC)
-	if err != nil {
-		return nil, errors.Wrapf(err, "error open destination ItemSuffix DBC, path - '%s'", c.DstGeneratedItemSuffixDBC)
+	if !p.outputUpToDate(outputItemSuffixDBC) {
+		p.DstExportedGeneratedItemSuffixDBC, err = mkDirAndOpenFile(c.DstGeneratedItemSuffixDBC)
+		if err != nil {
+			return nil, errors.Wrapf(err, "error open destination ItemSuffix DBC, path - '%s'", c.DstGeneratedItemSuffixDBC)
+		}
 	}
-	dstSieDBC, err := mkDirAndOpenFile(c.DstGeneratedSpellItemEnchantDBC)
-	if err != nil {
-		return nil, errors.Wrapf(err, "error open destination SpellItemEnchantment DBC, path - '%s'", c.DstGeneratedSpellItemEnchantDBC)
-	}
-
-	p := &ProcessedConfig{
-		SrcItemSuffixDBC:                        &irsDBC,
-		SrcSpellItemEnchantDBC:                  &sieDBC,
-		DstGeneratedWorldSQL:                    dstWorldSQL,
-		DstExportedGeneratedItemSuffixDBC:       dstIrsDBC,
-		DstExportedGeneratedSpellItemEnchantDBC: dstSieDBC,
-		ItemRandomSuffixDBCCustomStartID:        c.ItemRandomSuffixDBCCustomStartID,
-		NumberOfAttributes:                      c.NumberOfAttributes,
-		NumberOfAttributesWeapons:               c.NumberOfAttributesWeapons,
-		StatPointAllocTiers:                     c.StatPointAllocTiers,
-		WeaponStatPenalty:                       c.WeaponStatPenalty,
-		Suffixes:                                c.Suffixes,
-		WeaponSuffixes:                          c.WeaponSuffixes,
+	if !p.outputUpToDate(outputSpellItemEnchantDBC) {
+		p.DstExportedGeneratedSpellItemEnchantDBC, err = mkDirAndOpenFile(c.DstGeneratedSpellItemEnchantDBC)
+		if err != nil {
+			return nil, errors.Wrapf(err, "error open destination SpellItemEnchantment DBC, path - '%s'", c.DstGeneratedSpellItemEnchantDBC)
+		}
 	}
 	// set this once, to make sure that its valid
 	p.SuffixMaskToNames()
@@ -96,12 +207,14 @@ func (c *Config) ProcessFromReader(cfgfile io.Reader) (*ProcessedConfig, error)
 
 type ProcessedConfig struct {
 	// Source
-	SrcItemSuffixDBC       *dbc.DBC
-	SrcSpellItemEnchantDBC *dbc.DBC
+	SrcItemSuffixDBC       *dbc.Table[dbc.ItemRandomSuffixRecord]
+	SrcSpellItemEnchantDBC *dbc.Table[dbc.SpellItemEnchantmentRecord]
 	// Destination
 	DstGeneratedWorldSQL                    io.Writer
+	DstGeneratedWorldTSVDir                 string
 	DstExportedGeneratedItemSuffixDBC       io.WriteSeeker
 	DstExportedGeneratedSpellItemEnchantDBC io.WriteSeeker
+	DstGeneratedSuffixRemap                 io.Writer
 	// Generate configuration
 	ItemRandomSuffixDBCCustomStartID int32
 	NumberOfAttributes               int
@@ -109,10 +222,22 @@ type ProcessedConfig struct {
 	StatPointAllocTiers              []int
 	WeaponStatPenalty                float64
 	Suffixes                         map[string]Attributes
+	SuffixWeights                    map[string]uint32
 	WeaponSuffixes                   map[int32]WeaponSuffix
+	WorldSQLFormat                   string
+	WorldSQLBatchRows                int
+	CompactSuffixes                  bool
 
 	// generated from Suffixes to check duplicates
 	suffixMaskToNames map[uint]string `yaml:"-"`
+	// loaded from ItemTemplateDump for compaction, nil if there is no dump
+	itemReachability *itemReachability
+
+	// Generation cache, see generationCache. cachePath is empty when generate-cache is not set.
+	cachePath string
+	prevCache *generationCache
+	outputs   map[string]cachedOutput
+	upToDate  map[string]bool
 }
 
 func (p *ProcessedConfig) SuffixMaskToNames() map[uint]string {
@@ -130,3 +255,12 @@ func (p *ProcessedConfig) SuffixMaskToNames() map[uint]string {
 	p.suffixMaskToNames = suffixMaskToNames
 	return p.suffixMaskToNames
 }
+
+// suffixWeight is the weight of the attribute suffixes named name, defaultSuffixWeight if suffix-weights
+// does not have it
+func (p *ProcessedConfig) suffixWeight(name string) uint32 {
+	if w, ok := p.SuffixWeights[name]; ok {
+		return w
+	}
+	return defaultSuffixWeight
+}
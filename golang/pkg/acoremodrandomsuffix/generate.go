@@ -8,7 +8,6 @@ import (
 	"fmt"
 	"math"
 	"sort"
-	"strconv"
 
 	"github.com/lohvht/mod-random-suffix/golang/pkg/dbc"
 	"github.com/pkg/errors"
@@ -34,6 +33,7 @@ type customRandomSuffixEntry struct {
 	MinLevel         int
 	MaxLevel         int
 	ItemClass        int
+	Weight           uint32
 }
 
 func (e customRandomSuffixEntry) displayName() string {
@@ -61,33 +61,31 @@ func (e customRandomSuffixEntry) nameMask() int64 {
 	return 16712190
 }
 
-func (e customRandomSuffixEntry) toDBCCSVEntry(schema dbc.DBCSchema) ([]string, error) {
+func (e customRandomSuffixEntry) toDBCRecord() (dbc.ItemRandomSuffixRecord, error) {
 	err := e.check()
 	if err != nil {
-		return nil, err
+		return dbc.ItemRandomSuffixRecord{}, err
 	}
-	// Form the item random suffix here
-	row := make([]string, len(schema.Fields))
-	// ID
-	row[0] = strconv.FormatInt(int64(e.ID), 10)
-	// Name
-	row[1] = e.displayName()
-	// NameMask
-	row[17] = strconv.FormatInt(e.nameMask(), 10)
-	// InternalName
-	row[18] = e.internalName()
 	newEnchantIDs := make([]int32, maxEnchantsForSuffix)
 	newAllocationPcts := make([]int32, maxEnchantsForSuffix)
 	copy(newEnchantIDs, e.EnchantIDs)
 	copy(newAllocationPcts, e.AllocationPcts)
-	// EnchantIDs
-	for i, enchID := range newEnchantIDs {
-		row[i+19] = strconv.FormatInt(int64(enchID), 10)
-	}
-	for i, allocPct := range newAllocationPcts {
-		row[i+24] = strconv.FormatInt(int64(allocPct), 10)
-	}
-	return row, nil
+	return dbc.ItemRandomSuffixRecord{
+		ID:              e.ID,
+		Name_Lang_enUS:  e.displayName(),
+		Name_Lang_Mask:  uint32(e.nameMask()),
+		InternalName:    e.internalName(),
+		Enchantment_1:   newEnchantIDs[0],
+		Enchantment_2:   newEnchantIDs[1],
+		Enchantment_3:   newEnchantIDs[2],
+		Enchantment_4:   newEnchantIDs[3],
+		Enchantment_5:   newEnchantIDs[4],
+		AllocationPct_1: newAllocationPcts[0],
+		AllocationPct_2: newAllocationPcts[1],
+		AllocationPct_3: newAllocationPcts[2],
+		AllocationPct_4: newAllocationPcts[3],
+		AllocationPct_5: newAllocationPcts[4],
+	}, nil
 }
 
 func (e customRandomSuffixEntry) toTmplSQLEntry() tmplItemRandomSuffixEntry {
@@ -117,189 +115,295 @@ func (e customRandomSuffixEntry) toTmplSQLEntry() tmplItemRandomSuffixEntry {
 	}
 }
 
-func generateItemRandomSuffixCSV(schema dbc.DBCSchema, es []customRandomSuffixEntry) ([][]string, error) {
-	var irsDBCCSVHeader []string
-	for fi := range schema.Fields {
-		irsDBCCSVHeader = append(irsDBCCSVHeader, schema.FieldName(fi))
-	}
-	rows := [][]string{irsDBCCSVHeader}
-	for i, e := range es {
-		row, err := e.toDBCCSVEntry(schema)
-		if err != nil {
-			return nil, errors.Wrapf(err, "DBC entry for item random suffix cannot be converted to entry: i=%d", i)
-		}
-		rows = append(rows, row)
-	}
-	return rows, nil
+var customSpellItemEnchantRecords = []dbc.SpellItemEnchantmentRecord{
+	{ID: AExpertise.EnchantID(), Effect_1: 5, EffectArg_1: 37, Name_Lang_enUS: "+$i Expertise Rating", Name_Lang_Mask: 16712190},
+	{ID: AParry.EnchantID(), Effect_1: 5, EffectArg_1: 14, Name_Lang_enUS: "+$i Parry Rating", Name_Lang_Mask: 16712190},
 }
 
-var customSpellItemEnchantDBCCSVEntries = [][]string{
-	{"ID", "Charges", "Effect_1", "Effect_2", "Effect_3", "EffectPointsMin_1", "EffectPointsMin_2", "EffectPointsMin_3", "EffectPointsMax_1", "EffectPointsMax_2", "EffectPointsMax_3", "EffectArg_1", "EffectArg_2", "EffectArg_3", "Name_Lang_enUS", "Name_Lang_enGB", "Name_Lang_koKR", "Name_Lang_frFR", "Name_Lang_deDE", "Name_Lang_enCN", "Name_Lang_zhCN", "Name_Lang_enTW", "Name_Lang_zhTW", "Name_Lang_esES", "Name_Lang_esMX", "Name_Lang_ruRU", "Name_Lang_ptPT", "Name_Lang_ptBR", "Name_Lang_itIT", "Name_Lang_Unk", "Name_Lang_Mask", "ItemVisual", "Flags", "Src_ItemID", "Condition_Id", "RequiredSkillID", "RequiredSkillRank", "MinLevel"},
-	{strconv.FormatInt(int64(AExpertise.EnchantID()), 10), "0", "5", "0", "0", "0", "0", "0", "0", "0", "0", "37", "0", "0", "+$i Expertise Rating", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "16712190", "0", "0", "0", "0", "0", "0", "0"},
-	{strconv.FormatInt(int64(AParry.EnchantID()), 10), "0", "5", "0", "0", "0", "0", "0", "0", "0", "0", "14", "0", "0", "+$i Parry Rating", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "16712190", "0", "0", "0", "0", "0", "0", "0"},
+func customSpellItemEnchantTmplEntries() []tmplSpellItemEnchantmentEntry {
+	var entries []tmplSpellItemEnchantmentEntry
+	for _, e := range customSpellItemEnchantRecords {
+		entries = append(entries, tmplSpellItemEnchantmentEntry{
+			ID: e.ID, Effect_1: e.Effect_1, EffectArg_1: e.EffectArg_1, Name_Lang_enUS: e.Name_Lang_enUS, Name_Lang_Mask: e.Name_Lang_Mask,
+		})
+	}
+	return entries
 }
 
 var latinNumerals = []string{"I", "II", "III", "IV", "V"}
 
-// Generate generates custom suffixes and other DBC changes needed for this random suffix mod.
-// It appends to the itemRandomSuffix and spellItemEnchant DBC passed into this function
-func Generate(p *ProcessedConfig) error {
-	err := p.SrcSpellItemEnchantDBC.AppendFromCSVData(customSpellItemEnchantDBCCSVEntries)
-	if err != nil {
-		return errors.Wrap(err, "unable to append spell item enchant DBC with custom expertise and parry entries")
-	}
-	var irsDBCCSVHeader []string
-	for fi := range p.SrcItemSuffixDBC.Schema.Fields {
-		irsDBCCSVHeader = append(irsDBCCSVHeader, p.SrcItemSuffixDBC.Schema.FieldName(fi))
-	}
-	var suffEntries []customRandomSuffixEntry
-	irsDBCID := p.ItemRandomSuffixDBCCustomStartID
-	seenNames := make(map[string]struct{})
-	for i := 0; i < p.NumberOfAttributes; i++ {
-		combis := generateAttributeCombinations(i+1, allAttributes)
-		for _, combi := range combis {
+// weaponCombination is a valid combination of weapon attributes along with the enchant categories
+// that roll it
+type weaponCombination struct {
+	combi       Attributes
+	enchCatMask uint
+}
+
+// weaponCombinations lists the valid combinations of the weapon attributes of every enchant category of
+// the weapon suffix in the order they are first seen. A combination that more than one category rolls
+// is listed once with all of their masks.
+func weaponCombinations(ws WeaponSuffix, n int) []weaponCombination {
+	var wcs []weaponCombination
+	seenAttrMaskToIdx := make(map[uint]int)
+	for _, ec := range ws.EnchantCategories {
+		combis := newAttributeCombinations(n, ec.WeaponAttributes())
+		for combi, ok := combis.Next(); ok; combi, ok = combis.Next() {
 			if !combi.IsValid() {
 				continue
 			}
-			eIDs := combi.EnchantIDs()
 			attrMask := combi.Mask()
-			name := p.SuffixMaskToNames()[attrMask]
-			seenNames[name] = struct{}{}
-			for k, maxAllocPoint := range p.StatPointAllocTiers {
-				allocPcts := make([]int32, len(eIDs))
-				for i := range allocPcts {
-					allocPcts[i] = int32(maxAllocPoint) / int32(len(eIDs))
-				}
-				suffEntries = append(suffEntries, customRandomSuffixEntry{
-					ID:             irsDBCID,
-					Name:           fmt.Sprintf("%s %s", name, latinNumerals[k]),
-					EnchantIDs:     eIDs,
-					AllocationPcts: allocPcts,
-					AttrMask:       attrMask,
-					EnchantQuality: k,
-				})
-				irsDBCID++
+			// This will still make a lot of duplicates but better to have duplicates so that our queries will be easier
+			if idx, ok := seenAttrMaskToIdx[attrMask]; ok {
+				wcs[idx].enchCatMask |= ec.Mask()
+				continue
 			}
+			seenAttrMaskToIdx[attrMask] = len(wcs)
+			wcs = append(wcs, weaponCombination{combi: combi, enchCatMask: ec.Mask()})
 		}
 	}
-	for n := range p.Suffixes {
-		if _, ok := seenNames[n]; !ok {
-			log.Warn("This name hasnt been seen", "suffix_name", n)
-		}
-	}
+	return wcs
+}
+
+// suffixSegment is the run of suffixes generated from one block of the config, the attribute suffixes or
+// a single weapon suffix. With a generation cache a segment is only generated again when its block
+// changes, see generationCache.
+type suffixSegment struct {
+	key      string
+	name     string
+	hash     string
+	generate func(emit func(e customRandomSuffixEntry) error) error
+}
 
+// suffixSegments lists the segments in the order their IDs are handed out on a fresh generation
+func (p *ProcessedConfig) suffixSegments() []suffixSegment {
+	segments := []suffixSegment{{
+		key:  "attributes",
+		hash: hashConfigSection(p.NumberOfAttributes, p.StatPointAllocTiers, p.Suffixes, p.SuffixWeights),
+		generate: func(emit func(e customRandomSuffixEntry) error) error {
+			seenNames := make(map[string]struct{})
+			err := p.generateAttributeSuffixes(func(e customRandomSuffixEntry) error {
+				seenNames[p.SuffixMaskToNames()[e.AttrMask]] = struct{}{}
+				return emit(e)
+			})
+			for n := range p.Suffixes {
+				if _, ok := seenNames[n]; !ok {
+					log.Warn("This name hasnt been seen", "suffix_name", n)
+				}
+			}
+			return err
+		},
+	}}
 	weaponEnchantIDs := make([]int32, 0, len(p.WeaponSuffixes))
 	for enchID := range p.WeaponSuffixes {
 		weaponEnchantIDs = append(weaponEnchantIDs, enchID)
 	}
 	sort.Slice(weaponEnchantIDs, func(i, j int) bool { return weaponEnchantIDs[i] < weaponEnchantIDs[j] })
 	for _, enchID := range weaponEnchantIDs {
+		enchID := enchID
 		ws, ok := p.WeaponSuffixes[enchID]
 		if !ok {
 			log.Panic("Weapon suffix iteration, enchant ID not found even if weaponSuffixes should have this ID", "enchID", enchID)
 		}
-		// Base
-		enchIDs := []int32{enchID}
-		allocPcts := []int32{1}
-		suffEntries = append(suffEntries, customRandomSuffixEntry{
-			ID:               irsDBCID,
-			Name:             ws.Name,
-			EnchantIDs:       enchIDs,
-			AllocationPcts:   allocPcts,
-			AttrMask:         0, // No additional attributes
-			ItemSubclassMask: ws.ItemSubClasses.Mask(),
-			EnchCatMask:      ws.EnchantCategories.Mask(),
-			EnchantQuality:   0, // lowest enchant quality
-			MinLevel:         ws.MinLevel,
-			MaxLevel:         ws.MaxLevel,
-			ItemClass:        ws.ItemClass,
+		segments = append(segments, suffixSegment{
+			key:  fmt.Sprintf("weapon:%d", enchID),
+			name: ws.Name,
+			hash: hashConfigSection(enchID, ws, p.NumberOfAttributesWeapons, p.StatPointAllocTiers, p.WeaponStatPenalty, p.Suffixes),
+			generate: func(emit func(e customRandomSuffixEntry) error) error {
+				return p.generateWeaponSuffixes(enchID, ws, emit)
+			},
 		})
-		irsDBCID++
-		seenWeaponAttrMaskToSuffEntriesIdx := make(map[uint][]int)
-		for _, ec := range ws.EnchantCategories {
-			for _, combi := range generateAttributeCombinations(p.NumberOfAttributesWeapons, ec.WeaponAttributes()) {
-				if !combi.IsValid() {
-					continue
-				}
-				attrMask := combi.Mask()
-				// This will still make a lot of duplicates but better to have duplicates so that our queries will be easier
-				if suffEntriesIdxs, ok := seenWeaponAttrMaskToSuffEntriesIdx[attrMask]; ok {
-					for _, idx := range suffEntriesIdxs {
-						suffEntries[idx].EnchCatMask |= ec.Mask()
-					}
-					continue
-				}
-				combiEnchIDs := combi.EnchantIDs()
-				for k, maxAllocPoint := range p.StatPointAllocTiers {
-					if k == len(p.StatPointAllocTiers)-1 {
-						// Dont include the last allocation thresholds for weapons.
-						continue
-					}
-					weaponMaxAllocPct := int(math.Ceil(p.WeaponStatPenalty * float64(maxAllocPoint)))
-					combiAllocPcts := make([]int32, len(combiEnchIDs))
-					for i := range combiAllocPcts {
-						combiAllocPcts[i] = int32(weaponMaxAllocPct) / int32(len(combiEnchIDs))
-					}
-					suffEntries = append(suffEntries, customRandomSuffixEntry{
-						ID:               irsDBCID,
-						Name:             fmt.Sprintf("%s - %s %s", ws.Name, p.SuffixMaskToNames()[attrMask], latinNumerals[k]),
-						EnchantIDs:       append(enchIDs, combiEnchIDs...),
-						AllocationPcts:   append(allocPcts, combiAllocPcts...),
-						AttrMask:         attrMask,
-						EnchantQuality:   k,
-						EnchCatMask:      ec.Mask(),
-						ItemSubclassMask: ws.ItemSubClasses.Mask(),
-						MinLevel:         ws.MinLevel,
-						MaxLevel:         ws.MaxLevel,
-						ItemClass:        ws.ItemClass,
-					})
-					seenWeaponAttrMaskToSuffEntriesIdx[attrMask] = append(seenWeaponAttrMaskToSuffEntriesIdx[attrMask], len(suffEntries)-1)
-					irsDBCID++
-				}
-			}
-		}
 	}
+	return segments
+}
 
-	itemRandomSuffixRows, err := generateItemRandomSuffixCSV(p.SrcItemSuffixDBC.Schema, suffEntries)
+// generateWeaponSuffixes makes the base suffix of a weapon suffix followed by one suffix per combination
+// of its weapon attributes and allocation tier
+func (p *ProcessedConfig) generateWeaponSuffixes(enchID int32, ws WeaponSuffix, emit func(e customRandomSuffixEntry) error) error {
+	// Base
+	enchIDs := []int32{enchID}
+	allocPcts := []int32{1}
+	err := emit(customRandomSuffixEntry{
+		Name:             ws.Name,
+		EnchantIDs:       enchIDs,
+		AllocationPcts:   allocPcts,
+		AttrMask:         0, // No additional attributes
+		ItemSubclassMask: ws.ItemSubClasses.Mask(),
+		EnchCatMask:      ws.EnchantCategories.Mask(),
+		EnchantQuality:   0, // lowest enchant quality
+		MinLevel:         ws.MinLevel,
+		MaxLevel:         ws.MaxLevel,
+		ItemClass:        ws.ItemClass,
+		Weight:           ws.weight(),
+	})
 	if err != nil {
-		return errors.Wrap(err, "Error generate item random suffix DBC CSV entries")
+		return err
 	}
-	err = p.SrcItemSuffixDBC.AppendFromCSVData(itemRandomSuffixRows)
-	if err != nil {
-		return errors.Wrap(err, "Error appending to item random suffix DBC")
+	for _, wc := range weaponCombinations(ws, p.NumberOfAttributesWeapons) {
+		attrMask := wc.combi.Mask()
+		combiEnchIDs := wc.combi.EnchantIDs()
+		for k, maxAllocPoint := range p.StatPointAllocTiers {
+			if k == len(p.StatPointAllocTiers)-1 {
+				// Dont include the last allocation thresholds for weapons.
+				continue
+			}
+			weaponMaxAllocPct := int(math.Ceil(p.WeaponStatPenalty * float64(maxAllocPoint)))
+			combiAllocPcts := make([]int32, len(combiEnchIDs))
+			for i := range combiAllocPcts {
+				combiAllocPcts[i] = int32(weaponMaxAllocPct) / int32(len(combiEnchIDs))
+			}
+			err = emit(customRandomSuffixEntry{
+				Name:             fmt.Sprintf("%s - %s %s", ws.Name, p.SuffixMaskToNames()[attrMask], latinNumerals[k]),
+				EnchantIDs:       append(enchIDs, combiEnchIDs...),
+				AllocationPcts:   append(allocPcts, combiAllocPcts...),
+				AttrMask:         attrMask,
+				EnchantQuality:   k,
+				EnchCatMask:      wc.enchCatMask,
+				ItemSubclassMask: ws.ItemSubClasses.Mask(),
+				MinLevel:         ws.MinLevel,
+				MaxLevel:         ws.MaxLevel,
+				ItemClass:        ws.ItemClass,
+				Weight:           ws.weight(),
+			})
+			if err != nil {
+				return err
+			}
+		}
+	}
+	return nil
+}
+
+// Generate generates custom suffixes and other DBC changes needed for this random suffix mod.
+// The suffixes are numbered and streamed into the SQL and the ItemRandomSuffix DBC as they are
+// generated, after the records of the source DBC. With a generation cache, outputs that are up to date
+// are left alone and only the segments whose config changed are generated again.
+func Generate(p *ProcessedConfig) (err error) {
+	if !p.outputUpToDate(outputSpellItemEnchantDBC) {
+		p.SrcSpellItemEnchantDBC.Append(customSpellItemEnchantRecords...)
+		err = p.SrcSpellItemEnchantDBC.ExportCompact(p.DstExportedGeneratedSpellItemEnchantDBC)
+		if err != nil {
+			return err
+		}
 	}
-	if irsDBCID > math.MaxInt16 {
-		return errors.Wrapf(ErrExceededItemRandomSuffixMaxAmount, "last ID was: %d", irsDBCID)
+	writeSQL := !p.outputUpToDate(outputWorldSQL)
+	writeDBC := !p.outputUpToDate(outputItemSuffixDBC)
+	if !writeSQL && !writeDBC {
+		log.Info("generated suffixes are up to date")
+		return p.saveGenerationCache(nil, 0)
 	}
 
-	var tmplSpellItemEnchEntries []tmplSpellItemEnchantmentEntry
-	for _, e := range customSpellItemEnchantDBCCSVEntries[1:] {
-		tmplSpellItemEnchEntries = append(tmplSpellItemEnchEntries, tmplSpellItemEnchantmentEntry{
-			ID: e[0], Effect_1: e[2], EffectArg_1: e[11], Name_Lang_enUS: e[14], Name_Lang_Mask: e[30],
-		})
+	var sqlw *generatedSQLWriter
+	if writeSQL {
+		if sqlw, err = newGeneratedSQLWriter(p); err != nil {
+			return err
+		}
+		defer sqlw.remove()
 	}
-	var tmplRanSuffEntries []tmplItemRandomSuffixEntry
-	for _, e := range suffEntries {
-		tmplRanSuffEntries = append(tmplRanSuffEntries, e.toTmplSQLEntry())
+	var irsw *dbc.TableWriter[dbc.ItemRandomSuffixRecord]
+	if writeDBC {
+		if irsw, err = dbc.NewTableWriter(p.DstExportedGeneratedItemSuffixDBC, p.SrcItemSuffixDBC); err != nil {
+			return err
+		}
+		defer func() {
+			if err != nil {
+				irsw.Close()
+			}
+		}()
 	}
-	sqlData := tmplData{
-		CustomItemRandomSuffixStartID:     p.ItemRandomSuffixDBCCustomStartID,
-		CustomItemRandomSuffixEndID:       irsDBCID,
-		CustomItemRandomSuffixEntries:     tmplRanSuffEntries,
-		CustomSpellItemEnchantmentEntries: tmplSpellItemEnchEntries,
-		ItemEnchantmentRandomSuffixes:     suffEntries,
+	var compactor *suffixCompactor
+	if p.CompactSuffixes {
+		compactor = newSuffixCompactor(p.itemReachability)
 	}
-	err = generatedSQLTemplate.Execute(p.DstGeneratedWorldSQL, &sqlData)
-	if err != nil {
-		return err
+	emit := func(e customRandomSuffixEntry) error {
+		if e.ID >= math.MaxInt16 {
+			return errors.Wrapf(ErrExceededItemRandomSuffixMaxAmount, "last ID was: %d", e.ID+1)
+		}
+		keepSuffix, keepRow := true, true
+		if compactor != nil {
+			keepSuffix, keepRow = compactor.compact(&e)
+		}
+		if irsw != nil && keepSuffix {
+			record, err := e.toDBCRecord()
+			if err != nil {
+				return errors.Wrapf(err, "DBC entry for item random suffix cannot be converted to entry: id=%d", e.ID)
+			}
+			if err = irsw.Write(record); err != nil {
+				return err
+			}
+		}
+		switch {
+		case sqlw == nil:
+		case keepSuffix:
+			return sqlw.write(e)
+		case keepRow:
+			return sqlw.writeRow(e)
+		}
+		return nil
 	}
-	err = p.SrcItemSuffixDBC.Export(p.DstExportedGeneratedItemSuffixDBC)
-	if err != nil {
-		return err
+
+	segments := p.suffixSegments()
+	var layout []cachedSegment
+	irsDBCID := p.ItemRandomSuffixDBCCustomStartID
+	if p.cachePath == "" {
+		// Without a cache nothing has to be kept, the suffixes are numbered and streamed as they come
+		for _, seg := range segments {
+			err = seg.generate(func(e customRandomSuffixEntry) error {
+				e.ID = irsDBCID
+				irsDBCID++
+				return emit(e)
+			})
+			if err != nil {
+				return errors.Wrap(err, "Error generate item random suffix DBC entries")
+			}
+		}
+	} else {
+		if layout, irsDBCID, err = p.layoutSegments(segments); err != nil {
+			return errors.Wrap(err, "Error generate item random suffix DBC entries")
+		}
+		var entries []customRandomSuffixEntry
+		for _, seg := range layout {
+			entries = append(entries, seg.Entries...)
+		}
+		sort.Slice(entries, func(i, j int) bool { return entries[i].ID < entries[j].ID })
+		for _, e := range entries {
+			if err = emit(e); err != nil {
+				return errors.Wrap(err, "Error generate item random suffix DBC entries")
+			}
+		}
 	}
-	err = p.SrcSpellItemEnchantDBC.Export(p.DstExportedGeneratedSpellItemEnchantDBC)
-	if err != nil {
-		return err
+
+	if sqlw != nil {
+		err = sqlw.Close(tmplData{
+			CustomItemRandomSuffixStartID:     p.ItemRandomSuffixDBCCustomStartID,
+			CustomItemRandomSuffixEndID:       irsDBCID,
+			CustomSpellItemEnchantmentEntries: customSpellItemEnchantTmplEntries(),
+			Compacted:                         compactor != nil,
+		})
+		if err != nil {
+			return err
+		}
+		if compactor != nil {
+			if err = writeSuffixRemap(p.DstGeneratedSuffixRemap, compactor.remap); err != nil {
+				return err
+			}
+		}
 	}
-	return nil
+	if irsw != nil {
+		if err = irsw.Close(); err != nil {
+			return err
+		}
+	}
+	if compactor != nil {
+		if irsw != nil {
+			var sourceMaxID int32
+			for _, r := range p.SrcItemSuffixDBC.Records {
+				if r.ID > sourceMaxID {
+					sourceMaxID = r.ID
+				}
+			}
+			compactor.report(irsw.Size(), irsw.RecordSize(), len(p.SrcItemSuffixDBC.Records), sourceMaxID)
+		} else {
+			compactor.report(0, 0, 0, 0)
+		}
+	}
+	return p.saveGenerationCache(layout, irsDBCID)
 }
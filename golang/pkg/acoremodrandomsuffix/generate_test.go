@@ -0,0 +1,161 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/lohvht/mod-random-suffix/golang/pkg/dbc"
+)
+
+const (
+	benchConfigPath = "../../../generatesuffixes.conf.yaml"
+	benchDBCDir     = "../../../patch-Z.MPQ/DBFilesClient"
+	benchSchemaDir  = "../../data/3.3.5.12340/schemas"
+	// The shipped DBCs are the sources, custom suffixes start after their highest ID
+	benchCustomStartID = 10000
+)
+
+// benchConfigSize is a config size to benchmark at, the shipped config is 3 attributes and 1 weapon attribute
+type benchConfigSize struct {
+	attrs       int
+	weaponAttrs int
+}
+
+var benchConfigSizes = []benchConfigSize{{2, 1}, {3, 1}, {4, 1}, {5, 1}}
+
+func (s benchConfigSize) String() string {
+	return fmt.Sprintf("attrs=%d/weapon-attrs=%d", s.attrs, s.weaponAttrs)
+}
+
+// benchConfig is the shipped config at the given size, generating into dir
+func benchConfig(b *testing.B, size benchConfigSize, dir string) *Config {
+	f, err := os.Open(benchConfigPath)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer f.Close()
+	var c Config
+	if err = c.decode(f); err != nil {
+		b.Fatal(err)
+	}
+	c.SrcItemSuffixDBC = filepath.Join(benchDBCDir, "ItemRandomSuffix.dbc")
+	c.SrcItemSuffixSchema = filepath.Join(benchSchemaDir, "ItemRandomSuffix.dbc.json")
+	c.SrcSpellItemEnchantDBC = filepath.Join(benchDBCDir, "SpellItemEnchantment.dbc")
+	c.SrcSpellItemEnchantSchema = filepath.Join(benchSchemaDir, "SpellItemEnchantment.dbc.json")
+	c.DstGeneratedWorldSQL = filepath.Join(dir, "mod_acore_random_suffix.sql")
+	c.DstGeneratedItemSuffixDBC = filepath.Join(dir, "ItemRandomSuffix.dbc")
+	c.DstGeneratedSpellItemEnchantDBC = filepath.Join(dir, "SpellItemEnchantment.dbc")
+	c.ItemRandomSuffixDBCCustomStartID = benchCustomStartID
+	c.NumberOfAttributes = size.attrs
+	c.NumberOfAttributesWeapons = size.weaponAttrs
+	return &c
+}
+
+// generateBenchConfig generates the config once, returning the directory of the outputs
+func generateBenchConfig(b *testing.B, size benchConfigSize) string {
+	dir := b.TempDir()
+	p, err := benchConfig(b, size, dir).Process()
+	if err != nil {
+		b.Fatal(err)
+	}
+	if err = Generate(p); err != nil {
+		b.Fatal(err)
+	}
+	return dir
+}
+
+// BenchmarkGenerate generates the shipped config at several sizes, reading the sources and writing the
+// outputs included
+func BenchmarkGenerate(b *testing.B) {
+	for _, size := range benchConfigSizes {
+		b.Run(size.String(), func(b *testing.B) {
+			dir := b.TempDir()
+			c := benchConfig(b, size, dir)
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				cfg := *c
+				p, err := cfg.Process()
+				if err != nil {
+					b.Fatal(err)
+				}
+				if err = Generate(p); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.StopTimer()
+			fi, err := os.Stat(c.DstGeneratedWorldSQL)
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.ReportMetric(float64(fi.Size()), "sql-bytes")
+		})
+	}
+}
+
+func BenchmarkGenerateAttributeCombinations(b *testing.B) {
+	for n := 1; n <= 5; n++ {
+		b.Run(fmt.Sprintf("n=%d", n), func(b *testing.B) {
+			b.ReportAllocs()
+			var combis []Attributes
+			for i := 0; i < b.N; i++ {
+				combis = generateAttributeCombinations(n, allAttributes)
+			}
+			b.ReportMetric(float64(len(combis)), "combinations")
+		})
+	}
+}
+
+func BenchmarkAttributesIsValid(b *testing.B) {
+	for n := 1; n <= 5; n++ {
+		combis := generateAttributeCombinations(n, allAttributes)
+		b.Run(fmt.Sprintf("n=%d", n), func(b *testing.B) {
+			b.ReportAllocs()
+			valid := 0
+			for i := 0; i < b.N; i++ {
+				if combis[i%len(combis)].IsValid() {
+					valid++
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkDBCExport exports the ItemRandomSuffix DBC generated at several config sizes
+func BenchmarkDBCExport(b *testing.B) {
+	for _, size := range benchConfigSizes {
+		dir := generateBenchConfig(b, size)
+		d, err := dbc.NewDBCFromFile(filepath.Join(dir, "ItemRandomSuffix.dbc"), filepath.Join(benchSchemaDir, "ItemRandomSuffix.dbc.json"))
+		if err != nil {
+			b.Fatal(err)
+		}
+		b.Run(size.String(), func(b *testing.B) {
+			f, err := os.Create(filepath.Join(b.TempDir(), "export.dbc"))
+			if err != nil {
+				b.Fatal(err)
+			}
+			defer f.Close()
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err = f.Seek(0, io.SeekStart); err != nil {
+					b.Fatal(err)
+				}
+				if err = f.Truncate(0); err != nil {
+					b.Fatal(err)
+				}
+				if err = d.Export(f); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.StopTimer()
+			b.ReportMetric(float64(len(d.Data)), "records")
+		})
+	}
+}
@@ -1,21 +1,16 @@
--- Delete custom item enchant IDs first
+{{/* The sections are rendered one at a time, rows of the suffix tables are streamed in between them. Rows are
+   VALUES tuples for the insert format and tab separated lines for the load-data format. */ -}}
+{{define "spellItemEnchantmentsDelete" -}}
 DELETE FROM spellitemenchantment_dbc WHERE ID IN ({{range $i, $e := .CustomSpellItemEnchantmentEntries -}}{{$e.ID}}{{if not (last $i $.CustomSpellItemEnchantmentEntries)}},{{end}}{{end }});
-INSERT INTO spellitemenchantment_dbc (ID,Effect_1,EffectArg_1,Name_Lang_enUS,Name_Lang_Mask)
-VALUES
-{{range $i, $e := .CustomSpellItemEnchantmentEntries -}}
-({{$e.ID}},{{$e.Effect_1}},{{$e.EffectArg_1}},'{{$e.Name_Lang_enUS}}',{{$e.Name_Lang_Mask}}){{if last $i $.CustomSpellItemEnchantmentEntries}};{{else}},{{end}}
-{{end }}
-
--- Delete the custom random suffixes first
+{{- end}}
+{{define "itemRandomSuffixesDelete" -}}
 DELETE FROM itemrandomsuffix_dbc where ID >= {{.CustomItemRandomSuffixStartID}} AND ID <= {{.CustomItemRandomSuffixEndID}};
+{{- end}}
+{{define "itemRandomSuffixesInsert" -}}
 INSERT INTO itemrandomsuffix_dbc (ID,Name_Lang_enUS,Name_Lang_Mask,InternalName,Enchantment_1,Enchantment_2,Enchantment_3,Enchantment_4,Enchantment_5,AllocationPct_1,AllocationPct_2,AllocationPct_3,AllocationPct_4,AllocationPct_5)
 VALUES
-{{range $i, $e := .CustomItemRandomSuffixEntries -}}
-({{$e.ID}},'{{$e.Name_Lang_enUS}}',{{$e.Name_Lang_Mask}},'{{$e.InternalName}}',{{$e.Enchantment_1}},{{$e.Enchantment_2}},{{$e.Enchantment_3}},{{$e.Enchantment_4}},{{$e.Enchantment_5}},{{$e.AllocationPct_1}},{{$e.AllocationPct_2}},{{$e.AllocationPct_3}},{{$e.AllocationPct_4}},{{$e.AllocationPct_5}}){{if last $i $.CustomItemRandomSuffixEntries}};{{else}},{{end}}
-{{end }}
-
--- Add in new enchants
-DROP TABLE IF EXISTS `item_enchantment_random_suffixes`;
+{{end}}
+{{define "itemEnchantmentRandomSuffixesTable" -}}
 CREATE TABLE `item_enchantment_random_suffixes` (
   `SuffixID` int NOT NULL DEFAULT '0',
   `MinLevel` int DEFAULT '0',
@@ -25,10 +20,97 @@ CREATE TABLE `item_enchantment_random_suffixes` (
   `ItemSubClassMask` int unsigned DEFAULT '0',
   `EnchantQuality` int unsigned DEFAULT '0',
   `EnchantCategoryMask` int unsigned DEFAULT '0',
-  PRIMARY KEY (`SuffixID`)
+  `Weight` int unsigned DEFAULT '1',
+  {{if .Compacted}}KEY (`SuffixID`){{else}}PRIMARY KEY (`SuffixID`){{end}}
 ) ENGINE=MyISAM DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_0900_ai_ci;
-INSERT INTO item_enchantment_random_suffixes (SuffixID,MinLevel,MaxLevel,AttributeMask,ItemClass,ItemSubClassMask,EnchantQuality,EnchantCategoryMask)
+{{end}}
+{{define "itemEnchantmentRandomSuffixesInsert" -}}
+INSERT INTO item_enchantment_random_suffixes (SuffixID,MinLevel,MaxLevel,AttributeMask,ItemClass,ItemSubClassMask,EnchantQuality,EnchantCategoryMask,Weight)
+VALUES
+{{end}}
+
+{{- /* insert format */ -}}
+{{define "spellItemEnchantments" -}}
+-- Delete custom item enchant IDs first
+{{template "spellItemEnchantmentsDelete" .}}
+INSERT INTO spellitemenchantment_dbc (ID,Effect_1,EffectArg_1,Name_Lang_enUS,Name_Lang_Mask)
+VALUES
+{{range $i, $e := .CustomSpellItemEnchantmentEntries -}}
+({{$e.ID}},{{$e.Effect_1}},{{$e.EffectArg_1}},'{{$e.Name_Lang_enUS}}',{{$e.Name_Lang_Mask}}){{if last $i $.CustomSpellItemEnchantmentEntries}};{{else}},{{end}}
+{{end -}}
+{{end}}
+{{define "itemRandomSuffixesHeader"}}
+
+-- Delete the custom random suffixes first
+{{template "itemRandomSuffixesDelete" .}}
+{{template "itemRandomSuffixesInsert"}}{{end}}
+{{define "itemRandomSuffixRow"}}({{.ID}},'{{.Name_Lang_enUS}}',{{.Name_Lang_Mask}},'{{.InternalName}}',{{.Enchantment_1}},{{.Enchantment_2}},{{.Enchantment_3}},{{.Enchantment_4}},{{.Enchantment_5}},{{.AllocationPct_1}},{{.AllocationPct_2}},{{.AllocationPct_3}},{{.AllocationPct_4}},{{.AllocationPct_5}}){{end}}
+{{define "itemEnchantmentRandomSuffixesHeader"}}
+
+-- Add in new enchants
+DROP TABLE IF EXISTS `item_enchantment_random_suffixes`;
+{{template "itemEnchantmentRandomSuffixesTable" .}}
+{{- if .BatchRows}}ALTER TABLE `item_enchantment_random_suffixes` DISABLE KEYS;
+{{end}}
+{{- template "itemEnchantmentRandomSuffixesInsert"}}{{end}}
+{{define "itemEnchantmentRandomSuffixRow"}}({{.ID}},{{.MinLevel}},{{.MaxLevel}},{{.AttrMask}},{{.ItemClass}},{{.ItemSubclassMask}},{{.EnchantQuality}},{{.EnchCatMask}},{{.Weight}}){{end}}
+{{define "footer"}}
+{{- if .BatchRows}}ALTER TABLE `item_enchantment_random_suffixes` ENABLE KEYS;
+{{end}}
+{{end}}
+
+{{- /* compaction */ -}}
+{{define "suffixRemap" -}}
+-- Suffix IDs taken out by the last compaction of generatesuffixes. NewSuffixID is the suffix it was merged into,
+-- or 0 if no item could roll it and it was pruned. Load this into the characters database, then remap the
+-- suffixes already on items with:
+--   UPDATE item_instance INNER JOIN item_random_suffix_remap ON item_instance.randomPropertyId = -item_random_suffix_remap.OldSuffixID
+--   SET item_instance.randomPropertyId = -item_random_suffix_remap.NewSuffixID;
+DROP TABLE IF EXISTS `item_random_suffix_remap`;
+CREATE TABLE `item_random_suffix_remap` (
+  `OldSuffixID` int NOT NULL,
+  `NewSuffixID` int NOT NULL,
+  PRIMARY KEY (`OldSuffixID`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_0900_ai_ci;
+{{if .}}
+INSERT INTO item_random_suffix_remap (OldSuffixID,NewSuffixID)
 VALUES
-{{range $i, $e := .ItemEnchantmentRandomSuffixes -}}
-({{$e.ID}},{{$e.MinLevel}},{{$e.MaxLevel}},{{$e.AttrMask}},{{$e.ItemClass}},{{$e.ItemSubclassMask}},{{$e.EnchantQuality}},{{$e.EnchCatMask}}){{if last $i $.CustomItemRandomSuffixEntries}};{{else}},{{end}}
-{{end }}
+{{range $i, $r := . -}}
+({{$r.OldID}},{{$r.NewID}}){{if last $i $}};{{else}},{{end}}
+{{end -}}
+{{end -}}
+{{end}}
+
+{{- /* load-data format */ -}}
+{{define "spellItemEnchantmentRowTSV"}}{{.ID}}	{{.Effect_1}}	{{.EffectArg_1}}	{{tsv .Name_Lang_enUS}}	{{.Name_Lang_Mask}}{{end}}
+{{define "itemRandomSuffixRowTSV"}}{{.ID}}	{{tsv .Name_Lang_enUS}}	{{.Name_Lang_Mask}}	{{tsv .InternalName}}	{{.Enchantment_1}}	{{.Enchantment_2}}	{{.Enchantment_3}}	{{.Enchantment_4}}	{{.Enchantment_5}}	{{.AllocationPct_1}}	{{.AllocationPct_2}}	{{.AllocationPct_3}}	{{.AllocationPct_4}}	{{.AllocationPct_5}}{{end}}
+{{define "itemEnchantmentRandomSuffixRowTSV"}}{{.ID}}	{{.MinLevel}}	{{.MaxLevel}}	{{.AttrMask}}	{{.ItemClass}}	{{.ItemSubclassMask}}	{{.EnchantQuality}}	{{.EnchCatMask}}	{{.Weight}}{{end}}
+{{define "loadData" -}}
+-- Loads the tab separated files written by generatesuffixes. LOAD DATA LOCAL INFILE has to be allowed on both
+-- ends (local_infile=1 on the server, --local-infile=1 for the mysql client) and relative paths are read from
+-- the directory the mysql client runs in. Generate with world-sql-format: insert where that is not possible.
+SET @old_unique_checks = @@unique_checks;
+SET unique_checks = 0;
+
+-- Delete custom item enchant IDs first
+{{template "spellItemEnchantmentsDelete" .}}
+LOAD DATA LOCAL INFILE '{{.SpellItemEnchantmentTSV}}' INTO TABLE spellitemenchantment_dbc
+CHARACTER SET utf8mb4 FIELDS TERMINATED BY '\t' LINES TERMINATED BY '\n'
+(ID,Effect_1,EffectArg_1,Name_Lang_enUS,Name_Lang_Mask);
+
+-- Delete the custom random suffixes first
+{{template "itemRandomSuffixesDelete" .}}
+LOAD DATA LOCAL INFILE '{{.ItemRandomSuffixTSV}}' INTO TABLE itemrandomsuffix_dbc
+CHARACTER SET utf8mb4 FIELDS TERMINATED BY '\t' LINES TERMINATED BY '\n'
+(ID,Name_Lang_enUS,Name_Lang_Mask,InternalName,Enchantment_1,Enchantment_2,Enchantment_3,Enchantment_4,Enchantment_5,AllocationPct_1,AllocationPct_2,AllocationPct_3,AllocationPct_4,AllocationPct_5);
+
+-- Add in new enchants
+DROP TABLE IF EXISTS `item_enchantment_random_suffixes`;
+{{template "itemEnchantmentRandomSuffixesTable" .}}ALTER TABLE `item_enchantment_random_suffixes` DISABLE KEYS;
+LOAD DATA LOCAL INFILE '{{.ItemEnchantmentRandomSuffixesTSV}}' INTO TABLE item_enchantment_random_suffixes
+CHARACTER SET utf8mb4 FIELDS TERMINATED BY '\t' LINES TERMINATED BY '\n'
+(SuffixID,MinLevel,MaxLevel,AttributeMask,ItemClass,ItemSubClassMask,EnchantQuality,EnchantCategoryMask,Weight);
+ALTER TABLE `item_enchantment_random_suffixes` ENABLE KEYS;
+
+SET unique_checks = @old_unique_checks;
+{{end}}
@@ -7,6 +7,7 @@ package acoremodrandomsuffix
 import (
 	_ "embed"
 	"reflect"
+	"strings"
 	"text/template"
 
 	"github.com/lohvht/logi"
@@ -17,10 +18,14 @@ var log iface.Logger = logi.Get().Named("acoremodrandomsuffix")
 
 var allAttributes Attributes
 
+var tsvEscaper = strings.NewReplacer("\\", "\\\\", "\t", "\\t", "\n", "\\n", "\x00", "\\0")
+
 var tmplFns = template.FuncMap{
 	"last": func(x int, a interface{}) bool {
 		return x == reflect.ValueOf(a).Len()-1
 	},
+	// tsv escapes a string the way LOAD DATA reads it back with its default ESCAPED BY '\\'
+	"tsv": tsvEscaper.Replace,
 }
 
 //go:embed generated_sql.tmpl.sql
@@ -46,19 +51,26 @@ type tmplItemRandomSuffixEntry struct {
 }
 
 type tmplSpellItemEnchantmentEntry struct {
-	ID             string
-	Effect_1       string
-	EffectArg_1    string
+	ID             int32
+	Effect_1       int32
+	EffectArg_1    int32
 	Name_Lang_enUS string
-	Name_Lang_Mask string
+	Name_Lang_Mask uint32
 }
 
 type tmplData struct {
 	CustomItemRandomSuffixStartID     int32
 	CustomItemRandomSuffixEndID       int32
 	CustomSpellItemEnchantmentEntries []tmplSpellItemEnchantmentEntry
-	CustomItemRandomSuffixEntries     []tmplItemRandomSuffixEntry
-	ItemEnchantmentRandomSuffixes     []customRandomSuffixEntry
+	// BatchRows is the number of rows per INSERT of the insert format, 0 for a single INSERT per table
+	BatchRows int
+	// Paths of the tab separated files of the load-data format
+	SpellItemEnchantmentTSV          string
+	ItemRandomSuffixTSV              string
+	ItemEnchantmentRandomSuffixesTSV string
+	// Compacted is set when suffixes may have been merged, a suffix can then have more than one row in
+	// item_enchantment_random_suffixes
+	Compacted bool
 }
 
 func init() {
@@ -0,0 +1,118 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"fmt"
+	"runtime"
+)
+
+// combinationChunkSize is the number of attribute combinations a worker takes at a time
+const combinationChunkSize = 256
+
+// combinationChunk is a run of consecutive combinations, filled in with their suffixes by a worker
+type combinationChunk struct {
+	combis  []Attributes
+	entries []customRandomSuffixEntry
+	done    chan struct{}
+}
+
+// attributeSuffixEntries makes the suffixes of a chunk of combinations, without IDs. It only reads the
+// config so any number of workers can run it at once.
+func (p *ProcessedConfig) attributeSuffixEntries(combis []Attributes) []customRandomSuffixEntry {
+	var entries []customRandomSuffixEntry
+	for _, combi := range combis {
+		if !combi.IsValid() {
+			continue
+		}
+		eIDs := combi.EnchantIDs()
+		attrMask := combi.Mask()
+		name := p.SuffixMaskToNames()[attrMask]
+		weight := p.suffixWeight(name)
+		for k, maxAllocPoint := range p.StatPointAllocTiers {
+			allocPcts := make([]int32, len(eIDs))
+			for i := range allocPcts {
+				allocPcts[i] = int32(maxAllocPoint) / int32(len(eIDs))
+			}
+			entries = append(entries, customRandomSuffixEntry{
+				Name:           fmt.Sprintf("%s %s", name, latinNumerals[k]),
+				EnchantIDs:     eIDs,
+				AllocationPcts: allocPcts,
+				AttrMask:       attrMask,
+				EnchantQuality: k,
+				Weight:         weight,
+			})
+		}
+	}
+	return entries
+}
+
+// generateAttributeSuffixes makes the suffixes of every combination of 1 up to NumberOfAttributes
+// attributes and hands them to emit in combination order. Combinations are enumerated lazily and split
+// into chunks over one worker per core, chunks are handed to emit in the order they were enumerated so
+// the caller can number the suffixes as they come. Only a few chunks per worker are in flight at once,
+// however many combinations there are.
+func (p *ProcessedConfig) generateAttributeSuffixes(emit func(e customRandomSuffixEntry) error) error {
+	// Built before the workers start, they only read it
+	p.SuffixMaskToNames()
+	workers := runtime.GOMAXPROCS(0)
+	jobs := make(chan *combinationChunk)
+	ordered := make(chan *combinationChunk, 2*workers)
+	quit := make(chan struct{})
+	for w := 0; w < workers; w++ {
+		go func() {
+			for c := range jobs {
+				c.entries = p.attributeSuffixEntries(c.combis)
+				close(c.done)
+			}
+		}()
+	}
+	go func() {
+		defer close(ordered)
+		defer close(jobs)
+		for i := 0; i < p.NumberOfAttributes; i++ {
+			combis := newAttributeCombinations(i+1, allAttributes)
+			for more := true; more; {
+				c := &combinationChunk{done: make(chan struct{})}
+				for len(c.combis) < combinationChunkSize {
+					var combi Attributes
+					if combi, more = combis.Next(); !more {
+						break
+					}
+					c.combis = append(c.combis, combi)
+				}
+				if len(c.combis) == 0 {
+					break
+				}
+				// A chunk is queued for the collector only once a worker has it, so every queued
+				// chunk is sure to be done eventually
+				select {
+				case jobs <- c:
+				case <-quit:
+					return
+				}
+				select {
+				case ordered <- c:
+				case <-quit:
+					return
+				}
+			}
+		}
+	}()
+	var err error
+	for c := range ordered {
+		<-c.done
+		if err != nil {
+			continue
+		}
+		for _, e := range c.entries {
+			if err = emit(e); err != nil {
+				close(quit)
+				break
+			}
+		}
+	}
+	return err
+}
@@ -0,0 +1,183 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"fmt"
+	"io"
+	"math"
+	"text/tabwriter"
+
+	"github.com/lohvht/mod-random-suffix/golang/pkg/dbc"
+	"github.com/pkg/errors"
+)
+
+// suffixCatalogEntrySize is the server memory of a RandomSuffixCatalogEntry of the module, it keeps one per
+// row of item_enchantment_random_suffixes
+const suffixCatalogEntrySize = 40
+
+// PlanSection is what one section of a config adds to the generated outputs
+type PlanSection struct {
+	Name        string
+	Description string
+	Rows        int
+	FirstID     int32
+	LastID      int32
+	// DBCBytes are the bytes of the records and strings in the ItemRandomSuffix DBC
+	DBCBytes int64
+	// SQLBytes are the bytes of the world SQL, along with the tab separated files of the load-data format
+	SQLBytes int64
+	// MemoryBytes is an estimate of the worldserver memory for the rows in sItemRandomSuffixStore and the
+	// suffix catalog of the module
+	MemoryBytes int64
+}
+
+// Plan is the size of everything a config generates
+type Plan struct {
+	Sections []PlanSection
+	Total    PlanSection
+}
+
+// PlanFromReader works out the plan of the suffix generation config from a reader
+func (c *Config) PlanFromReader(cfgfile io.Reader) (*Plan, error) {
+	if err := c.decode(cfgfile); err != nil {
+		return nil, err
+	}
+	return c.Plan()
+}
+
+// Plan works out the exact rows and bytes that each section of a decoded config generates, without writing any
+// of the outputs. The suffixes are numbered as on a generation without generate-cache and compaction.
+func (c *Config) Plan() (*Plan, error) {
+	if err := c.validate(); err != nil {
+		return nil, err
+	}
+	p := c.newProcessedConfig()
+	p.SuffixMaskToNames()
+	src, err := dbc.ReadTableFromFile[dbc.ItemRandomSuffixRecord](c.SrcItemSuffixDBC)
+	if err == nil {
+		err = src.CheckSchemaFile(c.SrcItemSuffixSchema)
+	}
+	if err != nil {
+		return nil, errors.Wrapf(err, "Error open source ItemSuffix DBC - dbcpath '%s', schemapath '%s'", c.SrcItemSuffixDBC, c.SrcItemSuffixSchema)
+	}
+	irsw, err := dbc.NewTableWriter(&discardWriteSeeker{}, src)
+	if err != nil {
+		return nil, err
+	}
+	defer irsw.Close()
+	sqlw := newCountedSQLWriter(p)
+	recordSize := int64(irsw.RecordSize())
+
+	plan := &Plan{}
+	source := PlanSection{Name: "source", Description: "ItemRandomSuffix DBC", Rows: len(src.Records), DBCBytes: irsw.Size()}
+	for i, r := range src.Records {
+		if i == 0 || r.ID < source.FirstID {
+			source.FirstID = r.ID
+		}
+		if r.ID > source.LastID {
+			source.LastID = r.ID
+		}
+	}
+	sourceStrs := source.DBCBytes - dbcHeaderSize - int64(source.Rows)*recordSize
+	source.MemoryBytes = int64(source.Rows)*suffixStoreRecordSize + sourceStrs
+	plan.Sections = append(plan.Sections, source)
+
+	id := p.ItemRandomSuffixDBCCustomStartID
+	for _, seg := range p.suffixSegments() {
+		s := PlanSection{Name: seg.key, Description: seg.name, FirstID: id}
+		dbcBytes, sqlBytes := irsw.Size(), sqlw.rowsSize()
+		err = seg.generate(func(e customRandomSuffixEntry) error {
+			e.ID = id
+			id++
+			s.Rows++
+			record, err := e.toDBCRecord()
+			if err != nil {
+				return errors.Wrapf(err, "DBC entry for item random suffix cannot be converted to entry: id=%d", e.ID)
+			}
+			if err = irsw.Write(record); err != nil {
+				return err
+			}
+			return sqlw.write(e)
+		})
+		if err != nil {
+			return nil, errors.Wrapf(err, "cannot plan %s", seg.key)
+		}
+		s.LastID = id - 1
+		s.DBCBytes = irsw.Size() - dbcBytes
+		s.SQLBytes = sqlw.rowsSize() - sqlBytes
+		strs := s.DBCBytes - int64(s.Rows)*recordSize
+		s.MemoryBytes = int64(s.Rows)*(suffixStoreIndexSize+suffixStoreRecordSize+suffixCatalogEntrySize) + strs
+		plan.Sections = append(plan.Sections, s)
+	}
+
+	statementBytes, err := sqlw.statementsSize(tmplData{
+		CustomItemRandomSuffixStartID:     p.ItemRandomSuffixDBCCustomStartID,
+		CustomItemRandomSuffixEndID:       id,
+		CustomSpellItemEnchantmentEntries: customSpellItemEnchantTmplEntries(),
+	})
+	if err != nil {
+		return nil, err
+	}
+	plan.Sections = append(plan.Sections, PlanSection{Name: "statements", Description: "world SQL besides the suffix rows", SQLBytes: statementBytes})
+
+	plan.Total = PlanSection{Name: "total", FirstID: source.FirstID, LastID: id - 1}
+	customRows := 0
+	for _, s := range plan.Sections {
+		plan.Total.Rows += s.Rows
+		plan.Total.DBCBytes += s.DBCBytes
+		plan.Total.SQLBytes += s.SQLBytes
+		if s.Name != "source" {
+			customRows += s.Rows
+		}
+	}
+	if source.LastID > plan.Total.LastID {
+		plan.Total.LastID = source.LastID
+	}
+	strs := plan.Total.DBCBytes - dbcHeaderSize - int64(plan.Total.Rows)*recordSize
+	plan.Total.MemoryBytes = int64(plan.Total.LastID+1)*suffixStoreIndexSize + int64(plan.Total.Rows)*suffixStoreRecordSize + strs +
+		int64(customRows)*suffixCatalogEntrySize
+	return plan, nil
+}
+
+// Print writes the plan as a table, along with a warning if the config generates more suffixes than there
+// are suffix IDs
+func (pl *Plan) Print(w io.Writer) error {
+	tw := tabwriter.NewWriter(w, 0, 8, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintln(tw, "section\t\trows\tfirst ID\tlast ID\tDBC bytes\tSQL bytes\tmemory bytes\t")
+	for _, s := range append(pl.Sections, pl.Total) {
+		fmt.Fprintf(tw, "%s\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t\n", s.Name, s.Description, s.Rows, s.FirstID, s.LastID, s.DBCBytes, s.SQLBytes, s.MemoryBytes)
+	}
+	if err := tw.Flush(); err != nil {
+		return err
+	}
+	if pl.Total.LastID >= math.MaxInt16 {
+		_, err := fmt.Fprintf(w, "WARNING: the last suffix ID %d is past the highest suffix ID %d, generation will fail\n", pl.Total.LastID, math.MaxInt16-1)
+		return err
+	}
+	return nil
+}
+
+// discardWriteSeeker keeps track of its position and nothing else
+type discardWriteSeeker struct {
+	pos int64
+}
+
+func (d *discardWriteSeeker) Write(b []byte) (int, error) {
+	d.pos += int64(len(b))
+	return len(b), nil
+}
+
+func (d *discardWriteSeeker) Seek(offset int64, whence int) (int64, error) {
+	switch whence {
+	case io.SeekStart:
+		d.pos = offset
+	case io.SeekCurrent:
+		d.pos += offset
+	default:
+		return 0, errors.New("discardWriteSeeker cannot seek from the end")
+	}
+	return d.pos, nil
+}
@@ -0,0 +1,292 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package acoremodrandomsuffix
+
+import (
+	"bufio"
+	"io"
+	"os"
+	"path/filepath"
+
+	"github.com/pkg/errors"
+)
+
+const (
+	spellItemEnchantmentTSVName          = "spellitemenchantment_dbc.tsv"
+	itemRandomSuffixTSVName              = "itemrandomsuffix_dbc.tsv"
+	itemEnchantmentRandomSuffixesTSVName = "item_enchantment_random_suffixes.tsv"
+)
+
+// sqlRows renders the rows of one table into a file. For the insert format the file is a temporary one
+// holding the VALUES of the table until the statements before them can be written out, a new INSERT is
+// started every batchRows rows. For the load-data format it is the tab separated file of the table. Rows
+// that are only counted have no file.
+type sqlRows struct {
+	tmpl       string
+	insertTmpl string
+	batchRows  int
+	tsv        bool
+	f          *os.File
+	counter    *countingWriter
+	bw         *bufio.Writer
+	rows       int
+}
+
+func newSpilledSQLRows(tmpl, insertTmpl string, batchRows int) (*sqlRows, error) {
+	f, err := os.CreateTemp("", "generatesuffixes-*.sql")
+	if err != nil {
+		return nil, errors.Wrap(err, "unable to create the SQL spill file")
+	}
+	return &sqlRows{tmpl: tmpl, insertTmpl: insertTmpl, batchRows: batchRows, f: f, bw: bufio.NewWriter(f)}, nil
+}
+
+func newTSVRows(tmpl, path string) (*sqlRows, error) {
+	f, err := mkDirAndOpenFile(path)
+	if err != nil {
+		return nil, err
+	}
+	return &sqlRows{tmpl: tmpl, tsv: true, f: f, bw: bufio.NewWriter(f)}, nil
+}
+
+// countingWriter only counts the bytes written to it
+type countingWriter struct {
+	n int64
+}
+
+func (w *countingWriter) Write(b []byte) (int, error) {
+	w.n += int64(len(b))
+	return len(b), nil
+}
+
+// newCountedSQLRows renders rows only to count their bytes, see size
+func newCountedSQLRows(tmpl, insertTmpl string, batchRows int, tsv bool) *sqlRows {
+	counter := &countingWriter{}
+	return &sqlRows{tmpl: tmpl, insertTmpl: insertTmpl, batchRows: batchRows, tsv: tsv, counter: counter, bw: bufio.NewWriter(counter)}
+}
+
+// size is the number of bytes of the rows written so far, for rows from newCountedSQLRows
+func (s *sqlRows) size() int64 {
+	return s.counter.n + int64(s.bw.Buffered())
+}
+
+func (s *sqlRows) write(data interface{}) error {
+	switch {
+	case s.tsv:
+	case s.rows > 0 && s.batchRows > 0 && s.rows%s.batchRows == 0:
+		s.bw.WriteString(";\n")
+		if err := generatedSQLTemplate.ExecuteTemplate(s.bw, s.insertTmpl, nil); err != nil {
+			return err
+		}
+	case s.rows > 0:
+		s.bw.WriteString(",\n")
+	}
+	s.rows++
+	if err := generatedSQLTemplate.ExecuteTemplate(s.bw, s.tmpl, data); err != nil {
+		return err
+	}
+	if s.tsv {
+		s.bw.WriteByte('\n')
+	}
+	return nil
+}
+
+// copyTo ends the INSERT and copies the spilled rows to w
+func (s *sqlRows) copyTo(w io.Writer) error {
+	s.bw.WriteString(";\n")
+	if err := s.bw.Flush(); err != nil {
+		return errors.Wrap(err, "unable to flush the SQL spill file")
+	}
+	if _, err := s.f.Seek(0, io.SeekStart); err != nil {
+		return errors.Wrap(err, "unable to rewind the SQL spill file")
+	}
+	_, err := io.Copy(w, s.f)
+	return errors.Wrap(err, "unable to copy the SQL spill file")
+}
+
+// close finishes a tab separated file
+func (s *sqlRows) close() error {
+	if err := s.bw.Flush(); err != nil {
+		return errors.Wrapf(err, "unable to write %s", s.f.Name())
+	}
+	return errors.Wrapf(s.f.Close(), "unable to close %s", s.f.Name())
+}
+
+// remove drops a temporary file, tab separated files are kept as they are
+func (s *sqlRows) remove() {
+	s.f.Close()
+	if !s.tsv {
+		os.Remove(s.f.Name())
+	}
+}
+
+// generatedSQLWriter renders generated_sql.tmpl.sql one suffix at a time. Close writes out the world SQL
+// once the last suffix ID is known, for the insert format that includes the suffix rows.
+type generatedSQLWriter struct {
+	w                   io.Writer
+	format              string
+	batchRows           int
+	tsvDir              string
+	itemRandomSuffixes  *sqlRows
+	enchantmentSuffixes *sqlRows
+}
+
+func newGeneratedSQLWriter(p *ProcessedConfig) (*generatedSQLWriter, error) {
+	s := &generatedSQLWriter{
+		w:         p.DstGeneratedWorldSQL,
+		format:    p.WorldSQLFormat,
+		batchRows: p.WorldSQLBatchRows,
+		tsvDir:    p.DstGeneratedWorldTSVDir,
+	}
+	var err error
+	if s.format == WorldSQLFormatLoadData {
+		s.itemRandomSuffixes, err = newTSVRows("itemRandomSuffixRowTSV", filepath.Join(s.tsvDir, itemRandomSuffixTSVName))
+		if err != nil {
+			return nil, err
+		}
+		s.enchantmentSuffixes, err = newTSVRows("itemEnchantmentRandomSuffixRowTSV", filepath.Join(s.tsvDir, itemEnchantmentRandomSuffixesTSVName))
+		if err != nil {
+			s.itemRandomSuffixes.remove()
+			return nil, err
+		}
+		return s, nil
+	}
+	s.itemRandomSuffixes, err = newSpilledSQLRows("itemRandomSuffixRow", "itemRandomSuffixesInsert", s.batchRows)
+	if err != nil {
+		return nil, err
+	}
+	s.enchantmentSuffixes, err = newSpilledSQLRows("itemEnchantmentRandomSuffixRow", "itemEnchantmentRandomSuffixesInsert", s.batchRows)
+	if err != nil {
+		s.itemRandomSuffixes.remove()
+		return nil, err
+	}
+	return s, nil
+}
+
+// newCountedSQLWriter renders the SQL only to count its bytes, see rowsSize and statementsSize
+func newCountedSQLWriter(p *ProcessedConfig) *generatedSQLWriter {
+	s := &generatedSQLWriter{format: p.WorldSQLFormat, batchRows: p.WorldSQLBatchRows, tsvDir: p.DstGeneratedWorldTSVDir}
+	if s.format == WorldSQLFormatLoadData {
+		s.itemRandomSuffixes = newCountedSQLRows("itemRandomSuffixRowTSV", "", 0, true)
+		s.enchantmentSuffixes = newCountedSQLRows("itemEnchantmentRandomSuffixRowTSV", "", 0, true)
+	} else {
+		s.itemRandomSuffixes = newCountedSQLRows("itemRandomSuffixRow", "itemRandomSuffixesInsert", s.batchRows, false)
+		s.enchantmentSuffixes = newCountedSQLRows("itemEnchantmentRandomSuffixRow", "itemEnchantmentRandomSuffixesInsert", s.batchRows, false)
+	}
+	return s
+}
+
+// rowsSize is the number of bytes of the suffix rows written so far
+func (s *generatedSQLWriter) rowsSize() int64 {
+	return s.itemRandomSuffixes.size() + s.enchantmentSuffixes.size()
+}
+
+// statementsSize is the number of bytes Close writes besides the suffix rows, it has to match Close
+func (s *generatedSQLWriter) statementsSize(data tmplData) (int64, error) {
+	data.BatchRows = s.batchRows
+	counter := &countingWriter{}
+	if s.format == WorldSQLFormatLoadData {
+		sieRows := newCountedSQLRows("spellItemEnchantmentRowTSV", "", 0, true)
+		for _, e := range data.CustomSpellItemEnchantmentEntries {
+			if err := sieRows.write(e); err != nil {
+				return 0, err
+			}
+		}
+		data.SpellItemEnchantmentTSV = filepath.ToSlash(filepath.Join(s.tsvDir, spellItemEnchantmentTSVName))
+		data.ItemRandomSuffixTSV = filepath.ToSlash(filepath.Join(s.tsvDir, itemRandomSuffixTSVName))
+		data.ItemEnchantmentRandomSuffixesTSV = filepath.ToSlash(filepath.Join(s.tsvDir, itemEnchantmentRandomSuffixesTSVName))
+		err := generatedSQLTemplate.ExecuteTemplate(counter, "loadData", &data)
+		return counter.n + sieRows.size(), err
+	}
+	for _, tmpl := range []string{"spellItemEnchantments", "itemRandomSuffixesHeader", "itemEnchantmentRandomSuffixesHeader", "footer"} {
+		if err := generatedSQLTemplate.ExecuteTemplate(counter, tmpl, &data); err != nil {
+			return 0, err
+		}
+	}
+	// copyTo ends the INSERT of both tables
+	return counter.n + 2*int64(len(";\n")), nil
+}
+
+func (s *generatedSQLWriter) write(e customRandomSuffixEntry) error {
+	if err := s.itemRandomSuffixes.write(e.toTmplSQLEntry()); err != nil {
+		return err
+	}
+	return s.enchantmentSuffixes.write(e)
+}
+
+// writeRow writes only the item_enchantment_random_suffixes row of a suffix, for a suffix merged into
+// another one by compaction
+func (s *generatedSQLWriter) writeRow(e customRandomSuffixEntry) error {
+	return s.enchantmentSuffixes.write(e)
+}
+
+// Close writes the SQL for the suffixes written so far
+func (s *generatedSQLWriter) Close(data tmplData) error {
+	defer s.remove()
+	data.BatchRows = s.batchRows
+	if s.format == WorldSQLFormatLoadData {
+		return s.closeLoadData(data)
+	}
+	bw := bufio.NewWriter(s.w)
+	if err := generatedSQLTemplate.ExecuteTemplate(bw, "spellItemEnchantments", &data); err != nil {
+		return err
+	}
+	if err := generatedSQLTemplate.ExecuteTemplate(bw, "itemRandomSuffixesHeader", &data); err != nil {
+		return err
+	}
+	if err := s.itemRandomSuffixes.copyTo(bw); err != nil {
+		return err
+	}
+	if err := generatedSQLTemplate.ExecuteTemplate(bw, "itemEnchantmentRandomSuffixesHeader", &data); err != nil {
+		return err
+	}
+	if err := s.enchantmentSuffixes.copyTo(bw); err != nil {
+		return err
+	}
+	if err := generatedSQLTemplate.ExecuteTemplate(bw, "footer", &data); err != nil {
+		return err
+	}
+	return errors.Wrap(bw.Flush(), "unable to write the generated SQL")
+}
+
+func (s *generatedSQLWriter) closeLoadData(data tmplData) error {
+	sieRows, err := newTSVRows("spellItemEnchantmentRowTSV", filepath.Join(s.tsvDir, spellItemEnchantmentTSVName))
+	if err != nil {
+		return err
+	}
+	defer sieRows.remove()
+	for _, e := range data.CustomSpellItemEnchantmentEntries {
+		if err = sieRows.write(e); err != nil {
+			return err
+		}
+	}
+	for _, rows := range []*sqlRows{sieRows, s.itemRandomSuffixes, s.enchantmentSuffixes} {
+		if err = rows.close(); err != nil {
+			return err
+		}
+	}
+	data.SpellItemEnchantmentTSV = filepath.ToSlash(filepath.Join(s.tsvDir, spellItemEnchantmentTSVName))
+	data.ItemRandomSuffixTSV = filepath.ToSlash(filepath.Join(s.tsvDir, itemRandomSuffixTSVName))
+	data.ItemEnchantmentRandomSuffixesTSV = filepath.ToSlash(filepath.Join(s.tsvDir, itemEnchantmentRandomSuffixesTSVName))
+	bw := bufio.NewWriter(s.w)
+	if err = generatedSQLTemplate.ExecuteTemplate(bw, "loadData", &data); err != nil {
+		return err
+	}
+	return errors.Wrap(bw.Flush(), "unable to write the generated SQL")
+}
+
+// remove drops the temporary files, the suffixes written so far are lost
+func (s *generatedSQLWriter) remove() {
+	s.itemRandomSuffixes.remove()
+	s.enchantmentSuffixes.remove()
+}
+
+// writeSuffixRemap writes the SQL of the remap table of a compaction
+func writeSuffixRemap(w io.Writer, remap []suffixRemap) error {
+	bw := bufio.NewWriter(w)
+	if err := generatedSQLTemplate.ExecuteTemplate(bw, "suffixRemap", remap); err != nil {
+		return err
+	}
+	return errors.Wrap(bw.Flush(), "unable to write the suffix remap SQL")
+}
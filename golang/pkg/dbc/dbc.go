@@ -10,6 +10,7 @@ import (
 	"encoding/csv"
 	"fmt"
 	"io"
+	"math"
 	"sort"
 	"strconv"
 
@@ -123,6 +124,9 @@ type DBC struct {
 	Schema      DBCSchema
 	Data        [][]interface{}
 	StringBlock map[int]string
+
+	// stringOffsets is the inverse of StringBlock, built on first use and kept up to date by AppendRecords
+	stringOffsets map[string]int
 }
 
 // validate validates the following:
@@ -143,17 +147,18 @@ func (d DBC) validate() error {
 // extractStrings extracts the strings from the given ReadSeeker. It assumes that the header for the DBC has already
 // been read as it uses the stringblocksize and recordstartoffset from the header to determine where the seeker should
 // jump to.
-// Returns a map of string offsets from the start of the string block to their respective strings
-func (d DBC) extractStrings(rs io.ReadSeeker) (map[int]string, error) {
+// Returns a map of string offsets from the start of the string block to their respective strings, along with
+// the string block itself
+func (d DBC) extractStrings(rs io.ReadSeeker) (map[int]string, []byte, error) {
 	m := make(map[int]string)
 	var stringBlock []byte
 	_, err := rs.Seek(-1*int64(d.Header.StringBlockSize), io.SeekEnd)
 	if err != nil {
-		return m, errors.Wrap(err, "error seeking to string block")
+		return m, nil, errors.Wrap(err, "error seeking to string block")
 	}
 	stringBlock, err = io.ReadAll(rs)
 	if err != nil {
-		return m, errors.Wrap(err, "error reading string block")
+		return m, nil, errors.Wrap(err, "error reading string block")
 	}
 	var strOffset int
 	for _, sB := range bytes.Split(stringBlock, []byte("\u0000")) {
@@ -161,18 +166,22 @@ func (d DBC) extractStrings(rs io.ReadSeeker) (map[int]string, error) {
 		strOffset += len(sB) + 1
 	}
 	// log.Info("EXTRACTED OFFSETS", "map", m)
-	return m, nil
+	return m, stringBlock, nil
 }
 
-func (d DBC) extractData(rs io.ReadSeeker) (data [][]interface{}, strs map[int]string, err error) {
-	strOffsetsToStr, err := d.extractStrings(rs)
+// extractData reads the records. String fields are read out of the string block at their offset, which may
+// be inside a longer string when the block was written compact, those strings are returned in tails along
+// with the offset they were read from.
+func (d DBC) extractData(rs io.ReadSeeker) (data [][]interface{}, strs map[int]string, tails map[string]int, err error) {
+	strOffsetsToStr, stringBlock, err := d.extractStrings(rs)
 	if err != nil {
-		return nil, strOffsetsToStr, err
+		return nil, strOffsetsToStr, nil, err
 	}
 	_, err = rs.Seek(validDBCRecordStartOffset, io.SeekStart)
 	if err != nil {
-		return nil, strOffsetsToStr, errors.Wrap(err, "unable to backtrack to record start offset")
+		return nil, strOffsetsToStr, nil, errors.Wrap(err, "unable to backtrack to record start offset")
 	}
+	tails = make(map[string]int)
 	for i := 0; i < int(d.Header.RecordCount); i++ {
 		var row []interface{}
 		for fi, f := range d.Schema.Fields {
@@ -199,9 +208,17 @@ func (d DBC) extractData(rs io.ReadSeeker) (data [][]interface{}, strs map[int]s
 				err = binary.Read(rs, binary.LittleEndian, &i)
 				v = i
 			case DBCSchemaFieldStringOffset:
-				var i int32
+				var i uint32
 				err = binary.Read(rs, binary.LittleEndian, &i)
-				v = strOffsetsToStr[int(i)]
+				if err != nil {
+					break
+				}
+				str, ok := strOffsetsToStr[int(i)]
+				if !ok {
+					str, err = stringAt(stringBlock, i)
+					tails[str] = int(i)
+				}
+				v = str
 			case DBCSchemaFieldUnknown:
 				var i int32
 				err = binary.Read(rs, binary.LittleEndian, &i)
@@ -210,13 +227,13 @@ func (d DBC) extractData(rs io.ReadSeeker) (data [][]interface{}, strs map[int]s
 				log.Panic("unsupported DBC Schema, check the schema again!", "field_type", f.Type, "col", d.Schema.FieldName(fi))
 			}
 			if err != nil {
-				return nil, strOffsetsToStr, errors.Wrapf(err, "unable to read field in DBC: field_index %d, field_name %s, field_type %s", fi, d.Schema.FieldName(fi), f.Type)
+				return nil, strOffsetsToStr, nil, errors.Wrapf(err, "unable to read field in DBC: field_index %d, field_name %s, field_type %s", fi, d.Schema.FieldName(fi), f.Type)
 			}
 			row = append(row, v)
 		}
 		data = append(data, row)
 	}
-	return data, strOffsetsToStr, nil
+	return data, strOffsetsToStr, tails, nil
 }
 
 func (d *DBC) extract(dbcRs, schemaRs io.ReadSeeker) error {
@@ -232,83 +249,146 @@ func (d *DBC) extract(dbcRs, schemaRs io.ReadSeeker) error {
 	if err != nil {
 		return err
 	}
-	data, strs, err := d.extractData(dbcRs)
+	data, strs, tails, err := d.extractData(dbcRs)
 	if err != nil {
 		return err
 	}
 	d.Data = data
 	d.StringBlock = strs
+	// Strings read from inside a longer one have no offset of their own in StringBlock, Export writes the
+	// block back as it was so they keep the offset they were read from
+	offsets := d.stringBlockOffsets()
+	for str, offset := range tails {
+		if _, ok := offsets[str]; !ok {
+			offsets[str] = offset
+		}
+	}
 	return nil
 }
 
+// stringBlockOffsets returns the offset of every string in the string block. A string that is in the
+// block more than once, like the empty string terminating it, maps to its lowest offset.
 func (d *DBC) stringBlockOffsets() map[string]int {
-	m := make(map[string]int)
+	if d.stringOffsets != nil {
+		return d.stringOffsets
+	}
+	d.stringOffsets = make(map[string]int, len(d.StringBlock))
 	for offset, str := range d.StringBlock {
-		m[str] = offset
+		if existing, ok := d.stringOffsets[str]; !ok || offset < existing {
+			d.stringOffsets[str] = offset
+		}
 	}
-	return m
+	return d.stringOffsets
 }
 
-func (d *DBC) Export(w io.WriteSeeker) error {
-	err := d.Header.WriteDBCHeader(w)
-	if err != nil {
-		return err
-	}
-	stringsToOffsets := d.stringBlockOffsets()
-	for _, row := range d.Data {
-		for fi, fv := range row {
-			schemaField := d.Schema.Fields[fi]
-			switch schemaField.Type {
-			case DBCSchemaFieldInt32, DBCSchemaFieldUint8, DBCSchemaFieldUint32, DBCSchemaFieldFloat32, DBCSchemaFieldFloat64, DBCSchemaFieldUnknown:
-				err = binary.Write(w, binary.LittleEndian, fv)
-				if err != nil {
-					return errors.Wrapf(err, "unable to write field in DBC: field_index %d, field_name %s, field_type %s, value: %v", fi, d.Schema.FieldName(fi), schemaField.Type, fv)
-				}
-			case DBCSchemaFieldStringOffset:
-				var fvStr string
-				switch fvt := fv.(type) {
-				case []byte:
-					fvStr = string(fvt)
-				case string:
-					fvStr = fvt
-				default:
-					return errors.Wrapf(ErrDBCInvalidDataStringOffset, "string offset type was %T, val: %v", fv, fv)
-				}
-				strOffset := int32(stringsToOffsets[fvStr])
-				err = binary.Write(w, binary.LittleEndian, strOffset)
-				if err != nil {
-					return errors.Wrapf(err, "unable to write field in DBC: field_index %d, field_name %s, field_type %s, value: %v", fi, d.Schema.FieldName(fi), schemaField.Type, fv)
-				}
-			default:
-				log.Panic("unsupported DBC Schema, check the schema again!", "field_type", schemaField.Type, "col", d.Schema.FieldName(fi))
-			}
-		}
-	}
+// Export writes the DBC, strings keep the offsets they have in StringBlock
+func (d *DBC) Export(w io.Writer) error {
 	type strBlockIndex struct {
 		offset int
-		sB     []byte
+		s      string
 	}
-	var sbis []strBlockIndex
+	sbis := make([]strBlockIndex, 0, len(d.StringBlock))
 	for off, s := range d.StringBlock {
-		sbis = append(sbis, strBlockIndex{offset: off, sB: []byte(s)})
+		sbis = append(sbis, strBlockIndex{offset: off, s: s})
 	}
-	sort.SliceStable(sbis, func(i, j int) bool { return sbis[i].offset < sbis[j].offset })
-	var strBs [][]byte
-	prev := -1
+	sort.Slice(sbis, func(i, j int) bool { return sbis[i].offset < sbis[j].offset })
+	var strByteBlock []byte
 	for i, sbi := range sbis {
-		if i == 0 && sbi.offset != 0 && string(sbi.sB) != "" {
+		if i == 0 && sbi.offset != 0 && sbi.s != "" {
 			return errors.Wrap(ErrDBCInvalidStringBlockOffset, "first offset should always be 0 and be an empty string")
 		}
-		if prev+1 != sbi.offset {
-			return errors.Wrapf(ErrDBCInvalidStringBlockOffset, "previous offset should always be one less than current, prev %d, current %d", prev, sbi.offset)
+		if len(strByteBlock) != sbi.offset {
+			return errors.Wrapf(ErrDBCInvalidStringBlockOffset, "previous offset should always be one less than current, prev %d, current %d", len(strByteBlock)-1, sbi.offset)
 		}
-		strBs = append(strBs, sbi.sB)
-		prev += len(sbi.sB) + 1
+		strByteBlock = append(strByteBlock, sbi.s...)
+		strByteBlock = append(strByteBlock, 0)
 	}
-	strByteBlock := bytes.Join(strBs, []byte("\u0000"))
-	_, err = w.Write(strByteBlock)
-	if err != nil {
-		return errors.Wrap(err, "unable to write string block to the end of the writer")
+	// Strings are joined by their terminators, the last one is the empty string at StringBlockSize
+	if len(strByteBlock) > 0 {
+		strByteBlock = strByteBlock[:len(strByteBlock)-1]
+	}
+	return d.export(w, stringOffsets(d.stringBlockOffsets()), strByteBlock)
+}
+
+// ExportCompact writes the DBC with a CompactStringBlock, only the strings that Data uses are kept
+func (d *DBC) ExportCompact(w io.Writer) error {
+	strs := make(map[string]struct{})
+	for _, row := range d.Data {
+		for fi, fv := range row {
+			if d.Schema.Fields[fi].Type != DBCSchemaFieldStringOffset {
+				continue
+			}
+			switch fvt := fv.(type) {
+			case []byte:
+				strs[string(fvt)] = struct{}{}
+			case string:
+				strs[fvt] = struct{}{}
+			default:
+				return errors.Wrapf(ErrDBCInvalidDataStringOffset, "string offset type was %T, val: %v", fv, fv)
+			}
+		}
+	}
+	block := NewCompactStringBlock(strs)
+	return d.export(w, block, block.Bytes())
+}
+
+// stringOffsets adapts the string to offset map of a DBC to a stringOffsetter
+type stringOffsets map[string]int
+
+func (s stringOffsets) Offset(str string) uint32 {
+	return uint32(s[str])
+}
+
+func (d *DBC) export(w io.Writer, strs stringOffsetter, stringBlock []byte) error {
+	header := d.Header
+	header.RecordCount = uint32(len(d.Data))
+	header.StringBlockSize = uint32(len(stringBlock))
+	return writeDBC(w, header, func(i int, b []byte) error { return d.encodeRow(d.Data[i], b, strs) }, stringBlock)
+}
+
+// encodeRow encodes a row of Data into b, each value is written with the size of its Go type like
+// binary.Write would, the row has to add up to exactly the record size
+func (d *DBC) encodeRow(row []interface{}, b []byte, strs stringOffsetter) error {
+	off := 0
+	for fi, fv := range row {
+		schemaField := d.Schema.Fields[fi]
+		if off+int(schemaField.Type.SizeOf()) > len(b) {
+			return errors.Wrapf(ErrDBCInvalidRecordCount, "record overflows the record size %d at field_index %d, field_name %s", len(b), fi, d.Schema.FieldName(fi))
+		}
+		if schemaField.Type == DBCSchemaFieldStringOffset {
+			switch fvt := fv.(type) {
+			case []byte:
+				binary.LittleEndian.PutUint32(b[off:], strs.Offset(string(fvt)))
+			case string:
+				binary.LittleEndian.PutUint32(b[off:], strs.Offset(fvt))
+			default:
+				return errors.Wrapf(ErrDBCInvalidDataStringOffset, "string offset type was %T, val: %v", fv, fv)
+			}
+			off += 4
+			continue
+		}
+		switch fvt := fv.(type) {
+		case int32:
+			binary.LittleEndian.PutUint32(b[off:], uint32(fvt))
+			off += 4
+		case uint32:
+			binary.LittleEndian.PutUint32(b[off:], fvt)
+			off += 4
+		case uint8:
+			b[off] = fvt
+			off++
+		case float32:
+			binary.LittleEndian.PutUint32(b[off:], math.Float32bits(fvt))
+			off += 4
+		case float64:
+			binary.LittleEndian.PutUint64(b[off:], math.Float64bits(fvt))
+			off += 8
+		default:
+			return errors.Errorf("unable to write field in DBC: field_index %d, field_name %s, field_type %s, value: %v (%T)", fi, d.Schema.FieldName(fi), schemaField.Type, fv, fv)
+		}
+	}
+	if off != len(b) {
+		return errors.Wrapf(ErrDBCInvalidRecordCount, "record encoded into %d bytes, record size is %d", off, len(b))
 	}
 	return nil
 }
@@ -348,32 +428,26 @@ func (d *DBC) AppendFromCSV(srcRs io.ReadSeeker) error {
 	return d.AppendFromCSVData(csvRecords)
 }
 
+// AppendFromCSVData parses CSV rows, the first being the header, and appends them with AppendRecords
 func (d *DBC) AppendFromCSVData(csvRecords [][]string) error {
 	csvHeader, csvRecords := csvRecords[0], csvRecords[1:]
 	if d.Header.FieldCount != uint32(len(csvHeader)) {
 		return errors.Wrapf(ErrDBCInvalidFieldCount, "field count from CSV and field count from header are these respectively: %d, %d", len(csvHeader), d.Header.FieldCount)
 	}
-	d.Header.RecordCount += uint32(len(csvRecords))
-
-	// // Remove last empty string from string block, will be added back later
-	for off, s := range d.StringBlock {
-		if s == "" && off != 0 {
-			delete(d.StringBlock, off)
+	for fi, sf := range d.Schema.Fields {
+		if sf.Name != csvHeader[fi] {
+			return errors.Wrapf(ErrDBCInvalidFieldName, "field names do not tally from schema and CSV, schema is %s, csv header is %s", sf.Name, csvHeader[fi])
 		}
 	}
 	var err error
-	stringsToOffsets := d.stringBlockOffsets()
+	dbcRows := make([][]interface{}, 0, len(csvRecords))
 	for _, row := range csvRecords {
 		if d.Header.FieldCount != uint32(len(row)) {
 			return errors.Wrapf(ErrDBCInvalidFieldCount, "field count from CSV row and field count from header are these respectively: %d, %d", len(row), d.Header.FieldCount)
 		}
-
-		var dbcRow []interface{}
+		dbcRow := make([]interface{}, 0, len(row))
 		for fi, fieldValue := range row {
 			sf := d.Schema.Fields[fi]
-			if sf.Name != csvHeader[fi] {
-				return errors.Wrapf(ErrDBCInvalidFieldName, "field names do not tally from schema and CSV, schema is %s, csv header is %s", sf.Name, csvHeader[fi])
-			}
 			var v interface{}
 			switch sf.Type {
 			case DBCSchemaFieldInt32:
@@ -398,12 +472,6 @@ func (d *DBC) AppendFromCSVData(csvRecords [][]string) error {
 				v = i
 			case DBCSchemaFieldStringOffset:
 				v = fieldValue
-				if _, ok := stringsToOffsets[fieldValue]; len(fieldValue) > 0 && !ok {
-					stringsToOffsets[fieldValue] = int(d.Header.StringBlockSize)
-					d.StringBlock[int(d.Header.StringBlockSize)] = fieldValue
-					// advance offset by the length of bytes and 1, where 1 is the \0 byte
-					d.Header.StringBlockSize += uint32(len([]byte(fieldValue))) + 1
-				}
 			case DBCSchemaFieldUnknown:
 				var i int64
 				i, err = strconv.ParseInt(fieldValue, 10, 32)
@@ -416,12 +484,57 @@ func (d *DBC) AppendFromCSVData(csvRecords [][]string) error {
 			}
 			dbcRow = append(dbcRow, v)
 		}
-		d.Data = append(d.Data, dbcRow)
+		dbcRows = append(dbcRows, dbcRow)
 	}
-	d.StringBlock[int(d.Header.StringBlockSize)] = "" // Last entry also ends off with a control char, we add this in to be consistent.
+	return d.AppendRecords(dbcRows)
+}
+
+// AppendRecords appends rows that are already typed the same way as Data, strings included. New strings
+// go to the end of the string block and into the string offset index, nothing is rebuilt per call.
+func (d *DBC) AppendRecords(rows [][]interface{}) error {
+	for _, row := range rows {
+		if d.Header.FieldCount != uint32(len(row)) {
+			return errors.Wrapf(ErrDBCInvalidFieldCount, "field count from row and field count from header are these respectively: %d, %d", len(row), d.Header.FieldCount)
+		}
+		for fi, v := range row {
+			if d.Schema.Fields[fi].Type != DBCSchemaFieldStringOffset {
+				continue
+			}
+			switch vt := v.(type) {
+			case string:
+				d.appendString(vt)
+			case []byte:
+				row[fi] = string(vt)
+				d.appendString(string(vt))
+			default:
+				return errors.Wrapf(ErrDBCInvalidDataStringOffset, "string offset type was %T, val: %v", v, v)
+			}
+		}
+	}
+	d.Header.RecordCount += uint32(len(rows))
+	d.Data = append(d.Data, rows...)
 	return nil
 }
 
+// appendString adds a string to the end of the string block if it is not in there yet
+func (d *DBC) appendString(s string) {
+	stringsToOffsets := d.stringBlockOffsets()
+	if _, ok := stringsToOffsets[s]; ok || len(s) == 0 {
+		return
+	}
+	// The string block map ends with an empty string at the offset one past the last \0, so that Export
+	// writes the terminator of the last string. It moves along as strings are appended.
+	end := int(d.Header.StringBlockSize)
+	if last, ok := d.StringBlock[end]; ok && last == "" {
+		delete(d.StringBlock, end)
+	}
+	stringsToOffsets[s] = end
+	d.StringBlock[end] = s
+	// advance offset by the length of bytes and 1, where 1 is the \0 byte
+	d.Header.StringBlockSize += uint32(len(s)) + 1
+	d.StringBlock[int(d.Header.StringBlockSize)] = ""
+}
+
 // extractFromCSV extracts from a source srcRs. It assumes that srcRs is
 // a CSV source.
 func (d *DBC) extractFromCSV(srcRs, schemaRs io.ReadSeeker) error {
@@ -438,6 +551,7 @@ func (d *DBC) extractFromCSV(srcRs, schemaRs io.ReadSeeker) error {
 	d.Header.StringBlockSize = 1
 	d.StringBlock = map[int]string{
 		0: "", // First is always zero and empty string, as the first byte is hardcoded as \0
+		1: "", // Last entry also ends off with a control char, see appendString
 	}
 	return d.AppendFromCSV(srcRs)
 }
@@ -40,7 +40,7 @@ func ExportFromCSV(dst, srcCSV, schemaJSON string) error {
 	if err != nil {
 		return errors.Wrap(err, "cannot open destination CSV file")
 	}
-	err = dbc.Export(dstfp)
+	err = dbc.ExportCompact(dstfp)
 	if err != nil {
 		return err
 	}
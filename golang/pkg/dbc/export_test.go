@@ -0,0 +1,196 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package dbc
+
+import (
+	"io"
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+const (
+	benchGeneratedDBCDir = "../../../patch-Z.MPQ/DBFilesClient"
+	benchSchemaDirExport = "../../data/3.3.5.12340/schemas"
+)
+
+// benchExport exports into a real file, since the number of writes matters as much as the encoding
+func benchExport(b *testing.B, export func(w io.Writer) error) {
+	f, err := os.Create(filepath.Join(b.TempDir(), "export.dbc"))
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer f.Close()
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err = f.Seek(0, io.SeekStart); err != nil {
+			b.Fatal(err)
+		}
+		if err = f.Truncate(0); err != nil {
+			b.Fatal(err)
+		}
+		if err = export(f); err != nil {
+			b.Fatal(err)
+		}
+	}
+	b.StopTimer()
+	fi, err := f.Stat()
+	if err != nil {
+		b.Fatal(err)
+	}
+	b.ReportMetric(float64(fi.Size()), "dbc-bytes")
+}
+
+// BenchmarkDBCExport exports the generated DBCs shipped with the module
+func BenchmarkDBCExport(b *testing.B) {
+	for _, name := range []string{"ItemRandomSuffix", "SpellItemEnchantment"} {
+		dbcPath := benchGeneratedDBCDir + "/" + name + ".dbc"
+		schemaPath := benchSchemaDirExport + "/" + name + ".dbc.json"
+		d, err := NewDBCFromFile(dbcPath, schemaPath)
+		if err != nil {
+			b.Fatal(err)
+		}
+		b.Run(name+"/DBC.Export", func(b *testing.B) {
+			benchExport(b, d.Export)
+		})
+		b.Run(name+"/DBC.ExportCompact", func(b *testing.B) {
+			benchExport(b, d.ExportCompact)
+		})
+		switch name {
+		case "ItemRandomSuffix":
+			t, err := ReadTableFromFile[ItemRandomSuffixRecord](dbcPath)
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.Run(name+"/Table.Export", func(b *testing.B) {
+				benchExport(b, t.Export)
+			})
+			b.Run(name+"/Table.ExportCompact", func(b *testing.B) {
+				benchExport(b, t.ExportCompact)
+			})
+		case "SpellItemEnchantment":
+			t, err := ReadTableFromFile[SpellItemEnchantmentRecord](dbcPath)
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.Run(name+"/Table.Export", func(b *testing.B) {
+				benchExport(b, t.Export)
+			})
+			b.Run(name+"/Table.ExportCompact", func(b *testing.B) {
+				benchExport(b, t.ExportCompact)
+			})
+		}
+	}
+}
+
+// TestDBCExportRoundTrip reads the shipped DBCs, whose compact string blocks have offsets pointing inside
+// longer strings, exports them and reads every string column back
+func TestDBCExportRoundTrip(t *testing.T) {
+	for _, name := range []string{"ItemRandomSuffix", "SpellItemEnchantment"} {
+		dbcPath := filepath.Join(benchGeneratedDBCDir, name+".dbc")
+		schemaPath := filepath.Join(benchSchemaDirExport, name+".dbc.json")
+		d, err := NewDBCFromFile(dbcPath, schemaPath)
+		if err != nil {
+			t.Fatal(err)
+		}
+		m, err := OpenMappedDBC(dbcPath, schemaPath)
+		if err != nil {
+			t.Fatal(err)
+		}
+		for i, row := range d.Data {
+			for fi, got := range row {
+				if m.Schema.Fields[fi].Type != DBCSchemaFieldStringOffset {
+					continue
+				}
+				want, err := m.Record(i).String(fi)
+				if err != nil || got != want {
+					t.Fatalf("%s record %d field %s: NewDBCFromFile %q, mapped %q (err %v)", name, i, m.Schema.FieldName(fi), got, want, err)
+				}
+			}
+		}
+		m.Close()
+
+		exports := []struct {
+			name   string
+			export func(w io.Writer) error
+		}{{"Export", d.Export}, {"ExportCompact", d.ExportCompact}}
+		for _, e := range exports {
+			path := filepath.Join(t.TempDir(), name+".dbc")
+			f, err := os.Create(path)
+			if err != nil {
+				t.Fatal(err)
+			}
+			err = e.export(f)
+			f.Close()
+			if err != nil {
+				t.Fatal(err)
+			}
+			back, err := NewDBCFromFile(path, schemaPath)
+			if err != nil {
+				t.Fatal(err)
+			}
+			if len(back.Data) != len(d.Data) {
+				t.Fatalf("%s %s: read back %d records, want %d", name, e.name, len(back.Data), len(d.Data))
+			}
+			for i, row := range d.Data {
+				for fi, want := range row {
+					if d.Schema.Fields[fi].Type == DBCSchemaFieldStringOffset && back.Data[i][fi] != want {
+						t.Fatalf("%s %s record %d field %s: read back %q, want %q", name, e.name, i, d.Schema.FieldName(fi), back.Data[i][fi], want)
+					}
+				}
+			}
+		}
+	}
+}
+
+// TestTableWriterSpillsStringsOnce writes records whose strings are not in the source table, a string that comes
+// again is given the offset it was spilled at the first time
+func TestTableWriterSpillsStringsOnce(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "ItemRandomSuffix.dbc")
+	f, err := os.Create(path)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer f.Close()
+	src := &Table[ItemRandomSuffixRecord]{Records: []ItemRandomSuffixRecord{{ID: 1, Name_Lang_enUS: "of the Bear", InternalName: "Bear"}}}
+	tw, err := NewTableWriter(f, src)
+	if err != nil {
+		t.Fatal(err)
+	}
+	names := []string{"[ I]", "[ II]", "[ I]", "[ II]", "of the Bear"}
+	for i, name := range names {
+		if err = tw.Write(ItemRandomSuffixRecord{ID: int32(i + 2), Name_Lang_enUS: name, InternalName: "CUSTOM " + name}); err != nil {
+			t.Fatal(err)
+		}
+	}
+	if err = tw.Close(); err != nil {
+		t.Fatal(err)
+	}
+	back, err := ReadTableFromFile[ItemRandomSuffixRecord](path)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i, name := range names {
+		if r := back.Records[i+1]; r.Name_Lang_enUS != name || r.InternalName != "CUSTOM "+name {
+			t.Fatalf("record %d: read back %q/%q, want %q/%q", i+1, r.Name_Lang_enUS, r.InternalName, name, "CUSTOM "+name)
+		}
+	}
+	// The source block is "\0of the Bear\0", "Bear" being its tail, then each new string once
+	var want uint32 = 1 + uint32(len("of the Bear")+1)
+	for _, s := range []string{"[ I]", "CUSTOM [ I]", "[ II]", "CUSTOM [ II]", "CUSTOM of the Bear"} {
+		want += uint32(len(s) + 1)
+	}
+	var header DBCHeader
+	if _, err = f.Seek(0, io.SeekStart); err != nil {
+		t.Fatal(err)
+	}
+	if err = header.ReadDBCHeader(f); err != nil {
+		t.Fatal(err)
+	}
+	if header.StringBlockSize != want {
+		t.Fatalf("string block size %d, want %d", header.StringBlockSize, want)
+	}
+}
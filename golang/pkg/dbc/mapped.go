@@ -0,0 +1,201 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package dbc
+
+import (
+	"bytes"
+	"encoding/binary"
+	"math"
+	"os"
+
+	"github.com/pkg/errors"
+)
+
+var (
+	ErrDBCTruncated           = errors.New("DBC file is shorter than its header says it is")
+	ErrDBCInvalidStringOffset = errors.New("DBC string offset points outside of the string block")
+)
+
+// MappedDBC is a read only view of a DBC file mapped into memory. Nothing is decoded up front, each
+// Record is a fixed stride view into the mapping and fields are only decoded when read. Unlike DBC, the
+// string block is never split up either, string offsets are only resolved when a string field is read.
+//
+// Records and byte slices returned by a MappedDBC are only valid until Close is called.
+type MappedDBC struct {
+	Header DBCHeader
+	Schema DBCSchema
+
+	mapping      []byte
+	unmap        func([]byte) error
+	records      []byte
+	stringBlock  []byte
+	fieldOffsets []uint32
+	fieldIndexes map[string]int
+}
+
+// OpenMappedDBC maps the DBC file into memory and validates it against the schema
+func OpenMappedDBC(dbcFilePath, schemaJSONPath string) (*MappedDBC, error) {
+	schemafp, err := os.Open(schemaJSONPath)
+	if err != nil {
+		return nil, errors.Wrap(err, "cannot open schema file")
+	}
+	defer schemafp.Close()
+	var m MappedDBC
+	if err = m.Schema.FromJSONReader(schemafp); err != nil {
+		return nil, err
+	}
+
+	dbcfp, err := os.Open(dbcFilePath)
+	if err != nil {
+		return nil, errors.Wrap(err, "cannot open dbc file")
+	}
+	defer dbcfp.Close()
+	m.mapping, m.unmap, err = mapFile(dbcfp)
+	if err != nil {
+		return nil, errors.Wrap(err, "cannot map dbc file")
+	}
+	if err = m.init(); err != nil {
+		m.Close()
+		return nil, err
+	}
+	return &m, nil
+}
+
+func (m *MappedDBC) init() error {
+	if len(m.mapping) < validDBCRecordStartOffset {
+		return errors.Wrapf(ErrDBCTruncated, "file size is %d, smaller than the header", len(m.mapping))
+	}
+	err := m.Header.ReadDBCHeader(bytes.NewReader(m.mapping[:validDBCRecordStartOffset]))
+	if err != nil {
+		return err
+	}
+	err = DBC{Header: m.Header, Schema: m.Schema}.validate()
+	if err != nil {
+		return err
+	}
+	recordsEnd := uint64(validDBCRecordStartOffset) + uint64(m.Header.RecordCount)*uint64(m.Header.RecordSize)
+	fileEnd := recordsEnd + uint64(m.Header.StringBlockSize)
+	if uint64(len(m.mapping)) < fileEnd {
+		return errors.Wrapf(ErrDBCTruncated, "file size is %d, header needs %d", len(m.mapping), fileEnd)
+	}
+	m.records = m.mapping[validDBCRecordStartOffset:recordsEnd]
+	m.stringBlock = m.mapping[recordsEnd:fileEnd]
+
+	m.fieldOffsets = make([]uint32, len(m.Schema.Fields))
+	m.fieldIndexes = make(map[string]int, len(m.Schema.Fields))
+	var offset uint32
+	for fi, f := range m.Schema.Fields {
+		m.fieldOffsets[fi] = offset
+		offset += f.Type.SizeOf()
+		m.fieldIndexes[m.Schema.FieldName(fi)] = fi
+	}
+	return nil
+}
+
+// Close unmaps the file, every record and byte slice from this MappedDBC is invalid afterwards
+func (m *MappedDBC) Close() error {
+	if m.mapping == nil {
+		return nil
+	}
+	err := m.unmap(m.mapping)
+	m.mapping, m.records, m.stringBlock = nil, nil, nil
+	return err
+}
+
+// RecordCount returns the number of records in the DBC
+func (m *MappedDBC) RecordCount() int {
+	return int(m.Header.RecordCount)
+}
+
+// FieldIndex returns the index of the field with the given schema field name
+func (m *MappedDBC) FieldIndex(name string) (int, bool) {
+	fi, ok := m.fieldIndexes[name]
+	return fi, ok
+}
+
+// Record returns a view of the i-th record
+func (m *MappedDBC) Record(i int) MappedRecord {
+	start := i * int(m.Header.RecordSize)
+	return MappedRecord{m: m, b: m.records[start : start+int(m.Header.RecordSize)]}
+}
+
+// StringAt returns the bytes of the string at the given string block offset, without copying them. Like
+// stringAt, the offset right past the end of the block is the empty string.
+func (m *MappedDBC) StringAt(offset uint32) ([]byte, error) {
+	if uint64(offset) == uint64(len(m.stringBlock)) {
+		return []byte{}, nil
+	}
+	if uint64(offset) > uint64(len(m.stringBlock)) {
+		return nil, errors.Wrapf(ErrDBCInvalidStringOffset, "offset %d, string block size %d", offset, len(m.stringBlock))
+	}
+	s := m.stringBlock[offset:]
+	if end := bytes.IndexByte(s, 0); end >= 0 {
+		s = s[:end]
+	}
+	return s, nil
+}
+
+// MappedRecord is a view of one record of a MappedDBC. The typed accessors do not check the field type
+// against the schema, reading a field as the wrong type returns garbage in the same way a C struct would.
+type MappedRecord struct {
+	m *MappedDBC
+	b []byte
+}
+
+func (r MappedRecord) field(fi int) []byte {
+	return r.b[r.m.fieldOffsets[fi]:]
+}
+
+func (r MappedRecord) Int32(fi int) int32 {
+	return int32(binary.LittleEndian.Uint32(r.field(fi)))
+}
+
+func (r MappedRecord) Uint8(fi int) uint8 {
+	return r.field(fi)[0]
+}
+
+func (r MappedRecord) Uint32(fi int) uint32 {
+	return binary.LittleEndian.Uint32(r.field(fi))
+}
+
+func (r MappedRecord) Float32(fi int) float32 {
+	return math.Float32frombits(binary.LittleEndian.Uint32(r.field(fi)))
+}
+
+func (r MappedRecord) Float64(fi int) float64 {
+	return math.Float64frombits(binary.LittleEndian.Uint64(r.field(fi)))
+}
+
+// StringBytes resolves a string_offset field without copying, the bytes are only valid until Close
+func (r MappedRecord) StringBytes(fi int) ([]byte, error) {
+	return r.m.StringAt(r.Uint32(fi))
+}
+
+// String resolves a string_offset field into a copy of the string
+func (r MappedRecord) String(fi int) (string, error) {
+	s, err := r.StringBytes(fi)
+	return string(s), err
+}
+
+// Value decodes a field the same way DBC.Data holds it, for callers that still need boxed values
+func (r MappedRecord) Value(fi int) (interface{}, error) {
+	switch t := r.m.Schema.Fields[fi].Type; t {
+	case DBCSchemaFieldInt32, DBCSchemaFieldUnknown:
+		return r.Int32(fi), nil
+	case DBCSchemaFieldUint8:
+		return r.Uint8(fi), nil
+	case DBCSchemaFieldUint32:
+		return r.Uint32(fi), nil
+	case DBCSchemaFieldFloat32:
+		return r.Float32(fi), nil
+	case DBCSchemaFieldFloat64:
+		return r.Float64(fi), nil
+	case DBCSchemaFieldStringOffset:
+		return r.String(fi)
+	default:
+		log.Panic("unsupported DBC Schema, check the schema again!", "field_type", t, "col", r.m.Schema.FieldName(fi))
+	}
+	return nil, nil
+}
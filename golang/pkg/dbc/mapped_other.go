@@ -0,0 +1,21 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+//go:build !unix
+
+package dbc
+
+import (
+	"io"
+	"os"
+)
+
+// mapFile falls back to reading the whole file where mmap is not available, the views work the same
+func mapFile(f *os.File) ([]byte, func([]byte) error, error) {
+	b, err := io.ReadAll(f)
+	if err != nil {
+		return nil, nil, err
+	}
+	return b, func([]byte) error { return nil }, nil
+}
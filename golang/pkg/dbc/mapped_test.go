@@ -0,0 +1,248 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package dbc
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"math/rand"
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+const benchSchemaDir = "../../data/3.3.5.12340/schemas"
+
+// benchDBCs are the bundled schemas along with roughly the record counts of the 3.3.5 client DBCs. Only
+// two of the DBC files ship with the module, so every benchmark DBC is synthesized from its schema.
+var benchDBCs = []struct {
+	name        string
+	recordCount int
+}{
+	{"ItemRandomProperties", 2200},
+	{"ItemRandomSuffix", 9200},
+	{"Spell", 49800},
+	{"SpellItemEnchantment", 3500},
+}
+
+// writeBenchDBC writes a DBC with random values and a distinct string per record for every string field
+func writeBenchDBC(b *testing.B, dir, name string, recordCount int) (dbcPath, schemaPath string) {
+	schemaPath = filepath.Join(benchSchemaDir, name+".dbc.json")
+	schemafp, err := os.Open(schemaPath)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer schemafp.Close()
+	var schema DBCSchema
+	if err = schema.FromJSONReader(schemafp); err != nil {
+		b.Fatal(err)
+	}
+
+	rng := rand.New(rand.NewSource(1))
+	stringBlock := []byte{0}
+	var records bytes.Buffer
+	for i := 0; i < recordCount; i++ {
+		for fi, f := range schema.Fields {
+			switch f.Type {
+			case DBCSchemaFieldUint8:
+				records.WriteByte(uint8(rng.Uint32()))
+			case DBCSchemaFieldFloat64:
+				binary.Write(&records, binary.LittleEndian, rng.Float64())
+			case DBCSchemaFieldFloat32:
+				binary.Write(&records, binary.LittleEndian, rng.Float32())
+			case DBCSchemaFieldStringOffset:
+				// Like the client DBCs, most localised string columns are empty
+				if fi%8 != 1 {
+					binary.Write(&records, binary.LittleEndian, uint32(0))
+					continue
+				}
+				binary.Write(&records, binary.LittleEndian, uint32(len(stringBlock)))
+				stringBlock = append(stringBlock, fmt.Sprintf("%s %d of record %d", schema.FieldName(fi), rng.Intn(1000), i)...)
+				stringBlock = append(stringBlock, 0)
+			default:
+				binary.Write(&records, binary.LittleEndian, rng.Uint32())
+			}
+		}
+	}
+
+	var out bytes.Buffer
+	header := DBCHeader{
+		MagicSignature:  []byte(dbcMagicSignature),
+		RecordCount:     uint32(recordCount),
+		FieldCount:      uint32(len(schema.Fields)),
+		RecordSize:      schema.CalculateRecordSize(),
+		StringBlockSize: uint32(len(stringBlock)),
+	}
+	if err = header.WriteDBCHeader(&out); err != nil {
+		b.Fatal(err)
+	}
+	out.Write(records.Bytes())
+	out.Write(stringBlock)
+	dbcPath = filepath.Join(dir, name+".dbc")
+	if err = os.WriteFile(dbcPath, out.Bytes(), 0644); err != nil {
+		b.Fatal(err)
+	}
+	return dbcPath, schemaPath
+}
+
+// readAllMapped decodes every field of every record, which is the work NewDBCFromFile does up front
+func readAllMapped(m *MappedDBC) (sum uint64, err error) {
+	for i := 0; i < m.RecordCount(); i++ {
+		r := m.Record(i)
+		for fi, f := range m.Schema.Fields {
+			switch f.Type {
+			case DBCSchemaFieldUint8:
+				sum += uint64(r.Uint8(fi))
+			case DBCSchemaFieldFloat32:
+				sum += uint64(r.Float32(fi))
+			case DBCSchemaFieldFloat64:
+				sum += uint64(r.Float64(fi))
+			case DBCSchemaFieldStringOffset:
+				var s []byte
+				if s, err = r.StringBytes(fi); err != nil {
+					return sum, err
+				}
+				sum += uint64(len(s))
+			default:
+				sum += uint64(r.Uint32(fi))
+			}
+		}
+	}
+	return sum, nil
+}
+
+// shippedDBCDir holds the DBCs of the client patch shipped with the module. They are written by ExportCompact, so
+// many of their string offsets point inside a longer string, which stringAt reads up to the next terminator.
+const shippedDBCDir = "../../../patch-Z.MPQ/DBFilesClient"
+
+func TestMappedDBCShipped(t *testing.T) {
+	for _, name := range []string{"ItemRandomSuffix", "SpellItemEnchantment"} {
+		dbcPath := filepath.Join(shippedDBCDir, name+".dbc")
+		schemaPath := filepath.Join(benchSchemaDir, name+".dbc.json")
+		d, err := NewDBCFromFile(dbcPath, schemaPath)
+		if err != nil {
+			t.Fatal(err)
+		}
+		m, err := OpenMappedDBC(dbcPath, schemaPath)
+		if err != nil {
+			t.Fatal(err)
+		}
+		raw, err := os.ReadFile(dbcPath)
+		if err != nil {
+			t.Fatal(err)
+		}
+		stringBlock := raw[len(raw)-int(m.Header.StringBlockSize):]
+		if m.RecordCount() != len(d.Data) {
+			t.Fatalf("%s: mapped %d records, NewDBCFromFile %d", name, m.RecordCount(), len(d.Data))
+		}
+		// The strings are checked against the raw block as well, as their offsets may point inside longer strings
+		for i, row := range d.Data {
+			r := m.Record(i)
+			for fi, want := range row {
+				if m.Schema.Fields[fi].Type != DBCSchemaFieldStringOffset {
+					if got, err := r.Value(fi); err != nil || got != want {
+						t.Fatalf("%s record %d field %s: mapped %v (err %v), NewDBCFromFile %v", name, i, m.Schema.FieldName(fi), got, err, want)
+					}
+					continue
+				}
+				wantStr, err := stringAt(stringBlock, r.Uint32(fi))
+				if err != nil {
+					t.Fatalf("%s record %d field %s: %v", name, i, m.Schema.FieldName(fi), err)
+				}
+				if wantStr != want {
+					t.Fatalf("%s record %d field %s: NewDBCFromFile %q, string block %q", name, i, m.Schema.FieldName(fi), want, wantStr)
+				}
+				if got, err := r.String(fi); err != nil || got != wantStr {
+					t.Fatalf("%s record %d field %s: mapped %q (err %v), string block %q", name, i, m.Schema.FieldName(fi), got, err, wantStr)
+				}
+			}
+		}
+		m.Close()
+
+		// The exporter before the compact string block wrote empty strings at the offset right past the end of the
+		// string block, none of the shipped DBCs have one so every string field of the first record is pointed there
+		for fi, f := range m.Schema.Fields {
+			if f.Type == DBCSchemaFieldStringOffset {
+				binary.LittleEndian.PutUint32(raw[validDBCRecordStartOffset+int(m.fieldOffsets[fi]):], m.Header.StringBlockSize)
+			}
+		}
+		endPath := filepath.Join(t.TempDir(), name+".dbc")
+		if err = os.WriteFile(endPath, raw, 0o644); err != nil {
+			t.Fatal(err)
+		}
+		m, err = OpenMappedDBC(endPath, schemaPath)
+		if err != nil {
+			t.Fatal(err)
+		}
+		for fi, f := range m.Schema.Fields {
+			if f.Type != DBCSchemaFieldStringOffset {
+				continue
+			}
+			if got, err := m.Record(0).String(fi); err != nil || got != "" {
+				t.Fatalf("%s field %s at the end of the string block: mapped %q (err %v), want \"\"", name, m.Schema.FieldName(fi), got, err)
+			}
+		}
+		m.Close()
+	}
+}
+
+func BenchmarkDBCRead(b *testing.B) {
+	dir := b.TempDir()
+	for _, bd := range benchDBCs {
+		dbcPath, schemaPath := writeBenchDBC(b, dir, bd.name, bd.recordCount)
+
+		// The mapped view has to decode to exactly what NewDBCFromFile does
+		d, err := NewDBCFromFile(dbcPath, schemaPath)
+		if err != nil {
+			b.Fatal(err)
+		}
+		m, err := OpenMappedDBC(dbcPath, schemaPath)
+		if err != nil {
+			b.Fatal(err)
+		}
+		for i, row := range d.Data {
+			r := m.Record(i)
+			for fi, want := range row {
+				if got, err := r.Value(fi); err != nil || got != want {
+					b.Fatalf("%s record %d field %s: mapped %v (err %v), NewDBCFromFile %v", bd.name, i, m.Schema.FieldName(fi), got, err, want)
+				}
+			}
+		}
+		m.Close()
+
+		b.Run(bd.name+"/NewDBCFromFile", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := NewDBCFromFile(dbcPath, schemaPath); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run(bd.name+"/OpenMappedDBC", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				m, err := OpenMappedDBC(dbcPath, schemaPath)
+				if err != nil {
+					b.Fatal(err)
+				}
+				m.Close()
+			}
+		})
+		b.Run(bd.name+"/OpenMappedDBCReadAll", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				m, err := OpenMappedDBC(dbcPath, schemaPath)
+				if err != nil {
+					b.Fatal(err)
+				}
+				if _, err = readAllMapped(m); err != nil {
+					b.Fatal(err)
+				}
+				m.Close()
+			}
+		})
+	}
+}
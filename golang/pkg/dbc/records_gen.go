@@ -0,0 +1,1744 @@
+// Code generated by dbcstructgen. DO NOT EDIT.
+
+package dbc
+
+import (
+	"encoding/binary"
+	"math"
+
+	"github.com/pkg/errors"
+)
+
+// ItemRandomPropertiesRecord is a record of ItemRandomProperties.dbc, generated from ItemRandomProperties.dbc.json
+type ItemRandomPropertiesRecord struct {
+	ID             int32
+	Name           string
+	Enchantment_1  int32
+	Enchantment_2  int32
+	Enchantment_3  int32
+	Enchantment_4  int32
+	Enchantment_5  int32
+	Name_Lang_enUS string
+	Name_Lang_enGB string
+	Name_Lang_koKR string
+	Name_Lang_frFR string
+	Name_Lang_deDE string
+	Name_Lang_enCN string
+	Name_Lang_zhCN string
+	Name_Lang_enTW string
+	Name_Lang_zhTW string
+	Name_Lang_esES string
+	Name_Lang_esMX string
+	Name_Lang_ruRU string
+	Name_Lang_ptPT string
+	Name_Lang_ptBR string
+	Name_Lang_itIT string
+	Name_Lang_Unk  string
+	Name_Lang_Mask uint32
+}
+
+const ItemRandomPropertiesRecordSize = 96
+
+var ItemRandomPropertiesSchema = DBCSchema{Fields: []DBCSchemaField{
+	{Type: DBCSchemaFieldInt32, Name: "ID"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_1"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_2"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_3"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_4"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_5"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "Name_Lang_Mask"},
+}}
+
+func (ItemRandomPropertiesRecord) dbcSchema() DBCSchema { return ItemRandomPropertiesSchema }
+
+func (r *ItemRandomPropertiesRecord) decodeDBC(b []byte, stringBlock []byte) (err error) {
+	_ = b[ItemRandomPropertiesRecordSize-1]
+	r.ID = int32(binary.LittleEndian.Uint32(b[0:]))
+	if r.Name, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[4:])); err != nil {
+		return errors.Wrap(err, "field Name")
+	}
+	r.Enchantment_1 = int32(binary.LittleEndian.Uint32(b[8:]))
+	r.Enchantment_2 = int32(binary.LittleEndian.Uint32(b[12:]))
+	r.Enchantment_3 = int32(binary.LittleEndian.Uint32(b[16:]))
+	r.Enchantment_4 = int32(binary.LittleEndian.Uint32(b[20:]))
+	r.Enchantment_5 = int32(binary.LittleEndian.Uint32(b[24:]))
+	if r.Name_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[28:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enUS")
+	}
+	if r.Name_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[32:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enGB")
+	}
+	if r.Name_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[36:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_koKR")
+	}
+	if r.Name_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[40:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_frFR")
+	}
+	if r.Name_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[44:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_deDE")
+	}
+	if r.Name_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[48:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enCN")
+	}
+	if r.Name_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[52:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhCN")
+	}
+	if r.Name_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[56:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enTW")
+	}
+	if r.Name_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[60:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhTW")
+	}
+	if r.Name_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[64:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esES")
+	}
+	if r.Name_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[68:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esMX")
+	}
+	if r.Name_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[72:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ruRU")
+	}
+	if r.Name_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[76:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptPT")
+	}
+	if r.Name_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[80:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptBR")
+	}
+	if r.Name_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[84:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_itIT")
+	}
+	if r.Name_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[88:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_Unk")
+	}
+	r.Name_Lang_Mask = binary.LittleEndian.Uint32(b[92:])
+	return nil
+}
+
+func (r ItemRandomPropertiesRecord) visitDBCStrings(visit func(str string)) {
+	visit(r.Name)
+	visit(r.Name_Lang_enUS)
+	visit(r.Name_Lang_enGB)
+	visit(r.Name_Lang_koKR)
+	visit(r.Name_Lang_frFR)
+	visit(r.Name_Lang_deDE)
+	visit(r.Name_Lang_enCN)
+	visit(r.Name_Lang_zhCN)
+	visit(r.Name_Lang_enTW)
+	visit(r.Name_Lang_zhTW)
+	visit(r.Name_Lang_esES)
+	visit(r.Name_Lang_esMX)
+	visit(r.Name_Lang_ruRU)
+	visit(r.Name_Lang_ptPT)
+	visit(r.Name_Lang_ptBR)
+	visit(r.Name_Lang_itIT)
+	visit(r.Name_Lang_Unk)
+}
+
+func (r ItemRandomPropertiesRecord) encodeDBC(b []byte, strs stringOffsetter) {
+	_ = b[ItemRandomPropertiesRecordSize-1]
+	binary.LittleEndian.PutUint32(b[0:], uint32(r.ID))
+	binary.LittleEndian.PutUint32(b[4:], strs.Offset(r.Name))
+	binary.LittleEndian.PutUint32(b[8:], uint32(r.Enchantment_1))
+	binary.LittleEndian.PutUint32(b[12:], uint32(r.Enchantment_2))
+	binary.LittleEndian.PutUint32(b[16:], uint32(r.Enchantment_3))
+	binary.LittleEndian.PutUint32(b[20:], uint32(r.Enchantment_4))
+	binary.LittleEndian.PutUint32(b[24:], uint32(r.Enchantment_5))
+	binary.LittleEndian.PutUint32(b[28:], strs.Offset(r.Name_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[32:], strs.Offset(r.Name_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[36:], strs.Offset(r.Name_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[40:], strs.Offset(r.Name_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[44:], strs.Offset(r.Name_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[48:], strs.Offset(r.Name_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[52:], strs.Offset(r.Name_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[56:], strs.Offset(r.Name_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[60:], strs.Offset(r.Name_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[64:], strs.Offset(r.Name_Lang_esES))
+	binary.LittleEndian.PutUint32(b[68:], strs.Offset(r.Name_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[72:], strs.Offset(r.Name_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[76:], strs.Offset(r.Name_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[80:], strs.Offset(r.Name_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[84:], strs.Offset(r.Name_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[88:], strs.Offset(r.Name_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[92:], r.Name_Lang_Mask)
+}
+
+// ItemRandomSuffixRecord is a record of ItemRandomSuffix.dbc, generated from ItemRandomSuffix.dbc.json
+type ItemRandomSuffixRecord struct {
+	ID              int32
+	Name_Lang_enUS  string
+	Name_Lang_enGB  string
+	Name_Lang_koKR  string
+	Name_Lang_frFR  string
+	Name_Lang_deDE  string
+	Name_Lang_enCN  string
+	Name_Lang_zhCN  string
+	Name_Lang_enTW  string
+	Name_Lang_zhTW  string
+	Name_Lang_esES  string
+	Name_Lang_esMX  string
+	Name_Lang_ruRU  string
+	Name_Lang_ptPT  string
+	Name_Lang_ptBR  string
+	Name_Lang_itIT  string
+	Name_Lang_Unk   string
+	Name_Lang_Mask  uint32
+	InternalName    string
+	Enchantment_1   int32
+	Enchantment_2   int32
+	Enchantment_3   int32
+	Enchantment_4   int32
+	Enchantment_5   int32
+	AllocationPct_1 int32
+	AllocationPct_2 int32
+	AllocationPct_3 int32
+	AllocationPct_4 int32
+	AllocationPct_5 int32
+}
+
+const ItemRandomSuffixRecordSize = 116
+
+var ItemRandomSuffixSchema = DBCSchema{Fields: []DBCSchemaField{
+	{Type: DBCSchemaFieldInt32, Name: "ID"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "Name_Lang_Mask"},
+	{Type: DBCSchemaFieldStringOffset, Name: "InternalName"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_1"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_2"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_3"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_4"},
+	{Type: DBCSchemaFieldInt32, Name: "Enchantment_5"},
+	{Type: DBCSchemaFieldInt32, Name: "AllocationPct_1"},
+	{Type: DBCSchemaFieldInt32, Name: "AllocationPct_2"},
+	{Type: DBCSchemaFieldInt32, Name: "AllocationPct_3"},
+	{Type: DBCSchemaFieldInt32, Name: "AllocationPct_4"},
+	{Type: DBCSchemaFieldInt32, Name: "AllocationPct_5"},
+}}
+
+func (ItemRandomSuffixRecord) dbcSchema() DBCSchema { return ItemRandomSuffixSchema }
+
+func (r *ItemRandomSuffixRecord) decodeDBC(b []byte, stringBlock []byte) (err error) {
+	_ = b[ItemRandomSuffixRecordSize-1]
+	r.ID = int32(binary.LittleEndian.Uint32(b[0:]))
+	if r.Name_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[4:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enUS")
+	}
+	if r.Name_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[8:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enGB")
+	}
+	if r.Name_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[12:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_koKR")
+	}
+	if r.Name_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[16:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_frFR")
+	}
+	if r.Name_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[20:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_deDE")
+	}
+	if r.Name_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[24:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enCN")
+	}
+	if r.Name_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[28:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhCN")
+	}
+	if r.Name_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[32:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enTW")
+	}
+	if r.Name_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[36:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhTW")
+	}
+	if r.Name_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[40:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esES")
+	}
+	if r.Name_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[44:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esMX")
+	}
+	if r.Name_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[48:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ruRU")
+	}
+	if r.Name_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[52:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptPT")
+	}
+	if r.Name_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[56:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptBR")
+	}
+	if r.Name_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[60:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_itIT")
+	}
+	if r.Name_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[64:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_Unk")
+	}
+	r.Name_Lang_Mask = binary.LittleEndian.Uint32(b[68:])
+	if r.InternalName, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[72:])); err != nil {
+		return errors.Wrap(err, "field InternalName")
+	}
+	r.Enchantment_1 = int32(binary.LittleEndian.Uint32(b[76:]))
+	r.Enchantment_2 = int32(binary.LittleEndian.Uint32(b[80:]))
+	r.Enchantment_3 = int32(binary.LittleEndian.Uint32(b[84:]))
+	r.Enchantment_4 = int32(binary.LittleEndian.Uint32(b[88:]))
+	r.Enchantment_5 = int32(binary.LittleEndian.Uint32(b[92:]))
+	r.AllocationPct_1 = int32(binary.LittleEndian.Uint32(b[96:]))
+	r.AllocationPct_2 = int32(binary.LittleEndian.Uint32(b[100:]))
+	r.AllocationPct_3 = int32(binary.LittleEndian.Uint32(b[104:]))
+	r.AllocationPct_4 = int32(binary.LittleEndian.Uint32(b[108:]))
+	r.AllocationPct_5 = int32(binary.LittleEndian.Uint32(b[112:]))
+	return nil
+}
+
+func (r ItemRandomSuffixRecord) visitDBCStrings(visit func(str string)) {
+	visit(r.Name_Lang_enUS)
+	visit(r.Name_Lang_enGB)
+	visit(r.Name_Lang_koKR)
+	visit(r.Name_Lang_frFR)
+	visit(r.Name_Lang_deDE)
+	visit(r.Name_Lang_enCN)
+	visit(r.Name_Lang_zhCN)
+	visit(r.Name_Lang_enTW)
+	visit(r.Name_Lang_zhTW)
+	visit(r.Name_Lang_esES)
+	visit(r.Name_Lang_esMX)
+	visit(r.Name_Lang_ruRU)
+	visit(r.Name_Lang_ptPT)
+	visit(r.Name_Lang_ptBR)
+	visit(r.Name_Lang_itIT)
+	visit(r.Name_Lang_Unk)
+	visit(r.InternalName)
+}
+
+func (r ItemRandomSuffixRecord) encodeDBC(b []byte, strs stringOffsetter) {
+	_ = b[ItemRandomSuffixRecordSize-1]
+	binary.LittleEndian.PutUint32(b[0:], uint32(r.ID))
+	binary.LittleEndian.PutUint32(b[4:], strs.Offset(r.Name_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[8:], strs.Offset(r.Name_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[12:], strs.Offset(r.Name_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[16:], strs.Offset(r.Name_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[20:], strs.Offset(r.Name_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[24:], strs.Offset(r.Name_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[28:], strs.Offset(r.Name_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[32:], strs.Offset(r.Name_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[36:], strs.Offset(r.Name_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[40:], strs.Offset(r.Name_Lang_esES))
+	binary.LittleEndian.PutUint32(b[44:], strs.Offset(r.Name_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[48:], strs.Offset(r.Name_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[52:], strs.Offset(r.Name_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[56:], strs.Offset(r.Name_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[60:], strs.Offset(r.Name_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[64:], strs.Offset(r.Name_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[68:], r.Name_Lang_Mask)
+	binary.LittleEndian.PutUint32(b[72:], strs.Offset(r.InternalName))
+	binary.LittleEndian.PutUint32(b[76:], uint32(r.Enchantment_1))
+	binary.LittleEndian.PutUint32(b[80:], uint32(r.Enchantment_2))
+	binary.LittleEndian.PutUint32(b[84:], uint32(r.Enchantment_3))
+	binary.LittleEndian.PutUint32(b[88:], uint32(r.Enchantment_4))
+	binary.LittleEndian.PutUint32(b[92:], uint32(r.Enchantment_5))
+	binary.LittleEndian.PutUint32(b[96:], uint32(r.AllocationPct_1))
+	binary.LittleEndian.PutUint32(b[100:], uint32(r.AllocationPct_2))
+	binary.LittleEndian.PutUint32(b[104:], uint32(r.AllocationPct_3))
+	binary.LittleEndian.PutUint32(b[108:], uint32(r.AllocationPct_4))
+	binary.LittleEndian.PutUint32(b[112:], uint32(r.AllocationPct_5))
+}
+
+// SpellRecord is a record of Spell.dbc, generated from Spell.dbc.json
+type SpellRecord struct {
+	ID                         int32
+	Category                   uint32
+	DispelType                 uint32
+	Mechanic                   uint32
+	Attributes                 uint32
+	AttributesEx               uint32
+	AttributesEx2              uint32
+	AttributesEx3              uint32
+	AttributesEx4              uint32
+	AttributesEx5              uint32
+	AttributesEx6              uint32
+	AttributesEx7              uint32
+	ShapeshiftMask             uint32
+	Unk_320_2                  int32
+	ShapeshiftExclude          uint32
+	Unk_320_3                  int32
+	Targets                    uint32
+	TargetCreatureType         uint32
+	RequiresSpellFocus         uint32
+	FacingCasterFlags          uint32
+	CasterAuraState            uint32
+	TargetAuraState            uint32
+	ExcludeCasterAuraState     uint32
+	ExcludeTargetAuraState     uint32
+	CasterAuraSpell            uint32
+	TargetAuraSpell            uint32
+	ExcludeCasterAuraSpell     uint32
+	ExcludeTargetAuraSpell     uint32
+	CastingTimeIndex           uint32
+	RecoveryTime               uint32
+	CategoryRecoveryTime       uint32
+	InterruptFlags             uint32
+	AuraInterruptFlags         uint32
+	ChannelInterruptFlags      uint32
+	ProcTypeMask               uint32
+	ProcChance                 uint32
+	ProcCharges                uint32
+	MaxLevel                   uint32
+	BaseLevel                  uint32
+	SpellLevel                 uint32
+	DurationIndex              uint32
+	PowerType                  int32
+	ManaCost                   uint32
+	ManaCostPerLevel           uint32
+	ManaPerSecond              uint32
+	ManaPerSecondPerLevel      uint32
+	RangeIndex                 uint32
+	Speed                      float32
+	ModalNextSpell             uint32
+	CumulativeAura             uint32
+	Totem_1                    uint32
+	Totem_2                    uint32
+	Reagent_1                  int32
+	Reagent_2                  int32
+	Reagent_3                  int32
+	Reagent_4                  int32
+	Reagent_5                  int32
+	Reagent_6                  int32
+	Reagent_7                  int32
+	Reagent_8                  int32
+	ReagentCount_1             int32
+	ReagentCount_2             int32
+	ReagentCount_3             int32
+	ReagentCount_4             int32
+	ReagentCount_5             int32
+	ReagentCount_6             int32
+	ReagentCount_7             int32
+	ReagentCount_8             int32
+	EquippedItemClass          int32
+	EquippedItemSubclass       int32
+	EquippedItemInvTypes       int32
+	Effect_1                   uint32
+	Effect_2                   uint32
+	Effect_3                   uint32
+	EffectDieSides_1           int32
+	EffectDieSides_2           int32
+	EffectDieSides_3           int32
+	EffectRealPointsPerLevel_1 float32
+	EffectRealPointsPerLevel_2 float32
+	EffectRealPointsPerLevel_3 float32
+	EffectBasePoints_1         int32
+	EffectBasePoints_2         int32
+	EffectBasePoints_3         int32
+	EffectMechanic_1           uint32
+	EffectMechanic_2           uint32
+	EffectMechanic_3           uint32
+	ImplicitTargetA_1          uint32
+	ImplicitTargetA_2          uint32
+	ImplicitTargetA_3          uint32
+	ImplicitTargetB_1          uint32
+	ImplicitTargetB_2          uint32
+	ImplicitTargetB_3          uint32
+	EffectRadiusIndex_1        uint32
+	EffectRadiusIndex_2        uint32
+	EffectRadiusIndex_3        uint32
+	EffectAura_1               uint32
+	EffectAura_2               uint32
+	EffectAura_3               uint32
+	EffectAuraPeriod_1         uint32
+	EffectAuraPeriod_2         uint32
+	EffectAuraPeriod_3         uint32
+	EffectMultipleValue_1      float32
+	EffectMultipleValue_2      float32
+	EffectMultipleValue_3      float32
+	EffectChainTargets_1       uint32
+	EffectChainTargets_2       uint32
+	EffectChainTargets_3       uint32
+	EffectItemType_1           uint32
+	EffectItemType_2           uint32
+	EffectItemType_3           uint32
+	EffectMiscValue_1          int32
+	EffectMiscValue_2          int32
+	EffectMiscValue_3          int32
+	EffectMiscValueB_1         int32
+	EffectMiscValueB_2         int32
+	EffectMiscValueB_3         int32
+	EffectTriggerSpell_1       uint32
+	EffectTriggerSpell_2       uint32
+	EffectTriggerSpell_3       uint32
+	EffectPointsPerCombo_1     float32
+	EffectPointsPerCombo_2     float32
+	EffectPointsPerCombo_3     float32
+	EffectSpellClassMaskA_1    uint32
+	EffectSpellClassMaskA_2    uint32
+	EffectSpellClassMaskA_3    uint32
+	EffectSpellClassMaskB_1    uint32
+	EffectSpellClassMaskB_2    uint32
+	EffectSpellClassMaskB_3    uint32
+	EffectSpellClassMaskC_1    uint32
+	EffectSpellClassMaskC_2    uint32
+	EffectSpellClassMaskC_3    uint32
+	SpellVisualID_1            uint32
+	SpellVisualID_2            uint32
+	SpellIconID                uint32
+	ActiveIconID               uint32
+	SpellPriority              uint32
+	Name_Lang_enUS             string
+	Name_Lang_enGB             string
+	Name_Lang_koKR             string
+	Name_Lang_frFR             string
+	Name_Lang_deDE             string
+	Name_Lang_enCN             string
+	Name_Lang_zhCN             string
+	Name_Lang_enTW             string
+	Name_Lang_zhTW             string
+	Name_Lang_esES             string
+	Name_Lang_esMX             string
+	Name_Lang_ruRU             string
+	Name_Lang_ptPT             string
+	Name_Lang_ptBR             string
+	Name_Lang_itIT             string
+	Name_Lang_Unk              string
+	Name_Lang_Mask             uint32
+	NameSubtext_Lang_enUS      string
+	NameSubtext_Lang_enGB      string
+	NameSubtext_Lang_koKR      string
+	NameSubtext_Lang_frFR      string
+	NameSubtext_Lang_deDE      string
+	NameSubtext_Lang_enCN      string
+	NameSubtext_Lang_zhCN      string
+	NameSubtext_Lang_enTW      string
+	NameSubtext_Lang_zhTW      string
+	NameSubtext_Lang_esES      string
+	NameSubtext_Lang_esMX      string
+	NameSubtext_Lang_ruRU      string
+	NameSubtext_Lang_ptPT      string
+	NameSubtext_Lang_ptBR      string
+	NameSubtext_Lang_itIT      string
+	NameSubtext_Lang_Unk       string
+	NameSubtext_Lang_Mask      uint32
+	Description_Lang_enUS      string
+	Description_Lang_enGB      string
+	Description_Lang_koKR      string
+	Description_Lang_frFR      string
+	Description_Lang_deDE      string
+	Description_Lang_enCN      string
+	Description_Lang_zhCN      string
+	Description_Lang_enTW      string
+	Description_Lang_zhTW      string
+	Description_Lang_esES      string
+	Description_Lang_esMX      string
+	Description_Lang_ruRU      string
+	Description_Lang_ptPT      string
+	Description_Lang_ptBR      string
+	Description_Lang_itIT      string
+	Description_Lang_Unk       string
+	Description_Lang_Mask      uint32
+	AuraDescription_Lang_enUS  string
+	AuraDescription_Lang_enGB  string
+	AuraDescription_Lang_koKR  string
+	AuraDescription_Lang_frFR  string
+	AuraDescription_Lang_deDE  string
+	AuraDescription_Lang_enCN  string
+	AuraDescription_Lang_zhCN  string
+	AuraDescription_Lang_enTW  string
+	AuraDescription_Lang_zhTW  string
+	AuraDescription_Lang_esES  string
+	AuraDescription_Lang_esMX  string
+	AuraDescription_Lang_ruRU  string
+	AuraDescription_Lang_ptPT  string
+	AuraDescription_Lang_ptBR  string
+	AuraDescription_Lang_itIT  string
+	AuraDescription_Lang_Unk   string
+	AuraDescription_Lang_Mask  uint32
+	ManaCostPct                uint32
+	StartRecoveryCategory      uint32
+	StartRecoveryTime          uint32
+	MaxTargetLevel             uint32
+	SpellClassSet              uint32
+	SpellClassMask_1           uint32
+	SpellClassMask_2           uint32
+	SpellClassMask_3           uint32
+	MaxTargets                 uint32
+	DefenseType                uint32
+	PreventionType             uint32
+	StanceBarOrder             uint32
+	EffectChainAmplitude_1     float32
+	EffectChainAmplitude_2     float32
+	EffectChainAmplitude_3     float32
+	MinFactionID               uint32
+	MinReputation              uint32
+	RequiredAuraVision         uint32
+	RequiredTotemCategoryID_1  uint32
+	RequiredTotemCategoryID_2  uint32
+	RequiredAreasID            int32
+	SchoolMask                 uint32
+	RuneCostID                 uint32
+	SpellMissileID             uint32
+	PowerDisplayID             int32
+	EffectBonusMultiplier_1    float32
+	EffectBonusMultiplier_2    float32
+	EffectBonusMultiplier_3    float32
+	SpellDescriptionVariableID uint32
+	SpellDifficultyID          uint32
+}
+
+const SpellRecordSize = 936
+
+var SpellSchema = DBCSchema{Fields: []DBCSchemaField{
+	{Type: DBCSchemaFieldInt32, Name: "ID"},
+	{Type: DBCSchemaFieldUint32, Name: "Category"},
+	{Type: DBCSchemaFieldUint32, Name: "DispelType"},
+	{Type: DBCSchemaFieldUint32, Name: "Mechanic"},
+	{Type: DBCSchemaFieldUint32, Name: "Attributes"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx2"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx3"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx4"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx5"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx6"},
+	{Type: DBCSchemaFieldUint32, Name: "AttributesEx7"},
+	{Type: DBCSchemaFieldUint32, Name: "ShapeshiftMask"},
+	{Type: DBCSchemaFieldInt32, Name: "unk_320_2"},
+	{Type: DBCSchemaFieldUint32, Name: "ShapeshiftExclude"},
+	{Type: DBCSchemaFieldInt32, Name: "unk_320_3"},
+	{Type: DBCSchemaFieldUint32, Name: "Targets"},
+	{Type: DBCSchemaFieldUint32, Name: "TargetCreatureType"},
+	{Type: DBCSchemaFieldUint32, Name: "RequiresSpellFocus"},
+	{Type: DBCSchemaFieldUint32, Name: "FacingCasterFlags"},
+	{Type: DBCSchemaFieldUint32, Name: "CasterAuraState"},
+	{Type: DBCSchemaFieldUint32, Name: "TargetAuraState"},
+	{Type: DBCSchemaFieldUint32, Name: "ExcludeCasterAuraState"},
+	{Type: DBCSchemaFieldUint32, Name: "ExcludeTargetAuraState"},
+	{Type: DBCSchemaFieldUint32, Name: "CasterAuraSpell"},
+	{Type: DBCSchemaFieldUint32, Name: "TargetAuraSpell"},
+	{Type: DBCSchemaFieldUint32, Name: "ExcludeCasterAuraSpell"},
+	{Type: DBCSchemaFieldUint32, Name: "ExcludeTargetAuraSpell"},
+	{Type: DBCSchemaFieldUint32, Name: "CastingTimeIndex"},
+	{Type: DBCSchemaFieldUint32, Name: "RecoveryTime"},
+	{Type: DBCSchemaFieldUint32, Name: "CategoryRecoveryTime"},
+	{Type: DBCSchemaFieldUint32, Name: "InterruptFlags"},
+	{Type: DBCSchemaFieldUint32, Name: "AuraInterruptFlags"},
+	{Type: DBCSchemaFieldUint32, Name: "ChannelInterruptFlags"},
+	{Type: DBCSchemaFieldUint32, Name: "ProcTypeMask"},
+	{Type: DBCSchemaFieldUint32, Name: "ProcChance"},
+	{Type: DBCSchemaFieldUint32, Name: "ProcCharges"},
+	{Type: DBCSchemaFieldUint32, Name: "MaxLevel"},
+	{Type: DBCSchemaFieldUint32, Name: "BaseLevel"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellLevel"},
+	{Type: DBCSchemaFieldUint32, Name: "DurationIndex"},
+	{Type: DBCSchemaFieldInt32, Name: "PowerType"},
+	{Type: DBCSchemaFieldUint32, Name: "ManaCost"},
+	{Type: DBCSchemaFieldUint32, Name: "ManaCostPerLevel"},
+	{Type: DBCSchemaFieldUint32, Name: "ManaPerSecond"},
+	{Type: DBCSchemaFieldUint32, Name: "ManaPerSecondPerLevel"},
+	{Type: DBCSchemaFieldUint32, Name: "RangeIndex"},
+	{Type: DBCSchemaFieldFloat32, Name: "Speed"},
+	{Type: DBCSchemaFieldUint32, Name: "ModalNextSpell"},
+	{Type: DBCSchemaFieldUint32, Name: "CumulativeAura"},
+	{Type: DBCSchemaFieldUint32, Name: "Totem_1"},
+	{Type: DBCSchemaFieldUint32, Name: "Totem_2"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_1"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_2"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_3"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_4"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_5"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_6"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_7"},
+	{Type: DBCSchemaFieldInt32, Name: "Reagent_8"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_1"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_2"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_3"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_4"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_5"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_6"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_7"},
+	{Type: DBCSchemaFieldInt32, Name: "ReagentCount_8"},
+	{Type: DBCSchemaFieldInt32, Name: "EquippedItemClass"},
+	{Type: DBCSchemaFieldInt32, Name: "EquippedItemSubclass"},
+	{Type: DBCSchemaFieldInt32, Name: "EquippedItemInvTypes"},
+	{Type: DBCSchemaFieldUint32, Name: "Effect_1"},
+	{Type: DBCSchemaFieldUint32, Name: "Effect_2"},
+	{Type: DBCSchemaFieldUint32, Name: "Effect_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectDieSides_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectDieSides_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectDieSides_3"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectRealPointsPerLevel_1"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectRealPointsPerLevel_2"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectRealPointsPerLevel_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectBasePoints_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectBasePoints_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectBasePoints_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectMechanic_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectMechanic_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectMechanic_3"},
+	{Type: DBCSchemaFieldUint32, Name: "ImplicitTargetA_1"},
+	{Type: DBCSchemaFieldUint32, Name: "ImplicitTargetA_2"},
+	{Type: DBCSchemaFieldUint32, Name: "ImplicitTargetA_3"},
+	{Type: DBCSchemaFieldUint32, Name: "ImplicitTargetB_1"},
+	{Type: DBCSchemaFieldUint32, Name: "ImplicitTargetB_2"},
+	{Type: DBCSchemaFieldUint32, Name: "ImplicitTargetB_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectRadiusIndex_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectRadiusIndex_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectRadiusIndex_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectAura_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectAura_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectAura_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectAuraPeriod_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectAuraPeriod_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectAuraPeriod_3"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectMultipleValue_1"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectMultipleValue_2"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectMultipleValue_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectChainTargets_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectChainTargets_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectChainTargets_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectItemType_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectItemType_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectItemType_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectMiscValue_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectMiscValue_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectMiscValue_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectMiscValueB_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectMiscValueB_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectMiscValueB_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectTriggerSpell_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectTriggerSpell_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectTriggerSpell_3"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectPointsPerCombo_1"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectPointsPerCombo_2"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectPointsPerCombo_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskA_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskA_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskA_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskB_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskB_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskB_3"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskC_1"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskC_2"},
+	{Type: DBCSchemaFieldUint32, Name: "EffectSpellClassMaskC_3"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellVisualID_1"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellVisualID_2"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellIconID"},
+	{Type: DBCSchemaFieldUint32, Name: "ActiveIconID"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellPriority"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "Name_Lang_Mask"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "NameSubtext_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "NameSubtext_Lang_Mask"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Description_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "Description_Lang_Mask"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "AuraDescription_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "AuraDescription_Lang_Mask"},
+	{Type: DBCSchemaFieldUint32, Name: "ManaCostPct"},
+	{Type: DBCSchemaFieldUint32, Name: "StartRecoveryCategory"},
+	{Type: DBCSchemaFieldUint32, Name: "StartRecoveryTime"},
+	{Type: DBCSchemaFieldUint32, Name: "MaxTargetLevel"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellClassSet"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellClassMask_1"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellClassMask_2"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellClassMask_3"},
+	{Type: DBCSchemaFieldUint32, Name: "MaxTargets"},
+	{Type: DBCSchemaFieldUint32, Name: "DefenseType"},
+	{Type: DBCSchemaFieldUint32, Name: "PreventionType"},
+	{Type: DBCSchemaFieldUint32, Name: "StanceBarOrder"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectChainAmplitude_1"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectChainAmplitude_2"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectChainAmplitude_3"},
+	{Type: DBCSchemaFieldUint32, Name: "MinFactionID"},
+	{Type: DBCSchemaFieldUint32, Name: "MinReputation"},
+	{Type: DBCSchemaFieldUint32, Name: "RequiredAuraVision"},
+	{Type: DBCSchemaFieldUint32, Name: "RequiredTotemCategoryID_1"},
+	{Type: DBCSchemaFieldUint32, Name: "RequiredTotemCategoryID_2"},
+	{Type: DBCSchemaFieldInt32, Name: "RequiredAreasID"},
+	{Type: DBCSchemaFieldUint32, Name: "SchoolMask"},
+	{Type: DBCSchemaFieldUint32, Name: "RuneCostID"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellMissileID"},
+	{Type: DBCSchemaFieldInt32, Name: "PowerDisplayID"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectBonusMultiplier_1"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectBonusMultiplier_2"},
+	{Type: DBCSchemaFieldFloat32, Name: "EffectBonusMultiplier_3"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellDescriptionVariableID"},
+	{Type: DBCSchemaFieldUint32, Name: "SpellDifficultyID"},
+}}
+
+func (SpellRecord) dbcSchema() DBCSchema { return SpellSchema }
+
+func (r *SpellRecord) decodeDBC(b []byte, stringBlock []byte) (err error) {
+	_ = b[SpellRecordSize-1]
+	r.ID = int32(binary.LittleEndian.Uint32(b[0:]))
+	r.Category = binary.LittleEndian.Uint32(b[4:])
+	r.DispelType = binary.LittleEndian.Uint32(b[8:])
+	r.Mechanic = binary.LittleEndian.Uint32(b[12:])
+	r.Attributes = binary.LittleEndian.Uint32(b[16:])
+	r.AttributesEx = binary.LittleEndian.Uint32(b[20:])
+	r.AttributesEx2 = binary.LittleEndian.Uint32(b[24:])
+	r.AttributesEx3 = binary.LittleEndian.Uint32(b[28:])
+	r.AttributesEx4 = binary.LittleEndian.Uint32(b[32:])
+	r.AttributesEx5 = binary.LittleEndian.Uint32(b[36:])
+	r.AttributesEx6 = binary.LittleEndian.Uint32(b[40:])
+	r.AttributesEx7 = binary.LittleEndian.Uint32(b[44:])
+	r.ShapeshiftMask = binary.LittleEndian.Uint32(b[48:])
+	r.Unk_320_2 = int32(binary.LittleEndian.Uint32(b[52:]))
+	r.ShapeshiftExclude = binary.LittleEndian.Uint32(b[56:])
+	r.Unk_320_3 = int32(binary.LittleEndian.Uint32(b[60:]))
+	r.Targets = binary.LittleEndian.Uint32(b[64:])
+	r.TargetCreatureType = binary.LittleEndian.Uint32(b[68:])
+	r.RequiresSpellFocus = binary.LittleEndian.Uint32(b[72:])
+	r.FacingCasterFlags = binary.LittleEndian.Uint32(b[76:])
+	r.CasterAuraState = binary.LittleEndian.Uint32(b[80:])
+	r.TargetAuraState = binary.LittleEndian.Uint32(b[84:])
+	r.ExcludeCasterAuraState = binary.LittleEndian.Uint32(b[88:])
+	r.ExcludeTargetAuraState = binary.LittleEndian.Uint32(b[92:])
+	r.CasterAuraSpell = binary.LittleEndian.Uint32(b[96:])
+	r.TargetAuraSpell = binary.LittleEndian.Uint32(b[100:])
+	r.ExcludeCasterAuraSpell = binary.LittleEndian.Uint32(b[104:])
+	r.ExcludeTargetAuraSpell = binary.LittleEndian.Uint32(b[108:])
+	r.CastingTimeIndex = binary.LittleEndian.Uint32(b[112:])
+	r.RecoveryTime = binary.LittleEndian.Uint32(b[116:])
+	r.CategoryRecoveryTime = binary.LittleEndian.Uint32(b[120:])
+	r.InterruptFlags = binary.LittleEndian.Uint32(b[124:])
+	r.AuraInterruptFlags = binary.LittleEndian.Uint32(b[128:])
+	r.ChannelInterruptFlags = binary.LittleEndian.Uint32(b[132:])
+	r.ProcTypeMask = binary.LittleEndian.Uint32(b[136:])
+	r.ProcChance = binary.LittleEndian.Uint32(b[140:])
+	r.ProcCharges = binary.LittleEndian.Uint32(b[144:])
+	r.MaxLevel = binary.LittleEndian.Uint32(b[148:])
+	r.BaseLevel = binary.LittleEndian.Uint32(b[152:])
+	r.SpellLevel = binary.LittleEndian.Uint32(b[156:])
+	r.DurationIndex = binary.LittleEndian.Uint32(b[160:])
+	r.PowerType = int32(binary.LittleEndian.Uint32(b[164:]))
+	r.ManaCost = binary.LittleEndian.Uint32(b[168:])
+	r.ManaCostPerLevel = binary.LittleEndian.Uint32(b[172:])
+	r.ManaPerSecond = binary.LittleEndian.Uint32(b[176:])
+	r.ManaPerSecondPerLevel = binary.LittleEndian.Uint32(b[180:])
+	r.RangeIndex = binary.LittleEndian.Uint32(b[184:])
+	r.Speed = math.Float32frombits(binary.LittleEndian.Uint32(b[188:]))
+	r.ModalNextSpell = binary.LittleEndian.Uint32(b[192:])
+	r.CumulativeAura = binary.LittleEndian.Uint32(b[196:])
+	r.Totem_1 = binary.LittleEndian.Uint32(b[200:])
+	r.Totem_2 = binary.LittleEndian.Uint32(b[204:])
+	r.Reagent_1 = int32(binary.LittleEndian.Uint32(b[208:]))
+	r.Reagent_2 = int32(binary.LittleEndian.Uint32(b[212:]))
+	r.Reagent_3 = int32(binary.LittleEndian.Uint32(b[216:]))
+	r.Reagent_4 = int32(binary.LittleEndian.Uint32(b[220:]))
+	r.Reagent_5 = int32(binary.LittleEndian.Uint32(b[224:]))
+	r.Reagent_6 = int32(binary.LittleEndian.Uint32(b[228:]))
+	r.Reagent_7 = int32(binary.LittleEndian.Uint32(b[232:]))
+	r.Reagent_8 = int32(binary.LittleEndian.Uint32(b[236:]))
+	r.ReagentCount_1 = int32(binary.LittleEndian.Uint32(b[240:]))
+	r.ReagentCount_2 = int32(binary.LittleEndian.Uint32(b[244:]))
+	r.ReagentCount_3 = int32(binary.LittleEndian.Uint32(b[248:]))
+	r.ReagentCount_4 = int32(binary.LittleEndian.Uint32(b[252:]))
+	r.ReagentCount_5 = int32(binary.LittleEndian.Uint32(b[256:]))
+	r.ReagentCount_6 = int32(binary.LittleEndian.Uint32(b[260:]))
+	r.ReagentCount_7 = int32(binary.LittleEndian.Uint32(b[264:]))
+	r.ReagentCount_8 = int32(binary.LittleEndian.Uint32(b[268:]))
+	r.EquippedItemClass = int32(binary.LittleEndian.Uint32(b[272:]))
+	r.EquippedItemSubclass = int32(binary.LittleEndian.Uint32(b[276:]))
+	r.EquippedItemInvTypes = int32(binary.LittleEndian.Uint32(b[280:]))
+	r.Effect_1 = binary.LittleEndian.Uint32(b[284:])
+	r.Effect_2 = binary.LittleEndian.Uint32(b[288:])
+	r.Effect_3 = binary.LittleEndian.Uint32(b[292:])
+	r.EffectDieSides_1 = int32(binary.LittleEndian.Uint32(b[296:]))
+	r.EffectDieSides_2 = int32(binary.LittleEndian.Uint32(b[300:]))
+	r.EffectDieSides_3 = int32(binary.LittleEndian.Uint32(b[304:]))
+	r.EffectRealPointsPerLevel_1 = math.Float32frombits(binary.LittleEndian.Uint32(b[308:]))
+	r.EffectRealPointsPerLevel_2 = math.Float32frombits(binary.LittleEndian.Uint32(b[312:]))
+	r.EffectRealPointsPerLevel_3 = math.Float32frombits(binary.LittleEndian.Uint32(b[316:]))
+	r.EffectBasePoints_1 = int32(binary.LittleEndian.Uint32(b[320:]))
+	r.EffectBasePoints_2 = int32(binary.LittleEndian.Uint32(b[324:]))
+	r.EffectBasePoints_3 = int32(binary.LittleEndian.Uint32(b[328:]))
+	r.EffectMechanic_1 = binary.LittleEndian.Uint32(b[332:])
+	r.EffectMechanic_2 = binary.LittleEndian.Uint32(b[336:])
+	r.EffectMechanic_3 = binary.LittleEndian.Uint32(b[340:])
+	r.ImplicitTargetA_1 = binary.LittleEndian.Uint32(b[344:])
+	r.ImplicitTargetA_2 = binary.LittleEndian.Uint32(b[348:])
+	r.ImplicitTargetA_3 = binary.LittleEndian.Uint32(b[352:])
+	r.ImplicitTargetB_1 = binary.LittleEndian.Uint32(b[356:])
+	r.ImplicitTargetB_2 = binary.LittleEndian.Uint32(b[360:])
+	r.ImplicitTargetB_3 = binary.LittleEndian.Uint32(b[364:])
+	r.EffectRadiusIndex_1 = binary.LittleEndian.Uint32(b[368:])
+	r.EffectRadiusIndex_2 = binary.LittleEndian.Uint32(b[372:])
+	r.EffectRadiusIndex_3 = binary.LittleEndian.Uint32(b[376:])
+	r.EffectAura_1 = binary.LittleEndian.Uint32(b[380:])
+	r.EffectAura_2 = binary.LittleEndian.Uint32(b[384:])
+	r.EffectAura_3 = binary.LittleEndian.Uint32(b[388:])
+	r.EffectAuraPeriod_1 = binary.LittleEndian.Uint32(b[392:])
+	r.EffectAuraPeriod_2 = binary.LittleEndian.Uint32(b[396:])
+	r.EffectAuraPeriod_3 = binary.LittleEndian.Uint32(b[400:])
+	r.EffectMultipleValue_1 = math.Float32frombits(binary.LittleEndian.Uint32(b[404:]))
+	r.EffectMultipleValue_2 = math.Float32frombits(binary.LittleEndian.Uint32(b[408:]))
+	r.EffectMultipleValue_3 = math.Float32frombits(binary.LittleEndian.Uint32(b[412:]))
+	r.EffectChainTargets_1 = binary.LittleEndian.Uint32(b[416:])
+	r.EffectChainTargets_2 = binary.LittleEndian.Uint32(b[420:])
+	r.EffectChainTargets_3 = binary.LittleEndian.Uint32(b[424:])
+	r.EffectItemType_1 = binary.LittleEndian.Uint32(b[428:])
+	r.EffectItemType_2 = binary.LittleEndian.Uint32(b[432:])
+	r.EffectItemType_3 = binary.LittleEndian.Uint32(b[436:])
+	r.EffectMiscValue_1 = int32(binary.LittleEndian.Uint32(b[440:]))
+	r.EffectMiscValue_2 = int32(binary.LittleEndian.Uint32(b[444:]))
+	r.EffectMiscValue_3 = int32(binary.LittleEndian.Uint32(b[448:]))
+	r.EffectMiscValueB_1 = int32(binary.LittleEndian.Uint32(b[452:]))
+	r.EffectMiscValueB_2 = int32(binary.LittleEndian.Uint32(b[456:]))
+	r.EffectMiscValueB_3 = int32(binary.LittleEndian.Uint32(b[460:]))
+	r.EffectTriggerSpell_1 = binary.LittleEndian.Uint32(b[464:])
+	r.EffectTriggerSpell_2 = binary.LittleEndian.Uint32(b[468:])
+	r.EffectTriggerSpell_3 = binary.LittleEndian.Uint32(b[472:])
+	r.EffectPointsPerCombo_1 = math.Float32frombits(binary.LittleEndian.Uint32(b[476:]))
+	r.EffectPointsPerCombo_2 = math.Float32frombits(binary.LittleEndian.Uint32(b[480:]))
+	r.EffectPointsPerCombo_3 = math.Float32frombits(binary.LittleEndian.Uint32(b[484:]))
+	r.EffectSpellClassMaskA_1 = binary.LittleEndian.Uint32(b[488:])
+	r.EffectSpellClassMaskA_2 = binary.LittleEndian.Uint32(b[492:])
+	r.EffectSpellClassMaskA_3 = binary.LittleEndian.Uint32(b[496:])
+	r.EffectSpellClassMaskB_1 = binary.LittleEndian.Uint32(b[500:])
+	r.EffectSpellClassMaskB_2 = binary.LittleEndian.Uint32(b[504:])
+	r.EffectSpellClassMaskB_3 = binary.LittleEndian.Uint32(b[508:])
+	r.EffectSpellClassMaskC_1 = binary.LittleEndian.Uint32(b[512:])
+	r.EffectSpellClassMaskC_2 = binary.LittleEndian.Uint32(b[516:])
+	r.EffectSpellClassMaskC_3 = binary.LittleEndian.Uint32(b[520:])
+	r.SpellVisualID_1 = binary.LittleEndian.Uint32(b[524:])
+	r.SpellVisualID_2 = binary.LittleEndian.Uint32(b[528:])
+	r.SpellIconID = binary.LittleEndian.Uint32(b[532:])
+	r.ActiveIconID = binary.LittleEndian.Uint32(b[536:])
+	r.SpellPriority = binary.LittleEndian.Uint32(b[540:])
+	if r.Name_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[544:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enUS")
+	}
+	if r.Name_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[548:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enGB")
+	}
+	if r.Name_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[552:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_koKR")
+	}
+	if r.Name_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[556:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_frFR")
+	}
+	if r.Name_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[560:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_deDE")
+	}
+	if r.Name_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[564:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enCN")
+	}
+	if r.Name_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[568:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhCN")
+	}
+	if r.Name_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[572:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enTW")
+	}
+	if r.Name_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[576:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhTW")
+	}
+	if r.Name_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[580:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esES")
+	}
+	if r.Name_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[584:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esMX")
+	}
+	if r.Name_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[588:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ruRU")
+	}
+	if r.Name_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[592:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptPT")
+	}
+	if r.Name_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[596:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptBR")
+	}
+	if r.Name_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[600:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_itIT")
+	}
+	if r.Name_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[604:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_Unk")
+	}
+	r.Name_Lang_Mask = binary.LittleEndian.Uint32(b[608:])
+	if r.NameSubtext_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[612:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_enUS")
+	}
+	if r.NameSubtext_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[616:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_enGB")
+	}
+	if r.NameSubtext_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[620:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_koKR")
+	}
+	if r.NameSubtext_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[624:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_frFR")
+	}
+	if r.NameSubtext_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[628:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_deDE")
+	}
+	if r.NameSubtext_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[632:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_enCN")
+	}
+	if r.NameSubtext_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[636:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_zhCN")
+	}
+	if r.NameSubtext_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[640:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_enTW")
+	}
+	if r.NameSubtext_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[644:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_zhTW")
+	}
+	if r.NameSubtext_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[648:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_esES")
+	}
+	if r.NameSubtext_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[652:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_esMX")
+	}
+	if r.NameSubtext_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[656:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_ruRU")
+	}
+	if r.NameSubtext_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[660:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_ptPT")
+	}
+	if r.NameSubtext_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[664:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_ptBR")
+	}
+	if r.NameSubtext_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[668:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_itIT")
+	}
+	if r.NameSubtext_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[672:])); err != nil {
+		return errors.Wrap(err, "field NameSubtext_Lang_Unk")
+	}
+	r.NameSubtext_Lang_Mask = binary.LittleEndian.Uint32(b[676:])
+	if r.Description_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[680:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_enUS")
+	}
+	if r.Description_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[684:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_enGB")
+	}
+	if r.Description_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[688:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_koKR")
+	}
+	if r.Description_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[692:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_frFR")
+	}
+	if r.Description_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[696:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_deDE")
+	}
+	if r.Description_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[700:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_enCN")
+	}
+	if r.Description_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[704:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_zhCN")
+	}
+	if r.Description_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[708:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_enTW")
+	}
+	if r.Description_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[712:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_zhTW")
+	}
+	if r.Description_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[716:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_esES")
+	}
+	if r.Description_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[720:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_esMX")
+	}
+	if r.Description_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[724:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_ruRU")
+	}
+	if r.Description_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[728:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_ptPT")
+	}
+	if r.Description_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[732:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_ptBR")
+	}
+	if r.Description_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[736:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_itIT")
+	}
+	if r.Description_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[740:])); err != nil {
+		return errors.Wrap(err, "field Description_Lang_Unk")
+	}
+	r.Description_Lang_Mask = binary.LittleEndian.Uint32(b[744:])
+	if r.AuraDescription_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[748:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_enUS")
+	}
+	if r.AuraDescription_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[752:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_enGB")
+	}
+	if r.AuraDescription_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[756:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_koKR")
+	}
+	if r.AuraDescription_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[760:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_frFR")
+	}
+	if r.AuraDescription_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[764:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_deDE")
+	}
+	if r.AuraDescription_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[768:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_enCN")
+	}
+	if r.AuraDescription_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[772:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_zhCN")
+	}
+	if r.AuraDescription_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[776:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_enTW")
+	}
+	if r.AuraDescription_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[780:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_zhTW")
+	}
+	if r.AuraDescription_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[784:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_esES")
+	}
+	if r.AuraDescription_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[788:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_esMX")
+	}
+	if r.AuraDescription_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[792:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_ruRU")
+	}
+	if r.AuraDescription_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[796:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_ptPT")
+	}
+	if r.AuraDescription_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[800:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_ptBR")
+	}
+	if r.AuraDescription_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[804:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_itIT")
+	}
+	if r.AuraDescription_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[808:])); err != nil {
+		return errors.Wrap(err, "field AuraDescription_Lang_Unk")
+	}
+	r.AuraDescription_Lang_Mask = binary.LittleEndian.Uint32(b[812:])
+	r.ManaCostPct = binary.LittleEndian.Uint32(b[816:])
+	r.StartRecoveryCategory = binary.LittleEndian.Uint32(b[820:])
+	r.StartRecoveryTime = binary.LittleEndian.Uint32(b[824:])
+	r.MaxTargetLevel = binary.LittleEndian.Uint32(b[828:])
+	r.SpellClassSet = binary.LittleEndian.Uint32(b[832:])
+	r.SpellClassMask_1 = binary.LittleEndian.Uint32(b[836:])
+	r.SpellClassMask_2 = binary.LittleEndian.Uint32(b[840:])
+	r.SpellClassMask_3 = binary.LittleEndian.Uint32(b[844:])
+	r.MaxTargets = binary.LittleEndian.Uint32(b[848:])
+	r.DefenseType = binary.LittleEndian.Uint32(b[852:])
+	r.PreventionType = binary.LittleEndian.Uint32(b[856:])
+	r.StanceBarOrder = binary.LittleEndian.Uint32(b[860:])
+	r.EffectChainAmplitude_1 = math.Float32frombits(binary.LittleEndian.Uint32(b[864:]))
+	r.EffectChainAmplitude_2 = math.Float32frombits(binary.LittleEndian.Uint32(b[868:]))
+	r.EffectChainAmplitude_3 = math.Float32frombits(binary.LittleEndian.Uint32(b[872:]))
+	r.MinFactionID = binary.LittleEndian.Uint32(b[876:])
+	r.MinReputation = binary.LittleEndian.Uint32(b[880:])
+	r.RequiredAuraVision = binary.LittleEndian.Uint32(b[884:])
+	r.RequiredTotemCategoryID_1 = binary.LittleEndian.Uint32(b[888:])
+	r.RequiredTotemCategoryID_2 = binary.LittleEndian.Uint32(b[892:])
+	r.RequiredAreasID = int32(binary.LittleEndian.Uint32(b[896:]))
+	r.SchoolMask = binary.LittleEndian.Uint32(b[900:])
+	r.RuneCostID = binary.LittleEndian.Uint32(b[904:])
+	r.SpellMissileID = binary.LittleEndian.Uint32(b[908:])
+	r.PowerDisplayID = int32(binary.LittleEndian.Uint32(b[912:]))
+	r.EffectBonusMultiplier_1 = math.Float32frombits(binary.LittleEndian.Uint32(b[916:]))
+	r.EffectBonusMultiplier_2 = math.Float32frombits(binary.LittleEndian.Uint32(b[920:]))
+	r.EffectBonusMultiplier_3 = math.Float32frombits(binary.LittleEndian.Uint32(b[924:]))
+	r.SpellDescriptionVariableID = binary.LittleEndian.Uint32(b[928:])
+	r.SpellDifficultyID = binary.LittleEndian.Uint32(b[932:])
+	return nil
+}
+
+func (r SpellRecord) visitDBCStrings(visit func(str string)) {
+	visit(r.Name_Lang_enUS)
+	visit(r.Name_Lang_enGB)
+	visit(r.Name_Lang_koKR)
+	visit(r.Name_Lang_frFR)
+	visit(r.Name_Lang_deDE)
+	visit(r.Name_Lang_enCN)
+	visit(r.Name_Lang_zhCN)
+	visit(r.Name_Lang_enTW)
+	visit(r.Name_Lang_zhTW)
+	visit(r.Name_Lang_esES)
+	visit(r.Name_Lang_esMX)
+	visit(r.Name_Lang_ruRU)
+	visit(r.Name_Lang_ptPT)
+	visit(r.Name_Lang_ptBR)
+	visit(r.Name_Lang_itIT)
+	visit(r.Name_Lang_Unk)
+	visit(r.NameSubtext_Lang_enUS)
+	visit(r.NameSubtext_Lang_enGB)
+	visit(r.NameSubtext_Lang_koKR)
+	visit(r.NameSubtext_Lang_frFR)
+	visit(r.NameSubtext_Lang_deDE)
+	visit(r.NameSubtext_Lang_enCN)
+	visit(r.NameSubtext_Lang_zhCN)
+	visit(r.NameSubtext_Lang_enTW)
+	visit(r.NameSubtext_Lang_zhTW)
+	visit(r.NameSubtext_Lang_esES)
+	visit(r.NameSubtext_Lang_esMX)
+	visit(r.NameSubtext_Lang_ruRU)
+	visit(r.NameSubtext_Lang_ptPT)
+	visit(r.NameSubtext_Lang_ptBR)
+	visit(r.NameSubtext_Lang_itIT)
+	visit(r.NameSubtext_Lang_Unk)
+	visit(r.Description_Lang_enUS)
+	visit(r.Description_Lang_enGB)
+	visit(r.Description_Lang_koKR)
+	visit(r.Description_Lang_frFR)
+	visit(r.Description_Lang_deDE)
+	visit(r.Description_Lang_enCN)
+	visit(r.Description_Lang_zhCN)
+	visit(r.Description_Lang_enTW)
+	visit(r.Description_Lang_zhTW)
+	visit(r.Description_Lang_esES)
+	visit(r.Description_Lang_esMX)
+	visit(r.Description_Lang_ruRU)
+	visit(r.Description_Lang_ptPT)
+	visit(r.Description_Lang_ptBR)
+	visit(r.Description_Lang_itIT)
+	visit(r.Description_Lang_Unk)
+	visit(r.AuraDescription_Lang_enUS)
+	visit(r.AuraDescription_Lang_enGB)
+	visit(r.AuraDescription_Lang_koKR)
+	visit(r.AuraDescription_Lang_frFR)
+	visit(r.AuraDescription_Lang_deDE)
+	visit(r.AuraDescription_Lang_enCN)
+	visit(r.AuraDescription_Lang_zhCN)
+	visit(r.AuraDescription_Lang_enTW)
+	visit(r.AuraDescription_Lang_zhTW)
+	visit(r.AuraDescription_Lang_esES)
+	visit(r.AuraDescription_Lang_esMX)
+	visit(r.AuraDescription_Lang_ruRU)
+	visit(r.AuraDescription_Lang_ptPT)
+	visit(r.AuraDescription_Lang_ptBR)
+	visit(r.AuraDescription_Lang_itIT)
+	visit(r.AuraDescription_Lang_Unk)
+}
+
+func (r SpellRecord) encodeDBC(b []byte, strs stringOffsetter) {
+	_ = b[SpellRecordSize-1]
+	binary.LittleEndian.PutUint32(b[0:], uint32(r.ID))
+	binary.LittleEndian.PutUint32(b[4:], r.Category)
+	binary.LittleEndian.PutUint32(b[8:], r.DispelType)
+	binary.LittleEndian.PutUint32(b[12:], r.Mechanic)
+	binary.LittleEndian.PutUint32(b[16:], r.Attributes)
+	binary.LittleEndian.PutUint32(b[20:], r.AttributesEx)
+	binary.LittleEndian.PutUint32(b[24:], r.AttributesEx2)
+	binary.LittleEndian.PutUint32(b[28:], r.AttributesEx3)
+	binary.LittleEndian.PutUint32(b[32:], r.AttributesEx4)
+	binary.LittleEndian.PutUint32(b[36:], r.AttributesEx5)
+	binary.LittleEndian.PutUint32(b[40:], r.AttributesEx6)
+	binary.LittleEndian.PutUint32(b[44:], r.AttributesEx7)
+	binary.LittleEndian.PutUint32(b[48:], r.ShapeshiftMask)
+	binary.LittleEndian.PutUint32(b[52:], uint32(r.Unk_320_2))
+	binary.LittleEndian.PutUint32(b[56:], r.ShapeshiftExclude)
+	binary.LittleEndian.PutUint32(b[60:], uint32(r.Unk_320_3))
+	binary.LittleEndian.PutUint32(b[64:], r.Targets)
+	binary.LittleEndian.PutUint32(b[68:], r.TargetCreatureType)
+	binary.LittleEndian.PutUint32(b[72:], r.RequiresSpellFocus)
+	binary.LittleEndian.PutUint32(b[76:], r.FacingCasterFlags)
+	binary.LittleEndian.PutUint32(b[80:], r.CasterAuraState)
+	binary.LittleEndian.PutUint32(b[84:], r.TargetAuraState)
+	binary.LittleEndian.PutUint32(b[88:], r.ExcludeCasterAuraState)
+	binary.LittleEndian.PutUint32(b[92:], r.ExcludeTargetAuraState)
+	binary.LittleEndian.PutUint32(b[96:], r.CasterAuraSpell)
+	binary.LittleEndian.PutUint32(b[100:], r.TargetAuraSpell)
+	binary.LittleEndian.PutUint32(b[104:], r.ExcludeCasterAuraSpell)
+	binary.LittleEndian.PutUint32(b[108:], r.ExcludeTargetAuraSpell)
+	binary.LittleEndian.PutUint32(b[112:], r.CastingTimeIndex)
+	binary.LittleEndian.PutUint32(b[116:], r.RecoveryTime)
+	binary.LittleEndian.PutUint32(b[120:], r.CategoryRecoveryTime)
+	binary.LittleEndian.PutUint32(b[124:], r.InterruptFlags)
+	binary.LittleEndian.PutUint32(b[128:], r.AuraInterruptFlags)
+	binary.LittleEndian.PutUint32(b[132:], r.ChannelInterruptFlags)
+	binary.LittleEndian.PutUint32(b[136:], r.ProcTypeMask)
+	binary.LittleEndian.PutUint32(b[140:], r.ProcChance)
+	binary.LittleEndian.PutUint32(b[144:], r.ProcCharges)
+	binary.LittleEndian.PutUint32(b[148:], r.MaxLevel)
+	binary.LittleEndian.PutUint32(b[152:], r.BaseLevel)
+	binary.LittleEndian.PutUint32(b[156:], r.SpellLevel)
+	binary.LittleEndian.PutUint32(b[160:], r.DurationIndex)
+	binary.LittleEndian.PutUint32(b[164:], uint32(r.PowerType))
+	binary.LittleEndian.PutUint32(b[168:], r.ManaCost)
+	binary.LittleEndian.PutUint32(b[172:], r.ManaCostPerLevel)
+	binary.LittleEndian.PutUint32(b[176:], r.ManaPerSecond)
+	binary.LittleEndian.PutUint32(b[180:], r.ManaPerSecondPerLevel)
+	binary.LittleEndian.PutUint32(b[184:], r.RangeIndex)
+	binary.LittleEndian.PutUint32(b[188:], math.Float32bits(r.Speed))
+	binary.LittleEndian.PutUint32(b[192:], r.ModalNextSpell)
+	binary.LittleEndian.PutUint32(b[196:], r.CumulativeAura)
+	binary.LittleEndian.PutUint32(b[200:], r.Totem_1)
+	binary.LittleEndian.PutUint32(b[204:], r.Totem_2)
+	binary.LittleEndian.PutUint32(b[208:], uint32(r.Reagent_1))
+	binary.LittleEndian.PutUint32(b[212:], uint32(r.Reagent_2))
+	binary.LittleEndian.PutUint32(b[216:], uint32(r.Reagent_3))
+	binary.LittleEndian.PutUint32(b[220:], uint32(r.Reagent_4))
+	binary.LittleEndian.PutUint32(b[224:], uint32(r.Reagent_5))
+	binary.LittleEndian.PutUint32(b[228:], uint32(r.Reagent_6))
+	binary.LittleEndian.PutUint32(b[232:], uint32(r.Reagent_7))
+	binary.LittleEndian.PutUint32(b[236:], uint32(r.Reagent_8))
+	binary.LittleEndian.PutUint32(b[240:], uint32(r.ReagentCount_1))
+	binary.LittleEndian.PutUint32(b[244:], uint32(r.ReagentCount_2))
+	binary.LittleEndian.PutUint32(b[248:], uint32(r.ReagentCount_3))
+	binary.LittleEndian.PutUint32(b[252:], uint32(r.ReagentCount_4))
+	binary.LittleEndian.PutUint32(b[256:], uint32(r.ReagentCount_5))
+	binary.LittleEndian.PutUint32(b[260:], uint32(r.ReagentCount_6))
+	binary.LittleEndian.PutUint32(b[264:], uint32(r.ReagentCount_7))
+	binary.LittleEndian.PutUint32(b[268:], uint32(r.ReagentCount_8))
+	binary.LittleEndian.PutUint32(b[272:], uint32(r.EquippedItemClass))
+	binary.LittleEndian.PutUint32(b[276:], uint32(r.EquippedItemSubclass))
+	binary.LittleEndian.PutUint32(b[280:], uint32(r.EquippedItemInvTypes))
+	binary.LittleEndian.PutUint32(b[284:], r.Effect_1)
+	binary.LittleEndian.PutUint32(b[288:], r.Effect_2)
+	binary.LittleEndian.PutUint32(b[292:], r.Effect_3)
+	binary.LittleEndian.PutUint32(b[296:], uint32(r.EffectDieSides_1))
+	binary.LittleEndian.PutUint32(b[300:], uint32(r.EffectDieSides_2))
+	binary.LittleEndian.PutUint32(b[304:], uint32(r.EffectDieSides_3))
+	binary.LittleEndian.PutUint32(b[308:], math.Float32bits(r.EffectRealPointsPerLevel_1))
+	binary.LittleEndian.PutUint32(b[312:], math.Float32bits(r.EffectRealPointsPerLevel_2))
+	binary.LittleEndian.PutUint32(b[316:], math.Float32bits(r.EffectRealPointsPerLevel_3))
+	binary.LittleEndian.PutUint32(b[320:], uint32(r.EffectBasePoints_1))
+	binary.LittleEndian.PutUint32(b[324:], uint32(r.EffectBasePoints_2))
+	binary.LittleEndian.PutUint32(b[328:], uint32(r.EffectBasePoints_3))
+	binary.LittleEndian.PutUint32(b[332:], r.EffectMechanic_1)
+	binary.LittleEndian.PutUint32(b[336:], r.EffectMechanic_2)
+	binary.LittleEndian.PutUint32(b[340:], r.EffectMechanic_3)
+	binary.LittleEndian.PutUint32(b[344:], r.ImplicitTargetA_1)
+	binary.LittleEndian.PutUint32(b[348:], r.ImplicitTargetA_2)
+	binary.LittleEndian.PutUint32(b[352:], r.ImplicitTargetA_3)
+	binary.LittleEndian.PutUint32(b[356:], r.ImplicitTargetB_1)
+	binary.LittleEndian.PutUint32(b[360:], r.ImplicitTargetB_2)
+	binary.LittleEndian.PutUint32(b[364:], r.ImplicitTargetB_3)
+	binary.LittleEndian.PutUint32(b[368:], r.EffectRadiusIndex_1)
+	binary.LittleEndian.PutUint32(b[372:], r.EffectRadiusIndex_2)
+	binary.LittleEndian.PutUint32(b[376:], r.EffectRadiusIndex_3)
+	binary.LittleEndian.PutUint32(b[380:], r.EffectAura_1)
+	binary.LittleEndian.PutUint32(b[384:], r.EffectAura_2)
+	binary.LittleEndian.PutUint32(b[388:], r.EffectAura_3)
+	binary.LittleEndian.PutUint32(b[392:], r.EffectAuraPeriod_1)
+	binary.LittleEndian.PutUint32(b[396:], r.EffectAuraPeriod_2)
+	binary.LittleEndian.PutUint32(b[400:], r.EffectAuraPeriod_3)
+	binary.LittleEndian.PutUint32(b[404:], math.Float32bits(r.EffectMultipleValue_1))
+	binary.LittleEndian.PutUint32(b[408:], math.Float32bits(r.EffectMultipleValue_2))
+	binary.LittleEndian.PutUint32(b[412:], math.Float32bits(r.EffectMultipleValue_3))
+	binary.LittleEndian.PutUint32(b[416:], r.EffectChainTargets_1)
+	binary.LittleEndian.PutUint32(b[420:], r.EffectChainTargets_2)
+	binary.LittleEndian.PutUint32(b[424:], r.EffectChainTargets_3)
+	binary.LittleEndian.PutUint32(b[428:], r.EffectItemType_1)
+	binary.LittleEndian.PutUint32(b[432:], r.EffectItemType_2)
+	binary.LittleEndian.PutUint32(b[436:], r.EffectItemType_3)
+	binary.LittleEndian.PutUint32(b[440:], uint32(r.EffectMiscValue_1))
+	binary.LittleEndian.PutUint32(b[444:], uint32(r.EffectMiscValue_2))
+	binary.LittleEndian.PutUint32(b[448:], uint32(r.EffectMiscValue_3))
+	binary.LittleEndian.PutUint32(b[452:], uint32(r.EffectMiscValueB_1))
+	binary.LittleEndian.PutUint32(b[456:], uint32(r.EffectMiscValueB_2))
+	binary.LittleEndian.PutUint32(b[460:], uint32(r.EffectMiscValueB_3))
+	binary.LittleEndian.PutUint32(b[464:], r.EffectTriggerSpell_1)
+	binary.LittleEndian.PutUint32(b[468:], r.EffectTriggerSpell_2)
+	binary.LittleEndian.PutUint32(b[472:], r.EffectTriggerSpell_3)
+	binary.LittleEndian.PutUint32(b[476:], math.Float32bits(r.EffectPointsPerCombo_1))
+	binary.LittleEndian.PutUint32(b[480:], math.Float32bits(r.EffectPointsPerCombo_2))
+	binary.LittleEndian.PutUint32(b[484:], math.Float32bits(r.EffectPointsPerCombo_3))
+	binary.LittleEndian.PutUint32(b[488:], r.EffectSpellClassMaskA_1)
+	binary.LittleEndian.PutUint32(b[492:], r.EffectSpellClassMaskA_2)
+	binary.LittleEndian.PutUint32(b[496:], r.EffectSpellClassMaskA_3)
+	binary.LittleEndian.PutUint32(b[500:], r.EffectSpellClassMaskB_1)
+	binary.LittleEndian.PutUint32(b[504:], r.EffectSpellClassMaskB_2)
+	binary.LittleEndian.PutUint32(b[508:], r.EffectSpellClassMaskB_3)
+	binary.LittleEndian.PutUint32(b[512:], r.EffectSpellClassMaskC_1)
+	binary.LittleEndian.PutUint32(b[516:], r.EffectSpellClassMaskC_2)
+	binary.LittleEndian.PutUint32(b[520:], r.EffectSpellClassMaskC_3)
+	binary.LittleEndian.PutUint32(b[524:], r.SpellVisualID_1)
+	binary.LittleEndian.PutUint32(b[528:], r.SpellVisualID_2)
+	binary.LittleEndian.PutUint32(b[532:], r.SpellIconID)
+	binary.LittleEndian.PutUint32(b[536:], r.ActiveIconID)
+	binary.LittleEndian.PutUint32(b[540:], r.SpellPriority)
+	binary.LittleEndian.PutUint32(b[544:], strs.Offset(r.Name_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[548:], strs.Offset(r.Name_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[552:], strs.Offset(r.Name_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[556:], strs.Offset(r.Name_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[560:], strs.Offset(r.Name_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[564:], strs.Offset(r.Name_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[568:], strs.Offset(r.Name_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[572:], strs.Offset(r.Name_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[576:], strs.Offset(r.Name_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[580:], strs.Offset(r.Name_Lang_esES))
+	binary.LittleEndian.PutUint32(b[584:], strs.Offset(r.Name_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[588:], strs.Offset(r.Name_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[592:], strs.Offset(r.Name_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[596:], strs.Offset(r.Name_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[600:], strs.Offset(r.Name_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[604:], strs.Offset(r.Name_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[608:], r.Name_Lang_Mask)
+	binary.LittleEndian.PutUint32(b[612:], strs.Offset(r.NameSubtext_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[616:], strs.Offset(r.NameSubtext_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[620:], strs.Offset(r.NameSubtext_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[624:], strs.Offset(r.NameSubtext_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[628:], strs.Offset(r.NameSubtext_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[632:], strs.Offset(r.NameSubtext_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[636:], strs.Offset(r.NameSubtext_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[640:], strs.Offset(r.NameSubtext_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[644:], strs.Offset(r.NameSubtext_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[648:], strs.Offset(r.NameSubtext_Lang_esES))
+	binary.LittleEndian.PutUint32(b[652:], strs.Offset(r.NameSubtext_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[656:], strs.Offset(r.NameSubtext_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[660:], strs.Offset(r.NameSubtext_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[664:], strs.Offset(r.NameSubtext_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[668:], strs.Offset(r.NameSubtext_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[672:], strs.Offset(r.NameSubtext_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[676:], r.NameSubtext_Lang_Mask)
+	binary.LittleEndian.PutUint32(b[680:], strs.Offset(r.Description_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[684:], strs.Offset(r.Description_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[688:], strs.Offset(r.Description_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[692:], strs.Offset(r.Description_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[696:], strs.Offset(r.Description_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[700:], strs.Offset(r.Description_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[704:], strs.Offset(r.Description_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[708:], strs.Offset(r.Description_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[712:], strs.Offset(r.Description_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[716:], strs.Offset(r.Description_Lang_esES))
+	binary.LittleEndian.PutUint32(b[720:], strs.Offset(r.Description_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[724:], strs.Offset(r.Description_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[728:], strs.Offset(r.Description_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[732:], strs.Offset(r.Description_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[736:], strs.Offset(r.Description_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[740:], strs.Offset(r.Description_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[744:], r.Description_Lang_Mask)
+	binary.LittleEndian.PutUint32(b[748:], strs.Offset(r.AuraDescription_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[752:], strs.Offset(r.AuraDescription_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[756:], strs.Offset(r.AuraDescription_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[760:], strs.Offset(r.AuraDescription_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[764:], strs.Offset(r.AuraDescription_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[768:], strs.Offset(r.AuraDescription_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[772:], strs.Offset(r.AuraDescription_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[776:], strs.Offset(r.AuraDescription_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[780:], strs.Offset(r.AuraDescription_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[784:], strs.Offset(r.AuraDescription_Lang_esES))
+	binary.LittleEndian.PutUint32(b[788:], strs.Offset(r.AuraDescription_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[792:], strs.Offset(r.AuraDescription_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[796:], strs.Offset(r.AuraDescription_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[800:], strs.Offset(r.AuraDescription_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[804:], strs.Offset(r.AuraDescription_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[808:], strs.Offset(r.AuraDescription_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[812:], r.AuraDescription_Lang_Mask)
+	binary.LittleEndian.PutUint32(b[816:], r.ManaCostPct)
+	binary.LittleEndian.PutUint32(b[820:], r.StartRecoveryCategory)
+	binary.LittleEndian.PutUint32(b[824:], r.StartRecoveryTime)
+	binary.LittleEndian.PutUint32(b[828:], r.MaxTargetLevel)
+	binary.LittleEndian.PutUint32(b[832:], r.SpellClassSet)
+	binary.LittleEndian.PutUint32(b[836:], r.SpellClassMask_1)
+	binary.LittleEndian.PutUint32(b[840:], r.SpellClassMask_2)
+	binary.LittleEndian.PutUint32(b[844:], r.SpellClassMask_3)
+	binary.LittleEndian.PutUint32(b[848:], r.MaxTargets)
+	binary.LittleEndian.PutUint32(b[852:], r.DefenseType)
+	binary.LittleEndian.PutUint32(b[856:], r.PreventionType)
+	binary.LittleEndian.PutUint32(b[860:], r.StanceBarOrder)
+	binary.LittleEndian.PutUint32(b[864:], math.Float32bits(r.EffectChainAmplitude_1))
+	binary.LittleEndian.PutUint32(b[868:], math.Float32bits(r.EffectChainAmplitude_2))
+	binary.LittleEndian.PutUint32(b[872:], math.Float32bits(r.EffectChainAmplitude_3))
+	binary.LittleEndian.PutUint32(b[876:], r.MinFactionID)
+	binary.LittleEndian.PutUint32(b[880:], r.MinReputation)
+	binary.LittleEndian.PutUint32(b[884:], r.RequiredAuraVision)
+	binary.LittleEndian.PutUint32(b[888:], r.RequiredTotemCategoryID_1)
+	binary.LittleEndian.PutUint32(b[892:], r.RequiredTotemCategoryID_2)
+	binary.LittleEndian.PutUint32(b[896:], uint32(r.RequiredAreasID))
+	binary.LittleEndian.PutUint32(b[900:], r.SchoolMask)
+	binary.LittleEndian.PutUint32(b[904:], r.RuneCostID)
+	binary.LittleEndian.PutUint32(b[908:], r.SpellMissileID)
+	binary.LittleEndian.PutUint32(b[912:], uint32(r.PowerDisplayID))
+	binary.LittleEndian.PutUint32(b[916:], math.Float32bits(r.EffectBonusMultiplier_1))
+	binary.LittleEndian.PutUint32(b[920:], math.Float32bits(r.EffectBonusMultiplier_2))
+	binary.LittleEndian.PutUint32(b[924:], math.Float32bits(r.EffectBonusMultiplier_3))
+	binary.LittleEndian.PutUint32(b[928:], r.SpellDescriptionVariableID)
+	binary.LittleEndian.PutUint32(b[932:], r.SpellDifficultyID)
+}
+
+// SpellItemEnchantmentRecord is a record of SpellItemEnchantment.dbc, generated from SpellItemEnchantment.dbc.json
+type SpellItemEnchantmentRecord struct {
+	ID                int32
+	Charges           int32
+	Effect_1          int32
+	Effect_2          int32
+	Effect_3          int32
+	EffectPointsMin_1 int32
+	EffectPointsMin_2 int32
+	EffectPointsMin_3 int32
+	EffectPointsMax_1 int32
+	EffectPointsMax_2 int32
+	EffectPointsMax_3 int32
+	EffectArg_1       int32
+	EffectArg_2       int32
+	EffectArg_3       int32
+	Name_Lang_enUS    string
+	Name_Lang_enGB    string
+	Name_Lang_koKR    string
+	Name_Lang_frFR    string
+	Name_Lang_deDE    string
+	Name_Lang_enCN    string
+	Name_Lang_zhCN    string
+	Name_Lang_enTW    string
+	Name_Lang_zhTW    string
+	Name_Lang_esES    string
+	Name_Lang_esMX    string
+	Name_Lang_ruRU    string
+	Name_Lang_ptPT    string
+	Name_Lang_ptBR    string
+	Name_Lang_itIT    string
+	Name_Lang_Unk     string
+	Name_Lang_Mask    uint32
+	ItemVisual        int32
+	Flags             int32
+	Src_ItemID        int32
+	Condition_Id      int32
+	RequiredSkillID   int32
+	RequiredSkillRank int32
+	MinLevel          int32
+}
+
+const SpellItemEnchantmentRecordSize = 152
+
+var SpellItemEnchantmentSchema = DBCSchema{Fields: []DBCSchemaField{
+	{Type: DBCSchemaFieldInt32, Name: "ID"},
+	{Type: DBCSchemaFieldInt32, Name: "Charges"},
+	{Type: DBCSchemaFieldInt32, Name: "Effect_1"},
+	{Type: DBCSchemaFieldInt32, Name: "Effect_2"},
+	{Type: DBCSchemaFieldInt32, Name: "Effect_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectPointsMin_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectPointsMin_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectPointsMin_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectPointsMax_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectPointsMax_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectPointsMax_3"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectArg_1"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectArg_2"},
+	{Type: DBCSchemaFieldInt32, Name: "EffectArg_3"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enUS"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enGB"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_koKR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_frFR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_deDE"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhCN"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_enTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_zhTW"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esES"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_esMX"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ruRU"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptPT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_ptBR"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_itIT"},
+	{Type: DBCSchemaFieldStringOffset, Name: "Name_Lang_Unk"},
+	{Type: DBCSchemaFieldUint32, Name: "Name_Lang_Mask"},
+	{Type: DBCSchemaFieldInt32, Name: "ItemVisual"},
+	{Type: DBCSchemaFieldInt32, Name: "Flags"},
+	{Type: DBCSchemaFieldInt32, Name: "Src_ItemID"},
+	{Type: DBCSchemaFieldInt32, Name: "Condition_Id"},
+	{Type: DBCSchemaFieldInt32, Name: "RequiredSkillID"},
+	{Type: DBCSchemaFieldInt32, Name: "RequiredSkillRank"},
+	{Type: DBCSchemaFieldInt32, Name: "MinLevel"},
+}}
+
+func (SpellItemEnchantmentRecord) dbcSchema() DBCSchema { return SpellItemEnchantmentSchema }
+
+func (r *SpellItemEnchantmentRecord) decodeDBC(b []byte, stringBlock []byte) (err error) {
+	_ = b[SpellItemEnchantmentRecordSize-1]
+	r.ID = int32(binary.LittleEndian.Uint32(b[0:]))
+	r.Charges = int32(binary.LittleEndian.Uint32(b[4:]))
+	r.Effect_1 = int32(binary.LittleEndian.Uint32(b[8:]))
+	r.Effect_2 = int32(binary.LittleEndian.Uint32(b[12:]))
+	r.Effect_3 = int32(binary.LittleEndian.Uint32(b[16:]))
+	r.EffectPointsMin_1 = int32(binary.LittleEndian.Uint32(b[20:]))
+	r.EffectPointsMin_2 = int32(binary.LittleEndian.Uint32(b[24:]))
+	r.EffectPointsMin_3 = int32(binary.LittleEndian.Uint32(b[28:]))
+	r.EffectPointsMax_1 = int32(binary.LittleEndian.Uint32(b[32:]))
+	r.EffectPointsMax_2 = int32(binary.LittleEndian.Uint32(b[36:]))
+	r.EffectPointsMax_3 = int32(binary.LittleEndian.Uint32(b[40:]))
+	r.EffectArg_1 = int32(binary.LittleEndian.Uint32(b[44:]))
+	r.EffectArg_2 = int32(binary.LittleEndian.Uint32(b[48:]))
+	r.EffectArg_3 = int32(binary.LittleEndian.Uint32(b[52:]))
+	if r.Name_Lang_enUS, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[56:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enUS")
+	}
+	if r.Name_Lang_enGB, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[60:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enGB")
+	}
+	if r.Name_Lang_koKR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[64:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_koKR")
+	}
+	if r.Name_Lang_frFR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[68:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_frFR")
+	}
+	if r.Name_Lang_deDE, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[72:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_deDE")
+	}
+	if r.Name_Lang_enCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[76:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enCN")
+	}
+	if r.Name_Lang_zhCN, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[80:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhCN")
+	}
+	if r.Name_Lang_enTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[84:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_enTW")
+	}
+	if r.Name_Lang_zhTW, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[88:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_zhTW")
+	}
+	if r.Name_Lang_esES, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[92:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esES")
+	}
+	if r.Name_Lang_esMX, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[96:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_esMX")
+	}
+	if r.Name_Lang_ruRU, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[100:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ruRU")
+	}
+	if r.Name_Lang_ptPT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[104:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptPT")
+	}
+	if r.Name_Lang_ptBR, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[108:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_ptBR")
+	}
+	if r.Name_Lang_itIT, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[112:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_itIT")
+	}
+	if r.Name_Lang_Unk, err = stringAt(stringBlock, binary.LittleEndian.Uint32(b[116:])); err != nil {
+		return errors.Wrap(err, "field Name_Lang_Unk")
+	}
+	r.Name_Lang_Mask = binary.LittleEndian.Uint32(b[120:])
+	r.ItemVisual = int32(binary.LittleEndian.Uint32(b[124:]))
+	r.Flags = int32(binary.LittleEndian.Uint32(b[128:]))
+	r.Src_ItemID = int32(binary.LittleEndian.Uint32(b[132:]))
+	r.Condition_Id = int32(binary.LittleEndian.Uint32(b[136:]))
+	r.RequiredSkillID = int32(binary.LittleEndian.Uint32(b[140:]))
+	r.RequiredSkillRank = int32(binary.LittleEndian.Uint32(b[144:]))
+	r.MinLevel = int32(binary.LittleEndian.Uint32(b[148:]))
+	return nil
+}
+
+func (r SpellItemEnchantmentRecord) visitDBCStrings(visit func(str string)) {
+	visit(r.Name_Lang_enUS)
+	visit(r.Name_Lang_enGB)
+	visit(r.Name_Lang_koKR)
+	visit(r.Name_Lang_frFR)
+	visit(r.Name_Lang_deDE)
+	visit(r.Name_Lang_enCN)
+	visit(r.Name_Lang_zhCN)
+	visit(r.Name_Lang_enTW)
+	visit(r.Name_Lang_zhTW)
+	visit(r.Name_Lang_esES)
+	visit(r.Name_Lang_esMX)
+	visit(r.Name_Lang_ruRU)
+	visit(r.Name_Lang_ptPT)
+	visit(r.Name_Lang_ptBR)
+	visit(r.Name_Lang_itIT)
+	visit(r.Name_Lang_Unk)
+}
+
+func (r SpellItemEnchantmentRecord) encodeDBC(b []byte, strs stringOffsetter) {
+	_ = b[SpellItemEnchantmentRecordSize-1]
+	binary.LittleEndian.PutUint32(b[0:], uint32(r.ID))
+	binary.LittleEndian.PutUint32(b[4:], uint32(r.Charges))
+	binary.LittleEndian.PutUint32(b[8:], uint32(r.Effect_1))
+	binary.LittleEndian.PutUint32(b[12:], uint32(r.Effect_2))
+	binary.LittleEndian.PutUint32(b[16:], uint32(r.Effect_3))
+	binary.LittleEndian.PutUint32(b[20:], uint32(r.EffectPointsMin_1))
+	binary.LittleEndian.PutUint32(b[24:], uint32(r.EffectPointsMin_2))
+	binary.LittleEndian.PutUint32(b[28:], uint32(r.EffectPointsMin_3))
+	binary.LittleEndian.PutUint32(b[32:], uint32(r.EffectPointsMax_1))
+	binary.LittleEndian.PutUint32(b[36:], uint32(r.EffectPointsMax_2))
+	binary.LittleEndian.PutUint32(b[40:], uint32(r.EffectPointsMax_3))
+	binary.LittleEndian.PutUint32(b[44:], uint32(r.EffectArg_1))
+	binary.LittleEndian.PutUint32(b[48:], uint32(r.EffectArg_2))
+	binary.LittleEndian.PutUint32(b[52:], uint32(r.EffectArg_3))
+	binary.LittleEndian.PutUint32(b[56:], strs.Offset(r.Name_Lang_enUS))
+	binary.LittleEndian.PutUint32(b[60:], strs.Offset(r.Name_Lang_enGB))
+	binary.LittleEndian.PutUint32(b[64:], strs.Offset(r.Name_Lang_koKR))
+	binary.LittleEndian.PutUint32(b[68:], strs.Offset(r.Name_Lang_frFR))
+	binary.LittleEndian.PutUint32(b[72:], strs.Offset(r.Name_Lang_deDE))
+	binary.LittleEndian.PutUint32(b[76:], strs.Offset(r.Name_Lang_enCN))
+	binary.LittleEndian.PutUint32(b[80:], strs.Offset(r.Name_Lang_zhCN))
+	binary.LittleEndian.PutUint32(b[84:], strs.Offset(r.Name_Lang_enTW))
+	binary.LittleEndian.PutUint32(b[88:], strs.Offset(r.Name_Lang_zhTW))
+	binary.LittleEndian.PutUint32(b[92:], strs.Offset(r.Name_Lang_esES))
+	binary.LittleEndian.PutUint32(b[96:], strs.Offset(r.Name_Lang_esMX))
+	binary.LittleEndian.PutUint32(b[100:], strs.Offset(r.Name_Lang_ruRU))
+	binary.LittleEndian.PutUint32(b[104:], strs.Offset(r.Name_Lang_ptPT))
+	binary.LittleEndian.PutUint32(b[108:], strs.Offset(r.Name_Lang_ptBR))
+	binary.LittleEndian.PutUint32(b[112:], strs.Offset(r.Name_Lang_itIT))
+	binary.LittleEndian.PutUint32(b[116:], strs.Offset(r.Name_Lang_Unk))
+	binary.LittleEndian.PutUint32(b[120:], r.Name_Lang_Mask)
+	binary.LittleEndian.PutUint32(b[124:], uint32(r.ItemVisual))
+	binary.LittleEndian.PutUint32(b[128:], uint32(r.Flags))
+	binary.LittleEndian.PutUint32(b[132:], uint32(r.Src_ItemID))
+	binary.LittleEndian.PutUint32(b[136:], uint32(r.Condition_Id))
+	binary.LittleEndian.PutUint32(b[140:], uint32(r.RequiredSkillID))
+	binary.LittleEndian.PutUint32(b[144:], uint32(r.RequiredSkillRank))
+	binary.LittleEndian.PutUint32(b[148:], uint32(r.MinLevel))
+}
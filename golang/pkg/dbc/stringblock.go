@@ -0,0 +1,201 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package dbc
+
+import (
+	"bufio"
+	"bytes"
+	"io"
+	"sort"
+	"strings"
+
+	"github.com/pkg/errors"
+)
+
+// exportBufferSize is the size of the buffered writer that DBC exports stream through
+const exportBufferSize = 64 * 1024
+
+// stringOffsetter looks up the string block offset of a string while records are encoded
+type stringOffsetter interface {
+	Offset(str string) uint32
+}
+
+// StringBlockBuilder is a DBC string block that strings can be interned into. Offset 0 is always the
+// empty string.
+type StringBlockBuilder struct {
+	block   []byte
+	offsets map[string]uint32
+}
+
+// NewStringBlockBuilder starts from an existing string block, whose strings keep their offsets
+func NewStringBlockBuilder(block []byte) *StringBlockBuilder {
+	s := &StringBlockBuilder{
+		block:   append([]byte{}, block...),
+		offsets: make(map[string]uint32),
+	}
+	if len(s.block) == 0 || s.block[0] != 0 {
+		s.block = append([]byte{0}, s.block...)
+	}
+	for offset := 0; offset < len(s.block); {
+		end := bytes.IndexByte(s.block[offset:], 0)
+		if end < 0 {
+			// Terminate a truncated last string so appended strings do not run into it
+			s.block = append(s.block, 0)
+			end = len(s.block) - 1 - offset
+		}
+		str := string(s.block[offset : offset+end])
+		if _, ok := s.offsets[str]; !ok && str != "" {
+			s.offsets[str] = uint32(offset)
+		}
+		offset += end + 1
+	}
+	return s
+}
+
+// Offset returns the offset of the string, appending it to the block if it is not in there yet
+func (s *StringBlockBuilder) Offset(str string) uint32 {
+	if str == "" {
+		return 0
+	}
+	if offset, ok := s.offsets[str]; ok {
+		return offset
+	}
+	offset := uint32(len(s.block))
+	s.block = append(s.block, str...)
+	s.block = append(s.block, 0)
+	s.offsets[str] = offset
+	return offset
+}
+
+// Bytes returns the string block
+func (s *StringBlockBuilder) Bytes() []byte {
+	return s.block
+}
+
+// stringAt reads the string at an offset of the string block. Offsets at the very end of the block are
+// read as empty strings, older exports of this package wrote empty strings that way.
+func stringAt(stringBlock []byte, offset uint32) (string, error) {
+	if uint64(offset) == uint64(len(stringBlock)) {
+		return "", nil
+	}
+	if uint64(offset) > uint64(len(stringBlock)) {
+		return "", errors.Wrapf(ErrDBCInvalidStringOffset, "offset %d, string block size %d", offset, len(stringBlock))
+	}
+	s := stringBlock[offset:]
+	if end := bytes.IndexByte(s, 0); end >= 0 {
+		s = s[:end]
+	}
+	return string(s), nil
+}
+
+// CompactStringBlock is a string block that holds every distinct string once. A string that is the tail
+// of a longer string is not stored at all, its offset points into the tail of the longer one instead,
+// e.g. "of the Bear" is read from inside "Crown of the Bear".
+type CompactStringBlock struct {
+	block   []byte
+	offsets map[string]uint32
+}
+
+// NewCompactStringBlock lays out the set of strings. Sorting the reversed strings puts every string right
+// before the strings it is a tail of, so a single pass backwards over them finds all of the shared tails.
+func NewCompactStringBlock(strs map[string]struct{}) *CompactStringBlock {
+	var size int
+	for s := range strs {
+		size += len(s)
+	}
+	// The reversed strings, and later the offset keys, are all slices of a single allocation
+	var sb strings.Builder
+	sb.Grow(size)
+	ends := make([]int, 0, len(strs))
+	for s := range strs {
+		if s == "" {
+			continue
+		}
+		for i := len(s) - 1; i >= 0; i-- {
+			sb.WriteByte(s[i])
+		}
+		ends = append(ends, sb.Len())
+	}
+	all := sb.String()
+	reversed := make([]string, len(ends))
+	for i, end := range ends {
+		start := 0
+		if i > 0 {
+			start = ends[i-1]
+		}
+		reversed[i] = all[start:end]
+	}
+	sort.Strings(reversed)
+
+	type span struct {
+		offset, length uint32
+	}
+	spans := make([]span, len(reversed))
+	block := make([]byte, 1, size+len(reversed)+1)
+	var tail string
+	var tailOffset uint32
+	for i := len(reversed) - 1; i >= 0; i-- {
+		r := reversed[i]
+		if strings.HasPrefix(tail, r) {
+			spans[i] = span{offset: tailOffset + uint32(len(tail)-len(r)), length: uint32(len(r))}
+			continue
+		}
+		tail, tailOffset = r, uint32(len(block))
+		for j := len(r) - 1; j >= 0; j-- {
+			block = append(block, r[j])
+		}
+		block = append(block, 0)
+		spans[i] = span{offset: tailOffset, length: uint32(len(r))}
+	}
+	blockStr := string(block)
+	c := &CompactStringBlock{
+		block:   block,
+		offsets: make(map[string]uint32, len(spans)+1),
+	}
+	c.offsets[""] = 0
+	for _, sp := range spans {
+		c.offsets[blockStr[sp.offset:sp.offset+sp.length]] = sp.offset
+	}
+	return c
+}
+
+// Offset returns the offset of a string that the block was laid out with
+func (c *CompactStringBlock) Offset(str string) uint32 {
+	if str == "" {
+		return 0
+	}
+	offset, ok := c.offsets[str]
+	if !ok {
+		log.Panic("string was not in the set the compact string block was laid out with", "str", str)
+	}
+	return offset
+}
+
+// Bytes returns the string block
+func (c *CompactStringBlock) Bytes() []byte {
+	return c.block
+}
+
+// writeDBC streams a DBC through a buffered writer front to back. encode fills the reused buffer with the
+// i-th record, so no more than one record is ever encoded at a time.
+func writeDBC(w io.Writer, header DBCHeader, encode func(i int, b []byte) error, stringBlock []byte) error {
+	bw := bufio.NewWriterSize(w, exportBufferSize)
+	if err := header.WriteDBCHeader(bw); err != nil {
+		return err
+	}
+	b := make([]byte, header.RecordSize)
+	for i := 0; i < int(header.RecordCount); i++ {
+		if err := encode(i, b); err != nil {
+			return err
+		}
+		if _, err := bw.Write(b); err != nil {
+			return errors.Wrapf(err, "unable to write record %d", i)
+		}
+	}
+	if _, err := bw.Write(stringBlock); err != nil {
+		return errors.Wrap(err, "unable to write string block to the end of the writer")
+	}
+	return errors.Wrap(bw.Flush(), "unable to flush the dbc")
+}
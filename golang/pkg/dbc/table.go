@@ -0,0 +1,163 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package dbc
+
+//go:generate go run ../../cmd/dbcstructgen -schemas ../../data/3.3.5.12340/schemas -out records_gen.go
+
+import (
+	"bytes"
+	"io"
+	"os"
+
+	"github.com/pkg/errors"
+)
+
+var ErrDBCSchemaMismatch = errors.New("DBC schema does not match the schema the records were generated from, regenerate records_gen.go")
+
+// Record is implemented by the record structs generated from the DBC schemas in records_gen.go
+type Record interface {
+	dbcSchema() DBCSchema
+	visitDBCStrings(visit func(str string))
+	encodeDBC(b []byte, strs stringOffsetter)
+}
+
+// recordPtr is the pointer to a generated record struct, which decodes into the record
+type recordPtr[R Record] interface {
+	*R
+	decodeDBC(b []byte, stringBlock []byte) error
+}
+
+// Table is a DBC decoded into typed records. Strings of the source DBC keep their offsets on export,
+// strings that are new to the table are appended to the end of the string block.
+type Table[R Record] struct {
+	Records []R
+	strings *StringBlockBuilder
+}
+
+// ReadTableFromFile reads a DBC file into typed records
+func ReadTableFromFile[R Record, P recordPtr[R]](dbcFilePath string) (*Table[R], error) {
+	b, err := os.ReadFile(dbcFilePath)
+	if err != nil {
+		return nil, errors.Wrap(err, "cannot read dbc file")
+	}
+	return ReadTable[R, P](b)
+}
+
+// ReadTable decodes the bytes of a DBC file into typed records
+func ReadTable[R Record, P recordPtr[R]](b []byte) (*Table[R], error) {
+	var d DBC
+	if len(b) < validDBCRecordStartOffset {
+		return nil, errors.Wrapf(ErrDBCTruncated, "file size is %d, smaller than the header", len(b))
+	}
+	err := d.Header.ReadDBCHeader(bytes.NewReader(b[:validDBCRecordStartOffset]))
+	if err != nil {
+		return nil, err
+	}
+	var zero R
+	d.Schema = zero.dbcSchema()
+	if err = d.validate(); err != nil {
+		return nil, err
+	}
+	recordSize := uint64(d.Header.RecordSize)
+	recordsEnd := uint64(validDBCRecordStartOffset) + uint64(d.Header.RecordCount)*recordSize
+	fileEnd := recordsEnd + uint64(d.Header.StringBlockSize)
+	if uint64(len(b)) < fileEnd {
+		return nil, errors.Wrapf(ErrDBCTruncated, "file size is %d, header needs %d", len(b), fileEnd)
+	}
+	stringBlock := b[recordsEnd:fileEnd]
+	t := &Table[R]{
+		Records: make([]R, d.Header.RecordCount),
+		strings: NewStringBlockBuilder(stringBlock),
+	}
+	for i := range t.Records {
+		start := uint64(validDBCRecordStartOffset) + uint64(i)*recordSize
+		if err = P(&t.Records[i]).decodeDBC(b[start:start+recordSize], stringBlock); err != nil {
+			return nil, errors.Wrapf(err, "unable to decode record %d", i)
+		}
+	}
+	return t, nil
+}
+
+// Append adds records to the table, interning their strings into the string block as it goes
+func (t *Table[R]) Append(records ...R) {
+	if t.strings == nil {
+		t.strings = NewStringBlockBuilder(nil)
+	}
+	intern := t.internString
+	for i := range records {
+		records[i].visitDBCStrings(intern)
+	}
+	t.Records = append(t.Records, records...)
+}
+
+// CheckSchemaFile checks that a schema JSON still matches the schema the records were generated from
+func (t *Table[R]) CheckSchemaFile(schemaJSONPath string) error {
+	schemafp, err := os.Open(schemaJSONPath)
+	if err != nil {
+		return errors.Wrap(err, "cannot open schema file")
+	}
+	defer schemafp.Close()
+	var schema DBCSchema
+	if err = schema.FromJSONReader(schemafp); err != nil {
+		return err
+	}
+	var zero R
+	generated := zero.dbcSchema()
+	if len(schema.Fields) != len(generated.Fields) {
+		return errors.Wrapf(ErrDBCSchemaMismatch, "schema has %d fields, generated records have %d", len(schema.Fields), len(generated.Fields))
+	}
+	for fi, f := range schema.Fields {
+		if f != generated.Fields[fi] {
+			return errors.Wrapf(ErrDBCSchemaMismatch, "field %d is %s %s in the schema, %s %s in the generated records", fi, f.Name, f.Type, generated.Fields[fi].Name, generated.Fields[fi].Type)
+		}
+	}
+	return nil
+}
+
+func (t *Table[R]) internString(str string) {
+	t.strings.Offset(str)
+}
+
+// Export writes the table as a DBC file, strings of the source DBC keep their offsets
+func (t *Table[R]) Export(w io.Writer) error {
+	if t.strings == nil {
+		t.strings = NewStringBlockBuilder(nil)
+	}
+	// Records can be edited in place after Append, so the strings are interned again up front for the
+	// string block size in the header
+	intern := t.internString
+	for i := range t.Records {
+		t.Records[i].visitDBCStrings(intern)
+	}
+	return t.export(w, t.strings, t.strings.Bytes())
+}
+
+// ExportCompact writes the table as a DBC file with a CompactStringBlock, only the strings that the
+// records use are kept and strings that are the tail of another string share its bytes
+func (t *Table[R]) ExportCompact(w io.Writer) error {
+	strs := make(map[string]struct{})
+	collect := func(str string) { strs[str] = struct{}{} }
+	for i := range t.Records {
+		t.Records[i].visitDBCStrings(collect)
+	}
+	block := NewCompactStringBlock(strs)
+	return t.export(w, block, block.Bytes())
+}
+
+func (t *Table[R]) export(w io.Writer, strs stringOffsetter, stringBlock []byte) error {
+	var zero R
+	schema := zero.dbcSchema()
+	header := DBCHeader{
+		MagicSignature:  []byte(dbcMagicSignature),
+		RecordCount:     uint32(len(t.Records)),
+		FieldCount:      uint32(len(schema.Fields)),
+		RecordSize:      schema.CalculateRecordSize(),
+		StringBlockSize: uint32(len(stringBlock)),
+	}
+	return writeDBC(w, header, func(i int, b []byte) error {
+		t.Records[i].encodeDBC(b, strs)
+		return nil
+	}, stringBlock)
+}
@@ -0,0 +1,170 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+package dbc
+
+import (
+	"bufio"
+	"io"
+	"os"
+
+	"github.com/pkg/errors"
+)
+
+// TableWriter streams a DBC file record by record, so the records written through it never have to be
+// held in memory. The records of the source table are written first with their strings laid out in a
+// CompactStringBlock, strings of the records written afterwards are spilled to a temporary file until
+// Close writes the string block and goes back to fill in the header.
+//
+// Strings of the source table share their tails, every other string is spilled once and then reused.
+type TableWriter[R Record] struct {
+	w           io.WriteSeeker
+	start       int64
+	bw          *bufio.Writer
+	buf         []byte
+	recordCount uint32
+	strs        *spilledStrings
+}
+
+// spilledStrings looks strings up in the string block of the source table, any other string is appended to the spill
+// file the first time it comes and is given the offset it will have once the spill file is copied after the source block
+type spilledStrings struct {
+	source  *CompactStringBlock
+	spilled map[string]uint32
+	spill   *os.File
+	bw      *bufio.Writer
+	next    uint32
+}
+
+func (s *spilledStrings) Offset(str string) uint32 {
+	if str == "" {
+		return 0
+	}
+	if offset, ok := s.source.offsets[str]; ok {
+		return offset
+	}
+	if offset, ok := s.spilled[str]; ok {
+		return offset
+	}
+	offset := s.next
+	s.bw.WriteString(str)
+	s.bw.WriteByte(0)
+	s.next += uint32(len(str)) + 1
+	s.spilled[str] = offset
+	return offset
+}
+
+// NewTableWriter starts a DBC at the current position of w with the records of src
+func NewTableWriter[R Record](w io.WriteSeeker, src *Table[R]) (*TableWriter[R], error) {
+	start, err := w.Seek(0, io.SeekCurrent)
+	if err != nil {
+		return nil, errors.Wrap(err, "unable to find the start of the dbc")
+	}
+	spill, err := os.CreateTemp("", "dbc-strings-*")
+	if err != nil {
+		return nil, errors.Wrap(err, "unable to create the string spill file")
+	}
+	sourceStrs := make(map[string]struct{})
+	if src != nil {
+		collect := func(str string) { sourceStrs[str] = struct{}{} }
+		for i := range src.Records {
+			src.Records[i].visitDBCStrings(collect)
+		}
+	}
+	source := NewCompactStringBlock(sourceStrs)
+	var zero R
+	tw := &TableWriter[R]{
+		w:     w,
+		start: start,
+		bw:    bufio.NewWriterSize(w, exportBufferSize),
+		buf:   make([]byte, zero.dbcSchema().CalculateRecordSize()),
+		strs: &spilledStrings{
+			source:  source,
+			spilled: make(map[string]uint32),
+			spill:   spill,
+			bw:      bufio.NewWriterSize(spill, exportBufferSize),
+		},
+	}
+	// The header is filled in by Close, until then the space is held by an empty one
+	if _, err = tw.bw.Write(make([]byte, validDBCRecordStartOffset)); err != nil {
+		tw.removeSpill()
+		return nil, errors.Wrap(err, "unable to write the dbc header")
+	}
+	if src != nil {
+		if err = tw.Write(src.Records...); err != nil {
+			tw.removeSpill()
+			return nil, err
+		}
+	}
+	tw.strs.next = uint32(len(source.Bytes()))
+	return tw, nil
+}
+
+// Write streams records to the DBC
+func (tw *TableWriter[R]) Write(records ...R) error {
+	for i := range records {
+		records[i].encodeDBC(tw.buf, tw.strs)
+		if _, err := tw.bw.Write(tw.buf); err != nil {
+			return errors.Wrapf(err, "unable to write record %d", tw.recordCount)
+		}
+		tw.recordCount++
+	}
+	return nil
+}
+
+// Size is the size the DBC will have once closed, for the records written so far
+func (tw *TableWriter[R]) Size() int64 {
+	return validDBCRecordStartOffset + int64(tw.recordCount)*int64(len(tw.buf)) + int64(tw.strs.next)
+}
+
+// RecordSize is the size of a single record in the DBC
+func (tw *TableWriter[R]) RecordSize() int {
+	return len(tw.buf)
+}
+
+// Close writes the string block and the header, the writer is left at the end of the DBC
+func (tw *TableWriter[R]) Close() error {
+	defer tw.removeSpill()
+	if _, err := tw.bw.Write(tw.strs.source.Bytes()); err != nil {
+		return errors.Wrap(err, "unable to write string block to the end of the writer")
+	}
+	if err := tw.strs.bw.Flush(); err != nil {
+		return errors.Wrap(err, "unable to flush the string spill file")
+	}
+	if _, err := tw.strs.spill.Seek(0, io.SeekStart); err != nil {
+		return errors.Wrap(err, "unable to rewind the string spill file")
+	}
+	if _, err := io.Copy(tw.bw, tw.strs.spill); err != nil {
+		return errors.Wrap(err, "unable to copy the spilled strings to the end of the writer")
+	}
+	if err := tw.bw.Flush(); err != nil {
+		return errors.Wrap(err, "unable to flush the dbc")
+	}
+	end, err := tw.w.Seek(0, io.SeekCurrent)
+	if err != nil {
+		return errors.Wrap(err, "unable to find the end of the dbc")
+	}
+	var zero R
+	schema := zero.dbcSchema()
+	header := DBCHeader{
+		MagicSignature:  []byte(dbcMagicSignature),
+		RecordCount:     tw.recordCount,
+		FieldCount:      uint32(len(schema.Fields)),
+		RecordSize:      uint32(len(tw.buf)),
+		StringBlockSize: tw.strs.next,
+	}
+	if _, err = tw.w.Seek(tw.start, io.SeekStart); err != nil {
+		return errors.Wrap(err, "unable to seek back to the dbc header")
+	}
+	if err = header.WriteDBCHeader(tw.w); err != nil {
+		return err
+	}
+	_, err = tw.w.Seek(end, io.SeekStart)
+	return errors.Wrap(err, "unable to seek to the end of the dbc")
+}
+
+func (tw *TableWriter[R]) removeSpill() {
+	tw.strs.spill.Close()
+	os.Remove(tw.strs.spill.Name())
+}
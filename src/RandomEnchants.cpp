@@ -4,123 +4,52 @@
 #include "ScriptMgr.h"
 #include "Player.h"
 #include "Configuration/Config.h"
+#include "Bag.h"
 #include "Chat.h"
 #include "Item.h"
 #include "ItemEnchantmentMgr.h"
-
-// DEFAULT VALUES
-
-// Our suffix tiers can go up to 4.
-#define MAX_RAND_ENCHANT_TIERS 4
-
-double default_enchant_pcts[MAX_RAND_ENCHANT_TIERS] = {30.0, 35.0, 40.0, 45.0};
-
-bool default_announce_on_log = true;
-bool default_debug = false;
-bool default_on_loot = true;
-bool default_on_create = true;
-bool default_on_quest_reward = true;
-bool default_on_group_roll_reward_item = true;
-bool default_on_vendor_purchase = true;
-bool default_on_all_items_created = true;
-bool default_use_new_random_enchant_system = true;
-bool default_roll_player_class_preference = false;
-std::string default_login_message ="This server is running a RandomEnchants Module.";
-
-// CONFIGURATION
-
-double config_enchant_pcts[MAX_RAND_ENCHANT_TIERS] = {
-    default_enchant_pcts[0],
-    default_enchant_pcts[1],
-    default_enchant_pcts[2],
-    default_enchant_pcts[3],
-};
-bool config_announce_on_log = default_announce_on_log;
-bool config_debug = default_debug;
-bool config_on_loot = default_on_loot;
-bool config_on_create = default_on_create;
-bool config_on_quest_reward = default_on_quest_reward;
-bool config_on_group_roll_reward_item = default_on_group_roll_reward_item;
-bool config_on_vendor_purchase = default_on_vendor_purchase;
-// bool config_on_all_items_created = default_on_all_items_created;
-bool config_use_new_random_enchant_system = default_use_new_random_enchant_system;
-bool config_roll_player_class_preference = default_roll_player_class_preference;
-std::string config_login_message = default_login_message;
-
-enum Attributes
-{
-    ATTRIBUTE_STRENGTH      = 0,  
-    ATTRIBUTE_AGILITY       = 1,  
-    ATTRIBUTE_INTELLECT     = 2,  
-    ATTRIBUTE_SPIRIT        = 3,  
-    ATTRIBUTE_STAMINA       = 4,  
-    ATTRIBUTE_ATTACKPOWER   = 5,  
-    ATTRIBUTE_SPELLPOWER    = 6,  
-    ATTRIBUTE_HASTE         = 7,  
-    ATTRIBUTE_HIT           = 8,  
-    ATTRIBUTE_CRIT          = 9,  
-    ATTRIBUTE_EXPERTISE     = 10,  
-    ATTRIBUTE_DEFENSERATING = 11,  
-    ATTRIBUTE_DODGE         = 12,  
-    ATTRIBUTE_PARRY         = 13,  
-};
+#include "Corpse.h"
+#include "Creature.h"
+#include "GameObject.h"
+#include "LootMgr.h"
+#include "ObjectAccessor.h"
+#include "ObjectMgr.h"
+#include "RandomEnchants.h"
+#include "RandomEnchantsMgr.h"
+#include "RandomSuffixCoverageAnalyzer.h"
+#include "RandomSuffixMetrics.h"
+#include "RandomSuffixPreroll.h"
+#include "RandomSuffixProfile.h"
+#include "RandomSuffixScheduler.h"
+#include "RandomSuffixSimulator.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <sstream>
 
 // UTILS
-enum EnchantCategory
-{
-    ENCH_CAT_MELEE_STR_DPS  = 0,
-    ENCH_CAT_MELEE_STR_TANK = 1,
-    ENCH_CAT_MELEE_AGI_DPS  = 2,
-    ENCH_CAT_MELEE_AGI_TANK = 3,
-    ENCH_CAT_RANGED_AGI     = 4,
-    ENCH_CAT_CASTER         = 5,
-};
 
-uint32 getEnchantCategoryMask(std::vector<EnchantCategory> enchCategories)
+// getItemTemplatePlayerLevel retrieves an item template's player required level
+// It uses the item's required level if its not zero, otherwise it will rely on
+// the average required level calculated from the item template table.
+uint32 getItemTemplatePlayerLevel(ItemTemplate const* proto)
 {
-    uint32 r = 0;
-    for (auto enchCat : enchCategories)
+    if (uint32 reqLevel = proto->RequiredLevel)
     {
-        r |= 1 << enchCat;
+        return reqLevel;
     }
-    return r;
-}
-
-uint32 getAttributeMask(std::vector<Attributes> attributes)
-{
-    uint32 r = 0;
-    for (auto enchCat : attributes)
+    if (uint32 avgReqLevel = sRandomEnchantsMgr->GetAverageRequiredLevel(proto->ItemLevel))
     {
-        r |= 1 << enchCat;
+        return avgReqLevel;
     }
-    return r;
+    // If unable to query, fallback to maxlevel (NOTE: maybe would be better to default to 1 instead of max)
+    return sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
 }
 
-// getItemPlayerLevel retrieves an item's player required level
-// It uses the item's required level if its not zero, otherwise it will rely on
-// the average required level calculated from the item template table.
 uint32 getItemPlayerLevel(Item* item)
 {
-    if (uint32 reqLevel = item->GetTemplate()->RequiredLevel)
-    {
-        return reqLevel;
-    }
-    QueryResult qr = WorldDatabase.Query(R"(select ceil(avg(RequiredLevel)) from item_template where
-ItemLevel = {}
-and class in ({},{})
-and RequiredLevel != {}
-and not (name like '%qa%' or name like '%test%' or name like '%debug%' or name like '%internal%' or name like '%demo%')
-group by ItemLevel LIMIT 1)",
-        item->GetTemplate()->ItemLevel,
-        ITEM_CLASS_WEAPON, ITEM_CLASS_ARMOR,
-        0);
-    if (!qr)
-    {
-        // If unable to query, fallback to maxlevel (NOTE: maybe would be better to default to 1 instead of max)
-        return sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
-    }
-    uint32 avgReqLevel = qr->Fetch()[0].Get<uint32>();
-    return avgReqLevel;
+    RANDOM_SUFFIX_PROFILE_ZONE("getItemPlayerLevel");
+    return getItemTemplatePlayerLevel(item->GetTemplate());
 }
 
 int getLevelOffset(Item* item, Player* player = nullptr)
@@ -144,1186 +73,466 @@ int getLevelOffset(Item* item, Player* player = nullptr)
     return level;
 }
 
-auto getEnchantCategoryMaskByClassAndSpec(uint8 plrClass, uint32 plrSpec)
+// END UTILS
+
+// MAIN GET ROLL ENCHANT FUNCTIONS
+
+// querySuffixCandidates runs the roll query against the world database, either picking one random
+// candidate by weight (the active SQL engine) or returning all of them ordered by ID (shadow mode).
+// Ordering by -LOG(1 - RAND()) / Weight picks each row in proportion to its weight.
+QueryResult querySuffixCandidates(SuffixRollQuery const& q, bool allCandidates)
+{
+    return WorldDatabase.Query(R"(SELECT ID FROM item_enchantment_random_suffixes
+INNER JOIN itemrandomsuffix_dbc ON
+item_enchantment_random_suffixes.SuffixID = itemrandomsuffix_dbc.ID
+WHERE
+((MinLevel <= {} AND {} <= MaxLevel) OR (MinLevel = 0 AND MaxLevel = 0))
+AND (
+(ItemClass = 0) OR
+(ItemClass = {} AND ItemSubClassMask = 0) OR
+(ItemClass = {} AND ItemSubClassMask & {} > 0)
+)
+AND EnchantQuality = {}
+AND (
+  (AttributeMask = 0) OR
+  ((AttributeMask & {} > 0) AND (AttributeMask & ~{} = 0))
+)
+AND (
+  (EnchantCategoryMask = 0) OR
+  (EnchantCategoryMask & {} > 0)
+)
+AND Weight > 0 {})", q.Level, q.Level, q.ItemClass, q.ItemClass, q.SubClassMask, q.EnchantQuality, q.AttrMask, q.AttrMask, q.EnchCatMask,
+        allCandidates ? "ORDER BY ID" : "ORDER BY -LOG(1 - RAND()) / Weight LIMIT 1");
+}
+
+std::string joinSuffixIDs(std::vector<uint32> const& suffixIDs)
 {
-    std::vector<EnchantCategory> plrEnchCats;
-    std::vector<Attributes> plrAttrs;
-    switch (plrClass)
+    std::stringstream stream;
+    for (size_t i = 0; i < suffixIDs.size(); ++i)
     {
-        case CLASS_WARRIOR:
-            switch (plrSpec)
-            {
-            case TALENT_TREE_WARRIOR_ARMS:
-            case TALENT_TREE_WARRIOR_FURY:
-                plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
-                plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_DPS});
-                break;
-            case TALENT_TREE_WARRIOR_PROTECTION:
-                plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE,ATTRIBUTE_PARRY});
-                plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_TANK});
-                break;
-            }
-            break;
-        case CLASS_PALADIN:
-            switch (plrSpec)
-            {
-                case TALENT_TREE_PALADIN_HOLY:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-                    break;
-                case TALENT_TREE_PALADIN_PROTECTION:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE,ATTRIBUTE_PARRY});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_TANK});
-                    break;
-                case TALENT_TREE_PALADIN_RETRIBUTION:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_DPS});
-                    break;
-            }
-            break;
-        case CLASS_HUNTER:
-            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_RANGED_AGI});
-            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_AGILITY,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
-            switch (plrSpec)
-            {
-                case TALENT_TREE_HUNTER_BEAST_MASTERY:
-                case TALENT_TREE_HUNTER_MARKSMANSHIP:
-                case TALENT_TREE_HUNTER_SURVIVAL:
-                    break;
-            }
-            break;
-        case CLASS_ROGUE:
-            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_AGILITY,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
-            switch (plrSpec)
-            {
-                case TALENT_TREE_ROGUE_ASSASSINATION:
-                case TALENT_TREE_ROGUE_COMBAT:
-                case TALENT_TREE_ROGUE_SUBTLETY:
-                    break;
-            }
-            break;
-        case CLASS_PRIEST:
-            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_CRIT});
-            switch (plrSpec)
-            {
-                case TALENT_TREE_PRIEST_DISCIPLINE:
-                case TALENT_TREE_PRIEST_HOLY:
-                    break;
-                case TALENT_TREE_PRIEST_SHADOW:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_HIT});
-                    break;
-            }
-            break;
-        case CLASS_DEATH_KNIGHT:
-            switch (plrSpec)
-            {
-                case TALENT_TREE_DEATH_KNIGHT_BLOOD:
-                case TALENT_TREE_DEATH_KNIGHT_FROST:
-                case TALENT_TREE_DEATH_KNIGHT_UNHOLY:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE,ATTRIBUTE_PARRY});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_DPS, ENCH_CAT_MELEE_STR_TANK});
-                    break;
-            }
-            break;
-        case CLASS_SHAMAN:
-            switch (plrSpec)
-            {
-                case TALENT_TREE_SHAMAN_ELEMENTAL:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-                    break;
-                case TALENT_TREE_SHAMAN_ENHANCEMENT:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STAMINA,ATTRIBUTE_STRENGTH,ATTRIBUTE_AGILITY,ATTRIBUTE_INTELLECT,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_AGI_DPS});
-                    break;
-                case TALENT_TREE_SHAMAN_RESTORATION:
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_CRIT});
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-                    break;
-            }
-            break;
-        case CLASS_MAGE:
-            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
-            switch (plrSpec)
-            {
-                case TALENT_TREE_MAGE_ARCANE:
-                case TALENT_TREE_MAGE_FIRE:
-                case TALENT_TREE_MAGE_FROST:
-                    break;
-            }
-            break;
-        case CLASS_WARLOCK:
-            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
-            switch (plrSpec)
-            {
-                case TALENT_TREE_WARLOCK_AFFLICTION:
-                case TALENT_TREE_WARLOCK_DEMONOLOGY:
-                case TALENT_TREE_WARLOCK_DESTRUCTION:
-                    break;
-            }
-            break;
-        case CLASS_DRUID:
-            switch (plrSpec)
-            {
-                case TALENT_TREE_DRUID_BALANCE:
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
-                    break;
-                case TALENT_TREE_DRUID_FERAL_COMBAT:
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_AGI_DPS, ENCH_CAT_MELEE_AGI_TANK});
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_AGILITY,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE});
-                    break;
-                case TALENT_TREE_DRUID_RESTORATION:
-                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
-                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_CRIT});
-                    break;
-            }
-            break;
+        if (i != 0)
+        {
+            stream << ",";
+        }
+        stream << suffixIDs[i];
     }
-    struct retVals {
-        uint32 enchCatMask, attrMask;
-    };
-    return retVals{getEnchantCategoryMask(plrEnchCats), getAttributeMask(plrAttrs)};
+    return stream.str();
 }
 
-auto getPlayerEnchantCategoryMask(Player* player)
+// shadowCompareSuffixCandidates computes the candidate set with both engines, recording each engine's
+// latency and logging the full roll inputs if the sets differ. The pick itself is left to the active engine.
+void shadowCompareSuffixCandidates(SuffixRollQuery const& q, ItemTemplate const* proto)
 {
-    return getEnchantCategoryMaskByClassAndSpec(player->getClass(), player->GetSpec(player->GetActiveSpec()));
+    auto sqlStart = std::chrono::steady_clock::now();
+    std::vector<uint32> sqlCandidates;
+    if (QueryResult qr = querySuffixCandidates(q, true))
+    {
+        do
+        {
+            sqlCandidates.push_back(qr->Fetch()[0].Get<uint32>());
+        } while (qr->NextRow());
+    }
+    auto inProcessStart = std::chrono::steady_clock::now();
+    std::vector<uint32> inProcessCandidates;
+    sRandomEnchantsMgr->GetSuffixCandidates(q, inProcessCandidates);
+    auto inProcessEnd = std::chrono::steady_clock::now();
+
+    bool match = sqlCandidates == inProcessCandidates;
+    sRandomEnchantsMgr->RecordShadowSample(
+        std::chrono::duration_cast<std::chrono::microseconds>(inProcessStart - sqlStart).count(),
+        std::chrono::duration_cast<std::chrono::microseconds>(inProcessEnd - inProcessStart).count(),
+        match);
+    if (match)
+    {
+        return;
+    }
+    std::vector<uint32> sqlOnly;
+    std::vector<uint32> inProcessOnly;
+    std::set_difference(sqlCandidates.begin(), sqlCandidates.end(), inProcessCandidates.begin(), inProcessCandidates.end(), std::back_inserter(sqlOnly));
+    std::set_difference(inProcessCandidates.begin(), inProcessCandidates.end(), sqlCandidates.begin(), sqlCandidates.end(), std::back_inserter(inProcessOnly));
+    LOG_ERROR("module", "RANDOM_ENCHANT: Shadow mode candidate mismatch for item {}, Item ID {}", proto->Name1, proto->ItemId);
+    LOG_ERROR("module", "                level {}, enchantQuality {}, item_class {}, subclassmask {}, enchCatMask {}, attrMask {}", q.Level, q.EnchantQuality, q.ItemClass, q.SubClassMask, q.EnchCatMask, q.AttrMask);
+    LOG_ERROR("module", "                sql candidates {}, in-process candidates {}", sqlCandidates.size(), inProcessCandidates.size());
+    LOG_ERROR("module", "                only in sql: [{}]", joinSuffixIDs(sqlOnly));
+    LOG_ERROR("module", "                only in-process: [{}]", joinSuffixIDs(inProcessOnly));
 }
 
-std::unordered_map<uint32, uint8> specToClass = {
-    {TALENT_TREE_WARRIOR_ARMS,          CLASS_WARRIOR},
-    {TALENT_TREE_WARRIOR_FURY,          CLASS_WARRIOR},
-    {TALENT_TREE_WARRIOR_PROTECTION,    CLASS_WARRIOR},
-    {TALENT_TREE_PALADIN_HOLY,          CLASS_PALADIN},
-    {TALENT_TREE_PALADIN_PROTECTION,    CLASS_PALADIN},
-    {TALENT_TREE_PALADIN_RETRIBUTION,   CLASS_PALADIN},
-    {TALENT_TREE_HUNTER_BEAST_MASTERY,  CLASS_HUNTER},
-    {TALENT_TREE_HUNTER_MARKSMANSHIP,   CLASS_HUNTER},
-    {TALENT_TREE_HUNTER_SURVIVAL,       CLASS_HUNTER},
-    {TALENT_TREE_ROGUE_ASSASSINATION,   CLASS_ROGUE},
-    {TALENT_TREE_ROGUE_COMBAT,          CLASS_ROGUE},
-    {TALENT_TREE_ROGUE_SUBTLETY,        CLASS_ROGUE},
-    {TALENT_TREE_PRIEST_DISCIPLINE,     CLASS_PRIEST},
-    {TALENT_TREE_PRIEST_HOLY,           CLASS_PRIEST},
-    {TALENT_TREE_PRIEST_SHADOW,         CLASS_PRIEST},
-    {TALENT_TREE_DEATH_KNIGHT_BLOOD,    CLASS_DEATH_KNIGHT},
-    {TALENT_TREE_DEATH_KNIGHT_FROST,    CLASS_DEATH_KNIGHT},
-    {TALENT_TREE_DEATH_KNIGHT_UNHOLY,   CLASS_DEATH_KNIGHT},
-    {TALENT_TREE_SHAMAN_ELEMENTAL,      CLASS_SHAMAN},
-    {TALENT_TREE_SHAMAN_ENHANCEMENT,    CLASS_SHAMAN},
-    {TALENT_TREE_SHAMAN_RESTORATION,    CLASS_SHAMAN},
-    {TALENT_TREE_MAGE_ARCANE,           CLASS_MAGE},
-    {TALENT_TREE_MAGE_FIRE,             CLASS_MAGE},
-    {TALENT_TREE_MAGE_FROST,            CLASS_MAGE},
-    {TALENT_TREE_WARLOCK_AFFLICTION,    CLASS_WARLOCK},
-    {TALENT_TREE_WARLOCK_DEMONOLOGY,    CLASS_WARLOCK},
-    {TALENT_TREE_WARLOCK_DESTRUCTION,   CLASS_WARLOCK},
-    {TALENT_TREE_DRUID_BALANCE,         CLASS_DRUID},
-    {TALENT_TREE_DRUID_FERAL_COMBAT,    CLASS_DRUID},
-    {TALENT_TREE_DRUID_RESTORATION,     CLASS_DRUID},
-};
-
-std::unordered_map<uint32, std::string> specToSpecNames = {
-    {TALENT_TREE_WARRIOR_ARMS,          "WARRIOR_ARMS"},
-    {TALENT_TREE_WARRIOR_FURY,          "WARRIOR_FURY"},
-    {TALENT_TREE_WARRIOR_PROTECTION,    "WARRIOR_PROTECTION"},
-    {TALENT_TREE_PALADIN_HOLY,          "PALADIN_HOLY"},
-    {TALENT_TREE_PALADIN_PROTECTION,    "PALADIN_PROTECTION"},
-    {TALENT_TREE_PALADIN_RETRIBUTION,   "PALADIN_RETRIBUTION"},
-    {TALENT_TREE_HUNTER_BEAST_MASTERY,  "HUNTER_BEAST_MASTERY"},
-    {TALENT_TREE_HUNTER_MARKSMANSHIP,   "HUNTER_MARKSMANSHIP"},
-    {TALENT_TREE_HUNTER_SURVIVAL,       "HUNTER_SURVIVAL"},
-    {TALENT_TREE_ROGUE_ASSASSINATION,   "ROGUE_ASSASSINATION"},
-    {TALENT_TREE_ROGUE_COMBAT,          "ROGUE_COMBAT"},
-    {TALENT_TREE_ROGUE_SUBTLETY,        "ROGUE_SUBTLETY"},
-    {TALENT_TREE_PRIEST_DISCIPLINE,     "PRIEST_DISCIPLINE"},
-    {TALENT_TREE_PRIEST_HOLY,           "PRIEST_HOLY"},
-    {TALENT_TREE_PRIEST_SHADOW,         "PRIEST_SHADOW"},
-    {TALENT_TREE_DEATH_KNIGHT_BLOOD,    "DEATH_KNIGHT_BLOOD"},
-    {TALENT_TREE_DEATH_KNIGHT_FROST,    "DEATH_KNIGHT_FROST"},
-    {TALENT_TREE_DEATH_KNIGHT_UNHOLY,   "DEATH_KNIGHT_UNHOLY"},
-    {TALENT_TREE_SHAMAN_ELEMENTAL,      "SHAMAN_ELEMENTAL"},
-    {TALENT_TREE_SHAMAN_ENHANCEMENT,    "SHAMAN_ENHANCEMENT"},
-    {TALENT_TREE_SHAMAN_RESTORATION,    "SHAMAN_RESTORATION"},
-    {TALENT_TREE_MAGE_ARCANE,           "MAGE_ARCANE"},
-    {TALENT_TREE_MAGE_FIRE,             "MAGE_FIRE"},
-    {TALENT_TREE_MAGE_FROST,            "MAGE_FROST"},
-    {TALENT_TREE_WARLOCK_AFFLICTION,    "WARLOCK_AFFLICTION"},
-    {TALENT_TREE_WARLOCK_DEMONOLOGY,    "WARLOCK_DEMONOLOGY"},
-    {TALENT_TREE_WARLOCK_DESTRUCTION,   "WARLOCK_DESTRUCTION"},
-    {TALENT_TREE_DRUID_BALANCE,         "DRUID_BALANCE"},
-    {TALENT_TREE_DRUID_FERAL_COMBAT,    "DRUID_FERAL_COMBAT"},
-    {TALENT_TREE_DRUID_RESTORATION,     "DRUID_RESTORATION"},
-};
-
-typedef struct itemPotentialRoleCheck {
-    bool isRanged;
-    bool isMelee;
-    bool isPhysDPS;
-    bool isStr;
-    bool isAgi;
-    bool isTank;
-    bool isCaster;
-
-    itemPotentialRoleCheck(): isRanged(false), isMelee(false), isPhysDPS(false), isStr(false), isAgi(false), isTank(false), isCaster(false) {}
+// WorldSuffixCandidateSource picks candidates with the configured engine, checking them against the suffix DBC store.
+// It never touches the item or the player, so the pre-roll worker rolls with it too.
+class WorldSuffixCandidateSource : public SuffixCandidateSource
+{
+public:
+    explicit WorldSuffixCandidateSource(RandomEnchantsConfig const& config)
+        : _config(config), _catalogSource(sRandomEnchantsMgr->GetSuffixCatalog(), sRandomEnchantsMgr->GetSuffixColumns(),
+            sRandomEnchantsMgr->GetSuffixAliasTables()) { }
 
-} itemPotentialRoleCheck;
+    void OnRollQuery(ItemTemplate const* proto, SuffixRollQuery const& query) override
+    {
+        if (_config.ShadowSamplePct > 0.0 && rand_chance() < _config.ShadowSamplePct)
+        {
+            shadowCompareSuffixCandidates(query, proto);
+        }
+    }
 
-auto getItemPotentialRoles(Item* item)
-{
-    itemPotentialRoleCheck r;
-    // role checks
-    for (uint8 i = 0; i < MAX_ITEM_PROTO_STATS; ++i)
+    int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) override
     {
-        if (i >= item->GetTemplate()->StatsCount)
+        if (_config.SuffixEngine == SUFFIX_ENGINE_IN_PROCESS)
         {
-            break;
+            return _catalogSource.PickCandidate(query, rng);
         }
-        switch (item->GetTemplate()->ItemStat[i].ItemStatType)
+        QueryResult qr = querySuffixCandidates(query, false);
+        if (!qr)
         {
-            case ITEM_MOD_AGILITY:
-                r.isAgi = true;
-                continue;
-            case ITEM_MOD_STRENGTH:
-                r.isStr = true;
-                continue;
-            case ITEM_MOD_INTELLECT:
-            case ITEM_MOD_SPIRIT:
-                r.isCaster = true;
-                continue;
-            case ITEM_MOD_HIT_MELEE_RATING:
-            case ITEM_MOD_CRIT_MELEE_RATING:
-            case ITEM_MOD_HASTE_MELEE_RATING:
-            case ITEM_MOD_EXPERTISE_RATING:
-                r.isMelee = true;
-                continue;
-            case ITEM_MOD_HIT_RANGED_RATING:
-            case ITEM_MOD_CRIT_RANGED_RATING:
-            case ITEM_MOD_HASTE_RANGED_RATING:
-            case ITEM_MOD_RANGED_ATTACK_POWER:
-                r.isRanged = true;
-                continue;
-            case ITEM_MOD_HIT_SPELL_RATING:
-            case ITEM_MOD_SPELL_DAMAGE_DONE:
-            case ITEM_MOD_SPELL_PENETRATION:
-                r.isCaster = true;
-                continue;
-            case ITEM_MOD_CRIT_SPELL_RATING:
-            case ITEM_MOD_HASTE_SPELL_RATING:
-            case ITEM_MOD_SPELL_POWER:
-            // TODO: Check proto->HasSpellPowerStat() for spellpower
-            // TODO: Check SPELL_AURA_MOD_POWER_COST_SCHOOL for specific spell schools (e.g. shadow, holy etc)
-                r.isCaster = true;
-                continue;
-            case ITEM_MOD_SPELL_HEALING_DONE:
-            case ITEM_MOD_MANA_REGENERATION:
-                r.isCaster = true;
-                continue;
-            case ITEM_MOD_ATTACK_POWER:
-            case ITEM_MOD_ARMOR_PENETRATION_RATING:
-                r.isPhysDPS = true;
-                continue;
-            case ITEM_MOD_DEFENSE_SKILL_RATING:
-            case ITEM_MOD_DODGE_RATING:
-            case ITEM_MOD_PARRY_RATING:
-                r.isTank = true;
-                continue;
-            case ITEM_MOD_BLOCK_RATING:
-            case ITEM_MOD_BLOCK_VALUE:
-                r.isTank = true;
-                continue;
-            case ITEM_MOD_STAMINA:
-            case ITEM_MOD_HEALTH:
-            case ITEM_MOD_MANA:
-            case ITEM_MOD_HEALTH_REGEN:
-            case ITEM_MOD_HIT_RATING:
-            case ITEM_MOD_CRIT_RATING:
-            case ITEM_MOD_HASTE_RATING:
-            case ITEM_MOD_HIT_TAKEN_RATING:         // Miss Related
-            case ITEM_MOD_HIT_TAKEN_MELEE_RATING:   // Miss Related
-            case ITEM_MOD_HIT_TAKEN_RANGED_RATING:  // Miss Related
-            case ITEM_MOD_HIT_TAKEN_SPELL_RATING:   // Miss Related
-            case ITEM_MOD_CRIT_TAKEN_RATING:        // Resilience related
-            case ITEM_MOD_RESILIENCE_RATING:        // Resilience related
-            case ITEM_MOD_CRIT_TAKEN_MELEE_RATING:  // Resilience related
-            case ITEM_MOD_CRIT_TAKEN_RANGED_RATING: // Resilience related
-            case ITEM_MOD_CRIT_TAKEN_SPELL_RATING:  // Resilience related
-                continue;
+            return -1;
         }
+        return qr->Fetch()[0].Get<uint32>();
     }
-    // TODO: Get DefenseRating equip check
-    return r;
-}
 
-auto itemRoleRoleCheckToClassSpecs_Warrior(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (itemClass == ITEM_CLASS_ARMOR && itemSubClass == ITEM_SUBCLASS_ARMOR_SHIELD) {
-        if (rc.isMelee || rc.isPhysDPS || rc.isStr || rc.isTank || forceAddAll) {
-            specPool.insert({TALENT_TREE_WARRIOR_PROTECTION});
+    bool GetMinAllocPct(uint32 suffixId, uint32& minAllocPct) override
+    {
+        ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(suffixId);
+        if (!item_rand)
+        {
+            return false;
         }
-        return specPool;
-    }
-    if (rc.isTank) {
-        specPool.insert({TALENT_TREE_WARRIOR_PROTECTION});
-    } else if (!rc.isAgi && (rc.isMelee || rc.isPhysDPS)) {
-        specPool.insert({TALENT_TREE_WARRIOR_ARMS, TALENT_TREE_WARRIOR_FURY});
-    } else if (rc.isStr || forceAddAll) {
-        specPool.insert({TALENT_TREE_WARRIOR_PROTECTION, TALENT_TREE_WARRIOR_ARMS, TALENT_TREE_WARRIOR_FURY});
+        minAllocPct = 3567587328;
+        for (uint8 k = 0; k != MAX_ITEM_ENCHANTMENT_EFFECTS; ++k)
+        {
+            if (item_rand->AllocationPct[k] > 100)
+            {
+                // NOTE: Any value set below 100, is either a 0, or a 1, which is used to denote either not set,
+                // or set but not really a stat ench, this is *Hardcoded*.
+                if (minAllocPct > item_rand->AllocationPct[k])
+                {
+                    minAllocPct = item_rand->AllocationPct[k];
+                }
+            }
+        }
+        return true;
     }
-    return specPool;
+
+private:
+    RandomEnchantsConfig const& _config;
+    AliasSuffixSource _catalogSource;
+};
+
+int32 rollWorldSuffix(RandomEnchantsConfig const& config, ItemTemplate const* proto, SuffixRollContext const& ctx, SuffixRollSettings const& settings,
+    SuffixRollResult* result)
+{
+    WorldSuffixCandidateSource candidateSource(config);
+    return rollSuffix(proto, ctx, settings, candidateSource, result);
 }
 
-auto itemRoleRoleCheckToClassSpecs_Paladin(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (itemClass == ITEM_CLASS_ARMOR && itemSubClass == ITEM_SUBCLASS_ARMOR_SHIELD) {
-        if (rc.isMelee || rc.isPhysDPS || rc.isStr || rc.isTank) {
-            specPool.insert({TALENT_TREE_PALADIN_PROTECTION});
-        } else if (rc.isCaster) {
-            specPool.insert({TALENT_TREE_PALADIN_HOLY});
-        } else if (forceAddAll) {
-            specPool.insert({TALENT_TREE_PALADIN_HOLY, TALENT_TREE_PALADIN_PROTECTION});
-        }
-        return specPool;
-    }
-    if (itemInvType == INVTYPE_HOLDABLE) {
-        if (rc.isCaster || forceAddAll) {
-            specPool.insert({TALENT_TREE_PALADIN_HOLY});
-        }
-        return specPool;
-    }
-    if (rc.isTank) {
-        specPool.insert({TALENT_TREE_PALADIN_PROTECTION});
-    } else if (rc.isCaster) {
-        specPool.insert({TALENT_TREE_PALADIN_HOLY});
-    } else if (!rc.isAgi && (rc.isMelee || rc.isPhysDPS)) {
-        specPool.insert({TALENT_TREE_PALADIN_RETRIBUTION});
-    } else if (rc.isStr || forceAddAll) {
-        specPool.insert({TALENT_TREE_PALADIN_HOLY, TALENT_TREE_PALADIN_PROTECTION, TALENT_TREE_PALADIN_RETRIBUTION});
-    }
-    return specPool;
+// getItemTemplateRollContext is the roll context of an item the player has yet to get, canUseItem is only asked for
+// when rolling with the player class preference
+template <typename CanUseItem>
+SuffixRollContext getItemTemplateRollContext(Player* player, ItemTemplate const* proto, CanUseItem&& canUseItem, SuffixRollSettings const& settings,
+    SuffixRollSource source)
+{
+    SuffixRollContext ctx;
+    ctx.ItemPlayerLevel = getItemTemplatePlayerLevel(proto);
+    ctx.SuffixFactor = sRandomEnchantsMgr->GetItemSuffixFactor(proto->ItemId);
+    ctx.PlayerClass = player->getClass();
+    ctx.PlayerSpec = player->GetSpec(player->GetActiveSpec());
+    ctx.PlayerLevel = player->GetLevel();
+    ctx.PlayerCanUseItem = settings.RollPlayerClassPreference && canUseItem();
+    ctx.Source = source;
+    ctx.Seed = rand32();
+    return ctx;
 }
 
-auto itemRoleRoleCheckToClassSpecs_Hunter(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (rc.isRanged || rc.isAgi || (!rc.isStr && rc.isPhysDPS) || forceAddAll) {
-        specPool.insert({
-            TALENT_TREE_HUNTER_BEAST_MASTERY,
-            TALENT_TREE_HUNTER_MARKSMANSHIP,
-            TALENT_TREE_HUNTER_SURVIVAL,
-        });
-    }
-    return specPool;
+SuffixRollContext getRollContext(Player* player, Item* item, SuffixRollSettings const& settings, SuffixRollSource source)
+{
+    RANDOM_SUFFIX_PROFILE_ZONE("getRollContext");
+    return getItemTemplateRollContext(player, item->GetTemplate(), [player, item]() { return player->CanUseItem(item, false) == EQUIP_ERR_OK; },
+        settings, source);
 }
 
-auto itemRoleRoleCheckToClassSpecs_Rogue(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (rc.isAgi || (!rc.isStr && (rc.isMelee || rc.isPhysDPS)) || forceAddAll) {
-        specPool.insert({
-            TALENT_TREE_ROGUE_ASSASSINATION,
-            TALENT_TREE_ROGUE_COMBAT,
-            TALENT_TREE_ROGUE_SUBTLETY,
-        });
+// applySuffixRoll gives the item the suffix the roll ended with, telling the player about it
+void applySuffixRoll(Player* player, Item* item, SuffixRollContext const& ctx, SuffixRollResult const& result)
+{
+    ItemTemplate const* proto = item->GetTemplate();
+    sRandomEnchantsMgr->CaptureRoll(proto, ctx);
+    sRandomSuffixMetrics->RecordRoll(proto, SuffixRollSource(ctx.Source), result);
+    if (result.SuffixID < 0)
+    {
+        return;
+    }
+    // Apply the suffix to the item
+    ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(result.SuffixID);
+    if (!item_rand)
+    {
+        return;
     }
-    return specPool;
+    item->SetItemRandomProperties(-result.SuffixID);
+    RANDOM_SUFFIX_PROFILE_ZONE("applySuffixRoll chat message");
+    ChatHandler chathandle = ChatHandler(player->GetSession());
+    uint32 loc = player->GetSession()->GetSessionDbLocaleIndex();
+    std::string suffixName = item_rand->Name[loc];
+    chathandle.PSendSysMessage("|cffFF0000 %s |rhas rolled the suffix|cffFF0000 %s |r!", proto->Name1.c_str(), suffixName);
 }
 
-auto itemRoleRoleCheckToClassSpecs_Priest(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (rc.isCaster || forceAddAll) {
-        specPool.insert({
-            TALENT_TREE_PRIEST_DISCIPLINE,
-            TALENT_TREE_PRIEST_HOLY,
-            TALENT_TREE_PRIEST_SHADOW,
-        });
+void RollPossibleEnchant(Player* player, Item* item, SuffixRollSource source)
+{
+    RANDOM_SUFFIX_PROFILE_ZONE("RollPossibleEnchant");
+    ItemTemplate const* proto = item->GetTemplate();
+    if (!isRollableItemTemplate(proto))
+    {
+        return;
     }
-    return specPool;
-}
 
-auto itemRoleRoleCheckToClassSpecs_DeathKnight(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (rc.isTank) {
-        specPool.insert({TALENT_TREE_DEATH_KNIGHT_BLOOD});
-    } else if (rc.isMelee || rc.isPhysDPS || rc.isStr || rc.isAgi || forceAddAll) {
-        specPool.insert({TALENT_TREE_DEATH_KNIGHT_BLOOD,TALENT_TREE_DEATH_KNIGHT_FROST,TALENT_TREE_DEATH_KNIGHT_UNHOLY});
+    if (item->GetItemRandomPropertyId() != 0)
+    {
+        // If already have enchant, we shouldnt apply a new one
+        return;
     }
-    return specPool;
+
+    RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+    SuffixRollContext ctx = getRollContext(player, item, config->RollSettings, source);
+    SuffixRollResult result;
+    rollWorldSuffix(*config, proto, ctx, config->RollSettings, &result);
+    applySuffixRoll(player, item, ctx, result);
 }
 
-auto itemRoleRoleCheckToClassSpecs_Shaman(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (itemClass == ITEM_CLASS_ARMOR && itemSubClass == ITEM_SUBCLASS_ARMOR_SHIELD) {
-        if (rc.isCaster || forceAddAll) {
-            specPool.insert({TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
-        }
-        return specPool;
-    }
-    if (itemInvType == INVTYPE_HOLDABLE) {
-        if (rc.isCaster || forceAddAll) {
-            specPool.insert({TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
-        }
-        return specPool;
-    }
-    if (rc.isAgi || (!rc.isStr && (rc.isMelee || rc.isPhysDPS))) {
-        specPool.insert({TALENT_TREE_SHAMAN_ENHANCEMENT});
-    } else if (rc.isCaster) {
-        specPool.insert({TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
-    } else if (forceAddAll) {
-        specPool.insert({TALENT_TREE_SHAMAN_ENHANCEMENT,TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
+// prerollItemTemplate queues a pre-roll of an item the player is about to get, attached to owner
+void prerollItemTemplate(Player* player, ItemTemplate const* proto, SuffixRollSource source, PrerollOwner ownerType, uint64 owner)
+{
+    if (!proto || !isRollableItemTemplate(proto))
+    {
+        return;
     }
-    return specPool;
+    RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+    SuffixRollSettings const& settings = config->RollSettings;
+    SuffixRollContext ctx = getItemTemplateRollContext(player, proto, [player, proto]() { return player->CanUseItem(proto) == EQUIP_ERR_OK; },
+        settings, source);
+    sRandomSuffixPreroll->Preroll(ownerType, owner, proto, ctx, settings);
 }
 
-auto itemRoleRoleCheckToClassSpecs_Mage(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (rc.isCaster || forceAddAll) {
-        specPool.insert({
-            TALENT_TREE_MAGE_ARCANE,
-            TALENT_TREE_MAGE_FIRE,
-            TALENT_TREE_MAGE_FROST,
-        });
+// prerollVendorItem pre-rolls the next item of the vendor the player buys, unless it already has a pre-roll
+void prerollVendorItem(Player* player, ItemTemplate const* proto)
+{
+    uint64 owner = player->GetGUID().GetRawValue();
+    if (proto && !sRandomSuffixPreroll->HasPreroll(PREROLL_OWNER_VENDOR, owner, proto->ItemId))
+    {
+        prerollItemTemplate(player, proto, ROLL_SOURCE_VENDOR_PURCHASE, PREROLL_OWNER_VENDOR, owner);
     }
-    return specPool;
 }
 
-auto itemRoleRoleCheckToClassSpecs_Warlock(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (rc.isCaster || forceAddAll) {
-        specPool.insert({
-            TALENT_TREE_WARLOCK_AFFLICTION,
-            TALENT_TREE_WARLOCK_DEMONOLOGY,
-            TALENT_TREE_WARLOCK_DESTRUCTION,
-        });
+// applyPrerolledSuffix gives a new item the ready pre-roll attached to owner, returns false if the item still has to
+// be rolled
+bool applyPrerolledSuffix(Player* player, Item* item, SuffixRollSource source, PrerollOwner ownerType, uint64 owner)
+{
+    ItemTemplate const* proto = item->GetTemplate();
+    if (!isRollableItemTemplate(proto) || item->GetItemRandomPropertyId() != 0)
+    {
+        return false;
+    }
+    RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+    SuffixRollSettings const& settings = config->RollSettings;
+    SuffixRollContext ctx = getRollContext(player, item, settings, source);
+    SuffixRollResult result;
+    if (!sRandomSuffixPreroll->Take(ownerType, owner, proto, settings, ctx, result))
+    {
+        return false;
     }
-    return specPool;
+    applySuffixRoll(player, item, ctx, result);
+    return true;
 }
 
-auto itemRoleRoleCheckToClassSpecs_Druid(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
-    std::set<uint32> specPool;
-    if (itemInvType == INVTYPE_HOLDABLE) {
-        if (rc.isCaster || forceAddAll) {
-            specPool.insert({TALENT_TREE_DRUID_BALANCE,TALENT_TREE_DRUID_RESTORATION});
-        }
-        return specPool;
+// getPlayerLoot finds the loot the player has open, the same way the core does when an item of it is looted
+Loot* getPlayerLoot(Player* player)
+{
+    ObjectGuid lootGuid = player->GetLootGUID();
+    if (lootGuid.IsGameObject())
+    {
+        GameObject* go = player->GetMap()->GetGameObject(lootGuid);
+        return go ? &go->loot : nullptr;
     }
-    if (rc.isTank || rc.isAgi || (!rc.isStr && (rc.isMelee || rc.isPhysDPS))) {
-        specPool.insert({TALENT_TREE_DRUID_FERAL_COMBAT});
-    } else if (rc.isCaster) {
-        specPool.insert({TALENT_TREE_DRUID_BALANCE,TALENT_TREE_DRUID_RESTORATION});
-    } else if (forceAddAll) {
-        specPool.insert({TALENT_TREE_DRUID_BALANCE,TALENT_TREE_DRUID_FERAL_COMBAT,TALENT_TREE_DRUID_RESTORATION});
+    if (lootGuid.IsItem())
+    {
+        Item* item = player->GetItemByGuid(lootGuid);
+        return item ? &item->loot : nullptr;
+    }
+    if (lootGuid.IsCorpse())
+    {
+        Corpse* bones = ObjectAccessor::GetCorpse(*player, lootGuid);
+        return bones ? &bones->loot : nullptr;
     }
-    return specPool;
+    Creature* creature = player->GetMap()->GetCreature(lootGuid);
+    return creature ? &creature->loot : nullptr;
 }
 
-
-// gets the item enchant category mask for a given item
-auto getItemEnchantCategoryMask(Item* item)
+// applyPrerolledLootSuffix gives an item looted by the player the pre-roll made when its loot was filled
+bool applyPrerolledLootSuffix(Player* player, Item* item)
 {
-    auto r = getItemPotentialRoles(item);
-    auto itemPlayerLevel = getItemPlayerLevel(item);
-    std::set<uint32> specPool; 
-    auto ic = item->GetTemplate()->Class;
-    auto isc = item->GetTemplate()->SubClass;
-    auto ivt = item->GetTemplate()->InventoryType;
-    // ITEM CLASS + SUB CLASS - ARMOUR
-    bool isCloth = false;
-    bool isLeather = false;
-    bool isMail = false;
-    bool isPlate = false;
-    bool isIdol = false;
-    bool isLibram = false;
-    bool isTotem = false;
-    bool isSigil = false;
-    bool isShield = false;
-    // ITEM CLASS + SUB CLASS - WEAPONS
-    bool isBow = false;
-    bool isCrossbow = false;
-    bool isGun = false;
-    bool isThrown = false;
-    bool isWand = false;
-    bool isDagger = false;
-    bool isFist = false;
-    bool isAxe = false;
-    bool isMace = false;
-    bool isSword = false;
-    bool isPolearm = false;
-    bool isStaff = false;
-    bool isAxe2 = false;
-    bool isMace2 = false;
-    bool isSword2 = false;
-    // INV TYPE FOR MISC SLOTS
-    bool isNeck = false; 
-    bool isCloak = false; 
-    bool isHoldable = false; 
-    bool isFinger = false; 
-    bool isTrinket = false; 
-    switch (ic)
+    if (!sRandomSuffixPreroll->IsEnabled())
     {
-        case ITEM_CLASS_ARMOR:
-            switch (isc)
-            {
-                case ITEM_SUBCLASS_ARMOR_CLOTH:
-                    isCloth = ivt != INVTYPE_CLOAK;
-                    if (isCloth) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_ARMOR_LEATHER:
-                    isLeather = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (itemPlayerLevel > 40) {
-                        if (specPool.empty()) {
-                            // Nothing set, we include all potential leather wearing specs.
-                            specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                            specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                        }
-                        // If leather item above level 40, we can safely break away
-                        break;
-                    }
-                    // NOTE: FALLTHROUGH TO MAIL, there is a potential that isSet is not set at all
-                    //       but we try to bank on the chance that the conditionals in mail are set.
-                case ITEM_SUBCLASS_ARMOR_MAIL:
-                    // isMail gear check, but this case check can be fallenthrough from the LEATHER
-                    // in that case if isLeather is true, isMail will still be set false.
-                    isMail = !isLeather;
-                    // isEventualMailUserItem check. This checks for actual mail item is above lvl 40 or is leather below level 40.
-                    if (bool isEventualMailUserItem = !isMail || itemPlayerLevel > 40)
-                    {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                        if (specPool.empty())
-                        {
-                            if (!isMail)
-                            {
-                                // received fallthru from leather item + nothing set, we include all
-                                // potential leather wearing specs.
-                                specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                                specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                            }
-                            specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                            specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        }
-                        break;
-                    }
-                    // NOTE: fallthrough to PLATE item. there is a potential that isSet is not set at all
-                    //       but we try to bank on the chance that the conditionals in the next case section are set.
-                case ITEM_SUBCLASS_ARMOR_PLATE:
-                    // isMail gear check, but this case check can be fallenthrough from the LEATHER
-                    // in that case if isLeather is true, isMail will still be set false.
-                    isPlate = !isMail;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_ARMOR_SHIELD:
-                    isShield = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_ARMOR_IDOL:
-                    isIdol = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_ARMOR_LIBRAM:
-                    isLibram = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_ARMOR_TOTEM:
-                    isTotem = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_ARMOR_SIGIL:
-                    isSigil = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                    }
-                    break;
-            }
-            break;
-        case ITEM_CLASS_WEAPON:
-            switch (isc)
-            {
-                case ITEM_SUBCLASS_WEAPON_BOW:
-                    isBow = true;
-                    // NOTE: fallthrough to Crossbow item. there is a potential that isSet is not set at all
-                    //       all ranged item types are evaluated together
-                case ITEM_SUBCLASS_WEAPON_CROSSBOW:
-                    isCrossbow = !isBow;
-                    // NOTE: fallthrough to Gun item. there is a potential that isSet is not set at all
-                    //       all ranged item types are evaluated together
-                case ITEM_SUBCLASS_WEAPON_GUN:
-                    isGun = !isBow && !isCrossbow;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    // NOTE: fallthrough to Thrown item. there is a potential that isSet is not set at all
-                    //       all ranged item types are evaluated together
-                case ITEM_SUBCLASS_WEAPON_THROWN:
-                    isThrown = !isBow && !isCrossbow && !isGun;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_WAND:
-                    isWand = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-                    break;
-                case ITEM_SUBCLASS_WEAPON_DAGGER:
-                    isDagger = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_FIST:
-                    isFist = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_AXE:
-                    isAxe = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_MACE:
-                    isMace = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_SWORD:
-                    isSword = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_POLEARM:
-                    isPolearm = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_STAFF:
-                    isStaff = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_AXE2:
-                    isAxe2 = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_MACE2:
-                    isMace2 = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_SWORD2:
-                    isSword2 = true;
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-                    if (specPool.empty()) {
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                    }
-                    break;
-                case ITEM_SUBCLASS_WEAPON_SPEAR:
-                case ITEM_SUBCLASS_WEAPON_obsolete:
-                case ITEM_SUBCLASS_WEAPON_EXOTIC:
-                case ITEM_SUBCLASS_WEAPON_EXOTIC2:
-                case ITEM_SUBCLASS_WEAPON_MISC:
-                case ITEM_SUBCLASS_WEAPON_FISHING_POLE:
-                    break;
-            }
-            break;
+        return false;
     }
+    Loot* loot = getPlayerLoot(player);
+    return loot && applyPrerolledSuffix(player, item, ROLL_SOURCE_LOOT, PREROLL_OWNER_LOOT, uint64(uintptr_t(loot)));
+}
 
-    switch (ivt)
+// isReforgeableItem checks if the item can have its suffix rerolled: it rolls custom suffixes and has either none
+// or one of ours, never a suffix or random property of the core. Items waiting for their first roll are left alone.
+bool isReforgeableItem(Player* player, Item* item)
+{
+    if (!isRollableItemTemplate(item->GetTemplate()) || sRandomSuffixScheduler->IsPending(player->FindMap(), item))
     {
-        case INVTYPE_HOLDABLE:
-            isHoldable = true;
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-            break;
-        case INVTYPE_NECK:
-            isNeck = true;
-            // fallthru
-        case INVTYPE_CLOAK:
-            isCloak = !isNeck;
-            // fallthru
-        case INVTYPE_FINGER:
-            isFinger = !isNeck && !isCloak;
-            // fallthru
-        case INVTYPE_TRINKET:
-            isTrinket = !isFinger && !isNeck && !isCloak;
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
-            specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
-            if (specPool.empty()) {
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
-                specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
-            }
-            break;
+        return false;
     }
-    if (config_debug)
+    int32 randomPropertyId = item->GetItemRandomPropertyId();
+    return randomPropertyId == 0 || (randomPropertyId < 0 && sRandomEnchantsMgr->IsCustomSuffix(-randomPropertyId));
+}
+
+// canPayReforge checks if the player has the gold and tokens for reforging one more item
+bool canPayReforge(Player* player, RandomEnchantsConfig const& config)
+{
+    if (config.ReforgeCostCopper && !player->HasEnoughMoney(config.ReforgeCostCopper))
     {
-        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT START <<<<<");
-        LOG_INFO("module", "RANDOM_ENCHANT: Getting item enchant mask, checks below:");
-        LOG_INFO("module", "       For item {}, Item ID is: {}", item->GetTemplate()->Name1, item->GetTemplate()->ItemId);
-        LOG_INFO("module", "       >>> Printing detected item roles/stats profile");
-        LOG_INFO("module", "                isRanged = {}", r.isRanged);
-        LOG_INFO("module", "                isMelee = {}", r.isMelee);
-        LOG_INFO("module", "                isPhysDPS = {}", r.isPhysDPS);
-        LOG_INFO("module", "                isStr = {}", r.isStr);
-        LOG_INFO("module", "                isAgi = {}", r.isAgi);
-        LOG_INFO("module", "                isTank = {}", r.isTank);
-        LOG_INFO("module", "                isCaster = {}", r.isCaster);
-        LOG_INFO("module", "       >>> Printing detected item slots");
-        LOG_INFO("module", "                isCloth = {}", isCloth);
-        LOG_INFO("module", "                isLeather = {}", isLeather);
-        LOG_INFO("module", "                isMail = {}", isMail);
-        LOG_INFO("module", "                isPlate = {}", isPlate);
-        LOG_INFO("module", "                isIdol = {}", isIdol);
-        LOG_INFO("module", "                isLibram = {}", isLibram);
-        LOG_INFO("module", "                isTotem = {}", isTotem);
-        LOG_INFO("module", "                isSigil = {}", isSigil);
-        LOG_INFO("module", "                isShield = {}", isShield);
-        LOG_INFO("module", "                isBow = {}", isBow);
-        LOG_INFO("module", "                isCrossbow = {}", isCrossbow);
-        LOG_INFO("module", "                isGun = {}", isGun);
-        LOG_INFO("module", "                isThrown = {}", isThrown);
-        LOG_INFO("module", "                isWand = {}", isWand);
-        LOG_INFO("module", "                isDagger = {}", isDagger);
-        LOG_INFO("module", "                isFist = {}", isFist);
-        LOG_INFO("module", "                isAxe = {}", isAxe);
-        LOG_INFO("module", "                isMace = {}", isMace);
-        LOG_INFO("module", "                isSword = {}", isSword);
-        LOG_INFO("module", "                isPolearm = {}", isPolearm);
-        LOG_INFO("module", "                isStaff = {}", isStaff);
-        LOG_INFO("module", "                isAxe2 = {}", isAxe2);
-        LOG_INFO("module", "                isMace2 = {}", isMace2);
-        LOG_INFO("module", "                isSword2 = {}", isSword2);
-        LOG_INFO("module", "                isNeck = {}", isNeck);
-        LOG_INFO("module", "                isCloak = {}", isCloak);
-        LOG_INFO("module", "                isHoldable = {}", isHoldable);
-        LOG_INFO("module", "                isFinger = {}", isFinger);
-        LOG_INFO("module", "                isTrinket = {}", isTrinket);
-        LOG_INFO("module", "       >>> Printing candidate specs");
-        std::ostringstream stream;
-        for (auto s : specPool) {
-            auto specName = std::to_string(s);
-            if (auto found = specToSpecNames.find(s); found != specToSpecNames.end()) {
-                specName = found->second;
-            }
-            stream << specName << ",";
-        }
-        std::string result = stream.str();
-        LOG_INFO("module", "                candidate_specs = [{}]", result);
-        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT END <<<<<");
+        return false;
     }
-    struct retVals {
-        uint32 enchCatMask, attrMask;
-        bool hasEnch;
-    };
-    if (specPool.empty()) {
-        LOG_ERROR("module", "RANDOM_ENCHANT: ERROR Spec pool is empty somehow");
-        return retVals{0, 0, false};
-    }
-    auto chosenSpec = Acore::Containers::SelectRandomContainerElement(specPool);
-    uint8 plrClass = 0;
-    uint32 plrSpec = 0;
-    bool isFound = false;
-    if (auto found = specToClass.find(chosenSpec); found != specToClass.end()) {
-        isFound = true;
-        plrClass = found->second;
-        plrSpec = found->first;
-    }
-    if (!isFound) {
-        // should not be the case
-        LOG_ERROR("module", "RANDOM_ENCHANT: ERROR the chosen spec is not found: chosen spec was: {}", chosenSpec);
-        return retVals{0, 0, false};
+    return !config.ReforgeTokenItem || player->HasItemCount(config.ReforgeTokenItem, config.ReforgeTokenCount);
+}
+
+void payReforge(Player* player, RandomEnchantsConfig const& config)
+{
+    if (config.ReforgeCostCopper)
+    {
+        player->ModifyMoney(-int32(config.ReforgeCostCopper));
     }
-    auto [enchCatMask, attrMask] = getEnchantCategoryMaskByClassAndSpec(plrClass, plrSpec);
-    if (config_debug)
+    if (config.ReforgeTokenItem)
     {
-        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT CHOSEN ITEM SPEC START <<<<<");
-        LOG_INFO("module", "RANDOM_ENCHANT: CHOSEN SPEC: {}; PLAYER CLASS: {}", plrSpec, plrClass);
-        LOG_INFO("module", "                enchMask: {}", enchCatMask);
-        LOG_INFO("module", "                attrMask: {}", attrMask);
-        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT CHOSEN ITEM SPEC END <<<<<");
+        player->DestroyItemCount(config.ReforgeTokenItem, config.ReforgeTokenCount, true, false);
     }
-    return retVals{enchCatMask, attrMask, true};
 }
 
-auto getPlayerItemEnchantCategoryMask(Item* item, Player* player = nullptr)
+struct ReforgeResult
+{
+    uint32 Reforged;
+    // NoSuffix items found no candidate and were left as they were, free of charge
+    uint32 NoSuffix;
+    // Remaining items were not reached before the budget ran out or the player could not pay
+    uint32 Remaining;
+    bool OutOfFunds;
+    uint64 Micros;
+};
+
+// reforgeItems rerolls the suffix of every item, charging for each item that gets a new one. All the rolls pick
+// from the in-memory catalog and share their candidate lists, so items alike only filter the catalog once. It stops
+// early once RandomEnchants.Reforge.BudgetMicros is spent, the first item is always rolled.
+ReforgeResult reforgeItems(Player* player, std::vector<Item*> const& items)
 {
-    struct retVals {
-        uint32 enchCatMask, attrMask;
-        bool found;
-    };
-    if (config_roll_player_class_preference && player->CanUseItem(item, false) == EQUIP_ERR_OK)
+    auto start = std::chrono::steady_clock::now();
+    RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+    auto budget = std::chrono::microseconds(config->ReforgeBudgetMicros);
+    SuffixRollSettings const& settings = config->ReforgeRollSettings;
+    MemoizedCatalogSuffixSource candidateSource(sRandomEnchantsMgr->GetSuffixCatalog());
+    ChatHandler chathandle = ChatHandler(player->GetSession());
+    uint32 loc = player->GetSession()->GetSessionDbLocaleIndex();
+
+    ReforgeResult result{};
+    for (size_t i = 0; i < items.size(); ++i)
     {
-        if (config_debug)
+        if (i > 0 && std::chrono::steady_clock::now() - start >= budget)
         {
-            LOG_INFO("module", "RANDOM_ENCHANT: Getting player class preference for enchant category");
+            result.Remaining = items.size() - i;
+            break;
+        }
+        if (!canPayReforge(player, *config))
+        {
+            result.OutOfFunds = true;
+            result.Remaining = items.size() - i;
+            break;
         }
-        auto [enchMask, attrMask] = getPlayerEnchantCategoryMask(player);
-        return retVals{enchMask, attrMask, true};
+        Item* item = items[i];
+        SuffixRollContext ctx = getRollContext(player, item, settings, ROLL_SOURCE_REFORGE);
+        SuffixRollResult rollResult;
+        int32 suffixID = rollSuffix(item->GetTemplate(), ctx, settings, candidateSource, &rollResult);
+        sRandomSuffixMetrics->RecordRoll(item->GetTemplate(), ROLL_SOURCE_REFORGE, rollResult);
+        ItemRandomSuffixEntry const* item_rand = suffixID < 0 ? nullptr : sItemRandomSuffixStore.LookupEntry(suffixID);
+        if (!item_rand)
+        {
+            ++result.NoSuffix;
+            continue;
+        }
+        payReforge(player, *config);
+        item->SetItemRandomProperties(-suffixID);
+        ++result.Reforged;
+        std::string suffixName = item_rand->Name[loc];
+        chathandle.PSendSysMessage("|cffFF0000 %s |rhas been reforged with the suffix|cffFF0000 %s |r!", item->GetTemplate()->Name1.c_str(), suffixName);
     }
-    if (config_debug)
+    result.Micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    if (config->Debug)
     {
-        LOG_INFO("module", "RANDOM_ENCHANT: Getting item enchant category");
+        LOG_INFO("module", "RANDOM_ENCHANT: Reforged {} of {} items for {} in {} us, {} distinct queries", result.Reforged, items.size(),
+            player->GetName(), result.Micros, candidateSource.GetQueryCount());
     }
-    auto [enchMask, attrMask, found] = getItemEnchantCategoryMask(item);
-    return retVals{enchMask, attrMask, found};
+    return result;
 }
 
-// END UTILS
+// isValidCustomItemRandomSuffix is registered with the core to check custom suffixes on item links
+bool isValidCustomItemRandomSuffix(uint32 itemId, uint32 suffixId)
+{
+    return sRandomEnchantsMgr->IsValidItemSuffix(itemId, suffixId);
+}
 
-// MAIN GET ROLL ENCHANT FUNCTIONS
+// END MAIN GET ROLL ENCHANTS FUNCTIONS
 
-int32 getCustomRandomSuffix(int enchantQuality, Item* item, Player* player = nullptr)
+class RandomEnchantsWorldScript : public WorldScript
 {
-    uint32 Class = item->GetTemplate()->Class;
-    uint32 subclassMask = 1 << item->GetTemplate()->SubClass;
-    // int level = getLevelOffset(item, player);
-    int level = getItemPlayerLevel(item);
-    auto [enchantCategoryMask, attrMask, found] = getPlayerItemEnchantCategoryMask(item, player);
-    if (!found) {
-        return -1;
-    }
+public:
+    RandomEnchantsWorldScript() : WorldScript("RandomEnchantsWorldScript") { }
 
-    int maxCount = 50;
-    while (maxCount > 0)
+    void OnBeforeConfigLoad(bool /*reload*/) override
     {
-    QueryResult qr = WorldDatabase.Query(R"(SELECT ID FROM item_enchantment_random_suffixes
-INNER JOIN itemrandomsuffix_dbc ON
-item_enchantment_random_suffixes.SuffixID = itemrandomsuffix_dbc.ID
-WHERE
-((MinLevel <= {} AND {} <= MaxLevel) OR (MinLevel = 0 AND MaxLevel = 0))
-AND (
-(ItemClass = 0) OR
-(ItemClass = {} AND ItemSubClassMask = 0) OR
-(ItemClass = {} AND ItemSubClassMask & {} > 0)
-)
-AND EnchantQuality = {}
-AND (
-  (AttributeMask = 0) OR
-  ((AttributeMask & {} > 0) AND (AttributeMask & ~{} = 0))
-)
-AND (
-  (EnchantCategoryMask = 0) OR
-  (EnchantCategoryMask & {} > 0)
-) ORDER BY RAND() LIMIT 1)", level, level, Class, Class, subclassMask, enchantQuality, attrMask, attrMask, enchantCategoryMask);
-        if (qr)
-        {
-            int suffixID = qr->Fetch()[0].Get<uint32>();
-            ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(suffixID);
-            if (!item_rand)
-            {
-                LOG_INFO("module", "Suffix ID does not exist to be enchanted, getting a new one: {}", suffixID);
-                // get suffixID failed for some reason, should not happen, we still just continue and try to get
-                // another one.
-                maxCount--;
-                continue;
-            }
-            uint32 minAllocPct = 3567587328;
-            for (uint8 k = 0; k != MAX_ITEM_ENCHANTMENT_EFFECTS; ++k)
-            {
-                if (item_rand->AllocationPct[k] > 100)
-                {
-                    // NOTE: Any value set below 100, is either a 0, or a 1, which is used to denote either not set,
-                    // or set but not really a stat ench, this is *Hardcoded*.
-                    if (minAllocPct > item_rand->AllocationPct[k])
-                    {
-                        minAllocPct = item_rand->AllocationPct[k];
-                    }
-                }
-            }
-            auto suffFactor = GenerateEnchSuffixFactor(item->GetTemplate()->ItemId);
-            if (config_debug)
-            {
-                LOG_INFO("module", "RANDOM_ENCHANT: Suffix factor for item {}, Item ID is: {} is {}", item->GetTemplate()->Name1, item->GetTemplate()->ItemId, suffFactor);
-            }
-            int32 basepoints = int32(minAllocPct * suffFactor / 10000);
-            if (basepoints < 1)
-            {
-                // Suffix points should ideally be above 1 after suffix factor calculations
-                // This is so that when presented on the client we dont get some weird looking values
-                LOG_INFO("module", "Suffix min alloc pct calculation is below one, getting a new one: suffID: {}, suffFactor: {}, minAllocPct: {}", suffixID, suffFactor, minAllocPct);
-                maxCount--;
-                continue;
-            }
-            if (config_debug)
-            {
-                LOG_INFO("module", "RANDOM_ENCHANT: Query with the following params:");
-                LOG_INFO("module", "                level {}, enchantQuality {}, item_class {}, subclassmask {}, enchCatMask {}, attrMask {}", level, enchantQuality, Class, subclassMask, enchantCategoryMask, attrMask);
-                LOG_INFO("module", "                Return was: {}", suffixID);
-            }
-            return suffixID;
-        }
-        LOG_INFO("module", "RANDOM_ENCHANT: No suffixes found for this combi");
-        LOG_INFO("module", "                level {}, enchantQuality {}, item_class {}, subclassmask {}, enchCatMask {}, attrMask {}", level, enchantQuality, Class, subclassMask, enchantCategoryMask, attrMask);
-        // get suffixID failed for some reason here too. probably no entries.
-        maxCount--;
+        // The rolls going on keep the snapshot they grabbed, the ones after get the new settings all at once
+        publishRandomEnchantsConfig(loadRandomEnchantsConfig());
     }
-    LOG_INFO("module", "rerolled rolls a max number of times already times, but no candidate enchants, returning without a suffix");
-    return -1;
-}
 
-int GetRolledEnchantLevel()
-{
-    int currentTier = -1;
-    for (auto rollpct: config_enchant_pcts)
+    void OnAfterConfigLoad(bool /*reload*/) override
     {
-        double roll = (float)rand_chance();
-        if (roll + rollpct < 100.0)
-        {
-            // If roll was not successful, we break, no more attempted rolls beyond this;
-            break;
-        }
-        currentTier++;
+        RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+        sRandomSuffixScheduler->SetConfig(config->SchedulerBudgetMicros, config->SchedulerDegradeMicros, config->SchedulerMaxQueue);
+        sRandomSuffixMetrics->SetConfig(config->MetricsFile, config->MetricsIntervalMs);
+        sRandomEnchantsMgr->OpenRollTrace(config->CaptureTraceFile, config->RollSettings);
+        sRandomSuffixPreroll->SetConfig(config->PrerollEnable, config->PrerollMaxQueue, config->PrerollExpireMs);
+        sRandomSuffixSimulator->SetConfig(config->SimulatorThreads);
+        sRandomSuffixCoverageAnalyzer->SetConfig(config->CoverageFile, config->CoverageThreads);
+        RANDOM_SUFFIX_PROFILE_OPEN(config->ProfileTraceFile);
     }
-    return currentTier;
-}
 
-void RollPossibleEnchant(Player* player, Item* item)
-{
-    uint32 Quality = item->GetTemplate()->Quality;
-    uint32 Class = item->GetTemplate()->Class;
-
-    switch (item->GetTemplate()->InventoryType)
-    {
-        // Dont roll if its of these types (Taken from GenerateEnchSuffixFactor)
-        // Items of that type don`t have points
-        case INVTYPE_NON_EQUIP:
-        case INVTYPE_BAG:
-        case INVTYPE_TABARD:
-        case INVTYPE_AMMO:
-        case INVTYPE_QUIVER:
-        // case INVTYPE_RELIC: // core changes will allow enchants of relics as well
-            return;
-    }
-    if (
-        (Quality > ITEM_QUALITY_LEGENDARY || Quality < ITEM_QUALITY_UNCOMMON) /* eliminates enchanting anything that isn't a recognized quality */ ||
-        (Class != ITEM_CLASS_WEAPON && Class != ITEM_CLASS_ARMOR) /* eliminates enchanting anything but weapons/armor */)
+    void OnStartup() override
     {
-        return;
+        sRandomEnchantsMgr->LoadItemLevelRequirements();
+        sRandomEnchantsMgr->LoadItemSuffixFactors();
+        sRandomEnchantsMgr->LoadSuffixCatalog();
+        sRandomEnchantsMgr->LoadItemSuffixValidity();
+        if (getRandomEnchantsConfig()->CoverageOnStartup)
+        {
+            sRandomSuffixCoverageAnalyzer->Analyze();
+        }
+        // Let the core validate item links carrying one of our custom suffixes
+        SetCustomItemRandomSuffixCheck(isValidCustomItemRandomSuffix);
     }
 
-    if (item->GetItemRandomPropertyId() != 0)
+    void OnUpdate(uint32 diff) override
     {
-        // If already have enchant, we shouldnt apply a new one
-        return;
+        sRandomSuffixMetrics->Update(diff);
+        sRandomSuffixPreroll->Update(diff);
+        sRandomSuffixSimulator->Update();
+        sRandomSuffixCoverageAnalyzer->Update();
     }
 
-    auto rolledEnchantLevel = GetRolledEnchantLevel();
-    if (rolledEnchantLevel < 0)
-    {
-        // Failed roll
-        return;
-    }
-    auto suffixID = getCustomRandomSuffix(rolledEnchantLevel, item, player);
-    if (suffixID < 0)
+    void OnShutdown() override
     {
-        return;
-    }
-    // Apply the suffix to the item
-    ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(suffixID);
-    if (!item_rand)
-    {
-        return;
-    }
-    item->SetItemRandomProperties(-suffixID);
-    ChatHandler chathandle = ChatHandler(player->GetSession());
-    uint32 loc = player->GetSession()->GetSessionDbLocaleIndex();
-    std::string suffixName = item_rand->Name[loc];
-    chathandle.PSendSysMessage("|cffFF0000 %s |rhas rolled the suffix|cffFF0000 %s |r!", item->GetTemplate()->Name1.c_str(), suffixName);
-}
-
-// END MAIN GET ROLL ENCHANTS FUNCTIONS
-
-class RandomEnchantsWorldScript : public WorldScript
-{
-public:
-    RandomEnchantsWorldScript() : WorldScript("RandomEnchantsWorldScript") { }
-
-    void OnBeforeConfigLoad(bool /*reload*/) override
-    {
-        config_announce_on_log = sConfigMgr->GetOption<bool>("RandomEnchants.AnnounceOnLogin", default_announce_on_log);
-        config_debug = sConfigMgr->GetOption<bool>("RandomEnchants.Debug", default_debug);
-        config_on_loot = sConfigMgr->GetOption<bool>("RandomEnchants.OnLoot", default_on_loot);
-        config_on_create = sConfigMgr->GetOption<bool>("RandomEnchants.OnCreate", default_on_create);
-        config_on_quest_reward = sConfigMgr->GetOption<bool>("RandomEnchants.OnQuestReward", default_on_quest_reward);
-        config_on_group_roll_reward_item = sConfigMgr->GetOption<bool>("RandomEnchants.OnGroupRollRewardItem", default_on_group_roll_reward_item);
-        config_on_vendor_purchase = sConfigMgr->GetOption<bool>("RandomEnchants.OnVendorPurchase", default_on_vendor_purchase);
-        // config_on_all_items_created = sConfigMgr->GetOption<bool>("RandomEnchants.OnAllItemsCreated", default_on_all_items_created);
-        config_roll_player_class_preference =  sConfigMgr->GetOption<bool>("RandomEnchants.RollPlayerClassPreference", default_roll_player_class_preference);
-        config_login_message = sConfigMgr->GetOption<std::string>("RandomEnchants.OnLoginMessage", default_login_message);
-        config_enchant_pcts[0] = sConfigMgr->GetOption<float>("RandomEnchants.RollPercentage.1", default_enchant_pcts[0]);
-        config_enchant_pcts[1] = sConfigMgr->GetOption<float>("RandomEnchants.RollPercentage.2", default_enchant_pcts[1]);
-        config_enchant_pcts[2] = sConfigMgr->GetOption<float>("RandomEnchants.RollPercentage.3", default_enchant_pcts[2]);
-        config_enchant_pcts[3] = sConfigMgr->GetOption<float>("RandomEnchants.RollPercentage.4", default_enchant_pcts[3]);
+        sRandomSuffixPreroll->Stop();
+        sRandomSuffixSimulator->Stop();
+        sRandomSuffixCoverageAnalyzer->Stop();
+        // The rolls since the last write would be lost otherwise
+        sRandomSuffixMetrics->Write();
+        sRandomEnchantsMgr->CloseRollTrace();
+        RANDOM_SUFFIX_PROFILE_CLOSE();
     }
 };
 
@@ -1333,43 +542,153 @@ public:
     RandomEnchantsPlayer() : PlayerScript("RandomEnchantsPlayer") { }
 
     void OnLogin(Player* player) override {
-        if (config_announce_on_log)
+        RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+        if (config->AnnounceOnLogin)
         {
-            ChatHandler(player->GetSession()).SendSysMessage(config_login_message);
+            ChatHandler(player->GetSession()).SendSysMessage(config->LoginMessage);
         }
     }
+    void OnLogout(Player* player) override
+    {
+        sRandomSuffixPreroll->Drop(PREROLL_OWNER_VENDOR, player->GetGUID().GetRawValue());
+    }
     void OnStoreNewItem(Player* player, Item* item, uint32 /*count*/) override
     {
-        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */config_on_loot)
-
-            RollPossibleEnchant(player, item);
+        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */getRandomEnchantsConfig()->OnLoot && !applyPrerolledLootSuffix(player, item))
+            sRandomSuffixScheduler->Roll(player, item, ROLL_SOURCE_LOOT);
     }
     void OnCreateItem(Player* player, Item* item, uint32 /*count*/) override
     {
-        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */config_on_create)
-            RollPossibleEnchant(player, item);
+        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */getRandomEnchantsConfig()->OnCreate)
+            sRandomSuffixScheduler->Roll(player, item, ROLL_SOURCE_CREATE);
     }
     void OnQuestRewardItem(Player* player, Item* item, uint32 /*count*/) override
     {
-        if(/*!HasBeenTouchedByRandomEnchantMod(item) && */config_on_quest_reward)
-            RollPossibleEnchant(player, item);
+        if(/*!HasBeenTouchedByRandomEnchantMod(item) && */getRandomEnchantsConfig()->OnQuestReward)
+            sRandomSuffixScheduler->Roll(player, item, ROLL_SOURCE_QUEST_REWARD);
     }
     void OnGroupRollRewardItem(Player* player, Item* item, uint32 /*count*/, RollVote /*voteType*/, Roll* /*roll*/) override
     {
-        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */config_on_group_roll_reward_item)
+        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */getRandomEnchantsConfig()->OnGroupRollRewardItem)
+        {
+            sRandomSuffixScheduler->Roll(player, item, ROLL_SOURCE_GROUP_ROLL);
+        }
+    }
+    void OnAfterStoreOrEquipNewItem(Player* player, uint32 /*vendorslot*/, Item* item, uint8 /*count*/, uint8 /*bag*/, uint8 /*slot*/, ItemTemplate const* pProto, Creature* /*pVendor*/, VendorItem const* /*crItem*/, bool /*bStore*/) override
+    {
+        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */getRandomEnchantsConfig()->OnVendorPurchase)
+        {
+            if (!sRandomSuffixPreroll->IsEnabled() ||
+                !applyPrerolledSuffix(player, item, ROLL_SOURCE_VENDOR_PURCHASE, PREROLL_OWNER_VENDOR, player->GetGUID().GetRawValue()))
+            {
+                sRandomSuffixScheduler->Roll(player, item, ROLL_SOURCE_VENDOR_PURCHASE);
+            }
+            // The vendor restocks, the next one the player buys is rolled ahead as well
+            if (sRandomSuffixPreroll->IsEnabled())
+            {
+                prerollVendorItem(player, pProto);
+            }
+        }
+    }
+    // An item waiting for its roll is rolled before it leaves the player, the queue would lose it otherwise
+    bool CanSetTradeItem(Player* player, Item* tradedItem, uint8 /*tradeSlot*/) override
+    {
+        sRandomSuffixScheduler->FlushItem(player, tradedItem);
+        return true;
+    }
+    bool CanSellItem(Player* player, Item* item, Creature* /*creature*/) override
+    {
+        sRandomSuffixScheduler->FlushItem(player, item);
+        return true;
+    }
+    bool CanSendMail(Player* player, ObjectGuid /*receiverGuid*/, ObjectGuid /*mailbox*/, std::string& /*subject*/, std::string& /*body*/,
+        uint32 /*money*/, uint32 /*COD*/, Item* item) override
+    {
+        if (item)
+        {
+            sRandomSuffixScheduler->FlushItem(player, item);
+        }
+        return true;
+    }
+    void OnSendListInventory(Player* player, ObjectGuid vendorGuid, uint32& vendorEntry) override
+    {
+        if (!getRandomEnchantsConfig()->OnVendorPurchase || !sRandomSuffixPreroll->IsEnabled())
+        {
+            return;
+        }
+        // Same list the core is about to send
+        VendorItemData const* items = nullptr;
+        if (vendorEntry)
         {
-            RollPossibleEnchant(player, item);
+            items = sObjectMgr->GetNpcVendorItemList(vendorEntry);
+        }
+        else if (Creature* vendor = ObjectAccessor::GetCreature(*player, vendorGuid))
+        {
+            items = vendor->GetVendorItems();
+        }
+        if (!items)
+        {
+            return;
+        }
+        for (VendorItem const* vendorItem : items->m_items)
+        {
+            if (vendorItem)
+            {
+                prerollVendorItem(player, sObjectMgr->GetItemTemplate(vendorItem->item));
+            }
         }
     }
-    void OnAfterStoreOrEquipNewItem(Player* player, uint32 /*vendorslot*/, Item* item, uint8 /*count*/, uint8 /*bag*/, uint8 /*slot*/, ItemTemplate const* /*pProto*/, Creature* /*pVendor*/, VendorItem const* /*crItem*/, bool /*bStore*/) override
+};
+
+// RandomEnchantsGlobal pre-rolls the items of loot as it is filled
+class RandomEnchantsGlobal : public GlobalScript
+{
+public:
+    RandomEnchantsGlobal() : GlobalScript("RandomEnchantsGlobal") { }
+
+    void OnAfterLootTemplateProcess(Loot* loot, LootTemplate const* /*tab*/, LootStore const& /*store*/, Player* lootOwner, bool /*personal*/,
+        bool /*noEmptyError*/, uint16 /*lootMode*/) override
     {
-        if (/*!HasBeenTouchedByRandomEnchantMod(item) && */config_on_vendor_purchase)
+        if (!getRandomEnchantsConfig()->OnLoot || !lootOwner || !sRandomSuffixPreroll->IsEnabled())
+        {
+            return;
+        }
+        // The loot owner is who most likely loots the items, anyone else rolls them when looting
+        uint64 owner = uint64(uintptr_t(loot));
+        sRandomSuffixPreroll->Drop(PREROLL_OWNER_LOOT, owner);
+        for (LootItem const& lootItem : loot->items)
         {
-            RollPossibleEnchant(player, item);
+            if (!lootItem.randomPropertyId)
+            {
+                prerollItemTemplate(lootOwner, sObjectMgr->GetItemTemplate(lootItem.itemid), ROLL_SOURCE_LOOT, PREROLL_OWNER_LOOT, owner);
+            }
         }
     }
 };
 
+// RandomEnchantsAllMap drives the RandomSuffixScheduler from the map updates
+class RandomEnchantsAllMap : public AllMapScript
+{
+public:
+    RandomEnchantsAllMap() : AllMapScript("RandomEnchantsAllMap") { }
+
+    void OnMapUpdate(Map* map, uint32 /*diff*/) override
+    {
+        sRandomSuffixScheduler->Update(map);
+    }
+
+    void OnPlayerLeaveAll(Map* map, Player* player) override
+    {
+        // Queued rolls are for items of the players on the map, they are rolled before the player leaves it
+        sRandomSuffixScheduler->FlushPlayer(map, player);
+    }
+
+    void OnDestroyMap(Map* map) override
+    {
+        sRandomSuffixScheduler->RemoveMap(map);
+    }
+};
+
 // class RandomEnchantsMisc : public MiscScript{
 // public:
 
@@ -1377,7 +696,7 @@ public:
 
 //     void OnItemCreate(Item* item, ItemTemplate const* /*itemProto*/, Player const* owner) override
 //     {
-//         if (config_on_all_items_created)
+//         if (getRandomEnchantsConfig()->OnAllItemsCreated)
 //         {
 //             if (!owner) {
 //                 return;
@@ -1387,7 +706,7 @@ public:
 //             {
 //                 return;
 //             }
-//             RollPossibleEnchant(player, item);
+//             RollPossibleEnchant(player, item, ROLL_SOURCE_CREATE);
 //         }
 //     }
 // };
@@ -1395,6 +714,9 @@ public:
 
 using namespace Acore::ChatCommands;
 
+// Suffixes listed per tier by .randomsuffix preview, from the most likely
+#define MAX_PREVIEW_SUFFIXES_PER_TIER 10
+
 class RandomEnchantCommands : public CommandScript
 {
 public:
@@ -1402,12 +724,305 @@ public:
 
     ChatCommandTable GetCommands() const override
     {
+        static ChatCommandTable simulateCommandTable =
+        {
+            { "item",                     HandleSimulateItemCommand,      SEC_GAMEMASTER,         Console::Yes },
+            { "band",                     HandleSimulateBandCommand,      SEC_GAMEMASTER,         Console::Yes },
+        };
+        static ChatCommandTable randomSuffixCommandTable =
+        {
+            { "shadow",                   HandleShadowStatsCommand,       SEC_GAMEMASTER,         Console::Yes },
+            { "shadowreset",              HandleShadowResetCommand,       SEC_ADMINISTRATOR,      Console::Yes },
+            { "preview",                  HandlePreviewCommand,           SEC_PLAYER,             Console::Yes },
+            { "reforge",                  HandleReforgeCommand,           SEC_PLAYER,             Console::No  },
+            { "scheduler",                HandleSchedulerStatsCommand,    SEC_GAMEMASTER,         Console::Yes },
+            { "preroll",                  HandlePrerollStatsCommand,      SEC_GAMEMASTER,         Console::Yes },
+            { "coverage",                 HandleCoverageCommand,          SEC_ADMINISTRATOR,      Console::Yes },
+            { "simulate",                 simulateCommandTable },
+        };
         static ChatCommandTable commandTable =
         {
             { "additemwsuffix",           HandleAddItemCommand,           SEC_GAMEMASTER,         Console::No  },
+            { "randomsuffix",             randomSuffixCommandTable },
         };
         return commandTable;
     }
+
+    static bool HandleShadowStatsCommand(ChatHandler* handler)
+    {
+        ShadowStats stats = sRandomEnchantsMgr->GetShadowStats();
+        RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+        char const* engineNames[MAX_SUFFIX_ENGINES] = {"sql", "in-process"};
+        handler->PSendSysMessage("Random suffix engine: %s, shadow sample: %.2f%%", engineNames[config->SuffixEngine], config->ShadowSamplePct);
+        handler->PSendSysMessage("Shadow samples: %llu, mismatches: %llu", (unsigned long long)stats.Samples, (unsigned long long)stats.Mismatches);
+        for (uint8 i = 0; i < MAX_SUFFIX_ENGINES; ++i)
+        {
+            SuffixEngineStats const& engine = stats.Engines[i];
+            double avgMicros = engine.Samples ? double(engine.TotalMicros) / engine.Samples : 0.0;
+            handler->PSendSysMessage("  %s: avg %.1f us, max %llu us", engineNames[i], avgMicros, (unsigned long long)engine.MaxMicros);
+        }
+        return true;
+    }
+
+    static bool HandleShadowResetCommand(ChatHandler* handler)
+    {
+        sRandomEnchantsMgr->ResetShadowStats();
+        handler->SendSysMessage("Random suffix shadow mode statistics reset.");
+        return true;
+    }
+
+    static bool HandleSchedulerStatsCommand(ChatHandler* handler)
+    {
+        RollSchedulerStats stats = sRandomSuffixScheduler->GetStats();
+        handler->PSendSysMessage("Roll scheduler: queue depth %llu (max %llu), average roll %llu us%s",
+            (unsigned long long)stats.QueueDepth, (unsigned long long)stats.MaxQueueDepth, (unsigned long long)stats.AvgRollMicros,
+            stats.Degraded ? ", degraded: deferring every roll" : "");
+        handler->PSendSysMessage("Rolls inline: %llu, deferred: %llu, drained: %llu, forced by a full queue: %llu, flushed: %llu, dropped: %llu",
+            (unsigned long long)stats.InlineRolls, (unsigned long long)stats.DeferredRolls, (unsigned long long)stats.DrainedRolls,
+            (unsigned long long)stats.ForcedRolls, (unsigned long long)stats.FlushedRolls, (unsigned long long)stats.DroppedRolls);
+        return true;
+    }
+
+    static bool HandlePrerollStatsCommand(ChatHandler* handler)
+    {
+        if (!sRandomSuffixPreroll->IsEnabled())
+        {
+            handler->SendSysMessage("Pre-rolling is disabled.");
+            return true;
+        }
+        PrerollStats stats = sRandomSuffixPreroll->GetStats();
+        handler->PSendSysMessage("Pre-rolls: queue depth %llu, ready %llu, average roll %llu us",
+            (unsigned long long)stats.QueueDepth, (unsigned long long)stats.ReadyCount, (unsigned long long)stats.AvgRollMicros);
+        handler->PSendSysMessage("Queued: %llu, not queued as the queue was full: %llu, applied: %llu, missed: %llu, expired: %llu, dropped: %llu",
+            (unsigned long long)stats.Queued, (unsigned long long)stats.Full, (unsigned long long)stats.Applied, (unsigned long long)stats.Missed,
+            (unsigned long long)stats.Expired, (unsigned long long)stats.Dropped);
+        return true;
+    }
+
+    // ParseSpec looks the optional spec of a command up, 0 without one. Returns false if there is no such spec.
+    static bool ParseSpec(ChatHandler* handler, Optional<std::string> const& specName, uint32& spec)
+    {
+        spec = 0;
+        if (!specName)
+        {
+            return true;
+        }
+        spec = getSpecByName(*specName);
+        if (!spec)
+        {
+            handler->PSendSysMessage("Unknown spec %s, specs are named like WARRIOR_ARMS or DRUID_FERAL_COMBAT.", specName->c_str());
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        return true;
+    }
+
+    // StartSimulation starts a dry run of the items in the background, its report follows once it is done
+    static bool StartSimulation(ChatHandler* handler, std::string const& description, std::vector<SimulatedItem>&& items, uint32 count,
+        Optional<std::string> const& specName)
+    {
+        uint32 spec;
+        if (!ParseSpec(handler, specName, spec))
+        {
+            return false;
+        }
+        RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+        if (!count || count > config->SimulatorMaxRolls)
+        {
+            handler->PSendSysMessage("Dry runs roll 1 to %u times.", config->SimulatorMaxRolls);
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        if (items.empty())
+        {
+            handler->PSendSysMessage("There is no item of %s that rolls a suffix.", description.c_str());
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        std::string rolledAs = spec ? description + " as " + specToSpecNames[spec] : description;
+        ObjectGuid requester = handler->GetSession() ? handler->GetSession()->GetPlayer()->GetGUID() : ObjectGuid::Empty;
+        if (!sRandomSuffixSimulator->Start(requester, rolledAs, std::move(items), spec, config->RollSettings, count))
+        {
+            handler->SendSysMessage("A dry run is already going, try again once its report is out.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        handler->PSendSysMessage("Dry run of %u rolls of %s started, the report follows once it is done.", count, rolledAs.c_str());
+        return true;
+    }
+
+    static SimulatedItem GetSimulatedItem(ItemTemplate const* proto)
+    {
+        return {proto, getItemTemplatePlayerLevel(proto), sRandomEnchantsMgr->GetItemSuffixFactor(proto->ItemId)};
+    }
+
+    // HandleSimulateItemCommand rolls an item count times without creating it, with the roll percentages in use and
+    // optionally as a player of the spec. Dry runs never query the database.
+    static bool HandleSimulateItemCommand(ChatHandler* handler, ItemTemplate const* itemTemplate, uint32 count, Optional<std::string> specName)
+    {
+        std::vector<SimulatedItem> items;
+        if (isRollableItemTemplate(itemTemplate))
+        {
+            items.push_back(GetSimulatedItem(itemTemplate));
+        }
+        return StartSimulation(handler, itemTemplate->Name1, std::move(items), count, specName);
+    }
+
+    // HandleSimulateBandCommand rolls the items of an item level band count times in all, taking turns
+    static bool HandleSimulateBandCommand(ChatHandler* handler, uint32 minItemLevel, uint32 maxItemLevel, uint32 count, Optional<std::string> specName)
+    {
+        std::vector<SimulatedItem> items;
+        for (auto const& [itemId, itemTemplate] : *sObjectMgr->GetItemTemplateStore())
+        {
+            if (minItemLevel <= itemTemplate.ItemLevel && itemTemplate.ItemLevel <= maxItemLevel && isRollableItemTemplate(&itemTemplate))
+            {
+                items.push_back(GetSimulatedItem(&itemTemplate));
+            }
+        }
+        // The store is unordered, the items take turns by ID so the same band always rolls alike
+        std::sort(items.begin(), items.end(), [](SimulatedItem const& a, SimulatedItem const& b) { return a.Proto->ItemId < b.Proto->ItemId; });
+        std::string description = "item levels " + std::to_string(minItemLevel) + " to " + std::to_string(maxItemLevel) + " (" +
+            std::to_string(items.size()) + " items)";
+        return StartSimulation(handler, description, std::move(items), count, specName);
+    }
+
+    // HandleCoverageCommand checks in the background that every rollable item can roll a suffix and every suffix can be
+    // rolled, its summary follows once it is done
+    static bool HandleCoverageCommand(ChatHandler* handler)
+    {
+        ObjectGuid requester = handler->GetSession() ? handler->GetSession()->GetPlayer()->GetGUID() : ObjectGuid::Empty;
+        if (!sRandomSuffixCoverageAnalyzer->Start(requester))
+        {
+            handler->SendSysMessage("A coverage analysis is already going, try again once its summary is out.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        handler->SendSysMessage("Coverage analysis started, the summary follows once it is done.");
+        return true;
+    }
+
+    // HandlePreviewCommand lists the suffixes an item can roll along with their chances, optionally as rolled by a
+    // player of the spec with RandomEnchants.RollPlayerClassPreference. Previews never query the database.
+    static bool HandlePreviewCommand(ChatHandler* handler, ItemTemplate const* itemTemplate, Optional<std::string> specName)
+    {
+        uint32 spec;
+        if (!ParseSpec(handler, specName, spec))
+        {
+            return false;
+        }
+        if (!isRollableItemTemplate(itemTemplate))
+        {
+            handler->PSendSysMessage("%s never rolls a suffix.", itemTemplate->Name1.c_str());
+            return true;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<SuffixRollPreview const> preview = sRandomEnchantsMgr->GetSuffixRollPreview(itemTemplate, spec);
+        uint64 micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        std::string rolledAs = spec ? "as " + specToSpecNames[spec] : "from " + std::to_string(preview->MaskPoolSize) + " specs";
+        handler->PSendSysMessage("Suffixes of %s rolled %s, player level %u, suffix factor %u (%llu us):", itemTemplate->Name1.c_str(), rolledAs.c_str(),
+            getItemTemplatePlayerLevel(itemTemplate), sRandomEnchantsMgr->GetItemSuffixFactor(itemTemplate->ItemId), (unsigned long long)micros);
+        handler->PSendSysMessage("No suffix: %.2f%%", preview->NoSuffixChance * 100.0);
+        uint32 loc = handler->GetSessionDbcLocale();
+        auto outcome = preview->Outcomes.begin();
+        for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+        {
+            auto tierEnd = std::find_if(outcome, preview->Outcomes.end(), [tier](SuffixRollOutcome const& o) { return o.Tier != tier; });
+            handler->PSendSysMessage("Tier %u: %.2f%% of rolls, %u suffixes, %.2f%% of the tier without a usable suffix", tier + 1,
+                preview->TierChances[tier] * 100.0, uint32(tierEnd - outcome), preview->TierNoSuffixChances[tier] * 100.0);
+            for (uint32 shown = 0; outcome != tierEnd; ++outcome, ++shown)
+            {
+                if (shown == MAX_PREVIEW_SUFFIXES_PER_TIER)
+                {
+                    handler->PSendSysMessage("  ... and %u more", uint32(tierEnd - outcome));
+                    outcome = tierEnd;
+                    break;
+                }
+                ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(outcome->SuffixID);
+                handler->PSendSysMessage("  %u %s: %.2f%% of the tier, %.3f%% of rolls", outcome->SuffixID, item_rand ? item_rand->Name[loc] : "",
+                    outcome->TierChance * 100.0, outcome->Chance * 100.0);
+            }
+        }
+        return true;
+    }
+
+    // HandleReforgeCommand rerolls the suffix of the item in a slot of a bag, or of every eligible item in the bag.
+    // Bag 0 is the backpack and bags 1 to 4 are the equipped bags, slots are numbered from 1.
+    static bool HandleReforgeCommand(ChatHandler* handler, uint8 bagNumber, Optional<uint8> slotNumber)
+    {
+        if (!getRandomEnchantsConfig()->ReforgeEnable)
+        {
+            handler->SendSysMessage("Reforging is disabled.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        Player* player = handler->GetSession()->GetPlayer();
+        uint8 bagSlot = INVENTORY_SLOT_BAG_0;
+        uint8 firstSlot = INVENTORY_SLOT_ITEM_START;
+        uint8 bagSize = INVENTORY_SLOT_ITEM_END - INVENTORY_SLOT_ITEM_START;
+        if (bagNumber > 0)
+        {
+            Bag* bag = bagNumber <= INVENTORY_SLOT_BAG_END - INVENTORY_SLOT_BAG_START ? player->GetBagByPos(INVENTORY_SLOT_BAG_START + bagNumber - 1) : nullptr;
+            if (!bag)
+            {
+                handler->PSendSysMessage("There is no bag %u, bag 0 is the backpack and bags 1 to 4 are the equipped bags.", uint32(bagNumber));
+                handler->SetSentErrorMessage(true);
+                return false;
+            }
+            bagSlot = INVENTORY_SLOT_BAG_START + bagNumber - 1;
+            firstSlot = 0;
+            bagSize = bag->GetBagSize();
+        }
+        if (slotNumber && (*slotNumber == 0 || *slotNumber > bagSize))
+        {
+            handler->PSendSysMessage("Bag %u has slots 1 to %u.", uint32(bagNumber), uint32(bagSize));
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        std::vector<Item*> items;
+        for (uint8 slot = 0; slot < bagSize; ++slot)
+        {
+            if (slotNumber && slot != *slotNumber - 1)
+            {
+                continue;
+            }
+            Item* item = player->GetItemByPos(bagSlot, firstSlot + slot);
+            if (item && isReforgeableItem(player, item))
+            {
+                items.push_back(item);
+            }
+        }
+        if (items.empty())
+        {
+            handler->SendSysMessage(slotNumber ? "That item cannot be reforged." : "There is nothing to reforge in that bag.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+        if (!sRandomEnchantsMgr->TryStartReforge(player->GetGUID().GetCounter(), getRandomEnchantsConfig()->ReforgeCooldownMs))
+        {
+            handler->SendSysMessage("You have reforged too recently, try again in a few seconds.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        ReforgeResult result = reforgeItems(player, items);
+        if (result.NoSuffix)
+        {
+            handler->PSendSysMessage("%u items found no suffix to roll and were left as they were.", result.NoSuffix);
+        }
+        if (result.OutOfFunds)
+        {
+            handler->PSendSysMessage("You cannot pay for reforging the %u items left.", result.Remaining);
+        }
+        else if (result.Remaining)
+        {
+            handler->PSendSysMessage("%u items were not reforged this time, reforge the bag again for the rest.", result.Remaining);
+        }
+        return true;
+    }
+
     static bool HandleAddItemCommand(ChatHandler* handler, ItemTemplate const* itemTemplate, Optional<int32> _count, Optional<int32> _suffID)
     {
         if (!sObjectMgr->GetItemTemplate(itemTemplate->ItemId))
@@ -1528,6 +1143,8 @@ public:
 void AddRandomEnchantsScripts() {
     new RandomEnchantsWorldScript();
     new RandomEnchantsPlayer();
+    new RandomEnchantsAllMap();
+    new RandomEnchantsGlobal();
     new RandomEnchantCommands();
     // new RandomEnchantsMisc();
 }
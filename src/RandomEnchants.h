@@ -0,0 +1,18 @@
+/*
+* Shared declarations between the RandomEnchants scripts and the RandomEnchantsMgr
+*/
+#ifndef _RANDOM_ENCHANTS_H_
+#define _RANDOM_ENCHANTS_H_
+
+#include "RandomEnchantsConfig.h"
+#include "RandomSuffixEngine.h"
+
+uint32 getItemTemplatePlayerLevel(ItemTemplate const* proto);
+// RollPossibleEnchant rolls a suffix for a new item of the player, in the hook that created it or later on from the
+// RandomSuffixScheduler
+void RollPossibleEnchant(Player* player, Item* item, SuffixRollSource source);
+// rollWorldSuffix rolls with the suffix engine of the config snapshot, it is safe to call off the map threads
+int32 rollWorldSuffix(RandomEnchantsConfig const& config, ItemTemplate const* proto, SuffixRollContext const& ctx, SuffixRollSettings const& settings,
+    SuffixRollResult* result);
+
+#endif
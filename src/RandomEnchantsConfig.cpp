@@ -0,0 +1,94 @@
+/*
+* RandomEnchantsConfig snapshots the module's settings, see RandomEnchantsConfig.h
+*/
+#include "RandomEnchantsConfig.h"
+#include "Configuration/Config.h"
+#include "Log.h"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+static RandomEnchantsConfig buildDefaultConfig()
+{
+    RandomEnchantsConfig config;
+    config.BuildTables();
+    return config;
+}
+
+// currentConfig is only read and replaced through the atomic shared_ptr functions, a roll holding the snapshot it
+// grabbed keeps it alive however many times the config is reloaded meanwhile
+static RandomEnchantsConfigPtr currentConfig = std::make_shared<RandomEnchantsConfig const>(buildDefaultConfig());
+static std::atomic<uint32> loadedConfigs{0};
+
+void RandomEnchantsConfig::BuildTables()
+{
+    std::copy(std::begin(EnchantPcts), std::end(EnchantPcts), RollSettings.EnchantPcts);
+    RollSettings.RollPlayerClassPreference = RollPlayerClassPreference;
+    RollSettings.Debug = Debug;
+    RollSettings.Quiet = false;
+    ReforgeRollSettings = RollSettings;
+    ReforgeRollSettings.EnchantPcts[0] = 100.0;
+    buildSuffixTierChances(RollSettings);
+    buildSuffixTierChances(ReforgeRollSettings);
+}
+
+std::unique_ptr<RandomEnchantsConfig> loadRandomEnchantsConfig()
+{
+    RandomEnchantsConfig const defaults{};
+    auto config = std::make_unique<RandomEnchantsConfig>();
+    config->Generation = ++loadedConfigs;
+    config->AnnounceOnLogin = sConfigMgr->GetOption<bool>("RandomEnchants.AnnounceOnLogin", defaults.AnnounceOnLogin);
+    config->LoginMessage = sConfigMgr->GetOption<std::string>("RandomEnchants.OnLoginMessage", defaults.LoginMessage);
+    config->Debug = sConfigMgr->GetOption<bool>("RandomEnchants.Debug", defaults.Debug);
+    config->OnLoot = sConfigMgr->GetOption<bool>("RandomEnchants.OnLoot", defaults.OnLoot);
+    config->OnCreate = sConfigMgr->GetOption<bool>("RandomEnchants.OnCreate", defaults.OnCreate);
+    config->OnQuestReward = sConfigMgr->GetOption<bool>("RandomEnchants.OnQuestReward", defaults.OnQuestReward);
+    config->OnGroupRollRewardItem = sConfigMgr->GetOption<bool>("RandomEnchants.OnGroupRollRewardItem", defaults.OnGroupRollRewardItem);
+    config->OnVendorPurchase = sConfigMgr->GetOption<bool>("RandomEnchants.OnVendorPurchase", defaults.OnVendorPurchase);
+    // config->OnAllItemsCreated = sConfigMgr->GetOption<bool>("RandomEnchants.OnAllItemsCreated", defaults.OnAllItemsCreated);
+    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        config->EnchantPcts[tier] = sConfigMgr->GetOption<float>("RandomEnchants.RollPercentage." + std::to_string(tier + 1), defaults.EnchantPcts[tier]);
+    }
+    config->RollPlayerClassPreference = sConfigMgr->GetOption<bool>("RandomEnchants.RollPlayerClassPreference", defaults.RollPlayerClassPreference);
+    config->SuffixEngine = sConfigMgr->GetOption<uint32>("RandomEnchants.SuffixEngine", defaults.SuffixEngine);
+    if (config->SuffixEngine >= MAX_SUFFIX_ENGINES)
+    {
+        LOG_ERROR("module", "RANDOM_ENCHANT: RandomEnchants.SuffixEngine {} is not a valid engine, falling back to {}", config->SuffixEngine, defaults.SuffixEngine);
+        config->SuffixEngine = defaults.SuffixEngine;
+    }
+    config->ShadowSamplePct = sConfigMgr->GetOption<float>("RandomEnchants.ShadowSamplePercentage", defaults.ShadowSamplePct);
+    config->CaptureTraceFile = sConfigMgr->GetOption<std::string>("RandomEnchants.CaptureTraceFile", defaults.CaptureTraceFile);
+    config->ReforgeEnable = sConfigMgr->GetOption<bool>("RandomEnchants.Reforge.Enable", defaults.ReforgeEnable);
+    config->ReforgeCostCopper = sConfigMgr->GetOption<uint32>("RandomEnchants.Reforge.CostCopper", defaults.ReforgeCostCopper);
+    config->ReforgeTokenItem = sConfigMgr->GetOption<uint32>("RandomEnchants.Reforge.TokenItem", defaults.ReforgeTokenItem);
+    config->ReforgeTokenCount = sConfigMgr->GetOption<uint32>("RandomEnchants.Reforge.TokenCount", defaults.ReforgeTokenCount);
+    config->ReforgeCooldownMs = sConfigMgr->GetOption<uint32>("RandomEnchants.Reforge.CooldownMs", defaults.ReforgeCooldownMs);
+    config->ReforgeBudgetMicros = sConfigMgr->GetOption<uint32>("RandomEnchants.Reforge.BudgetMicros", defaults.ReforgeBudgetMicros);
+    config->SchedulerBudgetMicros = sConfigMgr->GetOption<uint32>("RandomEnchants.Scheduler.BudgetMicros", defaults.SchedulerBudgetMicros);
+    config->SchedulerDegradeMicros = sConfigMgr->GetOption<uint32>("RandomEnchants.Scheduler.DegradeMicros", defaults.SchedulerDegradeMicros);
+    config->SchedulerMaxQueue = sConfigMgr->GetOption<uint32>("RandomEnchants.Scheduler.MaxQueue", defaults.SchedulerMaxQueue);
+    config->MetricsFile = sConfigMgr->GetOption<std::string>("RandomEnchants.Metrics.File", defaults.MetricsFile);
+    config->MetricsIntervalMs = sConfigMgr->GetOption<uint32>("RandomEnchants.Metrics.IntervalMs", defaults.MetricsIntervalMs);
+    config->ProfileTraceFile = sConfigMgr->GetOption<std::string>("RandomEnchants.ProfileTraceFile", defaults.ProfileTraceFile);
+    config->PrerollEnable = sConfigMgr->GetOption<bool>("RandomEnchants.Preroll.Enable", defaults.PrerollEnable);
+    config->PrerollMaxQueue = sConfigMgr->GetOption<uint32>("RandomEnchants.Preroll.MaxQueue", defaults.PrerollMaxQueue);
+    config->PrerollExpireMs = sConfigMgr->GetOption<uint32>("RandomEnchants.Preroll.ExpireMs", defaults.PrerollExpireMs);
+    config->SimulatorThreads = sConfigMgr->GetOption<uint32>("RandomEnchants.Simulator.Threads", defaults.SimulatorThreads);
+    config->SimulatorMaxRolls = sConfigMgr->GetOption<uint32>("RandomEnchants.Simulator.MaxRolls", defaults.SimulatorMaxRolls);
+    config->CoverageFile = sConfigMgr->GetOption<std::string>("RandomEnchants.Coverage.File", defaults.CoverageFile);
+    config->CoverageThreads = sConfigMgr->GetOption<uint32>("RandomEnchants.Coverage.Threads", defaults.CoverageThreads);
+    config->CoverageOnStartup = sConfigMgr->GetOption<bool>("RandomEnchants.Coverage.OnStartup", defaults.CoverageOnStartup);
+    config->BuildTables();
+    return config;
+}
+
+void publishRandomEnchantsConfig(RandomEnchantsConfigPtr config)
+{
+    std::atomic_store_explicit(&currentConfig, std::move(config), std::memory_order_release);
+}
+
+RandomEnchantsConfigPtr getRandomEnchantsConfig()
+{
+    return std::atomic_load_explicit(&currentConfig, std::memory_order_acquire);
+}
@@ -0,0 +1,93 @@
+/*
+* RandomEnchantsConfig is an immutable snapshot of the module's settings, along with the tables worked out of them.
+*
+* A config load reads the settings into a new snapshot on the thread loading the config, the world thread, while the
+* pre-roll worker goes on with the one before, then publishes it with a single atomic store. A roll grabs the snapshot
+* once, a single atomic load, and sees the same settings from its first stage to its last however the config is
+* reloaded meanwhile. Snapshots are shared, a replaced one lives on for as long as a roll, the pre-roll worker or the
+* scheduler still holds it, and is freed by whichever lets go of it last.
+*/
+#ifndef _RANDOM_ENCHANTS_CONFIG_H_
+#define _RANDOM_ENCHANTS_CONFIG_H_
+
+#include "RandomSuffixEngine.h"
+#include <memory>
+#include <string>
+
+enum SuffixEngine
+{
+    SUFFIX_ENGINE_SQL        = 0,
+    SUFFIX_ENGINE_IN_PROCESS = 1,
+    MAX_SUFFIX_ENGINES       = 2,
+};
+
+// The members are initialised to the defaults of the settings
+struct RandomEnchantsConfig
+{
+    // Generation counts the snapshots loaded, 0 is the defaults. Unlike the address of a snapshot it is never reused.
+    uint32 Generation = 0;
+
+    bool AnnounceOnLogin = true;
+    std::string LoginMessage = "This server is running a RandomEnchants Module.";
+    bool Debug = false;
+
+    // Hooks rolling a suffix for the new item
+    bool OnLoot = true;
+    bool OnCreate = true;
+    bool OnQuestReward = true;
+    bool OnGroupRollRewardItem = true;
+    bool OnVendorPurchase = true;
+    // bool OnAllItemsCreated = true;
+
+    double EnchantPcts[MAX_RAND_ENCHANT_TIERS] = {30.0, 35.0, 40.0, 45.0};
+    bool RollPlayerClassPreference = false;
+    uint32 SuffixEngine = SUFFIX_ENGINE_SQL;
+    double ShadowSamplePct = 0.0;
+    std::string CaptureTraceFile = "";
+
+    bool ReforgeEnable = false;
+    uint32 ReforgeCostCopper = 100000;
+    uint32 ReforgeTokenItem = 0;
+    uint32 ReforgeTokenCount = 1;
+    uint32 ReforgeCooldownMs = 5000;
+    uint32 ReforgeBudgetMicros = 2000;
+
+    uint32 SchedulerBudgetMicros = 0;
+    uint32 SchedulerDegradeMicros = 0;
+    uint32 SchedulerMaxQueue = 200;
+
+    std::string MetricsFile = "";
+    uint32 MetricsIntervalMs = 15000;
+    std::string ProfileTraceFile = "";
+
+    bool PrerollEnable = false;
+    uint32 PrerollMaxQueue = 1000;
+    uint32 PrerollExpireMs = 300000;
+
+    uint32 SimulatorThreads = 0;
+    uint32 SimulatorMaxRolls = 10000000;
+
+    std::string CoverageFile = "";
+    uint32 CoverageThreads = 0;
+    bool CoverageOnStartup = false;
+
+    // RollSettings are what every roll is made with, ReforgeRollSettings what reforging rolls with: the first tier
+    // always passes so a paid reroll gets a suffix, the tiers above keep their chances
+    SuffixRollSettings RollSettings;
+    SuffixRollSettings ReforgeRollSettings;
+
+    // BuildTables works the tables out of the settings, once they are all set
+    void BuildTables();
+};
+
+typedef std::shared_ptr<RandomEnchantsConfig const> RandomEnchantsConfigPtr;
+
+// loadRandomEnchantsConfig reads a new snapshot out of the config files, falling back to the defaults
+std::unique_ptr<RandomEnchantsConfig> loadRandomEnchantsConfig();
+// publishRandomEnchantsConfig makes config the snapshot of every roll from now on
+void publishRandomEnchantsConfig(RandomEnchantsConfigPtr config);
+// getRandomEnchantsConfig returns the latest snapshot, the defaults until the config is first loaded. Hold on to the
+// pointer for as long as the snapshot is used, not to a reference into it.
+RandomEnchantsConfigPtr getRandomEnchantsConfig();
+
+#endif
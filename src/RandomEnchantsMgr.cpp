@@ -0,0 +1,570 @@
+/*
+* RandomEnchantsMgr holds the data the module precomputes at startup
+*/
+#include "RandomEnchantsMgr.h"
+#include "RandomEnchants.h"
+#include "RandomSuffixTrace.h"
+#include "DatabaseEnv.h"
+#include "DBCStores.h"
+#include "Log.h"
+#include "ObjectMgr.h"
+#include "Timer.h"
+#include <map>
+#include <tuple>
+
+RandomEnchantsMgr* RandomEnchantsMgr::instance()
+{
+    static RandomEnchantsMgr instance;
+    return &instance;
+}
+
+void RandomEnchantsMgr::LoadItemLevelRequirements()
+{
+    uint32 oldMSTime = getMSTime();
+    _averageRequiredLevels.clear();
+
+    QueryResult qr = WorldDatabase.Query(R"(select ItemLevel, ceil(avg(RequiredLevel)) from item_template where
+class in ({},{})
+and RequiredLevel != {}
+and not (name like '%qa%' or name like '%test%' or name like '%debug%' or name like '%internal%' or name like '%demo%')
+group by ItemLevel)",
+        ITEM_CLASS_WEAPON, ITEM_CLASS_ARMOR,
+        0);
+    if (qr)
+    {
+        do
+        {
+            Field* fields = qr->Fetch();
+            _averageRequiredLevels[fields[0].Get<uint32>()] = fields[1].Get<uint32>();
+        } while (qr->NextRow());
+    }
+    LOG_INFO("module", ">> RANDOM_ENCHANT: Loaded average required levels for {} item levels in {} ms", _averageRequiredLevels.size(), GetMSTimeDiffToNow(oldMSTime));
+}
+
+uint32 RandomEnchantsMgr::GetAverageRequiredLevel(uint32 itemLevel) const
+{
+    auto found = _averageRequiredLevels.find(itemLevel);
+    if (found == _averageRequiredLevels.end())
+    {
+        return 0;
+    }
+    return found->second;
+}
+
+void RandomEnchantsMgr::LoadItemSuffixFactors()
+{
+    // The core reads the table from the map threads without a lock, so it is built once at startup and never
+    // changed or freed after
+    ASSERT(_itemSuffixFactors.empty());
+    uint32 oldMSTime = getMSTime();
+
+    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
+    uint32 maxItemId = 0;
+    for (auto const& itr : *itemTemplates)
+    {
+        maxItemId = std::max(maxItemId, itr.first);
+    }
+    // Missing item IDs stay at 0, same as GenerateEnchSuffixFactor for an unknown item
+    std::vector<uint32> itemSuffixFactors(maxItemId + 1, 0);
+    for (auto const& itr : *itemTemplates)
+    {
+        itemSuffixFactors[itr.first] = GenerateEnchSuffixFactor(itr.first);
+    }
+    _itemSuffixFactors = std::move(itemSuffixFactors);
+    _coreItemSuffixFactors = {_itemSuffixFactors.data(), uint32(_itemSuffixFactors.size())};
+    SetCustomItemSuffixFactors(&_coreItemSuffixFactors);
+    LOG_INFO("module", ">> RANDOM_ENCHANT: Built suffix factor table for {} item IDs, {} bytes in {} ms",
+        _itemSuffixFactors.size(), _itemSuffixFactors.size() * sizeof(uint32), GetMSTimeDiffToNow(oldMSTime));
+}
+
+void RandomEnchantsMgr::LoadSuffixCatalog()
+{
+    uint32 oldMSTime = getMSTime();
+    _suffixCatalog.clear();
+    _suffixColumns = SuffixCatalogColumns();
+    _suffixAliasTables = SuffixAliasTables();
+    ResetSuffixRollPreviews();
+
+    QueryResult qr = WorldDatabase.Query(R"(SELECT SuffixID, MinLevel, MaxLevel, AttributeMask, ItemClass, ItemSubClassMask, EnchantQuality, EnchantCategoryMask, Weight
+FROM item_enchantment_random_suffixes
+INNER JOIN itemrandomsuffix_dbc ON
+item_enchantment_random_suffixes.SuffixID = itemrandomsuffix_dbc.ID
+ORDER BY SuffixID)");
+    if (!qr)
+    {
+        LOG_ERROR("module", ">> RANDOM_ENCHANT: Loaded 0 custom random suffixes, item_enchantment_random_suffixes is empty");
+        return;
+    }
+    do
+    {
+        Field* fields = qr->Fetch();
+        RandomSuffixCatalogEntry entry;
+        entry.SuffixID = fields[0].Get<uint32>();
+        entry.MinLevel = fields[1].Get<uint32>();
+        entry.MaxLevel = fields[2].Get<uint32>();
+        entry.AttributeMask = fields[3].Get<uint32>();
+        entry.ItemClass = fields[4].Get<uint32>();
+        entry.ItemSubClassMask = fields[5].Get<uint32>();
+        entry.EnchantQuality = fields[6].Get<uint32>();
+        entry.EnchantCategoryMask = fields[7].Get<uint32>();
+        entry.Weight = fields[8].Get<uint32>();
+        entry.MinAllocPct = 3567587328;
+        entry.InStore = false;
+        if (ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(entry.SuffixID))
+        {
+            entry.InStore = true;
+            for (uint8 k = 0; k != MAX_ITEM_ENCHANTMENT_EFFECTS; ++k)
+            {
+                // Same as the roll, allocations of 100 and below are not stat enchants
+                if (item_rand->AllocationPct[k] > 100 && entry.MinAllocPct > item_rand->AllocationPct[k])
+                {
+                    entry.MinAllocPct = item_rand->AllocationPct[k];
+                }
+            }
+        }
+        _suffixCatalog.push_back(entry);
+    } while (qr->NextRow());
+    _suffixColumns.Build(_suffixCatalog);
+    _suffixAliasTables.Build(_suffixCatalog);
+    LOG_INFO("module", ">> RANDOM_ENCHANT: Loaded {} custom random suffixes in {} ms, filtering them with {}", _suffixCatalog.size(),
+        GetMSTimeDiffToNow(oldMSTime), getSuffixFilterIsaName(getBestSuffixFilterIsa()));
+    LOG_INFO("module", ">> RANDOM_ENCHANT: Built {} suffix alias tables for {} roll buckets, {} bytes", _suffixAliasTables.GetTableCount(),
+        _suffixAliasTables.GetBucketCount(), _suffixAliasTables.GetMemorySize());
+}
+
+void RandomEnchantsMgr::GetSuffixCandidates(SuffixRollQuery const& query, std::vector<uint32>& candidates) const
+{
+    candidates.clear();
+    std::vector<uint64> matches;
+    _suffixColumns.Filter(query, matches, getBestSuffixFilterIsa());
+    _suffixColumns.GetMatchSuffixIDs(matches, candidates);
+}
+
+std::shared_ptr<SuffixRollPreview const> RandomEnchantsMgr::GetSuffixRollPreview(ItemTemplate const* proto, uint32 spec)
+{
+    uint64 key = (uint64(proto->ItemId) << 32) | spec;
+    RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+    {
+        std::lock_guard<std::mutex> guard(_rollPreviewLock);
+        // The previews cached were worked out with the roll percentages of an older config
+        if (_rollPreviewGeneration != config->Generation)
+        {
+            _rollPreviews.clear();
+            _rollPreviewGeneration = config->Generation;
+        }
+        if (auto found = _rollPreviews.find(key); found != _rollPreviews.end())
+        {
+            return found->second;
+        }
+    }
+
+    uint32 level = getItemTemplatePlayerLevel(proto);
+    std::vector<EnchantMasks> maskPool;
+    if (auto found = specToClass.find(spec); found != specToClass.end())
+    {
+        maskPool.push_back(getEnchantCategoryMaskByClassAndSpec(found->second, spec));
+    }
+    else
+    {
+        maskPool = getItemTemplateMaskPool(proto, level);
+    }
+    auto preview = std::make_shared<SuffixRollPreview>();
+    previewSuffixRolls(proto, level, GetItemSuffixFactor(proto->ItemId), maskPool, config->RollSettings.TierChances, _suffixCatalog, *preview);
+
+    std::lock_guard<std::mutex> guard(_rollPreviewLock);
+    if (_rollPreviewGeneration != config->Generation)
+    {
+        // The config was reloaded meanwhile, the preview is still right for the percentages it was asked with
+        return preview;
+    }
+    return _rollPreviews.emplace(key, std::move(preview)).first->second;
+}
+
+void RandomEnchantsMgr::ResetSuffixRollPreviews()
+{
+    std::lock_guard<std::mutex> guard(_rollPreviewLock);
+    _rollPreviews.clear();
+}
+
+void RandomEnchantsMgr::AtomicSuffixEngineStats::Record(uint64 micros)
+{
+    Samples.fetch_add(1, std::memory_order_relaxed);
+    TotalMicros.fetch_add(micros, std::memory_order_relaxed);
+    uint64 currentMax = MaxMicros.load(std::memory_order_relaxed);
+    while (currentMax < micros && !MaxMicros.compare_exchange_weak(currentMax, micros, std::memory_order_relaxed))
+    {
+    }
+}
+
+void RandomEnchantsMgr::RecordShadowSample(uint64 sqlMicros, uint64 inProcessMicros, bool match)
+{
+    _shadowSamples.fetch_add(1, std::memory_order_relaxed);
+    if (!match)
+    {
+        _shadowMismatches.fetch_add(1, std::memory_order_relaxed);
+    }
+    uint64 micros[MAX_SUFFIX_ENGINES] = {sqlMicros, inProcessMicros};
+    for (uint8 i = 0; i < MAX_SUFFIX_ENGINES; ++i)
+    {
+        _shadowEngineStats[i].Record(micros[i]);
+    }
+}
+
+ShadowStats RandomEnchantsMgr::GetShadowStats() const
+{
+    ShadowStats stats;
+    stats.Samples = _shadowSamples.load(std::memory_order_relaxed);
+    stats.Mismatches = _shadowMismatches.load(std::memory_order_relaxed);
+    for (uint8 i = 0; i < MAX_SUFFIX_ENGINES; ++i)
+    {
+        stats.Engines[i].Samples = _shadowEngineStats[i].Samples.load(std::memory_order_relaxed);
+        stats.Engines[i].TotalMicros = _shadowEngineStats[i].TotalMicros.load(std::memory_order_relaxed);
+        stats.Engines[i].MaxMicros = _shadowEngineStats[i].MaxMicros.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void RandomEnchantsMgr::ResetShadowStats()
+{
+    _shadowSamples = 0;
+    _shadowMismatches = 0;
+    for (AtomicSuffixEngineStats& stats : _shadowEngineStats)
+    {
+        stats.Samples = 0;
+        stats.TotalMicros = 0;
+        stats.MaxMicros = 0;
+    }
+}
+
+void RandomEnchantsMgr::OpenRollTrace(std::string const& path, SuffixRollSettings const& settings)
+{
+    std::lock_guard<std::mutex> guard(_rollTraceLock);
+    if (path != _rollTracePath)
+    {
+        if (_rollTrace.is_open())
+        {
+            _rollTrace.close();
+            LOG_INFO("module", ">> RANDOM_ENCHANT: Stopped capturing rolls to {}", _rollTracePath);
+        }
+        _rollTracePath = path;
+        if (!path.empty())
+        {
+            std::ifstream existing(path, std::ios::binary | std::ios::ate);
+            bool isEmpty = !existing || existing.tellg() == 0;
+            existing.close();
+            _rollTrace.open(path, std::ios::binary | std::ios::app);
+            if (!_rollTrace)
+            {
+                LOG_ERROR("module", ">> RANDOM_ENCHANT: Unable to open roll trace file {}", path);
+                _rollTrace.clear();
+                _rollTracePath.clear();
+            }
+            else
+            {
+                if (isEmpty)
+                {
+                    writeRollTraceHeader(_rollTrace);
+                }
+                LOG_INFO("module", ">> RANDOM_ENCHANT: Capturing rolls to {}", path);
+            }
+        }
+    }
+    _rollTraceOpen = _rollTrace.is_open();
+    if (_rollTraceOpen)
+    {
+        writeRollTraceSettings(_rollTrace, settings);
+        _rollTrace.flush();
+    }
+}
+
+void RandomEnchantsMgr::CaptureRoll(ItemTemplate const* proto, SuffixRollContext const& ctx)
+{
+    if (!_rollTraceOpen)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(_rollTraceLock);
+    if (_rollTrace.is_open())
+    {
+        writeRollTraceRoll(_rollTrace, proto, ctx);
+    }
+}
+
+void RandomEnchantsMgr::CloseRollTrace()
+{
+    std::lock_guard<std::mutex> guard(_rollTraceLock);
+    _rollTraceOpen = false;
+    _rollTracePath.clear();
+    if (_rollTrace.is_open())
+    {
+        _rollTrace.close();
+    }
+}
+
+typedef std::vector<uint64> SuffixBitmap;
+
+void RandomEnchantsMgr::LoadItemSuffixValidity()
+{
+    uint32 oldMSTime = getMSTime();
+    _suffixIdBase = 0;
+    _suffixIdRange = 0;
+    _suffixValidityWords = 0;
+    _suffixValidity.clear();
+    _itemSuffixValidity[0].clear();
+    _itemSuffixValidity[1].clear();
+    if (_suffixCatalog.empty())
+    {
+        return;
+    }
+
+    _suffixIdBase = _suffixCatalog.front().SuffixID;
+    for (RandomSuffixCatalogEntry const& entry : _suffixCatalog)
+    {
+        _suffixIdBase = std::min(_suffixIdBase, entry.SuffixID);
+        _suffixIdRange = std::max(_suffixIdRange, entry.SuffixID + 1);
+    }
+    _suffixIdRange -= _suffixIdBase;
+    _suffixValidityWords = (_suffixIdRange + 63) / 64;
+    uint32 words = _suffixValidityWords;
+
+    // buildBitmap sets the bit of every catalog row passing the filter, each filter below
+    // mirrors one condition of the roll query in getCustomRandomSuffix
+    auto buildBitmap = [this, words](auto&& filter)
+    {
+        SuffixBitmap bitmap(words, 0);
+        for (RandomSuffixCatalogEntry const& entry : _suffixCatalog)
+        {
+            if (filter(entry))
+            {
+                uint32 bit = entry.SuffixID - _suffixIdBase;
+                bitmap[bit / 64] |= uint64(1) << (bit % 64);
+            }
+        }
+        return bitmap;
+    };
+
+    // Every player mask that can reach the roll: each talent tree, and each class without talents
+    std::vector<SuffixBitmap> maskBitmaps;
+    std::unordered_map<uint32, uint32> specToMaskBit;
+    // player class -> the mask bits of the class, those of its talent trees and its own
+    std::map<uint8, uint64> classMaskBits;
+    std::set<uint8> classes;
+    auto addMaskBitmap = [&](uint8 plrClass, uint32 plrSpec)
+    {
+        classMaskBits[plrClass] |= uint64(1) << maskBitmaps.size();
+        auto [enchCatMask, attrMask] = getEnchantCategoryMaskByClassAndSpec(plrClass, plrSpec);
+        maskBitmaps.push_back(buildBitmap([enchCatMask = enchCatMask, attrMask = attrMask](RandomSuffixCatalogEntry const& entry) {
+            return (entry.AttributeMask == 0 || ((entry.AttributeMask & attrMask) > 0 && (entry.AttributeMask & ~attrMask) == 0)) &&
+                (entry.EnchantCategoryMask == 0 || (entry.EnchantCategoryMask & enchCatMask) > 0);
+        }));
+    };
+    for (auto const& [spec, plrClass] : specToClass)
+    {
+        specToMaskBit[spec] = maskBitmaps.size();
+        addMaskBitmap(plrClass, spec);
+        classes.insert(plrClass);
+    }
+    for (uint8 plrClass : classes)
+    {
+        addMaskBitmap(plrClass, 0);
+    }
+    ASSERT(maskBitmaps.size() < 64);
+
+    std::map<uint32, SuffixBitmap> levelBitmaps;
+    std::map<std::pair<uint32, uint32>, SuffixBitmap> classBitmaps;
+    std::map<uint32, SuffixBitmap> factorBitmaps;
+    std::map<uint64, SuffixBitmap> poolBitmaps;
+    auto getLevelBitmap = [&](uint32 level) -> SuffixBitmap const&
+    {
+        auto found = levelBitmaps.find(level);
+        if (found == levelBitmaps.end())
+        {
+            found = levelBitmaps.emplace(level, buildBitmap([level](RandomSuffixCatalogEntry const& entry) {
+                return (entry.MinLevel <= level && level <= entry.MaxLevel) || (entry.MinLevel == 0 && entry.MaxLevel == 0);
+            })).first;
+        }
+        return found->second;
+    };
+    auto getClassBitmap = [&](uint32 Class, uint32 subClass) -> SuffixBitmap const&
+    {
+        auto found = classBitmaps.find({Class, subClass});
+        if (found == classBitmaps.end())
+        {
+            uint32 subclassMask = 1 << subClass;
+            found = classBitmaps.emplace(std::make_pair(Class, subClass), buildBitmap([Class, subclassMask](RandomSuffixCatalogEntry const& entry) {
+                return entry.ItemClass == 0 ||
+                    (entry.ItemClass == Class && entry.ItemSubClassMask == 0) ||
+                    (entry.ItemClass == Class && (entry.ItemSubClassMask & subclassMask) > 0);
+            })).first;
+        }
+        return found->second;
+    };
+    // The factor bitmap also holds the checks done on the picked suffix: its tier and basepoints
+    auto getFactorBitmap = [&](uint32 suffFactor) -> SuffixBitmap const&
+    {
+        auto found = factorBitmaps.find(suffFactor);
+        if (found == factorBitmaps.end())
+        {
+            found = factorBitmaps.emplace(suffFactor, buildBitmap([suffFactor](RandomSuffixCatalogEntry const& entry) {
+                return entry.InStore && entry.Weight > 0 && entry.EnchantQuality < MAX_RAND_ENCHANT_TIERS &&
+                    int32(entry.MinAllocPct * suffFactor / 10000) >= 1;
+            })).first;
+        }
+        return found->second;
+    };
+    auto getPoolBitmap = [&](uint64 pool) -> SuffixBitmap const&
+    {
+        auto found = poolBitmaps.find(pool);
+        if (found == poolBitmaps.end())
+        {
+            SuffixBitmap bitmap(words, 0);
+            for (uint32 i = 0; i < maskBitmaps.size(); ++i)
+            {
+                if (pool & (uint64(1) << i))
+                {
+                    for (uint32 w = 0; w < words; ++w)
+                    {
+                        bitmap[w] |= maskBitmaps[i][w];
+                    }
+                }
+            }
+            found = poolBitmaps.emplace(pool, std::move(bitmap)).first;
+        }
+        return found->second;
+    };
+
+    // Items with equal keys always share a bitmap, equal bitmaps are then deduplicated by content
+    typedef std::tuple<uint32, uint32, uint32, uint32, uint64> ItemSuffixKey;
+    std::map<ItemSuffixKey, uint32> keyToIndex;
+    std::map<SuffixBitmap, uint32> bitmapToIndex;
+    bitmapToIndex[SuffixBitmap(words, 0)] = 0;
+    _suffixValidity.assign(words, 0);
+    auto getIndex = [&](uint32 level, uint32 Class, uint32 subClass, uint32 suffFactor, uint64 pool) -> uint32
+    {
+        ItemSuffixKey key{level, Class, subClass, suffFactor, pool};
+        if (auto found = keyToIndex.find(key); found != keyToIndex.end())
+        {
+            return found->second;
+        }
+        SuffixBitmap const& levelBitmap = getLevelBitmap(level);
+        SuffixBitmap const& classBitmap = getClassBitmap(Class, subClass);
+        SuffixBitmap const& factorBitmap = getFactorBitmap(suffFactor);
+        SuffixBitmap const& poolBitmap = getPoolBitmap(pool);
+        SuffixBitmap bitmap(words, 0);
+        for (uint32 w = 0; w < words; ++w)
+        {
+            bitmap[w] = levelBitmap[w] & classBitmap[w] & factorBitmap[w] & poolBitmap[w];
+        }
+        auto [found, inserted] = bitmapToIndex.emplace(std::move(bitmap), bitmapToIndex.size());
+        if (inserted)
+        {
+            _suffixValidity.insert(_suffixValidity.end(), found->first.begin(), found->first.end());
+        }
+        keyToIndex[key] = found->second;
+        return found->second;
+    };
+
+    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
+    uint32 maxItemId = 0;
+    for (auto const& itr : *itemTemplates)
+    {
+        maxItemId = std::max(maxItemId, itr.first);
+    }
+    _itemSuffixValidity[0].assign(maxItemId + 1, 0);
+    _itemSuffixValidity[1].assign(maxItemId + 1, 0);
+    uint32 rollableItems = 0;
+    for (auto const& itr : *itemTemplates)
+    {
+        ItemTemplate const* proto = &itr.second;
+        if (!isRollableItemTemplate(proto))
+        {
+            continue;
+        }
+        ++rollableItems;
+        uint32 level = getItemTemplatePlayerLevel(proto);
+        uint32 suffFactor = GetItemSuffixFactor(proto->ItemId);
+        uint64 pool = 0;
+        for (uint32 spec : getItemTemplateSpecPool(proto, level))
+        {
+            if (auto found = specToMaskBit.find(spec); found != specToMaskBit.end())
+            {
+                pool |= uint64(1) << found->second;
+            }
+        }
+        if (pool)
+        {
+            _itemSuffixValidity[0][proto->ItemId] = getIndex(level, proto->Class, proto->SubClass, suffFactor, pool);
+        }
+        // With the class preference, a player able to use the item rolls with the masks of their own class, any
+        // other player with the item's masks. A class is left out if the item does not allow it, as in
+        // Player::CanUseItem, or if it can never learn the armor or weapon proficiency.
+        uint64 classPool = pool;
+        for (auto const& [plrClass, maskBits] : classMaskBits)
+        {
+            if ((proto->AllowableClass & (1 << (plrClass - 1))) != 0 && canClassUseItemSubClass(plrClass, proto->Class, proto->SubClass))
+            {
+                classPool |= maskBits;
+            }
+        }
+        if (classPool)
+        {
+            _itemSuffixValidity[1][proto->ItemId] = getIndex(level, proto->Class, proto->SubClass, suffFactor, classPool);
+        }
+    }
+
+    size_t memory = _suffixValidity.size() * sizeof(uint64) + 2 * _itemSuffixValidity[0].size() * sizeof(uint32);
+    LOG_INFO("module", ">> RANDOM_ENCHANT: Built suffix validity for {} rollable items over {} suffixes: {} distinct bitmaps from {} item keys, {} bytes in {} ms",
+        rollableItems, _suffixCatalog.size(), bitmapToIndex.size(), keyToIndex.size(), memory, GetMSTimeDiffToNow(oldMSTime));
+}
+
+bool RandomEnchantsMgr::IsValidItemSuffix(uint32 itemId, uint32 suffixId) const
+{
+    std::vector<uint32> const& itemSuffixValidity = _itemSuffixValidity[getRandomEnchantsConfig()->RollPlayerClassPreference ? 1 : 0];
+    if (itemId >= itemSuffixValidity.size() || suffixId < _suffixIdBase || suffixId - _suffixIdBase >= _suffixIdRange)
+    {
+        return false;
+    }
+    uint32 bit = suffixId - _suffixIdBase;
+    uint64 word = _suffixValidity[size_t(itemSuffixValidity[itemId]) * _suffixValidityWords + bit / 64];
+    return (word >> (bit % 64)) & 1;
+}
+
+bool RandomEnchantsMgr::IsCustomSuffix(uint32 suffixId) const
+{
+    auto found = std::lower_bound(_suffixCatalog.begin(), _suffixCatalog.end(), suffixId, [](RandomSuffixCatalogEntry const& entry, uint32 id) {
+        return entry.SuffixID < id;
+    });
+    return found != _suffixCatalog.end() && found->SuffixID == suffixId;
+}
+
+bool RandomEnchantsMgr::TryStartReforge(uint32 playerGuid, uint32 cooldownMs)
+{
+    auto now = std::chrono::steady_clock::now();
+    auto cooldown = std::chrono::milliseconds(cooldownMs);
+    std::lock_guard<std::mutex> guard(_reforgeLock);
+    auto [found, inserted] = _lastReforges.emplace(playerGuid, now);
+    if (!inserted)
+    {
+        if (now - found->second < cooldown)
+        {
+            return false;
+        }
+        found->second = now;
+    }
+    // Forget players whose cooldown is over so the map only holds recent reforges
+    if (inserted && _lastReforges.size() > 1024)
+    {
+        for (auto itr = _lastReforges.begin(); itr != _lastReforges.end();)
+        {
+            if (now - itr->second >= cooldown)
+            {
+                itr = _lastReforges.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,144 @@
+/*
+* RandomEnchantsMgr holds the data the module precomputes at startup
+*/
+#ifndef _RANDOM_ENCHANTS_MGR_H_
+#define _RANDOM_ENCHANTS_MGR_H_
+
+#include "Define.h"
+#include "ItemEnchantmentMgr.h"
+#include "RandomEnchantsConfig.h"
+#include "RandomSuffixAlias.h"
+#include "RandomSuffixColumns.h"
+#include "RandomSuffixEngine.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct SuffixEngineStats
+{
+    uint64 Samples;
+    uint64 TotalMicros;
+    uint64 MaxMicros;
+};
+
+struct ShadowStats
+{
+    uint64 Samples;
+    uint64 Mismatches;
+    SuffixEngineStats Engines[MAX_SUFFIX_ENGINES];
+};
+
+class RandomEnchantsMgr
+{
+public:
+    static RandomEnchantsMgr* instance();
+
+    // LoadItemLevelRequirements caches the average required level of every item level in one query
+    void LoadItemLevelRequirements();
+    uint32 GetAverageRequiredLevel(uint32 itemLevel) const;
+
+    // LoadItemSuffixFactors precomputes GenerateEnchSuffixFactor for every item template and
+    // hands the table over to the core so both share the same O(1) lookup, once at startup
+    void LoadItemSuffixFactors();
+    uint32 GetItemSuffixFactor(uint32 itemId) const
+    {
+        if (itemId < _itemSuffixFactors.size())
+        {
+            return _itemSuffixFactors[itemId];
+        }
+        return GenerateEnchSuffixFactor(itemId);
+    }
+
+    void LoadSuffixCatalog();
+    std::vector<RandomSuffixCatalogEntry> const& GetSuffixCatalog() const { return _suffixCatalog; }
+    // GetSuffixColumns is the catalog stored as columns for the in-process engine
+    SuffixCatalogColumns const& GetSuffixColumns() const { return _suffixColumns; }
+    // GetSuffixAliasTables are the weighted picks of the in-process engine for every roll bucket
+    SuffixAliasTables const& GetSuffixAliasTables() const { return _suffixAliasTables; }
+
+    // GetSuffixCandidates is the in-process engine, it returns the IDs of every catalog row
+    // matching the roll query, ordered by suffix ID
+    void GetSuffixCandidates(SuffixRollQuery const& query, std::vector<uint32>& candidates) const;
+
+    // GetSuffixRollPreview returns every outcome of rolling the item from its spec pool, or with the masks of the
+    // spec if it is not 0. Previews are cached per item and spec until the catalog or the roll percentages change.
+    std::shared_ptr<SuffixRollPreview const> GetSuffixRollPreview(ItemTemplate const* proto, uint32 spec);
+    void ResetSuffixRollPreviews();
+
+    // Shadow mode statistics, recorded from the map threads rolling suffixes
+    void RecordShadowSample(uint64 sqlMicros, uint64 inProcessMicros, bool match);
+    ShadowStats GetShadowStats() const;
+    void ResetShadowStats();
+
+    // OpenRollTrace starts appending the inputs of every roll to the trace file, or stops capturing if the
+    // path is empty. The settings are recorded again on every call so config reloads show up in the trace.
+    void OpenRollTrace(std::string const& path, SuffixRollSettings const& settings);
+    void CaptureRoll(ItemTemplate const* proto, SuffixRollContext const& ctx);
+    void CloseRollTrace();
+
+    // LoadItemSuffixValidity precomputes, for every rollable item template, which of the
+    // custom suffixes the roll could ever give it. Requires LoadSuffixCatalog.
+    void LoadItemSuffixValidity();
+    // IsValidItemSuffix returns true if the item could have rolled the custom suffix
+    bool IsValidItemSuffix(uint32 itemId, uint32 suffixId) const;
+    // IsCustomSuffix returns true if the suffix is one of the module's
+    bool IsCustomSuffix(uint32 suffixId) const;
+
+    // TryStartReforge returns false if the player started a reforge less than cooldownMs ago
+    bool TryStartReforge(uint32 playerGuid, uint32 cooldownMs);
+
+private:
+    RandomEnchantsMgr() = default;
+
+    std::unordered_map<uint32, uint32> _averageRequiredLevels;
+    std::vector<uint32> _itemSuffixFactors;
+    // _coreItemSuffixFactors is _itemSuffixFactors as published to the core
+    CustomItemSuffixFactors _coreItemSuffixFactors = {nullptr, 0};
+    std::vector<RandomSuffixCatalogEntry> _suffixCatalog;
+    SuffixCatalogColumns _suffixColumns;
+    SuffixAliasTables _suffixAliasTables;
+
+    // Validity bitmaps are indexed by (suffix ID - _suffixIdBase), _suffixValidityWords words each.
+    // Items share the same bitmap whenever their suffix sets are equal, bitmap 0 is always empty.
+    uint32 _suffixIdBase = 0;
+    uint32 _suffixIdRange = 0;
+    uint32 _suffixValidityWords = 0;
+    std::vector<uint64> _suffixValidity;
+    // item ID -> bitmap index, [0] without and [1] with the player class preference
+    std::vector<uint32> _itemSuffixValidity[2];
+
+    std::mutex _reforgeLock;
+    std::unordered_map<uint32, std::chrono::steady_clock::time_point> _lastReforges;
+
+    std::mutex _rollPreviewLock;
+    // (item ID << 32 | spec) -> preview
+    std::unordered_map<uint64, std::shared_ptr<SuffixRollPreview const>> _rollPreviews;
+    // _rollPreviewGeneration is the generation of the config snapshot the previews were worked out with
+    uint32 _rollPreviewGeneration = 0;
+
+    struct AtomicSuffixEngineStats
+    {
+        std::atomic<uint64> Samples{0};
+        std::atomic<uint64> TotalMicros{0};
+        std::atomic<uint64> MaxMicros{0};
+
+        void Record(uint64 micros);
+    };
+    std::mutex _rollTraceLock;
+    std::atomic<bool> _rollTraceOpen{false};
+    std::string _rollTracePath;
+    std::ofstream _rollTrace;
+
+    std::atomic<uint64> _shadowSamples{0};
+    std::atomic<uint64> _shadowMismatches{0};
+    AtomicSuffixEngineStats _shadowEngineStats[MAX_SUFFIX_ENGINES];
+};
+
+#define sRandomEnchantsMgr RandomEnchantsMgr::instance()
+
+#endif
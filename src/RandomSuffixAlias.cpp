@@ -0,0 +1,270 @@
+/*
+* Alias tables of the suffix catalog buckets, see RandomSuffixAlias.h
+*/
+#include "RandomSuffixAlias.h"
+#include <algorithm>
+#include <map>
+#include <set>
+
+// Item player levels past this one are only bucketed if no catalog row has a level above it
+#define SUFFIX_ALIAS_MAX_LEVEL 255
+
+typedef std::vector<uint64> SuffixRowBitmap;
+
+// buildRowBitmap sets the bit of every catalog row passing the filter
+template <typename Filter>
+static SuffixRowBitmap buildRowBitmap(std::vector<RandomSuffixCatalogEntry> const& catalog, Filter&& filter)
+{
+    SuffixRowBitmap bitmap((catalog.size() + 63) / 64, 0);
+    for (uint32 row = 0; row < catalog.size(); ++row)
+    {
+        if (filter(catalog[row]))
+        {
+            bitmap[row / 64] |= uint64(1) << (row % 64);
+        }
+    }
+    return bitmap;
+}
+
+// getBitmapGroup returns the group of the values matching the rows of the bitmap, adding a group for the first one
+static uint32 getBitmapGroup(std::map<SuffixRowBitmap, uint32>& groupIndexes, std::vector<SuffixRowBitmap>& groups, SuffixRowBitmap&& bitmap)
+{
+    auto found = groupIndexes.find(bitmap);
+    if (found != groupIndexes.end())
+    {
+        return found->second;
+    }
+    groupIndexes.emplace(bitmap, groups.size());
+    groups.push_back(std::move(bitmap));
+    return groups.size() - 1;
+}
+
+static void intersectBitmaps(SuffixRowBitmap const& a, SuffixRowBitmap const& b, SuffixRowBitmap& out)
+{
+    out.resize(a.size());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        out[i] = a[i] & b[i];
+    }
+}
+
+void SuffixAliasTables::Build(std::vector<RandomSuffixCatalogEntry> const& catalog)
+{
+    _levelGroups.clear();
+    _itemClasses.clear();
+    _itemGroups.clear();
+    _maskGroups.clear();
+    _buckets.clear();
+    _tables.clear();
+    _suffixIds.clear();
+    _slots.clear();
+    _maxLevel = 0;
+    _itemGroupCount = 0;
+    _maskGroupCount = 0;
+
+    // Past the highest bound of every level range, a level only matches the rows without one
+    for (RandomSuffixCatalogEntry const& entry : catalog)
+    {
+        if (entry.MinLevel != 0 || entry.MaxLevel != 0)
+        {
+            _maxLevel = std::max<uint32>(_maxLevel, std::min<uint32>(std::max(entry.MinLevel, entry.MaxLevel), SUFFIX_ALIAS_MAX_LEVEL) + 1);
+        }
+    }
+    _maxLevel = std::min<uint32>(_maxLevel, SUFFIX_ALIAS_MAX_LEVEL);
+    std::map<SuffixRowBitmap, uint32> groupIndexes;
+    std::vector<SuffixRowBitmap> levelBitmaps;
+    for (uint32 level = 0; level <= _maxLevel; ++level)
+    {
+        _levelGroups.push_back(getBitmapGroup(groupIndexes, levelBitmaps, buildRowBitmap(catalog, [level](RandomSuffixCatalogEntry const& entry) {
+            return (entry.MinLevel <= level && level <= entry.MaxLevel) || (entry.MinLevel == 0 && entry.MaxLevel == 0);
+        })));
+    }
+
+    std::set<uint32> itemClasses;
+    for (RandomSuffixCatalogEntry const& entry : catalog)
+    {
+        if (entry.ItemClass != 0)
+        {
+            itemClasses.insert(entry.ItemClass);
+        }
+    }
+    _itemClasses.assign(itemClasses.begin(), itemClasses.end());
+    groupIndexes.clear();
+    std::vector<SuffixRowBitmap> itemBitmaps;
+    for (uint32 i = 0; i <= _itemClasses.size(); ++i)
+    {
+        // The item classes past the ones of the catalog stand for every other class, which only matches rows of any class
+        uint32 itemClass = i < _itemClasses.size() ? _itemClasses[i] : 0;
+        for (uint32 subClass = 0; subClass < 32; ++subClass)
+        {
+            uint32 subClassMask = uint32(1) << subClass;
+            _itemGroups.push_back(getBitmapGroup(groupIndexes, itemBitmaps, buildRowBitmap(catalog, [itemClass, subClassMask](RandomSuffixCatalogEntry const& entry) {
+                return entry.ItemClass == 0 ||
+                    (itemClass != 0 && entry.ItemClass == itemClass && (entry.ItemSubClassMask == 0 || (entry.ItemSubClassMask & subClassMask) > 0));
+            })));
+        }
+    }
+    _itemGroupCount = itemBitmaps.size();
+
+    // Every player mask that can reach the roll: each talent tree, and each class without talents
+    groupIndexes.clear();
+    std::vector<SuffixRowBitmap> maskBitmaps;
+    std::set<uint8> classes;
+    auto addMasks = [&](uint8 plrClass, uint32 plrSpec)
+    {
+        EnchantMasks masks = getEnchantCategoryMaskByClassAndSpec(plrClass, plrSpec);
+        uint64 key = (uint64(masks.attrMask) << 32) | masks.enchCatMask;
+        if (_maskGroups.count(key))
+        {
+            return;
+        }
+        _maskGroups[key] = getBitmapGroup(groupIndexes, maskBitmaps, buildRowBitmap(catalog, [masks](RandomSuffixCatalogEntry const& entry) {
+            return (entry.AttributeMask == 0 || ((entry.AttributeMask & masks.attrMask) > 0 && (entry.AttributeMask & ~masks.attrMask) == 0)) &&
+                (entry.EnchantCategoryMask == 0 || (entry.EnchantCategoryMask & masks.enchCatMask) > 0);
+        }));
+    };
+    for (auto const& [spec, plrClass] : specToClass)
+    {
+        addMasks(plrClass, spec);
+        classes.insert(plrClass);
+    }
+    for (uint8 plrClass : classes)
+    {
+        addMasks(plrClass, 0);
+    }
+    _maskGroupCount = maskBitmaps.size();
+
+    // Rows of weight 0 are left out of every tier, so no bucket has them
+    std::vector<SuffixRowBitmap> tierBitmaps;
+    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        tierBitmaps.push_back(buildRowBitmap(catalog, [tier](RandomSuffixCatalogEntry const& entry) {
+            return entry.Weight > 0 && entry.EnchantQuality == tier;
+        }));
+    }
+
+    // Buckets with the same candidates share a table, the empty table has no slots
+    std::map<SuffixRowBitmap, uint32> tableIndexes;
+    std::vector<uint32> rows;
+    std::vector<SuffixAliasSlot> table;
+    auto getTable = [&](SuffixRowBitmap const& bitmap) -> uint32
+    {
+        auto found = tableIndexes.find(bitmap);
+        if (found != tableIndexes.end())
+        {
+            return found->second;
+        }
+        rows.clear();
+        for (uint32 word = 0; word < bitmap.size(); ++word)
+        {
+            for (uint64 bits = bitmap[word]; bits; bits &= bits - 1)
+            {
+                uint32 bit = 0;
+                while (!(bits & (uint64(1) << bit)))
+                {
+                    ++bit;
+                }
+                rows.push_back(word * 64 + bit);
+            }
+        }
+        buildSuffixAliasTable(catalog, rows, table);
+        bool uniform = std::all_of(table.begin(), table.end(), [](SuffixAliasSlot const& slot) { return slot.Threshold == SUFFIX_ALIAS_KEEP; });
+        if (uniform)
+        {
+            _tables.push_back({uint32(_suffixIds.size()), uint32(table.size()), true});
+            for (SuffixAliasSlot const& slot : table)
+            {
+                _suffixIds.push_back(slot.SuffixID);
+            }
+        }
+        else
+        {
+            _tables.push_back({uint32(_slots.size()), uint32(table.size()), false});
+            _slots.insert(_slots.end(), table.begin(), table.end());
+        }
+        tableIndexes.emplace(bitmap, _tables.size() - 1);
+        return _tables.size() - 1;
+    };
+
+    _buckets.reserve(levelBitmaps.size() * _itemGroupCount * MAX_RAND_ENCHANT_TIERS * _maskGroupCount);
+    SuffixRowBitmap levelItem;
+    SuffixRowBitmap levelItemTier;
+    SuffixRowBitmap candidates;
+    for (SuffixRowBitmap const& levelBitmap : levelBitmaps)
+    {
+        for (SuffixRowBitmap const& itemBitmap : itemBitmaps)
+        {
+            intersectBitmaps(levelBitmap, itemBitmap, levelItem);
+            for (SuffixRowBitmap const& tierBitmap : tierBitmaps)
+            {
+                intersectBitmaps(levelItem, tierBitmap, levelItemTier);
+                for (SuffixRowBitmap const& maskBitmap : maskBitmaps)
+                {
+                    intersectBitmaps(levelItemTier, maskBitmap, candidates);
+                    _buckets.push_back(getTable(candidates));
+                }
+            }
+        }
+    }
+}
+
+size_t SuffixAliasTables::GetMemorySize() const
+{
+    return (_levelGroups.size() + _itemGroups.size() + _buckets.size() + _suffixIds.size()) * sizeof(uint32) +
+        _tables.size() * sizeof(Table) + _slots.size() * sizeof(SuffixAliasSlot);
+}
+
+bool SuffixAliasTables::Pick(SuffixRollQuery const& query, SuffixRollRng& rng, int32& suffixId) const
+{
+    if (_buckets.empty() || query.EnchantQuality >= MAX_RAND_ENCHANT_TIERS || !query.SubClassMask || (query.SubClassMask & (query.SubClassMask - 1)))
+    {
+        return false;
+    }
+    auto mask = _maskGroups.find((uint64(query.AttrMask) << 32) | query.EnchCatMask);
+    if (mask == _maskGroups.end())
+    {
+        return false;
+    }
+    uint32 level = query.Level;
+    if (level > _maxLevel)
+    {
+        if (_maxLevel == SUFFIX_ALIAS_MAX_LEVEL)
+        {
+            return false;
+        }
+        level = _maxLevel;
+    }
+    uint32 itemClass = std::find(_itemClasses.begin(), _itemClasses.end(), query.ItemClass) - _itemClasses.begin();
+    uint32 subClass = 0;
+    while (!(query.SubClassMask & (uint32(1) << subClass)))
+    {
+        ++subClass;
+    }
+    uint32 bucket = ((_levelGroups[level] * _itemGroupCount + _itemGroups[itemClass * 32 + subClass]) * MAX_RAND_ENCHANT_TIERS +
+        query.EnchantQuality) * _maskGroupCount + mask->second;
+    Table const& table = _tables[_buckets[bucket]];
+    if (!table.Size)
+    {
+        suffixId = -1;
+    }
+    else if (table.Uniform)
+    {
+        // Same as pickSuffixAlias over slots that all keep their suffix
+        suffixId = _suffixIds[table.Offset + rng() % table.Size];
+    }
+    else
+    {
+        suffixId = pickSuffixAlias(_slots.data() + table.Offset, table.Size, rng);
+    }
+    return true;
+}
+
+int32 AliasSuffixSource::PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng)
+{
+    int32 suffixId;
+    if (!_tables.Pick(query, rng, suffixId))
+    {
+        return ColumnarSuffixSource::PickCandidate(query, rng);
+    }
+    return suffixId;
+}
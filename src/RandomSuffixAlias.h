@@ -0,0 +1,76 @@
+/*
+* Weighted picks of the in-process engine through alias tables built once when the suffix catalog is loaded.
+*
+* Roll queries are split into buckets that always have the same candidates: the item player levels, the item
+* classes and subclasses and the player masks are each grouped by the catalog rows they match, and a bucket is
+* one group of each with a tier. Every bucket gets the Walker/Vose alias table of its candidates, buckets with the
+* same candidates share theirs, so a pick is one random index and one compare however many candidates there are.
+* The table of candidates of the same weight only keeps their suffix IDs, every slot of it keeps its suffix.
+*/
+#ifndef _RANDOM_SUFFIX_ALIAS_H_
+#define _RANDOM_SUFFIX_ALIAS_H_
+
+#include "RandomSuffixColumns.h"
+#include <unordered_map>
+#include <vector>
+
+class SuffixAliasTables
+{
+public:
+    SuffixAliasTables() = default;
+    explicit SuffixAliasTables(std::vector<RandomSuffixCatalogEntry> const& catalog) { Build(catalog); }
+
+    void Build(std::vector<RandomSuffixCatalogEntry> const& catalog);
+
+    // Pick picks a candidate of the query from the alias table of its bucket, suffixId is -1 if the bucket has no
+    // candidates. Returns false if no bucket has the query: the masks are not those of a player class and spec, the
+    // subclass mask is not a single subclass or the tier is past MAX_RAND_ENCHANT_TIERS.
+    bool Pick(SuffixRollQuery const& query, SuffixRollRng& rng, int32& suffixId) const;
+
+    uint32 GetBucketCount() const { return _buckets.size(); }
+    uint32 GetTableCount() const { return _tables.size(); }
+    // GetMemorySize is the bytes of the buckets and the tables
+    size_t GetMemorySize() const;
+
+private:
+    // Levels past _maxLevel are in its group, unless _maxLevel is capped at the highest level bucketed
+    uint32 _maxLevel = 0;
+    std::vector<uint32> _levelGroups;
+    // _itemGroups has 32 subclasses for each of _itemClasses, then 32 for every other item class
+    std::vector<uint32> _itemClasses;
+    std::vector<uint32> _itemGroups;
+    uint32 _itemGroupCount = 0;
+    // _maskGroups is keyed by the attribute mask in the high half and the enchant category mask in the low half
+    std::unordered_map<uint64, uint32> _maskGroups;
+    uint32 _maskGroupCount = 0;
+    // _buckets holds the table of every level group, item group, tier and mask group, in that order
+    std::vector<uint32> _buckets;
+    struct Table
+    {
+        // Offset is in _suffixIds if Uniform, in _slots otherwise
+        uint32 Offset;
+        uint32 Size;
+        bool Uniform;
+    };
+    std::vector<Table> _tables;
+    std::vector<uint32> _suffixIds;
+    std::vector<SuffixAliasSlot> _slots;
+};
+
+// AliasSuffixSource picks the same candidates as CatalogSuffixSource, from the alias table of the bucket of the query.
+// A query out of every bucket is filtered on the column store. The catalog must be the one the columns and the tables
+// were built from.
+class AliasSuffixSource : public ColumnarSuffixSource
+{
+public:
+    AliasSuffixSource(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixCatalogColumns const& columns, SuffixAliasTables const& tables,
+        SuffixFilterIsa isa = getBestSuffixFilterIsa())
+        : ColumnarSuffixSource(catalog, columns, isa), _tables(tables) { }
+
+    int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) override;
+
+private:
+    SuffixAliasTables const& _tables;
+};
+
+#endif
@@ -0,0 +1,346 @@
+/*
+* Column store of the suffix catalog, see RandomSuffixColumns.h
+*/
+#include "RandomSuffixColumns.h"
+#include <algorithm>
+#include <climits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SUFFIX_FILTER_X86
+#define SUFFIX_FILTER_TARGET_SSE2 __attribute__((target("sse2")))
+#define SUFFIX_FILTER_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define SUFFIX_FILTER_X86
+#define SUFFIX_FILTER_TARGET_SSE2
+#define SUFFIX_FILTER_TARGET_AVX2
+#endif
+
+static char const* const suffixFilterIsaNames[MAX_SUFFIX_FILTER_ISAS] = { "scalar", "sse2", "avx2" };
+
+#ifdef SUFFIX_FILTER_X86
+static bool cpuSupportsSse2()
+{
+#if defined(_MSC_VER) || defined(__x86_64__)
+    // Part of x86-64
+    return true;
+#else
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+static bool cpuSupportsAvx2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    // The OS has to save the AVX registers too
+    bool osxsave = info[2] & (1 << 27);
+    bool avx = info[2] & (1 << 28);
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6)
+    {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return info[1] & (1 << 5);
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+bool isSuffixFilterIsaSupported(SuffixFilterIsa isa)
+{
+    switch (isa)
+    {
+        case SUFFIX_FILTER_SCALAR:
+            return true;
+#ifdef SUFFIX_FILTER_X86
+        case SUFFIX_FILTER_SSE2:
+            return cpuSupportsSse2();
+        case SUFFIX_FILTER_AVX2:
+            return cpuSupportsAvx2();
+#endif
+        default:
+            return false;
+    }
+}
+
+SuffixFilterIsa getBestSuffixFilterIsa()
+{
+    static SuffixFilterIsa const best = []()
+    {
+        if (isSuffixFilterIsaSupported(SUFFIX_FILTER_AVX2))
+        {
+            return SUFFIX_FILTER_AVX2;
+        }
+        if (isSuffixFilterIsaSupported(SUFFIX_FILTER_SSE2))
+        {
+            return SUFFIX_FILTER_SSE2;
+        }
+        return SUFFIX_FILTER_SCALAR;
+    }();
+    return best;
+}
+
+char const* getSuffixFilterIsaName(SuffixFilterIsa isa)
+{
+    return isa < MAX_SUFFIX_FILTER_ISAS ? suffixFilterIsaNames[isa] : "unknown";
+}
+
+static int32 clampLevel(uint32 level)
+{
+    return int32(std::min<uint32>(level, INT32_MAX));
+}
+
+void SuffixCatalogColumns::Build(std::vector<RandomSuffixCatalogEntry> const& catalog)
+{
+    _suffixIds.clear();
+    _blocks.assign((catalog.size() + SUFFIX_COLUMN_BLOCK_ROWS - 1) / SUFFIX_COLUMN_BLOCK_ROWS, SuffixColumnBlock());
+    for (size_t row = 0; row < catalog.size(); ++row)
+    {
+        RandomSuffixCatalogEntry const& entry = catalog[row];
+        SuffixColumnBlock& block = _blocks[row / SUFFIX_COLUMN_BLOCK_ROWS];
+        size_t i = row % SUFFIX_COLUMN_BLOCK_ROWS;
+        block.MinLevel[i] = clampLevel(entry.MinLevel);
+        block.MaxLevel[i] = clampLevel(entry.MaxLevel);
+        if (entry.Weight == 0)
+        {
+            // An empty level range never matches, same as matchesSuffixRollQuery for rows of weight 0
+            block.MinLevel[i] = 1;
+            block.MaxLevel[i] = 0;
+        }
+        block.AttributeMask[i] = entry.AttributeMask;
+        block.ItemClass[i] = entry.ItemClass;
+        block.ItemSubClassMask[i] = entry.ItemSubClassMask;
+        block.EnchantQuality[i] = entry.EnchantQuality;
+        block.EnchantCategoryMask[i] = entry.EnchantCategoryMask;
+        _suffixIds.push_back(entry.SuffixID);
+    }
+}
+
+// filterScalar evaluates the roll query a row at a time, checking the most selective columns first
+static void filterScalar(SuffixColumnBlock const* blocks, size_t blockCount, SuffixRollQuery const& query, int32 level, uint64* matches)
+{
+    for (size_t b = 0; b < blockCount; ++b)
+    {
+        SuffixColumnBlock const& block = blocks[b];
+        uint64 bits = 0;
+        for (uint32 i = 0; i < SUFFIX_COLUMN_BLOCK_ROWS; ++i)
+        {
+            int32 minLevel = block.MinLevel[i];
+            int32 maxLevel = block.MaxLevel[i];
+            uint32 itemClass = block.ItemClass[i];
+            uint32 subClassMask = block.ItemSubClassMask[i];
+            uint32 attrMask = block.AttributeMask[i];
+            uint32 enchCatMask = block.EnchantCategoryMask[i];
+            bool match = block.EnchantQuality[i] == query.EnchantQuality &&
+                (itemClass == 0 || (itemClass == query.ItemClass && (subClassMask == 0 || (subClassMask & query.SubClassMask) != 0))) &&
+                ((minLevel <= level && level <= maxLevel) || (minLevel == 0 && maxLevel == 0)) &&
+                (attrMask == 0 || ((attrMask & query.AttrMask) != 0 && (attrMask & ~query.AttrMask) == 0)) &&
+                (enchCatMask == 0 || (enchCatMask & query.EnchCatMask) != 0);
+            bits |= uint64(match) << i;
+        }
+        matches[b] = bits;
+    }
+}
+
+#ifdef SUFFIX_FILTER_X86
+// The vector filters first check EnchantQuality and ItemClass, which rule out most rows of a query, and skip the
+// rest of the columns for lanes with no row left. The generator writes alike suffixes next to each other, so most are.
+
+SUFFIX_FILTER_TARGET_SSE2
+static void filterSse2(SuffixColumnBlock const* blocks, size_t blockCount, SuffixRollQuery const& query, int32 level, uint64* matches)
+{
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const ones = _mm_set1_epi32(-1);
+    __m128i const qLevel = _mm_set1_epi32(level);
+    __m128i const qItemClass = _mm_set1_epi32(int32(query.ItemClass));
+    __m128i const qSubClassMask = _mm_set1_epi32(int32(query.SubClassMask));
+    __m128i const qQuality = _mm_set1_epi32(int32(query.EnchantQuality));
+    __m128i const qAttrMask = _mm_set1_epi32(int32(query.AttrMask));
+    __m128i const qEnchCatMask = _mm_set1_epi32(int32(query.EnchCatMask));
+    for (size_t b = 0; b < blockCount; ++b)
+    {
+        SuffixColumnBlock const& block = blocks[b];
+        uint64 bits = 0;
+        for (uint32 i = 0; i < SUFFIX_COLUMN_BLOCK_ROWS; i += 4)
+        {
+            __m128i quality = _mm_load_si128(reinterpret_cast<__m128i const*>(block.EnchantQuality + i));
+            __m128i itemClass = _mm_load_si128(reinterpret_cast<__m128i const*>(block.ItemClass + i));
+            __m128i anyItemClass = _mm_cmpeq_epi32(itemClass, zero);
+            __m128i sameItemClass = _mm_cmpeq_epi32(itemClass, qItemClass);
+            __m128i ok = _mm_and_si128(_mm_cmpeq_epi32(quality, qQuality), _mm_or_si128(anyItemClass, sameItemClass));
+            if (!_mm_movemask_ps(_mm_castsi128_ps(ok)))
+            {
+                continue;
+            }
+            __m128i minLevel = _mm_load_si128(reinterpret_cast<__m128i const*>(block.MinLevel + i));
+            __m128i maxLevel = _mm_load_si128(reinterpret_cast<__m128i const*>(block.MaxLevel + i));
+            __m128i subClassMask = _mm_load_si128(reinterpret_cast<__m128i const*>(block.ItemSubClassMask + i));
+            __m128i attrMask = _mm_load_si128(reinterpret_cast<__m128i const*>(block.AttributeMask + i));
+            __m128i enchCatMask = _mm_load_si128(reinterpret_cast<__m128i const*>(block.EnchantCategoryMask + i));
+
+            __m128i levelOut = _mm_or_si128(_mm_cmpgt_epi32(minLevel, qLevel), _mm_cmpgt_epi32(qLevel, maxLevel));
+            __m128i levelAny = _mm_and_si128(_mm_cmpeq_epi32(minLevel, zero), _mm_cmpeq_epi32(maxLevel, zero));
+            __m128i levelOk = _mm_or_si128(_mm_xor_si128(levelOut, ones), levelAny);
+
+            __m128i subClassOk = _mm_or_si128(_mm_cmpeq_epi32(subClassMask, zero),
+                _mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(subClassMask, qSubClassMask), zero), ones));
+            __m128i itemOk = _mm_or_si128(anyItemClass, _mm_and_si128(sameItemClass, subClassOk));
+
+            __m128i attrHit = _mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(attrMask, qAttrMask), zero), ones);
+            __m128i attrNoExtra = _mm_cmpeq_epi32(_mm_andnot_si128(qAttrMask, attrMask), zero);
+            __m128i attrOk = _mm_or_si128(_mm_cmpeq_epi32(attrMask, zero), _mm_and_si128(attrHit, attrNoExtra));
+
+            __m128i catOk = _mm_or_si128(_mm_cmpeq_epi32(enchCatMask, zero),
+                _mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(enchCatMask, qEnchCatMask), zero), ones));
+
+            ok = _mm_and_si128(_mm_and_si128(ok, levelOk), _mm_and_si128(itemOk, _mm_and_si128(attrOk, catOk)));
+            bits |= uint64(_mm_movemask_ps(_mm_castsi128_ps(ok))) << i;
+        }
+        matches[b] = bits;
+    }
+}
+
+SUFFIX_FILTER_TARGET_AVX2
+static void filterAvx2(SuffixColumnBlock const* blocks, size_t blockCount, SuffixRollQuery const& query, int32 level, uint64* matches)
+{
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const ones = _mm256_set1_epi32(-1);
+    __m256i const qLevel = _mm256_set1_epi32(level);
+    __m256i const qItemClass = _mm256_set1_epi32(int32(query.ItemClass));
+    __m256i const qSubClassMask = _mm256_set1_epi32(int32(query.SubClassMask));
+    __m256i const qQuality = _mm256_set1_epi32(int32(query.EnchantQuality));
+    __m256i const qAttrMask = _mm256_set1_epi32(int32(query.AttrMask));
+    __m256i const qEnchCatMask = _mm256_set1_epi32(int32(query.EnchCatMask));
+    for (size_t b = 0; b < blockCount; ++b)
+    {
+        SuffixColumnBlock const& block = blocks[b];
+        uint64 bits = 0;
+        for (uint32 i = 0; i < SUFFIX_COLUMN_BLOCK_ROWS; i += 8)
+        {
+            __m256i quality = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.EnchantQuality + i));
+            __m256i itemClass = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.ItemClass + i));
+            __m256i anyItemClass = _mm256_cmpeq_epi32(itemClass, zero);
+            __m256i sameItemClass = _mm256_cmpeq_epi32(itemClass, qItemClass);
+            __m256i ok = _mm256_and_si256(_mm256_cmpeq_epi32(quality, qQuality), _mm256_or_si256(anyItemClass, sameItemClass));
+            if (_mm256_testz_si256(ok, ok))
+            {
+                continue;
+            }
+            __m256i minLevel = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.MinLevel + i));
+            __m256i maxLevel = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.MaxLevel + i));
+            __m256i subClassMask = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.ItemSubClassMask + i));
+            __m256i attrMask = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.AttributeMask + i));
+            __m256i enchCatMask = _mm256_load_si256(reinterpret_cast<__m256i const*>(block.EnchantCategoryMask + i));
+
+            __m256i levelOut = _mm256_or_si256(_mm256_cmpgt_epi32(minLevel, qLevel), _mm256_cmpgt_epi32(qLevel, maxLevel));
+            __m256i levelAny = _mm256_and_si256(_mm256_cmpeq_epi32(minLevel, zero), _mm256_cmpeq_epi32(maxLevel, zero));
+            __m256i levelOk = _mm256_or_si256(_mm256_xor_si256(levelOut, ones), levelAny);
+
+            __m256i subClassOk = _mm256_or_si256(_mm256_cmpeq_epi32(subClassMask, zero),
+                _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_and_si256(subClassMask, qSubClassMask), zero), ones));
+            __m256i itemOk = _mm256_or_si256(anyItemClass, _mm256_and_si256(sameItemClass, subClassOk));
+
+            __m256i attrHit = _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_and_si256(attrMask, qAttrMask), zero), ones);
+            __m256i attrNoExtra = _mm256_cmpeq_epi32(_mm256_andnot_si256(qAttrMask, attrMask), zero);
+            __m256i attrOk = _mm256_or_si256(_mm256_cmpeq_epi32(attrMask, zero), _mm256_and_si256(attrHit, attrNoExtra));
+
+            __m256i catOk = _mm256_or_si256(_mm256_cmpeq_epi32(enchCatMask, zero),
+                _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_and_si256(enchCatMask, qEnchCatMask), zero), ones));
+
+            ok = _mm256_and_si256(_mm256_and_si256(ok, levelOk), _mm256_and_si256(itemOk, _mm256_and_si256(attrOk, catOk)));
+            bits |= uint64(uint32(_mm256_movemask_ps(_mm256_castsi256_ps(ok)))) << i;
+        }
+        matches[b] = bits;
+    }
+}
+#endif
+
+static uint32 countBits(uint64 word)
+{
+#ifdef __GNUC__
+    return __builtin_popcountll(word);
+#else
+    uint32 count = 0;
+    for (; word; word &= word - 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+uint32 SuffixCatalogColumns::Filter(SuffixRollQuery const& query, std::vector<uint64>& matches, SuffixFilterIsa isa) const
+{
+    typedef void (*FilterFn)(SuffixColumnBlock const*, size_t, SuffixRollQuery const&, int32, uint64*);
+    FilterFn filter = filterScalar;
+#ifdef SUFFIX_FILTER_X86
+    if (isa == SUFFIX_FILTER_AVX2)
+    {
+        filter = filterAvx2;
+    }
+    else if (isa == SUFFIX_FILTER_SSE2)
+    {
+        filter = filterSse2;
+    }
+#endif
+    matches.resize(_blocks.size());
+    if (_blocks.empty())
+    {
+        return 0;
+    }
+    filter(_blocks.data(), _blocks.size(), query, clampLevel(query.Level), matches.data());
+    uint32 count = 0;
+    for (uint64 word : matches)
+    {
+        count += countBits(word);
+    }
+    // The zeroed rows past the end of the catalog would match every query of level 0 columns
+    if (uint32 lastRows = _suffixIds.size() % SUFFIX_COLUMN_BLOCK_ROWS)
+    {
+        uint64 padding = matches.back() & ~((uint64(1) << lastRows) - 1);
+        count -= countBits(padding);
+        matches.back() &= ~padding;
+    }
+    return count;
+}
+
+void SuffixCatalogColumns::GetMatchSuffixIDs(std::vector<uint64> const& matches, std::vector<uint32>& suffixIds) const
+{
+    for (size_t i = 0; i < matches.size(); ++i)
+    {
+        for (uint64 word = matches[i]; word; word &= word - 1)
+        {
+            suffixIds.push_back(_suffixIds[i * SUFFIX_COLUMN_BLOCK_ROWS + countMatchTrailingZeros(word)]);
+        }
+    }
+}
+
+void SuffixCatalogColumns::GetMatchRows(std::vector<uint64> const& matches, std::vector<uint32>& rows) const
+{
+    for (size_t i = 0; i < matches.size(); ++i)
+    {
+        for (uint64 word = matches[i]; word; word &= word - 1)
+        {
+            rows.push_back(i * SUFFIX_COLUMN_BLOCK_ROWS + countMatchTrailingZeros(word));
+        }
+    }
+}
+
+int32 ColumnarSuffixSource::PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng)
+{
+    if (!_columns.Filter(query, _matches, _isa))
+    {
+        return -1;
+    }
+    // Rows are in catalog order, so this builds the alias table CatalogSuffixSource builds and picks what it picks
+    // with the same generator
+    _rows.clear();
+    _columns.GetMatchRows(_matches, _rows);
+    buildSuffixAliasTable(_catalog, _rows, _aliasTable);
+    return pickSuffixAlias(_aliasTable.data(), _aliasTable.size(), rng);
+}
@@ -0,0 +1,96 @@
+/*
+* Column store of the suffix catalog for the in-process engine. Every block holds the columns of 64 catalog rows,
+* so the whole roll query is evaluated over 8 rows at a time with AVX2 or 4 with SSE2, and each block gives one
+* word of a match bitmap. The instruction set is picked at runtime from what the CPU supports.
+*/
+#ifndef _RANDOM_SUFFIX_COLUMNS_H_
+#define _RANDOM_SUFFIX_COLUMNS_H_
+
+#include "RandomSuffixEngine.h"
+#include <vector>
+
+#define SUFFIX_COLUMN_BLOCK_ROWS 64
+
+enum SuffixFilterIsa
+{
+    SUFFIX_FILTER_SCALAR = 0,
+    SUFFIX_FILTER_SSE2   = 1,
+    SUFFIX_FILTER_AVX2   = 2,
+    MAX_SUFFIX_FILTER_ISAS = 3,
+};
+
+// isSuffixFilterIsaSupported returns true if the build and the CPU both support the instruction set
+bool isSuffixFilterIsaSupported(SuffixFilterIsa isa);
+// getBestSuffixFilterIsa returns the widest supported instruction set
+SuffixFilterIsa getBestSuffixFilterIsa();
+char const* getSuffixFilterIsaName(SuffixFilterIsa isa);
+
+// countMatchTrailingZeros returns the index of the lowest set bit of a match bitmap word, which must not be 0
+inline uint32 countMatchTrailingZeros(uint64 word)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll(word);
+#else
+    uint32 count = 0;
+    for (; !(word & 1); word >>= 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// SuffixColumnBlock holds 64 catalog rows, the rows past the end of the catalog never match. The levels are
+// clamped into int32 so every comparison is a signed one, which SSE2 has.
+struct alignas(64) SuffixColumnBlock
+{
+    int32 MinLevel[SUFFIX_COLUMN_BLOCK_ROWS];
+    int32 MaxLevel[SUFFIX_COLUMN_BLOCK_ROWS];
+    uint32 AttributeMask[SUFFIX_COLUMN_BLOCK_ROWS];
+    uint32 ItemClass[SUFFIX_COLUMN_BLOCK_ROWS];
+    uint32 ItemSubClassMask[SUFFIX_COLUMN_BLOCK_ROWS];
+    uint32 EnchantQuality[SUFFIX_COLUMN_BLOCK_ROWS];
+    uint32 EnchantCategoryMask[SUFFIX_COLUMN_BLOCK_ROWS];
+};
+
+class SuffixCatalogColumns
+{
+public:
+    SuffixCatalogColumns() = default;
+    explicit SuffixCatalogColumns(std::vector<RandomSuffixCatalogEntry> const& catalog) { Build(catalog); }
+
+    void Build(std::vector<RandomSuffixCatalogEntry> const& catalog);
+    uint32 GetRowCount() const { return _suffixIds.size(); }
+    uint32 GetSuffixID(uint32 row) const { return _suffixIds[row]; }
+
+    // Filter sets bit (row % 64) of word (row / 64) of matches for every catalog row matching the roll query,
+    // the same rows as matchesSuffixRollQuery, and returns the number of matches. isa must be supported.
+    uint32 Filter(SuffixRollQuery const& query, std::vector<uint64>& matches, SuffixFilterIsa isa) const;
+    // GetMatchSuffixIDs appends the suffix ID of every row of the match bitmap, in catalog order
+    void GetMatchSuffixIDs(std::vector<uint64> const& matches, std::vector<uint32>& suffixIds) const;
+    // GetMatchRows appends every row of the match bitmap, in catalog order
+    void GetMatchRows(std::vector<uint64> const& matches, std::vector<uint32>& rows) const;
+
+private:
+    std::vector<SuffixColumnBlock> _blocks;
+    std::vector<uint32> _suffixIds;
+};
+
+// ColumnarSuffixSource picks the same candidates as CatalogSuffixSource, filtering the column store instead.
+// The catalog must be the one the columns were built from.
+class ColumnarSuffixSource : public CatalogSuffixSource
+{
+public:
+    ColumnarSuffixSource(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixCatalogColumns const& columns,
+        SuffixFilterIsa isa = getBestSuffixFilterIsa())
+        : CatalogSuffixSource(catalog), _columns(columns), _isa(isa) { }
+
+    int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) override;
+
+private:
+    SuffixCatalogColumns const& _columns;
+    SuffixFilterIsa _isa;
+    std::vector<uint64> _matches;
+};
+
+#endif
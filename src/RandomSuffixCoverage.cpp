@@ -0,0 +1,288 @@
+/*
+* Coverage of the suffix catalog over the item templates, see RandomSuffixCoverage.h
+*/
+#include "RandomSuffixCoverage.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <tuple>
+
+// Items a shard takes at once off the items left
+#define COVERAGE_ITEMS_PER_TAKE 64
+
+char const* getItemCoverageStatusName(ItemCoverageStatus status)
+{
+    switch (status)
+    {
+        case ITEM_COVERAGE_OK:
+            return "ok";
+        case ITEM_COVERAGE_EMPTY_SPEC_POOL:
+            return "empty_spec_pool";
+        case ITEM_COVERAGE_NO_SUFFIX_FACTOR:
+            return "no_suffix_factor";
+        case ITEM_COVERAGE_NO_CANDIDATE:
+            return "no_candidate";
+        default:
+            return "unknown";
+    }
+}
+
+typedef std::tuple<uint32, uint32, uint32> CoverageBucketKey;
+// CoverageQueryKey is the item player level, the item class and subclass, then the masks of every spec of the pool
+typedef std::vector<uint64> CoverageQueryKey;
+
+struct CoverageShard
+{
+    // Rows is the bitmap of the catalog rows some item of the shard can roll
+    std::vector<uint64> Rows;
+    std::map<CoverageBucketKey, CoverageBucket> Buckets;
+    // TierRows has the bitmap of the rows matching any spec of the pool in every tier, as many items share their
+    // level, subclass and spec pool. MaskRows has the ones matching a single spec, as many pools share their specs.
+    std::map<CoverageQueryKey, std::vector<uint64>> TierRows;
+    std::map<CoverageQueryKey, std::vector<uint64>> MaskRows;
+};
+
+// evaluateItemCoverage works out the candidates of every tier of the item, marking the rows it can roll
+static ItemCoverage evaluateItemCoverage(SimulatedItem const& item, std::vector<RandomSuffixCatalogEntry> const& catalog,
+    SuffixCatalogColumns const& columns, SuffixFilterIsa isa, CoverageShard& shard, std::vector<uint64>& matches)
+{
+    ItemCoverage coverage{item.Proto->ItemId, ITEM_COVERAGE_OK, {}};
+    std::vector<EnchantMasks> maskPool = getItemTemplateMaskPool(item.Proto, item.ItemPlayerLevel);
+    if (maskPool.empty())
+    {
+        coverage.Status = ITEM_COVERAGE_EMPTY_SPEC_POOL;
+        return coverage;
+    }
+    if (!item.SuffixFactor)
+    {
+        coverage.Status = ITEM_COVERAGE_NO_SUFFIX_FACTOR;
+        return coverage;
+    }
+    size_t words = shard.Rows.size();
+    CoverageQueryKey key{item.ItemPlayerLevel, item.Proto->Class, item.Proto->SubClass};
+    for (EnchantMasks const& masks : maskPool)
+    {
+        key.push_back((uint64(masks.attrMask) << 32) | masks.enchCatMask);
+    }
+    auto [found, inserted] = shard.TierRows.try_emplace(std::move(key));
+    std::vector<uint64>& tierRows = found->second;
+    if (inserted)
+    {
+        tierRows.assign(MAX_RAND_ENCHANT_TIERS * words, 0);
+        for (EnchantMasks const& masks : maskPool)
+        {
+            auto [maskFound, maskInserted] = shard.MaskRows.try_emplace({found->first[0], found->first[1], found->first[2],
+                (uint64(masks.attrMask) << 32) | masks.enchCatMask});
+            std::vector<uint64>& maskRows = maskFound->second;
+            if (maskInserted)
+            {
+                maskRows.reserve(MAX_RAND_ENCHANT_TIERS * words);
+                for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+                {
+                    SuffixRollQuery query{item.ItemPlayerLevel, item.Proto->Class, uint32(1) << item.Proto->SubClass, tier, masks.attrMask, masks.enchCatMask};
+                    columns.Filter(query, matches, isa);
+                    maskRows.insert(maskRows.end(), matches.begin(), matches.begin() + words);
+                }
+            }
+            for (size_t word = 0; word < tierRows.size(); ++word)
+            {
+                tierRows[word] |= maskRows[word];
+            }
+        }
+    }
+    bool anyCandidate = false;
+    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        // Same check as rollSuffix, a row whose smallest stat rounds down to nothing is never handed out
+        for (size_t word = 0; word < words; ++word)
+        {
+            for (uint64 bits = tierRows[tier * words + word]; bits; bits &= bits - 1)
+            {
+                uint32 row = uint32(word * 64 + countMatchTrailingZeros(bits));
+                RandomSuffixCatalogEntry const& entry = catalog[row];
+                if (entry.InStore && getSuffixBasepoints(entry.MinAllocPct, item.SuffixFactor) >= 1)
+                {
+                    ++coverage.Candidates[tier];
+                    shard.Rows[word] |= uint64(1) << (row % 64);
+                }
+            }
+        }
+        anyCandidate = anyCandidate || coverage.Candidates[tier] > 0;
+    }
+    if (!anyCandidate)
+    {
+        coverage.Status = ITEM_COVERAGE_NO_CANDIDATE;
+    }
+    return coverage;
+}
+
+void analyzeSuffixCoverage(std::vector<SimulatedItem> const& items, std::vector<RandomSuffixCatalogEntry> const& catalog,
+    SuffixCatalogColumns const& columns, uint32 threads, SuffixCoverageReport& report)
+{
+    auto start = std::chrono::steady_clock::now();
+    report = SuffixCoverageReport{};
+    if (!threads)
+    {
+        threads = std::max<uint32>(1, std::thread::hardware_concurrency());
+    }
+    threads = std::max<uint32>(1, std::min<uint32>(threads, uint32((items.size() + COVERAGE_ITEMS_PER_TAKE - 1) / COVERAGE_ITEMS_PER_TAKE)));
+    size_t words = (catalog.size() + 63) / 64;
+    SuffixFilterIsa isa = getBestSuffixFilterIsa();
+
+    // Items are taken in small runs, so a shard of slow items does not hold the others up
+    std::atomic<size_t> nextItem{0};
+    std::vector<ItemCoverage> coverages(items.size());
+    std::vector<CoverageShard> shards(threads);
+    std::vector<std::thread> workers;
+    for (uint32 t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]()
+        {
+            CoverageShard& shard = shards[t];
+            shard.Rows.assign(words, 0);
+            std::vector<uint64> matches;
+            while (true)
+            {
+                size_t first = nextItem.fetch_add(COVERAGE_ITEMS_PER_TAKE, std::memory_order_relaxed);
+                if (first >= items.size())
+                {
+                    break;
+                }
+                size_t last = std::min(items.size(), first + COVERAGE_ITEMS_PER_TAKE);
+                for (size_t i = first; i < last; ++i)
+                {
+                    ItemCoverage& coverage = coverages[i];
+                    coverage = evaluateItemCoverage(items[i], catalog, columns, isa, shard, matches);
+                    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+                    {
+                        CoverageBucket& bucket = shard.Buckets[{items[i].Proto->Class, items[i].Proto->SubClass, tier}];
+                        uint32 candidates = coverage.Candidates[tier];
+                        bucket.MinCandidates = bucket.Items ? std::min(bucket.MinCandidates, candidates) : candidates;
+                        bucket.MaxCandidates = std::max(bucket.MaxCandidates, candidates);
+                        bucket.TotalCandidates += candidates;
+                        bucket.EmptyItems += candidates == 0;
+                        ++bucket.Items;
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<uint64> rows(words, 0);
+    std::map<CoverageBucketKey, CoverageBucket> buckets;
+    for (CoverageShard const& shard : shards)
+    {
+        for (size_t word = 0; word < words; ++word)
+        {
+            rows[word] |= shard.Rows[word];
+        }
+        for (auto const& [key, shardBucket] : shard.Buckets)
+        {
+            CoverageBucket& bucket = buckets[key];
+            bucket.MinCandidates = bucket.Items ? std::min(bucket.MinCandidates, shardBucket.MinCandidates) : shardBucket.MinCandidates;
+            bucket.MaxCandidates = std::max(bucket.MaxCandidates, shardBucket.MaxCandidates);
+            bucket.TotalCandidates += shardBucket.TotalCandidates;
+            bucket.EmptyItems += shardBucket.EmptyItems;
+            bucket.Items += shardBucket.Items;
+        }
+    }
+    for (auto const& [key, bucket] : buckets)
+    {
+        report.Buckets.push_back(bucket);
+        std::tie(report.Buckets.back().ItemClass, report.Buckets.back().ItemSubClass, report.Buckets.back().Tier) = key;
+    }
+
+    report.Items = items.size();
+    for (ItemCoverage const& coverage : coverages)
+    {
+        ++report.Statuses[coverage.Status];
+        if (coverage.Status != ITEM_COVERAGE_OK)
+        {
+            report.Unreachable.push_back(coverage);
+        }
+        else if (std::find(std::begin(coverage.Candidates), std::end(coverage.Candidates), 0u) != std::end(coverage.Candidates))
+        {
+            report.TierGaps.push_back(coverage);
+        }
+    }
+    auto byItemId = [](ItemCoverage const& a, ItemCoverage const& b) { return a.ItemID < b.ItemID; };
+    std::sort(report.Unreachable.begin(), report.Unreachable.end(), byItemId);
+    std::sort(report.TierGaps.begin(), report.TierGaps.end(), byItemId);
+
+    // A suffix is only unrollable if none of its rows can be rolled
+    std::map<uint32, bool> suffixes;
+    for (uint32 row = 0; row < catalog.size(); ++row)
+    {
+        if (catalog[row].Weight > 0)
+        {
+            suffixes[catalog[row].SuffixID] |= (rows[row / 64] >> (row % 64)) & 1;
+        }
+    }
+    for (auto const& [suffixId, rollable] : suffixes)
+    {
+        if (!rollable)
+        {
+            report.UnrollableSuffixes.push_back(suffixId);
+        }
+    }
+    report.Threads = threads;
+    report.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool writeSuffixCoverageReport(std::string const& path, SuffixCoverageReport const& report, std::string& error)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        error = "cannot open " + path + " for writing";
+        return false;
+    }
+    file << "# suffix coverage of " << report.Items << " items in " << report.Seconds << " s on " << report.Threads << " threads\n";
+    file << "# " << report.Unreachable.size() << " unreachable items, " << report.TierGaps.size() << " items with tier gaps, "
+        << report.UnrollableSuffixes.size() << " unrollable suffixes\n";
+    auto writeItems = [&file](char const* section, std::vector<ItemCoverage> const& coverages)
+    {
+        file << "\n[" << section << "]\nitem\tstatus";
+        for (uint32 tier = 1; tier <= MAX_RAND_ENCHANT_TIERS; ++tier)
+        {
+            file << "\ttier" << tier;
+        }
+        file << "\n";
+        for (ItemCoverage const& coverage : coverages)
+        {
+            file << coverage.ItemID << "\t" << getItemCoverageStatusName(coverage.Status);
+            for (uint32 candidates : coverage.Candidates)
+            {
+                file << "\t" << candidates;
+            }
+            file << "\n";
+        }
+    };
+    writeItems("unreachable_items", report.Unreachable);
+    writeItems("tier_gaps", report.TierGaps);
+    file << "\n[unrollable_suffixes]\nsuffix\n";
+    for (uint32 suffixId : report.UnrollableSuffixes)
+    {
+        file << suffixId << "\n";
+    }
+    file << "\n[buckets]\nclass\tsubclass\ttier\titems\tempty_items\tmin\tavg\tmax\n";
+    for (CoverageBucket const& bucket : report.Buckets)
+    {
+        file << bucket.ItemClass << "\t" << bucket.ItemSubClass << "\t" << bucket.Tier + 1 << "\t" << bucket.Items << "\t" << bucket.EmptyItems << "\t"
+            << bucket.MinCandidates << "\t" << (bucket.Items ? double(bucket.TotalCandidates) / bucket.Items : 0.0) << "\t" << bucket.MaxCandidates << "\n";
+    }
+    file.flush();
+    if (!file)
+    {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,74 @@
+/*
+* Coverage of the suffix catalog over the item templates. Every rollable item is checked against the catalog for every
+* tier and every spec of its spec pool, the specs a roll can pick for it, to find the items that can never roll a
+* suffix and the suffixes no item can ever roll. The items are sharded over threads, each one filtering the column
+* store on its own and keeping the rows matched by every level, subclass and spec it saw, as most items share them.
+*/
+#ifndef _RANDOM_SUFFIX_COVERAGE_H_
+#define _RANDOM_SUFFIX_COVERAGE_H_
+
+#include "RandomSuffixColumns.h"
+#include "RandomSuffixSimulation.h"
+#include <string>
+#include <vector>
+
+enum ItemCoverageStatus
+{
+    ITEM_COVERAGE_OK               = 0,
+    // ITEM_COVERAGE_EMPTY_SPEC_POOL items have no spec to roll for
+    ITEM_COVERAGE_EMPTY_SPEC_POOL  = 1,
+    // ITEM_COVERAGE_NO_SUFFIX_FACTOR items have a suffix factor of 0, so no suffix gives them any stats
+    ITEM_COVERAGE_NO_SUFFIX_FACTOR = 2,
+    // ITEM_COVERAGE_NO_CANDIDATE items match no catalog row giving them stats, in any tier for any spec
+    ITEM_COVERAGE_NO_CANDIDATE     = 3,
+    MAX_ITEM_COVERAGE_STATUSES     = 4,
+};
+
+char const* getItemCoverageStatusName(ItemCoverageStatus status);
+
+struct ItemCoverage
+{
+    uint32 ItemID;
+    ItemCoverageStatus Status;
+    // Candidates of every tier are the catalog rows giving the item stats for at least one spec of its pool
+    uint32 Candidates[MAX_RAND_ENCHANT_TIERS];
+};
+
+// CoverageBucket sums the candidates of the items of a subclass for a tier
+struct CoverageBucket
+{
+    uint32 ItemClass;
+    uint32 ItemSubClass;
+    uint32 Tier;
+    uint32 Items;
+    // EmptyItems have no candidate in the tier
+    uint32 EmptyItems;
+    uint32 MinCandidates;
+    uint32 MaxCandidates;
+    uint64 TotalCandidates;
+};
+
+struct SuffixCoverageReport
+{
+    uint32 Items;
+    uint32 Statuses[MAX_ITEM_COVERAGE_STATUSES];
+    // Unreachable has the items that can never roll a suffix, TierGaps the other items with a tier without any
+    // candidate, both by item ID
+    std::vector<ItemCoverage> Unreachable;
+    std::vector<ItemCoverage> TierGaps;
+    // UnrollableSuffixes has the suffix of every catalog row no item can roll, rows of weight 0 aside, by suffix ID
+    std::vector<uint32> UnrollableSuffixes;
+    // Buckets are ordered by item class, subclass and tier
+    std::vector<CoverageBucket> Buckets;
+    uint32 Threads;
+    double Seconds;
+};
+
+// analyzeSuffixCoverage evaluates the items against the catalog the columns were built from, sharded over threads,
+// 0 being one per core
+void analyzeSuffixCoverage(std::vector<SimulatedItem> const& items, std::vector<RandomSuffixCatalogEntry> const& catalog,
+    SuffixCatalogColumns const& columns, uint32 threads, SuffixCoverageReport& report);
+// writeSuffixCoverageReport writes the report as tab separated sections, returns false if the file could not be written
+bool writeSuffixCoverageReport(std::string const& path, SuffixCoverageReport const& report, std::string& error);
+
+#endif
@@ -0,0 +1,154 @@
+/*
+* RandomSuffixCoverageAnalyzer checks the suffix catalog covers the item templates, see RandomSuffixCoverageAnalyzer.h
+*/
+#include "RandomSuffixCoverageAnalyzer.h"
+#include "RandomEnchants.h"
+#include "RandomEnchantsMgr.h"
+#include "Chat.h"
+#include "ObjectAccessor.h"
+#include "ObjectMgr.h"
+#include "Player.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <functional>
+
+// Unreachable items and unrollable suffixes listed in the summary, the report file has them all
+#define MAX_COVERAGE_SUMMARY_IDS 10
+
+RandomSuffixCoverageAnalyzer* RandomSuffixCoverageAnalyzer::instance()
+{
+    static RandomSuffixCoverageAnalyzer instance;
+    return &instance;
+}
+
+RandomSuffixCoverageAnalyzer::~RandomSuffixCoverageAnalyzer()
+{
+    Stop();
+}
+
+void RandomSuffixCoverageAnalyzer::Analyze()
+{
+    if (_running.exchange(true))
+    {
+        return;
+    }
+    _requester = ObjectGuid::Empty;
+    _file = _configFile;
+    _threads = _configThreads;
+    Run();
+    Report();
+    _running = false;
+}
+
+bool RandomSuffixCoverageAnalyzer::Start(ObjectGuid requester)
+{
+    if (_running.exchange(true))
+    {
+        return false;
+    }
+    if (_runner.joinable())
+    {
+        _runner.join();
+    }
+    _requester = requester;
+    _file = _configFile;
+    _threads = _configThreads;
+    _done = false;
+    _runner = std::thread([this]()
+    {
+        Run();
+        _done = true;
+    });
+    return true;
+}
+
+void RandomSuffixCoverageAnalyzer::Update()
+{
+    if (!_done.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    _runner.join();
+    _done = false;
+    Report();
+    _running = false;
+}
+
+void RandomSuffixCoverageAnalyzer::Stop()
+{
+    if (_runner.joinable())
+    {
+        _runner.join();
+    }
+    _done = false;
+    _running = false;
+}
+
+void RandomSuffixCoverageAnalyzer::Run()
+{
+    std::vector<SimulatedItem> items;
+    for (auto const& [itemId, itemTemplate] : *sObjectMgr->GetItemTemplateStore())
+    {
+        if (isRollableItemTemplate(&itemTemplate))
+        {
+            items.push_back({&itemTemplate, getItemTemplatePlayerLevel(&itemTemplate), sRandomEnchantsMgr->GetItemSuffixFactor(itemId)});
+        }
+    }
+    analyzeSuffixCoverage(items, sRandomEnchantsMgr->GetSuffixCatalog(), sRandomEnchantsMgr->GetSuffixColumns(), _threads, _report);
+    _error.clear();
+    if (!_file.empty())
+    {
+        writeSuffixCoverageReport(_file, _report, _error);
+    }
+}
+
+void RandomSuffixCoverageAnalyzer::Report()
+{
+    Player* player = _requester.IsEmpty() ? nullptr : ObjectAccessor::FindPlayer(_requester);
+    if (!_requester.IsEmpty() && !player)
+    {
+        // Logged out meanwhile, the summary goes to the log instead
+        LOG_INFO("module", ">> RANDOM_ENCHANT: The player who started the coverage analysis logged out, reporting here");
+    }
+    std::function<void(std::string const&)> send = [player](std::string const& line)
+    {
+        if (player)
+        {
+            ChatHandler(player->GetSession()).SendSysMessage(line);
+        }
+        else
+        {
+            LOG_INFO("module", ">> RANDOM_ENCHANT: {}", line);
+        }
+    };
+
+    SuffixCoverageReport const& report = _report;
+    send(Acore::StringFormat("Suffix coverage of {} rollable items on {} threads in {:.2f} s", report.Items, report.Threads, report.Seconds));
+    send(Acore::StringFormat("Unreachable items: {} (empty spec pool: {}, no suffix factor: {}, no candidate: {}), items with a tier gap: {}",
+        report.Unreachable.size(), report.Statuses[ITEM_COVERAGE_EMPTY_SPEC_POOL], report.Statuses[ITEM_COVERAGE_NO_SUFFIX_FACTOR],
+        report.Statuses[ITEM_COVERAGE_NO_CANDIDATE], report.TierGaps.size()));
+    for (size_t i = 0; i < report.Unreachable.size() && i < MAX_COVERAGE_SUMMARY_IDS; ++i)
+    {
+        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(report.Unreachable[i].ItemID);
+        send(Acore::StringFormat("  {} {}: {}", report.Unreachable[i].ItemID, proto ? proto->Name1 : "",
+            getItemCoverageStatusName(report.Unreachable[i].Status)));
+    }
+    std::string suffixes = Acore::StringFormat("Suffixes no item can roll: {}", report.UnrollableSuffixes.size());
+    for (size_t i = 0; i < report.UnrollableSuffixes.size() && i < MAX_COVERAGE_SUMMARY_IDS; ++i)
+    {
+        suffixes += Acore::StringFormat("{} {}", i ? "," : "", report.UnrollableSuffixes[i]);
+    }
+    if (report.UnrollableSuffixes.size() > MAX_COVERAGE_SUMMARY_IDS)
+    {
+        suffixes += ", ...";
+    }
+    send(suffixes);
+    if (!_error.empty())
+    {
+        send(Acore::StringFormat("Coverage report not written: {}", _error));
+    }
+    else if (!_file.empty())
+    {
+        send(Acore::StringFormat("Coverage report with {} buckets written to {}", report.Buckets.size(), _file));
+    }
+}
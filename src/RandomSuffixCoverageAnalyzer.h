@@ -0,0 +1,64 @@
+/*
+* RandomSuffixCoverageAnalyzer checks the suffix catalog covers every rollable item template, see RandomSuffixCoverage.h.
+* .randomsuffix coverage analyzes in the background, off the map threads, and hands the summary out from the world
+* updates once it is done. RandomEnchants.Coverage.OnStartup analyzes once the suffix catalog is loaded, before the
+* world is up, so a CI run of the server can check the data.
+*/
+#ifndef _RANDOM_SUFFIX_COVERAGE_ANALYZER_H_
+#define _RANDOM_SUFFIX_COVERAGE_ANALYZER_H_
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include "RandomSuffixCoverage.h"
+#include <atomic>
+#include <string>
+#include <thread>
+
+class RandomSuffixCoverageAnalyzer
+{
+public:
+    static RandomSuffixCoverageAnalyzer* instance();
+
+    // SetConfig sets the file the full report is written to, none if empty, and the threads, 0 being one per core
+    void SetConfig(std::string const& file, uint32 threads)
+    {
+        _configFile = file;
+        _configThreads = threads;
+    }
+
+    // Analyze analyzes every rollable item template right away and logs the summary
+    void Analyze();
+    // Start analyzes in the background. The summary goes to the player of requester, or to the log for the console.
+    // Returns false if an analysis is already going.
+    bool Start(ObjectGuid requester);
+    bool IsRunning() const { return _running.load(std::memory_order_relaxed); }
+    // Update hands the summary of a finished analysis out
+    void Update();
+    // Stop waits for the analysis going
+    void Stop();
+
+private:
+    RandomSuffixCoverageAnalyzer() = default;
+    ~RandomSuffixCoverageAnalyzer();
+
+    // Run analyzes the items of the item template store and writes the report, the error is kept for Report
+    void Run();
+    void Report();
+
+    // The config is only read from the world thread, which hands a copy to every analysis
+    std::string _configFile;
+    uint32 _configThreads = 0;
+    std::atomic<bool> _running{false};
+    std::atomic<bool> _done{false};
+    // The members below belong to the runner while it runs, then to Update
+    std::string _file;
+    uint32 _threads = 0;
+    std::thread _runner;
+    ObjectGuid _requester;
+    std::string _error;
+    SuffixCoverageReport _report;
+};
+
+#define sRandomSuffixCoverageAnalyzer RandomSuffixCoverageAnalyzer::instance()
+
+#endif
@@ -0,0 +1,256 @@
+/*
+* Core types used by the random suffix roll engine.
+*
+* Inside the worldserver these come from the core headers. The offline tools under tools/ build the
+* engine with RANDOM_SUFFIX_STANDALONE instead, which mirrors the few core definitions the engine
+* needs. Values below are copied from the core headers and must be kept in sync with them.
+*/
+#ifndef _RANDOM_SUFFIX_DEFINES_H_
+#define _RANDOM_SUFFIX_DEFINES_H_
+
+#ifndef RANDOM_SUFFIX_STANDALONE
+
+#include "Define.h"
+#include "SharedDefines.h"
+#include "ItemTemplate.h"
+#include "Player.h"
+#include "Log.h"
+
+#else
+
+#include <cstdint>
+#include <string>
+
+typedef int64_t int64;
+typedef int32_t int32;
+typedef int16_t int16;
+typedef int8_t int8;
+typedef uint64_t uint64;
+typedef uint32_t uint32;
+typedef uint16_t uint16;
+typedef uint8_t uint8;
+
+// The tools report through their own output, engine logs are dropped
+template<typename... Args>
+inline void discardRandomSuffixLog(char const* /*filterType*/, Args const&... /*args*/) { }
+#define LOG_INFO(filterType__, ...) discardRandomSuffixLog(filterType__, __VA_ARGS__)
+#define LOG_ERROR(filterType__, ...) discardRandomSuffixLog(filterType__, __VA_ARGS__)
+
+#define MAX_ITEM_PROTO_STATS 10
+#define MAX_ITEM_ENCHANTMENT_EFFECTS 3
+
+enum Classes
+{
+    CLASS_NONE          = 0,
+    CLASS_WARRIOR       = 1,
+    CLASS_PALADIN       = 2,
+    CLASS_HUNTER        = 3,
+    CLASS_ROGUE         = 4,
+    CLASS_PRIEST        = 5,
+    CLASS_DEATH_KNIGHT  = 6,
+    CLASS_SHAMAN        = 7,
+    CLASS_MAGE          = 8,
+    CLASS_WARLOCK       = 9,
+    CLASS_DRUID         = 11,
+};
+
+enum TalentTree
+{
+    TALENT_TREE_WARRIOR_ARMS         = 161,
+    TALENT_TREE_WARRIOR_FURY         = 164,
+    TALENT_TREE_WARRIOR_PROTECTION   = 163,
+    TALENT_TREE_PALADIN_HOLY         = 382,
+    TALENT_TREE_PALADIN_PROTECTION   = 383,
+    TALENT_TREE_PALADIN_RETRIBUTION  = 381,
+    TALENT_TREE_HUNTER_BEAST_MASTERY = 361,
+    TALENT_TREE_HUNTER_MARKSMANSHIP  = 363,
+    TALENT_TREE_HUNTER_SURVIVAL      = 362,
+    TALENT_TREE_ROGUE_ASSASSINATION  = 182,
+    TALENT_TREE_ROGUE_COMBAT         = 181,
+    TALENT_TREE_ROGUE_SUBTLETY       = 183,
+    TALENT_TREE_PRIEST_DISCIPLINE    = 201,
+    TALENT_TREE_PRIEST_HOLY          = 202,
+    TALENT_TREE_PRIEST_SHADOW        = 203,
+    TALENT_TREE_DEATH_KNIGHT_BLOOD   = 398,
+    TALENT_TREE_DEATH_KNIGHT_FROST   = 399,
+    TALENT_TREE_DEATH_KNIGHT_UNHOLY  = 400,
+    TALENT_TREE_SHAMAN_ELEMENTAL     = 261,
+    TALENT_TREE_SHAMAN_ENHANCEMENT   = 263,
+    TALENT_TREE_SHAMAN_RESTORATION   = 262,
+    TALENT_TREE_MAGE_ARCANE          = 81,
+    TALENT_TREE_MAGE_FIRE            = 41,
+    TALENT_TREE_MAGE_FROST           = 61,
+    TALENT_TREE_WARLOCK_AFFLICTION   = 302,
+    TALENT_TREE_WARLOCK_DEMONOLOGY   = 303,
+    TALENT_TREE_WARLOCK_DESTRUCTION  = 301,
+    TALENT_TREE_DRUID_BALANCE        = 283,
+    TALENT_TREE_DRUID_FERAL_COMBAT   = 281,
+    TALENT_TREE_DRUID_RESTORATION    = 282,
+};
+
+enum ItemQualities
+{
+    ITEM_QUALITY_POOR      = 0,
+    ITEM_QUALITY_NORMAL    = 1,
+    ITEM_QUALITY_UNCOMMON  = 2,
+    ITEM_QUALITY_RARE      = 3,
+    ITEM_QUALITY_EPIC      = 4,
+    ITEM_QUALITY_LEGENDARY = 5,
+    ITEM_QUALITY_ARTIFACT  = 6,
+    ITEM_QUALITY_HEIRLOOM  = 7,
+};
+
+enum ItemModType
+{
+    ITEM_MOD_MANA                     = 0,
+    ITEM_MOD_HEALTH                   = 1,
+    ITEM_MOD_AGILITY                  = 3,
+    ITEM_MOD_STRENGTH                 = 4,
+    ITEM_MOD_INTELLECT                = 5,
+    ITEM_MOD_SPIRIT                   = 6,
+    ITEM_MOD_STAMINA                  = 7,
+    ITEM_MOD_DEFENSE_SKILL_RATING     = 12,
+    ITEM_MOD_DODGE_RATING             = 13,
+    ITEM_MOD_PARRY_RATING             = 14,
+    ITEM_MOD_BLOCK_RATING             = 15,
+    ITEM_MOD_HIT_MELEE_RATING         = 16,
+    ITEM_MOD_HIT_RANGED_RATING        = 17,
+    ITEM_MOD_HIT_SPELL_RATING         = 18,
+    ITEM_MOD_CRIT_MELEE_RATING        = 19,
+    ITEM_MOD_CRIT_RANGED_RATING       = 20,
+    ITEM_MOD_CRIT_SPELL_RATING        = 21,
+    ITEM_MOD_HIT_TAKEN_MELEE_RATING   = 22,
+    ITEM_MOD_HIT_TAKEN_RANGED_RATING  = 23,
+    ITEM_MOD_HIT_TAKEN_SPELL_RATING   = 24,
+    ITEM_MOD_CRIT_TAKEN_MELEE_RATING  = 25,
+    ITEM_MOD_CRIT_TAKEN_RANGED_RATING = 26,
+    ITEM_MOD_CRIT_TAKEN_SPELL_RATING  = 27,
+    ITEM_MOD_HASTE_MELEE_RATING       = 28,
+    ITEM_MOD_HASTE_RANGED_RATING      = 29,
+    ITEM_MOD_HASTE_SPELL_RATING       = 30,
+    ITEM_MOD_HIT_RATING               = 31,
+    ITEM_MOD_CRIT_RATING              = 32,
+    ITEM_MOD_HIT_TAKEN_RATING         = 33,
+    ITEM_MOD_CRIT_TAKEN_RATING        = 34,
+    ITEM_MOD_RESILIENCE_RATING        = 35,
+    ITEM_MOD_HASTE_RATING             = 36,
+    ITEM_MOD_EXPERTISE_RATING         = 37,
+    ITEM_MOD_ATTACK_POWER             = 38,
+    ITEM_MOD_RANGED_ATTACK_POWER      = 39,
+    ITEM_MOD_FERAL_ATTACK_POWER       = 40,
+    ITEM_MOD_SPELL_HEALING_DONE       = 41,
+    ITEM_MOD_SPELL_DAMAGE_DONE        = 42,
+    ITEM_MOD_MANA_REGENERATION        = 43,
+    ITEM_MOD_ARMOR_PENETRATION_RATING = 44,
+    ITEM_MOD_SPELL_POWER              = 45,
+    ITEM_MOD_HEALTH_REGEN             = 46,
+    ITEM_MOD_SPELL_PENETRATION        = 47,
+    ITEM_MOD_BLOCK_VALUE              = 48,
+};
+
+enum ItemClass
+{
+    ITEM_CLASS_CONSUMABLE = 0,
+    ITEM_CLASS_CONTAINER  = 1,
+    ITEM_CLASS_WEAPON     = 2,
+    ITEM_CLASS_GEM        = 3,
+    ITEM_CLASS_ARMOR      = 4,
+};
+
+enum ItemSubclassWeapon
+{
+    ITEM_SUBCLASS_WEAPON_AXE          = 0,
+    ITEM_SUBCLASS_WEAPON_AXE2         = 1,
+    ITEM_SUBCLASS_WEAPON_BOW          = 2,
+    ITEM_SUBCLASS_WEAPON_GUN          = 3,
+    ITEM_SUBCLASS_WEAPON_MACE         = 4,
+    ITEM_SUBCLASS_WEAPON_MACE2        = 5,
+    ITEM_SUBCLASS_WEAPON_POLEARM      = 6,
+    ITEM_SUBCLASS_WEAPON_SWORD        = 7,
+    ITEM_SUBCLASS_WEAPON_SWORD2       = 8,
+    ITEM_SUBCLASS_WEAPON_obsolete     = 9,
+    ITEM_SUBCLASS_WEAPON_STAFF        = 10,
+    ITEM_SUBCLASS_WEAPON_EXOTIC       = 11,
+    ITEM_SUBCLASS_WEAPON_EXOTIC2      = 12,
+    ITEM_SUBCLASS_WEAPON_FIST         = 13,
+    ITEM_SUBCLASS_WEAPON_MISC         = 14,
+    ITEM_SUBCLASS_WEAPON_DAGGER       = 15,
+    ITEM_SUBCLASS_WEAPON_THROWN       = 16,
+    ITEM_SUBCLASS_WEAPON_SPEAR        = 17,
+    ITEM_SUBCLASS_WEAPON_CROSSBOW     = 18,
+    ITEM_SUBCLASS_WEAPON_WAND         = 19,
+    ITEM_SUBCLASS_WEAPON_FISHING_POLE = 20,
+};
+
+enum ItemSubclassArmor
+{
+    ITEM_SUBCLASS_ARMOR_MISC    = 0,
+    ITEM_SUBCLASS_ARMOR_CLOTH   = 1,
+    ITEM_SUBCLASS_ARMOR_LEATHER = 2,
+    ITEM_SUBCLASS_ARMOR_MAIL    = 3,
+    ITEM_SUBCLASS_ARMOR_BUCKLER = 4,
+    ITEM_SUBCLASS_ARMOR_PLATE   = 5,
+    ITEM_SUBCLASS_ARMOR_SHIELD  = 6,
+    ITEM_SUBCLASS_ARMOR_LIBRAM  = 7,
+    ITEM_SUBCLASS_ARMOR_IDOL    = 8,
+    ITEM_SUBCLASS_ARMOR_TOTEM   = 9,
+    ITEM_SUBCLASS_ARMOR_SIGIL   = 10,
+};
+
+enum InventoryType
+{
+    INVTYPE_NON_EQUIP      = 0,
+    INVTYPE_HEAD           = 1,
+    INVTYPE_NECK           = 2,
+    INVTYPE_SHOULDERS      = 3,
+    INVTYPE_BODY           = 4,
+    INVTYPE_CHEST          = 5,
+    INVTYPE_WAIST          = 6,
+    INVTYPE_LEGS           = 7,
+    INVTYPE_FEET           = 8,
+    INVTYPE_WRISTS         = 9,
+    INVTYPE_HANDS          = 10,
+    INVTYPE_FINGER         = 11,
+    INVTYPE_TRINKET        = 12,
+    INVTYPE_WEAPON         = 13,
+    INVTYPE_SHIELD         = 14,
+    INVTYPE_RANGED         = 15,
+    INVTYPE_CLOAK          = 16,
+    INVTYPE_2HWEAPON       = 17,
+    INVTYPE_BAG            = 18,
+    INVTYPE_TABARD         = 19,
+    INVTYPE_ROBE           = 20,
+    INVTYPE_WEAPONMAINHAND = 21,
+    INVTYPE_WEAPONOFFHAND  = 22,
+    INVTYPE_HOLDABLE       = 23,
+    INVTYPE_AMMO           = 24,
+    INVTYPE_THROWN         = 25,
+    INVTYPE_RANGEDRIGHT    = 26,
+    INVTYPE_QUIVER         = 27,
+    INVTYPE_RELIC          = 28,
+};
+
+struct _ItemStat
+{
+    uint32 ItemStatType;
+    int32  ItemStatValue;
+};
+
+// ItemTemplate only holds the item_template columns the engine reads
+struct ItemTemplate
+{
+    uint32 ItemId;
+    uint32 Class;
+    uint32 SubClass;
+    std::string Name1;
+    uint32 Quality;
+    uint32 InventoryType;
+    uint32 ItemLevel;
+    uint32 RequiredLevel;
+    uint32 StatsCount;
+    _ItemStat ItemStat[MAX_ITEM_PROTO_STATS];
+};
+
+#endif
+
+#endif
@@ -0,0 +1,1508 @@
+/*
+* Random suffix roll engine, see RandomSuffixEngine.h
+*/
+#include "RandomSuffixEngine.h"
+#include "RandomSuffixProfile.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <sstream>
+
+uint32 getEnchantCategoryMask(std::vector<EnchantCategory> enchCategories)
+{
+    uint32 r = 0;
+    for (auto enchCat : enchCategories)
+    {
+        r |= 1 << enchCat;
+    }
+    return r;
+}
+
+uint32 getAttributeMask(std::vector<Attributes> attributes)
+{
+    uint32 r = 0;
+    for (auto enchCat : attributes)
+    {
+        r |= 1 << enchCat;
+    }
+    return r;
+}
+
+EnchantMasks getEnchantCategoryMaskByClassAndSpec(uint8 plrClass, uint32 plrSpec)
+{
+    std::vector<EnchantCategory> plrEnchCats;
+    std::vector<Attributes> plrAttrs;
+    switch (plrClass)
+    {
+        case CLASS_WARRIOR:
+            switch (plrSpec)
+            {
+            case TALENT_TREE_WARRIOR_ARMS:
+            case TALENT_TREE_WARRIOR_FURY:
+                plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
+                plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_DPS});
+                break;
+            case TALENT_TREE_WARRIOR_PROTECTION:
+                plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE,ATTRIBUTE_PARRY});
+                plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_TANK});
+                break;
+            }
+            break;
+        case CLASS_PALADIN:
+            switch (plrSpec)
+            {
+                case TALENT_TREE_PALADIN_HOLY:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+                    break;
+                case TALENT_TREE_PALADIN_PROTECTION:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE,ATTRIBUTE_PARRY});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_TANK});
+                    break;
+                case TALENT_TREE_PALADIN_RETRIBUTION:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_DPS});
+                    break;
+            }
+            break;
+        case CLASS_HUNTER:
+            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_RANGED_AGI});
+            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_AGILITY,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
+            switch (plrSpec)
+            {
+                case TALENT_TREE_HUNTER_BEAST_MASTERY:
+                case TALENT_TREE_HUNTER_MARKSMANSHIP:
+                case TALENT_TREE_HUNTER_SURVIVAL:
+                    break;
+            }
+            break;
+        case CLASS_ROGUE:
+            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_AGILITY,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
+            switch (plrSpec)
+            {
+                case TALENT_TREE_ROGUE_ASSASSINATION:
+                case TALENT_TREE_ROGUE_COMBAT:
+                case TALENT_TREE_ROGUE_SUBTLETY:
+                    break;
+            }
+            break;
+        case CLASS_PRIEST:
+            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_CRIT});
+            switch (plrSpec)
+            {
+                case TALENT_TREE_PRIEST_DISCIPLINE:
+                case TALENT_TREE_PRIEST_HOLY:
+                    break;
+                case TALENT_TREE_PRIEST_SHADOW:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_HIT});
+                    break;
+            }
+            break;
+        case CLASS_DEATH_KNIGHT:
+            switch (plrSpec)
+            {
+                case TALENT_TREE_DEATH_KNIGHT_BLOOD:
+                case TALENT_TREE_DEATH_KNIGHT_FROST:
+                case TALENT_TREE_DEATH_KNIGHT_UNHOLY:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE,ATTRIBUTE_PARRY});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_STR_DPS, ENCH_CAT_MELEE_STR_TANK});
+                    break;
+            }
+            break;
+        case CLASS_SHAMAN:
+            switch (plrSpec)
+            {
+                case TALENT_TREE_SHAMAN_ELEMENTAL:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+                    break;
+                case TALENT_TREE_SHAMAN_ENHANCEMENT:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STAMINA,ATTRIBUTE_STRENGTH,ATTRIBUTE_AGILITY,ATTRIBUTE_INTELLECT,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_AGI_DPS});
+                    break;
+                case TALENT_TREE_SHAMAN_RESTORATION:
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_CRIT});
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+                    break;
+            }
+            break;
+        case CLASS_MAGE:
+            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
+            switch (plrSpec)
+            {
+                case TALENT_TREE_MAGE_ARCANE:
+                case TALENT_TREE_MAGE_FIRE:
+                case TALENT_TREE_MAGE_FROST:
+                    break;
+            }
+            break;
+        case CLASS_WARLOCK:
+            plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+            plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
+            switch (plrSpec)
+            {
+                case TALENT_TREE_WARLOCK_AFFLICTION:
+                case TALENT_TREE_WARLOCK_DEMONOLOGY:
+                case TALENT_TREE_WARLOCK_DESTRUCTION:
+                    break;
+            }
+            break;
+        case CLASS_DRUID:
+            switch (plrSpec)
+            {
+                case TALENT_TREE_DRUID_BALANCE:
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT});
+                    break;
+                case TALENT_TREE_DRUID_FERAL_COMBAT:
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_MELEE_AGI_DPS, ENCH_CAT_MELEE_AGI_TANK});
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_STRENGTH,ATTRIBUTE_AGILITY,ATTRIBUTE_STAMINA,ATTRIBUTE_ATTACKPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_HIT,ATTRIBUTE_CRIT,ATTRIBUTE_EXPERTISE,ATTRIBUTE_DEFENSERATING,ATTRIBUTE_DODGE});
+                    break;
+                case TALENT_TREE_DRUID_RESTORATION:
+                    plrEnchCats.insert(plrEnchCats.end(), {ENCH_CAT_CASTER});
+                    plrAttrs.insert(plrAttrs.end(), {ATTRIBUTE_INTELLECT,ATTRIBUTE_SPIRIT,ATTRIBUTE_STAMINA,ATTRIBUTE_SPELLPOWER,ATTRIBUTE_HASTE,ATTRIBUTE_CRIT});
+                    break;
+            }
+            break;
+    }
+    return EnchantMasks{getEnchantCategoryMask(plrEnchCats), getAttributeMask(plrAttrs)};
+}
+
+std::unordered_map<uint32, uint8> specToClass = {
+    {TALENT_TREE_WARRIOR_ARMS,          CLASS_WARRIOR},
+    {TALENT_TREE_WARRIOR_FURY,          CLASS_WARRIOR},
+    {TALENT_TREE_WARRIOR_PROTECTION,    CLASS_WARRIOR},
+    {TALENT_TREE_PALADIN_HOLY,          CLASS_PALADIN},
+    {TALENT_TREE_PALADIN_PROTECTION,    CLASS_PALADIN},
+    {TALENT_TREE_PALADIN_RETRIBUTION,   CLASS_PALADIN},
+    {TALENT_TREE_HUNTER_BEAST_MASTERY,  CLASS_HUNTER},
+    {TALENT_TREE_HUNTER_MARKSMANSHIP,   CLASS_HUNTER},
+    {TALENT_TREE_HUNTER_SURVIVAL,       CLASS_HUNTER},
+    {TALENT_TREE_ROGUE_ASSASSINATION,   CLASS_ROGUE},
+    {TALENT_TREE_ROGUE_COMBAT,          CLASS_ROGUE},
+    {TALENT_TREE_ROGUE_SUBTLETY,        CLASS_ROGUE},
+    {TALENT_TREE_PRIEST_DISCIPLINE,     CLASS_PRIEST},
+    {TALENT_TREE_PRIEST_HOLY,           CLASS_PRIEST},
+    {TALENT_TREE_PRIEST_SHADOW,         CLASS_PRIEST},
+    {TALENT_TREE_DEATH_KNIGHT_BLOOD,    CLASS_DEATH_KNIGHT},
+    {TALENT_TREE_DEATH_KNIGHT_FROST,    CLASS_DEATH_KNIGHT},
+    {TALENT_TREE_DEATH_KNIGHT_UNHOLY,   CLASS_DEATH_KNIGHT},
+    {TALENT_TREE_SHAMAN_ELEMENTAL,      CLASS_SHAMAN},
+    {TALENT_TREE_SHAMAN_ENHANCEMENT,    CLASS_SHAMAN},
+    {TALENT_TREE_SHAMAN_RESTORATION,    CLASS_SHAMAN},
+    {TALENT_TREE_MAGE_ARCANE,           CLASS_MAGE},
+    {TALENT_TREE_MAGE_FIRE,             CLASS_MAGE},
+    {TALENT_TREE_MAGE_FROST,            CLASS_MAGE},
+    {TALENT_TREE_WARLOCK_AFFLICTION,    CLASS_WARLOCK},
+    {TALENT_TREE_WARLOCK_DEMONOLOGY,    CLASS_WARLOCK},
+    {TALENT_TREE_WARLOCK_DESTRUCTION,   CLASS_WARLOCK},
+    {TALENT_TREE_DRUID_BALANCE,         CLASS_DRUID},
+    {TALENT_TREE_DRUID_FERAL_COMBAT,    CLASS_DRUID},
+    {TALENT_TREE_DRUID_RESTORATION,     CLASS_DRUID},
+};
+
+std::unordered_map<uint32, std::string> specToSpecNames = {
+    {TALENT_TREE_WARRIOR_ARMS,          "WARRIOR_ARMS"},
+    {TALENT_TREE_WARRIOR_FURY,          "WARRIOR_FURY"},
+    {TALENT_TREE_WARRIOR_PROTECTION,    "WARRIOR_PROTECTION"},
+    {TALENT_TREE_PALADIN_HOLY,          "PALADIN_HOLY"},
+    {TALENT_TREE_PALADIN_PROTECTION,    "PALADIN_PROTECTION"},
+    {TALENT_TREE_PALADIN_RETRIBUTION,   "PALADIN_RETRIBUTION"},
+    {TALENT_TREE_HUNTER_BEAST_MASTERY,  "HUNTER_BEAST_MASTERY"},
+    {TALENT_TREE_HUNTER_MARKSMANSHIP,   "HUNTER_MARKSMANSHIP"},
+    {TALENT_TREE_HUNTER_SURVIVAL,       "HUNTER_SURVIVAL"},
+    {TALENT_TREE_ROGUE_ASSASSINATION,   "ROGUE_ASSASSINATION"},
+    {TALENT_TREE_ROGUE_COMBAT,          "ROGUE_COMBAT"},
+    {TALENT_TREE_ROGUE_SUBTLETY,        "ROGUE_SUBTLETY"},
+    {TALENT_TREE_PRIEST_DISCIPLINE,     "PRIEST_DISCIPLINE"},
+    {TALENT_TREE_PRIEST_HOLY,           "PRIEST_HOLY"},
+    {TALENT_TREE_PRIEST_SHADOW,         "PRIEST_SHADOW"},
+    {TALENT_TREE_DEATH_KNIGHT_BLOOD,    "DEATH_KNIGHT_BLOOD"},
+    {TALENT_TREE_DEATH_KNIGHT_FROST,    "DEATH_KNIGHT_FROST"},
+    {TALENT_TREE_DEATH_KNIGHT_UNHOLY,   "DEATH_KNIGHT_UNHOLY"},
+    {TALENT_TREE_SHAMAN_ELEMENTAL,      "SHAMAN_ELEMENTAL"},
+    {TALENT_TREE_SHAMAN_ENHANCEMENT,    "SHAMAN_ENHANCEMENT"},
+    {TALENT_TREE_SHAMAN_RESTORATION,    "SHAMAN_RESTORATION"},
+    {TALENT_TREE_MAGE_ARCANE,           "MAGE_ARCANE"},
+    {TALENT_TREE_MAGE_FIRE,             "MAGE_FIRE"},
+    {TALENT_TREE_MAGE_FROST,            "MAGE_FROST"},
+    {TALENT_TREE_WARLOCK_AFFLICTION,    "WARLOCK_AFFLICTION"},
+    {TALENT_TREE_WARLOCK_DEMONOLOGY,    "WARLOCK_DEMONOLOGY"},
+    {TALENT_TREE_WARLOCK_DESTRUCTION,   "WARLOCK_DESTRUCTION"},
+    {TALENT_TREE_DRUID_BALANCE,         "DRUID_BALANCE"},
+    {TALENT_TREE_DRUID_FERAL_COMBAT,    "DRUID_FERAL_COMBAT"},
+    {TALENT_TREE_DRUID_RESTORATION,     "DRUID_RESTORATION"},
+};
+
+typedef struct itemPotentialRoleCheck {
+    bool isRanged;
+    bool isMelee;
+    bool isPhysDPS;
+    bool isStr;
+    bool isAgi;
+    bool isTank;
+    bool isCaster;
+
+    itemPotentialRoleCheck(): isRanged(false), isMelee(false), isPhysDPS(false), isStr(false), isAgi(false), isTank(false), isCaster(false) {}
+
+} itemPotentialRoleCheck;
+
+auto getItemPotentialRoles(ItemTemplate const* proto)
+{
+    RANDOM_SUFFIX_PROFILE_ZONE("getItemPotentialRoles");
+    itemPotentialRoleCheck r;
+    // role checks
+    for (uint8 i = 0; i < MAX_ITEM_PROTO_STATS; ++i)
+    {
+        if (i >= proto->StatsCount)
+        {
+            break;
+        }
+        switch (proto->ItemStat[i].ItemStatType)
+        {
+            case ITEM_MOD_AGILITY:
+                r.isAgi = true;
+                continue;
+            case ITEM_MOD_STRENGTH:
+                r.isStr = true;
+                continue;
+            case ITEM_MOD_INTELLECT:
+            case ITEM_MOD_SPIRIT:
+                r.isCaster = true;
+                continue;
+            case ITEM_MOD_HIT_MELEE_RATING:
+            case ITEM_MOD_CRIT_MELEE_RATING:
+            case ITEM_MOD_HASTE_MELEE_RATING:
+            case ITEM_MOD_EXPERTISE_RATING:
+                r.isMelee = true;
+                continue;
+            case ITEM_MOD_HIT_RANGED_RATING:
+            case ITEM_MOD_CRIT_RANGED_RATING:
+            case ITEM_MOD_HASTE_RANGED_RATING:
+            case ITEM_MOD_RANGED_ATTACK_POWER:
+                r.isRanged = true;
+                continue;
+            case ITEM_MOD_HIT_SPELL_RATING:
+            case ITEM_MOD_SPELL_DAMAGE_DONE:
+            case ITEM_MOD_SPELL_PENETRATION:
+                r.isCaster = true;
+                continue;
+            case ITEM_MOD_CRIT_SPELL_RATING:
+            case ITEM_MOD_HASTE_SPELL_RATING:
+            case ITEM_MOD_SPELL_POWER:
+            // TODO: Check proto->HasSpellPowerStat() for spellpower
+            // TODO: Check SPELL_AURA_MOD_POWER_COST_SCHOOL for specific spell schools (e.g. shadow, holy etc)
+                r.isCaster = true;
+                continue;
+            case ITEM_MOD_SPELL_HEALING_DONE:
+            case ITEM_MOD_MANA_REGENERATION:
+                r.isCaster = true;
+                continue;
+            case ITEM_MOD_ATTACK_POWER:
+            case ITEM_MOD_ARMOR_PENETRATION_RATING:
+                r.isPhysDPS = true;
+                continue;
+            case ITEM_MOD_DEFENSE_SKILL_RATING:
+            case ITEM_MOD_DODGE_RATING:
+            case ITEM_MOD_PARRY_RATING:
+                r.isTank = true;
+                continue;
+            case ITEM_MOD_BLOCK_RATING:
+            case ITEM_MOD_BLOCK_VALUE:
+                r.isTank = true;
+                continue;
+            case ITEM_MOD_STAMINA:
+            case ITEM_MOD_HEALTH:
+            case ITEM_MOD_MANA:
+            case ITEM_MOD_HEALTH_REGEN:
+            case ITEM_MOD_HIT_RATING:
+            case ITEM_MOD_CRIT_RATING:
+            case ITEM_MOD_HASTE_RATING:
+            case ITEM_MOD_HIT_TAKEN_RATING:         // Miss Related
+            case ITEM_MOD_HIT_TAKEN_MELEE_RATING:   // Miss Related
+            case ITEM_MOD_HIT_TAKEN_RANGED_RATING:  // Miss Related
+            case ITEM_MOD_HIT_TAKEN_SPELL_RATING:   // Miss Related
+            case ITEM_MOD_CRIT_TAKEN_RATING:        // Resilience related
+            case ITEM_MOD_RESILIENCE_RATING:        // Resilience related
+            case ITEM_MOD_CRIT_TAKEN_MELEE_RATING:  // Resilience related
+            case ITEM_MOD_CRIT_TAKEN_RANGED_RATING: // Resilience related
+            case ITEM_MOD_CRIT_TAKEN_SPELL_RATING:  // Resilience related
+                continue;
+        }
+    }
+    // TODO: Get DefenseRating equip check
+    return r;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Warrior(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (itemClass == ITEM_CLASS_ARMOR && itemSubClass == ITEM_SUBCLASS_ARMOR_SHIELD) {
+        if (rc.isMelee || rc.isPhysDPS || rc.isStr || rc.isTank || forceAddAll) {
+            specPool.insert({TALENT_TREE_WARRIOR_PROTECTION});
+        }
+        return specPool;
+    }
+    if (rc.isTank) {
+        specPool.insert({TALENT_TREE_WARRIOR_PROTECTION});
+    } else if (!rc.isAgi && (rc.isMelee || rc.isPhysDPS)) {
+        specPool.insert({TALENT_TREE_WARRIOR_ARMS, TALENT_TREE_WARRIOR_FURY});
+    } else if (rc.isStr || forceAddAll) {
+        specPool.insert({TALENT_TREE_WARRIOR_PROTECTION, TALENT_TREE_WARRIOR_ARMS, TALENT_TREE_WARRIOR_FURY});
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Paladin(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (itemClass == ITEM_CLASS_ARMOR && itemSubClass == ITEM_SUBCLASS_ARMOR_SHIELD) {
+        if (rc.isMelee || rc.isPhysDPS || rc.isStr || rc.isTank) {
+            specPool.insert({TALENT_TREE_PALADIN_PROTECTION});
+        } else if (rc.isCaster) {
+            specPool.insert({TALENT_TREE_PALADIN_HOLY});
+        } else if (forceAddAll) {
+            specPool.insert({TALENT_TREE_PALADIN_HOLY, TALENT_TREE_PALADIN_PROTECTION});
+        }
+        return specPool;
+    }
+    if (itemInvType == INVTYPE_HOLDABLE) {
+        if (rc.isCaster || forceAddAll) {
+            specPool.insert({TALENT_TREE_PALADIN_HOLY});
+        }
+        return specPool;
+    }
+    if (rc.isTank) {
+        specPool.insert({TALENT_TREE_PALADIN_PROTECTION});
+    } else if (rc.isCaster) {
+        specPool.insert({TALENT_TREE_PALADIN_HOLY});
+    } else if (!rc.isAgi && (rc.isMelee || rc.isPhysDPS)) {
+        specPool.insert({TALENT_TREE_PALADIN_RETRIBUTION});
+    } else if (rc.isStr || forceAddAll) {
+        specPool.insert({TALENT_TREE_PALADIN_HOLY, TALENT_TREE_PALADIN_PROTECTION, TALENT_TREE_PALADIN_RETRIBUTION});
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Hunter(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (rc.isRanged || rc.isAgi || (!rc.isStr && rc.isPhysDPS) || forceAddAll) {
+        specPool.insert({
+            TALENT_TREE_HUNTER_BEAST_MASTERY,
+            TALENT_TREE_HUNTER_MARKSMANSHIP,
+            TALENT_TREE_HUNTER_SURVIVAL,
+        });
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Rogue(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (rc.isAgi || (!rc.isStr && (rc.isMelee || rc.isPhysDPS)) || forceAddAll) {
+        specPool.insert({
+            TALENT_TREE_ROGUE_ASSASSINATION,
+            TALENT_TREE_ROGUE_COMBAT,
+            TALENT_TREE_ROGUE_SUBTLETY,
+        });
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Priest(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (rc.isCaster || forceAddAll) {
+        specPool.insert({
+            TALENT_TREE_PRIEST_DISCIPLINE,
+            TALENT_TREE_PRIEST_HOLY,
+            TALENT_TREE_PRIEST_SHADOW,
+        });
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_DeathKnight(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (rc.isTank) {
+        specPool.insert({TALENT_TREE_DEATH_KNIGHT_BLOOD});
+    } else if (rc.isMelee || rc.isPhysDPS || rc.isStr || rc.isAgi || forceAddAll) {
+        specPool.insert({TALENT_TREE_DEATH_KNIGHT_BLOOD,TALENT_TREE_DEATH_KNIGHT_FROST,TALENT_TREE_DEATH_KNIGHT_UNHOLY});
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Shaman(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (itemClass == ITEM_CLASS_ARMOR && itemSubClass == ITEM_SUBCLASS_ARMOR_SHIELD) {
+        if (rc.isCaster || forceAddAll) {
+            specPool.insert({TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
+        }
+        return specPool;
+    }
+    if (itemInvType == INVTYPE_HOLDABLE) {
+        if (rc.isCaster || forceAddAll) {
+            specPool.insert({TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
+        }
+        return specPool;
+    }
+    if (rc.isAgi || (!rc.isStr && (rc.isMelee || rc.isPhysDPS))) {
+        specPool.insert({TALENT_TREE_SHAMAN_ENHANCEMENT});
+    } else if (rc.isCaster) {
+        specPool.insert({TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
+    } else if (forceAddAll) {
+        specPool.insert({TALENT_TREE_SHAMAN_ENHANCEMENT,TALENT_TREE_SHAMAN_ELEMENTAL,TALENT_TREE_SHAMAN_RESTORATION});
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Mage(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (rc.isCaster || forceAddAll) {
+        specPool.insert({
+            TALENT_TREE_MAGE_ARCANE,
+            TALENT_TREE_MAGE_FIRE,
+            TALENT_TREE_MAGE_FROST,
+        });
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Warlock(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (rc.isCaster || forceAddAll) {
+        specPool.insert({
+            TALENT_TREE_WARLOCK_AFFLICTION,
+            TALENT_TREE_WARLOCK_DEMONOLOGY,
+            TALENT_TREE_WARLOCK_DESTRUCTION,
+        });
+    }
+    return specPool;
+}
+
+auto itemRoleRoleCheckToClassSpecs_Druid(itemPotentialRoleCheck rc, bool forceAddAll=false, uint32 itemClass=0, uint32 itemSubClass=0, uint32 itemInvType=0) {
+    std::set<uint32> specPool;
+    if (itemInvType == INVTYPE_HOLDABLE) {
+        if (rc.isCaster || forceAddAll) {
+            specPool.insert({TALENT_TREE_DRUID_BALANCE,TALENT_TREE_DRUID_RESTORATION});
+        }
+        return specPool;
+    }
+    if (rc.isTank || rc.isAgi || (!rc.isStr && (rc.isMelee || rc.isPhysDPS))) {
+        specPool.insert({TALENT_TREE_DRUID_FERAL_COMBAT});
+    } else if (rc.isCaster) {
+        specPool.insert({TALENT_TREE_DRUID_BALANCE,TALENT_TREE_DRUID_RESTORATION});
+    } else if (forceAddAll) {
+        specPool.insert({TALENT_TREE_DRUID_BALANCE,TALENT_TREE_DRUID_FERAL_COMBAT,TALENT_TREE_DRUID_RESTORATION});
+    }
+    return specPool;
+}
+
+
+// gets the candidate spec pool for a given item template
+std::set<uint32> getItemTemplateSpecPool(ItemTemplate const* proto, uint32 itemPlayerLevel, bool debugPrint)
+{
+    RANDOM_SUFFIX_PROFILE_ZONE("getItemTemplateSpecPool");
+    auto r = getItemPotentialRoles(proto);
+    std::set<uint32> specPool;
+    auto ic = proto->Class;
+    auto isc = proto->SubClass;
+    auto ivt = proto->InventoryType;
+    // ITEM CLASS + SUB CLASS - ARMOUR
+    bool isCloth = false;
+    bool isLeather = false;
+    bool isMail = false;
+    bool isPlate = false;
+    bool isIdol = false;
+    bool isLibram = false;
+    bool isTotem = false;
+    bool isSigil = false;
+    bool isShield = false;
+    // ITEM CLASS + SUB CLASS - WEAPONS
+    bool isBow = false;
+    bool isCrossbow = false;
+    bool isGun = false;
+    bool isThrown = false;
+    bool isWand = false;
+    bool isDagger = false;
+    bool isFist = false;
+    bool isAxe = false;
+    bool isMace = false;
+    bool isSword = false;
+    bool isPolearm = false;
+    bool isStaff = false;
+    bool isAxe2 = false;
+    bool isMace2 = false;
+    bool isSword2 = false;
+    // INV TYPE FOR MISC SLOTS
+    bool isNeck = false; 
+    bool isCloak = false; 
+    bool isHoldable = false; 
+    bool isFinger = false; 
+    bool isTrinket = false; 
+    switch (ic)
+    {
+        case ITEM_CLASS_ARMOR:
+            switch (isc)
+            {
+                case ITEM_SUBCLASS_ARMOR_CLOTH:
+                    isCloth = ivt != INVTYPE_CLOAK;
+                    if (isCloth) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_ARMOR_LEATHER:
+                    isLeather = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (itemPlayerLevel > 40) {
+                        if (specPool.empty()) {
+                            // Nothing set, we include all potential leather wearing specs.
+                            specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                            specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                        }
+                        // If leather item above level 40, we can safely break away
+                        break;
+                    }
+                    // NOTE: FALLTHROUGH TO MAIL, there is a potential that isSet is not set at all
+                    //       but we try to bank on the chance that the conditionals in mail are set.
+                case ITEM_SUBCLASS_ARMOR_MAIL:
+                    // isMail gear check, but this case check can be fallenthrough from the LEATHER
+                    // in that case if isLeather is true, isMail will still be set false.
+                    isMail = !isLeather;
+                    // isEventualMailUserItem check. This checks for actual mail item is above lvl 40 or is leather below level 40.
+                    if (bool isEventualMailUserItem = !isMail || itemPlayerLevel > 40)
+                    {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                        if (specPool.empty())
+                        {
+                            if (!isMail)
+                            {
+                                // received fallthru from leather item + nothing set, we include all
+                                // potential leather wearing specs.
+                                specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                                specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                            }
+                            specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                            specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        }
+                        break;
+                    }
+                    // NOTE: fallthrough to PLATE item. there is a potential that isSet is not set at all
+                    //       but we try to bank on the chance that the conditionals in the next case section are set.
+                case ITEM_SUBCLASS_ARMOR_PLATE:
+                    // isMail gear check, but this case check can be fallenthrough from the LEATHER
+                    // in that case if isLeather is true, isMail will still be set false.
+                    isPlate = !isMail;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_ARMOR_SHIELD:
+                    isShield = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_ARMOR_IDOL:
+                    isIdol = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_ARMOR_LIBRAM:
+                    isLibram = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_ARMOR_TOTEM:
+                    isTotem = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_ARMOR_SIGIL:
+                    isSigil = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                    }
+                    break;
+            }
+            break;
+        case ITEM_CLASS_WEAPON:
+            switch (isc)
+            {
+                case ITEM_SUBCLASS_WEAPON_BOW:
+                    isBow = true;
+                    // NOTE: fallthrough to Crossbow item. there is a potential that isSet is not set at all
+                    //       all ranged item types are evaluated together
+                case ITEM_SUBCLASS_WEAPON_CROSSBOW:
+                    isCrossbow = !isBow;
+                    // NOTE: fallthrough to Gun item. there is a potential that isSet is not set at all
+                    //       all ranged item types are evaluated together
+                case ITEM_SUBCLASS_WEAPON_GUN:
+                    isGun = !isBow && !isCrossbow;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    // NOTE: fallthrough to Thrown item. there is a potential that isSet is not set at all
+                    //       all ranged item types are evaluated together
+                case ITEM_SUBCLASS_WEAPON_THROWN:
+                    isThrown = !isBow && !isCrossbow && !isGun;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_WAND:
+                    isWand = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+                    break;
+                case ITEM_SUBCLASS_WEAPON_DAGGER:
+                    isDagger = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_FIST:
+                    isFist = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_AXE:
+                    isAxe = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_MACE:
+                    isMace = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_SWORD:
+                    isSword = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_POLEARM:
+                    isPolearm = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_STAFF:
+                    isStaff = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_AXE2:
+                    isAxe2 = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_MACE2:
+                    isMace2 = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_SWORD2:
+                    isSword2 = true;
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+                    specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+                    if (specPool.empty()) {
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                        specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                    }
+                    break;
+                case ITEM_SUBCLASS_WEAPON_SPEAR:
+                case ITEM_SUBCLASS_WEAPON_obsolete:
+                case ITEM_SUBCLASS_WEAPON_EXOTIC:
+                case ITEM_SUBCLASS_WEAPON_EXOTIC2:
+                case ITEM_SUBCLASS_WEAPON_MISC:
+                case ITEM_SUBCLASS_WEAPON_FISHING_POLE:
+                    break;
+            }
+            break;
+    }
+
+    switch (ivt)
+    {
+        case INVTYPE_HOLDABLE:
+            isHoldable = true;
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+            break;
+        case INVTYPE_NECK:
+            isNeck = true;
+            // fallthru
+        case INVTYPE_CLOAK:
+            isCloak = !isNeck;
+            // fallthru
+        case INVTYPE_FINGER:
+            isFinger = !isNeck && !isCloak;
+            // fallthru
+        case INVTYPE_TRINKET:
+            isTrinket = !isFinger && !isNeck && !isCloak;
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, false, ic, isc, ivt));
+            specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, false, ic, isc, ivt));
+            if (specPool.empty()) {
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Warrior(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Paladin(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Hunter(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Rogue(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Priest(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_DeathKnight(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Shaman(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Mage(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Warlock(r, true, ic, isc, ivt));
+                specPool.merge(itemRoleRoleCheckToClassSpecs_Druid(r, true, ic, isc, ivt));
+            }
+            break;
+    }
+    if (debugPrint)
+    {
+        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT START <<<<<");
+        LOG_INFO("module", "RANDOM_ENCHANT: Getting item enchant mask, checks below:");
+        LOG_INFO("module", "       For item {}, Item ID is: {}", proto->Name1, proto->ItemId);
+        LOG_INFO("module", "       >>> Printing detected item roles/stats profile");
+        LOG_INFO("module", "                isRanged = {}", r.isRanged);
+        LOG_INFO("module", "                isMelee = {}", r.isMelee);
+        LOG_INFO("module", "                isPhysDPS = {}", r.isPhysDPS);
+        LOG_INFO("module", "                isStr = {}", r.isStr);
+        LOG_INFO("module", "                isAgi = {}", r.isAgi);
+        LOG_INFO("module", "                isTank = {}", r.isTank);
+        LOG_INFO("module", "                isCaster = {}", r.isCaster);
+        LOG_INFO("module", "       >>> Printing detected item slots");
+        LOG_INFO("module", "                isCloth = {}", isCloth);
+        LOG_INFO("module", "                isLeather = {}", isLeather);
+        LOG_INFO("module", "                isMail = {}", isMail);
+        LOG_INFO("module", "                isPlate = {}", isPlate);
+        LOG_INFO("module", "                isIdol = {}", isIdol);
+        LOG_INFO("module", "                isLibram = {}", isLibram);
+        LOG_INFO("module", "                isTotem = {}", isTotem);
+        LOG_INFO("module", "                isSigil = {}", isSigil);
+        LOG_INFO("module", "                isShield = {}", isShield);
+        LOG_INFO("module", "                isBow = {}", isBow);
+        LOG_INFO("module", "                isCrossbow = {}", isCrossbow);
+        LOG_INFO("module", "                isGun = {}", isGun);
+        LOG_INFO("module", "                isThrown = {}", isThrown);
+        LOG_INFO("module", "                isWand = {}", isWand);
+        LOG_INFO("module", "                isDagger = {}", isDagger);
+        LOG_INFO("module", "                isFist = {}", isFist);
+        LOG_INFO("module", "                isAxe = {}", isAxe);
+        LOG_INFO("module", "                isMace = {}", isMace);
+        LOG_INFO("module", "                isSword = {}", isSword);
+        LOG_INFO("module", "                isPolearm = {}", isPolearm);
+        LOG_INFO("module", "                isStaff = {}", isStaff);
+        LOG_INFO("module", "                isAxe2 = {}", isAxe2);
+        LOG_INFO("module", "                isMace2 = {}", isMace2);
+        LOG_INFO("module", "                isSword2 = {}", isSword2);
+        LOG_INFO("module", "                isNeck = {}", isNeck);
+        LOG_INFO("module", "                isCloak = {}", isCloak);
+        LOG_INFO("module", "                isHoldable = {}", isHoldable);
+        LOG_INFO("module", "                isFinger = {}", isFinger);
+        LOG_INFO("module", "                isTrinket = {}", isTrinket);
+        LOG_INFO("module", "       >>> Printing candidate specs");
+        std::ostringstream stream;
+        for (auto s : specPool) {
+            auto specName = std::to_string(s);
+            if (auto found = specToSpecNames.find(s); found != specToSpecNames.end()) {
+                specName = found->second;
+            }
+            stream << specName << ",";
+        }
+        std::string result = stream.str();
+        LOG_INFO("module", "                candidate_specs = [{}]", result);
+        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT END <<<<<");
+    }
+    return specPool;
+}
+
+// isRollableItemTemplate checks if items of this template are allowed to roll a custom suffix at all
+bool isRollableItemTemplate(ItemTemplate const* proto)
+{
+    uint32 Quality = proto->Quality;
+    uint32 Class = proto->Class;
+
+    switch (proto->InventoryType)
+    {
+        // Dont roll if its of these types (Taken from GenerateEnchSuffixFactor)
+        // Items of that type don`t have points
+        case INVTYPE_NON_EQUIP:
+        case INVTYPE_BAG:
+        case INVTYPE_TABARD:
+        case INVTYPE_AMMO:
+        case INVTYPE_QUIVER:
+        // case INVTYPE_RELIC: // core changes will allow enchants of relics as well
+            return false;
+    }
+    if (
+        (Quality > ITEM_QUALITY_LEGENDARY || Quality < ITEM_QUALITY_UNCOMMON) /* eliminates enchanting anything that isn't a recognized quality */ ||
+        (Class != ITEM_CLASS_WEAPON && Class != ITEM_CLASS_ARMOR) /* eliminates enchanting anything but weapons/armor */)
+    {
+        return false;
+    }
+    return true;
+}
+
+// canClassUseItemSubClass checks if a player of the class can ever learn to use items of the armor or weapon
+// subclass, the proficiencies every class can train in 3.3.5. Other item classes need no proficiency.
+bool canClassUseItemSubClass(uint8 plrClass, uint32 itemClass, uint32 subClass)
+{
+    if (itemClass != ITEM_CLASS_ARMOR && itemClass != ITEM_CLASS_WEAPON)
+    {
+        return true;
+    }
+    if (subClass >= 32)
+    {
+        return false;
+    }
+    uint32 armor = (1 << ITEM_SUBCLASS_ARMOR_MISC) | (1 << ITEM_SUBCLASS_ARMOR_CLOTH);
+    uint32 weapon = (1 << ITEM_SUBCLASS_WEAPON_MISC) | (1 << ITEM_SUBCLASS_WEAPON_FISHING_POLE);
+    switch (plrClass)
+    {
+        case CLASS_WARRIOR:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER) | (1 << ITEM_SUBCLASS_ARMOR_MAIL) | (1 << ITEM_SUBCLASS_ARMOR_PLATE) |
+                (1 << ITEM_SUBCLASS_ARMOR_BUCKLER) | (1 << ITEM_SUBCLASS_ARMOR_SHIELD);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_AXE2) | (1 << ITEM_SUBCLASS_WEAPON_MACE) |
+                (1 << ITEM_SUBCLASS_WEAPON_MACE2) | (1 << ITEM_SUBCLASS_WEAPON_SWORD) | (1 << ITEM_SUBCLASS_WEAPON_SWORD2) |
+                (1 << ITEM_SUBCLASS_WEAPON_POLEARM) | (1 << ITEM_SUBCLASS_WEAPON_STAFF) | (1 << ITEM_SUBCLASS_WEAPON_FIST) |
+                (1 << ITEM_SUBCLASS_WEAPON_DAGGER) | (1 << ITEM_SUBCLASS_WEAPON_BOW) | (1 << ITEM_SUBCLASS_WEAPON_GUN) |
+                (1 << ITEM_SUBCLASS_WEAPON_CROSSBOW) | (1 << ITEM_SUBCLASS_WEAPON_THROWN);
+            break;
+        case CLASS_PALADIN:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER) | (1 << ITEM_SUBCLASS_ARMOR_MAIL) | (1 << ITEM_SUBCLASS_ARMOR_PLATE) |
+                (1 << ITEM_SUBCLASS_ARMOR_BUCKLER) | (1 << ITEM_SUBCLASS_ARMOR_SHIELD) | (1 << ITEM_SUBCLASS_ARMOR_LIBRAM);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_AXE2) | (1 << ITEM_SUBCLASS_WEAPON_MACE) |
+                (1 << ITEM_SUBCLASS_WEAPON_MACE2) | (1 << ITEM_SUBCLASS_WEAPON_SWORD) | (1 << ITEM_SUBCLASS_WEAPON_SWORD2) |
+                (1 << ITEM_SUBCLASS_WEAPON_POLEARM);
+            break;
+        case CLASS_HUNTER:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER) | (1 << ITEM_SUBCLASS_ARMOR_MAIL);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_AXE2) | (1 << ITEM_SUBCLASS_WEAPON_SWORD) |
+                (1 << ITEM_SUBCLASS_WEAPON_SWORD2) | (1 << ITEM_SUBCLASS_WEAPON_POLEARM) | (1 << ITEM_SUBCLASS_WEAPON_STAFF) |
+                (1 << ITEM_SUBCLASS_WEAPON_FIST) | (1 << ITEM_SUBCLASS_WEAPON_DAGGER) | (1 << ITEM_SUBCLASS_WEAPON_BOW) |
+                (1 << ITEM_SUBCLASS_WEAPON_GUN) | (1 << ITEM_SUBCLASS_WEAPON_CROSSBOW) | (1 << ITEM_SUBCLASS_WEAPON_THROWN);
+            break;
+        case CLASS_ROGUE:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_MACE) | (1 << ITEM_SUBCLASS_WEAPON_SWORD) |
+                (1 << ITEM_SUBCLASS_WEAPON_FIST) | (1 << ITEM_SUBCLASS_WEAPON_DAGGER) | (1 << ITEM_SUBCLASS_WEAPON_BOW) |
+                (1 << ITEM_SUBCLASS_WEAPON_GUN) | (1 << ITEM_SUBCLASS_WEAPON_CROSSBOW) | (1 << ITEM_SUBCLASS_WEAPON_THROWN);
+            break;
+        case CLASS_PRIEST:
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_MACE) | (1 << ITEM_SUBCLASS_WEAPON_STAFF) | (1 << ITEM_SUBCLASS_WEAPON_DAGGER) |
+                (1 << ITEM_SUBCLASS_WEAPON_WAND);
+            break;
+        case CLASS_DEATH_KNIGHT:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER) | (1 << ITEM_SUBCLASS_ARMOR_MAIL) | (1 << ITEM_SUBCLASS_ARMOR_PLATE) |
+                (1 << ITEM_SUBCLASS_ARMOR_SIGIL);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_AXE2) | (1 << ITEM_SUBCLASS_WEAPON_MACE) |
+                (1 << ITEM_SUBCLASS_WEAPON_MACE2) | (1 << ITEM_SUBCLASS_WEAPON_SWORD) | (1 << ITEM_SUBCLASS_WEAPON_SWORD2) |
+                (1 << ITEM_SUBCLASS_WEAPON_POLEARM);
+            break;
+        case CLASS_SHAMAN:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER) | (1 << ITEM_SUBCLASS_ARMOR_MAIL) | (1 << ITEM_SUBCLASS_ARMOR_BUCKLER) |
+                (1 << ITEM_SUBCLASS_ARMOR_SHIELD) | (1 << ITEM_SUBCLASS_ARMOR_TOTEM);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_AXE2) | (1 << ITEM_SUBCLASS_WEAPON_MACE) |
+                (1 << ITEM_SUBCLASS_WEAPON_MACE2) | (1 << ITEM_SUBCLASS_WEAPON_STAFF) | (1 << ITEM_SUBCLASS_WEAPON_FIST) |
+                (1 << ITEM_SUBCLASS_WEAPON_DAGGER);
+            break;
+        case CLASS_MAGE:
+        case CLASS_WARLOCK:
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_SWORD) | (1 << ITEM_SUBCLASS_WEAPON_STAFF) | (1 << ITEM_SUBCLASS_WEAPON_DAGGER) |
+                (1 << ITEM_SUBCLASS_WEAPON_WAND);
+            break;
+        case CLASS_DRUID:
+            armor |= (1 << ITEM_SUBCLASS_ARMOR_LEATHER) | (1 << ITEM_SUBCLASS_ARMOR_IDOL);
+            weapon |= (1 << ITEM_SUBCLASS_WEAPON_MACE) | (1 << ITEM_SUBCLASS_WEAPON_MACE2) | (1 << ITEM_SUBCLASS_WEAPON_POLEARM) |
+                (1 << ITEM_SUBCLASS_WEAPON_STAFF) | (1 << ITEM_SUBCLASS_WEAPON_FIST) | (1 << ITEM_SUBCLASS_WEAPON_DAGGER);
+            break;
+        default:
+            return false;
+    }
+    return ((itemClass == ITEM_CLASS_ARMOR ? armor : weapon) & (uint32(1) << subClass)) != 0;
+}
+
+// matchesSuffixItem has the level and item class conditions of the roll query
+bool matchesSuffixItem(RandomSuffixCatalogEntry const& entry, SuffixRollQuery const& query)
+{
+    if (!((entry.MinLevel <= query.Level && query.Level <= entry.MaxLevel) || (entry.MinLevel == 0 && entry.MaxLevel == 0)))
+    {
+        return false;
+    }
+    return entry.ItemClass == 0 ||
+        (entry.ItemClass == query.ItemClass && entry.ItemSubClassMask == 0) ||
+        (entry.ItemClass == query.ItemClass && (entry.ItemSubClassMask & query.SubClassMask) > 0);
+}
+
+// matchesSuffixMasks has the attribute and enchant category conditions of the roll query
+bool matchesSuffixMasks(RandomSuffixCatalogEntry const& entry, SuffixRollQuery const& query)
+{
+    if (!(entry.AttributeMask == 0 || ((entry.AttributeMask & query.AttrMask) > 0 && (entry.AttributeMask & ~query.AttrMask) == 0)))
+    {
+        return false;
+    }
+    return entry.EnchantCategoryMask == 0 || (entry.EnchantCategoryMask & query.EnchCatMask) > 0;
+}
+
+bool matchesSuffixRollQuery(RandomSuffixCatalogEntry const& entry, SuffixRollQuery const& query)
+{
+    return entry.Weight > 0 && matchesSuffixItem(entry, query) && entry.EnchantQuality == query.EnchantQuality && matchesSuffixMasks(entry, query);
+}
+
+void getSuffixCandidates(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixRollQuery const& query, std::vector<uint32>& candidates)
+{
+    candidates.clear();
+    for (RandomSuffixCatalogEntry const& entry : catalog)
+    {
+        if (matchesSuffixRollQuery(entry, query))
+        {
+            candidates.push_back(entry.SuffixID);
+        }
+    }
+}
+
+void getSuffixCandidateRows(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixRollQuery const& query, std::vector<uint32>& rows)
+{
+    rows.clear();
+    for (uint32 i = 0; i < catalog.size(); ++i)
+    {
+        if (matchesSuffixRollQuery(catalog[i], query))
+        {
+            rows.push_back(i);
+        }
+    }
+}
+
+int32 getSuffixBasepoints(uint32 minAllocPct, uint32 suffFactor)
+{
+    return int32(minAllocPct * suffFactor / 10000);
+}
+
+double rollChance(SuffixRollRng& rng)
+{
+    return double(rng()) * 100.0 / 4294967296.0;
+}
+
+void buildSuffixAliasTable(std::vector<RandomSuffixCatalogEntry> const& catalog, std::vector<uint32> const& rows, std::vector<SuffixAliasSlot>& table)
+{
+    table.resize(rows.size());
+    if (rows.empty())
+    {
+        return;
+    }
+    // Vose's method in integers: every row has weight * rows out of a total of the weight sum per slot, rows under
+    // the total are topped up by a row over it. Being exact, the table only depends on the rows and their order.
+    uint64 total = 0;
+    for (uint32 row : rows)
+    {
+        total += catalog[row].Weight;
+    }
+    std::vector<uint64> scaled(rows.size());
+    std::vector<uint32> small;
+    std::vector<uint32> large;
+    for (uint32 i = 0; i < rows.size(); ++i)
+    {
+        scaled[i] = uint64(catalog[rows[i]].Weight) * rows.size();
+        table[i] = {catalog[rows[i]].SuffixID, catalog[rows[i]].SuffixID, SUFFIX_ALIAS_KEEP};
+        (scaled[i] < total ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty())
+    {
+        uint32 less = small.back();
+        uint32 more = large.back();
+        small.pop_back();
+        table[less].Alias = table[more].SuffixID;
+        table[less].Threshold = uint32(std::min(double(scaled[less]) / double(total) * 4294967296.0, double(SUFFIX_ALIAS_KEEP - 1)));
+        scaled[more] -= total - scaled[less];
+        if (scaled[more] < total)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+}
+
+int32 CatalogSuffixSource::PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng)
+{
+    getSuffixCandidateRows(_catalog, query, _rows);
+    if (_rows.empty())
+    {
+        return -1;
+    }
+    buildSuffixAliasTable(_catalog, _rows, _aliasTable);
+    return pickSuffixAlias(_aliasTable.data(), _aliasTable.size(), rng);
+}
+
+int32 MemoizedCatalogSuffixSource::PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng)
+{
+    QueryKey key{query.Level, query.ItemClass, query.SubClassMask, query.EnchantQuality, query.AttrMask, query.EnchCatMask};
+    auto found = _queryCandidates.find(key);
+    if (found == _queryCandidates.end())
+    {
+        found = _queryCandidates.emplace(key, std::vector<SuffixAliasSlot>()).first;
+        getSuffixCandidateRows(_catalog, query, _rows);
+        buildSuffixAliasTable(_catalog, _rows, found->second);
+    }
+    if (found->second.empty())
+    {
+        return -1;
+    }
+    return pickSuffixAlias(found->second.data(), found->second.size(), rng);
+}
+
+bool CatalogSuffixSource::GetMinAllocPct(uint32 suffixId, uint32& minAllocPct)
+{
+    auto found = std::lower_bound(_catalog.begin(), _catalog.end(), suffixId, [](RandomSuffixCatalogEntry const& entry, uint32 id) {
+        return entry.SuffixID < id;
+    });
+    if (found == _catalog.end() || found->SuffixID != suffixId || !found->InStore)
+    {
+        return false;
+    }
+    minAllocPct = found->MinAllocPct;
+    return true;
+}
+
+void buildSuffixTierChances(SuffixRollSettings& settings)
+{
+    // Each tier is reached by passing its roll and every roll before it, and kept by failing the next one
+    double reachChance = 1.0;
+    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        reachChance *= std::min(std::max(settings.EnchantPcts[tier] / 100.0, 0.0), 1.0);
+        settings.TierReachChances[tier] = reachChance;
+    }
+    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        double nextReachChance = tier + 1 < MAX_RAND_ENCHANT_TIERS ? settings.TierReachChances[tier + 1] : 0.0;
+        settings.TierChances[tier] = settings.TierReachChances[tier] - nextReachChance;
+    }
+}
+
+int getRolledEnchantLevel(double const (&tierReachChances)[MAX_RAND_ENCHANT_TIERS], SuffixRollRng& rng)
+{
+    // A single draw against the chances of getting to each tier, they only go down from one tier to the next
+    double roll = rollChance(rng) / 100.0;
+    int currentTier = -1;
+    while (currentTier + 1 < MAX_RAND_ENCHANT_TIERS && roll < tierReachChances[currentTier + 1])
+    {
+        currentTier++;
+    }
+    return currentTier;
+}
+
+// getItemTemplateEnchantMasks picks a random spec out of the item's spec pool and returns its masks
+bool getItemTemplateEnchantMasks(ItemTemplate const* proto, uint32 itemPlayerLevel, SuffixRollRng& rng, SuffixRollSettings const& settings, EnchantMasks& masks)
+{
+    RANDOM_SUFFIX_PROFILE_ZONE("getItemTemplateEnchantMasks");
+    std::set<uint32> specPool = getItemTemplateSpecPool(proto, itemPlayerLevel, settings.Debug);
+    if (specPool.empty()) {
+        if (!settings.Quiet)
+        {
+            LOG_ERROR("module", "RANDOM_ENCHANT: ERROR Spec pool is empty somehow");
+        }
+        return false;
+    }
+    auto chosenSpec = *std::next(specPool.begin(), rng() % specPool.size());
+    uint8 plrClass = 0;
+    uint32 plrSpec = 0;
+    bool isFound = false;
+    if (auto found = specToClass.find(chosenSpec); found != specToClass.end()) {
+        isFound = true;
+        plrClass = found->second;
+        plrSpec = found->first;
+    }
+    if (!isFound) {
+        // should not be the case
+        LOG_ERROR("module", "RANDOM_ENCHANT: ERROR the chosen spec is not found: chosen spec was: {}", chosenSpec);
+        return false;
+    }
+    masks = getEnchantCategoryMaskByClassAndSpec(plrClass, plrSpec);
+    if (settings.Debug)
+    {
+        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT CHOSEN ITEM SPEC START <<<<<");
+        LOG_INFO("module", "RANDOM_ENCHANT: CHOSEN SPEC: {}; PLAYER CLASS: {}", plrSpec, plrClass);
+        LOG_INFO("module", "                enchMask: {}", masks.enchCatMask);
+        LOG_INFO("module", "                attrMask: {}", masks.attrMask);
+        LOG_INFO("module", ">>>>> RANDOM_ENCHANT DEBUG PRINT CHOSEN ITEM SPEC END <<<<<");
+    }
+    return true;
+}
+
+static int32 setRollResult(SuffixRollResult* result, int32 suffixID, int tier, SuffixRollStatus status)
+{
+    if (result)
+    {
+        *result = {suffixID, tier, status};
+    }
+    return suffixID;
+}
+
+int32 rollSuffix(ItemTemplate const* proto, SuffixRollContext const& ctx, SuffixRollSettings const& settings, SuffixCandidateSource& source,
+    SuffixRollResult* result)
+{
+    RANDOM_SUFFIX_PROFILE_ZONE("rollSuffix");
+    SuffixRollRng rng(ctx.Seed);
+    int rolledEnchantLevel = getRolledEnchantLevel(settings.TierReachChances, rng);
+    if (rolledEnchantLevel < 0)
+    {
+        // Failed roll
+        return setRollResult(result, -1, -1, SUFFIX_ROLL_NO_TIER);
+    }
+
+    EnchantMasks masks;
+    if (settings.RollPlayerClassPreference && ctx.PlayerCanUseItem)
+    {
+        if (settings.Debug)
+        {
+            LOG_INFO("module", "RANDOM_ENCHANT: Getting player class preference for enchant category");
+        }
+        masks = getEnchantCategoryMaskByClassAndSpec(ctx.PlayerClass, ctx.PlayerSpec);
+    }
+    else
+    {
+        if (settings.Debug)
+        {
+            LOG_INFO("module", "RANDOM_ENCHANT: Getting item enchant category");
+        }
+        if (!getItemTemplateEnchantMasks(proto, ctx.ItemPlayerLevel, rng, settings, masks))
+        {
+            return setRollResult(result, -1, rolledEnchantLevel, SUFFIX_ROLL_EMPTY_SPEC_POOL);
+        }
+    }
+
+    SuffixRollQuery query{ctx.ItemPlayerLevel, proto->Class, uint32(1) << proto->SubClass, uint32(rolledEnchantLevel), masks.attrMask, masks.enchCatMask};
+    source.OnRollQuery(proto, query);
+
+    RANDOM_SUFFIX_PROFILE_ZONE("rollSuffix query loop");
+    int maxCount = MAX_SUFFIX_ROLL_PICKS;
+    while (maxCount > 0)
+    {
+        int32 suffixID;
+        {
+            RANDOM_SUFFIX_PROFILE_ZONE("PickCandidate");
+            suffixID = source.PickCandidate(query, rng);
+        }
+        if (suffixID >= 0)
+        {
+            uint32 minAllocPct = 0;
+            if (!source.GetMinAllocPct(suffixID, minAllocPct))
+            {
+                if (!settings.Quiet)
+                {
+                    LOG_INFO("module", "Suffix ID does not exist to be enchanted, getting a new one: {}", suffixID);
+                }
+                // get suffixID failed for some reason, should not happen, we still just continue and try to get
+                // another one.
+                maxCount--;
+                continue;
+            }
+            if (settings.Debug)
+            {
+                LOG_INFO("module", "RANDOM_ENCHANT: Suffix factor for item {}, Item ID is: {} is {}", proto->Name1, proto->ItemId, ctx.SuffixFactor);
+            }
+            int32 basepoints = getSuffixBasepoints(minAllocPct, ctx.SuffixFactor);
+            if (basepoints < 1)
+            {
+                // Suffix points should ideally be above 1 after suffix factor calculations
+                // This is so that when presented on the client we dont get some weird looking values
+                if (!settings.Quiet)
+                {
+                    LOG_INFO("module", "Suffix min alloc pct calculation is below one, getting a new one: suffID: {}, suffFactor: {}, minAllocPct: {}", suffixID, ctx.SuffixFactor, minAllocPct);
+                }
+                maxCount--;
+                continue;
+            }
+            if (settings.Debug)
+            {
+                LOG_INFO("module", "RANDOM_ENCHANT: Query with the following params:");
+                LOG_INFO("module", "                level {}, enchantQuality {}, item_class {}, subclassmask {}, enchCatMask {}, attrMask {}", query.Level, query.EnchantQuality, query.ItemClass, query.SubClassMask, query.EnchCatMask, query.AttrMask);
+                LOG_INFO("module", "                Return was: {}", suffixID);
+            }
+            return setRollResult(result, suffixID, rolledEnchantLevel, SUFFIX_ROLL_OK);
+        }
+        if (!settings.Quiet)
+        {
+            LOG_INFO("module", "RANDOM_ENCHANT: No suffixes found for this combi");
+            LOG_INFO("module", "                level {}, enchantQuality {}, item_class {}, subclassmask {}, enchCatMask {}, attrMask {}", query.Level, query.EnchantQuality, query.ItemClass, query.SubClassMask, query.EnchCatMask, query.AttrMask);
+        }
+        // get suffixID failed for some reason here too. probably no entries.
+        maxCount--;
+    }
+    if (!settings.Quiet)
+    {
+        LOG_INFO("module", "rerolled rolls a max number of times already times, but no candidate enchants, returning without a suffix");
+    }
+    return setRollResult(result, -1, rolledEnchantLevel, SUFFIX_ROLL_NO_CANDIDATE);
+}
+
+uint32 getSpecByName(std::string const& name)
+{
+    for (auto const& [spec, specName] : specToSpecNames)
+    {
+        if (specName.size() == name.size() && std::equal(specName.begin(), specName.end(), name.begin(), [](char a, char b) {
+            return std::toupper((unsigned char)a) == std::toupper((unsigned char)b);
+        }))
+        {
+            return spec;
+        }
+    }
+    return 0;
+}
+
+std::vector<EnchantMasks> getItemTemplateMaskPool(ItemTemplate const* proto, uint32 itemPlayerLevel)
+{
+    std::vector<EnchantMasks> maskPool;
+    for (uint32 spec : getItemTemplateSpecPool(proto, itemPlayerLevel))
+    {
+        if (auto found = specToClass.find(spec); found != specToClass.end())
+        {
+            maskPool.push_back(getEnchantCategoryMaskByClassAndSpec(found->second, spec));
+        }
+    }
+    return maskPool;
+}
+
+void previewSuffixRolls(ItemTemplate const* proto, uint32 itemPlayerLevel, uint32 suffFactor, std::vector<EnchantMasks> const& maskPool,
+    double const (&tierChances)[MAX_RAND_ENCHANT_TIERS], std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixRollPreview& preview)
+{
+    preview = SuffixRollPreview();
+    preview.MaskPoolSize = maskPool.size();
+    std::copy(std::begin(tierChances), std::end(tierChances), preview.TierChances);
+
+    // The level and item class conditions are the same for every tier and mask, so the catalog is narrowed down
+    // once and split by tier
+    SuffixRollQuery query{itemPlayerLevel, proto->Class, uint32(1) << proto->SubClass, 0, 0, 0};
+    std::vector<RandomSuffixCatalogEntry const*> tierEntries[MAX_RAND_ENCHANT_TIERS];
+    for (RandomSuffixCatalogEntry const& entry : catalog)
+    {
+        if (entry.Weight > 0 && entry.EnchantQuality < MAX_RAND_ENCHANT_TIERS && matchesSuffixItem(entry, query))
+        {
+            tierEntries[entry.EnchantQuality].push_back(&entry);
+        }
+    }
+    // Specs sharing their masks are counted once, weighted by how many specs have them
+    std::map<std::pair<uint32, uint32>, uint32> maskWeights;
+    for (EnchantMasks const& masks : maskPool)
+    {
+        ++maskWeights[{masks.attrMask, masks.enchCatMask}];
+    }
+
+    double noSuffixChance = 1.0;
+    std::vector<uint32> usable;
+    std::vector<double> rowChances;
+    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        noSuffixChance -= preview.TierChances[tier];
+        if (maskPool.empty())
+        {
+            // Same as an empty spec pool, the roll fails before picking anything
+            preview.TierNoSuffixChances[tier] = 1.0;
+            noSuffixChance += preview.TierChances[tier];
+            continue;
+        }
+        std::vector<RandomSuffixCatalogEntry const*> const& entries = tierEntries[tier];
+        rowChances.assign(entries.size(), 0.0);
+        for (auto const& [masks, weight] : maskWeights)
+        {
+            query.AttrMask = masks.first;
+            query.EnchCatMask = masks.second;
+            double maskChance = double(weight) / maskPool.size();
+            // Every pick is by weight over the candidate rows, picks of unusable rows are retried up to MAX_SUFFIX_ROLL_PICKS times
+            usable.clear();
+            uint64 candidateWeight = 0;
+            uint64 usableWeight = 0;
+            for (uint32 i = 0; i < entries.size(); ++i)
+            {
+                if (!matchesSuffixMasks(*entries[i], query))
+                {
+                    continue;
+                }
+                candidateWeight += entries[i]->Weight;
+                if (entries[i]->InStore && getSuffixBasepoints(entries[i]->MinAllocPct, suffFactor) >= 1)
+                {
+                    usable.push_back(i);
+                    usableWeight += entries[i]->Weight;
+                }
+            }
+            double pickChance = 0.0;
+            if (!usable.empty())
+            {
+                pickChance = 1.0 - std::pow(double(candidateWeight - usableWeight) / candidateWeight, MAX_SUFFIX_ROLL_PICKS);
+                for (uint32 i : usable)
+                {
+                    rowChances[i] += maskChance * pickChance * entries[i]->Weight / usableWeight;
+                }
+            }
+            preview.TierNoSuffixChances[tier] += maskChance * (1.0 - pickChance);
+        }
+        noSuffixChance += preview.TierChances[tier] * preview.TierNoSuffixChances[tier];
+        // The catalog is sorted by SuffixID, rows of the same suffix are next to each other
+        size_t tierStart = preview.Outcomes.size();
+        for (uint32 i = 0; i < entries.size(); ++i)
+        {
+            if (rowChances[i] <= 0.0)
+            {
+                continue;
+            }
+            if (preview.Outcomes.size() > tierStart && preview.Outcomes.back().SuffixID == entries[i]->SuffixID)
+            {
+                preview.Outcomes.back().TierChance += rowChances[i];
+                preview.Outcomes.back().Chance = preview.Outcomes.back().TierChance * preview.TierChances[tier];
+                continue;
+            }
+            preview.Outcomes.push_back({entries[i]->SuffixID, tier, rowChances[i], rowChances[i] * preview.TierChances[tier]});
+        }
+        std::stable_sort(preview.Outcomes.begin() + tierStart, preview.Outcomes.end(), [](SuffixRollOutcome const& a, SuffixRollOutcome const& b) {
+            return a.TierChance > b.TierChance;
+        });
+    }
+    preview.NoSuffixChance = std::max(noSuffixChance, 0.0);
+}
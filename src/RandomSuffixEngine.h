@@ -0,0 +1,280 @@
+/*
+* Random suffix roll engine: everything a roll depends on besides the worldserver itself.
+* Built into the module, and into the offline tools under tools/ with RANDOM_SUFFIX_STANDALONE.
+*/
+#ifndef _RANDOM_SUFFIX_ENGINE_H_
+#define _RANDOM_SUFFIX_ENGINE_H_
+
+#include "RandomSuffixDefines.h"
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#define MAX_RAND_ENCHANT_TIERS 4
+// A roll picks a candidate this many times before giving up on a suffix
+#define MAX_SUFFIX_ROLL_PICKS 50
+
+enum Attributes
+{
+    ATTRIBUTE_STRENGTH      = 0,  
+    ATTRIBUTE_AGILITY       = 1,  
+    ATTRIBUTE_INTELLECT     = 2,  
+    ATTRIBUTE_SPIRIT        = 3,  
+    ATTRIBUTE_STAMINA       = 4,  
+    ATTRIBUTE_ATTACKPOWER   = 5,  
+    ATTRIBUTE_SPELLPOWER    = 6,  
+    ATTRIBUTE_HASTE         = 7,  
+    ATTRIBUTE_HIT           = 8,  
+    ATTRIBUTE_CRIT          = 9,  
+    ATTRIBUTE_EXPERTISE     = 10,  
+    ATTRIBUTE_DEFENSERATING = 11,  
+    ATTRIBUTE_DODGE         = 12,  
+    ATTRIBUTE_PARRY         = 13,  
+};
+
+enum EnchantCategory
+{
+    ENCH_CAT_MELEE_STR_DPS  = 0,
+    ENCH_CAT_MELEE_STR_TANK = 1,
+    ENCH_CAT_MELEE_AGI_DPS  = 2,
+    ENCH_CAT_MELEE_AGI_TANK = 3,
+    ENCH_CAT_RANGED_AGI     = 4,
+    ENCH_CAT_CASTER         = 5,
+};
+
+struct EnchantMasks
+{
+    uint32 enchCatMask;
+    uint32 attrMask;
+};
+
+// specToClass maps every talent tree to the player class owning it
+extern std::unordered_map<uint32, uint8> specToClass;
+extern std::unordered_map<uint32, std::string> specToSpecNames;
+
+uint32 getEnchantCategoryMask(std::vector<EnchantCategory> enchCategories);
+uint32 getAttributeMask(std::vector<Attributes> attributes);
+EnchantMasks getEnchantCategoryMaskByClassAndSpec(uint8 plrClass, uint32 plrSpec);
+// getSpecByName returns the talent tree named as in specToSpecNames, ignoring case, or 0 if there is none
+uint32 getSpecByName(std::string const& name);
+std::set<uint32> getItemTemplateSpecPool(ItemTemplate const* proto, uint32 itemPlayerLevel, bool debugPrint = false);
+bool isRollableItemTemplate(ItemTemplate const* proto);
+// canClassUseItemSubClass checks if a player of the class can ever learn to use the armor or weapon subclass
+bool canClassUseItemSubClass(uint8 plrClass, uint32 itemClass, uint32 subClass);
+
+// RandomSuffixCatalogEntry is one row of item_enchantment_random_suffixes joined with the suffix DBC
+struct RandomSuffixCatalogEntry
+{
+    uint32 SuffixID;
+    uint32 MinLevel;
+    uint32 MaxLevel;
+    uint32 AttributeMask;
+    uint32 ItemClass;
+    uint32 ItemSubClassMask;
+    uint32 EnchantQuality;
+    uint32 EnchantCategoryMask;
+    // Weight is how likely the row is picked against the other candidates of a roll, rows of weight 0 never match
+    uint32 Weight;
+    // MinAllocPct is the smallest stat allocation of the suffix, used for the basepoints check
+    uint32 MinAllocPct;
+    // InStore is false if the suffix is missing from the suffix DBC store
+    bool InStore;
+};
+
+// SuffixRollQuery holds the inputs of one suffix roll query
+struct SuffixRollQuery
+{
+    uint32 Level;
+    uint32 ItemClass;
+    uint32 SubClassMask;
+    uint32 EnchantQuality;
+    uint32 AttrMask;
+    uint32 EnchCatMask;
+};
+
+// matchesSuffixRollQuery has the same conditions as the roll query against item_enchantment_random_suffixes
+bool matchesSuffixRollQuery(RandomSuffixCatalogEntry const& entry, SuffixRollQuery const& query);
+// getSuffixCandidates returns the IDs of every catalog row matching the query, in catalog order
+void getSuffixCandidates(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixRollQuery const& query, std::vector<uint32>& candidates);
+// getSuffixCandidateRows returns the index of every catalog row matching the query, in catalog order
+void getSuffixCandidateRows(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixRollQuery const& query, std::vector<uint32>& rows);
+// getSuffixBasepoints returns the smallest stat value the suffix gives an item with this suffix factor
+int32 getSuffixBasepoints(uint32 minAllocPct, uint32 suffFactor);
+
+// Every random decision of a roll is drawn from a generator seeded per roll, so a roll can be replayed
+typedef std::mt19937 SuffixRollRng;
+// rollChance returns a value in [0, 100)
+double rollChance(SuffixRollRng& rng);
+
+// A slot of a SUFFIX_ALIAS_KEEP threshold keeps its suffix without drawing
+#define SUFFIX_ALIAS_KEEP 0xFFFFFFFF
+
+// SuffixAliasSlot is one slot of a Walker/Vose alias table. A pick lands on a slot uniformly and keeps its suffix
+// if the next draw is below Threshold, or takes Alias otherwise.
+struct SuffixAliasSlot
+{
+    uint32 SuffixID;
+    uint32 Alias;
+    uint32 Threshold;
+};
+
+// buildSuffixAliasTable builds the alias table picking each of the catalog rows in proportion to its weight, so that
+// equal rows give the same table. The rows must have a weight above 0. If every weight is the same, every slot keeps
+// its suffix and a pick is the same as a uniform pick of the rows.
+void buildSuffixAliasTable(std::vector<RandomSuffixCatalogEntry> const& catalog, std::vector<uint32> const& rows, std::vector<SuffixAliasSlot>& table);
+
+// pickSuffixAlias picks a suffix out of an alias table, which must not be empty
+inline uint32 pickSuffixAlias(SuffixAliasSlot const* table, uint32 size, SuffixRollRng& rng)
+{
+    SuffixAliasSlot const& slot = table[rng() % size];
+    if (slot.Threshold == SUFFIX_ALIAS_KEEP || rng() < slot.Threshold)
+    {
+        return slot.SuffixID;
+    }
+    return slot.Alias;
+}
+
+enum SuffixRollSource
+{
+    ROLL_SOURCE_LOOT             = 0,
+    ROLL_SOURCE_CREATE           = 1,
+    ROLL_SOURCE_QUEST_REWARD     = 2,
+    ROLL_SOURCE_GROUP_ROLL       = 3,
+    ROLL_SOURCE_VENDOR_PURCHASE  = 4,
+    ROLL_SOURCE_REFORGE          = 5,
+    MAX_ROLL_SOURCES             = 6,
+};
+
+// SuffixRollContext is everything besides the item template that a roll depends on
+struct SuffixRollContext
+{
+    uint32 ItemPlayerLevel;
+    uint32 SuffixFactor;
+    uint8 PlayerClass;
+    uint32 PlayerSpec;
+    uint8 PlayerLevel;
+    // PlayerCanUseItem is only checked when rolling with the player class preference
+    bool PlayerCanUseItem;
+    uint8 Source;
+    uint32 Seed;
+};
+
+struct SuffixRollSettings
+{
+    double EnchantPcts[MAX_RAND_ENCHANT_TIERS];
+    // TierReachChances is the chance of a roll getting to each tier, TierChances of it ending on the tier, both worked
+    // out of EnchantPcts by buildSuffixTierChances
+    double TierReachChances[MAX_RAND_ENCHANT_TIERS];
+    double TierChances[MAX_RAND_ENCHANT_TIERS];
+    bool RollPlayerClassPreference;
+    bool Debug;
+    // Quiet keeps the failed picks and the rolls without a candidate out of the log, for dry runs of millions of rolls
+    bool Quiet;
+};
+
+// SuffixCandidateSource is where a roll picks its candidate suffixes from
+class SuffixCandidateSource
+{
+public:
+    virtual ~SuffixCandidateSource() = default;
+
+    // OnRollQuery is called once per roll, before any candidate is picked
+    virtual void OnRollQuery(ItemTemplate const* /*proto*/, SuffixRollQuery const& /*query*/) { }
+    // PickCandidate returns a random suffix matching the query, -1 if there are none
+    virtual int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) = 0;
+    // GetMinAllocPct returns false if the suffix is missing from the suffix DBC store
+    virtual bool GetMinAllocPct(uint32 suffixId, uint32& minAllocPct) = 0;
+};
+
+// CatalogSuffixSource picks candidates from a suffix catalog sorted by SuffixID, by weight through the alias table of
+// the candidate rows
+class CatalogSuffixSource : public SuffixCandidateSource
+{
+public:
+    explicit CatalogSuffixSource(std::vector<RandomSuffixCatalogEntry> const& catalog) : _catalog(catalog) { }
+
+    int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) override;
+    bool GetMinAllocPct(uint32 suffixId, uint32& minAllocPct) override;
+
+protected:
+    std::vector<RandomSuffixCatalogEntry> const& _catalog;
+    std::vector<uint32> _rows;
+    std::vector<SuffixAliasSlot> _aliasTable;
+};
+
+// MemoizedCatalogSuffixSource picks candidates the same way as CatalogSuffixSource, keeping the candidates of every
+// query it has seen so that a batch of rolls for alike items filters the catalog once per query
+class MemoizedCatalogSuffixSource : public CatalogSuffixSource
+{
+public:
+    using CatalogSuffixSource::CatalogSuffixSource;
+
+    int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) override;
+    size_t GetQueryCount() const { return _queryCandidates.size(); }
+
+private:
+    typedef std::tuple<uint32, uint32, uint32, uint32, uint32, uint32> QueryKey;
+    std::map<QueryKey, std::vector<SuffixAliasSlot>> _queryCandidates;
+};
+
+enum SuffixRollStatus
+{
+    SUFFIX_ROLL_OK               = 0,
+    // SUFFIX_ROLL_NO_TIER failed the roll of the first tier
+    SUFFIX_ROLL_NO_TIER          = 1,
+    SUFFIX_ROLL_EMPTY_SPEC_POOL  = 2,
+    // SUFFIX_ROLL_NO_CANDIDATE rolled a tier but found no usable suffix for it
+    SUFFIX_ROLL_NO_CANDIDATE     = 3,
+};
+
+// SuffixRollResult is how a roll ended, Tier is -1 without a tier
+struct SuffixRollResult
+{
+    int32 SuffixID;
+    int Tier;
+    SuffixRollStatus Status;
+};
+
+// buildSuffixTierChances works the tier chances of the settings out of their EnchantPcts
+void buildSuffixTierChances(SuffixRollSettings& settings);
+// getRolledEnchantLevel rolls the suffix tier out of the chances of getting to each tier, -1 if the roll failed
+int getRolledEnchantLevel(double const (&tierReachChances)[MAX_RAND_ENCHANT_TIERS], SuffixRollRng& rng);
+// rollSuffix runs a whole roll for an item, returning the rolled suffix ID or -1 if there is none. How the roll
+// ended is written to result if it is not null.
+int32 rollSuffix(ItemTemplate const* proto, SuffixRollContext const& ctx, SuffixRollSettings const& settings, SuffixCandidateSource& source,
+    SuffixRollResult* result = nullptr);
+
+// SuffixRollOutcome is a suffix a roll can give an item
+struct SuffixRollOutcome
+{
+    uint32 SuffixID;
+    uint32 Tier;
+    // TierChance is the chance of getting the suffix once its tier is rolled, Chance is the chance of any roll getting it
+    double TierChance;
+    double Chance;
+};
+
+// SuffixRollPreview is every outcome of rolling an item, chances are between 0 and 1
+struct SuffixRollPreview
+{
+    double TierChances[MAX_RAND_ENCHANT_TIERS];
+    // TierNoSuffixChances is the chance of a roll of the tier finding no usable candidate
+    double TierNoSuffixChances[MAX_RAND_ENCHANT_TIERS];
+    double NoSuffixChance;
+    uint32 MaskPoolSize;
+    // Outcomes are ordered by tier, then from the most to the least likely
+    std::vector<SuffixRollOutcome> Outcomes;
+};
+
+// getItemTemplateMaskPool returns the masks of every spec in the item's spec pool, in the order rollSuffix picks from
+std::vector<EnchantMasks> getItemTemplateMaskPool(ItemTemplate const* proto, uint32 itemPlayerLevel);
+// previewSuffixRolls works out the chance of every outcome of rollSuffix for an item whose masks are picked
+// uniformly out of maskPool, from the catalog and the TierChances of the roll settings instead of rolling
+void previewSuffixRolls(ItemTemplate const* proto, uint32 itemPlayerLevel, uint32 suffFactor, std::vector<EnchantMasks> const& maskPool,
+    double const (&tierChances)[MAX_RAND_ENCHANT_TIERS], std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixRollPreview& preview);
+
+#endif
@@ -0,0 +1,234 @@
+/*
+* RandomSuffixMetrics counts what the rolls hand out, see RandomSuffixMetrics.h
+*/
+#include "RandomSuffixMetrics.h"
+#include "Log.h"
+#include "RandomEnchantsMgr.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+static char const* const rollSourceNames[MAX_ROLL_SOURCES] = {
+    "loot",
+    "create",
+    "quest_reward",
+    "group_roll",
+    "vendor_purchase",
+    "reforge",
+};
+
+// increment is only called by the thread owning the counter, so it needs no read-modify-write
+static void increment(std::atomic<uint64>& counter)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+RandomSuffixMetrics* RandomSuffixMetrics::instance()
+{
+    static RandomSuffixMetrics instance;
+    return &instance;
+}
+
+void RandomSuffixMetrics::SetConfig(std::string const& path, uint32 intervalMs)
+{
+    std::lock_guard<std::mutex> guard(_configLock);
+    _path = path;
+    _intervalMs = intervalMs;
+    _sinceWriteMs = 0;
+    _enabled = !path.empty();
+}
+
+RandomSuffixMetrics::ThreadCounters& RandomSuffixMetrics::GetThreadCounters()
+{
+    thread_local ThreadCounters* counters = nullptr;
+    if (!counters)
+    {
+        // Value initialised, so every counter starts at 0
+        std::unique_ptr<ThreadCounters> threadCounters = std::make_unique<ThreadCounters>();
+        counters = threadCounters.get();
+        std::lock_guard<std::mutex> guard(_threadsLock);
+        _threads.push_back(std::move(threadCounters));
+    }
+    return *counters;
+}
+
+void RandomSuffixMetrics::RecordRoll(ItemTemplate const* proto, SuffixRollSource source, SuffixRollResult const& result)
+{
+    if (!IsEnabled() || source >= MAX_ROLL_SOURCES || proto->Class >= MAX_METRIC_ITEM_CLASSES)
+    {
+        return;
+    }
+    ThreadCounters& counters = GetThreadCounters();
+    increment(counters.Rolls[source][proto->Class][result.Tier + 1]);
+    switch (result.Status)
+    {
+        case SUFFIX_ROLL_OK:
+            if (result.SuffixID < MAX_METRIC_SUFFIX_IDS)
+            {
+                increment(counters.Suffixes[result.SuffixID]);
+            }
+            break;
+        case SUFFIX_ROLL_EMPTY_SPEC_POOL:
+            increment(counters.EmptySpecPools[source][proto->Class]);
+            break;
+        case SUFFIX_ROLL_NO_CANDIDATE:
+            increment(counters.NoCandidates[source][proto->Class][result.Tier]);
+            break;
+        default:
+            break;
+    }
+}
+
+void RandomSuffixMetrics::Update(uint32 diff)
+{
+    {
+        std::lock_guard<std::mutex> guard(_configLock);
+        if (_path.empty())
+        {
+            return;
+        }
+        _sinceWriteMs += diff;
+        if (_sinceWriteMs < _intervalMs)
+        {
+            return;
+        }
+        _sinceWriteMs = 0;
+    }
+    Write();
+}
+
+bool RandomSuffixMetrics::Write()
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> guard(_configLock);
+        path = _path;
+    }
+    if (path.empty())
+    {
+        return false;
+    }
+
+    uint64 rolls[MAX_ROLL_SOURCES][MAX_METRIC_ITEM_CLASSES][MAX_RAND_ENCHANT_TIERS + 1] = {};
+    uint64 emptySpecPools[MAX_ROLL_SOURCES][MAX_METRIC_ITEM_CLASSES] = {};
+    uint64 noCandidates[MAX_ROLL_SOURCES][MAX_METRIC_ITEM_CLASSES][MAX_RAND_ENCHANT_TIERS] = {};
+    std::vector<uint64> suffixes(MAX_METRIC_SUFFIX_IDS);
+    {
+        std::lock_guard<std::mutex> guard(_threadsLock);
+        for (std::unique_ptr<ThreadCounters> const& counters : _threads)
+        {
+            for (uint32 source = 0; source < MAX_ROLL_SOURCES; ++source)
+            {
+                for (uint32 itemClass = 0; itemClass < MAX_METRIC_ITEM_CLASSES; ++itemClass)
+                {
+                    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS + 1; ++tier)
+                    {
+                        rolls[source][itemClass][tier] += counters->Rolls[source][itemClass][tier].load(std::memory_order_relaxed);
+                    }
+                    for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+                    {
+                        noCandidates[source][itemClass][tier] += counters->NoCandidates[source][itemClass][tier].load(std::memory_order_relaxed);
+                    }
+                    emptySpecPools[source][itemClass] += counters->EmptySpecPools[source][itemClass].load(std::memory_order_relaxed);
+                }
+            }
+            for (uint32 suffixId = 0; suffixId < MAX_METRIC_SUFFIX_IDS; ++suffixId)
+            {
+                suffixes[suffixId] += counters->Suffixes[suffixId].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // The textfile collector only reads files ending in .prom, so it never sees the file half written
+    std::string tmpPath = path + ".tmp";
+    std::ofstream out(tmpPath, std::ios::trunc);
+    if (!out)
+    {
+        LOG_ERROR("module", "RANDOM_ENCHANT: Cannot open the metrics file {}", tmpPath);
+        return false;
+    }
+
+    out << "# HELP random_suffix_rolls_total Suffix rolls by hook, item class and rolled EnchantQuality, \"none\" if no tier was rolled\n";
+    out << "# TYPE random_suffix_rolls_total counter\n";
+    for (uint32 source = 0; source < MAX_ROLL_SOURCES; ++source)
+    {
+        for (uint32 itemClass = 0; itemClass < MAX_METRIC_ITEM_CLASSES; ++itemClass)
+        {
+            for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS + 1; ++tier)
+            {
+                if (uint64 count = rolls[source][itemClass][tier])
+                {
+                    out << "random_suffix_rolls_total{hook=\"" << rollSourceNames[source] << "\",item_class=\"" << itemClass
+                        << "\",enchant_quality=\"" << (tier ? std::to_string(tier - 1) : "none") << "\"} " << count << "\n";
+                }
+            }
+        }
+    }
+
+    out << "# HELP random_suffix_no_candidate_total Rolls of a tier that found no usable suffix\n";
+    out << "# TYPE random_suffix_no_candidate_total counter\n";
+    for (uint32 source = 0; source < MAX_ROLL_SOURCES; ++source)
+    {
+        for (uint32 itemClass = 0; itemClass < MAX_METRIC_ITEM_CLASSES; ++itemClass)
+        {
+            for (uint32 tier = 0; tier < MAX_RAND_ENCHANT_TIERS; ++tier)
+            {
+                if (uint64 count = noCandidates[source][itemClass][tier])
+                {
+                    out << "random_suffix_no_candidate_total{hook=\"" << rollSourceNames[source] << "\",item_class=\"" << itemClass
+                        << "\",enchant_quality=\"" << tier << "\"} " << count << "\n";
+                }
+            }
+        }
+    }
+
+    out << "# HELP random_suffix_empty_spec_pool_total Rolls of items whose spec pool was empty\n";
+    out << "# TYPE random_suffix_empty_spec_pool_total counter\n";
+    for (uint32 source = 0; source < MAX_ROLL_SOURCES; ++source)
+    {
+        for (uint32 itemClass = 0; itemClass < MAX_METRIC_ITEM_CLASSES; ++itemClass)
+        {
+            if (uint64 count = emptySpecPools[source][itemClass])
+            {
+                out << "random_suffix_empty_spec_pool_total{hook=\"" << rollSourceNames[source] << "\",item_class=\"" << itemClass
+                    << "\"} " << count << "\n";
+            }
+        }
+    }
+
+    out << "# HELP random_suffix_suffixes_total Rolls by the suffix they gave, with the item class and EnchantQuality of the suffix\n";
+    out << "# TYPE random_suffix_suffixes_total counter\n";
+    std::vector<RandomSuffixCatalogEntry> const& catalog = sRandomEnchantsMgr->GetSuffixCatalog();
+    for (uint32 suffixId = 0; suffixId < MAX_METRIC_SUFFIX_IDS; ++suffixId)
+    {
+        uint64 count = suffixes[suffixId];
+        if (!count)
+        {
+            continue;
+        }
+        out << "random_suffix_suffixes_total{suffix_id=\"" << suffixId << "\"";
+        auto entry = std::lower_bound(catalog.begin(), catalog.end(), suffixId,
+            [](RandomSuffixCatalogEntry const& e, uint32 id) { return e.SuffixID < id; });
+        if (entry != catalog.end() && entry->SuffixID == suffixId)
+        {
+            out << ",item_class=\"" << entry->ItemClass << "\",enchant_quality=\"" << entry->EnchantQuality << "\"";
+        }
+        out << "} " << count << "\n";
+    }
+
+    out.close();
+    if (!out)
+    {
+        LOG_ERROR("module", "RANDOM_ENCHANT: Cannot write the metrics file {}", tmpPath);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    // Renaming over the old file is atomic, a scrape reads either the old or the new metrics
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        LOG_ERROR("module", "RANDOM_ENCHANT: Cannot replace the metrics file {}", path);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
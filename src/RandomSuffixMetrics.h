@@ -0,0 +1,68 @@
+/*
+* RandomSuffixMetrics counts what the rolls hand out and writes the counts to a Prometheus text file, for the
+* textfile collector of node-exporter to scrape. The worldserver never listens for the scrape itself.
+*
+* Every thread rolling suffixes counts into its own fixed-size counter arrays, only that thread writes them.
+* The arrays of every thread are summed when the file is written.
+*/
+#ifndef _RANDOM_SUFFIX_METRICS_H_
+#define _RANDOM_SUFFIX_METRICS_H_
+
+#include "Define.h"
+#include "RandomSuffixEngine.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Suffix IDs are stored negated in the int16 random property of the item, so they always fit this many counters
+#define MAX_METRIC_SUFFIX_IDS 0x8000
+#define MAX_METRIC_ITEM_CLASSES 17
+
+class RandomSuffixMetrics
+{
+public:
+    static RandomSuffixMetrics* instance();
+
+    // SetConfig starts writing the metrics to path every intervalMs, an empty path stops counting
+    void SetConfig(std::string const& path, uint32 intervalMs);
+    bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    // RecordRoll counts one roll of the item from the hook source
+    void RecordRoll(ItemTemplate const* proto, SuffixRollSource source, SuffixRollResult const& result);
+
+    // Update writes the file once the interval has passed since it was last written
+    void Update(uint32 diff);
+    // Write sums the counters of every thread and replaces the file with them, returns false if it could not
+    bool Write();
+
+private:
+    RandomSuffixMetrics() = default;
+
+    // ThreadCounters are counted by their thread alone, the atomics are so the writer can read them meanwhile
+    struct ThreadCounters
+    {
+        // Tier 0 of Rolls is a failed tier roll, tier t + 1 is EnchantQuality t
+        std::atomic<uint64> Rolls[MAX_ROLL_SOURCES][MAX_METRIC_ITEM_CLASSES][MAX_RAND_ENCHANT_TIERS + 1];
+        std::atomic<uint64> EmptySpecPools[MAX_ROLL_SOURCES][MAX_METRIC_ITEM_CLASSES];
+        std::atomic<uint64> NoCandidates[MAX_ROLL_SOURCES][MAX_METRIC_ITEM_CLASSES][MAX_RAND_ENCHANT_TIERS];
+        // Indexed by suffix ID
+        std::atomic<uint64> Suffixes[MAX_METRIC_SUFFIX_IDS];
+    };
+
+    ThreadCounters& GetThreadCounters();
+
+    std::atomic<bool> _enabled{false};
+    std::mutex _configLock;
+    std::string _path;
+    uint32 _intervalMs = 0;
+    uint32 _sinceWriteMs = 0;
+
+    std::mutex _threadsLock;
+    std::vector<std::unique_ptr<ThreadCounters>> _threads;
+};
+
+#define sRandomSuffixMetrics RandomSuffixMetrics::instance()
+
+#endif
@@ -0,0 +1,246 @@
+/*
+* RandomSuffixPreroll rolls suffixes ahead of time on a worker thread, see RandomSuffixPreroll.h
+*/
+#include "RandomSuffixPreroll.h"
+#include "RandomEnchants.h"
+#include "ItemTemplate.h"
+#include <algorithm>
+#include <iterator>
+
+// Milliseconds between two passes over the pre-rolls for the expired ones
+#define PREROLL_EXPIRE_INTERVAL_MS 1000
+
+RandomSuffixPreroll* RandomSuffixPreroll::instance()
+{
+    static RandomSuffixPreroll instance;
+    return &instance;
+}
+
+RandomSuffixPreroll::~RandomSuffixPreroll()
+{
+    Stop();
+}
+
+// isSameRoll checks that a roll with b would have been the roll with a, the seed and the hook aside
+static bool isSameRoll(SuffixRollContext const& a, SuffixRollSettings const& aSettings, SuffixRollContext const& b,
+    SuffixRollSettings const& bSettings)
+{
+    return a.ItemPlayerLevel == b.ItemPlayerLevel && a.SuffixFactor == b.SuffixFactor && a.PlayerClass == b.PlayerClass &&
+        a.PlayerSpec == b.PlayerSpec && a.PlayerLevel == b.PlayerLevel && a.PlayerCanUseItem == b.PlayerCanUseItem &&
+        std::equal(std::begin(aSettings.EnchantPcts), std::end(aSettings.EnchantPcts), std::begin(bSettings.EnchantPcts)) &&
+        aSettings.RollPlayerClassPreference == bSettings.RollPlayerClassPreference;
+}
+
+void RandomSuffixPreroll::SetConfig(bool enable, uint32 maxQueue, uint32 expireMs)
+{
+    Stop();
+    std::lock_guard<std::mutex> guard(_lock);
+    _maxQueue = maxQueue;
+    _expireMs = expireMs;
+    if (!enable)
+    {
+        return;
+    }
+    _stopping = false;
+    _worker = std::thread(&RandomSuffixPreroll::Run, this);
+    _enabled = true;
+}
+
+void RandomSuffixPreroll::Stop()
+{
+    _enabled = false;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stopping = true;
+    }
+    _wake.notify_all();
+    if (_worker.joinable())
+    {
+        _worker.join();
+    }
+    std::lock_guard<std::mutex> guard(_lock);
+    Clear();
+}
+
+void RandomSuffixPreroll::Clear()
+{
+    for (auto& prerolls : _prerolls)
+    {
+        for (auto const& [owner, ownerPrerolls] : prerolls)
+        {
+            _dropped += ownerPrerolls.size();
+        }
+        prerolls.clear();
+    }
+    _jobs.clear();
+}
+
+void RandomSuffixPreroll::Run()
+{
+    std::unique_lock<std::mutex> guard(_lock);
+    while (true)
+    {
+        _wake.wait(guard, [this] { return _stopping || !_jobs.empty(); });
+        if (_stopping)
+        {
+            return;
+        }
+        PrerollJob job = _jobs.front();
+        _jobs.pop_front();
+        guard.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        SuffixRollResult result;
+        RandomEnchantsConfigPtr config = getRandomEnchantsConfig();
+        rollWorldSuffix(*config, job.Proto, job.Context, job.Settings, &result);
+        uint64 micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        uint64 avg = _avgRollMicros.load(std::memory_order_relaxed);
+        _avgRollMicros.store(avg + (int64(micros) - int64(avg)) / 16, std::memory_order_relaxed);
+
+        guard.lock();
+        // The pre-roll is gone if its loot was refilled or it expired meanwhile
+        auto found = _prerolls[job.OwnerType].find(job.Owner);
+        if (found == _prerolls[job.OwnerType].end())
+        {
+            continue;
+        }
+        for (ItemPreroll& preroll : found->second)
+        {
+            if (preroll.ID == job.ID)
+            {
+                preroll.Result = result;
+                preroll.Ready = true;
+                break;
+            }
+        }
+    }
+}
+
+void RandomSuffixPreroll::Preroll(PrerollOwner ownerType, uint64 owner, ItemTemplate const* proto, SuffixRollContext const& ctx,
+    SuffixRollSettings const& settings)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_jobs.size() >= _maxQueue)
+    {
+        ++_full;
+        return;
+    }
+    uint64 id = ++_nextID;
+    _prerolls[ownerType][owner].push_back({id, proto->ItemId, ctx, settings, {-1, -1, SUFFIX_ROLL_NO_TIER}, false, std::chrono::steady_clock::now()});
+    _jobs.push_back({ownerType, owner, id, proto, ctx, settings});
+    ++_queued;
+    _wake.notify_one();
+}
+
+bool RandomSuffixPreroll::HasPreroll(PrerollOwner ownerType, uint64 owner, uint32 itemId)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto found = _prerolls[ownerType].find(owner);
+    return found != _prerolls[ownerType].end() &&
+        std::any_of(found->second.begin(), found->second.end(), [itemId](ItemPreroll const& preroll) { return preroll.ItemID == itemId; });
+}
+
+bool RandomSuffixPreroll::Take(PrerollOwner ownerType, uint64 owner, ItemTemplate const* proto, SuffixRollSettings const& settings,
+    SuffixRollContext& ctx, SuffixRollResult& result)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(_lock);
+    auto found = _prerolls[ownerType].find(owner);
+    if (found != _prerolls[ownerType].end())
+    {
+        std::vector<ItemPreroll>& prerolls = found->second;
+        auto preroll = std::find_if(prerolls.begin(), prerolls.end(), [&](ItemPreroll const& p)
+        {
+            return p.Ready && p.ItemID == proto->ItemId && isSameRoll(p.Context, p.Settings, ctx, settings);
+        });
+        if (preroll != prerolls.end())
+        {
+            ctx.Seed = preroll->Context.Seed;
+            result = preroll->Result;
+            prerolls.erase(preroll);
+            if (prerolls.empty())
+            {
+                _prerolls[ownerType].erase(found);
+            }
+            ++_applied;
+            return true;
+        }
+    }
+    ++_missed;
+    return false;
+}
+
+void RandomSuffixPreroll::Drop(PrerollOwner ownerType, uint64 owner)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(_lock);
+    auto found = _prerolls[ownerType].find(owner);
+    if (found == _prerolls[ownerType].end())
+    {
+        return;
+    }
+    _dropped += found->second.size();
+    _prerolls[ownerType].erase(found);
+}
+
+void RandomSuffixPreroll::Update(uint32 diff)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+    _sinceExpireMs += diff;
+    if (_sinceExpireMs < PREROLL_EXPIRE_INTERVAL_MS)
+    {
+        return;
+    }
+    _sinceExpireMs = 0;
+    std::lock_guard<std::mutex> guard(_lock);
+    auto expireBefore = std::chrono::steady_clock::now() - std::chrono::milliseconds(_expireMs);
+    for (auto& prerolls : _prerolls)
+    {
+        for (auto owner = prerolls.begin(); owner != prerolls.end();)
+        {
+            std::vector<ItemPreroll>& ownerPrerolls = owner->second;
+            auto expired = std::remove_if(ownerPrerolls.begin(), ownerPrerolls.end(), [expireBefore](ItemPreroll const& preroll)
+            {
+                return preroll.Created < expireBefore;
+            });
+            _expired += ownerPrerolls.end() - expired;
+            ownerPrerolls.erase(expired, ownerPrerolls.end());
+            owner = ownerPrerolls.empty() ? prerolls.erase(owner) : std::next(owner);
+        }
+    }
+}
+
+PrerollStats RandomSuffixPreroll::GetStats() const
+{
+    PrerollStats stats{};
+    stats.Queued = _queued.load(std::memory_order_relaxed);
+    stats.Full = _full.load(std::memory_order_relaxed);
+    stats.Applied = _applied.load(std::memory_order_relaxed);
+    stats.Missed = _missed.load(std::memory_order_relaxed);
+    stats.Expired = _expired.load(std::memory_order_relaxed);
+    stats.Dropped = _dropped.load(std::memory_order_relaxed);
+    stats.AvgRollMicros = _avgRollMicros.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> guard(_lock);
+    stats.QueueDepth = _jobs.size();
+    for (auto const& prerolls : _prerolls)
+    {
+        for (auto const& [owner, ownerPrerolls] : prerolls)
+        {
+            stats.ReadyCount += std::count_if(ownerPrerolls.begin(), ownerPrerolls.end(), [](ItemPreroll const& preroll) { return preroll.Ready; });
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,130 @@
+/*
+* RandomSuffixPreroll rolls suffixes ahead of time on a worker thread. When loot is filled or a vendor list is
+* viewed, the rolls of the items that could be picked up are queued for the worker with the context of the player
+* who will most likely get them. The acquisition hooks then only apply a ready pre-roll, an item without one is
+* rolled in the hook as before.
+*
+* A pre-roll is attached to the loot or to the player viewing the vendor, and only ever handed out for the same
+* item template, roll context and roll settings it was rolled with, so it is the roll the hook would have done.
+*/
+#ifndef _RANDOM_SUFFIX_PREROLL_H_
+#define _RANDOM_SUFFIX_PREROLL_H_
+
+#include "Define.h"
+#include "RandomSuffixEngine.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+enum PrerollOwner
+{
+    // PREROLL_OWNER_LOOT pre-rolls are attached to the address of the Loot they were filled into
+    PREROLL_OWNER_LOOT   = 0,
+    // PREROLL_OWNER_VENDOR pre-rolls are attached to the raw GUID of the player who viewed the vendor
+    PREROLL_OWNER_VENDOR = 1,
+    MAX_PREROLL_OWNERS   = 2,
+};
+
+struct PrerollStats
+{
+    // Queued pre-rolls were handed to the worker, Full ones were not as its queue was full
+    uint64 Queued;
+    uint64 Full;
+    // Applied pre-rolls were taken by an acquisition hook, Missed hooks found none ready and rolled inline
+    uint64 Applied;
+    uint64 Missed;
+    // Expired pre-rolls were never taken, Dropped ones went with their loot or player
+    uint64 Expired;
+    uint64 Dropped;
+    uint64 QueueDepth;
+    uint64 ReadyCount;
+    uint64 AvgRollMicros;
+};
+
+class RandomSuffixPreroll
+{
+public:
+    static RandomSuffixPreroll* instance();
+
+    // SetConfig starts the worker when enabled and stops it otherwise, every pre-roll made so far is dropped
+    void SetConfig(bool enable, uint32 maxQueue, uint32 expireMs);
+    bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+    // Stop stops the worker, the queued pre-rolls are dropped
+    void Stop();
+
+    // Preroll queues a roll of the item attached to owner, its seed is the one the roll uses
+    void Preroll(PrerollOwner ownerType, uint64 owner, ItemTemplate const* proto, SuffixRollContext const& ctx, SuffixRollSettings const& settings);
+    // HasPreroll returns true if owner has a pre-roll of the item, ready or not
+    bool HasPreroll(PrerollOwner ownerType, uint64 owner, uint32 itemId);
+    // Take removes a ready pre-roll of the item attached to owner that was rolled with ctx and settings. ctx gets
+    // the seed of the pre-roll. Returns false, counting a miss, if there is none.
+    bool Take(PrerollOwner ownerType, uint64 owner, ItemTemplate const* proto, SuffixRollSettings const& settings, SuffixRollContext& ctx,
+        SuffixRollResult& result);
+    // Drop drops every pre-roll attached to owner
+    void Drop(PrerollOwner ownerType, uint64 owner);
+
+    // Update expires the pre-rolls nobody took in time
+    void Update(uint32 diff);
+    PrerollStats GetStats() const;
+
+private:
+    RandomSuffixPreroll() = default;
+    ~RandomSuffixPreroll();
+
+    struct ItemPreroll
+    {
+        uint64 ID;
+        uint32 ItemID;
+        SuffixRollContext Context;
+        SuffixRollSettings Settings;
+        SuffixRollResult Result;
+        bool Ready;
+        std::chrono::steady_clock::time_point Created;
+    };
+
+    struct PrerollJob
+    {
+        PrerollOwner OwnerType;
+        uint64 Owner;
+        uint64 ID;
+        ItemTemplate const* Proto;
+        SuffixRollContext Context;
+        SuffixRollSettings Settings;
+    };
+
+    // Run rolls the queued pre-rolls until the worker is stopped
+    void Run();
+    void Clear();
+
+    std::atomic<bool> _enabled{false};
+
+    // _lock guards the queue, the pre-rolls and the worker
+    mutable std::mutex _lock;
+    std::condition_variable _wake;
+    std::thread _worker;
+    bool _stopping = false;
+    uint32 _maxQueue = 0;
+    uint32 _expireMs = 0;
+    uint32 _sinceExpireMs = 0;
+    uint64 _nextID = 0;
+    std::deque<PrerollJob> _jobs;
+    std::unordered_map<uint64, std::vector<ItemPreroll>> _prerolls[MAX_PREROLL_OWNERS];
+
+    // Moving average of the worker's roll latency, over about the last 16 rolls
+    std::atomic<uint64> _avgRollMicros{0};
+    std::atomic<uint64> _queued{0};
+    std::atomic<uint64> _full{0};
+    std::atomic<uint64> _applied{0};
+    std::atomic<uint64> _missed{0};
+    std::atomic<uint64> _expired{0};
+    std::atomic<uint64> _dropped{0};
+};
+
+#define sRandomSuffixPreroll RandomSuffixPreroll::instance()
+
+#endif
@@ -0,0 +1,150 @@
+/*
+* Profiling zones across the stages of a suffix roll, see RandomSuffixProfile.h
+*/
+#include "RandomSuffixProfile.h"
+
+#ifdef RANDOM_SUFFIX_PROFILE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// A thread appends its buffer to the trace file once it grows past this many bytes
+#define PROFILE_BUFFER_FLUSH_SIZE (64 * 1024)
+
+struct ProfileThreadBuffer
+{
+    // Lock is only contended while the trace is being closed
+    std::mutex Lock;
+    std::string Events;
+    uint32 Tid;
+};
+
+static std::atomic<bool> profileOpen{false};
+static std::mutex profileLock;
+static FILE* profileFile = nullptr;
+static bool profileFirstEvent = true;
+static std::vector<std::unique_ptr<ProfileThreadBuffer>> profileThreads;
+
+static uint64 profileNowNanos()
+{
+    static std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static ProfileThreadBuffer& getProfileThreadBuffer()
+{
+    thread_local ProfileThreadBuffer* buffer = nullptr;
+    if (!buffer)
+    {
+        std::unique_ptr<ProfileThreadBuffer> threadBuffer = std::make_unique<ProfileThreadBuffer>();
+        buffer = threadBuffer.get();
+        std::lock_guard<std::mutex> guard(profileLock);
+        buffer->Tid = profileThreads.size() + 1;
+        profileThreads.push_back(std::move(threadBuffer));
+    }
+    return *buffer;
+}
+
+// writeProfileEvents appends events to the trace file, profileLock must be held
+static void writeProfileEvents(std::string const& events)
+{
+    if (!profileFile || events.empty())
+    {
+        return;
+    }
+    // Every event starts with a comma, the first one of the trace drops it
+    char const* data = events.data();
+    size_t size = events.size();
+    if (profileFirstEvent)
+    {
+        ++data;
+        --size;
+        profileFirstEvent = false;
+    }
+    std::fwrite(data, 1, size, profileFile);
+}
+
+bool openRandomSuffixProfile(std::string const& path)
+{
+    closeRandomSuffixProfile();
+    if (path.empty())
+    {
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(profileLock);
+    profileFile = std::fopen(path.c_str(), "w");
+    if (!profileFile)
+    {
+        LOG_ERROR("module", "RANDOM_ENCHANT: Cannot open the profile trace file {}", path);
+        return false;
+    }
+    std::fputs("{\"traceEvents\":[\n", profileFile);
+    profileFirstEvent = true;
+    profileOpen = true;
+    return true;
+}
+
+void closeRandomSuffixProfile()
+{
+    std::lock_guard<std::mutex> guard(profileLock);
+    profileOpen = false;
+    if (!profileFile)
+    {
+        return;
+    }
+    for (std::unique_ptr<ProfileThreadBuffer> const& buffer : profileThreads)
+    {
+        std::lock_guard<std::mutex> bufferGuard(buffer->Lock);
+        writeProfileEvents(buffer->Events);
+        buffer->Events.clear();
+    }
+    std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", profileFile);
+    std::fclose(profileFile);
+    profileFile = nullptr;
+}
+
+RandomSuffixProfileZone::RandomSuffixProfileZone(char const* name) : _name(nullptr), _startNanos(0)
+{
+    if (profileOpen.load(std::memory_order_relaxed))
+    {
+        _name = name;
+        _startNanos = profileNowNanos();
+    }
+}
+
+RandomSuffixProfileZone::~RandomSuffixProfileZone()
+{
+    if (!_name)
+    {
+        return;
+    }
+    uint64 endNanos = profileNowNanos();
+    ProfileThreadBuffer& buffer = getProfileThreadBuffer();
+    char event[256];
+    int size = std::snprintf(event, sizeof(event), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+        _name, buffer.Tid, _startNanos / 1000.0, (endNanos - _startNanos) / 1000.0);
+    if (size <= 0)
+    {
+        return;
+    }
+
+    std::string full;
+    {
+        std::lock_guard<std::mutex> guard(buffer.Lock);
+        buffer.Events.append(event, std::min<size_t>(size, sizeof(event) - 1));
+        if (buffer.Events.size() < PROFILE_BUFFER_FLUSH_SIZE)
+        {
+            return;
+        }
+        full.swap(buffer.Events);
+    }
+    std::lock_guard<std::mutex> guard(profileLock);
+    writeProfileEvents(full);
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+* Profiling zones across the stages of a suffix roll, written as a Chrome trace (trace event JSON) that
+* chrome://tracing and https://ui.perfetto.dev open.
+*
+* The zones are only compiled in with RANDOM_SUFFIX_PROFILE defined, otherwise every macro below is empty.
+* Every zone closed on a thread is buffered by that thread, the buffers are appended to the trace file as
+* they fill up and on RANDOM_SUFFIX_PROFILE_CLOSE.
+*/
+#ifndef _RANDOM_SUFFIX_PROFILE_H_
+#define _RANDOM_SUFFIX_PROFILE_H_
+
+#ifdef RANDOM_SUFFIX_PROFILE
+
+#include "RandomSuffixDefines.h"
+#include <string>
+
+// openRandomSuffixProfile starts a new trace file, closing the previous one. An empty path stops profiling.
+bool openRandomSuffixProfile(std::string const& path);
+void closeRandomSuffixProfile();
+
+// RandomSuffixProfileZone records the time from its construction to its destruction, name must outlive the trace
+class RandomSuffixProfileZone
+{
+public:
+    explicit RandomSuffixProfileZone(char const* name);
+    ~RandomSuffixProfileZone();
+
+    RandomSuffixProfileZone(RandomSuffixProfileZone const&) = delete;
+    RandomSuffixProfileZone& operator=(RandomSuffixProfileZone const&) = delete;
+
+private:
+    // _name is null if no trace was open when the zone started
+    char const* _name;
+    uint64 _startNanos;
+};
+
+#define RANDOM_SUFFIX_PROFILE_CONCAT_(a, b) a##b
+#define RANDOM_SUFFIX_PROFILE_CONCAT(a, b) RANDOM_SUFFIX_PROFILE_CONCAT_(a, b)
+#define RANDOM_SUFFIX_PROFILE_ZONE(name) RandomSuffixProfileZone RANDOM_SUFFIX_PROFILE_CONCAT(randomSuffixProfileZone, __LINE__)(name)
+#define RANDOM_SUFFIX_PROFILE_OPEN(path) openRandomSuffixProfile(path)
+#define RANDOM_SUFFIX_PROFILE_CLOSE() closeRandomSuffixProfile()
+
+#else
+
+#define RANDOM_SUFFIX_PROFILE_ZONE(name)
+#define RANDOM_SUFFIX_PROFILE_OPEN(path) ((void)0)
+#define RANDOM_SUFFIX_PROFILE_CLOSE() ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,244 @@
+/*
+* RandomSuffixScheduler spreads suffix rolls over map updates, see RandomSuffixScheduler.h
+*/
+#include "RandomSuffixScheduler.h"
+#include "RandomEnchants.h"
+#include "Item.h"
+#include "Map.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+RandomSuffixScheduler* RandomSuffixScheduler::instance()
+{
+    static RandomSuffixScheduler instance;
+    return &instance;
+}
+
+void RandomSuffixScheduler::SetConfig(uint32 budgetMicros, uint32 degradeMicros, uint32 maxQueue)
+{
+    _budgetMicros = budgetMicros;
+    _degradeMicros = degradeMicros;
+    _maxQueue = maxQueue;
+}
+
+RandomSuffixScheduler::MapRollQueue* RandomSuffixScheduler::GetQueue(Map* map)
+{
+    std::lock_guard<std::mutex> guard(_queuesLock);
+    std::unique_ptr<MapRollQueue>& queue = _queues[map];
+    if (!queue)
+    {
+        queue = std::make_unique<MapRollQueue>();
+    }
+    return queue.get();
+}
+
+RandomSuffixScheduler::MapRollQueue* RandomSuffixScheduler::FindQueue(Map* map)
+{
+    std::lock_guard<std::mutex> guard(_queuesLock);
+    auto found = _queues.find(map);
+    return found == _queues.end() ? nullptr : found->second.get();
+}
+
+bool RandomSuffixScheduler::IsDegraded() const
+{
+    uint32 degradeMicros = _degradeMicros.load(std::memory_order_relaxed);
+    return degradeMicros && _avgRollMicros.load(std::memory_order_relaxed) > degradeMicros;
+}
+
+uint64 RandomSuffixScheduler::RollTimed(Player* player, Item* item, SuffixRollSource source)
+{
+    auto start = std::chrono::steady_clock::now();
+    RollPossibleEnchant(player, item, source);
+    uint64 micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    // Rolls from several maps may race on the average, losing a sample now and then is fine
+    uint64 avg = _avgRollMicros.load(std::memory_order_relaxed);
+    _avgRollMicros.store(avg + (int64(micros) - int64(avg)) / 16, std::memory_order_relaxed);
+    return micros;
+}
+
+void RandomSuffixScheduler::Roll(Player* player, Item* item, SuffixRollSource source)
+{
+    uint32 budgetMicros = _budgetMicros.load(std::memory_order_relaxed);
+    Map* map = player->FindMap();
+    if (!budgetMicros || !map)
+    {
+        RollPossibleEnchant(player, item, source);
+        return;
+    }
+    // Only rolls that would do anything are worth queueing
+    if (!isRollableItemTemplate(item->GetTemplate()) || item->GetItemRandomPropertyId() != 0)
+    {
+        return;
+    }
+
+    MapRollQueue* queue = GetQueue(map);
+    std::unique_lock<std::mutex> guard(queue->Lock);
+    // Items already queued go first, and while rolls are slow every roll waits for the map update
+    if (queue->Pending.empty() && queue->SpentMicros < budgetMicros && !IsDegraded())
+    {
+        guard.unlock();
+        uint64 micros = RollTimed(player, item, source);
+        guard.lock();
+        queue->SpentMicros += micros;
+        ++_inlineRolls;
+        return;
+    }
+    if (queue->Pending.size() >= _maxQueue.load(std::memory_order_relaxed))
+    {
+        guard.unlock();
+        uint64 micros = RollTimed(player, item, source);
+        guard.lock();
+        queue->SpentMicros += micros;
+        ++_forcedRolls;
+        return;
+    }
+    queue->Pending.push_back({player->GetGUID(), item->GetGUID(), source});
+    queue->PendingItems.insert(item->GetGUID().GetRawValue());
+    ++_deferredRolls;
+    uint64 depth = queue->Pending.size();
+    uint64 maxDepth = _maxQueueDepth.load(std::memory_order_relaxed);
+    while (maxDepth < depth && !_maxQueueDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed))
+    {
+    }
+}
+
+void RandomSuffixScheduler::Update(Map* map)
+{
+    MapRollQueue* queue = FindQueue(map);
+    if (!queue)
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> guard(queue->Lock);
+    uint64 budgetMicros = _budgetMicros.load(std::memory_order_relaxed);
+    // At least one queued roll is done every update, so the queue drains even when rolls take longer than the budget
+    bool first = true;
+    while (!queue->Pending.empty() && (first || queue->SpentMicros < budgetMicros))
+    {
+        PendingRoll roll = queue->Pending.front();
+        queue->Pending.pop_front();
+        queue->PendingItems.erase(roll.ItemGuid.GetRawValue());
+        first = false;
+
+        Player* player = ObjectAccessor::GetPlayer(map, roll.PlayerGuid);
+        Item* item = player ? player->GetItemByGuid(roll.ItemGuid) : nullptr;
+        if (!item)
+        {
+            // Sold, destroyed or traded away since
+            ++_droppedRolls;
+            continue;
+        }
+        guard.unlock();
+        uint64 micros = RollTimed(player, item, roll.Source);
+        guard.lock();
+        queue->SpentMicros += micros;
+        ++_drainedRolls;
+    }
+    queue->SpentMicros = 0;
+}
+
+void RandomSuffixScheduler::FlushPlayer(Map* map, Player* player)
+{
+    MapRollQueue* queue = FindQueue(map);
+    if (!queue)
+    {
+        return;
+    }
+    std::vector<PendingRoll> rolls;
+    {
+        std::lock_guard<std::mutex> guard(queue->Lock);
+        for (auto itr = queue->Pending.begin(); itr != queue->Pending.end();)
+        {
+            if (itr->PlayerGuid == player->GetGUID())
+            {
+                queue->PendingItems.erase(itr->ItemGuid.GetRawValue());
+                rolls.push_back(*itr);
+                itr = queue->Pending.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+    }
+    for (PendingRoll const& roll : rolls)
+    {
+        if (Item* item = player->GetItemByGuid(roll.ItemGuid))
+        {
+            RollTimed(player, item, roll.Source);
+            ++_flushedRolls;
+        }
+        else
+        {
+            ++_droppedRolls;
+        }
+    }
+}
+
+void RandomSuffixScheduler::FlushItem(Player* player, Item* item)
+{
+    Map* map = player->FindMap();
+    MapRollQueue* queue = map ? FindQueue(map) : nullptr;
+    if (!queue)
+    {
+        return;
+    }
+    PendingRoll roll;
+    {
+        std::lock_guard<std::mutex> guard(queue->Lock);
+        if (!queue->PendingItems.erase(item->GetGUID().GetRawValue()))
+        {
+            return;
+        }
+        auto pending = std::find_if(queue->Pending.begin(), queue->Pending.end(), [item](PendingRoll const& p)
+        {
+            return p.ItemGuid == item->GetGUID();
+        });
+        roll = *pending;
+        queue->Pending.erase(pending);
+    }
+    RollTimed(player, item, roll.Source);
+    ++_flushedRolls;
+}
+
+void RandomSuffixScheduler::RemoveMap(Map* map)
+{
+    std::lock_guard<std::mutex> guard(_queuesLock);
+    _queues.erase(map);
+}
+
+bool RandomSuffixScheduler::IsPending(Map* map, Item* item)
+{
+    MapRollQueue* queue = map ? FindQueue(map) : nullptr;
+    if (!queue)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(queue->Lock);
+    return queue->PendingItems.count(item->GetGUID().GetRawValue()) > 0;
+}
+
+RollSchedulerStats RandomSuffixScheduler::GetStats() const
+{
+    RollSchedulerStats stats;
+    stats.InlineRolls = _inlineRolls.load(std::memory_order_relaxed);
+    stats.DeferredRolls = _deferredRolls.load(std::memory_order_relaxed);
+    stats.DrainedRolls = _drainedRolls.load(std::memory_order_relaxed);
+    stats.ForcedRolls = _forcedRolls.load(std::memory_order_relaxed);
+    stats.FlushedRolls = _flushedRolls.load(std::memory_order_relaxed);
+    stats.DroppedRolls = _droppedRolls.load(std::memory_order_relaxed);
+    stats.MaxQueueDepth = _maxQueueDepth.load(std::memory_order_relaxed);
+    stats.AvgRollMicros = _avgRollMicros.load(std::memory_order_relaxed);
+    stats.Degraded = IsDegraded();
+    stats.QueueDepth = 0;
+    std::lock_guard<std::mutex> guard(_queuesLock);
+    for (auto const& [map, queue] : _queues)
+    {
+        std::lock_guard<std::mutex> queueGuard(queue->Lock);
+        stats.QueueDepth += queue->Pending.size();
+    }
+    return stats;
+}
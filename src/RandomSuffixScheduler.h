@@ -0,0 +1,111 @@
+/*
+* RandomSuffixScheduler spreads suffix rolls over map updates. Every map gets a budget of roll time per update,
+* rolls past the budget are queued and rolled on the next updates of the map.
+*/
+#ifndef _RANDOM_SUFFIX_SCHEDULER_H_
+#define _RANDOM_SUFFIX_SCHEDULER_H_
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include "RandomSuffixEngine.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+class Item;
+class Map;
+class Player;
+
+struct RollSchedulerStats
+{
+    // InlineRolls were rolled in the hook, DeferredRolls were queued and DrainedRolls rolled off a queue
+    uint64 InlineRolls;
+    uint64 DeferredRolls;
+    uint64 DrainedRolls;
+    // ForcedRolls were rolled in the hook past the budget as the queue of their map was full
+    uint64 ForcedRolls;
+    // FlushedRolls were rolled as their player left the map or their item was about to change hands, DroppedRolls
+    // lost their item before being rolled
+    uint64 FlushedRolls;
+    uint64 DroppedRolls;
+    uint64 QueueDepth;
+    uint64 MaxQueueDepth;
+    uint64 AvgRollMicros;
+    bool Degraded;
+};
+
+class RandomSuffixScheduler
+{
+public:
+    static RandomSuffixScheduler* instance();
+
+    // SetConfig applies the scheduler settings, a budget of 0 rolls everything in the hooks as before
+    void SetConfig(uint32 budgetMicros, uint32 degradeMicros, uint32 maxQueue);
+
+    // Roll rolls the item right away while its map has budget left, otherwise the roll is queued and the
+    // item is pending until a later update of the map rolls it
+    void Roll(Player* player, Item* item, SuffixRollSource source);
+    // Update rolls queued items within what is left of the map's budget, and starts the map's next budget
+    void Update(Map* map);
+    // FlushPlayer rolls every queued item of a player leaving the map
+    void FlushPlayer(Map* map, Player* player);
+    // FlushItem rolls the item right away if it is queued. The queue only finds items in the inventory of the
+    // player it was queued for, so it must be called before the item is traded, sold or mailed.
+    void FlushItem(Player* player, Item* item);
+    void RemoveMap(Map* map);
+
+    // IsPending returns true if the item is waiting in the queue of the map for its roll
+    bool IsPending(Map* map, Item* item);
+    RollSchedulerStats GetStats() const;
+
+private:
+    RandomSuffixScheduler() = default;
+
+    struct PendingRoll
+    {
+        ObjectGuid PlayerGuid;
+        ObjectGuid ItemGuid;
+        SuffixRollSource Source;
+    };
+
+    // MapRollQueue is only used from the thread updating its map, the lock is for the stats command
+    struct MapRollQueue
+    {
+        std::mutex Lock;
+        std::deque<PendingRoll> Pending;
+        std::unordered_set<uint64> PendingItems;
+        // SpentMicros is the roll time spent in the current update of the map
+        uint64 SpentMicros = 0;
+    };
+
+    MapRollQueue* GetQueue(Map* map);
+    // FindQueue returns nullptr if no roll was ever queued on the map
+    MapRollQueue* FindQueue(Map* map);
+    // RollTimed rolls the item and records the roll latency
+    uint64 RollTimed(Player* player, Item* item, SuffixRollSource source);
+    bool IsDegraded() const;
+
+    std::atomic<uint32> _budgetMicros{0};
+    std::atomic<uint32> _degradeMicros{0};
+    std::atomic<uint32> _maxQueue{0};
+
+    mutable std::mutex _queuesLock;
+    std::unordered_map<Map*, std::unique_ptr<MapRollQueue>> _queues;
+
+    // Moving average of the roll latency, over about the last 16 rolls
+    std::atomic<uint64> _avgRollMicros{0};
+    std::atomic<uint64> _inlineRolls{0};
+    std::atomic<uint64> _deferredRolls{0};
+    std::atomic<uint64> _drainedRolls{0};
+    std::atomic<uint64> _forcedRolls{0};
+    std::atomic<uint64> _flushedRolls{0};
+    std::atomic<uint64> _droppedRolls{0};
+    std::atomic<uint64> _maxQueueDepth{0};
+};
+
+#define sRandomSuffixScheduler RandomSuffixScheduler::instance()
+
+#endif
@@ -0,0 +1,119 @@
+/*
+* Dry runs of suffix rolls, see RandomSuffixSimulation.h
+*/
+#include "RandomSuffixSimulation.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+// Rolls of a shard between two checks for a cancel
+#define SIMULATION_CANCEL_CHECK_ROLLS 4096
+
+struct SimulationShard
+{
+    uint64 Rolls = 0;
+    uint64 Tiers[MAX_RAND_ENCHANT_TIERS + 1] = {};
+    uint64 EmptySpecPools = 0;
+    uint64 NoCandidates = 0;
+    std::unordered_map<uint32, uint64> Suffixes;
+};
+
+void simulateSuffixRolls(std::vector<SimulatedItem> const& items, uint32 spec, SuffixRollSettings const& settings, uint64 count, uint32 seed,
+    uint32 threads, SuffixSourceFactory const& makeSource, SuffixSimulationReport& report, std::atomic<bool> const* cancel)
+{
+    auto start = std::chrono::steady_clock::now();
+    report = SuffixSimulationReport{};
+    if (items.empty() || !count)
+    {
+        return;
+    }
+    if (!threads)
+    {
+        threads = std::max<uint32>(1, std::thread::hardware_concurrency());
+    }
+    threads = uint32(std::min<uint64>(threads, count));
+
+    SuffixRollSettings rollSettings = settings;
+    rollSettings.Debug = false;
+    rollSettings.Quiet = true;
+    auto specClass = specToClass.find(spec);
+    rollSettings.RollPlayerClassPreference = specClass != specToClass.end();
+    uint8 plrClass = rollSettings.RollPlayerClassPreference ? specClass->second : uint8(CLASS_NONE);
+
+    std::vector<SimulationShard> shards(threads);
+    std::vector<std::thread> workers;
+    for (uint32 t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]()
+        {
+            std::unique_ptr<SuffixCandidateSource> source = makeSource();
+            SuffixRollRng seeds(seed + t);
+            SimulationShard& shard = shards[t];
+            // Shard t rolls every threads-th roll from t, so the items are rolled alike whatever the thread count
+            for (uint64 i = t; i < count; i += threads)
+            {
+                if (cancel && shard.Rolls % SIMULATION_CANCEL_CHECK_ROLLS == 0 && cancel->load(std::memory_order_relaxed))
+                {
+                    break;
+                }
+                SimulatedItem const& item = items[i % items.size()];
+                SuffixRollContext ctx;
+                ctx.ItemPlayerLevel = item.ItemPlayerLevel;
+                ctx.SuffixFactor = item.SuffixFactor;
+                ctx.PlayerClass = plrClass;
+                ctx.PlayerSpec = spec;
+                ctx.PlayerLevel = uint8(std::min<uint32>(item.ItemPlayerLevel, 255));
+                // The player of the spec is taken to be able to use every item, like the previews do
+                ctx.PlayerCanUseItem = rollSettings.RollPlayerClassPreference;
+                // The source never changes a roll, a dry run counts as loot
+                ctx.Source = ROLL_SOURCE_LOOT;
+                ctx.Seed = seeds();
+                SuffixRollResult result;
+                rollSuffix(item.Proto, ctx, rollSettings, *source, &result);
+                ++shard.Rolls;
+                ++shard.Tiers[result.Tier + 1];
+                switch (result.Status)
+                {
+                    case SUFFIX_ROLL_OK:
+                        ++shard.Suffixes[result.SuffixID];
+                        break;
+                    case SUFFIX_ROLL_EMPTY_SPEC_POOL:
+                        ++shard.EmptySpecPools;
+                        break;
+                    case SUFFIX_ROLL_NO_CANDIDATE:
+                        ++shard.NoCandidates;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::unordered_map<uint32, uint64> suffixes;
+    for (SimulationShard const& shard : shards)
+    {
+        report.Rolls += shard.Rolls;
+        for (uint32 tier = 0; tier <= MAX_RAND_ENCHANT_TIERS; ++tier)
+        {
+            report.Tiers[tier] += shard.Tiers[tier];
+        }
+        report.EmptySpecPools += shard.EmptySpecPools;
+        report.NoCandidates += shard.NoCandidates;
+        for (auto const& [suffixId, rolls] : shard.Suffixes)
+        {
+            suffixes[suffixId] += rolls;
+        }
+    }
+    report.Suffixes.assign(suffixes.begin(), suffixes.end());
+    std::sort(report.Suffixes.begin(), report.Suffixes.end(), [](std::pair<uint32, uint64> const& a, std::pair<uint32, uint64> const& b)
+    {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    report.Threads = threads;
+    report.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
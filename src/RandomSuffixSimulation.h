@@ -0,0 +1,46 @@
+/*
+* Dry runs of suffix rolls: items are rolled through rollSuffix like a real roll, and what the rolls end with is
+* counted instead of applied. The rolls are sharded over threads, each with its own candidate source, and the
+* counts of every shard are summed once they are all done.
+*/
+#ifndef _RANDOM_SUFFIX_SIMULATION_H_
+#define _RANDOM_SUFFIX_SIMULATION_H_
+
+#include "RandomSuffixEngine.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// SimulatedItem is an item template along with the roll context it gets from the worldserver
+struct SimulatedItem
+{
+    ItemTemplate const* Proto;
+    uint32 ItemPlayerLevel;
+    uint32 SuffixFactor;
+};
+
+struct SuffixSimulationReport
+{
+    uint64 Rolls;
+    // Tiers[0] counts the failed tier rolls, Tiers[t + 1] the rolls of EnchantQuality t
+    uint64 Tiers[MAX_RAND_ENCHANT_TIERS + 1];
+    uint64 EmptySpecPools;
+    uint64 NoCandidates;
+    // Suffixes has every suffix rolled with how many times it was, the most rolled first
+    std::vector<std::pair<uint32, uint64>> Suffixes;
+    uint32 Threads;
+    double Seconds;
+};
+
+// SuffixSourceFactory makes the candidate source of one shard, which only its thread picks from
+typedef std::function<std::unique_ptr<SuffixCandidateSource>()> SuffixSourceFactory;
+
+// simulateSuffixRolls rolls count items in all, going round the items. With a spec the items are rolled by a player
+// of it with the player class preference, without one from the spec pool of every item. The rolls are sharded over
+// threads, 0 being one per core, and stop early once cancel is set.
+void simulateSuffixRolls(std::vector<SimulatedItem> const& items, uint32 spec, SuffixRollSettings const& settings, uint64 count, uint32 seed,
+    uint32 threads, SuffixSourceFactory const& makeSource, SuffixSimulationReport& report, std::atomic<bool> const* cancel = nullptr);
+
+#endif
@@ -0,0 +1,124 @@
+/*
+* RandomSuffixSimulator runs the dry runs of .randomsuffix simulate in the background, see RandomSuffixSimulator.h
+*/
+#include "RandomSuffixSimulator.h"
+#include "RandomEnchantsMgr.h"
+#include "RandomSuffixAlias.h"
+#include "Chat.h"
+#include "DBCStores.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "Random.h"
+#include "StringFormat.h"
+#include <functional>
+
+// Most rolled suffixes listed in the report of a dry run
+#define MAX_SIMULATION_REPORT_SUFFIXES 10
+
+RandomSuffixSimulator* RandomSuffixSimulator::instance()
+{
+    static RandomSuffixSimulator instance;
+    return &instance;
+}
+
+RandomSuffixSimulator::~RandomSuffixSimulator()
+{
+    Stop();
+}
+
+bool RandomSuffixSimulator::Start(ObjectGuid requester, std::string const& description, std::vector<SimulatedItem>&& items, uint32 spec,
+    SuffixRollSettings const& settings, uint64 count)
+{
+    if (_running.exchange(true))
+    {
+        return false;
+    }
+    if (_runner.joinable())
+    {
+        _runner.join();
+    }
+    _requester = requester;
+    _description = description;
+    _items = std::move(items);
+    _cancel = false;
+    _done = false;
+    uint32 seed = rand32();
+    uint32 threads = _threads.load(std::memory_order_relaxed);
+    _runner = std::thread([this, settings, spec, count, seed, threads]()
+    {
+        // Dry runs always pick from the in-memory catalog, a million queries would swamp the world database
+        SuffixSourceFactory makeSource = []() -> std::unique_ptr<SuffixCandidateSource>
+        {
+            return std::make_unique<AliasSuffixSource>(sRandomEnchantsMgr->GetSuffixCatalog(), sRandomEnchantsMgr->GetSuffixColumns(),
+                sRandomEnchantsMgr->GetSuffixAliasTables());
+        };
+        simulateSuffixRolls(_items, spec, settings, count, seed, threads, makeSource, _report, &_cancel);
+        _done = true;
+    });
+    return true;
+}
+
+void RandomSuffixSimulator::Update()
+{
+    if (!_done.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    _runner.join();
+    _done = false;
+    Report();
+    _items.clear();
+    _running = false;
+}
+
+void RandomSuffixSimulator::Stop()
+{
+    _cancel = true;
+    if (_runner.joinable())
+    {
+        _runner.join();
+    }
+    _done = false;
+    _running = false;
+}
+
+void RandomSuffixSimulator::Report()
+{
+    Player* player = _requester.IsEmpty() ? nullptr : ObjectAccessor::FindPlayer(_requester);
+    if (!_requester.IsEmpty() && !player)
+    {
+        // Logged out meanwhile, the report goes to the log instead
+        LOG_INFO("module", ">> RANDOM_ENCHANT: The player who started the dry run of {} logged out, reporting here", _description);
+    }
+    uint32 loc = player ? player->GetSession()->GetSessionDbLocaleIndex() : 0;
+    std::function<void(std::string const&)> send = [player](std::string const& line)
+    {
+        if (player)
+        {
+            ChatHandler(player->GetSession()).SendSysMessage(line);
+        }
+        else
+        {
+            LOG_INFO("module", ">> RANDOM_ENCHANT: {}", line);
+        }
+    };
+
+    SuffixSimulationReport const& report = _report;
+    double rolls = double(std::max<uint64>(report.Rolls, 1));
+    send(Acore::StringFormat("Dry run of {}: {} rolls on {} threads in {:.2f} s, {:.0f} rolls/s", _description, report.Rolls, report.Threads,
+        report.Seconds, report.Seconds > 0.0 ? report.Rolls / report.Seconds : 0.0));
+    std::string tiers = Acore::StringFormat("No tier: {:.2f}%", report.Tiers[0] * 100.0 / rolls);
+    for (uint32 tier = 1; tier <= MAX_RAND_ENCHANT_TIERS; ++tier)
+    {
+        tiers += Acore::StringFormat(", tier {}: {:.2f}%", tier, report.Tiers[tier] * 100.0 / rolls);
+    }
+    send(tiers);
+    send(Acore::StringFormat("Empty spec pool: {:.2f}%, no candidate: {:.2f}%, {} suffixes rolled", report.EmptySpecPools * 100.0 / rolls,
+        report.NoCandidates * 100.0 / rolls, report.Suffixes.size()));
+    for (size_t i = 0; i < report.Suffixes.size() && i < MAX_SIMULATION_REPORT_SUFFIXES; ++i)
+    {
+        ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(report.Suffixes[i].first);
+        send(Acore::StringFormat("  {} {}: {} rolls, {:.3f}%", report.Suffixes[i].first, item_rand ? item_rand->Name[loc] : "",
+            report.Suffixes[i].second, report.Suffixes[i].second * 100.0 / rolls));
+    }
+}
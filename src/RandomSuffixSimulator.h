@@ -0,0 +1,54 @@
+/*
+* RandomSuffixSimulator runs the dry runs of .randomsuffix simulate in the background, off the map threads. One dry
+* run goes at a time, its report is handed to whoever asked for it from the world updates once it is done.
+*/
+#ifndef _RANDOM_SUFFIX_SIMULATOR_H_
+#define _RANDOM_SUFFIX_SIMULATOR_H_
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include "RandomSuffixSimulation.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class RandomSuffixSimulator
+{
+public:
+    static RandomSuffixSimulator* instance();
+
+    // SetConfig sets the threads of every dry run, 0 being one per core
+    void SetConfig(uint32 threads) { _threads = threads; }
+
+    // Start starts a dry run of count rolls of the items, see simulateSuffixRolls. The report goes to the player of
+    // requester, or to the log for the console. Returns false if a dry run is already going.
+    bool Start(ObjectGuid requester, std::string const& description, std::vector<SimulatedItem>&& items, uint32 spec,
+        SuffixRollSettings const& settings, uint64 count);
+    bool IsRunning() const { return _running.load(std::memory_order_relaxed); }
+    // Update hands the report of a finished dry run out
+    void Update();
+    // Stop cancels the dry run going and waits for it
+    void Stop();
+
+private:
+    RandomSuffixSimulator() = default;
+    ~RandomSuffixSimulator();
+
+    void Report();
+
+    std::atomic<uint32> _threads{0};
+    std::atomic<bool> _running{false};
+    std::atomic<bool> _done{false};
+    std::atomic<bool> _cancel{false};
+    // The members below belong to the runner while it runs, then to Update
+    std::thread _runner;
+    ObjectGuid _requester;
+    std::string _description;
+    std::vector<SimulatedItem> _items;
+    SuffixSimulationReport _report;
+};
+
+#define sRandomSuffixSimulator RandomSuffixSimulator::instance()
+
+#endif
@@ -0,0 +1,152 @@
+/*
+* Binary trace of suffix roll inputs, see RandomSuffixTrace.h
+*/
+#include "RandomSuffixTrace.h"
+#include <cstring>
+
+static char const rollTraceMagic[4] = {'R', 'S', 'T', 'R'};
+
+template<typename T>
+static void writeLE(std::ostream& out, T value)
+{
+    char bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        bytes[i] = char((uint64(value) >> (8 * i)) & 0xFF);
+    }
+    out.write(bytes, sizeof(T));
+}
+
+template<typename T>
+static T readLE(char const* bytes)
+{
+    uint64 value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= uint64(uint8(bytes[i])) << (8 * i);
+    }
+    return T(value);
+}
+
+// Fixed sizes of the record payloads, not counting the type byte
+#define ROLL_TRACE_SETTINGS_SIZE (MAX_RAND_ENCHANT_TIERS * 8 + 1)
+#define ROLL_TRACE_ROLL_SIZE (4 + 1 + 1 + 1 + 1 + 2 + 1 + 1 + MAX_ITEM_PROTO_STATS + 1 + 4 + 1 + 1 + 2 + 1 + 1 + 4)
+
+void writeRollTraceHeader(std::ostream& out)
+{
+    out.write(rollTraceMagic, sizeof(rollTraceMagic));
+    writeLE<uint16>(out, ROLL_TRACE_VERSION);
+}
+
+void writeRollTraceSettings(std::ostream& out, SuffixRollSettings const& settings)
+{
+    writeLE<uint8>(out, ROLL_TRACE_RECORD_SETTINGS);
+    for (double pct : settings.EnchantPcts)
+    {
+        uint64 bits;
+        std::memcpy(&bits, &pct, sizeof(bits));
+        writeLE<uint64>(out, bits);
+    }
+    writeLE<uint8>(out, settings.RollPlayerClassPreference);
+}
+
+void writeRollTraceRoll(std::ostream& out, ItemTemplate const* proto, SuffixRollContext const& ctx)
+{
+    writeLE<uint8>(out, ROLL_TRACE_RECORD_ROLL);
+    writeLE<uint32>(out, proto->ItemId);
+    writeLE<uint8>(out, proto->Class);
+    writeLE<uint8>(out, proto->SubClass);
+    writeLE<uint8>(out, proto->Quality);
+    writeLE<uint8>(out, proto->InventoryType);
+    writeLE<uint16>(out, proto->ItemLevel);
+    writeLE<uint8>(out, proto->RequiredLevel);
+    writeLE<uint8>(out, proto->StatsCount);
+    for (uint8 i = 0; i < MAX_ITEM_PROTO_STATS; ++i)
+    {
+        writeLE<uint8>(out, proto->ItemStat[i].ItemStatType);
+    }
+    writeLE<uint8>(out, ctx.ItemPlayerLevel);
+    writeLE<uint32>(out, ctx.SuffixFactor);
+    writeLE<uint8>(out, ctx.PlayerClass);
+    writeLE<uint8>(out, ctx.PlayerLevel);
+    writeLE<uint16>(out, ctx.PlayerSpec);
+    writeLE<uint8>(out, ctx.PlayerCanUseItem);
+    writeLE<uint8>(out, ctx.Source);
+    writeLE<uint32>(out, ctx.Seed);
+}
+
+bool readRollTraceHeader(std::istream& in)
+{
+    char bytes[sizeof(rollTraceMagic) + 2];
+    if (!in.read(bytes, sizeof(bytes)))
+    {
+        return false;
+    }
+    return std::memcmp(bytes, rollTraceMagic, sizeof(rollTraceMagic)) == 0 &&
+        readLE<uint16>(bytes + sizeof(rollTraceMagic)) == ROLL_TRACE_VERSION;
+}
+
+bool readRollTraceRecord(std::istream& in, RollTraceRecord& record)
+{
+    char type;
+    if (!in.get(type))
+    {
+        return false;
+    }
+    char bytes[ROLL_TRACE_ROLL_SIZE > ROLL_TRACE_SETTINGS_SIZE ? ROLL_TRACE_ROLL_SIZE : ROLL_TRACE_SETTINGS_SIZE];
+    char const* p = bytes;
+    switch (uint8(type))
+    {
+        case ROLL_TRACE_RECORD_SETTINGS:
+            if (!in.read(bytes, ROLL_TRACE_SETTINGS_SIZE))
+            {
+                return false;
+            }
+            record.Type = ROLL_TRACE_RECORD_SETTINGS;
+            for (double& pct : record.Settings.EnchantPcts)
+            {
+                uint64 bits = readLE<uint64>(p);
+                std::memcpy(&pct, &bits, sizeof(bits));
+                p += 8;
+            }
+            record.Settings.RollPlayerClassPreference = readLE<uint8>(p);
+            record.Settings.Debug = false;
+            record.Settings.Quiet = true;
+            buildSuffixTierChances(record.Settings);
+            return true;
+        case ROLL_TRACE_RECORD_ROLL:
+        {
+            if (!in.read(bytes, ROLL_TRACE_ROLL_SIZE))
+            {
+                return false;
+            }
+            record.Type = ROLL_TRACE_RECORD_ROLL;
+            ItemTemplate& item = record.Item;
+            item = ItemTemplate();
+            item.ItemId = readLE<uint32>(p); p += 4;
+            item.Class = readLE<uint8>(p); p += 1;
+            item.SubClass = readLE<uint8>(p); p += 1;
+            item.Quality = readLE<uint8>(p); p += 1;
+            item.InventoryType = readLE<uint8>(p); p += 1;
+            item.ItemLevel = readLE<uint16>(p); p += 2;
+            item.RequiredLevel = readLE<uint8>(p); p += 1;
+            item.StatsCount = readLE<uint8>(p); p += 1;
+            for (uint8 i = 0; i < MAX_ITEM_PROTO_STATS; ++i)
+            {
+                item.ItemStat[i].ItemStatType = readLE<uint8>(p); p += 1;
+            }
+            SuffixRollContext& ctx = record.Context;
+            ctx.ItemPlayerLevel = readLE<uint8>(p); p += 1;
+            ctx.SuffixFactor = readLE<uint32>(p); p += 4;
+            ctx.PlayerClass = readLE<uint8>(p); p += 1;
+            ctx.PlayerLevel = readLE<uint8>(p); p += 1;
+            ctx.PlayerSpec = readLE<uint16>(p); p += 2;
+            ctx.PlayerCanUseItem = readLE<uint8>(p); p += 1;
+            ctx.Source = readLE<uint8>(p); p += 1;
+            ctx.Seed = readLE<uint32>(p);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
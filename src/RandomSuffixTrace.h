@@ -0,0 +1,40 @@
+/*
+* Binary trace of suffix roll inputs, written by the module's capture mode and read by tools/rollreplay.
+*
+* A trace starts with the "RSTR" magic and a uint16 version, followed by records each starting with
+* a RollTraceRecordType byte. A settings record applies to every roll record after it. All integers
+* are little endian.
+*/
+#ifndef _RANDOM_SUFFIX_TRACE_H_
+#define _RANDOM_SUFFIX_TRACE_H_
+
+#include "RandomSuffixEngine.h"
+#include <istream>
+#include <ostream>
+
+#define ROLL_TRACE_VERSION 1
+
+enum RollTraceRecordType
+{
+    ROLL_TRACE_RECORD_SETTINGS = 1,
+    ROLL_TRACE_RECORD_ROLL     = 2,
+};
+
+struct RollTraceRecord
+{
+    RollTraceRecordType Type;
+    SuffixRollSettings Settings;
+    ItemTemplate Item;
+    SuffixRollContext Context;
+};
+
+void writeRollTraceHeader(std::ostream& out);
+void writeRollTraceSettings(std::ostream& out, SuffixRollSettings const& settings);
+void writeRollTraceRoll(std::ostream& out, ItemTemplate const* proto, SuffixRollContext const& ctx);
+
+// readRollTraceHeader returns false if the stream is not a trace of a supported version
+bool readRollTraceHeader(std::istream& in);
+// readRollTraceRecord returns false at the end of the trace or on a truncated record
+bool readRollTraceRecord(std::istream& in, RollTraceRecord& record);
+
+#endif
@@ -0,0 +1,52 @@
+/*
+* Latency percentiles shared by the offline tools
+*/
+#ifndef _LATENCY_STATS_H_
+#define _LATENCY_STATS_H_
+
+#include "RandomSuffixDefines.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+struct LatencySummary
+{
+    uint64 Count;
+    uint64 P50;
+    uint64 P90;
+    uint64 P99;
+    uint64 P999;
+    uint64 Max;
+};
+
+// summarizeLatencies sorts the samples in place, all values are in nanoseconds
+inline LatencySummary summarizeLatencies(std::vector<uint64>& nanos)
+{
+    LatencySummary summary = {};
+    summary.Count = nanos.size();
+    if (nanos.empty())
+    {
+        return summary;
+    }
+    std::sort(nanos.begin(), nanos.end());
+    auto percentile = [&nanos](double pct)
+    {
+        size_t idx = size_t(pct / 100.0 * double(nanos.size() - 1) + 0.5);
+        return nanos[std::min(idx, nanos.size() - 1)];
+    };
+    summary.P50 = percentile(50.0);
+    summary.P90 = percentile(90.0);
+    summary.P99 = percentile(99.0);
+    summary.P999 = percentile(99.9);
+    summary.Max = nanos.back();
+    return summary;
+}
+
+inline void printLatencySummary(LatencySummary const& summary)
+{
+    std::printf("latency ns: p50=%llu p90=%llu p99=%llu p999=%llu max=%llu\n",
+        (unsigned long long)summary.P50, (unsigned long long)summary.P90, (unsigned long long)summary.P99,
+        (unsigned long long)summary.P999, (unsigned long long)summary.Max);
+}
+
+#endif
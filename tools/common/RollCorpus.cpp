@@ -0,0 +1,128 @@
+/*
+* Roll corpora for the offline tools, see RollCorpus.h
+*/
+#include "RollCorpus.h"
+#include "RandomSuffixTrace.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+bool loadRollTrace(std::string const& path, std::vector<SuffixRollSettings>& settings, std::vector<CorpusRoll>& rolls, std::string& error)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in || !readRollTraceHeader(in))
+    {
+        error = path + " is not a roll trace of version " + std::to_string(ROLL_TRACE_VERSION);
+        return false;
+    }
+    RollTraceRecord record;
+    while (readRollTraceRecord(in, record))
+    {
+        if (record.Type == ROLL_TRACE_RECORD_SETTINGS)
+        {
+            settings.push_back(record.Settings);
+            continue;
+        }
+        if (settings.empty())
+        {
+            error = path + " has a roll before any settings record";
+            return false;
+        }
+        rolls.push_back({ uint32(settings.size() - 1), record.Item, record.Context });
+    }
+    // A worldserver killed mid write leaves a truncated last record, the rolls before it are still good
+    return true;
+}
+
+struct CorpusItemShape
+{
+    uint8 Class;
+    uint8 SubClass;
+    uint8 InventoryType;
+};
+
+static CorpusItemShape const corpusItemShapes[] = {
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_CLOTH, INVTYPE_HEAD },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_CLOTH, INVTYPE_ROBE },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_CLOTH, INVTYPE_CLOAK },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_LEATHER, INVTYPE_CHEST },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_LEATHER, INVTYPE_HANDS },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_MAIL, INVTYPE_LEGS },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_MAIL, INVTYPE_FEET },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_PLATE, INVTYPE_SHOULDERS },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_PLATE, INVTYPE_WRISTS },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_PLATE, INVTYPE_WAIST },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_SHIELD, INVTYPE_SHIELD },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_MISC, INVTYPE_FINGER },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_MISC, INVTYPE_NECK },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_MISC, INVTYPE_TRINKET },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_MISC, INVTYPE_HOLDABLE },
+    { ITEM_CLASS_ARMOR, ITEM_SUBCLASS_ARMOR_LIBRAM, INVTYPE_RELIC },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_SWORD, INVTYPE_WEAPON },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_AXE2, INVTYPE_2HWEAPON },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_MACE, INVTYPE_WEAPONMAINHAND },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_DAGGER, INVTYPE_WEAPONOFFHAND },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_STAFF, INVTYPE_2HWEAPON },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_POLEARM, INVTYPE_2HWEAPON },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_BOW, INVTYPE_RANGED },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_WAND, INVTYPE_RANGEDRIGHT },
+    { ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_THROWN, INVTYPE_THROWN },
+};
+
+static uint8 const corpusStatTypes[] = {
+    ITEM_MOD_AGILITY, ITEM_MOD_STRENGTH, ITEM_MOD_INTELLECT, ITEM_MOD_SPIRIT, ITEM_MOD_STAMINA,
+    ITEM_MOD_DEFENSE_SKILL_RATING, ITEM_MOD_DODGE_RATING, ITEM_MOD_HIT_RATING, ITEM_MOD_CRIT_RATING,
+    ITEM_MOD_HASTE_RATING, ITEM_MOD_ATTACK_POWER, ITEM_MOD_SPELL_POWER,
+};
+
+static uint8 const corpusPlayerClasses[] = {
+    CLASS_WARRIOR, CLASS_PALADIN, CLASS_HUNTER, CLASS_ROGUE, CLASS_PRIEST,
+    CLASS_DEATH_KNIGHT, CLASS_SHAMAN, CLASS_MAGE, CLASS_WARLOCK, CLASS_DRUID,
+};
+
+void generateRollCorpus(uint32 count, uint32 seed, std::vector<CorpusRoll>& rolls)
+{
+    SuffixRollRng rng(seed);
+    rolls.clear();
+    rolls.reserve(count);
+    for (uint32 i = 0; i < count; ++i)
+    {
+        CorpusRoll roll = {};
+        ItemTemplate& item = roll.Item;
+        CorpusItemShape const& shape = corpusItemShapes[rng() % std::size(corpusItemShapes)];
+        item.ItemId = 100000 + i;
+        item.Class = shape.Class;
+        item.SubClass = shape.SubClass;
+        item.InventoryType = shape.InventoryType;
+        item.Quality = ITEM_QUALITY_UNCOMMON + rng() % 3;
+        item.RequiredLevel = 1 + rng() % 80;
+        item.ItemLevel = item.RequiredLevel + 5 + rng() % 20;
+        // Most items have no stats, the rest two or three, which is roughly what item_template has
+        item.StatsCount = rng() % 2 ? 0 : 2 + rng() % 2;
+        for (uint8 s = 0; s < item.StatsCount; ++s)
+        {
+            item.ItemStat[s].ItemStatType = corpusStatTypes[rng() % std::size(corpusStatTypes)];
+            item.ItemStat[s].ItemStatValue = 1 + rng() % 30;
+        }
+
+        SuffixRollContext& ctx = roll.Context;
+        ctx.ItemPlayerLevel = item.RequiredLevel;
+        // Close to what GenerateEnchSuffixFactor gives for a mid quality item of this level
+        ctx.SuffixFactor = item.ItemLevel * (item.Quality + 1) / 2;
+        ctx.PlayerClass = corpusPlayerClasses[rng() % std::size(corpusPlayerClasses)];
+        ctx.PlayerSpec = 0;
+        ctx.PlayerLevel = std::max<uint32>(item.RequiredLevel, 1 + rng() % 80);
+        ctx.PlayerCanUseItem = false;
+        // Generated items drop through the player hooks, reforges are never captured
+        ctx.Source = rng() % ROLL_SOURCE_REFORGE;
+        ctx.Seed = rng();
+        rolls.push_back(roll);
+    }
+}
+
+SuffixRollSettings defaultRollSettings()
+{
+    SuffixRollSettings settings = { { 30.0, 35.0, 40.0, 45.0 }, { }, { }, false, false, false };
+    buildSuffixTierChances(settings);
+    return settings;
+}
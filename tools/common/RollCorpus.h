@@ -0,0 +1,30 @@
+/*
+* Sets of roll inputs driven through the engine by the offline tools, either loaded from a captured
+* roll trace or generated.
+*/
+#ifndef _ROLL_CORPUS_H_
+#define _ROLL_CORPUS_H_
+
+#include "RandomSuffixEngine.h"
+#include <string>
+#include <vector>
+
+struct CorpusRoll
+{
+    // SettingsIndex is the index of the settings the roll was captured with
+    uint32 SettingsIndex;
+    ItemTemplate Item;
+    SuffixRollContext Context;
+};
+
+// loadRollTrace reads every roll of a trace along with the settings records before them
+bool loadRollTrace(std::string const& path, std::vector<SuffixRollSettings>& settings, std::vector<CorpusRoll>& rolls, std::string& error);
+
+// generateRollCorpus fills rolls with random rollable weapons and armor dropping for random players,
+// all rolled with settings index 0. The same seed always generates the same corpus.
+void generateRollCorpus(uint32 count, uint32 seed, std::vector<CorpusRoll>& rolls);
+
+// defaultRollSettings returns the module's default roll settings
+SuffixRollSettings defaultRollSettings();
+
+#endif
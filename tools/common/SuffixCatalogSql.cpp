@@ -0,0 +1,197 @@
+/*
+* Minimal reader of the generated module SQL, see SuffixCatalogSql.h
+*/
+#include "SuffixCatalogSql.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+// parseSqlValues parses the "(a,'b',c),(...)" tuples starting at pos up to the terminating ';'
+static bool parseSqlValues(std::string const& sql, size_t pos, std::vector<SqlRow>& rows)
+{
+    SqlRow row;
+    std::string value;
+    bool inTuple = false;
+    bool inString = false;
+    for (; pos < sql.size(); ++pos)
+    {
+        char c = sql[pos];
+        if (inString)
+        {
+            if (c == '\\' && pos + 1 < sql.size())
+            {
+                value += sql[++pos];
+            }
+            else if (c == '\'' && pos + 1 < sql.size() && sql[pos + 1] == '\'')
+            {
+                value += '\'';
+                ++pos;
+            }
+            else if (c == '\'')
+            {
+                inString = false;
+            }
+            else
+            {
+                value += c;
+            }
+            continue;
+        }
+        if (!inTuple)
+        {
+            if (c == '(')
+            {
+                inTuple = true;
+                row.clear();
+                value.clear();
+            }
+            else if (c == ';')
+            {
+                return true;
+            }
+            else if (c == '-' && pos + 1 < sql.size() && sql[pos + 1] == '-')
+            {
+                pos = sql.find('\n', pos);
+                if (pos == std::string::npos)
+                {
+                    return false;
+                }
+            }
+            continue;
+        }
+        switch (c)
+        {
+            case '\'':
+                inString = true;
+                break;
+            case ',':
+                row.push_back(value);
+                value.clear();
+                break;
+            case ')':
+                row.push_back(value);
+                rows.push_back(row);
+                inTuple = false;
+                break;
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                break;
+            default:
+                value += c;
+                break;
+        }
+    }
+    return false;
+}
+
+bool loadSqlInsertRows(std::string const& path, std::string const& table, std::vector<SqlRow>& rows, std::string& error)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string sql = buffer.str();
+
+    std::string const insert = "INSERT INTO " + table + " ";
+    bool found = false;
+    for (size_t pos = sql.find(insert); pos != std::string::npos; pos = sql.find(insert, pos + insert.size()))
+    {
+        size_t values = sql.find("VALUES", pos);
+        if (values == std::string::npos || !parseSqlValues(sql, values + 6, rows))
+        {
+            error = "unterminated INSERT INTO " + table + " in " + path;
+            return false;
+        }
+        found = true;
+    }
+    if (!found)
+    {
+        error = "no INSERT INTO " + table + " in " + path;
+        return false;
+    }
+    return true;
+}
+
+static uint32 sqlUInt32(std::string const& value)
+{
+    return uint32(std::strtoul(value.c_str(), nullptr, 10));
+}
+
+bool loadSuffixCatalogFromSql(std::string const& path, std::vector<RandomSuffixCatalogEntry>& catalog, std::string& error)
+{
+    // itemrandomsuffix_dbc columns: ID, Name_Lang_enUS, Name_Lang_Mask, InternalName, Enchantment_1..5, AllocationPct_1..5
+    std::vector<SqlRow> suffixRows;
+    if (!loadSqlInsertRows(path, "itemrandomsuffix_dbc", suffixRows, error))
+    {
+        return false;
+    }
+    std::unordered_map<uint32, uint32> minAllocPcts;
+    for (SqlRow const& row : suffixRows)
+    {
+        if (row.size() != 14)
+        {
+            error = "unexpected itemrandomsuffix_dbc row with " + std::to_string(row.size()) + " columns";
+            return false;
+        }
+        uint32 minAllocPct = 3567587328;
+        for (uint8 k = 0; k != MAX_ITEM_ENCHANTMENT_EFFECTS; ++k)
+        {
+            uint32 allocPct = sqlUInt32(row[9 + k]);
+            if (allocPct > 100 && minAllocPct > allocPct)
+            {
+                minAllocPct = allocPct;
+            }
+        }
+        minAllocPcts[sqlUInt32(row[0])] = minAllocPct;
+    }
+
+    // item_enchantment_random_suffixes columns: SuffixID, MinLevel, MaxLevel, AttributeMask, ItemClass, ItemSubClassMask, EnchantQuality, EnchantCategoryMask,
+    // and Weight, which SQL generated before it was added does not have
+    std::vector<SqlRow> catalogRows;
+    if (!loadSqlInsertRows(path, "item_enchantment_random_suffixes", catalogRows, error))
+    {
+        return false;
+    }
+    catalog.clear();
+    catalog.reserve(catalogRows.size());
+    for (SqlRow const& row : catalogRows)
+    {
+        if (row.size() != 8 && row.size() != 9)
+        {
+            error = "unexpected item_enchantment_random_suffixes row with " + std::to_string(row.size()) + " columns";
+            return false;
+        }
+        RandomSuffixCatalogEntry entry;
+        entry.SuffixID = sqlUInt32(row[0]);
+        auto itr = minAllocPcts.find(entry.SuffixID);
+        // Same as the INNER JOIN of the server, suffixes missing from itemrandomsuffix_dbc are never rolled
+        if (itr == minAllocPcts.end())
+        {
+            continue;
+        }
+        entry.MinLevel = sqlUInt32(row[1]);
+        entry.MaxLevel = sqlUInt32(row[2]);
+        entry.AttributeMask = sqlUInt32(row[3]);
+        entry.ItemClass = sqlUInt32(row[4]);
+        entry.ItemSubClassMask = sqlUInt32(row[5]);
+        entry.EnchantQuality = sqlUInt32(row[6]);
+        entry.EnchantCategoryMask = sqlUInt32(row[7]);
+        entry.Weight = row.size() > 8 ? sqlUInt32(row[8]) : 1;
+        entry.MinAllocPct = itr->second;
+        entry.InStore = true;
+        catalog.push_back(entry);
+    }
+    std::sort(catalog.begin(), catalog.end(), [](RandomSuffixCatalogEntry const& a, RandomSuffixCatalogEntry const& b)
+    {
+        return a.SuffixID < b.SuffixID;
+    });
+    return true;
+}
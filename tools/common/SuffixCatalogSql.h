@@ -0,0 +1,21 @@
+/*
+* Loads the suffix catalog from the generated mod_acore_random_suffix.sql, so that the offline tools
+* roll against the same suffixes as a server with the module installed.
+*/
+#ifndef _SUFFIX_CATALOG_SQL_H_
+#define _SUFFIX_CATALOG_SQL_H_
+
+#include "RandomSuffixEngine.h"
+#include <string>
+#include <vector>
+
+typedef std::vector<std::string> SqlRow;
+
+// loadSqlInsertRows reads the values of every INSERT INTO <table> statement in the SQL file
+bool loadSqlInsertRows(std::string const& path, std::string const& table, std::vector<SqlRow>& rows, std::string& error);
+
+// loadSuffixCatalogFromSql builds the catalog the same way as RandomEnchantsMgr::LoadSuffixCatalog,
+// joining item_enchantment_random_suffixes with itemrandomsuffix_dbc. The catalog is sorted by SuffixID.
+bool loadSuffixCatalogFromSql(std::string const& path, std::vector<RandomSuffixCatalogEntry>& catalog, std::string& error);
+
+#endif
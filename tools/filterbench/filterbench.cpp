@@ -0,0 +1,213 @@
+/*
+* filterbench times the candidate filter of the in-process engine over the whole suffix catalog, for roll queries
+* with the masks of the player class preference path, which vary per player and so cannot be bucketed ahead.
+*
+* The row by row filter the engine used before (getSuffixCandidates) is timed against the column store with every
+* instruction set the CPU supports, and against the precomputed alias tables of AliasSuffixSource. Before timing, every
+* filter is checked to match the same rows as the row by row one, and ColumnarSuffixSource and AliasSuffixSource to
+* pick the same suffix as CatalogSuffixSource for every query. --random-weights gives every catalog row a random weight
+* from 0 to 8 first, so the weighted picks are checked as well.
+*
+* Usage: filterbench --sql <mod_acore_random_suffix.sql> [--queries <n>] [--repeat <n>] [--random-weights <seed>]
+*/
+#include "RandomSuffixAlias.h"
+#include "RollCorpus.h"
+#include "SuffixCatalogSql.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// buildQueries turns a generated corpus into roll queries, each with the masks of the player's class and spec
+// and a random tier
+static void buildQueries(uint32 count, std::vector<SuffixRollQuery>& queries)
+{
+    std::vector<CorpusRoll> corpus;
+    generateRollCorpus(count, 1, corpus);
+    SuffixRollRng rng(1);
+    for (CorpusRoll const& roll : corpus)
+    {
+        EnchantMasks masks = getEnchantCategoryMaskByClassAndSpec(roll.Context.PlayerClass, roll.Context.PlayerSpec);
+        queries.push_back({roll.Context.ItemPlayerLevel, roll.Item.Class, uint32(1) << roll.Item.SubClass,
+            uint32(rng() % MAX_RAND_ENCHANT_TIERS), masks.attrMask, masks.enchCatMask});
+    }
+}
+
+// checkFilters returns false if a filter or a pick differs from the row by row filter
+static bool checkFilters(std::vector<RandomSuffixCatalogEntry> const& catalog, SuffixCatalogColumns const& columns,
+    SuffixAliasTables const& aliasTables, std::vector<SuffixRollQuery> const& queries, std::vector<SuffixFilterIsa> const& isas)
+{
+    std::vector<uint32> expected;
+    std::vector<uint32> got;
+    std::vector<uint64> matches;
+    for (size_t q = 0; q < queries.size(); ++q)
+    {
+        getSuffixCandidates(catalog, queries[q], expected);
+        for (SuffixFilterIsa isa : isas)
+        {
+            got.clear();
+            uint32 count = columns.Filter(queries[q], matches, isa);
+            columns.GetMatchSuffixIDs(matches, got);
+            if (got != expected || count != expected.size())
+            {
+                std::fprintf(stderr, "%s filter matches %zu rows instead of %zu for query %zu\n", getSuffixFilterIsaName(isa),
+                    got.size(), expected.size(), q);
+                return false;
+            }
+        }
+    }
+    CatalogSuffixSource rowSource(catalog);
+    ColumnarSuffixSource columnSource(catalog, columns);
+    AliasSuffixSource aliasSource(catalog, columns, aliasTables);
+    for (size_t q = 0; q < queries.size(); ++q)
+    {
+        SuffixRollRng rowRng(q);
+        SuffixRollRng columnRng(q);
+        SuffixRollRng aliasRng(q);
+        int32 rowPick = rowSource.PickCandidate(queries[q], rowRng);
+        int32 columnPick = columnSource.PickCandidate(queries[q], columnRng);
+        int32 aliasPick = aliasSource.PickCandidate(queries[q], aliasRng);
+        if (rowPick != columnPick || rowPick != aliasPick)
+        {
+            std::fprintf(stderr, "ColumnarSuffixSource picks %d and AliasSuffixSource %d instead of %d for query %zu\n", columnPick, aliasPick,
+                rowPick, q);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void printUsage()
+{
+    std::fprintf(stderr, "usage: filterbench --sql <mod_acore_random_suffix.sql> [--queries <n>] [--repeat <n>] [--random-weights <seed>]\n");
+}
+
+int main(int argc, char** argv)
+{
+    std::string sqlPath;
+    uint32 queryCount = 10000;
+    uint32 repeat = 5;
+    bool randomWeights = false;
+    uint32 weightSeed = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 2;
+        }
+        std::string value = argv[++i];
+        if (arg == "--sql")
+            sqlPath = value;
+        else if (arg == "--queries")
+            queryCount = std::max<uint32>(1, uint32(std::strtoul(value.c_str(), nullptr, 10)));
+        else if (arg == "--repeat")
+            repeat = std::max<uint32>(1, uint32(std::strtoul(value.c_str(), nullptr, 10)));
+        else if (arg == "--random-weights")
+        {
+            randomWeights = true;
+            weightSeed = uint32(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        else
+        {
+            printUsage();
+            return 2;
+        }
+    }
+    if (sqlPath.empty())
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<RandomSuffixCatalogEntry> catalog;
+    std::string error;
+    if (!loadSuffixCatalogFromSql(sqlPath, catalog, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (randomWeights)
+    {
+        SuffixRollRng weightRng(weightSeed);
+        for (RandomSuffixCatalogEntry& entry : catalog)
+        {
+            entry.Weight = weightRng() % 9;
+        }
+    }
+    SuffixCatalogColumns columns(catalog);
+    auto aliasStart = std::chrono::steady_clock::now();
+    SuffixAliasTables aliasTables(catalog);
+    double aliasBuildMillis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - aliasStart).count();
+    std::vector<SuffixRollQuery> queries;
+    buildQueries(queryCount, queries);
+    std::vector<SuffixFilterIsa> isas;
+    for (uint32 isa = 0; isa < MAX_SUFFIX_FILTER_ISAS; ++isa)
+    {
+        if (isSuffixFilterIsaSupported(SuffixFilterIsa(isa)))
+        {
+            isas.push_back(SuffixFilterIsa(isa));
+        }
+    }
+    if (!checkFilters(catalog, columns, aliasTables, queries, isas))
+    {
+        return 1;
+    }
+
+    std::printf("catalog: %zu suffixes, queries: %zu, repeat: %u, best: %s\n", catalog.size(), queries.size(), repeat,
+        getSuffixFilterIsaName(getBestSuffixFilterIsa()));
+    std::printf("alias tables: %u for %u buckets, %zu bytes, built in %.1f ms\n", aliasTables.GetTableCount(), aliasTables.GetBucketCount(),
+        aliasTables.GetMemorySize(), aliasBuildMillis);
+    std::printf("%-10s %12s %12s %10s %10s\n", "filter", "ns/query", "rows/ns", "speedup", "matches");
+
+    // The matches are summed so the filters cannot be optimised away
+    std::vector<uint32> candidates;
+    uint64 rowMatches = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 r = 0; r < repeat; ++r)
+    {
+        for (SuffixRollQuery const& query : queries)
+        {
+            getSuffixCandidates(catalog, query, candidates);
+            rowMatches += candidates.size();
+        }
+    }
+    double rowNanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (double(repeat) * queries.size());
+    std::printf("%-10s %12.0f %12.2f %9.2fx %10llu\n", "rows", rowNanos, catalog.size() / rowNanos, 1.0, (unsigned long long)rowMatches);
+
+    std::vector<uint64> matches;
+    for (SuffixFilterIsa isa : isas)
+    {
+        uint64 columnMatches = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32 r = 0; r < repeat; ++r)
+        {
+            for (SuffixRollQuery const& query : queries)
+            {
+                columnMatches += columns.Filter(query, matches, isa);
+            }
+        }
+        double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (double(repeat) * queries.size());
+        std::printf("%-10s %12.0f %12.2f %9.2fx %10llu\n", getSuffixFilterIsaName(isa), nanos, catalog.size() / nanos, rowNanos / nanos,
+            (unsigned long long)columnMatches);
+    }
+
+    // The alias picks are timed against the filters, a pick without a table has to filter first
+    AliasSuffixSource aliasSource(catalog, columns, aliasTables);
+    SuffixRollRng rng(1);
+    uint64 aliasPicks = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32 r = 0; r < repeat; ++r)
+    {
+        for (SuffixRollQuery const& query : queries)
+        {
+            aliasPicks += aliasSource.PickCandidate(query, rng) >= 0;
+        }
+    }
+    double aliasNanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (double(repeat) * queries.size());
+    std::printf("%-10s %12.0f %12.2f %9.2fx %10llu\n", "alias", aliasNanos, catalog.size() / aliasNanos, rowNanos / aliasNanos,
+        (unsigned long long)aliasPicks);
+    return 0;
+}
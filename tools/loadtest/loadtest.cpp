@@ -0,0 +1,336 @@
+/*
+* loadtest drives the roll pipeline from many threads at once, like the map update threads of a busy
+* worldserver (MapUpdate.Threads) rolling suffixes for every player looting at the same time.
+*
+* The world database is replaced by an in-process stand-in loaded from mod_acore_random_suffix.sql. With
+* --engine sql every candidate pick goes through it like the SQL engine of the module: the stand-in scans
+* the whole item_enchantment_random_suffixes table per query and each query holds one of --db-connections
+* connections, the same as the synchronous world database connections of the worldserver. With
+* --engine inprocess each thread picks from the alias tables of the catalog itself, like RandomEnchants.SuffixEngine = 1,
+* and --engine scalar filters the catalog rows one at a time as the in-process engine did before the column store.
+*
+* The acquisition events are drawn from a captured roll trace (--trace) or a generated item corpus.
+* For every thread count the latency percentiles and the throughput are reported, so the point where
+* adding threads stops adding throughput is visible.
+*
+* Built with -DRANDOM_SUFFIX_PROFILE=ON, --profile writes the profiling zones of every roll to a Chrome trace.
+*
+* Usage: loadtest --sql <mod_acore_random_suffix.sql> [--trace <trace> | --items <n>] [--threads 1,2,4,8]
+*                 [--events <n>] [--engine sql|inprocess|scalar] [--db-connections <n>] [--profile <trace.json>]
+*/
+#include "LatencyStats.h"
+#include "RandomSuffixAlias.h"
+#include "RandomSuffixProfile.h"
+#include "RollCorpus.h"
+#include "SuffixCatalogSql.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// FakeWorldDatabase serves the roll query from an in-memory copy of item_enchantment_random_suffixes
+class FakeWorldDatabase
+{
+public:
+    FakeWorldDatabase(std::vector<RandomSuffixCatalogEntry> const& catalog, uint32 connections)
+        : _catalog(catalog), _connectionCount(connections), _connections(new std::mutex[connections]), _nextConnection(0) { }
+
+    // QueryRandomSuffix is SELECT SuffixID ... ORDER BY -LOG(1 - RAND()) / Weight LIMIT 1, -1 if there is no row
+    int32 QueryRandomSuffix(SuffixRollQuery const& query, SuffixRollRng& rng, std::vector<uint32>& rows)
+    {
+        std::unique_lock<std::mutex> connection = AcquireConnection();
+        // No index covers the filtered columns, so every query is a full table scan
+        getSuffixCandidateRows(_catalog, query, rows);
+        if (rows.empty())
+        {
+            return -1;
+        }
+        uint64 totalWeight = 0;
+        for (uint32 row : rows)
+        {
+            totalWeight += _catalog[row].Weight;
+        }
+        uint64 pick = std::uniform_int_distribution<uint64>(0, totalWeight - 1)(rng);
+        for (uint32 row : rows)
+        {
+            if (pick < _catalog[row].Weight)
+            {
+                return _catalog[row].SuffixID;
+            }
+            pick -= _catalog[row].Weight;
+        }
+        return _catalog[rows.back()].SuffixID;
+    }
+
+private:
+    std::unique_lock<std::mutex> AcquireConnection()
+    {
+        uint32 first = _nextConnection.fetch_add(1, std::memory_order_relaxed) % _connectionCount;
+        for (uint32 i = 0; i < _connectionCount; ++i)
+        {
+            std::unique_lock<std::mutex> connection(_connections[(first + i) % _connectionCount], std::try_to_lock);
+            if (connection.owns_lock())
+            {
+                return connection;
+            }
+        }
+        // Every connection is busy, wait for one like the database worker queue does
+        return std::unique_lock<std::mutex>(_connections[first]);
+    }
+
+    std::vector<RandomSuffixCatalogEntry> const& _catalog;
+    uint32 _connectionCount;
+    std::unique_ptr<std::mutex[]> _connections;
+    std::atomic<uint32> _nextConnection;
+};
+
+// FakeWorldDatabaseSource is the SQL engine of the module on top of the stand-in. The suffix DBC store
+// lookups stay in memory, the same as sItemRandomSuffixStore.
+class FakeWorldDatabaseSource : public CatalogSuffixSource
+{
+public:
+    FakeWorldDatabaseSource(std::vector<RandomSuffixCatalogEntry> const& catalog, FakeWorldDatabase& db)
+        : CatalogSuffixSource(catalog), _db(db) { }
+
+    int32 PickCandidate(SuffixRollQuery const& query, SuffixRollRng& rng) override
+    {
+        return _db.QueryRandomSuffix(query, rng, _rows);
+    }
+
+private:
+    FakeWorldDatabase& _db;
+};
+
+struct LoadTestOptions
+{
+    std::string SqlPath;
+    std::string TracePath;
+    uint32 Items = 50000;
+    uint32 Events = 200000;
+    std::vector<uint32> Threads = { 1, 2, 4, 8 };
+    std::string Engine = "sql";
+    uint32 DbConnections = 1;
+    std::string ProfilePath;
+};
+
+struct LoadTestResult
+{
+    double Seconds;
+    uint64 Rolled;
+    LatencySummary Latency;
+};
+
+// Events are handed out in small batches so the shared counter is not the bottleneck being measured
+#define LOAD_TEST_EVENT_BATCH 64
+
+static LoadTestResult runLoadTest(LoadTestOptions const& options, uint32 threadCount, std::vector<RandomSuffixCatalogEntry> const& catalog,
+    std::vector<SuffixRollSettings> const& settings, std::vector<CorpusRoll> const& corpus)
+{
+    FakeWorldDatabase db(catalog, options.DbConnections);
+    SuffixCatalogColumns columns(catalog);
+    SuffixAliasTables aliasTables(catalog);
+    std::atomic<uint64> nextEvent(0);
+    std::atomic<uint64> rolled(0);
+    std::atomic<uint32> ready(0);
+    std::atomic<bool> start(false);
+    std::vector<std::vector<uint64>> latencies(threadCount);
+    std::vector<std::thread> workers;
+    for (uint32 t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&, t]()
+        {
+            std::unique_ptr<SuffixCandidateSource> source;
+            if (options.Engine == "sql")
+            {
+                source.reset(new FakeWorldDatabaseSource(catalog, db));
+            }
+            else if (options.Engine == "inprocess")
+            {
+                source.reset(new AliasSuffixSource(catalog, columns, aliasTables));
+            }
+            else
+            {
+                source.reset(new CatalogSuffixSource(catalog));
+            }
+            std::vector<uint64>& threadLatencies = latencies[t];
+            threadLatencies.reserve(options.Events / threadCount + LOAD_TEST_EVENT_BATCH);
+            uint64 threadRolled = 0;
+
+            ready.fetch_add(1);
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (;;)
+            {
+                uint64 first = nextEvent.fetch_add(LOAD_TEST_EVENT_BATCH, std::memory_order_relaxed);
+                if (first >= options.Events)
+                {
+                    break;
+                }
+                uint64 last = std::min<uint64>(first + LOAD_TEST_EVENT_BATCH, options.Events);
+                for (uint64 event = first; event < last; ++event)
+                {
+                    CorpusRoll const& roll = corpus[event % corpus.size()];
+                    SuffixRollContext ctx = roll.Context;
+                    // Repeated corpus entries still roll differently, as separate drops would
+                    ctx.Seed = roll.Context.Seed ^ uint32(event * 2654435761u);
+                    auto rollStart = std::chrono::steady_clock::now();
+                    if (rollSuffix(&roll.Item, ctx, settings[roll.SettingsIndex], *source) >= 0)
+                    {
+                        ++threadRolled;
+                    }
+                    threadLatencies.push_back(uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - rollStart).count()));
+                }
+            }
+            rolled.fetch_add(threadRolled);
+        });
+    }
+    while (ready.load() != threadCount)
+    {
+        std::this_thread::yield();
+    }
+    auto wallStart = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    LoadTestResult result;
+    result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    result.Rolled = rolled.load();
+
+    std::vector<uint64> all;
+    all.reserve(options.Events);
+    for (std::vector<uint64> const& threadLatencies : latencies)
+    {
+        all.insert(all.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    result.Latency = summarizeLatencies(all);
+    return result;
+}
+
+static bool parseThreadCounts(std::string const& value, std::vector<uint32>& threads)
+{
+    threads.clear();
+    std::stringstream ss(value);
+    std::string count;
+    while (std::getline(ss, count, ','))
+    {
+        uint32 n = uint32(std::strtoul(count.c_str(), nullptr, 10));
+        if (n == 0)
+        {
+            return false;
+        }
+        threads.push_back(n);
+    }
+    return !threads.empty();
+}
+
+static void printUsage()
+{
+    std::fprintf(stderr, "usage: loadtest --sql <mod_acore_random_suffix.sql> [--trace <trace> | --items <n>] [--threads 1,2,4,8] [--events <n>] [--engine sql|inprocess|scalar] [--db-connections <n>] [--profile <trace.json>]\n");
+}
+
+int main(int argc, char** argv)
+{
+    LoadTestOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 2;
+        }
+        std::string value = argv[++i];
+        if (arg == "--sql")
+            options.SqlPath = value;
+        else if (arg == "--trace")
+            options.TracePath = value;
+        else if (arg == "--items")
+            options.Items = std::max<uint32>(1, uint32(std::strtoul(value.c_str(), nullptr, 10)));
+        else if (arg == "--events")
+            options.Events = std::max<uint32>(1, uint32(std::strtoul(value.c_str(), nullptr, 10)));
+        else if (arg == "--db-connections")
+            options.DbConnections = std::max<uint32>(1, uint32(std::strtoul(value.c_str(), nullptr, 10)));
+        else if (arg == "--engine" && (value == "sql" || value == "inprocess" || value == "scalar"))
+            options.Engine = value;
+        else if (arg == "--threads" && parseThreadCounts(value, options.Threads))
+            continue;
+        else if (arg == "--profile")
+            options.ProfilePath = value;
+        else
+        {
+            printUsage();
+            return 2;
+        }
+    }
+    if (options.SqlPath.empty())
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<RandomSuffixCatalogEntry> catalog;
+    std::string error;
+    if (!loadSuffixCatalogFromSql(options.SqlPath, catalog, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    std::vector<SuffixRollSettings> settings;
+    std::vector<CorpusRoll> corpus;
+    if (!options.TracePath.empty())
+    {
+        if (!loadRollTrace(options.TracePath, settings, corpus, error))
+        {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        if (corpus.empty())
+        {
+            std::fprintf(stderr, "%s has no rolls\n", options.TracePath.c_str());
+            return 1;
+        }
+    }
+    else
+    {
+        settings.push_back(defaultRollSettings());
+        generateRollCorpus(options.Items, 1, corpus);
+    }
+    if (!options.ProfilePath.empty())
+    {
+#ifdef RANDOM_SUFFIX_PROFILE
+        if (!openRandomSuffixProfile(options.ProfilePath))
+        {
+            std::fprintf(stderr, "cannot open %s\n", options.ProfilePath.c_str());
+            return 1;
+        }
+#else
+        std::fprintf(stderr, "--profile needs a build with -DRANDOM_SUFFIX_PROFILE=ON\n");
+        return 2;
+#endif
+    }
+    std::printf("catalog: %zu suffixes, corpus: %zu items, engine: %s, db connections: %u, hardware threads: %u\n",
+        catalog.size(), corpus.size(), options.Engine.c_str(), options.DbConnections, std::thread::hardware_concurrency());
+    std::printf("%8s %10s %9s %12s %10s %10s %10s %10s %8s\n", "threads", "events", "seconds", "rolls/s", "p50 ns", "p99 ns", "p999 ns", "max ns", "hit %");
+
+    for (uint32 threadCount : options.Threads)
+    {
+        LoadTestResult result = runLoadTest(options, threadCount, catalog, settings, corpus);
+        std::printf("%8u %10u %9.3f %12.0f %10llu %10llu %10llu %10llu %8.2f\n", threadCount, options.Events, result.Seconds,
+            result.Seconds > 0 ? double(options.Events) / result.Seconds : 0.0,
+            (unsigned long long)result.Latency.P50, (unsigned long long)result.Latency.P99,
+            (unsigned long long)result.Latency.P999, (unsigned long long)result.Latency.Max,
+            100.0 * double(result.Rolled) / double(options.Events));
+    }
+    RANDOM_SUFFIX_PROFILE_CLOSE();
+    return 0;
+}
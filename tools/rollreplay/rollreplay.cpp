@@ -0,0 +1,197 @@
+/*
+* rollreplay replays a roll trace captured by RandomEnchants.CaptureTraceFile against the in-process suffix engine.
+*
+* Every roll is replayed with its captured seed, so two builds given the same trace and SQL roll the same suffixes
+* unless the roll logic changed. Save the results of one build with --out and diff another build against them with
+* --compare to catch behaviour changes, while the throughput and latency numbers show performance changes.
+*
+* Usage: rollreplay --sql <mod_acore_random_suffix.sql> --trace <trace> [--out <results>] [--compare <results>]
+*                   [--repeat <n>] [--max-diffs <n>]
+*/
+#include "LatencyStats.h"
+#include "RollCorpus.h"
+#include "SuffixCatalogSql.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static char const rollResultsMagic[4] = {'R', 'S', 'R', 'S'};
+
+static bool writeResults(std::string const& path, std::vector<int32> const& results)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(rollResultsMagic, sizeof(rollResultsMagic));
+    for (int32 suffixId : results)
+    {
+        uint32 value = uint32(suffixId);
+        char bytes[4] = { char(value & 0xFF), char((value >> 8) & 0xFF), char((value >> 16) & 0xFF), char((value >> 24) & 0xFF) };
+        out.write(bytes, sizeof(bytes));
+    }
+    return bool(out);
+}
+
+static bool readResults(std::string const& path, std::vector<int32>& results)
+{
+    std::ifstream in(path, std::ios::binary);
+    char magic[sizeof(rollResultsMagic)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, rollResultsMagic, sizeof(magic)) != 0)
+    {
+        std::fprintf(stderr, "%s is not a rollreplay results file\n", path.c_str());
+        return false;
+    }
+    char bytes[4];
+    while (in.read(bytes, sizeof(bytes)))
+    {
+        uint32 value = uint32(uint8(bytes[0])) | uint32(uint8(bytes[1])) << 8 | uint32(uint8(bytes[2])) << 16 | uint32(uint8(bytes[3])) << 24;
+        results.push_back(int32(value));
+    }
+    return true;
+}
+
+static void printUsage()
+{
+    std::fprintf(stderr, "usage: rollreplay --sql <mod_acore_random_suffix.sql> --trace <trace> [--out <results>] [--compare <results>] [--repeat <n>] [--max-diffs <n>]\n");
+}
+
+int main(int argc, char** argv)
+{
+    std::string sqlPath;
+    std::string tracePath;
+    std::string outPath;
+    std::string comparePath;
+    uint32 repeat = 1;
+    uint32 maxDiffs = 20;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 2;
+        }
+        if (arg == "--sql")
+            sqlPath = argv[++i];
+        else if (arg == "--trace")
+            tracePath = argv[++i];
+        else if (arg == "--out")
+            outPath = argv[++i];
+        else if (arg == "--compare")
+            comparePath = argv[++i];
+        else if (arg == "--repeat")
+            repeat = std::max<uint32>(1, uint32(std::strtoul(argv[++i], nullptr, 10)));
+        else if (arg == "--max-diffs")
+            maxDiffs = uint32(std::strtoul(argv[++i], nullptr, 10));
+        else
+        {
+            printUsage();
+            return 2;
+        }
+    }
+    if (sqlPath.empty() || tracePath.empty())
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<RandomSuffixCatalogEntry> catalog;
+    std::string error;
+    if (!loadSuffixCatalogFromSql(sqlPath, catalog, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    std::vector<SuffixRollSettings> settings;
+    std::vector<CorpusRoll> rolls;
+    if (!loadRollTrace(tracePath, settings, rolls, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    std::printf("catalog: %zu suffixes, trace: %zu rolls, %zu settings records\n", catalog.size(), rolls.size(), settings.size());
+
+    CatalogSuffixSource source(catalog);
+    std::vector<int32> results(rolls.size(), -1);
+    std::vector<uint64> latencies;
+    latencies.reserve(rolls.size() * repeat);
+    auto replayStart = std::chrono::steady_clock::now();
+    for (uint32 pass = 0; pass < repeat; ++pass)
+    {
+        for (size_t i = 0; i < rolls.size(); ++i)
+        {
+            CorpusRoll const& roll = rolls[i];
+            auto start = std::chrono::steady_clock::now();
+            results[i] = rollSuffix(&roll.Item, roll.Context, settings[roll.SettingsIndex], source);
+            latencies.push_back(uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStart).count();
+
+    uint64 rolled = 0;
+    uint64 bySource[MAX_ROLL_SOURCES] = {};
+    for (size_t i = 0; i < rolls.size(); ++i)
+    {
+        if (results[i] >= 0)
+        {
+            ++rolled;
+        }
+        if (rolls[i].Context.Source < MAX_ROLL_SOURCES)
+        {
+            ++bySource[rolls[i].Context.Source];
+        }
+    }
+    std::printf("replayed %zu rolls in %.3f s: %.0f rolls/s\n", latencies.size(), seconds, seconds > 0 ? double(latencies.size()) / seconds : 0.0);
+    printLatencySummary(summarizeLatencies(latencies));
+    std::printf("suffix rolled: %llu of %zu (%.2f%%)\n", (unsigned long long)rolled, rolls.size(), rolls.empty() ? 0.0 : 100.0 * double(rolled) / double(rolls.size()));
+    std::printf("by source: loot=%llu create=%llu quest_reward=%llu group_roll=%llu vendor_purchase=%llu\n",
+        (unsigned long long)bySource[ROLL_SOURCE_LOOT], (unsigned long long)bySource[ROLL_SOURCE_CREATE],
+        (unsigned long long)bySource[ROLL_SOURCE_QUEST_REWARD], (unsigned long long)bySource[ROLL_SOURCE_GROUP_ROLL],
+        (unsigned long long)bySource[ROLL_SOURCE_VENDOR_PURCHASE]);
+
+    if (!outPath.empty())
+    {
+        if (!writeResults(outPath, results))
+        {
+            std::fprintf(stderr, "cannot write %s\n", outPath.c_str());
+            return 1;
+        }
+        std::printf("results written to %s\n", outPath.c_str());
+    }
+
+    if (comparePath.empty())
+    {
+        return 0;
+    }
+    std::vector<int32> expected;
+    if (!readResults(comparePath, expected))
+    {
+        return 1;
+    }
+    if (expected.size() != results.size())
+    {
+        std::printf("results differ in size: %zu in %s, %zu replayed\n", expected.size(), comparePath.c_str(), results.size());
+        return 1;
+    }
+    uint64 diffs = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (expected[i] == results[i])
+        {
+            continue;
+        }
+        if (diffs++ < maxDiffs)
+        {
+            CorpusRoll const& roll = rolls[i];
+            std::printf("diff roll %zu: item %u (class %u subclass %u quality %u) item level %u player class %u spec %u level %u can use %u source %u seed %u: expected %d, got %d\n",
+                i, roll.Item.ItemId, uint32(roll.Item.Class), uint32(roll.Item.SubClass), uint32(roll.Item.Quality),
+                uint32(roll.Context.ItemPlayerLevel), uint32(roll.Context.PlayerClass), uint32(roll.Context.PlayerSpec),
+                uint32(roll.Context.PlayerLevel), uint32(roll.Context.PlayerCanUseItem), uint32(roll.Context.Source),
+                roll.Context.Seed, expected[i], results[i]);
+        }
+    }
+    std::printf("%llu of %zu rolls differ from %s\n", (unsigned long long)diffs, results.size(), comparePath.c_str());
+    return diffs == 0 ? 0 : 1;
+}